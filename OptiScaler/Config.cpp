@@ -50,6 +50,8 @@ bool Config::Reload(std::filesystem::path iniPath)
         {
             Dx11Upscaler.set_from_config(readString("Upscalers", "Dx11Upscaler", true));
             Dx12Upscaler.set_from_config(readString("Upscalers", "Dx12Upscaler", true));
+            Dx12WarmBackendSwitch.set_from_config(readBool("Upscalers", "Dx12WarmBackendSwitch"));
+            Dx12WarmPreCreate.set_from_config(readBool("Upscalers", "Dx12WarmPreCreate"));
             VulkanUpscaler.set_from_config(readString("Upscalers", "VulkanUpscaler", true));
         }
 
@@ -71,10 +73,15 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGEnabled.set_from_config(readBool("OptiFG", "Enabled"));
             FGDebugView.set_from_config(readBool("OptiFG", "DebugView"));
             FGAsync.set_from_config(readBool("OptiFG", "AllowAsync"));
+
+            if (auto setting = readInt("OptiFG", "QueuePolicy"); setting.has_value())
+                FGQueuePolicy.set_from_config(std::clamp(setting.value(), 0, 2));
+
             FGHUDFix.set_from_config(readBool("OptiFG", "HUDFix"));
             FGHUDLimit.set_from_config(readInt("OptiFG", "HUDLimit"));
             FGHUDFixExtended.set_from_config(readBool("OptiFG", "HUDFixExtended"));
             FGImmediateCapture.set_from_config(readBool("OptiFG", "HUDFixImmadiate"));
+            FGHUDFixDeferredTransfer.set_from_config(readBool("OptiFG", "HUDFixDeferredTransfer"));
             FGRectLeft.set_from_config(readInt("OptiFG", "RectLeft"));
             FGRectTop.set_from_config(readInt("OptiFG", "RectTop"));
             FGRectWidth.set_from_config(readInt("OptiFG", "RectWidth"));
@@ -82,12 +89,14 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGAlwaysTrackHeaps.set_from_config(readBool("OptiFG", "AlwaysTrackHeaps"));
             FGMakeDepthCopy.set_from_config(readBool("OptiFG", "MakeDepthCopy"));
             FGMakeMVCopy.set_from_config(readBool("OptiFG", "MakeMVCopy"));
+            FGInputHandoff.set_from_config(readBool("OptiFG", "InputHandoff"));
             FGUseMutexForSwapchain.set_from_config(readBool("OptiFG", "UseMutexForSwapchain"));
 
             FGEnableDepthScale.set_from_config(readBool("OptiFG", "EnableDepthScale"));
             FGDepthScaleMax.set_from_config(readFloat("OptiFG", "DepthScaleMax"));
 
             FGFramePacingTuning.set_from_config(readBool("OptiFG", "FramePacingTuning"));
+            FGAdaptivePacing.set_from_config(readBool("OptiFG", "AdaptivePacing"));
             FGFPTSafetyMarginInMs.set_from_config(readFloat("OptiFG", "FPTSafetyMarginInMs"));
             FGFPTVarianceFactor.set_from_config(readFloat("OptiFG", "FPTVarianceFactor"));
             FGFPTAllowHybridSpin.set_from_config(readBool("OptiFG", "FPTHybridSpin"));
@@ -101,6 +110,7 @@ bool Config::Reload(std::filesystem::path iniPath)
         // Framerate
         {
             FramerateLimit.set_from_config(readFloat("Framerate", "FramerateLimit"));
+            FramerateLimitAdaptive.set_from_config(readBool("Framerate", "AdaptiveLimit"));
         }
 
         // FSR Common
@@ -261,10 +271,14 @@ bool Config::Reload(std::filesystem::path iniPath)
             if (auto setting = readFloat("Menu", "FpsOverlayAlpha"); setting.has_value())
                 FpsOverlayAlpha.set_from_config(std::clamp(setting.value(), 0.0f, 1.0f));
 
+            if (auto setting = readInt("Menu", "FpsOverlayUpdateRate"); setting.has_value())
+                FpsOverlayUpdateRate.set_from_config(std::clamp(setting.value(), 0, 240));
+
             if (auto setting = readFloat("Menu", "FpsScale"); setting.has_value())
                 FpsScale.set_from_config(std::clamp(setting.value(), 0.5f, 2.0f));
 
             TTFFontPath.set_from_config(readWString("Menu", "TTFFontPath"));
+            FontCache.set_from_config(readBool("Menu", "FontCache"));
         }
 
         // Hooks
@@ -288,6 +302,10 @@ bool Config::Reload(std::filesystem::path iniPath)
             if (auto setting = readFloat("CAS", "MotionScaleLimit"); setting.has_value())
                 MotionScaleLimit.set_from_config(std::clamp(setting.value(), 0.01f, 100.0f));
 
+            RcasTiled.set_from_config(readBool("CAS", "Tiled"));
+            if (auto setting = readFloat("CAS", "TileSkipThreshold"); setting.has_value())
+                RcasTileSkipThreshold.set_from_config(std::clamp(setting.value(), 0.0f, 2.0f));
+
             ContrastEnabled.set_from_config(readBool("CAS", "ContrastEnabled"));
             if (auto setting = readFloat("CAS", "Contrast"); setting.has_value())
                 Contrast.set_from_config(std::clamp(setting.value(), -2.0f, 2.0f));
@@ -298,6 +316,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             OutputScalingEnabled.set_from_config(readBool("OutputScaling", "Enabled"));
             OutputScalingUseFsr.set_from_config(readBool("OutputScaling", "UseFsr"));
             OutputScalingDownscaler.set_from_config(readInt("OutputScaling", "Downscaler"));
+            OutputScalingFusedRcas.set_from_config(readBool("OutputScaling", "FusedRcas"));
 
             if (auto setting = readFloat("OutputScaling", "Multiplier"); setting.has_value())
                 OutputScalingMultiplier.set_from_config(std::clamp(setting.value(), 0.5f, 3.0f));
@@ -371,6 +390,8 @@ bool Config::Reload(std::filesystem::path iniPath)
             PreferDedicatedGpu.set_from_config(readBool("Hotfix", "PreferDedicatedGpu"));
             PreferFirstDedicatedGpu.set_from_config(readBool("Hotfix", "PreferFirstDedicatedGpu"));
             SkipFirstFrames.set_from_config(readInt("Hotfix", "SkipFirstFrames"));
+            JitterUnitCorrection.set_from_config(readBool("Hotfix", "JitterUnitCorrection"));
+            FileIndexCache.set_from_config(readBool("Hotfix", "FileIndexCache"));
             UsePrecompiledShaders.set_from_config(readBool("Hotfix", "UsePrecompiledShaders"));
             ColorResourceBarrier.set_from_config(readInt("Hotfix", "ColorResourceBarrier"));
             MVResourceBarrier.set_from_config(readInt("Hotfix", "MotionVectorResourceBarrier"));
@@ -384,6 +405,11 @@ bool Config::Reload(std::filesystem::path iniPath)
         {
             Dx11DelayedInit.set_from_config(readInt("Dx11withDx12", "UseDelayedInit"));
             DontUseNTShared.set_from_config(readBool("Dx11withDx12", "DontUseNTShared"));
+
+            if (auto setting = readInt("Dx11withDx12", "FramesInFlight"); setting.has_value())
+                Dx11FramesInFlight.set_from_config(std::clamp(setting.value(), 2, 4));
+
+            Dx11PromoteSharedTextures.set_from_config(readBool("Dx11withDx12", "PromoteSharedTextures"));
         }
 
         // NvApi
@@ -588,6 +614,10 @@ bool Config::SaveIni()
     {
         ini.SetValue("Upscalers", "Dx11Upscaler", Instance()->Dx11Upscaler.value_for_config_or("auto").c_str());
         ini.SetValue("Upscalers", "Dx12Upscaler", Instance()->Dx12Upscaler.value_for_config_or("auto").c_str());
+        ini.SetValue("Upscalers", "Dx12WarmBackendSwitch",
+                     GetBoolValue(Instance()->Dx12WarmBackendSwitch.value_for_config()).c_str());
+        ini.SetValue("Upscalers", "Dx12WarmPreCreate",
+                     GetBoolValue(Instance()->Dx12WarmPreCreate.value_for_config()).c_str());
         ini.SetValue("Upscalers", "VulkanUpscaler", Instance()->VulkanUpscaler.value_for_config_or("auto").c_str());
     }
 
@@ -611,11 +641,14 @@ bool Config::SaveIni()
         ini.SetValue("OptiFG", "Enabled", GetBoolValue(Instance()->FGEnabled.value_for_config()).c_str());
         ini.SetValue("OptiFG", "DebugView", GetBoolValue(Instance()->FGDebugView.value_for_config()).c_str());
         ini.SetValue("OptiFG", "AllowAsync", GetBoolValue(Instance()->FGAsync.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "QueuePolicy", GetIntValue(Instance()->FGQueuePolicy.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFix", GetBoolValue(Instance()->FGHUDFix.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDLimit", GetIntValue(Instance()->FGHUDLimit.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFixExtended", GetBoolValue(Instance()->FGHUDFixExtended.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFixImmadiate",
                      GetBoolValue(Instance()->FGImmediateCapture.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HUDFixDeferredTransfer",
+                     GetBoolValue(Instance()->FGHUDFixDeferredTransfer.value_for_config()).c_str());
         ini.SetValue("OptiFG", "RectLeft", GetIntValue(Instance()->FGRectLeft.value_for_config()).c_str());
         ini.SetValue("OptiFG", "RectTop", GetIntValue(Instance()->FGRectTop.value_for_config()).c_str());
         ini.SetValue("OptiFG", "RectWidth", GetIntValue(Instance()->FGRectWidth.value_for_config()).c_str());
@@ -624,6 +657,7 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->FGAlwaysTrackHeaps.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeDepthCopy", GetBoolValue(Instance()->FGMakeDepthCopy.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeMVCopy", GetBoolValue(Instance()->FGMakeMVCopy.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "InputHandoff", GetBoolValue(Instance()->FGInputHandoff.value_for_config()).c_str());
         ini.SetValue("OptiFG", "UseMutexForSwaphain",
                      GetBoolValue(Instance()->FGUseMutexForSwapchain.value_for_config()).c_str());
 
@@ -633,6 +667,7 @@ bool Config::SaveIni()
 
         ini.SetValue("OptiFG", "FramePacingTuning",
                      GetBoolValue(Instance()->FGFramePacingTuning.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "AdaptivePacing", GetBoolValue(Instance()->FGAdaptivePacing.value_for_config()).c_str());
         ini.SetValue("OptiFG", "FPTSafetyMarginInMs",
                      GetFloatValue(Instance()->FGFPTSafetyMarginInMs.value_for_config()).c_str());
         ini.SetValue("OptiFG", "FPTVarianceFactor",
@@ -652,6 +687,8 @@ bool Config::SaveIni()
     {
         ini.SetValue("Framerate", "FramerateLimit",
                      GetFloatValue(Instance()->FramerateLimit.value_for_config()).c_str());
+        ini.SetValue("Framerate", "AdaptiveLimit",
+                     GetBoolValue(Instance()->FramerateLimitAdaptive.value_for_config()).c_str());
     }
 
     // Output Scaling
@@ -663,6 +700,8 @@ bool Config::SaveIni()
         ini.SetValue("OutputScaling", "UseFsr",
                      GetBoolValue(Instance()->OutputScalingUseFsr.value_for_config()).c_str());
         ini.SetValue("OutputScaling", "Downscaler", GetIntValue(Instance()->OutputScalingDownscaler).c_str());
+        ini.SetValue("OutputScaling", "FusedRcas",
+                     GetBoolValue(Instance()->OutputScalingFusedRcas.value_for_config()).c_str());
     }
 
     // FSR common
@@ -776,9 +815,12 @@ bool Config::SaveIni()
         ini.SetValue("Menu", "FpsOverlayHorizontal",
                      GetBoolValue(Instance()->FpsOverlayHorizontal.value_for_config()).c_str());
         ini.SetValue("Menu", "FpsOverlayAlpha", GetFloatValue(Instance()->FpsOverlayAlpha.value_for_config()).c_str());
+        ini.SetValue("Menu", "FpsOverlayUpdateRate",
+                     GetIntValue(Instance()->FpsOverlayUpdateRate.value_for_config()).c_str());
         ini.SetValue("Menu", "FpsScale", GetFloatValue(Instance()->FpsScale.value_for_config()).c_str());
         ini.SetValue("Menu", "TTFFontPath",
                      wstring_to_string(Instance()->TTFFontPath.value_for_config_or(L"auto")).c_str());
+        ini.SetValue("Menu", "FontCache", GetBoolValue(Instance()->FontCache.value_for_config()).c_str());
     }
 
     // Hooks
@@ -800,6 +842,9 @@ bool Config::SaveIni()
         ini.SetValue("CAS", "MotionSharpness", GetFloatValue(Instance()->MotionSharpness.value_for_config()).c_str());
         ini.SetValue("CAS", "MotionThreshold", GetFloatValue(Instance()->MotionThreshold.value_for_config()).c_str());
         ini.SetValue("CAS", "MotionScaleLimit", GetFloatValue(Instance()->MotionScaleLimit.value_for_config()).c_str());
+        ini.SetValue("CAS", "Tiled", GetBoolValue(Instance()->RcasTiled.value_for_config()).c_str());
+        ini.SetValue("CAS", "TileSkipThreshold",
+                     GetFloatValue(Instance()->RcasTileSkipThreshold.value_for_config()).c_str());
         ini.SetValue("CAS", "ContrastEnabled", GetBoolValue(Instance()->ContrastEnabled.value_for_config()).c_str());
         ini.SetValue("CAS", "Contrast", GetFloatValue(Instance()->Contrast.value_for_config()).c_str());
     }
@@ -871,6 +916,9 @@ bool Config::SaveIni()
         ini.SetValue("Hotfix", "RestoreGraphicSignature",
                      GetBoolValue(Instance()->RestoreGraphicSignature.value_for_config()).c_str());
         ini.SetValue("Hotfix", "SkipFirstFrames", GetIntValue(Instance()->SkipFirstFrames.value_for_config()).c_str());
+        ini.SetValue("Hotfix", "JitterUnitCorrection",
+                     GetBoolValue(Instance()->JitterUnitCorrection.value_for_config()).c_str());
+        ini.SetValue("Hotfix", "FileIndexCache", GetBoolValue(Instance()->FileIndexCache.value_for_config()).c_str());
 
         ini.SetValue("Hotfix", "UsePrecompiledShaders",
                      GetBoolValue(Instance()->UsePrecompiledShaders.value_for_config()).c_str());
@@ -903,6 +951,10 @@ bool Config::SaveIni()
         // "UseDelayedInit", GetBoolValue(Instance()->Dx11DelayedInit.value_for_config()).c_str());
         ini.SetValue("Dx11withDx12", "DontUseNTShared",
                      GetBoolValue(Instance()->DontUseNTShared.value_for_config()).c_str());
+        ini.SetValue("Dx11withDx12", "FramesInFlight",
+                     GetIntValue(Instance()->Dx11FramesInFlight.value_for_config()).c_str());
+        ini.SetValue("Dx11withDx12", "PromoteSharedTextures",
+                     GetBoolValue(Instance()->Dx11PromoteSharedTextures.value_for_config()).c_str());
     }
 
     // Logging
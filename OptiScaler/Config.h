@@ -203,6 +203,8 @@ class Config
     CustomOptional<float> MotionSharpness { 0.4f };
     CustomOptional<float> MotionThreshold { 0.0f };
     CustomOptional<float> MotionScaleLimit { 10.0f };
+    CustomOptional<bool> RcasTiled { false };
+    CustomOptional<float> RcasTileSkipThreshold { 0.01f };
 
     // Sharpness
     CustomOptional<bool> OverrideSharpness { false };
@@ -224,9 +226,11 @@ class Config
     CustomOptional<int> FpsCycleShortcutKey { VK_NEXT };
     CustomOptional<bool> FpsOverlayHorizontal { false };
     CustomOptional<float> FpsOverlayAlpha { 0.4f };
+    CustomOptional<int> FpsOverlayUpdateRate { 0 }; // 0 means every frame
     CustomOptional<float, NoDefault> FpsScale; // No value means same as MenuScale
     CustomOptional<bool> UseHQFont { true };
     CustomOptional<std::wstring, NoDefault> TTFFontPath;
+    CustomOptional<bool> FontCache { false };
 
     // Hooks
     CustomOptional<bool> HookOriginalNvngxOnly { false };
@@ -262,6 +266,8 @@ class Config
     CustomOptional<bool> RestoreComputeSignature { false };
     CustomOptional<bool> RestoreGraphicSignature { false };
     CustomOptional<int, NoDefault> SkipFirstFrames; // disabled by default
+    CustomOptional<bool> JitterUnitCorrection { false };
+    CustomOptional<bool> FileIndexCache { false };
 
     CustomOptional<bool> UsePrecompiledShaders { true };
 
@@ -279,13 +285,17 @@ class Config
     // Upscalers
     CustomOptional<std::string, SoftDefault> Dx11Upscaler { "fsr22" };
     CustomOptional<std::string, SoftDefault> Dx12Upscaler { "xess" };
+    CustomOptional<bool> Dx12WarmBackendSwitch { false };
+    CustomOptional<bool> Dx12WarmPreCreate { false };
     CustomOptional<std::string, SoftDefault> VulkanUpscaler { "fsr21" };
 
     // Output Scaling
     CustomOptional<bool> OutputScalingEnabled { false };
     CustomOptional<float> OutputScalingMultiplier { 1.5f };
     CustomOptional<bool> OutputScalingUseFsr { true };
-    CustomOptional<uint32_t> OutputScalingDownscaler { 0 }; // 0 = Bicubic | 1 = Lanczos | 2 = Catmull-Rom | 3 = MAGC
+    // 0 = Bicubic | 1 = Lanczos | 2 = Catmull-Rom | 3 = MAGC | 4 = Lanczos Sep. | 5 = Catmull-Rom Sep.
+    CustomOptional<uint32_t> OutputScalingDownscaler { 0 };
+    CustomOptional<bool> OutputScalingFusedRcas { false };
 
     // FSR
     CustomOptional<bool> FsrDebugView { false };
@@ -314,6 +324,8 @@ class Config
     // dx11wdx12
     CustomOptional<bool> Dx11DelayedInit { false };
     CustomOptional<bool> DontUseNTShared { false };
+    CustomOptional<int> Dx11FramesInFlight { 2 };
+    CustomOptional<bool> Dx11PromoteSharedTextures { false };
 
     // NVAPI Override
     CustomOptional<bool> OverrideNvapiDll { false };
@@ -349,9 +361,11 @@ class Config
     CustomOptional<bool> FGEnabled { false };
     CustomOptional<bool> FGDebugView { false };
     CustomOptional<bool> FGAsync { false };
+    CustomOptional<int> FGQueuePolicy { 0 };
     CustomOptional<bool> FGUseMutexForSwapchain { true };
     CustomOptional<bool> FGMakeMVCopy { true };
     CustomOptional<bool> FGMakeDepthCopy { true };
+    CustomOptional<bool> FGInputHandoff { false };
     CustomOptional<bool> FGResourceFlip { false };
     CustomOptional<bool> FGResourceFlipOffset { false };
 
@@ -360,6 +374,7 @@ class Config
     CustomOptional<int> FGHUDLimit { 1 };
     CustomOptional<bool> FGHUDFixExtended { false };
     CustomOptional<bool> FGImmediateCapture { false };
+    CustomOptional<bool> FGHUDFixDeferredTransfer { false };
     CustomOptional<bool> FGHudfixHalfSync { false };
     CustomOptional<bool> FGHudfixFullSync { false };
     CustomOptional<bool> FGImmediatelyExecute { true };
@@ -381,6 +396,7 @@ class Config
 
     // OptiFG - FSR-FG FPT
     CustomOptional<bool> FGFramePacingTuning { true };
+    CustomOptional<bool> FGAdaptivePacing { false };
     CustomOptional<float> FGFPTSafetyMarginInMs { 0.01f };
     CustomOptional<float> FGFPTVarianceFactor { 0.3f };
     CustomOptional<bool> FGFPTAllowHybridSpin { false };
@@ -418,6 +434,7 @@ class Config
 
     // Framerate
     CustomOptional<float> FramerateLimit { 0.0f };
+    CustomOptional<bool> FramerateLimitAdaptive { false };
 
     // HDR
     CustomOptional<bool> ForceHDR { false };
@@ -2,12 +2,12 @@
 
 #include <pch.h>
 
+#include "hooks/DllNameMatcher.h"
+
 #define DEFINE_NAME_VECTORS(varName, libName)                                                                          \
-    inline std::vector<std::string> varName##Names = { libName ".dll", libName };                                      \
-    inline std::vector<std::wstring> varName##NamesW = { L##libName L".dll", L##libName };
+    inline std::vector<std::string> varName##Names = { libName ".dll", libName };
 
 inline std::vector<std::string> dllNames;
-inline std::vector<std::wstring> dllNamesW;
 
 //"rtsshooks64.dll", "rtsshooks64", "rtsshooks.dll", "rtsshooks",
 
@@ -36,31 +36,6 @@ inline std::vector<std::string> overlayNames = { "eosovh-win32-shipping.dll",
                                                  "overlay",
                                                  "overlay.dll" }; // Ubisoft
 
-inline std::vector<std::wstring> overlayNamesW = { L"eosovh-win32-shipping.dll",
-                                                   L"eosovh-win32-shipping",
-                                                   L"eosovh-win64-shipping.dll",
-                                                   L"eosovh-win64-shipping",
-                                                   L"gameoverlayrenderer64",
-                                                   L"gameoverlayrenderer64.dll",
-                                                   L"gameoverlayrenderer",
-                                                   L"gameoverlayrenderer.dll",
-                                                   L"socialclubd3d12renderer",
-                                                   L"socialclubd3d12renderer.dll",
-                                                   L"owutils.dll",
-                                                   L"owutils",
-                                                   L"galaxy.dll",
-                                                   L"galaxy",
-                                                   L"galaxy64.dll",
-                                                   L"galaxy64",
-                                                   L"discordoverlay.dll",
-                                                   L"discordoverlay",
-                                                   L"discordoverlay64.dll",
-                                                   L"discordoverlay64",
-                                                   L"overlay64",
-                                                   L"overlay64.dll",
-                                                   L"overlay",
-                                                   L"overlay.dll" };
-
 inline std::vector<std::string> blockOverlayNames = { "eosovh-win32-shipping.dll",
                                                       "eosovh-win32-shipping",
                                                       "eosovh-win64-shipping.dll",
@@ -70,7 +45,7 @@ inline std::vector<std::string> blockOverlayNames = { "eosovh-win32-shipping.dll
                                                       "gameoverlayrenderer",
                                                       "gameoverlayrenderer.dll",
                                                       "owclient.dll",
-                                                      "owclient"
+                                                      "owclient",
                                                       "galaxy.dll",
                                                       "galaxy",
                                                       "galaxy64.dll",
@@ -84,29 +59,6 @@ inline std::vector<std::string> blockOverlayNames = { "eosovh-win32-shipping.dll
                                                       "overlay",
                                                       "overlay.dll" };
 
-inline std::vector<std::wstring> blockOverlayNamesW = { L"eosovh-win32-shipping.dll",
-                                                        L"eosovh-win32-shipping",
-                                                        L"eosovh-win64-shipping.dll",
-                                                        L"eosovh-win64-shipping",
-                                                        L"gameoverlayrenderer64",
-                                                        L"gameoverlayrenderer64.dll",
-                                                        L"gameoverlayrenderer",
-                                                        L"gameoverlayrenderer.dll",
-                                                        L"owclient.dll",
-                                                        L"owclient",
-                                                        L"galaxy.dll",
-                                                        L"galaxy",
-                                                        L"galaxy64.dll",
-                                                        L"galaxy64",
-                                                        L"discordoverlay.dll",
-                                                        L"discordoverlay",
-                                                        L"discordoverlay64.dll",
-                                                        L"discordoverlay64",
-                                                        L"overlay64",
-                                                        L"overlay64.dll",
-                                                        L"overlay",
-                                                        L"overlay.dll" };
-
 DEFINE_NAME_VECTORS(dx11, "d3d11");
 DEFINE_NAME_VECTORS(dx12, "d3d12");
 DEFINE_NAME_VECTORS(dxgi, "dxgi");
@@ -131,30 +83,48 @@ DEFINE_NAME_VECTORS(fsr3BE, "ffx_backend_dx12_x64");
 DEFINE_NAME_VECTORS(ffxDx12, "amd_fidelityfx_dx12");
 DEFINE_NAME_VECTORS(ffxVk, "amd_fidelityfx_vk");
 
-inline static bool CheckDllName(std::string* dllName, std::vector<std::string>* namesList)
+// All lists above compiled into one matcher on first use
+inline DllNameMatcher& DllMatcher()
 {
-    for (size_t i = 0; i < namesList->size(); i++)
-    {
-        auto name = namesList->at(i);
-        auto pos = dllName->rfind(name);
+    // Too big for the stack of a hooked thread, filled in place
+    static DllNameMatcher matcher;
 
-        if (pos != std::string::npos && pos == (dllName->size() - name.size()))
-            return true;
-    }
-
-    return false;
+    [[maybe_unused]] static bool built = []
+    {
+        matcher.Add(dllNames, DllNameMatcher::OptiScaler);
+        matcher.Add(nvngxNames, DllNameMatcher::Nvngx);
+        matcher.Add(nvngxDlssNames, DllNameMatcher::NvngxDlss);
+        matcher.Add(nvapiNames, DllNameMatcher::NvApi);
+        matcher.Add(slInterposerNames, DllNameMatcher::SlInterposer);
+        matcher.Add(slDlssNames, DllNameMatcher::SlDlss);
+        matcher.Add(slDlssgNames, DllNameMatcher::SlDlssg);
+        matcher.Add(".bin", DllNameMatcher::NgxOtaBin);
+        matcher.Add(blockOverlayNames, DllNameMatcher::BlockOverlay);
+        matcher.Add(overlayNames, DllNameMatcher::Overlay);
+        matcher.Add(dx11Names, DllNameMatcher::Dx11);
+        matcher.Add(dx12Names, DllNameMatcher::Dx12);
+        matcher.Add(vkNames, DllNameMatcher::Vulkan);
+        matcher.Add(dxgiNames, DllNameMatcher::Dxgi);
+        matcher.Add(fsr2Names, DllNameMatcher::Fsr2);
+        matcher.Add(fsr2BENames, DllNameMatcher::Fsr2BE);
+        matcher.Add(fsr3Names, DllNameMatcher::Fsr3);
+        matcher.Add(fsr3BENames, DllNameMatcher::Fsr3BE);
+        matcher.Add(xessNames, DllNameMatcher::Xess);
+        matcher.Add(xessDx11Names, DllNameMatcher::XessDx11);
+        matcher.Add(ffxDx12Names, DllNameMatcher::FfxDx12);
+        matcher.Add(ffxVkNames, DllNameMatcher::FfxVk);
+        return true;
+    }();
+
+    return matcher;
 }
 
-inline static bool CheckDllNameW(std::wstring* dllName, std::vector<std::wstring>* namesList)
+// Adds a name OptiScaler is loaded as, LoadLibrary calls for it (with or without extension) return OptiScaler
+inline void AddDllName(const std::string& InName, const std::string& InExtension = ".dll")
 {
-    for (size_t i = 0; i < namesList->size(); i++)
+    for (const auto& name : { InName + InExtension, InName })
     {
-        auto name = namesList->at(i);
-        auto pos = dllName->rfind(name);
-
-        if (pos != std::string::npos && pos == (dllName->size() - name.size()))
-            return true;
+        dllNames.push_back(name);
+        DllMatcher().Add(name, DllNameMatcher::OptiScaler);
     }
-
-    return false;
 }
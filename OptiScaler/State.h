@@ -3,6 +3,7 @@
 
 #include "upscalers/IFeature.h"
 #include "framegen/IFGFeature_Dx12.h"
+#include "framegen/FramePacingModel.h"
 
 #include <deque>
 #include <vulkan/vulkan.h>
@@ -35,6 +36,17 @@ typedef enum FGType : uint32_t
     Nukems
 } FGType;
 
+// Process wide skip flag set around OptiScaler's own calls. The warm feature worker runs the same init code as
+// game threads, its writes are dropped so it can't flip the flag under them. Worker is covered by State::InWarmCreation
+class SkipFlag
+{
+    bool _value = false;
+
+  public:
+    SkipFlag& operator=(bool InValue);
+    operator bool() const { return _value; }
+};
+
 class State
 {
   public:
@@ -73,7 +85,7 @@ class State
     bool FGonlyGenerated = false;
     bool FGchanged = false;
     bool SCchanged = false;
-    bool skipHeapCapture = false;
+    SkipFlag skipHeapCapture;
 
     bool FGcaptureResources = false;
     int FGcapturedResourceCount = false;
@@ -82,6 +94,9 @@ class State
 
     bool FSRFGFTPchanged = false;
 
+    // Real frame intervals of OptiFG presents
+    FramePacingModel fgPacing;
+
     // NVNGX init parameters
     uint64_t NVNGX_ApplicationId = 1337;
     std::wstring NVNGX_ApplicationDataPath;
@@ -122,7 +137,7 @@ class State
     bool dlssdPresetsOverriddenExternally = false;
 
     // Spoofing
-    bool skipSpoofing = false;
+    SkipFlag skipSpoofing;
     // For DXVK, it calls DXGI which cause softlock
     bool skipDxgiLoadChecks = false;
 
@@ -233,6 +248,17 @@ class State
         }
     };
 
+    // Set on the warm feature worker while it creates a feature, hooks skip heap capture and spoofing on that thread
+    // without touching the process wide flags
+    class WarmCreationScope
+    {
+      public:
+        WarmCreationScope() { _inWarmCreation = true; }
+        ~WarmCreationScope() { _inWarmCreation = false; }
+    };
+
+    static bool InWarmCreation() { return _inWarmCreation; }
+
     static bool SkipDllChecks() { return _skipChecks; }
     static std::string SkipDllName() { return _skipDllName; }
     static bool ServeOriginal() { return _serveOriginal; }
@@ -245,5 +271,15 @@ class State
     inline static bool _serveOriginal = false;
     inline static UINT _serveOwner = 0;
 
+    inline static thread_local bool _inWarmCreation = false;
+
     State() = default;
 };
+
+inline SkipFlag& SkipFlag::operator=(bool InValue)
+{
+    if (!State::InWarmCreation())
+        _value = InValue;
+
+    return *this;
+}
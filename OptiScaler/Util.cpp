@@ -3,6 +3,8 @@
 #include "Util.h"
 #include "Config.h"
 
+#include <misc/FileIndex.h>
+
 #include <shlobj.h>
 
 extern HMODULE dllModule;
@@ -354,6 +356,37 @@ bool Util::GetDLLVersion(std::wstring dllPath, xess_version_t* xessVersionOut)
     return result;
 }
 
+// Indexes are created on first search and kept for the process lifetime,
+// searched files (nvngx dlls) are not expected to be added or removed while the game is running
+static FileIndex& GetFileIndex(const std::filesystem::path& root)
+{
+    static std::mutex indexMutex;
+    static std::map<std::filesystem::path, std::unique_ptr<FileIndex>> indexes;
+
+    std::lock_guard<std::mutex> lock(indexMutex);
+
+    auto& index = indexes[root];
+
+    if (index == nullptr)
+    {
+        index = std::make_unique<FileIndex>(root);
+
+        // Inputs search these one after another, first search finds all of them
+        index->Watch({ "nvngx_dlss.dll", "nvngx_dlssd.dll", "nvngx_dlssg.dll" });
+
+        if (Config::Instance()->FileIndexCache.value_or_default())
+        {
+            auto cacheFile = Util::DllPath().parent_path() /
+                             std::format(L"OptiScaler.{:x}.fileindex", std::hash<std::wstring>()(root.wstring()));
+
+            if (index->SetCacheFile(cacheFile))
+                LOG_INFO("File index of {} loaded from cache", root.string());
+        }
+    }
+
+    return *index;
+}
+
 std::optional<std::filesystem::path> Util::FindFilePath(const std::filesystem::path& startDir,
                                                         const std::filesystem::path fileName)
 {
@@ -366,14 +399,10 @@ std::optional<std::filesystem::path> Util::FindFilePath(const std::filesystem::p
     }
 
     // 2) Recursive search under startDir
-    for (auto& entry : std::filesystem::recursive_directory_iterator(
-             startDir, std::filesystem::directory_options::skip_permission_denied))
+    if (auto found = GetFileIndex(startDir).Find(fileName); found.has_value())
     {
-        if (!entry.is_directory() && entry.path().filename() == fileName)
-        {
-            LOG_INFO("{} found at {}", fileName.string(), entry.path().parent_path().string());
-            return entry.path();
-        }
+        LOG_INFO("{} found at {}", fileName.string(), found.value().parent_path().string());
+        return found;
     }
 
     // 3) Unreal-Engine/WinGDK fallback: check for Win64 or WinGDK in parent
@@ -384,14 +413,11 @@ std::optional<std::filesystem::path> Util::FindFilePath(const std::filesystem::p
         {
             // Move up two more levels from 'parent' to reach UE project root
             std::filesystem::path ueRoot = parent.parent_path().parent_path();
-            for (auto& entry : std::filesystem::recursive_directory_iterator(
-                     ueRoot, std::filesystem::directory_options::skip_permission_denied))
+
+            if (auto found = GetFileIndex(ueRoot).Find(fileName); found.has_value())
             {
-                if (!entry.is_directory() && entry.path().filename() == fileName)
-                {
-                    LOG_INFO("{} found at {}", fileName.string(), entry.path().parent_path().string());
-                    return entry.path();
-                }
+                LOG_INFO("{} found at {}", fileName.string(), found.value().parent_path().string());
+                return found;
             }
 
             // If not found under this folder, break to avoid double-search
@@ -24,6 +24,7 @@
 #include "inputs/FfxApi_Dx12.h"
 #include "inputs/FfxApi_Vk.h"
 #include "inputs/FfxApiExe_Dx12.h"
+#include "inputs/NVNGX_DLSS.h"
 
 #include "spoofing/Vulkan_Spoofing.h"
 
@@ -192,10 +193,7 @@ static void CheckWorkingMode()
         {
             LOG_INFO("OptiScaler working as native upscaler: {0}", filename);
 
-            dllNames.push_back("OptiScaler_DontLoad.dll");
-            dllNames.push_back("OptiScaler_DontLoad");
-            dllNamesW.push_back(L"OptiScaler_DontLoad.dll");
-            dllNamesW.push_back(L"OptiScaler_DontLoad");
+            AddDllName("OptiScaler_DontLoad");
 
             State::Instance().enablerAvailable = lCaseFilename == "dlss-enabler-upscaler.dll";
             if (State::Instance().enablerAvailable)
@@ -239,10 +237,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("version.dll");
-                dllNames.push_back("version");
-                dllNamesW.push_back(L"version.dll");
-                dllNamesW.push_back(L"version");
+                AddDllName("version");
 
                 shared.LoadOriginalLibrary(originalModule);
                 version.LoadOriginalLibrary(originalModule);
@@ -289,10 +284,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("winmm.dll");
-                dllNames.push_back("winmm");
-                dllNamesW.push_back(L"winmm.dll");
-                dllNamesW.push_back(L"winmm");
+                AddDllName("winmm");
 
                 shared.LoadOriginalLibrary(originalModule);
                 winmm.LoadOriginalLibrary(originalModule);
@@ -338,10 +330,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("wininet.dll");
-                dllNames.push_back("wininet");
-                dllNamesW.push_back(L"wininet.dll");
-                dllNamesW.push_back(L"wininet");
+                AddDllName("wininet");
 
                 shared.LoadOriginalLibrary(originalModule);
                 wininet.LoadOriginalLibrary(originalModule);
@@ -387,10 +376,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("dbghelp.dll");
-                dllNames.push_back("dbghelp");
-                dllNamesW.push_back(L"dbghelp.dll");
-                dllNamesW.push_back(L"dbghelp");
+                AddDllName("dbghelp");
 
                 shared.LoadOriginalLibrary(originalModule);
                 dbghelp.LoadOriginalLibrary(originalModule);
@@ -412,10 +398,7 @@ static void CheckWorkingMode()
             // quick hack for testing
             originalModule = dllModule;
 
-            dllNames.push_back("optiscaler.asi");
-            dllNames.push_back("optiscaler");
-            dllNamesW.push_back(L"optiscaler.asi");
-            dllNamesW.push_back(L"optiscaler");
+            AddDllName("optiscaler", ".asi");
 
             modeFound = true;
             break;
@@ -453,10 +436,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("winhttp.dll");
-                dllNames.push_back("winhttp");
-                dllNamesW.push_back(L"winhttp.dll");
-                dllNamesW.push_back(L"winhttp");
+                AddDllName("winhttp");
 
                 shared.LoadOriginalLibrary(originalModule);
                 winhttp.LoadOriginalLibrary(originalModule);
@@ -502,10 +482,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("dxgi.dll");
-                dllNames.push_back("dxgi");
-                dllNamesW.push_back(L"dxgi.dll");
-                dllNamesW.push_back(L"dxgi");
+                AddDllName("dxgi");
 
                 DxgiProxy::Init(originalModule);
                 dxgi.LoadOriginalLibrary(originalModule);
@@ -554,10 +531,7 @@ static void CheckWorkingMode()
 
             if (originalModule != nullptr)
             {
-                dllNames.push_back("d3d12.dll");
-                dllNames.push_back("d3d12");
-                dllNamesW.push_back(L"d3d12.dll");
-                dllNamesW.push_back(L"d3d12");
+                AddDllName("d3d12");
 
                 D3d12Proxy::Init(originalModule);
                 d3d12.LoadOriginalLibrary(originalModule);
@@ -1122,11 +1096,11 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         if (Config::Instance()->EnableFsr2Inputs.value_or_default())
         {
 
-            handle = KernelBaseProxy::GetModuleHandleW_()(fsr2NamesW[0].c_str());
+            handle = KernelBaseProxy::GetModuleHandleA_()(fsr2Names[0].c_str());
             if (handle != nullptr)
                 HookFSR2Inputs(handle);
 
-            handle = KernelBaseProxy::GetModuleHandleW_()(fsr2BENamesW[0].c_str());
+            handle = KernelBaseProxy::GetModuleHandleA_()(fsr2BENames[0].c_str());
             if (handle != nullptr)
                 HookFSR2Dx12Inputs(handle);
 
@@ -1137,11 +1111,11 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
 
         if (Config::Instance()->EnableFsr3Inputs.value_or_default())
         {
-            handle = KernelBaseProxy::GetModuleHandleW_()(fsr3NamesW[0].c_str());
+            handle = KernelBaseProxy::GetModuleHandleA_()(fsr3Names[0].c_str());
             if (handle != nullptr)
                 HookFSR3Inputs(handle);
 
-            handle = KernelBaseProxy::GetModuleHandleW_()(fsr3BENamesW[0].c_str());
+            handle = KernelBaseProxy::GetModuleHandleA_()(fsr3BENames[0].c_str());
             if (handle != nullptr)
                 HookFSR3Dx12Inputs(handle);
 
@@ -1176,6 +1150,9 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
         // unhookAdvapi32();
         // DetachHooks();
 
+        UnregisterSpoofingDllNotification();
+        DetachDx12WarmWorker();
+
         if (skModule != nullptr)
             KernelBaseProxy::FreeLibrary_()(skModule);
 
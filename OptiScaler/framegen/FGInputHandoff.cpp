@@ -0,0 +1,107 @@
+#include "FGInputHandoff.h"
+
+FGInputHandoff::ResourceState* FGInputHandoff::FindOrReplace(InputState& InState, const void* InResource)
+{
+    ResourceState* oldest = &InState.Known[0];
+
+    for (auto& known : InState.Known)
+    {
+        if (known.Resource == InResource)
+            return &known;
+
+        if (known.LastFrame < oldest->LastFrame)
+            oldest = &known;
+    }
+
+    // New resource, validate it again
+    *oldest = {};
+    oldest->Resource = InResource;
+
+    return oldest;
+}
+
+bool FGInputHandoff::Register(Input InInput, const void* InResource, bool InTracking)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& input = _inputs[InInput];
+
+    if (!InTracking || InResource == nullptr)
+    {
+        input.Watched.store(nullptr);
+        input.Known.fill({});
+        input.Current = nullptr;
+        input.HandedOff = false;
+        return false;
+    }
+
+    input.Current = FindOrReplace(input, InResource);
+    input.Current->LastFrame = ++_frame;
+
+    // Previous window without FG dispatch is not counted
+    input.Hazard.store(false);
+    input.Watched.store(InResource);
+    _watching.store(true);
+
+    input.HandedOff = !input.Current->Blocked && input.Current->CleanFrames >= ProbationFrames;
+    return input.HandedOff;
+}
+
+void FGInputHandoff::Written(const void* InResource)
+{
+    if (!_watching.load(std::memory_order_relaxed) || InResource == nullptr)
+        return;
+
+    for (auto& input : _inputs)
+    {
+        if (input.Watched.load(std::memory_order_relaxed) == InResource)
+            input.Hazard.store(true);
+    }
+}
+
+bool FGInputHandoff::Consumed()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _watching.store(false);
+    auto valid = true;
+
+    for (auto& input : _inputs)
+    {
+        if (input.Watched.exchange(nullptr) == nullptr || input.Current == nullptr)
+            continue;
+
+        auto current = input.Current;
+
+        if (input.Hazard.exchange(false))
+        {
+            if (input.HandedOff)
+                valid = false;
+
+            current->Blocked = true;
+            current->CleanFrames = 0;
+            input.HazardCount++;
+        }
+        else if (!current->Blocked && current->CleanFrames < ProbationFrames)
+        {
+            current->CleanFrames++;
+        }
+
+        input.HandedOff = false;
+    }
+
+    return valid;
+}
+
+bool FGInputHandoff::IsHandedOff(Input InInput)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto current = _inputs[InInput].Current;
+    return current != nullptr && !current->Blocked && current->CleanFrames >= ProbationFrames;
+}
+
+uint64_t FGInputHandoff::HazardCount(Input InInput)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _inputs[InInput].HazardCount;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+// Decides if frame generation can read upscaler inputs (velocity, depth) directly instead of copies.
+// Between Register (upscaler evaluate) and Consumed (before FG reads the inputs) the registered resources are
+// watched, resource tracking hooks report every resource bound or used as a destination for writing with Written.
+// A resource is handed off only after ProbationFrames clean frames, a write inside the window blocks handoff
+// for that resource. Last few resources of each input are remembered, so ping-ponged buffers keep their state.
+// When a handed off resource is written inside its window Consumed returns false, that frame's inputs are already
+// overwritten so FG should skip the frame, copies are made from the next frame on.
+class FGInputHandoff
+{
+  public:
+    enum Input : uint32_t
+    {
+        Velocity = 0,
+        Depth,
+        Count,
+    };
+
+    static constexpr uint32_t ProbationFrames = 8;
+    static constexpr uint32_t KnownResources = 4;
+
+  private:
+    struct ResourceState
+    {
+        const void* Resource = nullptr;
+        uint32_t CleanFrames = 0;
+        bool Blocked = false;
+        uint64_t LastFrame = 0;
+    };
+
+    struct InputState
+    {
+        std::atomic<const void*> Watched { nullptr };
+        std::atomic<bool> Hazard { false };
+
+        std::array<ResourceState, KnownResources> Known {};
+        ResourceState* Current = nullptr;
+        bool HandedOff = false;
+        uint64_t HazardCount = 0;
+    };
+
+    std::array<InputState, Input::Count> _inputs;
+    std::atomic<bool> _watching { false };
+    std::mutex _mutex;
+    uint64_t _frame = 0;
+
+    ResourceState* FindOrReplace(InputState& InState, const void* InResource);
+
+  public:
+    // Starts the watch window, returns true when FG can use InResource without a copy.
+    // Without InTracking writes can't be detected so copy is always needed.
+    bool Register(Input InInput, const void* InResource, bool InTracking);
+
+    // Called by resource tracking hooks for resources bound for writing, can be called from any thread
+    void Written(const void* InResource);
+
+    // Ends the watch window, must be called before FG reads the inputs.
+    // Returns false when an input which was handed off without a copy was written in this window.
+    bool Consumed();
+
+    bool IsWatching() const { return _watching.load(std::memory_order_relaxed); }
+
+    // Resource of InInput inside the watch window, nullptr outside of it
+    const void* Watched(Input InInput) const { return _inputs[InInput].Watched.load(std::memory_order_relaxed); }
+    bool IsHandedOff(Input InInput);
+    uint64_t HazardCount(Input InInput);
+};
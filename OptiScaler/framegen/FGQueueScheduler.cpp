@@ -0,0 +1,64 @@
+#include "FGQueueScheduler.h"
+
+#include <algorithm>
+
+FGQueueScheduler::FGQueueScheduler(Policy InPolicy, uint32_t InSlotCount)
+    : _policy(InPolicy), _slotCount(std::clamp(InSlotCount, 1u, MaxSlots))
+{
+}
+
+uint64_t FGQueueScheduler::Begin(uint32_t InSlot, uint64_t InCompletedValue)
+{
+    if (_recordedSlot >= 0)
+    {
+        _recordedSlot = -1;
+        _dropped++;
+    }
+
+    auto value = _slotValues[InSlot % _slotCount];
+
+    if (value <= InCompletedValue)
+        return 0;
+
+    _cpuWaits++;
+    return value;
+}
+
+bool FGQueueScheduler::Recorded(uint32_t InSlot)
+{
+    if (_recordedSlot >= 0)
+        return false;
+
+    _recordedSlot = InSlot % _slotCount;
+    return true;
+}
+
+bool FGQueueScheduler::SlotFree(uint32_t InSlot, uint64_t InCompletedValue) const
+{
+    return _slotValues[InSlot % _slotCount] <= InCompletedValue;
+}
+
+FGQueueScheduler::Submission FGQueueScheduler::Submit()
+{
+    Submission submission {};
+
+    if (_recordedSlot < 0)
+        return submission;
+
+    submission.Slot = _recordedSlot;
+    submission.InputValue = ++_lastValue;
+    submission.DoneValue = ++_lastValue;
+
+    _slotValues[_recordedSlot] = submission.DoneValue;
+    _pendingWait = submission.DoneValue;
+    _recordedSlot = -1;
+
+    return submission;
+}
+
+uint64_t FGQueueScheduler::TakeWait()
+{
+    auto value = _pendingWait;
+    _pendingWait = 0;
+    return value;
+}
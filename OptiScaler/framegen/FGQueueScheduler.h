@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Fence bookkeeping for running FG work on OptiScaler's own queue instead of the game's command list.
+// One fence is used by both queues. Game queue signals InputValue after the list which produced FG inputs and
+// FG queue waits for it, FG queue signals DoneValue after FG work and game queue waits for it before present.
+// Each frame slot remembers its DoneValue, so slot's allocator is only reset after GPU is done with it.
+class FGQueueScheduler
+{
+  public:
+    enum Policy : uint32_t
+    {
+        Inline = 0, // Recorded to game's command list
+        Async,      // Own compute queue
+        Direct,     // Own direct queue
+    };
+
+    static constexpr uint32_t MaxSlots = 8;
+
+    struct Submission
+    {
+        uint32_t Slot = 0;
+        uint64_t InputValue = 0;
+        uint64_t DoneValue = 0;
+    };
+
+  private:
+    Policy _policy = Inline;
+    uint32_t _slotCount = 4;
+    uint64_t _lastValue = 0;
+    uint64_t _pendingWait = 0;
+    int32_t _recordedSlot = -1;
+    std::array<uint64_t, MaxSlots> _slotValues {};
+
+    uint64_t _cpuWaits = 0;
+    uint64_t _dropped = 0;
+
+  public:
+    Policy GetPolicy() const { return _policy; }
+    bool UsesQueue() const { return _policy != Inline; }
+
+    // Returns fence value CPU should wait before reusing InSlot, 0 when slot is free.
+    // Work recorded in previous frame but never submitted is dropped.
+    uint64_t Begin(uint32_t InSlot, uint64_t InCompletedValue);
+
+    // InSlot's command list is closed and waits for the game queue.
+    // Returns false when a recording is already waiting for submit, that one is kept.
+    bool Recorded(uint32_t InSlot);
+    bool HasRecorded() const { return _recordedSlot >= 0; }
+
+    // Fence values for submitting recorded slot
+    Submission Submit();
+
+    // True when GPU is done with InSlot's lists and its allocators can be reset
+    bool SlotFree(uint32_t InSlot, uint64_t InCompletedValue) const;
+
+    // DoneValue game queue didn't wait yet, 0 if there is none
+    uint64_t TakeWait();
+
+    // Waiting this value drains FG queue
+    uint64_t LastValue() const { return _lastValue; }
+    uint64_t CpuWaitCount() const { return _cpuWaits; }
+    uint64_t DroppedCount() const { return _dropped; }
+
+    FGQueueScheduler() = default;
+    FGQueueScheduler(Policy InPolicy, uint32_t InSlotCount);
+};
@@ -0,0 +1,139 @@
+#include "FramePacingModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+FramePacingModel::FramePacingModel(double InAlpha) : _alpha(std::clamp(InAlpha, 0.01, 1.0)) {}
+
+double FramePacingModel::StdDev() const { return std::sqrt(_variance); }
+
+void FramePacingModel::Reset()
+{
+    _mean = 0.0;
+    _variance = 0.0;
+    _samples = 0;
+    _outlierRun = 0;
+    _limiterInterval = 0.0;
+}
+
+bool FramePacingModel::Sample(double InFrameTimeMs)
+{
+    // Zero is first frame, over a second is a pause
+    if (InFrameTimeMs <= 0.0 || InFrameTimeMs > 1000.0)
+        return false;
+
+    if (_samples == 0)
+    {
+        _mean = InFrameTimeMs;
+        _variance = 0.0;
+        _samples = 1;
+        return true;
+    }
+
+    auto delta = InFrameTimeMs - _mean;
+
+    // 4 sigma with a floor, so very stable frame times don't reject everything
+    if (IsWarm())
+    {
+        auto limit = std::max(4.0 * StdDev(), 0.25 * _mean);
+
+        if (std::abs(delta) > limit)
+        {
+            _outliers++;
+
+            // Frame rate changed, not a hitch
+            if (++_outlierRun >= OutlierRestart)
+            {
+                Reset();
+                _mean = InFrameTimeMs;
+                _samples = 1;
+            }
+
+            return false;
+        }
+    }
+
+    _outlierRun = 0;
+
+    // Faster adaptation until warm
+    auto alpha = std::max(_alpha, 1.0 / (double) (_samples + 1));
+
+    _mean += alpha * delta;
+    _variance = (1.0 - alpha) * (_variance + alpha * delta * delta);
+    _samples++;
+
+    if (IsWarm())
+        UpdateTuning();
+
+    return true;
+}
+
+void FramePacingModel::UpdateTuning()
+{
+    auto stdDev = StdDev();
+    auto cv = _mean > 0.0 ? stdDev / _mean : 0.0;
+
+    // Steady frame times can be paced tighter, noisy ones need more room
+    _tuning.SafetyMarginInMs = (float) std::clamp(0.5 * stdDev, 0.01, 1.0);
+    _tuning.VarianceFactor = (float) std::clamp(0.1 + 2.0 * cv, 0.1, 0.5);
+
+    auto moved = [](float a, float b) { return std::abs(a - b) > std::max(0.2f * b, 0.005f); };
+
+    if (moved(_tuning.SafetyMarginInMs, _appliedTuning.SafetyMarginInMs) ||
+        moved(_tuning.VarianceFactor, _appliedTuning.VarianceFactor))
+    {
+        _appliedTuning = _tuning;
+        _tuningChanged = true;
+    }
+}
+
+bool FramePacingModel::TakeTuningChange()
+{
+    auto changed = _tuningChanged;
+    _tuningChanged = false;
+    return changed;
+}
+
+void FramePacingModel::SampleWork(double InWorkTimeMs)
+{
+    if (InWorkTimeMs <= 0.0 || InWorkTimeMs > 1000.0)
+        return;
+
+    _workTimes[_workSamples % WorkWindow] = InWorkTimeMs;
+    _workSamples++;
+}
+
+double FramePacingModel::WorkPercentile(double InPercentile) const
+{
+    auto count = std::min(_workSamples, WorkWindow);
+
+    if (count == 0)
+        return 0.0;
+
+    std::array<double, WorkWindow> sorted = _workTimes;
+    auto nth = sorted.begin() + (size_t) (InPercentile * (count - 1));
+    std::nth_element(sorted.begin(), nth, sorted.begin() + count);
+
+    return *nth;
+}
+
+double FramePacingModel::LimiterInterval(double InCapIntervalMs)
+{
+    if (_workSamples < WarmupSamples || InCapIntervalMs <= 0.0)
+        return InCapIntervalMs;
+
+    // Game reaches the cap, limiter paces it
+    auto target = InCapIntervalMs;
+
+    // Most frames should make it, otherwise hit / miss pattern makes uneven spacing
+    if (WorkMedian() > InCapIntervalMs)
+        target = WorkPercentile(0.75);
+
+    // Hysteresis of 5%, raise at once but decay slowly so a few fast frames don't make spacing uneven
+    if (_limiterInterval < InCapIntervalMs || target > 1.05 * _limiterInterval)
+        _limiterInterval = target;
+    else if (target < 0.95 * _limiterInterval || target == InCapIntervalMs)
+        _limiterInterval = std::max(target, 0.98 * _limiterInterval);
+
+    return std::max(_limiterInterval, InCapIntervalMs);
+}
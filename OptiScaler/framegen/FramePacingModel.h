@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Models recent real frame intervals for frame generation pacing.
+// Keeps EWMA of frame time and its variance, samples far from the mean are rejected as outliers (loading hitches,
+// alt-tab) unless they keep coming, then model restarts from the new level.
+// From the model it suggests FSR-FG pacing tuning.
+// Frame limiter feeds frame times measured before its sleep separately, limiter interval stays at the cap unless
+// median of those is over the cap, then it's raised to what game can sustain so generated frames are placed between
+// evenly spaced real frames. It decays back to the cap when the game speeds up.
+class FramePacingModel
+{
+  public:
+    struct Tuning
+    {
+        float SafetyMarginInMs = 0.01f;
+        float VarianceFactor = 0.3f;
+    };
+
+    static constexpr uint32_t WarmupSamples = 16;
+    static constexpr uint32_t OutlierRestart = 8;
+    static constexpr uint32_t WorkWindow = 32;
+
+  private:
+    double _alpha = 0.1;
+    double _mean = 0.0;
+    double _variance = 0.0;
+
+    uint32_t _samples = 0;
+    uint32_t _outlierRun = 0;
+    uint64_t _outliers = 0;
+
+    Tuning _tuning {};
+    Tuning _appliedTuning {};
+    bool _tuningChanged = false;
+
+    std::array<double, WorkWindow> _workTimes {};
+    uint32_t _workSamples = 0;
+    double _limiterInterval = 0.0;
+
+    void UpdateTuning();
+    double WorkPercentile(double InPercentile) const;
+
+  public:
+    // Adds a real frame interval, returns false if it was rejected as outlier
+    bool Sample(double InFrameTimeMs);
+
+    // Adds frame time measured before limiter sleeps
+    void SampleWork(double InWorkTimeMs);
+    void Reset();
+
+    bool IsWarm() const { return _samples >= WarmupSamples; }
+    double Mean() const { return _mean; }
+    double Variance() const { return _variance; }
+    double StdDev() const;
+    uint64_t OutlierCount() const { return _outliers; }
+
+    // Returns true once after suggested tuning moved enough to be worth applying
+    bool TakeTuningChange();
+    Tuning CurrentTuning() const { return _appliedTuning; }
+
+    // Interval limiter should use for InCapIntervalMs, raised to what game can sustain when cap is missed
+    double LimiterInterval(double InCapIntervalMs);
+    double WorkMedian() const { return WorkPercentile(0.5); }
+
+    FramePacingModel() = default;
+    explicit FramePacingModel(double InAlpha);
+};
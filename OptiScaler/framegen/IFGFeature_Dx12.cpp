@@ -3,6 +3,8 @@
 #include <State.h>
 #include <Config.h>
 
+#include <resource_tracking/ResTrack_dx12.h>
+
 bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource* source, D3D12_RESOURCE_STATES state,
                                            ID3D12Resource** target, bool UAV, bool depth)
 {
@@ -57,33 +59,51 @@ bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource*
     return true;
 }
 
-void IFGFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* resource,
-                                      D3D12_RESOURCE_STATES beforeState, D3D12_RESOURCE_STATES afterState)
+PassGraph_Dx12* IFGFeature_Dx12::InputGraph()
 {
-    D3D12_RESOURCE_BARRIER barrier = {};
-    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    barrier.Transition.pResource = resource;
-    barrier.Transition.StateBefore = beforeState;
-    barrier.Transition.StateAfter = afterState;
-    barrier.Transition.Subresource = 0;
-    cmdList->ResourceBarrier(1, &barrier);
+    if (_inputGraph == nullptr)
+        _inputGraph = std::make_unique<PassGraph_Dx12>("FGInputGraph");
+
+    return _inputGraph.get();
 }
 
-bool IFGFeature_Dx12::CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                                   D3D12_RESOURCE_STATES sourceState)
+bool IFGFeature_Dx12::RecordCopy(ID3D12Resource* source, ID3D12Resource** target, D3D12_RESOURCE_STATES sourceState,
+                                 ID3D12Resource** param, D3D12_RESOURCE_STATES* paramState)
 {
-    auto result = true;
+    if (!CreateBufferResource(State::Instance().currentD3D12Device, source, D3D12_RESOURCE_STATE_COPY_DEST, target))
+        return false;
+
+    auto copy = *target;
+    auto graph = InputGraph();
+    auto sourceId = graph->Import("Source", source, sourceState, sourceState);
+    auto targetId = graph->Import("Copy", copy, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COPY_DEST);
+
+    auto pass = graph->AddPass("Copy",
+                               [source, copy, param, paramState](auto copyCmdList)
+                               {
+                                   copyCmdList->CopyResource(copy, source);
+
+                                   *param = copy;
 
-    ResourceBarrier(cmdList, source, sourceState, D3D12_RESOURCE_STATE_COPY_SOURCE);
+                                   if (paramState != nullptr)
+                                       *paramState = D3D12_RESOURCE_STATE_COPY_DEST;
 
-    if (CreateBufferResource(State::Instance().currentD3D12Device, source, D3D12_RESOURCE_STATE_COPY_DEST, target))
-        cmdList->CopyResource(*target, source);
-    else
-        result = false;
+                                   return true;
+                               });
 
-    ResourceBarrier(cmdList, source, D3D12_RESOURCE_STATE_COPY_SOURCE, sourceState);
+    graph->Read(pass, sourceId, D3D12_RESOURCE_STATE_COPY_SOURCE);
+    graph->Write(pass, targetId, D3D12_RESOURCE_STATE_COPY_DEST);
+
+    return true;
+}
+
+bool IFGFeature_Dx12::ExecuteInputs(ID3D12GraphicsCommandList* cmdList)
+{
+    if (_inputGraph == nullptr || _inputGraph->PassCount() == 0)
+        return true;
 
-    return result;
+    LOG_TRACE("Recording {} input passes", _inputGraph->PassCount());
+    return _inputGraph->Execute(cmdList);
 }
 
 void IFGFeature_Dx12::SetVelocity(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* velocity,
@@ -96,6 +116,7 @@ void IFGFeature_Dx12::SetVelocity(ID3D12GraphicsCommandList* cmdList, ID3D12Reso
         return;
 
     _paramVelocity[index] = velocity;
+    _paramVelocityState[index] = state;
 
     if (Config::Instance()->FGResourceFlip.value_or_default() && _device != nullptr &&
         CreateBufferResource(_device, velocity, D3D12_RESOURCE_STATE_COPY_DEST, &_paramVelocityCopy[index], true,
@@ -109,30 +130,46 @@ void IFGFeature_Dx12::SetVelocity(ID3D12GraphicsCommandList* cmdList, ID3D12Reso
 
         if (_mvFlip->IsInit())
         {
-            ResourceBarrier(cmdList, _paramVelocityCopy[index], D3D12_RESOURCE_STATE_COPY_DEST,
-                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-
             auto feature = State::Instance().currentFeature;
             UINT width = feature->LowResMV() ? feature->RenderWidth() : feature->DisplayWidth();
             UINT height = feature->LowResMV() ? feature->RenderHeight() : feature->DisplayHeight();
-            auto result = _mvFlip->Dispatch(_device, cmdList, velocity, _paramVelocityCopy[index], width, height, true);
-
-            ResourceBarrier(cmdList, _paramVelocityCopy[index], D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                            D3D12_RESOURCE_STATE_COPY_DEST);
 
-            if (result)
-                _paramVelocity[index] = _paramVelocityCopy[index];
+            // Velocity is read in the state game gave, only the copy is tracked.
+            // Recorded with depth in ExecuteInputs, velocity param is switched to the copy when the flip succeeds
+            auto graph = InputGraph();
+            auto copyId = graph->Import("VelocityCopy", _paramVelocityCopy[index], D3D12_RESOURCE_STATE_COPY_DEST,
+                                        D3D12_RESOURCE_STATE_COPY_DEST);
+
+            auto pass = graph->AddPass("VelocityFlip",
+                                       [this, velocity, index, width, height](auto flipCmdList)
+                                       {
+                                           if (!_mvFlip->Dispatch(_device, flipCmdList, velocity,
+                                                                  _paramVelocityCopy[index], width, height, true))
+                                               return false;
+
+                                           _paramVelocity[index] = _paramVelocityCopy[index];
+                                           _paramVelocityState[index] = D3D12_RESOURCE_STATE_COPY_DEST;
+                                           return true;
+                                       });
+
+            graph->Write(pass, copyId, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
         }
 
         return;
     }
 
-    if (Config::Instance()->FGMakeMVCopy.value_or_default() &&
-        CopyResource(cmdList, velocity, &_paramVelocityCopy[index], state))
+    // FG queue reads inputs after game queue continues, writes after upscaler are not ordered anymore
+    if (Config::Instance()->FGInputHandoff.value_or_default() &&
+        Handoff.Register(FGInputHandoff::Velocity, velocity,
+                         ResTrack_Dx12::IsHooked() && !_queueScheduler.UsesQueue()))
     {
-        _paramVelocity[index] = _paramVelocityCopy[index];
+        LOG_TRACE("Using velocity without copy");
         return;
     }
+
+    // Compute queue can't transition from graphics states, async policy reads the copies
+    if (Config::Instance()->FGMakeMVCopy.value_or_default() || _queueScheduler.GetPolicy() == FGQueueScheduler::Async)
+        RecordCopy(velocity, &_paramVelocityCopy[index], state, &_paramVelocity[index], &_paramVelocityState[index]);
 }
 
 void IFGFeature_Dx12::SetDepth(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* depth, D3D12_RESOURCE_STATES state)
@@ -144,6 +181,7 @@ void IFGFeature_Dx12::SetDepth(ID3D12GraphicsCommandList* cmdList, ID3D12Resourc
         return;
 
     _paramDepth[index] = depth;
+    _paramDepthState[index] = state;
 
     if (Config::Instance()->FGResourceFlip.value_or_default() && _device != nullptr)
     {
@@ -158,28 +196,42 @@ void IFGFeature_Dx12::SetDepth(ID3D12GraphicsCommandList* cmdList, ID3D12Resourc
 
         if (_depthFlip->IsInit())
         {
-            ResourceBarrier(cmdList, _paramDepthCopy[index], D3D12_RESOURCE_STATE_COPY_DEST,
-                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-
             auto feature = State::Instance().currentFeature;
-            auto result = _depthFlip->Dispatch(_device, cmdList, depth, _paramDepthCopy[index], feature->RenderWidth(),
-                                               feature->RenderHeight(), false);
-
-            ResourceBarrier(cmdList, _paramDepthCopy[index], D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                            D3D12_RESOURCE_STATE_COPY_DEST);
-
-            if (result)
-                _paramDepth[index] = _paramDepthCopy[index];
+            UINT width = feature->RenderWidth();
+            UINT height = feature->RenderHeight();
+
+            auto graph = InputGraph();
+            auto copyId = graph->Import("DepthCopy", _paramDepthCopy[index], D3D12_RESOURCE_STATE_COPY_DEST,
+                                        D3D12_RESOURCE_STATE_COPY_DEST);
+
+            auto pass = graph->AddPass("DepthFlip",
+                                       [this, depth, index, width, height](auto flipCmdList)
+                                       {
+                                           if (!_depthFlip->Dispatch(_device, flipCmdList, depth,
+                                                                     _paramDepthCopy[index], width, height, false))
+                                               return false;
+
+                                           _paramDepth[index] = _paramDepthCopy[index];
+                                           _paramDepthState[index] = D3D12_RESOURCE_STATE_COPY_DEST;
+                                           return true;
+                                       });
+
+            graph->Write(pass, copyId, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
         }
 
         return;
     }
 
-    if (Config::Instance()->FGMakeDepthCopy.value_or_default() &&
-        CopyResource(cmdList, depth, &_paramDepthCopy[index], state))
+    if (Config::Instance()->FGInputHandoff.value_or_default() &&
+        Handoff.Register(FGInputHandoff::Depth, depth, ResTrack_Dx12::IsHooked() && !_queueScheduler.UsesQueue()))
     {
-        _paramDepth[index] = _paramDepthCopy[index];
+        LOG_TRACE("Using depth without copy");
+        return;
     }
+
+    if (Config::Instance()->FGMakeDepthCopy.value_or_default() ||
+        _queueScheduler.GetPolicy() == FGQueueScheduler::Async)
+        RecordCopy(depth, &_paramDepthCopy[index], state, &_paramDepth[index], &_paramDepthState[index]);
 }
 
 void IFGFeature_Dx12::SetHudless(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* hudless,
@@ -194,10 +246,11 @@ void IFGFeature_Dx12::SetHudless(ID3D12GraphicsCommandList* cmdList, ID3D12Resou
         return;
     }
 
-    if (makeCopy && CopyResource(cmdList, hudless, &_paramHudlessCopy[index], state))
-        _paramHudless[index] = _paramHudlessCopy[index];
-    else
-        _paramHudless[index] = hudless;
+    // Copy pass switches the param to the copy when it's recorded
+    _paramHudless[index] = hudless;
+
+    if (makeCopy && RecordCopy(hudless, &_paramHudlessCopy[index], state, &_paramHudless[index], nullptr))
+        ExecuteInputs(cmdList);
 }
 
 void IFGFeature_Dx12::CreateObjects(ID3D12Device* InDevice)
@@ -247,6 +300,298 @@ void IFGFeature_Dx12::CreateObjects(ID3D12Device* InDevice)
         }
 
     } while (false);
+
+    if (!CreateQueueObjects(InDevice))
+        ReleaseQueueObjects();
+}
+
+bool IFGFeature_Dx12::CreateQueueObjects(ID3D12Device* InDevice)
+{
+    auto policy = (FGQueueScheduler::Policy) Config::Instance()->FGQueuePolicy.value_or_default();
+    _queueScheduler = FGQueueScheduler(FGQueueScheduler::Inline, BUFFER_COUNT);
+
+    if (policy == FGQueueScheduler::Inline)
+        return true;
+
+    // Submits depend on resource tracking hooks
+    if (!ResTrack_Dx12::IsHooked())
+    {
+        LOG_WARN("Resource tracking is not active, using inline FG queue policy");
+        return true;
+    }
+
+    auto listType =
+        policy == FGQueueScheduler::Async ? D3D12_COMMAND_LIST_TYPE_COMPUTE : D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = listType;
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    queueDesc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_HIGH;
+
+    auto result = InDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&_fgQueue));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommandQueue _fgQueue: {:X}", (unsigned long) result);
+        return false;
+    }
+
+    _fgQueue->SetName(L"_fgQueue");
+
+    result = InDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_fgFence));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateFence _fgFence: {:X}", (unsigned long) result);
+        return false;
+    }
+
+    _fgFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (_fgFenceEvent == nullptr)
+    {
+        LOG_ERROR("CreateEvent _fgFenceEvent failed");
+        return false;
+    }
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        ID3D12CommandAllocator* allocator = nullptr;
+        result = InDevice->CreateCommandAllocator(listType, IID_PPV_ARGS(&allocator));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandAllocators _prepareAllocators[{}]: {:X}", i, (unsigned long) result);
+            return false;
+        }
+        allocator->SetName(L"_prepareAllocator");
+        if (!CheckForRealObject(__FUNCTION__, allocator, (IUnknown**) &_prepareAllocators[i]))
+            _prepareAllocators[i] = allocator;
+
+        ID3D12GraphicsCommandList* cmdList = nullptr;
+        result = InDevice->CreateCommandList(0, listType, _prepareAllocators[i], NULL, IID_PPV_ARGS(&cmdList));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandList _prepareCommandList[{}]: {:X}", i, (unsigned long) result);
+            return false;
+        }
+        cmdList->SetName(L"_prepareCommandList");
+        if (!CheckForRealObject(__FUNCTION__, cmdList, (IUnknown**) &_prepareCommandList[i]))
+            _prepareCommandList[i] = cmdList;
+
+        result = _prepareCommandList[i]->Close();
+        if (result != S_OK)
+        {
+            LOG_ERROR("_prepareCommandList[{}]->Close: {:X}", i, (unsigned long) result);
+            return false;
+        }
+    }
+
+    _queueScheduler = FGQueueScheduler(policy, BUFFER_COUNT);
+    LOG_INFO("FG queue policy: {}", (UINT) policy);
+
+    return true;
+}
+
+void IFGFeature_Dx12::ReleaseQueueObjects()
+{
+    // Drain FG queue before releasing lists
+    if (_fgFence != nullptr && _fgFenceEvent != nullptr && _fgFence->GetCompletedValue() < _queueScheduler.LastValue())
+    {
+        _fgFence->SetEventOnCompletion(_queueScheduler.LastValue(), _fgFenceEvent);
+        WaitForSingleObject(_fgFenceEvent, 1000);
+    }
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        if (_prepareCommandList[i] != nullptr)
+        {
+            _prepareCommandList[i]->Release();
+            _prepareCommandList[i] = nullptr;
+        }
+
+        if (_prepareAllocators[i] != nullptr)
+        {
+            _prepareAllocators[i]->Release();
+            _prepareAllocators[i] = nullptr;
+        }
+    }
+
+    if (_fgQueue != nullptr)
+    {
+        _fgQueue->Release();
+        _fgQueue = nullptr;
+    }
+
+    if (_fgFence != nullptr)
+    {
+        _fgFence->Release();
+        _fgFence = nullptr;
+    }
+
+    if (_fgFenceEvent != nullptr)
+    {
+        CloseHandle(_fgFenceEvent);
+        _fgFenceEvent = nullptr;
+    }
+
+    _prepareSourceList = nullptr;
+    _preparing = false;
+    _queueScheduler = FGQueueScheduler(FGQueueScheduler::Inline, BUFFER_COUNT);
+}
+
+bool IFGFeature_Dx12::WaitForSlot(UINT InSlot)
+{
+    _slotBusy = false;
+
+    if (!_queueScheduler.UsesQueue())
+        return true;
+
+    auto waitValue = _queueScheduler.Begin(InSlot, _fgFence->GetCompletedValue());
+
+    if (waitValue == 0)
+        return true;
+
+    LOG_DEBUG("Waiting FG queue, slot: {}, value: {}", InSlot, waitValue);
+
+    // Keep waiting while GPU makes progress, completed value is UINT64_MAX after device removal
+    while (!_queueScheduler.SlotFree(InSlot, _fgFence->GetCompletedValue()))
+    {
+        if (_fgFence->GetCompletedValue() == UINT64_MAX ||
+            _fgFence->SetEventOnCompletion(waitValue, _fgFenceEvent) != S_OK)
+        {
+            break;
+        }
+
+        if (WaitForSingleObject(_fgFenceEvent, 1000) == WAIT_TIMEOUT)
+            LOG_WARN("FG queue is not done with slot: {}, value: {}", InSlot, waitValue);
+    }
+
+    _slotBusy = !_queueScheduler.SlotFree(InSlot, _fgFence->GetCompletedValue());
+
+    if (_slotBusy)
+        LOG_ERROR("FG queue can't finish slot: {}, value: {}", InSlot, waitValue);
+
+    return !_slotBusy;
+}
+
+static bool IsComputeState(D3D12_RESOURCE_STATES state)
+{
+    constexpr auto computeStates = D3D12_RESOURCE_STATE_UNORDERED_ACCESS |
+                                   D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_COPY_DEST |
+                                   D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+    return (state & ~computeStates) == 0;
+}
+
+ID3D12GraphicsCommandList* IFGFeature_Dx12::BeginPrepare(ID3D12GraphicsCommandList* InGameCmdList, UINT InSlot)
+{
+    _preparing = false;
+
+    if (!_queueScheduler.UsesQueue() || _prepareCommandList[InSlot] == nullptr || _slotBusy)
+        return InGameCmdList;
+
+    // Compute queue can't transition from graphics states
+    if (_queueScheduler.GetPolicy() == FGQueueScheduler::Async &&
+        (!IsComputeState(_paramVelocityState[InSlot]) || !IsComputeState(_paramDepthState[InSlot])))
+    {
+        LOG_DEBUG("Inputs are not in compute states, recording prepare on game queue");
+        return InGameCmdList;
+    }
+
+    auto result = _prepareAllocators[InSlot]->Reset();
+    if (result == S_OK)
+        result = _prepareCommandList[InSlot]->Reset(_prepareAllocators[InSlot], nullptr);
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("_prepareCommandList[{}]->Reset: {:X}", InSlot, (unsigned long) result);
+        return InGameCmdList;
+    }
+
+    _preparing = true;
+    _prepareSourceList = InGameCmdList;
+
+    return _prepareCommandList[InSlot];
+}
+
+void IFGFeature_Dx12::EndPrepare(UINT InSlot, bool InSuccess)
+{
+    if (!_preparing)
+        return;
+
+    _preparing = false;
+
+    auto result = _prepareCommandList[InSlot]->Close();
+    if (result != S_OK)
+    {
+        LOG_ERROR("_prepareCommandList[{}]->Close: {:X}", InSlot, (unsigned long) result);
+        return;
+    }
+
+    if (InSuccess)
+        _queueScheduler.Recorded(InSlot);
+}
+
+ID3D12GraphicsCommandList* IFGFeature_Dx12::BeginHudlessPrepare(UINT InSlot)
+{
+    // Dedicated direct queue runs the hudless list itself
+    if (_queueScheduler.GetPolicy() != FGQueueScheduler::Async)
+    {
+        _preparing = false;
+        return _commandList[InSlot];
+    }
+
+    auto cmdList = BeginPrepare(_commandList[InSlot], InSlot);
+
+    // Not waiting for a game list, hudless list's submit starts it
+    if (_preparing)
+        _prepareSourceList = nullptr;
+
+    return cmdList;
+}
+
+bool IFGFeature_Dx12::ExecutePrepare(ID3D12CommandQueue* InQueue, UINT InNumCommandLists,
+                                     ID3D12CommandList* const* InCommandLists)
+{
+    if (!_queueScheduler.HasRecorded() || _prepareSourceList == nullptr)
+        return false;
+
+    auto found = false;
+    for (size_t i = 0; i < InNumCommandLists; i++)
+    {
+        if (InCommandLists[i] == _prepareSourceList)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    _prepareSourceList = nullptr;
+
+    auto submission = _queueScheduler.Submit();
+
+    InQueue->Signal(_fgFence, submission.InputValue);
+    _fgQueue->Wait(_fgFence, submission.InputValue);
+
+    ID3D12CommandList* cl[] = { _prepareCommandList[submission.Slot] };
+    _fgQueue->ExecuteCommandLists(1, cl);
+    _fgQueue->Signal(_fgFence, submission.DoneValue);
+
+    LOG_DEBUG("Prepare submitted, slot: {}, input: {}, done: {}", submission.Slot, submission.InputValue,
+              submission.DoneValue);
+
+    return true;
+}
+
+void IFGFeature_Dx12::WaitForFGQueue()
+{
+    if (!_queueScheduler.UsesQueue() || _gameCommandQueue == nullptr)
+        return;
+
+    auto waitValue = _queueScheduler.TakeWait();
+
+    if (waitValue != 0)
+        _gameCommandQueue->Wait(_fgFence, waitValue);
 }
 
 void IFGFeature_Dx12::ReleaseObjects()
@@ -268,6 +613,8 @@ void IFGFeature_Dx12::ReleaseObjects()
         }
     }
 
+    ReleaseQueueObjects();
+
     _mvFlip.reset();
     _depthFlip.reset();
 }
@@ -278,7 +625,7 @@ bool IFGFeature_Dx12::IsFGCommandList(void* cmdList)
 
     for (size_t i = 0; i < BUFFER_COUNT; i++)
     {
-        if (_commandList[i] == cmdList)
+        if (_commandList[i] == cmdList || _prepareCommandList[i] == cmdList)
         {
             found = true;
             break;
@@ -305,7 +652,32 @@ bool IFGFeature_Dx12::ExecuteHudlessCmdList()
     if (result == S_OK)
     {
         ID3D12CommandList* cl[] = { cl[0] = _commandList[fIndex] };
-        _gameCommandQueue->ExecuteCommandLists(1, cl);
+
+        // Async policy recorded prepare to compute list of the slot (BeginHudlessPrepare), hudless list is empty then.
+        // Dedicated direct queue runs the hudless list itself,
+        // prepare recorded on FG queue is waiting for the game's list, it can't be replaced
+        auto asyncPrepare = _queueScheduler.GetPolicy() == FGQueueScheduler::Async && _queueScheduler.HasRecorded() &&
+                            _prepareSourceList == nullptr;
+
+        if (asyncPrepare ||
+            (_queueScheduler.GetPolicy() == FGQueueScheduler::Direct && _queueScheduler.Recorded(fIndex)))
+        {
+            auto submission = _queueScheduler.Submit();
+
+            if (asyncPrepare)
+                cl[0] = _prepareCommandList[submission.Slot];
+
+            _gameCommandQueue->Signal(_fgFence, submission.InputValue);
+            _fgQueue->Wait(_fgFence, submission.InputValue);
+            Hudfix_Dx12::WaitForCapture(_fgQueue);
+            _fgQueue->ExecuteCommandLists(1, cl);
+            _fgQueue->Signal(_fgFence, submission.DoneValue);
+        }
+        else
+        {
+            Hudfix_Dx12::WaitForCapture(_gameCommandQueue);
+            _gameCommandQueue->ExecuteCommandLists(1, cl);
+        }
 
         return true;
     }
@@ -1,10 +1,13 @@
 #pragma once
 #include <pch.h>
 #include "IFGFeature.h"
+#include "FGInputHandoff.h"
+#include "FGQueueScheduler.h"
 
 #include <upscalers/IFeature.h>
 
 #include <shaders/resource_flip/RF_Dx12.h>
+#include <pass_graph/PassGraph_Dx12.h>
 
 #include <dxgi1_6.h>
 #include <d3d12.h>
@@ -17,8 +20,25 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool _hudlessDispatchReady = false;
     std::unique_ptr<RF_Dx12> _mvFlip;
     std::unique_ptr<RF_Dx12> _depthFlip;
+    std::unique_ptr<PassGraph_Dx12> _inputGraph;
     ID3D12Device* _device = nullptr;
 
+    // FG queue objects, only created when QueuePolicy is not inline
+    ID3D12CommandQueue* _fgQueue = nullptr;
+    ID3D12Fence* _fgFence = nullptr;
+    HANDLE _fgFenceEvent = nullptr;
+    ID3D12GraphicsCommandList* _prepareCommandList[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
+    ID3D12CommandAllocator* _prepareAllocators[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
+    ID3D12GraphicsCommandList* _prepareSourceList = nullptr;
+    bool _slotBusy = false;
+    bool _preparing = false;
+
+    // Records copies and flips of FG inputs on game's command list
+    PassGraph_Dx12* InputGraph();
+
+    bool CreateQueueObjects(ID3D12Device* InDevice);
+    void ReleaseQueueObjects();
+
   protected:
     IDXGISwapChain* _swapChain = nullptr;
     ID3D12CommandQueue* _gameCommandQueue = nullptr;
@@ -28,20 +48,39 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     ID3D12Resource* _paramVelocityCopy[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     ID3D12Resource* _paramDepth[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     ID3D12Resource* _paramDepthCopy[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
+    D3D12_RESOURCE_STATES _paramVelocityState[BUFFER_COUNT] = {};
+    D3D12_RESOURCE_STATES _paramDepthState[BUFFER_COUNT] = {};
     ID3D12Resource* _paramHudless[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     ID3D12Resource* _paramHudlessCopy[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
 
     ID3D12GraphicsCommandList* _commandList[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     ID3D12CommandAllocator* _commandAllocators[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
 
+    FGQueueScheduler _queueScheduler;
+
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, D3D12_RESOURCE_STATES InState,
                               ID3D12Resource** OutResource, bool UAV = false, bool depth = false);
-    void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
-                         D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
-    bool CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                      D3D12_RESOURCE_STATES sourceState);
+
+    // Records a copy of source to InputGraph, param (and paramState) is switched to the copy when the pass runs
+    bool RecordCopy(ID3D12Resource* source, ID3D12Resource** target, D3D12_RESOURCE_STATES sourceState,
+                    ID3D12Resource** param, D3D12_RESOURCE_STATES* paramState);
+
+    // Waits on CPU until FG queue is done with the slot's command lists.
+    // Returns false when the slot is still in use (device lost), its allocators must not be reset then.
+    bool WaitForSlot(UINT InSlot);
+
+    // Returns command list to record FG prepare, game's list when prepare can't run on FG queue
+    ID3D12GraphicsCommandList* BeginPrepare(ID3D12GraphicsCommandList* InGameCmdList, UINT InSlot);
+    void EndPrepare(UINT InSlot, bool InSuccess);
+
+    // Returns command list to record FG prepare of hudless path, FG queue's list with async policy.
+    // Submitted by ExecuteHudlessCmdList
+    ID3D12GraphicsCommandList* BeginHudlessPrepare(UINT InSlot);
 
   public:
+    // Decides if velocity and depth are used without copies, fed by resource tracking
+    FGInputHandoff Handoff;
+
     virtual bool CreateSwapchain(IDXGIFactory* factory, ID3D12CommandQueue* cmdQueue, DXGI_SWAP_CHAIN_DESC* desc,
                                  IDXGISwapChain** swapChain) = 0;
     virtual bool CreateSwapchain1(IDXGIFactory* factory, ID3D12CommandQueue* cmdQueue, HWND hwnd,
@@ -62,14 +101,24 @@ class IFGFeature_Dx12 : public virtual IFGFeature
 
     void CreateObjects(ID3D12Device* InDevice);
 
+    // Velocity and depth copies & flips are recorded to InputGraph, call ExecuteInputs after setting both
     void SetVelocity(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* velocity, D3D12_RESOURCE_STATES state);
     void SetDepth(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* depth, D3D12_RESOURCE_STATES state);
+
+    // Records input passes of this frame as one graph, so their barriers are batched
+    bool ExecuteInputs(ID3D12GraphicsCommandList* cmdList);
     void SetHudless(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* hudless, D3D12_RESOURCE_STATES state,
                     bool makeCopy = false);
 
     bool IsFGCommandList(void* cmdList);
     bool ExecuteHudlessCmdList();
 
+    // Submits recorded prepare to FG queue when game submits the list with upscaler inputs
+    bool ExecutePrepare(ID3D12CommandQueue* InQueue, UINT InNumCommandLists, ID3D12CommandList* const* InCommandLists);
+
+    // Makes game queue wait for submitted FG queue work, called before present
+    void WaitForFGQueue();
+
     IFGFeature_Dx12() = default;
 
     // Inherited via IFGFeature
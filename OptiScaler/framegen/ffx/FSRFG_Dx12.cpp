@@ -6,8 +6,6 @@
 #include <menu/menu_overlay_dx.h>
 #include <future>
 
-// #define USE_QUEUE_FOR_FG
-
 typedef struct FfxSwapchainFramePacingTuning
 {
     float safetyMarginInMs;  // in Millisecond. Default is 0.1ms
@@ -19,6 +17,30 @@ typedef struct FfxSwapchainFramePacingTuning
                                           // false.
 } FfxSwapchainFramePacingTuning;
 
+// Inputs used without copies are passed in the state upscaler received them
+static uint32_t ToFfxResourceState(D3D12_RESOURCE_STATES state)
+{
+    if (state & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+        return FFX_API_RESOURCE_STATE_UNORDERED_ACCESS;
+
+    if (state & D3D12_RESOURCE_STATE_COPY_DEST)
+        return FFX_API_RESOURCE_STATE_COPY_DEST;
+
+    if (state & D3D12_RESOURCE_STATE_COPY_SOURCE)
+        return FFX_API_RESOURCE_STATE_COPY_SRC;
+
+    if (state & D3D12_RESOURCE_STATE_RENDER_TARGET)
+        return FFX_API_RESOURCE_STATE_RENDER_TARGET;
+
+    if ((state & D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE) == D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE)
+        return FFX_API_RESOURCE_STATE_PIXEL_COMPUTE_READ;
+
+    if (state & D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
+        return FFX_API_RESOURCE_STATE_PIXEL_READ;
+
+    return FFX_API_RESOURCE_STATE_COMPUTE_READ;
+}
+
 void FSRFG_Dx12::ConfigureFramePaceTuning()
 {
     State::Instance().FSRFGFTPchanged = false;
@@ -36,6 +58,17 @@ void FSRFG_Dx12::ConfigureFramePaceTuning()
         fpt.safetyMarginInMs = Config::Instance()->FGFPTSafetyMarginInMs.value_or_default();
         fpt.varianceFactor = Config::Instance()->FGFPTVarianceFactor.value_or_default();
 
+        auto& pacing = State::Instance().fgPacing;
+        if (Config::Instance()->FGAdaptivePacing.value_or_default() && pacing.IsWarm())
+        {
+            auto tuning = pacing.CurrentTuning();
+            fpt.safetyMarginInMs = tuning.SafetyMarginInMs;
+            fpt.varianceFactor = tuning.VarianceFactor;
+
+            LOG_DEBUG("Adaptive pacing, mean: {:.2f}ms, stddev: {:.2f}ms, safetyMargin: {:.3f}, varianceFactor: {:.3f}",
+                      pacing.Mean(), pacing.StdDev(), fpt.safetyMarginInMs, fpt.varianceFactor);
+        }
+
         ffxConfigureDescFrameGenerationSwapChainKeyValueDX12 cfgDesc {};
         cfgDesc.header.type = FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_KEYVALUE_DX12;
         cfgDesc.key = 2; // FfxSwapchainFramePacingTuning
@@ -64,7 +97,8 @@ UINT64 FSRFG_Dx12::UpscaleStart()
     {
         auto frameIndex = GetIndex();
 
-        if (Config::Instance()->FGHUDFix.value_or_default())
+        // Allocators of a slot which is still in use can't be reset
+        if (WaitForSlot(frameIndex) && Config::Instance()->FGHUDFix.value_or_default())
         {
             auto allocator = _commandAllocators[frameIndex];
             auto result = allocator->Reset();
@@ -182,6 +216,13 @@ bool FSRFG_Dx12::Dispatch(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* ou
     m_FrameGenerationConfig.frameID = _frameCount;
     m_FrameGenerationConfig.swapChain = _swapChain;
 
+    // Inputs used without copy are overwritten after upscaler, they are already invalid for this frame
+    if (!Handoff.Consumed())
+    {
+        LOG_WARN("(FG) Inputs overwritten after upscaler, skipping frame: {}", _frameCount);
+        m_FrameGenerationConfig.frameGenerationEnabled = false;
+    }
+
     ffxReturnCode_t retCode = FfxApiProxy::D3D12_Configure()(&_fgContext, &m_FrameGenerationConfig.header);
 
     if (retCode != FFX_API_RETURN_OK)
@@ -198,12 +239,7 @@ bool FSRFG_Dx12::Dispatch(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* ou
         dfgPrepare.header.pNext = &backendDesc.header;
 
         // GetDispatchCommandList();
-
-#ifdef USE_QUEUE_FOR_FG
-        dfgPrepare.commandList = _commandList[frameIndex];
-#else
-        dfgPrepare.commandList = cmdList;
-#endif
+        dfgPrepare.commandList = BeginPrepare(cmdList, frameIndex);
 
         dfgPrepare.frameID = _frameCount;
         dfgPrepare.flags = m_FrameGenerationConfig.flags;
@@ -212,8 +248,10 @@ bool FSRFG_Dx12::Dispatch(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* ou
 
         dfgPrepare.jitterOffset.x = _jitterX;
         dfgPrepare.jitterOffset.y = _jitterY;
-        dfgPrepare.motionVectors = ffxApiGetResourceDX12(_paramVelocity[frameIndex], FFX_API_RESOURCE_STATE_COPY_DEST);
-        dfgPrepare.depth = ffxApiGetResourceDX12(_paramDepth[frameIndex], FFX_API_RESOURCE_STATE_COPY_DEST);
+        dfgPrepare.motionVectors = ffxApiGetResourceDX12(_paramVelocity[frameIndex],
+                                                         ToFfxResourceState(_paramVelocityState[frameIndex]));
+        dfgPrepare.depth =
+            ffxApiGetResourceDX12(_paramDepth[frameIndex], ToFfxResourceState(_paramDepthState[frameIndex]));
 
         dfgPrepare.motionVectorScale.x = _mvScaleX;
         dfgPrepare.motionVectorScale.y = _mvScaleY;
@@ -225,6 +263,8 @@ bool FSRFG_Dx12::Dispatch(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* ou
 
         retCode = FfxApiProxy::D3D12_Dispatch()(&_fgContext, &dfgPrepare.header);
 
+        EndPrepare(frameIndex, retCode == FFX_API_RETURN_OK);
+
         if (retCode != FFX_API_RETURN_OK)
         {
             LOG_ERROR("(FG) D3D12_Dispatch result: {}({})", retCode, FfxApiProxy::ReturnCodeToString(retCode));
@@ -232,21 +272,6 @@ bool FSRFG_Dx12::Dispatch(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* ou
         else
         {
             LOG_DEBUG("(FG) Dispatch ok.");
-
-#ifdef USE_QUEUE_FOR_FG
-            if (!Config::Instance()->FGHudFixCloseAfterCallback.value_or_default())
-            {
-                ID3D12CommandList* cl[1] = { nullptr };
-                auto result = _commandList[frameIndex]->Close();
-                cl[0] = _commandList[frameIndex];
-                _commandQueue->ExecuteCommandLists(1, cl);
-
-                if (result != S_OK)
-                {
-                    LOG_ERROR("(FG) Close result: {}", (UINT) result);
-                }
-            }
-#endif
         }
     }
 
@@ -344,6 +369,13 @@ bool FSRFG_Dx12::DispatchHudless(bool useHudless, double frameTime)
     m_FrameGenerationConfig.frameID = _frameCount;
     m_FrameGenerationConfig.swapChain = State::Instance().currentSwapchain;
 
+    // Inputs used without copy are overwritten after upscaler, they are already invalid for this frame
+    if (!Handoff.Consumed())
+    {
+        LOG_WARN("(FG) Inputs overwritten after upscaler, skipping frame: {}", _frameCount);
+        m_FrameGenerationConfig.frameGenerationEnabled = false;
+    }
+
     ffxReturnCode_t retCode = FfxApiProxy::D3D12_Configure()(&_fgContext, &m_FrameGenerationConfig.header);
     LOG_DEBUG("D3D12_Configure result: {0:X}, frame: {1}, fIndex: {2}", retCode, _frameCount, fIndex);
 
@@ -358,7 +390,7 @@ bool FSRFG_Dx12::DispatchHudless(bool useHudless, double frameTime)
         dfgPrepare.header.pNext = &backendDesc.header;
 
         // GetDispatchCommandList();
-        dfgPrepare.commandList = _commandList[fIndex];
+        dfgPrepare.commandList = BeginHudlessPrepare(fIndex);
 
         dfgPrepare.frameID = _frameCount;
         dfgPrepare.flags = m_FrameGenerationConfig.flags;
@@ -368,8 +400,9 @@ bool FSRFG_Dx12::DispatchHudless(bool useHudless, double frameTime)
 
         dfgPrepare.jitterOffset.x = _jitterX;
         dfgPrepare.jitterOffset.y = _jitterY;
-        dfgPrepare.motionVectors = ffxApiGetResourceDX12(_paramVelocity[fIndex], FFX_API_RESOURCE_STATE_COPY_DEST);
-        dfgPrepare.depth = ffxApiGetResourceDX12(_paramDepth[fIndex], FFX_API_RESOURCE_STATE_COPY_DEST);
+        dfgPrepare.motionVectors =
+            ffxApiGetResourceDX12(_paramVelocity[fIndex], ToFfxResourceState(_paramVelocityState[fIndex]));
+        dfgPrepare.depth = ffxApiGetResourceDX12(_paramDepth[fIndex], ToFfxResourceState(_paramDepthState[fIndex]));
 
         dfgPrepare.motionVectorScale.x = _mvScaleX;
         dfgPrepare.motionVectorScale.y = _mvScaleY;
@@ -383,6 +416,8 @@ bool FSRFG_Dx12::DispatchHudless(bool useHudless, double frameTime)
         LOG_DEBUG("D3D12_Dispatch result: {0}, frame: {1}, fIndex: {2}, commandList: {3:X}", retCode, _frameCount,
                   fIndex, (size_t) dfgPrepare.commandList);
 
+        EndPrepare(fIndex, retCode == FFX_API_RETURN_OK);
+
         // if (retCode == FFX_API_RETURN_OK && !Config::Instance()->FGExecuteAfterCallback.value_or_default())
         //{
         //     auto result = _commandList[fIndex]->Close();
@@ -414,27 +449,8 @@ ffxReturnCode_t FSRFG_Dx12::DispatchCallback(ffxDispatchDescFrameGeneration* par
 
     params->reset = (_reset != 0);
 
-#ifdef USE_QUEUE_FOR_FG
-    if (Config::Instance()->FGHudFixCloseAfterCallback.value_or_default())
-    {
-        ID3D12CommandList* cl[1] = { nullptr };
-        auto result = _commandList[fIndex]->Close();
-        cl[0] = _commandList[fIndex];
-        _commandQueue->ExecuteCommandLists(1, cl);
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("(FG) Close result: {}", (UINT) result);
-        }
-    }
-#endif
-
     // check for status
-    if (!Config::Instance()->FGEnabled.value_or_default() || _fgContext == nullptr || State::Instance().SCchanged
-#ifdef USE_QUEUE_FOR_FG
-        || _commandList[fIndex] == nullptr || _commandQueue == nullptr
-#endif
-    )
+    if (!Config::Instance()->FGEnabled.value_or_default() || _fgContext == nullptr || State::Instance().SCchanged)
     {
         LOG_WARN("(FG) Cancel async dispatch fIndex: {}", fIndex);
         params->numGeneratedFrames = 0;
@@ -445,13 +461,6 @@ ffxReturnCode_t FSRFG_Dx12::DispatchCallback(ffxDispatchDescFrameGeneration* par
         State::Instance().FGchanged || State::Instance().currentFeature->FrameCount() == 0)
     {
         LOG_WARN("(FG) Callback without active FG! fIndex:{}", fIndex);
-
-#ifdef USE_QUEUE_FOR_FG
-        auto allocator = _commandAllocators[fIndex];
-        auto result = allocator->Reset();
-        result = _commandList[fIndex]->Reset(allocator, nullptr);
-#endif
-
         params->numGeneratedFrames = 0;
     }
 
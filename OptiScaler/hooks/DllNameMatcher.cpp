@@ -0,0 +1,137 @@
+#include "DllNameMatcher.h"
+
+#include <type_traits>
+
+DllNameMatcher::DllNameMatcher()
+{
+    for (auto& symbol : _symbols)
+        symbol.store(NoSymbol, std::memory_order_relaxed);
+}
+
+bool DllNameMatcher::Add(const std::string& InName, uint32_t InCategory)
+{
+    if (InName.empty())
+        return false;
+
+    for (auto c : InName)
+    {
+        if ((unsigned char) c > 127)
+            return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_addMutex);
+
+    // Symbols from the last character, a new symbol is harmless for Match until a node uses it
+    std::vector<uint8_t> symbols;
+    symbols.reserve(InName.size());
+
+    for (auto it = InName.rbegin(); it != InName.rend(); it++)
+    {
+        auto c = Fold((unsigned char) *it);
+        auto symbol = _symbols[c].load(std::memory_order_relaxed);
+
+        if (symbol == NoSymbol)
+        {
+            if (_symbolCount == MaxSymbols)
+                return false;
+
+            symbol = (uint8_t) _symbolCount++;
+            _symbols[c].store(symbol, std::memory_order_relaxed);
+        }
+
+        symbols.push_back(symbol);
+    }
+
+    // Part of the name which is already in the trie
+    uint32_t node = 0;
+    size_t i = 0;
+
+    for (; i < symbols.size(); i++)
+    {
+        auto next = _nodes[node].next[symbols[i]].load(std::memory_order_relaxed);
+
+        if (next == 0)
+            break;
+
+        node = next;
+    }
+
+    if (i == symbols.size())
+    {
+        _nodes[node].categories.fetch_or(InCategory, std::memory_order_relaxed);
+        return true;
+    }
+
+    auto first = _nodeCount.load(std::memory_order_relaxed);
+    auto count = first + (uint32_t) (symbols.size() - i);
+
+    if (count > MaxNodes)
+        return false;
+
+    // Rest of the name as a chain of new nodes, nothing links to them yet
+    uint32_t last = first;
+
+    for (size_t j = i + 1; j < symbols.size(); j++)
+    {
+        _nodes[last].next[symbols[j]].store((uint16_t) (last + 1), std::memory_order_relaxed);
+        last++;
+    }
+
+    _nodes[last].categories.store(InCategory, std::memory_order_relaxed);
+    _nodeCount.store(count, std::memory_order_relaxed);
+
+    // Publishes the chain, pairs with the acquire loads of Match
+    _nodes[node].next[symbols[i]].store((uint16_t) first, std::memory_order_release);
+
+    return true;
+}
+
+bool DllNameMatcher::Add(const std::vector<std::string>& InNames, uint32_t InCategory)
+{
+    bool result = true;
+
+    for (const auto& name : InNames)
+        result &= Add(name, InCategory);
+
+    return result;
+}
+
+template <typename T> uint32_t DllNameMatcher::MatchImpl(const T* InPath) const
+{
+    if (InPath == nullptr)
+        return None;
+
+    auto end = InPath;
+    while (*end != 0)
+        end++;
+
+    uint32_t node = 0;
+    uint32_t categories = None;
+
+    // Stops at the first character no name continues with, usually within the extension
+    while (end != InPath)
+    {
+        auto c = (uint32_t) (std::make_unsigned_t<T>) *--end;
+
+        if (c > 127)
+            break;
+
+        auto symbol = _symbols[Fold(c)].load(std::memory_order_relaxed);
+
+        if (symbol == NoSymbol)
+            break;
+
+        node = _nodes[node].next[symbol].load(std::memory_order_acquire);
+
+        if (node == 0)
+            break;
+
+        categories |= _nodes[node].categories.load(std::memory_order_relaxed);
+    }
+
+    return categories;
+}
+
+uint32_t DllNameMatcher::Match(const char* InPath) const { return MatchImpl(InPath); }
+
+uint32_t DllNameMatcher::Match(const wchar_t* InPath) const { return MatchImpl(InPath); }
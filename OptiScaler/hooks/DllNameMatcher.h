@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Finds which of the dll name lists (DllNames.h) a LoadLibrary path belongs to in one backwards pass over the
+// raw path. Names are stored reversed in a trie so every list entry which is a suffix of the path is found
+// while walking from the last character, same result as rfind against every list entry but without
+// lowercasing or copying the path. Characters are folded ASCII only, non ASCII characters never match.
+// Nothing in here depends on Windows headers so it can be built anywhere.
+class DllNameMatcher
+{
+  public:
+    // Bit flags, a path can be in more than one list (dxgi.dll is both dxgi and OptiScaler when working as dxgi)
+    enum Category : uint32_t
+    {
+        None = 0,
+        OptiScaler = 1u << 0, // dllNames, names OptiScaler is loaded as
+        Nvngx = 1u << 1,
+        NvngxDlss = 1u << 2,
+        NvApi = 1u << 3,
+        SlInterposer = 1u << 4,
+        SlDlss = 1u << 5,
+        SlDlssg = 1u << 6,
+        NgxOtaBin = 1u << 7,
+        BlockOverlay = 1u << 8,
+        Overlay = 1u << 9,
+        Dx11 = 1u << 10,
+        Dx12 = 1u << 11,
+        Vulkan = 1u << 12,
+        Dxgi = 1u << 13,
+        Fsr2 = 1u << 14,
+        Fsr2BE = 1u << 15,
+        Fsr3 = 1u << 16,
+        Fsr3BE = 1u << 17,
+        Xess = 1u << 18,
+        XessDx11 = 1u << 19,
+        FfxDx12 = 1u << 20,
+        FfxVk = 1u << 21,
+    };
+
+    // Returns false when the name has non ASCII characters or the trie is full.
+    // Hooks are installed before every name is known (AddDllName in DllMain), so a name can be added while
+    // other threads match. New nodes are written first and linked with a release store, Match sees either
+    // the old trie or the one with the whole name.
+    bool Add(const std::string& InName, uint32_t InCategory);
+    bool Add(const std::vector<std::string>& InNames, uint32_t InCategory);
+
+    // Categories of every name which is a suffix of the path, None for most paths
+    uint32_t Match(const char* InPath) const;
+    uint32_t Match(const wchar_t* InPath) const;
+
+    uint32_t NodeCount() const { return _nodeCount.load(std::memory_order_relaxed); }
+
+    DllNameMatcher();
+
+  private:
+    static constexpr uint32_t MaxNodes = 1024;
+    static constexpr uint32_t MaxSymbols = 48;
+    static constexpr uint8_t NoSymbol = 0xFF;
+
+    struct Node
+    {
+        std::array<std::atomic<uint16_t>, MaxSymbols> next {}; // 0 is root, which is never a child
+        std::atomic<uint32_t> categories = 0;
+    };
+
+    std::array<Node, MaxNodes> _nodes {};
+    std::array<std::atomic<uint8_t>, 128> _symbols {};
+    std::atomic<uint32_t> _nodeCount = 1;
+    uint32_t _symbolCount = 0;
+
+    // Only serializes Add calls, Match doesn't lock
+    std::mutex _addMutex;
+
+    static uint32_t Fold(uint32_t InChar) { return (InChar >= 'A' && InChar <= 'Z') ? InChar + ('a' - 'A') : InChar; }
+
+    template <typename T> uint32_t MatchImpl(const T* InPath) const;
+};
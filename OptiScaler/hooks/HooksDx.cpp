@@ -9,6 +9,7 @@
 #include <menu/menu_overlay_dx.h>
 #include <framegen/ffx/FSRFG_Dx12.h>
 #include <resource_tracking/ResTrack_Dx12.h>
+#include <upscalers/SharedTextureCache.h>
 
 #include <proxies/Dxgi_Proxy.h>
 #include <proxies/D3D12_Proxy.h>
@@ -101,6 +102,9 @@ typedef D3D12_RESOURCE_ALLOCATION_INFO (*PFN_GetResourceAllocationInfo)(ID3D12De
 typedef HRESULT (*PFN_CreateSamplerState)(ID3D11Device* This, const D3D11_SAMPLER_DESC* pSamplerDesc,
                                           ID3D11SamplerState** ppSamplerState);
 
+typedef HRESULT (*PFN_CreateTexture2D)(ID3D11Device* This, const D3D11_TEXTURE2D_DESC* pDesc,
+                                       const D3D11_SUBRESOURCE_DATA* pInitialData, ID3D11Texture2D** ppTexture2D);
+
 typedef ULONG (*PFN_Release)(IUnknown* This);
 
 static PFN_CreateSampler o_CreateSampler = nullptr;
@@ -116,6 +120,7 @@ static PFN_Release o_D3D12DeviceRelease = nullptr;
 static PFN_D3D11_CREATE_DEVICE o_D3D11CreateDevice = nullptr;
 static PFN_D3D11_CREATE_DEVICE_AND_SWAP_CHAIN o_D3D11CreateDeviceAndSwapChain = nullptr;
 static PFN_CreateSamplerState o_CreateSamplerState = nullptr;
+static PFN_CreateTexture2D o_CreateTexture2D = nullptr;
 static PFN_D3D11ON12_CREATE_DEVICE o_D3D11On12CreateDevice = nullptr;
 
 static ID3D12Device* _intelD3D12Device = nullptr;
@@ -158,6 +163,8 @@ static D3D12_RESOURCE_ALLOCATION_INFO hkGetResourceAllocationInfo(ID3D12Device*
 
 static HRESULT hkCreateSamplerState(ID3D11Device* This, const D3D11_SAMPLER_DESC* pSamplerDesc,
                                     ID3D11SamplerState** ppSamplerState);
+static HRESULT hkCreateTexture2D(ID3D11Device* This, const D3D11_TEXTURE2D_DESC* pDesc,
+                                 const D3D11_SUBRESOURCE_DATA* pInitialData, ID3D11Texture2D** ppTexture2D);
 static HRESULT hkEnumAdapters(IDXGIFactory* This, UINT Adapter, IUnknown** ppAdapter);
 static HRESULT hkEnumAdapters1(IDXGIFactory1* This, UINT Adapter, IUnknown** ppAdapter);
 static HRESULT hkEnumAdapterByLuid(IDXGIFactory4* This, LUID AdapterLuid, REFIID riid, IUnknown** ppvAdapter);
@@ -214,6 +221,14 @@ static HRESULT hkFGPresent(void* This, UINT SyncInterval, UINT Flags)
         _lastFrameTime = now;
         State::Instance().lastFrameTime = ftDelta;
 
+        if (Config::Instance()->FGAdaptivePacing.value_or_default())
+        {
+            State::Instance().fgPacing.Sample(ftDelta);
+
+            if (State::Instance().fgPacing.TakeTuningChange())
+                State::Instance().FSRFGFTPchanged = true;
+        }
+
         LOG_DEBUG("_frameCounter: {}, flags: {:X}, Frametime: {}", _frameCounter, Flags, ftDelta);
     }
 
@@ -291,6 +306,10 @@ static HRESULT hkFGPresent(void* This, UINT SyncInterval, UINT Flags)
 
     if (!(Flags & DXGI_PRESENT_TEST || Flags & DXGI_PRESENT_RESTART))
     {
+        // FG work on own queue must be done before present
+        if (fg != nullptr)
+            fg->WaitForFGQueue();
+
         ResTrack_Dx12::ClearPossibleHudless();
         Hudfix_Dx12::PresentStart();
     }
@@ -1604,6 +1623,7 @@ static void HookToDevice(ID3D11Device* InDevice)
     PVOID* pVTable = *(PVOID**) InDevice;
 
     o_CreateSamplerState = (PFN_CreateSamplerState) pVTable[23];
+    o_CreateTexture2D = (PFN_CreateTexture2D) pVTable[5];
 
     // Apply the detour
     if (o_CreateSamplerState != nullptr)
@@ -1613,6 +1633,9 @@ static void HookToDevice(ID3D11Device* InDevice)
 
         DetourAttach(&(PVOID&) o_CreateSamplerState, hkCreateSamplerState);
 
+        if (o_CreateTexture2D != nullptr)
+            DetourAttach(&(PVOID&) o_CreateTexture2D, hkCreateTexture2D);
+
         DetourTransactionCommit();
     }
 }
@@ -2341,6 +2364,55 @@ static HRESULT hkCreateSamplerState(ID3D11Device* This, const D3D11_SAMPLER_DESC
     return o_CreateSamplerState(This, &newDesc, ppSamplerState);
 }
 
+static HRESULT hkCreateTexture2D(ID3D11Device* This, const D3D11_TEXTURE2D_DESC* pDesc,
+                                 const D3D11_SUBRESOURCE_DATA* pInitialData, ID3D11Texture2D** ppTexture2D)
+{
+    if (pDesc == nullptr || ppTexture2D == nullptr || !Config::Instance()->Dx11PromoteSharedTextures.value_or_default())
+        return o_CreateTexture2D(This, pDesc, pInitialData, ppTexture2D);
+
+    // Only single mip render targets / UAVs can be upscaler inputs or output,
+    // depth is still transferred with a copy
+    if (pDesc->MiscFlags != 0 || pDesc->Usage != D3D11_USAGE_DEFAULT || pDesc->CPUAccessFlags != 0 ||
+        pDesc->MipLevels != 1 || pDesc->ArraySize != 1 || pDesc->SampleDesc.Count != 1 ||
+        (pDesc->BindFlags & D3D11_BIND_DEPTH_STENCIL) != 0 ||
+        (pDesc->BindFlags & (D3D11_BIND_RENDER_TARGET | D3D11_BIND_UNORDERED_ACCESS)) == 0)
+    {
+        return o_CreateTexture2D(This, pDesc, pInitialData, ppTexture2D);
+    }
+
+    // Only textures like the ones which were copied as upscaler inputs or output, rest of game's resources
+    // keep their flags. Textures created before the first evaluate are still copied.
+    SharedTextureCache::TextureDesc key {};
+    key.Width = pDesc->Width;
+    key.Height = pDesc->Height;
+    key.Format = (uint32_t) pDesc->Format;
+    key.BindFlags = pDesc->BindFlags;
+
+    if (!SharedTexturePromotion::Instance().Matches(key))
+        return o_CreateTexture2D(This, pDesc, pInitialData, ppTexture2D);
+
+    // Shareable textures are opened once on the Dx12 side of Dx11 with Dx12 upscalers instead of copied every frame,
+    // legacy shared handles are used when NT handles are disabled
+    D3D11_TEXTURE2D_DESC newDesc = *pDesc;
+    newDesc.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+
+    if (!Config::Instance()->DontUseNTShared.value_or_default())
+        newDesc.MiscFlags |= D3D11_RESOURCE_MISC_SHARED_NTHANDLE;
+
+    auto result = o_CreateTexture2D(This, &newDesc, pInitialData, ppTexture2D);
+
+    if (result == S_OK)
+    {
+        LOG_TRACE("Promoted to shared: {0}x{1}, format: {2}", pDesc->Width, pDesc->Height, (UINT) pDesc->Format);
+        return result;
+    }
+
+    LOG_DEBUG("Can't promote {0}x{1}, format: {2} to shared: {3:X}", pDesc->Width, pDesc->Height,
+              (UINT) pDesc->Format, (UINT) result);
+
+    return o_CreateTexture2D(This, pDesc, pInitialData, ppTexture2D);
+}
+
 #pragma endregion
 
 #pragma region Public hook methods
@@ -2477,6 +2549,12 @@ void HooksDx::UnHookDx()
         o_CreateSampler = nullptr;
     }
 
+    if (o_CreateTexture2D != nullptr)
+    {
+        DetourDetach(&(PVOID&) o_CreateTexture2D, hkCreateTexture2D);
+        o_CreateTexture2D = nullptr;
+    }
+
     DetourTransactionCommit();
     _isInited = false;
 }
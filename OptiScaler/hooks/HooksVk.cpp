@@ -28,6 +28,10 @@ static VkInstance _instance = VK_NULL_HANDLE;
 static VkPhysicalDevice _PD = VK_NULL_HANDLE;
 static HWND _hwnd = nullptr;
 
+// for timestamp queries
+static uint32_t _apiVersion = VK_API_VERSION_1_0;
+static VkDevice _hostQueryResetDevice = VK_NULL_HANDLE;
+
 static std::mutex _vkPresentMutex;
 
 // hooking
@@ -116,6 +120,9 @@ static VkResult hkvkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, cons
 
         _instance = *pInstance;
         LOG_DEBUG("_instance captured: {0:X}", (UINT64) _instance);
+
+        if (pCreateInfo->pApplicationInfo != nullptr)
+            _apiVersion = pCreateInfo->pApplicationInfo->apiVersion;
     }
 
     LOG_FUNC_RESULT(result);
@@ -123,15 +130,68 @@ static VkResult hkvkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, cons
     return result;
 }
 
+// Adds hostQueryReset to device features when game didn't set it, returns true if it will be enabled
+static bool PrepareHostQueryReset(VkPhysicalDevice InPD, VkDeviceCreateInfo& InOutCreateInfo,
+                                  VkPhysicalDeviceHostQueryResetFeatures& InFeature)
+{
+    for (auto next = (const VkBaseInStructure*) InOutCreateInfo.pNext; next != nullptr; next = next->pNext)
+    {
+        if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES)
+            return ((const VkPhysicalDeviceVulkan12Features*) next)->hostQueryReset == VK_TRUE;
+
+        if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES)
+            return ((const VkPhysicalDeviceHostQueryResetFeatures*) next)->hostQueryReset == VK_TRUE;
+    }
+
+    // Core since 1.2, older apps would need the extension to be enabled
+    VkPhysicalDeviceProperties prop {};
+    vkGetPhysicalDeviceProperties(InPD, &prop);
+
+    if (_apiVersion < VK_API_VERSION_1_2 || prop.apiVersion < VK_API_VERSION_1_2)
+        return false;
+
+    VkPhysicalDeviceHostQueryResetFeatures supported {};
+    supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features {};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &supported;
+    vkGetPhysicalDeviceFeatures2(InPD, &features);
+
+    if (supported.hostQueryReset != VK_TRUE)
+        return false;
+
+    InFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES;
+    InFeature.pNext = (void*) InOutCreateInfo.pNext;
+    InFeature.hostQueryReset = VK_TRUE;
+    InOutCreateInfo.pNext = &InFeature;
+
+    return true;
+}
+
+bool HooksVk::HostQueryResetEnabled(VkDevice InDevice)
+{
+    return InDevice != VK_NULL_HANDLE && InDevice == _hostQueryResetDevice;
+}
+
 static VkResult hkvkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
                                  const VkAllocationCallbacks* pAllocator, VkDevice* pDevice)
 {
     LOG_FUNC();
 
-    auto result = o_vkCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+    // Timestamp queries are reset from host after they are read
+    VkDeviceCreateInfo createInfo = *pCreateInfo;
+    VkPhysicalDeviceHostQueryResetFeatures hostQueryReset {};
+    auto hostResetEnabled = !State::Instance().vulkanSkipHooks &&
+                            PrepareHostQueryReset(physicalDevice, createInfo, hostQueryReset);
+
+    auto result = o_vkCreateDevice(physicalDevice, &createInfo, pAllocator, pDevice);
 
     if (result == VK_SUCCESS && !State::Instance().vulkanSkipHooks)
     {
+        _hostQueryResetDevice = hostResetEnabled ? *pDevice : VK_NULL_HANDLE;
+        LOG_DEBUG("hostQueryReset: {}", hostResetEnabled);
+
         MenuOverlayVk::DestroyVulkanObjects(false);
 
         _PD = physicalDevice;
@@ -153,31 +213,85 @@ static VkResult hkvkCreateDevice(VkPhysicalDevice physicalDevice, const VkDevice
     return result;
 }
 
-static VkResult hkvkQueuePresentKHR(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
+// Reads available timestamp results without waiting, frames which are not finished are read at next present
+static void ReadTimestamps()
 {
-    LOG_FUNC();
+    static uint64_t lastUpscalerFrame = 0;
 
-    // get upscaler time
-    if (HooksVk::vkUpscaleTrig && HooksVk::queryPool != VK_NULL_HANDLE)
+    if (HooksVk::queryPool == VK_NULL_HANDLE || HooksVk::queryDevice == VK_NULL_HANDLE)
+        return;
+
+    TimestampRing::Pending pending;
+    while (HooksVk::queryRing.OldestPending(pending))
     {
-        // Retrieve timestamps
-        uint64_t timestamps[2];
-        vkGetQueryPoolResults(_device, HooksVk::queryPool, 0, 2, sizeof(timestamps), timestamps, sizeof(uint64_t),
-                              VK_QUERY_RESULT_64_BIT);
+        for (uint32_t pass = 0; pass < HooksVk::queryRing.Passes(); pass++)
+        {
+            if ((pending.PassMask & (1u << pass)) == 0)
+                continue;
+
+            // Value and availability for begin & end queries
+            uint64_t results[4] {};
+            auto query = HooksVk::queryRing.Query(pending.Slot, pass);
+            auto result = vkGetQueryPoolResults(HooksVk::queryDevice, HooksVk::queryPool, query, 2, sizeof(results),
+                                                results, sizeof(uint64_t) * 2,
+                                                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+            // GPU didn't reach this frame yet
+            if ((result != VK_SUCCESS && result != VK_NOT_READY) || results[1] == 0 || results[3] == 0)
+                return;
+
+            // Values of previous use, reset in command buffer didn't run yet
+            if (!HooksVk::queryRing.Resolve(pending.Slot, pass, results[0], results[2]))
+                return;
+        }
+    }
+
+    auto upscalerFrame = HooksVk::queryRing.LastFrame(HooksVk::UpscalerPass);
+    auto upscalerTicks = HooksVk::queryRing.LastTicks(HooksVk::UpscalerPass);
+
+    if (upscalerTicks == 0 || upscalerFrame == lastUpscalerFrame)
+        return;
+
+    lastUpscalerFrame = upscalerFrame;
+
+    // Calculate elapsed time in milliseconds
+    double elapsedTimeMs = upscalerTicks * HooksVk::timeStampPeriod / 1e6;
+
+    if (elapsedTimeMs > 0.0 && elapsedTimeMs < 5000.0)
+    {
+        State::Instance().frameTimeMutex.lock();
+        State::Instance().upscaleTimes.push_back(elapsedTimeMs);
+        State::Instance().upscaleTimes.pop_front();
+        State::Instance().frameTimeMutex.unlock();
+    }
+}
 
-        // Calculate elapsed time in milliseconds
-        double elapsedTimeMs = (timestamps[1] - timestamps[0]) * HooksVk::timeStampPeriod / 1e6;
+// Read and dropped slots are reset from host before they are used again
+static void ResetTimestamps()
+{
+    auto mask = HooksVk::queryRing.TakeResetMask();
+
+    if (HooksVk::resetQueryPool == nullptr || HooksVk::queryPool == VK_NULL_HANDLE)
+        return;
 
-        if (elapsedTimeMs > 0.0 && elapsedTimeMs < 5000.0)
+    for (uint32_t slot = 0; mask != 0; slot++, mask >>= 1)
+    {
+        if ((mask & 1) != 0)
         {
-            State::Instance().frameTimeMutex.lock();
-            State::Instance().upscaleTimes.push_back(elapsedTimeMs);
-            State::Instance().upscaleTimes.pop_front();
-            State::Instance().frameTimeMutex.unlock();
+            HooksVk::resetQueryPool(HooksVk::queryDevice, HooksVk::queryPool, HooksVk::queryRing.Query(slot, 0),
+                                    HooksVk::queryRing.Passes() * 2);
         }
-
-        HooksVk::vkUpscaleTrig = false;
     }
+}
+
+static VkResult hkvkQueuePresentKHR(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
+{
+    LOG_FUNC();
+
+    // get upscaler time
+    ReadTimestamps();
+    HooksVk::queryRing.EndFrame();
+    ResetTimestamps();
 
     State::Instance().swapchainApi = Vulkan;
 
@@ -1,13 +1,28 @@
 #pragma once
 
 #include <pch.h>
+#include "TimestampRing.h"
+
 #include <vulkan/vulkan.hpp>
 
 namespace HooksVk
 {
+// Timed passes of queryRing, only upscaler dispatch is timed on Vulkan
+enum TimestampPass : uint32_t
+{
+    UpscalerPass = 0,
+    PassCount,
+};
+
+inline VkDevice queryDevice = VK_NULL_HANDLE;
 inline VkQueryPool queryPool = VK_NULL_HANDLE;
+inline TimestampRing queryRing { 3, PassCount };
 inline double timeStampPeriod = 1.0;
-inline bool vkUpscaleTrig = false;
+
+// Set when hostQueryReset is enabled on queryDevice, queries are reset after they are read
+inline PFN_vkResetQueryPool resetQueryPool = nullptr;
+
+bool HostQueryResetEnabled(VkDevice InDevice);
 
 void HookVk(HMODULE vulkan1);
 void UnHookVk();
@@ -26,6 +26,8 @@
 #include <hooks/HooksVk.h>
 #include <hooks/Gdi32_Hooks.h>
 #include <hooks/Streamline_Hooks.h>
+#include <hooks/WidePathMatcher.h>
+#include <hooks/ProcOverrideTable.h>
 
 #include <cwctype>
 
@@ -65,22 +67,37 @@ class KernelHooks
 
     inline static bool _overlayMethodsCalled = false;
 
-    inline static HMODULE LoadLibraryCheck(std::string lcaseLibName, LPCSTR lpLibFullPath)
+    // Exports replaced by GetProcAddress hooks
+    inline static ProcOverrideTable procOverrides { [](const wchar_t* moduleName) -> void*
+                                                    { return KernelBaseProxy::GetModuleHandleW_()(moduleName); } };
+
+    // Lowercase exe folder, computed once
+    inline static const std::wstring& LowerExePath()
+    {
+        static const std::wstring exePath = []
+        {
+            auto path = Util::ExePath().parent_path().wstring();
+
+            for (size_t i = 0; i < path.size(); i++)
+                path[i] = std::tolower(path[i]);
+
+            return path;
+        }();
+
+        return exePath;
+    }
+
+    inline static HMODULE LoadLibraryCheck(std::string lcaseLibName, LPCSTR lpLibFullPath, uint32_t categories)
     {
         LOG_TRACE("{}", lcaseLibName);
 
         // If Opti is not loading as nvngx.dll
         if (!State::Instance().enablerAvailable && !State::Instance().isWorkingAsNvngx)
         {
-            // exe path
-            auto exePath = Util::ExePath().parent_path().wstring();
-
-            for (size_t i = 0; i < exePath.size(); i++)
-                exePath[i] = std::tolower(exePath[i]);
-
-            auto pos = lcaseLibName.rfind(wstring_to_string(exePath));
+            static const std::string exePath = wstring_to_string(LowerExePath());
+            auto pos = lcaseLibName.rfind(exePath);
 
-            if (Config::Instance()->EnableDlssInputs.value_or_default() && CheckDllName(&lcaseLibName, &nvngxNames) &&
+            if (Config::Instance()->EnableDlssInputs.value_or_default() && (categories & DllNameMatcher::Nvngx) &&
                 (!Config::Instance()->HookOriginalNvngxOnly.value_or_default() || pos == std::string::npos))
             {
                 LOG_INFO("nvngx call: {0}, returning this dll!", lcaseLibName);
@@ -92,7 +109,7 @@ class KernelHooks
 
         if (!State::Instance().isWorkingAsNvngx &&
             (!State::Instance().isDxgiMode || !State::Instance().skipDxgiLoadChecks) &&
-            CheckDllName(&lcaseLibName, &dllNames))
+            (categories & DllNameMatcher::OptiScaler))
         {
             if (!State::Instance().ServeOriginal())
             {
@@ -107,7 +124,7 @@ class KernelHooks
         }
 
         // NvApi64.dll
-        if (CheckDllName(&lcaseLibName, &nvapiNames))
+        if ((categories & DllNameMatcher::NvApi))
         {
             if (!State::Instance().enablerAvailable && Config::Instance()->OverrideNvapiDll.value_or_default())
             {
@@ -142,7 +159,7 @@ class KernelHooks
 
         // sl.interposer.dll
         if (Config::Instance()->FGType.value_or_default() == FGType::Nukems &&
-            CheckDllName(&lcaseLibName, &slInterposerNames))
+            (categories & DllNameMatcher::SlInterposer))
         {
             auto streamlineModule = KernelBaseProxy::LoadLibraryExA_()(lpLibFullPath, NULL, 0);
 
@@ -159,7 +176,7 @@ class KernelHooks
         }
 
         // sl.dlss.dll
-        if (CheckDllName(&lcaseLibName, &slDlssNames))
+        if ((categories & DllNameMatcher::SlDlss))
         {
             auto dlssModule = KernelBaseProxy::LoadLibraryExA_()(lpLibFullPath, NULL, 0);
 
@@ -176,7 +193,7 @@ class KernelHooks
         }
 
         // sl.dlss_g.dll
-        if (CheckDllName(&lcaseLibName, &slDlssgNames))
+        if ((categories & DllNameMatcher::SlDlssg))
         {
             auto dlssgModule = KernelBaseProxy::LoadLibraryExA_()(lpLibFullPath, NULL, 0);
 
@@ -194,7 +211,7 @@ class KernelHooks
 
         // nvngx_dlss
         if (Config::Instance()->DLSSEnabled.value_or_default() && Config::Instance()->NVNGX_DLSS_Library.has_value() &&
-            CheckDllName(&lcaseLibName, &nvngxDlssNames))
+            (categories & DllNameMatcher::NvngxDlss))
         {
             auto nvngxDlss = LoadNvngxDlss(string_to_wstring(lcaseLibName));
 
@@ -207,7 +224,7 @@ class KernelHooks
         // NGX OTA
         // Try to catch something like this:
         // c:\programdata/nvidia/ngx/models//dlss/versions/20316673/files/160_e658700.bin
-        if (lcaseLibName.ends_with(".bin"))
+        if (categories & DllNameMatcher::NgxOtaBin)
         {
             auto loadedBin = KernelBaseProxy::LoadLibraryExA_()(lpLibFullPath, NULL, 0);
 
@@ -227,12 +244,12 @@ class KernelHooks
         }
 
         // Overlay
-        if (Config::Instance()->DisableOverlays.value_or_default() && CheckDllName(&lcaseLibName, &blockOverlayNames))
+        if (Config::Instance()->DisableOverlays.value_or_default() && (categories & DllNameMatcher::BlockOverlay))
         {
             LOG_DEBUG("Blocking overlay dll: {}", lcaseLibName);
             return (HMODULE) 1;
         }
-        else if (CheckDllName(&lcaseLibName, &overlayNames))
+        else if ((categories & DllNameMatcher::Overlay))
         {
             LOG_DEBUG("Overlay dll: {}", lcaseLibName);
 
@@ -274,7 +291,7 @@ class KernelHooks
         }
 
         // Hooks
-        if (CheckDllName(&lcaseLibName, &dx11Names) && Config::Instance()->OverlayMenu.value_or_default())
+        if ((categories & DllNameMatcher::Dx11) && Config::Instance()->OverlayMenu.value_or_default())
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -286,7 +303,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &dx12Names) && Config::Instance()->OverlayMenu.value_or_default())
+        if ((categories & DllNameMatcher::Dx12) && Config::Instance()->OverlayMenu.value_or_default())
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -303,7 +320,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &vkNames))
+        if ((categories & DllNameMatcher::Vulkan))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -327,7 +344,7 @@ class KernelHooks
             return module;
         }
 
-        if (!State::Instance().skipDxgiLoadChecks && CheckDllName(&lcaseLibName, &dxgiNames))
+        if (!State::Instance().skipDxgiLoadChecks && (categories & DllNameMatcher::Dxgi))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
 
@@ -349,7 +366,7 @@ class KernelHooks
             return module;
         }
 
-        if (Config::Instance()->EnableFsr2Inputs.value_or_default() && CheckDllName(&lcaseLibName, &fsr2Names))
+        if (Config::Instance()->EnableFsr2Inputs.value_or_default() && (categories & DllNameMatcher::Fsr2))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -361,7 +378,7 @@ class KernelHooks
             return module;
         }
 
-        if (Config::Instance()->EnableFsr2Inputs.value_or_default() && CheckDllName(&lcaseLibName, &fsr2BENames))
+        if (Config::Instance()->EnableFsr2Inputs.value_or_default() && (categories & DllNameMatcher::Fsr2BE))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -373,7 +390,7 @@ class KernelHooks
             return module;
         }
 
-        if (Config::Instance()->EnableFsr3Inputs.value_or_default() && CheckDllName(&lcaseLibName, &fsr3Names))
+        if (Config::Instance()->EnableFsr3Inputs.value_or_default() && (categories & DllNameMatcher::Fsr3))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -383,7 +400,7 @@ class KernelHooks
             return module;
         }
 
-        if (Config::Instance()->EnableFsr3Inputs.value_or_default() && CheckDllName(&lcaseLibName, &fsr3BENames))
+        if (Config::Instance()->EnableFsr3Inputs.value_or_default() && (categories & DllNameMatcher::Fsr3BE))
         {
             auto module = KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -395,7 +412,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &xessNames))
+        if ((categories & DllNameMatcher::Xess))
         {
             auto module = LoadLibxess(string_to_wstring(lcaseLibName));
 
@@ -407,7 +424,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &xessDx11Names))
+        if ((categories & DllNameMatcher::XessDx11))
         {
             auto module = LoadLibxessDx11(
                 string_to_wstring(lcaseLibName)); // KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
@@ -420,7 +437,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &ffxDx12Names))
+        if ((categories & DllNameMatcher::FfxDx12))
         {
             auto module = LoadFfxapiDx12(
                 string_to_wstring(lcaseLibName)); // KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
@@ -433,7 +450,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllName(&lcaseLibName, &ffxVkNames))
+        if ((categories & DllNameMatcher::FfxVk))
         {
             auto module = LoadFfxapiVk(
                 string_to_wstring(lcaseLibName)); // KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
@@ -449,7 +466,7 @@ class KernelHooks
         return nullptr;
     }
 
-    inline static HMODULE LoadLibraryCheckW(std::wstring lcaseLibName, LPCWSTR lpLibFullPath)
+    inline static HMODULE LoadLibraryCheckW(std::wstring lcaseLibName, LPCWSTR lpLibFullPath, uint32_t categories)
     {
         auto lcaseLibNameA = wstring_to_string(lcaseLibName);
         LOG_TRACE("{}", lcaseLibNameA);
@@ -457,15 +474,9 @@ class KernelHooks
         // If Opti is not loading as nvngx.dll
         if (!State::Instance().enablerAvailable && !State::Instance().isWorkingAsNvngx)
         {
-            // exe path
-            auto exePath = Util::ExePath().parent_path().wstring();
-
-            for (size_t i = 0; i < exePath.size(); i++)
-                exePath[i] = std::tolower(exePath[i]);
-
-            auto pos = lcaseLibName.rfind(exePath);
+            auto pos = lcaseLibName.rfind(LowerExePath());
 
-            if (Config::Instance()->EnableDlssInputs.value_or_default() && CheckDllNameW(&lcaseLibName, &nvngxNamesW) &&
+            if (Config::Instance()->EnableDlssInputs.value_or_default() && (categories & DllNameMatcher::Nvngx) &&
                 (!Config::Instance()->HookOriginalNvngxOnly.value_or_default() || pos == std::string::npos))
             {
                 LOG_INFO("nvngx call: {0}, returning this dll!", lcaseLibNameA);
@@ -479,7 +490,7 @@ class KernelHooks
 
         if (!State::Instance().isWorkingAsNvngx &&
             (!State::Instance().isDxgiMode || !State::Instance().skipDxgiLoadChecks) &&
-            CheckDllNameW(&lcaseLibName, &dllNamesW))
+            (categories & DllNameMatcher::OptiScaler))
         {
             if (!State::Instance().ServeOriginal())
             {
@@ -495,7 +506,7 @@ class KernelHooks
 
         // nvngx_dlss
         if (Config::Instance()->DLSSEnabled.value_or_default() && Config::Instance()->NVNGX_DLSS_Library.has_value() &&
-            CheckDllNameW(&lcaseLibName, &nvngxDlssNamesW))
+            (categories & DllNameMatcher::NvngxDlss))
         {
             auto nvngxDlss = LoadNvngxDlss(lcaseLibName);
 
@@ -508,7 +519,7 @@ class KernelHooks
         // NGX OTA
         // Try to catch something like this:
         // c:\programdata/nvidia/ngx/models//dlss/versions/20316673/files/160_e658700.bin
-        if (lcaseLibName.ends_with(L".bin"))
+        if (categories & DllNameMatcher::NgxOtaBin)
         {
             auto loadedBin = KernelBaseProxy::LoadLibraryExW_()(lpLibFullPath, NULL, 0);
 
@@ -528,7 +539,7 @@ class KernelHooks
         }
 
         // NvApi64.dll
-        if (CheckDllNameW(&lcaseLibName, &nvapiNamesW))
+        if ((categories & DllNameMatcher::NvApi))
         {
             if (!State::Instance().enablerAvailable && Config::Instance()->OverrideNvapiDll.value_or_default())
             {
@@ -563,7 +574,7 @@ class KernelHooks
 
         // sl.interposer.dll
         if (Config::Instance()->FGType.value_or_default() == FGType::Nukems &&
-            CheckDllNameW(&lcaseLibName, &slInterposerNamesW))
+            (categories & DllNameMatcher::SlInterposer))
         {
             auto streamlineModule = KernelBaseProxy::LoadLibraryExW_()(lpLibFullPath, NULL, 0);
 
@@ -580,7 +591,7 @@ class KernelHooks
         }
 
         // sl.dlss.dll
-        if (CheckDllNameW(&lcaseLibName, &slDlssNamesW))
+        if ((categories & DllNameMatcher::SlDlss))
         {
             auto dlssModule = KernelBaseProxy::LoadLibraryExW_()(lpLibFullPath, NULL, 0);
 
@@ -597,7 +608,7 @@ class KernelHooks
         }
 
         // sl.dlss_g.dll
-        if (CheckDllNameW(&lcaseLibName, &slDlssgNamesW))
+        if ((categories & DllNameMatcher::SlDlssg))
         {
             auto dlssgModule = KernelBaseProxy::LoadLibraryExW_()(lpLibFullPath, NULL, 0);
 
@@ -613,12 +624,12 @@ class KernelHooks
             return dlssgModule;
         }
 
-        if (Config::Instance()->DisableOverlays.value_or_default() && CheckDllNameW(&lcaseLibName, &blockOverlayNamesW))
+        if (Config::Instance()->DisableOverlays.value_or_default() && (categories & DllNameMatcher::BlockOverlay))
         {
             LOG_DEBUG("Blocking overlay dll: {}", wstring_to_string(lcaseLibName));
             return (HMODULE) 1;
         }
-        else if (CheckDllNameW(&lcaseLibName, &overlayNamesW))
+        else if ((categories & DllNameMatcher::Overlay))
         {
             LOG_DEBUG("Overlay dll: {}", wstring_to_string(lcaseLibName));
 
@@ -669,7 +680,7 @@ class KernelHooks
         }
 
         // Hooks
-        if (CheckDllNameW(&lcaseLibName, &dx11NamesW) && Config::Instance()->OverlayMenu.value_or_default())
+        if ((categories & DllNameMatcher::Dx11) && Config::Instance()->OverlayMenu.value_or_default())
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -679,7 +690,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &dx12NamesW) && Config::Instance()->OverlayMenu.value_or_default())
+        if ((categories & DllNameMatcher::Dx12) && Config::Instance()->OverlayMenu.value_or_default())
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -692,7 +703,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &vkNamesW))
+        if ((categories & DllNameMatcher::Vulkan))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -712,7 +723,7 @@ class KernelHooks
             return module;
         }
 
-        if (!State::Instance().skipDxgiLoadChecks && CheckDllNameW(&lcaseLibName, &dxgiNamesW))
+        if (!State::Instance().skipDxgiLoadChecks && (categories & DllNameMatcher::Dxgi))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
 
@@ -728,7 +739,7 @@ class KernelHooks
             }
         }
 
-        if (CheckDllNameW(&lcaseLibName, &fsr2NamesW))
+        if ((categories & DllNameMatcher::Fsr2))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -738,7 +749,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &fsr2BENamesW))
+        if ((categories & DllNameMatcher::Fsr2BE))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -748,7 +759,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &fsr3NamesW))
+        if ((categories & DllNameMatcher::Fsr3))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -758,7 +769,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &fsr3BENamesW))
+        if ((categories & DllNameMatcher::Fsr3BE))
         {
             auto module = KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
 
@@ -768,7 +779,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &xessNamesW))
+        if ((categories & DllNameMatcher::Xess))
         {
             auto module =
                 LoadLibxess(lcaseLibName); // KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
@@ -779,7 +790,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &xessDx11NamesW))
+        if ((categories & DllNameMatcher::XessDx11))
         {
             auto module =
                 LoadLibxessDx11(lcaseLibName); // KernelBaseProxy::LoadLibraryExA_()(lcaseLibName.c_str(), NULL, 0);
@@ -792,7 +803,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &ffxDx12NamesW))
+        if ((categories & DllNameMatcher::FfxDx12))
         {
             auto module =
                 LoadFfxapiDx12(lcaseLibName); // KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
@@ -803,7 +814,7 @@ class KernelHooks
             return module;
         }
 
-        if (CheckDllNameW(&lcaseLibName, &ffxVkNamesW))
+        if ((categories & DllNameMatcher::FfxVk))
         {
             auto module =
                 LoadFfxapiVk(lcaseLibName); // KernelBaseProxy::LoadLibraryExW_()(lcaseLibName.c_str(), NULL, 0);
@@ -1123,6 +1134,9 @@ class KernelHooks
             }
         }
 
+        // Handle is resolved again if the module stays loaded
+        procOverrides.Invalidate(lpLibrary);
+
         return o_K32_FreeLibrary(lpLibrary);
     }
 
@@ -1185,6 +1199,9 @@ class KernelHooks
             }
         }
 
+        // Handle is resolved again if the module stays loaded
+        procOverrides.Invalidate(lpLibrary);
+
         return o_KB_FreeLibrary(lpLibrary);
     }
 
@@ -1193,6 +1210,12 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        // Most loads are none of ours, no need to lowercase them
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_KB_LoadLibraryA(lpLibFileName);
+
         std::string libName(lpLibFileName);
         std::string lcaseLibName(libName);
 
@@ -1222,7 +1245,7 @@ class KernelHooks
 #if _DEBUG
         LOG_TRACE("{}, caller: {}", lcaseLibName, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
-        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1242,6 +1265,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_KB_LoadLibraryW(lpLibFileName);
+
         std::wstring libName(lpLibFileName);
         std::wstring lcaseLibName(libName);
 
@@ -1272,7 +1300,7 @@ class KernelHooks
         LOG_TRACE("{}, caller: {}", wstring_to_string(lcaseLibName), Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
-        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1292,6 +1320,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_KB_LoadLibraryExA(lpLibFileName, hFile, dwFlags);
+
         std::string libName(lpLibFileName);
         std::string lcaseLibName(libName);
 
@@ -1322,7 +1355,7 @@ class KernelHooks
             }
         }
 
-        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1343,6 +1376,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_KB_LoadLibraryExW(lpLibFileName, hFile, dwFlags);
+
         std::wstring libName(lpLibFileName);
         std::wstring lcaseLibName(libName);
 
@@ -1373,7 +1411,7 @@ class KernelHooks
             }
         }
 
-        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1394,6 +1432,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_K32_LoadLibraryExA(lpLibFileName, hFile, dwFlags);
+
         std::string libName(lpLibFileName);
         std::string lcaseLibName(libName);
 
@@ -1424,7 +1467,7 @@ class KernelHooks
         LOG_TRACE("{}, caller: {}", lcaseLibName, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
-        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1445,6 +1488,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_K32_LoadLibraryExW(lpLibFileName, hFile, dwFlags);
+
         std::wstring libName(lpLibFileName);
         std::wstring lcaseLibName(libName);
 
@@ -1475,7 +1523,7 @@ class KernelHooks
         LOG_TRACE("{}, caller: {}", wstring_to_string(lcaseLibName), Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
-        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1496,6 +1544,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_K32_LoadLibraryA(lpLibFileName);
+
         std::string libName(lpLibFileName);
         std::string lcaseLibName(libName);
 
@@ -1525,7 +1578,7 @@ class KernelHooks
 #if _DEBUG
         LOG_TRACE("{}, caller: {}", lcaseLibName, Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
-        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheck(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1545,6 +1598,11 @@ class KernelHooks
         if (lpLibFileName == nullptr)
             return NULL;
 
+        auto categories = DllMatcher().Match(lpLibFileName);
+
+        if (categories == DllNameMatcher::None)
+            return o_K32_LoadLibraryW(lpLibFileName);
+
         std::wstring libName(lpLibFileName);
         std::wstring lcaseLibName(libName);
 
@@ -1575,7 +1633,7 @@ class KernelHooks
         LOG_TRACE("{}, caller: {}", wstring_to_string(lcaseLibName), Util::WhoIsTheCaller(_ReturnAddress()));
 #endif
 
-        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName);
+        auto moduleHandle = LoadLibraryCheckW(lcaseLibName, lpLibFileName, categories);
 
         // skip loading of dll
         if (moduleHandle == (HMODULE) 1)
@@ -1606,10 +1664,11 @@ class KernelHooks
                       Util::WhoIsTheCaller(_ReturnAddress()));
         }
 
-        if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-            hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-            lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
-            return (FARPROC) &customD3DKMTEnumAdapters2;
+        if (State::Instance().isRunningOnLinux)
+        {
+            if (auto proc = procOverrides.Find(hModule, lpProcName); proc != nullptr)
+                return (FARPROC) proc;
+        }
 
         return o_K32_GetProcAddress(hModule, lpProcName);
     }
@@ -1642,44 +1701,29 @@ class KernelHooks
                       Util::WhoIsTheCaller(_ReturnAddress()));
         }
 
-        if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-            hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-            lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
-            return (FARPROC) &customD3DKMTEnumAdapters2;
+        if (State::Instance().isRunningOnLinux)
+        {
+            if (auto proc = procOverrides.Find(hModule, lpProcName); proc != nullptr)
+                return (FARPROC) proc;
+        }
 
         return o_KB_GetProcAddress(hModule, lpProcName);
     }
 
-    static inline void NormalizePath(std::string& path)
-    {
-        while (!path.empty() && (path.back() == '\\' || path.back() == '/'))
-            path.pop_back();
-    }
-
-    static inline bool IsInsideWindowsDirectory(const std::string& path)
+    static inline bool IsInsideWindowsDirectory(LPCWSTR path)
     {
-        char windowsDir[MAX_PATH];
-        UINT len = GetWindowsDirectoryA(windowsDir, MAX_PATH);
-
-        if (len == 0 || len >= MAX_PATH)
-            return false;
-
-        std::string pathToCheck(path);
-        std::string windowsPath(windowsDir);
-
-        NormalizePath(pathToCheck);
-        NormalizePath(windowsPath);
+        static const WidePathMatcher windowsDirectory = []
+        {
+            wchar_t windowsDir[MAX_PATH];
+            UINT len = GetWindowsDirectoryW(windowsDir, MAX_PATH);
 
-        to_lower_in_place(pathToCheck);
-        to_lower_in_place(windowsPath);
+            if (len == 0 || len >= MAX_PATH)
+                return WidePathMatcher();
 
-        // Check if pathToCheck starts with windowsPath, while having a slash after that
-        if (pathToCheck.compare(0, windowsPath.size(), windowsPath) == 0 &&
-            (pathToCheck.size() == windowsPath.size() || pathToCheck[windowsPath.size()] == '\\' ||
-             pathToCheck[windowsPath.size()] == '/'))
-            return true;
+            return WidePathMatcher(windowsDir);
+        }();
 
-        return false;
+        return windowsDirectory.IsInside(path);
     }
 
     static DWORD hk_K32_GetFileAttributesW(LPCWSTR lpFileName)
@@ -1687,11 +1731,8 @@ class KernelHooks
         if (!State::Instance().nvngxExists && State::Instance().nvngxReplacement.has_value() &&
             Config::Instance()->DxgiSpoofing.value_or_default())
         {
-            auto path = wstring_to_string(std::wstring(lpFileName));
-            to_lower_in_place(path);
-
-            if (path.contains("nvngx.dll") && !path.contains("_nvngx.dll") &&
-                !IsInsideWindowsDirectory(path)) // apply the override to just one path
+            // apply the override to just one path
+            if (WidePathMatcher::IsNvngxPath(lpFileName) && !IsInsideWindowsDirectory(lpFileName))
             {
                 LOG_DEBUG("Overriding GetFileAttributesW for nvngx");
                 return FILE_ATTRIBUTE_ARCHIVE;
@@ -1708,15 +1749,14 @@ class KernelHooks
         if (!State::Instance().nvngxExists && State::Instance().nvngxReplacement.has_value() &&
             Config::Instance()->DxgiSpoofing.value_or_default())
         {
-            auto path = wstring_to_string(std::wstring(lpFileName));
-            to_lower_in_place(path);
-
             static auto signedDll = Util::FindFilePath(Util::DllPath().remove_filename(), "nvngx_dlss.dll");
 
-            if (path.contains("nvngx.dll") && !path.contains("_nvngx.dll") && // apply the override to just one path
-                !IsInsideWindowsDirectory(path) && signedDll.has_value())
+            // apply the override to just one path
+            if (WidePathMatcher::IsNvngxPath(lpFileName) && !IsInsideWindowsDirectory(lpFileName) &&
+                signedDll.has_value())
             {
-                LOG_DEBUG("Overriding CreateFileW for nvngx with a signed dll, original path: {}", path);
+                LOG_DEBUG("Overriding CreateFileW for nvngx with a signed dll, original path: {}",
+                          wstring_to_string(lpFileName));
                 return o_K32_CreateFileW(signedDll.value().c_str(), dwDesiredAccess, dwShareMode, lpSecurityAttributes,
                                          dwCreationDisposition, dwFlagsAndAttributes, hTemplateFile);
             }
@@ -1726,6 +1766,14 @@ class KernelHooks
                                  dwFlagsAndAttributes, hTemplateFile);
     }
 
+    static void AddProcOverrides()
+    {
+        if (procOverrides.Count() > 0)
+            return;
+
+        procOverrides.Add(L"gdi32.dll", "D3DKMTEnumAdapters2", (void*) &customD3DKMTEnumAdapters2);
+    }
+
   public:
     static void Hook()
     {
@@ -1734,6 +1782,8 @@ class KernelHooks
 
         LOG_DEBUG("");
 
+        AddProcOverrides();
+
         o_K32_FreeLibrary = Kernel32Proxy::Hook_FreeLibrary(hk_K32_FreeLibrary);
         o_K32_LoadLibraryA = Kernel32Proxy::Hook_LoadLibraryA(hk_K32_LoadLibraryA);
         o_K32_LoadLibraryW = Kernel32Proxy::Hook_LoadLibraryW(hk_K32_LoadLibraryW);
@@ -1752,6 +1802,8 @@ class KernelHooks
 
         LOG_DEBUG("");
 
+        AddProcOverrides();
+
         // These hooks cause stability regressions
         // o_KB_FreeLibrary = KernelBaseProxy::Hook_FreeLibrary(hk_KB_FreeLibrary);
 
@@ -0,0 +1,126 @@
+#include "ProcOverrideTable.h"
+
+#include <cstring>
+#include <cwchar>
+
+uint64_t ProcOverrideTable::Hash(const char* InProcName)
+{
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (auto p = InProcName; *p != 0; p++)
+    {
+        hash ^= (unsigned char) *p;
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+bool ProcOverrideTable::Add(const wchar_t* InModuleName, const char* InProcName, void* InReplacement)
+{
+    if (InModuleName == nullptr || InProcName == nullptr || _entryCount >= MaxEntries / 2)
+        return false;
+
+    uint32_t module = 0;
+    while (module < _moduleCount && std::wcscmp(_modules[module].Name, InModuleName) != 0)
+        module++;
+
+    if (module == _moduleCount)
+    {
+        if (_moduleCount >= MaxModules)
+            return false;
+
+        _modules[_moduleCount++].Name = InModuleName;
+    }
+
+    auto hash = Hash(InProcName);
+
+    for (uint32_t i = 0; i < MaxEntries; i++)
+    {
+        auto& entry = _entries[(hash + i) & (MaxEntries - 1)];
+
+        if (entry.ProcName != nullptr)
+        {
+            // Replace existing override
+            if (entry.Module == module && entry.Hash == hash && std::strcmp(entry.ProcName, InProcName) == 0)
+            {
+                entry.Replacement = InReplacement;
+                return true;
+            }
+
+            continue;
+        }
+
+        entry = { hash, module, InProcName, InReplacement };
+        _entryCount++;
+        return true;
+    }
+
+    return false;
+}
+
+int32_t ProcOverrideTable::FindModule(void* InModule)
+{
+    for (uint32_t i = 0; i < _moduleCount; i++)
+    {
+        auto& slot = _modules[i];
+        auto handle = slot.Handle.load(std::memory_order_acquire);
+
+        // Module might be loaded after the last lookup
+        if (handle == nullptr && _resolve != nullptr)
+        {
+            handle = _resolve(slot.Name);
+
+            if (handle != nullptr)
+                slot.Handle.store(handle, std::memory_order_release);
+        }
+
+        if (handle == InModule)
+            return (int32_t) i;
+    }
+
+    return -1;
+}
+
+void* ProcOverrideTable::Find(void* InModule, const char* InProcName)
+{
+    if (InModule == nullptr || InProcName == nullptr || _entryCount == 0)
+        return nullptr;
+
+    auto module = FindModule(InModule);
+    if (module < 0)
+        return nullptr;
+
+    auto hash = Hash(InProcName);
+
+    for (uint32_t i = 0; i < MaxEntries; i++)
+    {
+        auto& entry = _entries[(hash + i) & (MaxEntries - 1)];
+
+        if (entry.ProcName == nullptr)
+            return nullptr;
+
+        if (entry.Hash == hash && entry.Module == (uint32_t) module && std::strcmp(entry.ProcName, InProcName) == 0)
+            return entry.Replacement;
+    }
+
+    return nullptr;
+}
+
+bool ProcOverrideTable::Invalidate(void* InModule)
+{
+    if (InModule == nullptr)
+        return false;
+
+    auto result = false;
+
+    for (uint32_t i = 0; i < _moduleCount; i++)
+    {
+        void* expected = InModule;
+        if (_modules[i].Handle.compare_exchange_strong(expected, nullptr))
+            result = true;
+    }
+
+    return result;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Exports which GetProcAddress hooks replace, keyed by module and hashed proc name.
+// Entries are added by module name before the hooks are active, module handles are resolved once on demand
+// and forgotten when the module is freed. Calls for other modules return after comparing the handle.
+// Module resolving is done by a callback so the table doesn't depend on Windows headers.
+class ProcOverrideTable
+{
+  public:
+    using PFN_ResolveModule = void* (*) (const wchar_t* InModuleName);
+
+    static constexpr uint32_t MaxModules = 4;
+    static constexpr uint32_t MaxEntries = 16; // Power of 2
+
+  private:
+    struct ModuleSlot
+    {
+        const wchar_t* Name = nullptr;
+        std::atomic<void*> Handle { nullptr };
+    };
+
+    struct Entry
+    {
+        uint64_t Hash = 0;
+        uint32_t Module = 0;
+        const char* ProcName = nullptr;
+        void* Replacement = nullptr;
+    };
+
+    PFN_ResolveModule _resolve = nullptr;
+    std::array<ModuleSlot, MaxModules> _modules {};
+    std::array<Entry, MaxEntries> _entries {};
+    uint32_t _moduleCount = 0;
+    uint32_t _entryCount = 0;
+
+    int32_t FindModule(void* InModule);
+
+  public:
+    static uint64_t Hash(const char* InProcName);
+
+    // Not thread safe, should be called before hooks are active
+    bool Add(const wchar_t* InModuleName, const char* InProcName, void* InReplacement);
+
+    // Replacement of the export or nullptr when the call should go to the original
+    void* Find(void* InModule, const char* InProcName);
+
+    // Called when a module is freed, handle is resolved again on next lookup
+    bool Invalidate(void* InModule);
+
+    uint32_t Count() const { return _entryCount; }
+
+    ProcOverrideTable(PFN_ResolveModule InResolve) : _resolve(InResolve) {}
+};
@@ -0,0 +1,129 @@
+#include "TimestampRing.h"
+
+#include <algorithm>
+
+TimestampRing::TimestampRing(uint32_t InFrames, uint32_t InPasses)
+    : _frames(std::clamp(InFrames, 2u, MaxFrames)), _passes(std::clamp(InPasses, 1u, MaxPasses))
+{
+}
+
+void TimestampRing::Free(uint32_t InSlot)
+{
+    _slots[InSlot] = {};
+    _resetMask |= 1u << InSlot;
+}
+
+uint32_t TimestampRing::BeginPass(uint32_t InPass)
+{
+    if (InPass >= _passes)
+        return InvalidQuery;
+
+    auto& slot = _slots[_current];
+    auto bit = 1u << InPass;
+
+    // Results of an older frame are not read yet, or pass is already timed this frame
+    if (slot.Submitted || (slot.PassMask & bit) != 0)
+    {
+        _skipped++;
+        return InvalidQuery;
+    }
+
+    slot.PassMask |= bit;
+    slot.FrameId = _frameId;
+
+    return Query(_current, InPass);
+}
+
+void TimestampRing::EndFrame()
+{
+    if (_slots[_current].PassMask != 0)
+        _slots[_current].Submitted = true;
+
+    // Results never became available (command buffer not submitted, device lost etc.)
+    for (uint32_t i = 0; i < _frames; i++)
+    {
+        auto& slot = _slots[i];
+
+        if (slot.Submitted && ++slot.Age > MaxPendingFrames)
+        {
+            _dropped++;
+            Free(i);
+        }
+    }
+
+    _frameId++;
+    _current = (_current + 1) % _frames;
+}
+
+bool TimestampRing::OldestPending(Pending& OutPending) const
+{
+    auto found = false;
+
+    for (uint32_t i = 0; i < _frames; i++)
+    {
+        auto& slot = _slots[i];
+
+        if (!slot.Submitted || slot.PassMask == 0)
+            continue;
+
+        if (!found || slot.FrameId < OutPending.FrameId)
+        {
+            OutPending = { i, slot.PassMask, slot.FrameId };
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool TimestampRing::Resolve(uint32_t InSlot, uint32_t InPass, uint64_t InBegin, uint64_t InEnd)
+{
+    if (InSlot >= _frames || InPass >= _passes)
+        return false;
+
+    auto& slot = _slots[InSlot];
+    auto bit = 1u << InPass;
+
+    if (!slot.Submitted || (slot.PassMask & bit) == 0)
+        return false;
+
+    // Frames are executed in order, values which are not newer than the last read ones are left from
+    // the previous use of the queries and their reset didn't run yet
+    if (_lastFrame[InPass] != 0 && InBegin <= _lastBegin[InPass])
+    {
+        _stale++;
+        return false;
+    }
+
+    slot.PassMask &= ~bit;
+
+    if (InEnd >= InBegin)
+    {
+        _lastTicks[InPass] = InEnd - InBegin;
+        _lastFrame[InPass] = slot.FrameId + 1;
+        _lastBegin[InPass] = InBegin;
+    }
+
+    if (slot.PassMask == 0)
+        Free(InSlot);
+
+    return true;
+}
+
+uint32_t TimestampRing::TakeResetMask()
+{
+    auto mask = _resetMask;
+    _resetMask = 0;
+    return mask;
+}
+
+void TimestampRing::Reset()
+{
+    _slots.fill({});
+    _lastTicks.fill(0);
+    _lastFrame.fill(0);
+    _lastBegin.fill(0);
+    _resetMask = 0;
+    _current = 0;
+    _frameId = 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Query index bookkeeping for GPU timestamps of a few frames in flight.
+// Each frame slot has a begin/end query pair for every pass, results of a slot are read when they become
+// available instead of waiting. A slot is not written again until its results are read, frames which find their
+// slot still pending are not timed. Slots which stay pending for MaxPendingFrames are dropped.
+//
+// Queries reset inside a command buffer keep availability of their previous use until the GPU executes the reset,
+// so Resolve rejects results which are not newer than the last resolved ones of the pass. When host query reset is
+// available caller resets slots returned by TakeResetMask instead and results are never stale.
+// Vulkan independent, caller records the queries and polls the results.
+class TimestampRing
+{
+  public:
+    static constexpr uint32_t MaxFrames = 8;
+    static constexpr uint32_t MaxPasses = 4;
+    static constexpr uint32_t MaxPendingFrames = 32;
+    static constexpr uint32_t InvalidQuery = UINT32_MAX;
+
+    struct Pending
+    {
+        uint32_t Slot = 0;
+        uint32_t PassMask = 0; // Passes waiting for results
+        uint64_t FrameId = 0;
+    };
+
+  private:
+    struct SlotInfo
+    {
+        uint32_t PassMask = 0;
+        uint32_t Age = 0;
+        uint64_t FrameId = 0;
+        bool Submitted = false;
+    };
+
+    uint32_t _frames = 3;
+    uint32_t _passes = 1;
+    uint32_t _current = 0;
+    uint64_t _frameId = 0;
+
+    std::array<SlotInfo, MaxFrames> _slots {};
+    std::array<uint64_t, MaxPasses> _lastTicks {};
+    std::array<uint64_t, MaxPasses> _lastFrame {};
+    std::array<uint64_t, MaxPasses> _lastBegin {};
+    uint32_t _resetMask = 0;
+
+    uint64_t _dropped = 0;
+    uint64_t _skipped = 0;
+    uint64_t _stale = 0;
+
+    void Free(uint32_t InSlot);
+
+  public:
+    uint32_t Frames() const { return _frames; }
+    uint32_t Passes() const { return _passes; }
+    uint32_t QueryCount() const { return _frames * _passes * 2; }
+
+    // First query of the pass in InSlot, second one is the end query
+    uint32_t Query(uint32_t InSlot, uint32_t InPass) const { return (InSlot * _passes + InPass) * 2; }
+
+    // Returns begin query of the pass for current frame, queries should be reset before writing.
+    // InvalidQuery when the pass is already recorded this frame or the slot still waits for results.
+    uint32_t BeginPass(uint32_t InPass);
+
+    // Called at present, moves recorded passes to pending and starts a new frame
+    void EndFrame();
+
+    // Oldest submitted slot which still waits for results
+    bool OldestPending(Pending& OutPending) const;
+
+    // Stores result of an available query pair, frees slot when all passes are read.
+    // Returns false for results of a previous use of the queries, slot stays pending.
+    bool Resolve(uint32_t InSlot, uint32_t InPass, uint64_t InBegin, uint64_t InEnd);
+
+    // Slots which were read or dropped since last call, for host query reset
+    uint32_t TakeResetMask();
+
+    // Last resolved duration of the pass in ticks and frame id + 1 of it, 0 if there is none
+    uint64_t LastTicks(uint32_t InPass) const { return InPass < _passes ? _lastTicks[InPass] : 0; }
+    uint64_t LastFrame(uint32_t InPass) const { return InPass < _passes ? _lastFrame[InPass] : 0; }
+    uint64_t DroppedCount() const { return _dropped; }
+    uint64_t SkippedCount() const { return _skipped; }
+    uint64_t StaleCount() const { return _stale; }
+
+    void Reset();
+
+    TimestampRing() = default;
+    TimestampRing(uint32_t InFrames, uint32_t InPasses);
+};
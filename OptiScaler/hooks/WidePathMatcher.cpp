@@ -0,0 +1,65 @@
+#include "WidePathMatcher.h"
+
+static constexpr wchar_t Nvngx[] = L"nvngx.dll";
+static constexpr size_t NvngxLength = sizeof(Nvngx) / sizeof(wchar_t) - 1;
+
+bool WidePathMatcher::IsNvngxPath(const wchar_t* InPath)
+{
+    if (InPath == nullptr)
+        return false;
+
+    auto found = false;
+
+    for (auto p = InPath; *p != 0; p++)
+    {
+        // Most characters are rejected here, 'n' and 'N' only differ in 0x20 bit
+        if ((((unsigned char) *p) | 0x20) != Nvngx[0])
+            continue;
+
+        size_t i = 1;
+        while (i < NvngxLength && p[i] != 0 && Fold(p[i]) == Nvngx[i])
+            i++;
+
+        if (i != NvngxLength)
+            continue;
+
+        // Every _nvngx.dll also contains nvngx.dll, so a single underscore match rejects the path
+        if (p != InPath && Fold(p[-1]) == L'_')
+            return false;
+
+        found = true;
+        p += NvngxLength - 1;
+    }
+
+    return found;
+}
+
+void WidePathMatcher::SetPrefix(const wchar_t* InPrefix)
+{
+    _prefix.clear();
+
+    if (InPrefix == nullptr)
+        return;
+
+    for (auto p = InPrefix; *p != 0; p++)
+        _prefix.push_back(Fold(*p));
+
+    while (!_prefix.empty() && (_prefix.back() == L'\\' || _prefix.back() == L'/'))
+        _prefix.pop_back();
+}
+
+bool WidePathMatcher::IsInside(const wchar_t* InPath) const
+{
+    if (InPath == nullptr || _prefix.empty())
+        return false;
+
+    size_t i = 0;
+    for (; i < _prefix.size(); i++)
+    {
+        if (InPath[i] == 0 || Fold(InPath[i]) != _prefix[i])
+            return false;
+    }
+
+    // Same directory (trailing slashes are ignored) or something inside it
+    return InPath[i] == 0 || Fold(InPath[i]) == L'\\' || Fold(InPath[i]) == L'/';
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Allocation free checks of wide paths received by file api hooks, which can be called thousands of times
+// per second while a game streams assets. Characters are folded the same way as
+// wstring_to_string + to_lower_in_place (truncated to a byte, ASCII lowercase) so results are identical
+// to the string based checks.
+class WidePathMatcher
+{
+  private:
+    std::wstring _prefix;
+
+  public:
+    static wchar_t Fold(wchar_t InChar)
+    {
+        auto c = (unsigned char) InChar;
+        return (c >= 'A' && c <= 'Z') ? (wchar_t) (c + ('a' - 'A')) : (wchar_t) c;
+    }
+
+    // True when path contains nvngx.dll but not _nvngx.dll
+    static bool IsNvngxPath(const wchar_t* InPath);
+
+    // Prefix is folded and trailing slashes are removed once
+    void SetPrefix(const wchar_t* InPrefix);
+
+    // True when path is the prefix directory or inside it
+    bool IsInside(const wchar_t* InPath) const;
+
+    bool HasPrefix() const { return !_prefix.empty(); }
+
+    WidePathMatcher() = default;
+    explicit WidePathMatcher(const wchar_t* InPrefix) { SetPrefix(InPrefix); }
+};
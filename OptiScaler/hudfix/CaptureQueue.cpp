@@ -0,0 +1,130 @@
+#include "CaptureQueue.h"
+
+CaptureQueue::CaptureQueue()
+{
+    for (uint32_t i = 0; i < Capacity; i++)
+        _cells[i].Sequence.store(i, std::memory_order_relaxed);
+}
+
+bool CaptureQueue::Push(const Request& InRequest)
+{
+    auto pos = _enqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto& cell = _cells[pos % Capacity];
+        auto sequence = cell.Sequence.load(std::memory_order_acquire);
+        auto diff = (int64_t) sequence - (int64_t) pos;
+
+        if (diff == 0)
+        {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.Value = InRequest;
+                cell.Sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Full
+            return false;
+        }
+        else
+        {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool CaptureQueue::Pop(Request& OutRequest)
+{
+    auto pos = _dequeuePos.load(std::memory_order_relaxed);
+    auto& cell = _cells[pos % Capacity];
+    auto sequence = cell.Sequence.load(std::memory_order_acquire);
+
+    if ((int64_t) sequence - (int64_t) (pos + 1) < 0)
+        return false;
+
+    OutRequest = cell.Value;
+    cell.Sequence.store(pos + Capacity, std::memory_order_release);
+    _dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+uint64_t CaptureQueue::SlotWaitValue(uint32_t InSlot, uint64_t InCompletedValue) const
+{
+    // Last submit of the slot, state can be changed to ready without GPU finishing it
+    auto value = _slots[InSlot % SlotCount].FenceValue.load(std::memory_order_acquire);
+
+    if (value <= InCompletedValue)
+        return 0;
+
+    return value;
+}
+
+void CaptureQueue::Recorded(uint32_t InSlot, uint64_t InFrameId)
+{
+    auto& slot = _slots[InSlot % SlotCount];
+    slot.FrameId = InFrameId;
+    slot.State.store(SlotRecorded, std::memory_order_release);
+}
+
+uint64_t CaptureQueue::Submitted(uint32_t InSlot)
+{
+    auto& slot = _slots[InSlot % SlotCount];
+    slot.FenceValue.store(++_lastFenceValue, std::memory_order_release);
+    slot.State.store(SlotSubmitted, std::memory_order_release);
+
+    return _lastFenceValue;
+}
+
+void CaptureQueue::MarkReady(uint32_t InSlot)
+{
+    _slots[InSlot % SlotCount].State.store(SlotReady, std::memory_order_release);
+}
+
+uint64_t CaptureQueue::Drop(uint32_t InSlot)
+{
+    MarkReady(InSlot);
+    return _droppedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+uint64_t CaptureQueue::DroppedCount() const { return _droppedCount.load(std::memory_order_relaxed); }
+
+uint64_t CaptureQueue::ReadyWaitValue(uint32_t InSlot, uint64_t InCompletedValue)
+{
+    auto& slot = _slots[InSlot % SlotCount];
+
+    if (slot.State.load(std::memory_order_acquire) != SlotSubmitted)
+        return 0;
+
+    auto value = slot.FenceValue.load(std::memory_order_acquire);
+
+    if (value <= InCompletedValue)
+    {
+        slot.State.store(SlotReady, std::memory_order_release);
+        return 0;
+    }
+
+    return value;
+}
+
+CaptureQueue::SlotState CaptureQueue::State(uint32_t InSlot) const
+{
+    return (SlotState) _slots[InSlot % SlotCount].State.load(std::memory_order_acquire);
+}
+
+void CaptureQueue::Reset()
+{
+    Request request;
+    while (Pop(request))
+        ;
+
+    for (auto& slot : _slots)
+    {
+        slot.State.store(SlotFree, std::memory_order_relaxed);
+        slot.FrameId = 0;
+    }
+}
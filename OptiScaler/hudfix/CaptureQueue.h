@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Hands hudless captures from draw hooks to the submit hook.
+// Hooks push a request after recording the snapshot copy to game's command list, lock free and from any thread.
+// Submit hook pops requests of submitted command lists and runs remaining capture work on Hudfix queue.
+// Each frame slot tracks readiness of its capture buffer: Recorded -> Submitted (fence value) -> Ready,
+// FG waits for the slot's fence value before reading the capture.
+class CaptureQueue
+{
+  public:
+    struct Request
+    {
+        const void* Resource = nullptr;
+        const void* CommandList = nullptr;
+        uint64_t FrameId = 0;
+        uint32_t Slot = 0;
+        bool NeedsTransfer = false;
+    };
+
+    enum SlotState : uint32_t
+    {
+        SlotFree = 0,
+        SlotRecorded,  // Copy is in game's command list
+        SlotSubmitted, // Remaining work is on Hudfix queue
+        SlotReady,     // Nothing else to wait
+    };
+
+    static constexpr uint32_t Capacity = 16;
+    static constexpr uint32_t SlotCount = 4;
+
+  private:
+    struct Cell
+    {
+        std::atomic<uint64_t> Sequence { 0 };
+        Request Value {};
+    };
+
+    struct SlotInfo
+    {
+        std::atomic<uint32_t> State { SlotFree };
+        std::atomic<uint64_t> FenceValue { 0 };
+        uint64_t FrameId = 0;
+    };
+
+    std::array<Cell, Capacity> _cells;
+    alignas(64) std::atomic<uint64_t> _enqueuePos { 0 };
+    alignas(64) std::atomic<uint64_t> _dequeuePos { 0 };
+
+    std::array<SlotInfo, SlotCount> _slots;
+    uint64_t _lastFenceValue = 0;
+    std::atomic<uint64_t> _droppedCount { 0 };
+
+  public:
+    // Multiple producers, returns false when queue is full
+    bool Push(const Request& InRequest);
+
+    // Single consumer
+    bool Pop(Request& OutRequest);
+
+    // Fence value to wait on CPU before slot's buffers are reused, 0 when slot is free
+    uint64_t SlotWaitValue(uint32_t InSlot, uint64_t InCompletedValue) const;
+
+    void Recorded(uint32_t InSlot, uint64_t InFrameId);
+
+    // Returns fence value Hudfix queue should signal after slot's work
+    uint64_t Submitted(uint32_t InSlot);
+    void MarkReady(uint32_t InSlot);
+
+    // Capture of the slot is given up (queue full or slot busy), marks it ready and returns number of drops so far
+    uint64_t Drop(uint32_t InSlot);
+    uint64_t DroppedCount() const;
+
+    // Fence value FG should wait before using the capture, 0 when it's ready
+    uint64_t ReadyWaitValue(uint32_t InSlot, uint64_t InCompletedValue);
+
+    SlotState State(uint32_t InSlot) const;
+    void Reset();
+
+    CaptureQueue();
+};
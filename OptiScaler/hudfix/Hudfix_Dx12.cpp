@@ -62,7 +62,7 @@ bool Hudfix_Dx12::CreateObjects()
         queueDesc.NodeMask = 0;
         queueDesc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_HIGH;
 
-        HRESULT hr = State::Instance().currentD3D12Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&_commandQueue));
+        result = State::Instance().currentD3D12Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&_commandQueue));
         if (result != S_OK)
         {
             LOG_ERROR("CreateCommandQueue: {:X}", (unsigned long) result);
@@ -71,6 +71,14 @@ bool Hudfix_Dx12::CreateObjects()
 
         _commandQueue->SetName(L"Hudfix CommandQueue");
 
+        result =
+            State::Instance().currentD3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_gameFence));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateFence: {0:X}", (unsigned long) result);
+            break;
+        }
+
         return true;
 
     } while (false);
@@ -79,17 +87,20 @@ bool Hudfix_Dx12::CreateObjects()
 }
 
 bool Hudfix_Dx12::CreateBufferResource(ID3D12Device* InDevice, ResourceInfo* InSource, D3D12_RESOURCE_STATES InState,
-                                       ID3D12Resource** OutResource)
+                                       ID3D12Resource** OutResource, DXGI_FORMAT InFormat)
 {
     if (InDevice == nullptr || InSource == nullptr)
         return false;
 
+    // Buffer can be created with a cast compatible format of source
+    auto format = InFormat != DXGI_FORMAT_UNKNOWN ? InFormat : InSource->format;
+
     if (*OutResource != nullptr)
     {
         auto bufDesc = (*OutResource)->GetDesc();
 
         if (bufDesc.Width != (UINT64) (InSource->width) || bufDesc.Height != (UINT) (InSource->height) ||
-            bufDesc.Format != InSource->format)
+            bufDesc.Format != format)
         {
             (*OutResource)->Release();
             (*OutResource) = nullptr;
@@ -112,6 +123,7 @@ bool Hudfix_Dx12::CreateBufferResource(ID3D12Device* InDevice, ResourceInfo* InS
     }
 
     D3D12_RESOURCE_DESC texDesc = InSource->buffer->GetDesc();
+    texDesc.Format = format;
     texDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
     hr = InDevice->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &texDesc, InState, nullptr,
@@ -564,9 +576,22 @@ bool Hudfix_Dx12::CheckForHudless(std::string callerName, ID3D12GraphicsCommandL
             return false;
         }
 
+        // Cast compatible formats are copied directly to a buffer with swapchain format
+        auto transferMode = FT_Dx12::TransferMode(resource->format, scDesc.BufferDesc.Format);
+
+        if (transferMode == FT_TransferMode::Unsupported)
+        {
+            LOG_DEBUG("Can't transfer {} to swapchain format {}", (UINT) resource->format,
+                      (UINT) scDesc.BufferDesc.Format);
+            _captureCounter[fIndex]--;
+            break;
+        }
+
+        auto captureFormat = transferMode == FT_TransferMode::Copy ? scDesc.BufferDesc.Format : resource->format;
+
         // Make a copy of resource to capture current state
         if (CreateBufferResource(State::Instance().currentD3D12Device, resource, D3D12_RESOURCE_STATE_COPY_DEST,
-                                 &_captureBuffer[fIndex]))
+                                 &_captureBuffer[fIndex], captureFormat))
         {
             LOG_DEBUG("Create a copy of resource: {:X}", (size_t) resource->buffer);
 
@@ -590,42 +615,59 @@ bool Hudfix_Dx12::CheckForHudless(std::string callerName, ID3D12GraphicsCommandL
         }
 
         // needs conversion?
-        if (resource->format != scDesc.BufferDesc.Format)
+        if (transferMode != FT_TransferMode::None && transferMode != FT_TransferMode::Copy)
         {
-            if (_formatTransfer == nullptr || !_formatTransfer->IsFormatCompatible(scDesc.BufferDesc.Format))
+            auto& formatTransfer = _formatTransfer[fIndex];
+
+            if (formatTransfer == nullptr || !formatTransfer->IsFormatCompatible(scDesc.BufferDesc.Format))
             {
-                LOG_DEBUG("Format change, recreate the FormatTransfer");
+                LOG_DEBUG("Format change, recreate the FormatTransfer of slot: {}", fIndex);
 
-                if (_formatTransfer != nullptr)
-                    delete _formatTransfer;
+                if (formatTransfer != nullptr)
+                    delete formatTransfer;
 
-                _formatTransfer = nullptr;
+                formatTransfer = nullptr;
                 State::Instance().skipHeapCapture = true;
-                _formatTransfer =
+                formatTransfer =
                     new FT_Dx12("FormatTransfer", State::Instance().currentD3D12Device, scDesc.BufferDesc.Format);
                 State::Instance().skipHeapCapture = false;
             }
 
-            if (_formatTransfer != nullptr &&
-                _formatTransfer->CreateBufferResource(State::Instance().currentD3D12Device, resource->buffer,
+            if (formatTransfer != nullptr &&
+                formatTransfer->CreateBufferResource(State::Instance().currentD3D12Device, resource->buffer,
                                                       D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
             {
                 // This will prevent resource tracker to check these operations
                 // Will reset after FG dispatch
                 _skipHudlessChecks = true;
 
-                ResourceBarrier(cmdList, _captureBuffer[fIndex], D3D12_RESOURCE_STATE_COPY_DEST,
-                                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-                _formatTransfer->Dispatch(State::Instance().currentD3D12Device, cmdList, _captureBuffer[fIndex],
-                                          _formatTransfer->Buffer());
-                ResourceBarrier(cmdList, _captureBuffer[fIndex], D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
-                                D3D12_RESOURCE_STATE_COPY_DEST);
+                if (Config::Instance()->FGHUDFixDeferredTransfer.value_or_default())
+                {
+                    // Only the snapshot copy stays in game's list, transfer runs after the list is submitted
+                    _captureQueue.Recorded(fIndex, _upscaleCounter);
 
-                LOG_TRACE("Using _formatTransfer->Buffer()");
+                    if (!_captureQueue.Push({ resource->buffer, cmdList, _upscaleCounter, (uint32_t) fIndex, true }))
+                    {
+                        CaptureDropped(fIndex, _upscaleCounter, "capture queue is full");
+                        _captureCounter[fIndex]--;
+                        break;
+                    }
+                }
+                else
+                {
+                    ResourceBarrier(cmdList, _captureBuffer[fIndex], D3D12_RESOURCE_STATE_COPY_DEST,
+                                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+                    formatTransfer->Dispatch(State::Instance().currentD3D12Device, cmdList, _captureBuffer[fIndex],
+                                             formatTransfer->Buffer());
+                    ResourceBarrier(cmdList, _captureBuffer[fIndex], D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+                                    D3D12_RESOURCE_STATE_COPY_DEST);
+                }
+
+                LOG_TRACE("Using _formatTransfer[{}]->Buffer()", fIndex);
 
                 auto fg = reinterpret_cast<IFGFeature_Dx12*>(State::Instance().currentFG);
                 if (fg != nullptr)
-                    fg->SetHudless(nullptr, _formatTransfer->Buffer(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, false);
+                    fg->SetHudless(nullptr, formatTransfer->Buffer(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, false);
             }
             else
             {
@@ -639,6 +681,7 @@ bool Hudfix_Dx12::CheckForHudless(std::string callerName, ID3D12GraphicsCommandL
             // This will prevent resource tracker to check these operations
             // Will reset after FG dispatch
             _skipHudlessChecks = true;
+            _captureQueue.MarkReady(fIndex);
             LOG_DEBUG("Using _captureBuffer");
             auto fg = reinterpret_cast<IFGFeature_Dx12*>(State::Instance().currentFG);
             if (fg != nullptr)
@@ -652,6 +695,8 @@ bool Hudfix_Dx12::CheckForHudless(std::string callerName, ID3D12GraphicsCommandL
             State::Instance().FGcapturedResourceCount = _captureList.size();
         }
 
+        _lastCaptureSlot = fIndex;
+
         LOG_DEBUG("Calling FG with hudless");
 
         // This will prevent resource tracker to check these operations
@@ -696,5 +741,211 @@ void Hudfix_Dx12::ResetCounters()
     _captureCounter[2] = 0;
     _captureCounter[3] = 0;
 
+    {
+        std::lock_guard<std::mutex> lock(_captureQueueMutex);
+        _captureQueue.Reset();
+        _pendingCaptures.clear();
+    }
+
     LOG_DEBUG("_hudlessList: {}", _hudlessList.size());
 }
+
+bool Hudfix_Dx12::TransferSlotBusy(UINT InSlot)
+{
+    // SubmitTransfer fails without objects
+    if (_fence[InSlot] == nullptr)
+        return false;
+
+    return _captureQueue.SlotWaitValue(InSlot, _fence[InSlot]->GetCompletedValue()) != 0;
+}
+
+void Hudfix_Dx12::ListSubmitted(ID3D12CommandQueue* InGameQueue, PendingCapture& InPending)
+{
+    // Transfer can only start after the snapshot copy, Hudfix queue waits this value when transfer is submitted
+    _gameFenceValue++;
+    InGameQueue->Signal(_gameFence, _gameFenceValue);
+    InPending.GameFenceValue = _gameFenceValue;
+}
+
+void Hudfix_Dx12::CaptureDropped(UINT InSlot, UINT64 InFrameId, const char* InReason)
+{
+    auto count = _captureQueue.Drop(InSlot);
+
+    if (count == 1)
+        LOG_WARN("Hudless capture dropped, frame: {}, slot: {}, reason: {}. FG runs without new hudless for the frame",
+                 InFrameId, InSlot, InReason);
+    else
+        LOG_DEBUG("Hudless capture dropped, frame: {}, slot: {}, reason: {}, dropped captures: {}", InFrameId, InSlot,
+                  InReason, count);
+}
+
+bool Hudfix_Dx12::SubmitTransfer(const PendingCapture& InPending)
+{
+    auto slot = InPending.Request.Slot % BUFFER_COUNT;
+
+    if (_commandQueue == nullptr || _formatTransfer[slot] == nullptr || _captureBuffer[slot] == nullptr ||
+        InPending.GameFenceValue == 0)
+        return false;
+
+    // Completed value is UINT64_MAX after device removal
+    if (_fence[slot]->GetCompletedValue() == UINT64_MAX)
+    {
+        LOG_ERROR("Hudfix queue can't finish slot: {}", slot);
+        return false;
+    }
+
+    auto result = _commandAllocator[slot]->Reset();
+    if (result != S_OK)
+    {
+        LOG_ERROR("_commandAllocator[{}]->Reset: {:X}", slot, (unsigned long) result);
+        return false;
+    }
+
+    result = _commandList[slot]->Reset(_commandAllocator[slot], nullptr);
+    if (result != S_OK)
+    {
+        LOG_ERROR("_commandList[{}]->Reset: {:X}", slot, (unsigned long) result);
+        return false;
+    }
+
+    ResourceBarrier(_commandList[slot], _captureBuffer[slot], D3D12_RESOURCE_STATE_COPY_DEST,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+    _formatTransfer[slot]->Dispatch(State::Instance().currentD3D12Device, _commandList[slot], _captureBuffer[slot],
+                                    _formatTransfer[slot]->Buffer());
+    ResourceBarrier(_commandList[slot], _captureBuffer[slot], D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COPY_DEST);
+
+    result = _commandList[slot]->Close();
+    if (result != S_OK)
+    {
+        LOG_ERROR("_commandList[{}]->Close: {:X}", slot, (unsigned long) result);
+        return false;
+    }
+
+    _commandQueue->Wait(_gameFence, InPending.GameFenceValue);
+
+    ID3D12CommandList* cl[] = { _commandList[slot] };
+    _commandQueue->ExecuteCommandLists(1, cl);
+    _commandQueue->Signal(_fence[slot], _captureQueue.Submitted(slot));
+
+    LOG_DEBUG("Capture transfer submitted, slot: {}, frame: {}", slot, InPending.Request.FrameId);
+
+    return true;
+}
+
+void Hudfix_Dx12::CommandListsSubmitted(ID3D12CommandQueue* InQueue, UINT InNumCommandLists,
+                                        ID3D12CommandList* const* InCommandLists)
+{
+    // Our own submits also pass through the hook
+    if (InQueue == _commandQueue)
+        return;
+
+    std::lock_guard<std::mutex> lock(_captureQueueMutex);
+
+    CaptureQueue::Request request;
+    while (_captureQueue.Pop(request))
+        _pendingCaptures.push_back({ request, 0 });
+
+    if (_pendingCaptures.empty())
+        return;
+
+    for (size_t i = 0; i < _pendingCaptures.size();)
+    {
+        auto& pending = _pendingCaptures[i];
+
+        if (pending.GameFenceValue == 0)
+        {
+            for (size_t j = 0; j < InNumCommandLists; j++)
+            {
+                if (InCommandLists[j] == pending.Request.CommandList)
+                {
+                    ListSubmitted(InQueue, pending);
+                    break;
+                }
+            }
+        }
+
+        // Not submitted yet or previous transfer of the slot is still running. The hook doesn't wait for the
+        // Hudfix queue, the transfer is retried with the next submit
+        if (pending.GameFenceValue == 0 || TransferSlotBusy(pending.Request.Slot % BUFFER_COUNT))
+        {
+            if (pending.Request.FrameId + BUFFER_COUNT > _upscaleCounter)
+            {
+                i++;
+                continue;
+            }
+
+            // Slot is reused
+            CaptureDropped(pending.Request.Slot % BUFFER_COUNT, pending.Request.FrameId,
+                           pending.GameFenceValue != 0 ? "slot is busy" : "list is not submitted");
+        }
+        else if (!SubmitTransfer(pending))
+        {
+            CaptureDropped(pending.Request.Slot % BUFFER_COUNT, pending.Request.FrameId, "transfer submit failed");
+        }
+
+        _pendingCaptures.erase(_pendingCaptures.begin() + i);
+    }
+}
+
+bool Hudfix_Dx12::WaitForCapture(ID3D12CommandQueue* InQueue)
+{
+    auto slot = _lastCaptureSlot % BUFFER_COUNT;
+
+    if (_fence[slot] == nullptr)
+        return false;
+
+    // Transfer is not submitted yet. Either submit of the game's list wasn't seen by the hook (at present everything
+    // before it is already on a queue so the transfer can be ordered after InQueue's work) or slot was busy
+    if (_captureQueue.State(slot) == CaptureQueue::SlotRecorded)
+    {
+        std::lock_guard<std::mutex> lock(_captureQueueMutex);
+
+        CaptureQueue::Request request;
+        while (_captureQueue.Pop(request))
+            _pendingCaptures.push_back({ request, 0 });
+
+        auto submitted = false;
+        const char* reason = "request not found";
+
+        for (size_t i = 0; i < _pendingCaptures.size(); i++)
+        {
+            auto& pending = _pendingCaptures[i];
+
+            if (pending.Request.Slot % BUFFER_COUNT != slot)
+                continue;
+
+            if (pending.GameFenceValue == 0)
+            {
+                LOG_WARN("Capture of slot {} is not submitted yet, submitting with present", slot);
+                ListSubmitted(InQueue, pending);
+            }
+
+            // Hudfix queue is a whole ring behind, skip this capture instead of stalling present
+            if (TransferSlotBusy(slot))
+            {
+                reason = "slot is busy";
+            }
+            else
+            {
+                submitted = SubmitTransfer(pending);
+                reason = "transfer submit failed";
+            }
+
+            _pendingCaptures.erase(_pendingCaptures.begin() + i);
+            break;
+        }
+
+        if (!submitted)
+            CaptureDropped(slot, _upscaleCounter, reason);
+    }
+
+    auto waitValue = _captureQueue.ReadyWaitValue(slot, _fence[slot]->GetCompletedValue());
+    if (waitValue == 0)
+        return false;
+
+    LOG_DEBUG("Waiting capture, slot: {}, value: {}", slot, waitValue);
+    InQueue->Wait(_fence[slot], waitValue);
+
+    return true;
+}
@@ -1,11 +1,13 @@
 #pragma once
 #include <pch.h>
+#include "CaptureQueue.h"
 
 #include <shaders/format_transfer/FT_Dx12.h>
 
 #include <ankerl/unordered_dense.h>
 
 #include <set>
+#include <vector>
 #include <dxgi.h>
 #include <d3d12.h>
 #include <shared_mutex>
@@ -14,7 +16,8 @@ enum ResourceType
 {
     SRV,
     RTV,
-    UAV
+    UAV,
+    DSV
 };
 
 typedef struct ResourceInfo
@@ -69,18 +72,37 @@ class Hudfix_Dx12
     inline static std::mutex _captureMutex;
     inline static std::mutex _counterMutex;
     inline static INT64 _captureCounter[BUFFER_COUNT] = { 0, 0, 0, 0 };
-    inline static FT_Dx12* _formatTransfer = nullptr;
+
+    // One per slot, FG queue can still be reading previous frame's output while Hudfix queue transfers the next one
+    inline static FT_Dx12* _formatTransfer[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
 
     inline static ID3D12CommandQueue* _commandQueue = nullptr;
     inline static ID3D12GraphicsCommandList* _commandList[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     inline static ID3D12CommandAllocator* _commandAllocator[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
     inline static ID3D12Fence* _fence[BUFFER_COUNT] = { nullptr, nullptr, nullptr, nullptr };
 
+    // Signalled on game queue after the list with snapshot copy, Hudfix queue waits it
+    inline static ID3D12Fence* _gameFence = nullptr;
+    inline static UINT64 _gameFenceValue = 0;
+
+    // Capture request waiting for its transfer submit
+    struct PendingCapture
+    {
+        CaptureQueue::Request Request;
+        UINT64 GameFenceValue = 0; // Signalled on game queue after the request's list, 0 until list is submitted
+    };
+
+    // Deferred format transfer requests
+    inline static CaptureQueue _captureQueue;
+    inline static std::mutex _captureQueueMutex;
+    inline static std::vector<PendingCapture> _pendingCaptures;
+    inline static UINT _lastCaptureSlot = 0;
+
     inline static bool _skipHudlessChecks = false;
 
     static bool CreateObjects();
     static bool CreateBufferResource(ID3D12Device* InDevice, ResourceInfo* InSource, D3D12_RESOURCE_STATES InState,
-                                     ID3D12Resource** OutResource);
+                                     ID3D12Resource** OutResource, DXGI_FORMAT InFormat = DXGI_FORMAT_UNKNOWN);
     static void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                                 D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
 
@@ -89,6 +111,18 @@ class Hudfix_Dx12
 
     static void HudlessFound();
 
+    // Previous transfer of the slot is still on Hudfix queue, its allocator can't be reset yet. Doesn't wait
+    static bool TransferSlotBusy(UINT InSlot);
+
+    // Signals _gameFence on game queue after the request's command list
+    static void ListSubmitted(ID3D12CommandQueue* InGameQueue, PendingCapture& InPending);
+
+    // Frame continues without hudless, logs first drop and keeps count of the rest
+    static void CaptureDropped(UINT InSlot, UINT64 InFrameId, const char* InReason);
+
+    // Records and executes format transfer of request on Hudfix queue, check TransferSlotBusy first
+    static bool SubmitTransfer(const PendingCapture& InPending);
+
     static int GetIndex();
 
     inline static IID streamlineRiid {};
@@ -121,6 +155,13 @@ class Hudfix_Dx12
                                 D3D12_RESOURCE_STATES state);
     static bool CheckResource(ResourceInfo* resource);
 
+    // Runs deferred capture work of submitted command lists
+    static void CommandListsSubmitted(ID3D12CommandQueue* InQueue, UINT InNumCommandLists,
+                                      ID3D12CommandList* const* InCommandLists);
+
+    // Makes InQueue wait until last capture is ready
+    static bool WaitForCapture(ID3D12CommandQueue* InQueue);
+
     // Reset frame counters
     static void ResetCounters();
 };
@@ -0,0 +1,94 @@
+#include "DepthCopyRing.h"
+
+#include <algorithm>
+
+DepthCopyRing::DepthCopyRing(uint32_t InSlots) : _slotCount(std::clamp(InSlots, 2u, MaxSlots)) {}
+
+DepthCopyRing::Action DepthCopyRing::Acquire(const Key& InKey)
+{
+    _current = (_current + 1) % _slotCount;
+
+    auto& slot = _slots[_current];
+
+    if (slot.Resource != nullptr && slot.Desc == InKey)
+    {
+        _reused++;
+        return Reuse;
+    }
+
+    // Size, format or device changed
+    if (slot.Resource != nullptr)
+        _retired.push_back({ slot.Resource, 0 });
+
+    slot.Resource = nullptr;
+    slot.Desc = InKey;
+    slot.State = 0;
+
+    return Create;
+}
+
+void DepthCopyRing::Created(void* InResource, uint32_t InState)
+{
+    auto& slot = _slots[_current];
+
+    slot.Resource = InResource;
+    slot.State = InState;
+
+    if (InResource != nullptr)
+        _created++;
+}
+
+bool DepthCopyRing::NeedsSignal() const
+{
+    return std::any_of(_retired.begin(), _retired.end(),
+                       [](const Retired& retired) { return retired.FenceValue == 0; });
+}
+
+void DepthCopyRing::Signaled(uint64_t InFenceValue)
+{
+    for (auto& retired : _retired)
+    {
+        if (retired.FenceValue == 0)
+            retired.FenceValue = InFenceValue;
+    }
+}
+
+void* DepthCopyRing::Release(uint64_t InCompletedValue)
+{
+    for (size_t i = 0; i < _retired.size(); i++)
+    {
+        if (_retired[i].FenceValue == 0 || _retired[i].FenceValue > InCompletedValue)
+            continue;
+
+        auto resource = _retired[i].Resource;
+        _retired.erase(_retired.begin() + i);
+
+        return resource;
+    }
+
+    return nullptr;
+}
+
+void* DepthCopyRing::Drain()
+{
+    if (!_retired.empty())
+    {
+        auto resource = _retired.back().Resource;
+        _retired.pop_back();
+
+        return resource;
+    }
+
+    for (auto& slot : _slots)
+    {
+        if (slot.Resource != nullptr)
+        {
+            auto resource = slot.Resource;
+            slot = {};
+
+            return resource;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Persistent copies of a resource which is consumed a frame later (DLSSG depth).
+// Every frame uses the next slot, so the consumer reads a copy that is not written by the following frame.
+// A slot's resource is recreated only when the description of the source changes, resource states are
+// tracked per slot. Replaced resources are kept until a fence value signaled after their last use is reached.
+// API independent, resources are opaque pointers created and released by the caller.
+class DepthCopyRing
+{
+  public:
+    static constexpr uint32_t MaxSlots = 4;
+
+    struct Key
+    {
+        uint64_t Device = 0; // resources of another device are never reused
+        uint64_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t DepthOrArraySize = 0;
+        uint32_t MipLevels = 0;
+        uint32_t Format = 0;
+        uint32_t SampleCount = 0;
+        uint32_t Flags = 0;
+        uint32_t HeapType = 0;
+
+        bool operator==(const Key& other) const
+        {
+            return Device == other.Device && Width == other.Width && Height == other.Height &&
+                   DepthOrArraySize == other.DepthOrArraySize && MipLevels == other.MipLevels &&
+                   Format == other.Format && SampleCount == other.SampleCount && Flags == other.Flags &&
+                   HeapType == other.HeapType;
+        }
+    };
+
+    enum Action : uint32_t
+    {
+        Reuse = 0, // Current slot has a matching resource
+        Create,    // Caller should create a resource and pass it to Created
+    };
+
+  private:
+    struct Slot
+    {
+        void* Resource = nullptr;
+        Key Desc;
+        uint32_t State = 0;
+    };
+
+    struct Retired
+    {
+        void* Resource = nullptr;
+        uint64_t FenceValue = 0; // 0 until a fence is signaled after retiring
+    };
+
+    std::array<Slot, MaxSlots> _slots {};
+    uint32_t _slotCount = 2;
+    uint32_t _current = 0;
+
+    std::vector<Retired> _retired;
+
+    uint64_t _created = 0;
+    uint64_t _reused = 0;
+
+  public:
+    // Moves to the next slot. When the slot has a resource which doesn't match InKey it's retired,
+    // a fence signaled after this call covers its last use.
+    Action Acquire(const Key& InKey);
+
+    // Resource created for the current slot, nullptr when creation failed
+    void Created(void* InResource, uint32_t InState);
+
+    void* Current() const { return _slots[_current].Resource; }
+    uint32_t CurrentState() const { return _slots[_current].State; }
+    void SetCurrentState(uint32_t InState) { _slots[_current].State = InState; }
+
+    // Retired resources are waiting for Signaled
+    bool NeedsSignal() const;
+
+    // InFenceValue was signaled on the queue after the resources retired so far were used
+    void Signaled(uint64_t InFenceValue);
+
+    // Returns a retired resource for release when its fence value is reached, nullptr when there is none
+    void* Release(uint64_t InCompletedValue);
+
+    // Empties slots and retired resources, returns one resource per call until nullptr. GPU must be idle.
+    void* Drain();
+
+    size_t RetiredCount() const { return _retired.size(); }
+
+    uint32_t SlotCount() const { return _slotCount; }
+    uint32_t CurrentSlot() const { return _current; }
+    uint64_t CreatedCount() const { return _created; }
+    uint64_t ReusedCount() const { return _reused; }
+
+    DepthCopyRing() = default;
+    DepthCopyRing(uint32_t InSlots);
+};
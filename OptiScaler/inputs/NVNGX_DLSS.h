@@ -6,3 +6,6 @@ template <typename FeatureType> struct ContextData
     NVSDK_NGX_Parameter* createParams = nullptr;
     int changeBackendCounter = 0;
 };
+
+// Called on DLL_PROCESS_DETACH, never joins under the loader lock
+void DetachDx12WarmWorker();
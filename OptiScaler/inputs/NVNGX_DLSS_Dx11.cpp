@@ -936,6 +936,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceConte
         return NVSDK_NGX_Result_Success;
     }
 
+    // Read once for the upscaler
+    deviceContext->ReadInputs(InParameters, EvaluateInputs::Dx11);
+
     // In the render loop:
     HooksDx::previousFrameIndex =
         (HooksDx::currentFrameIndex + HooksDx::QUERY_BUFFER_COUNT - 2) % HooksDx::QUERY_BUFFER_COUNT;
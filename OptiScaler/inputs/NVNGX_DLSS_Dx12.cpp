@@ -5,6 +5,7 @@
 #include "proxies/NVNGX_Proxy.h"
 #include "DLSSG_Mod.h"
 #include "NVNGX_DLSS.h"
+#include "DepthCopyRing.h"
 
 #include "upscalers/dlss/DLSSFeature_Dx12.h"
 #include "upscalers/dlssd/DLSSDFeature_Dx12.h"
@@ -12,6 +13,7 @@
 #include "upscalers/fsr2_212/FSR2Feature_Dx12_212.h"
 #include "upscalers/fsr31/FSR31Feature_Dx12.h"
 #include "upscalers/xess/XeSSFeature_Dx12.h"
+#include "upscalers/FeatureWarmPool.h"
 
 #include "framegen/ffx/FSRFG_Dx12.h"
 
@@ -24,6 +26,7 @@
 #include "shaders/depth_scale/DS_Dx12.h"
 
 #include <dxgi1_4.h>
+#include <thread>
 #include <shared_mutex>
 #include "detours/detours.h"
 #include <ffx_framegeneration.h>
@@ -31,8 +34,6 @@
 
 // Use a dedicated Queue + CommandList for FG without hudfix
 // Looks like causing stutter/sync issues
-// #define USE_QUEUE_FOR_FG
-
 // static UINT64 fgLastFrameTime = 0;
 // static UINT64 fgLastFGFrame = 0;
 // static UINT fgCallbackFrameIndex = 0;
@@ -49,6 +50,13 @@ static bool shutdown = false;
 
 static DS_Dx12* DepthScale = nullptr;
 
+// Depth copies for DLSSG when MakeDepthCopy is enabled, replaced copies are released after depthCopyFence
+static DepthCopyRing dlssgDepthCopies;
+static ID3D12Device* depthCopyDevice = nullptr;
+static ID3D12Fence* depthCopyFence = nullptr;
+static HANDLE depthCopyFenceEvent = nullptr;
+static UINT64 depthCopyFenceValue = 0;
+
 static void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                             D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState)
 {
@@ -61,6 +69,58 @@ static void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Reso
     InCommandList->ResourceBarrier(1, &barrier);
 }
 
+// InAll waits for the GPU and releases every copy (shutdown or device change)
+static void ReleaseDepthCopies(bool InAll)
+{
+    auto queue = State::Instance().currentCommandQueue;
+
+    if (InAll)
+    {
+        // Fence of an old device can't be signaled from the new device's queue, its work is done anyway
+        if (depthCopyFence != nullptr && queue != nullptr && depthCopyDevice == D3D12Device &&
+            queue->Signal(depthCopyFence, ++depthCopyFenceValue) == S_OK &&
+            depthCopyFence->SetEventOnCompletion(depthCopyFenceValue, depthCopyFenceEvent) == S_OK)
+        {
+            WaitForSingleObject(depthCopyFenceEvent, 5000);
+        }
+
+        while (auto copy = (ID3D12Resource*) dlssgDepthCopies.Drain())
+            copy->Release();
+
+        if (depthCopyFence != nullptr)
+        {
+            depthCopyFence->Release();
+            depthCopyFence = nullptr;
+        }
+
+        if (depthCopyFenceEvent != nullptr)
+        {
+            CloseHandle(depthCopyFenceEvent);
+            depthCopyFenceEvent = nullptr;
+        }
+
+        depthCopyDevice = nullptr;
+        depthCopyFenceValue = 0;
+
+        return;
+    }
+
+    if (depthCopyFence == nullptr)
+        return;
+
+    // Without the swapchain's queue replaced copies are kept until shutdown
+    if (dlssgDepthCopies.NeedsSignal() && queue != nullptr &&
+        queue->Signal(depthCopyFence, depthCopyFenceValue + 1) == S_OK)
+    {
+        dlssgDepthCopies.Signaled(++depthCopyFenceValue);
+    }
+
+    auto completed = depthCopyFence->GetCompletedValue();
+
+    while (auto copy = (ID3D12Resource*) dlssgDepthCopies.Release(completed))
+        copy->Release();
+}
+
 static bool CreateBufferResource(LPCWSTR Name, ID3D12Device* InDevice, ID3D12Resource* InSource,
                                  D3D12_RESOURCE_STATES InState, ID3D12Resource** OutResource)
 {
@@ -207,6 +267,447 @@ static void UnhookAll()
 
 #pragma endregion
 
+#pragma region Warm Backend Switch
+
+// Backend change without hitch, new feature is created on a worker while current one keeps upscaling.
+// With Dx12WarmPreCreate the likely next feature is created before the change is requested.
+static FeatureWarmPool warmPool;
+static std::unique_ptr<IFeature_Dx12> warmFeature;
+static NVNGX_Parameters* warmParams = nullptr;
+static std::thread warmThread;
+static std::atomic<bool> warmThreadRunning = false;
+
+static ID3D12CommandQueue* warmQueue = nullptr;
+static ID3D12CommandAllocator* warmAllocator = nullptr;
+static ID3D12GraphicsCommandList* warmCommandList = nullptr;
+static ID3D12Fence* warmFence = nullptr;
+static HANDLE warmFenceEvent = nullptr;
+static UINT64 warmFenceValue = 0;
+
+// Feature whose init work didn't finish in time, released after warmFence reaches its value
+static std::unique_ptr<IFeature_Dx12> warmTimedOut;
+
+// Replaced features are released after frames in flight can't use them anymore. After RetireDelay evaluates
+// command lists recorded with them are submitted, then a fence is signaled on the game's queue and feature
+// is released when the fence is reached.
+constexpr int RetireDelay = 8;
+
+struct RetiredFeature
+{
+    int Delay = RetireDelay;
+    UINT64 FenceValue = 0;
+    std::unique_ptr<IFeature_Dx12> Feature;
+    ID3D12Fence* Fence = nullptr; // retireFence when signaled from the game's queue
+};
+
+static std::vector<RetiredFeature> retiredFeatures;
+static ID3D12Fence* retireFence = nullptr;
+static UINT64 retireFenceValue = 0;
+
+// DLSS Enabler backend index of the backend, -1 for DLSSD
+static int Dx12BackendChoice(const std::string& InBackend)
+{
+    // backend selection
+    // 0 : XeSS
+    // 1 : FSR2.2
+    // 2 : FSR2.1
+    // 3 : DLSS
+    // 4 : FSR3.1
+    if (InBackend == "fsr22")
+        return 1;
+
+    if (InBackend == "fsr21")
+        return 2;
+
+    if (InBackend == "dlss")
+        return 3;
+
+    if (InBackend == "dlssd")
+        return -1;
+
+    if (InBackend == "fsr31")
+        return 4;
+
+    return 0;
+}
+
+static std::unique_ptr<IFeature_Dx12> CreateDx12Feature(const std::string& InBackend, unsigned int InHandleId,
+                                                        NVSDK_NGX_Parameter* InParameters)
+{
+    switch (Dx12BackendChoice(InBackend))
+    {
+    case 1:
+        LOG_INFO("creating new FSR 2.2.1 feature");
+        return std::make_unique<FSR2FeatureDx12>(InHandleId, InParameters);
+
+    case 2:
+        LOG_INFO("creating new FSR 2.1.2 feature");
+        return std::make_unique<FSR2FeatureDx12_212>(InHandleId, InParameters);
+
+    case 3:
+        LOG_INFO("creating new DLSS feature");
+        return std::make_unique<DLSSFeatureDx12>(InHandleId, InParameters);
+
+    case -1:
+        LOG_INFO("creating new DLSSD feature");
+        return std::make_unique<DLSSDFeatureDx12>(InHandleId, InParameters);
+
+    case 4:
+        LOG_INFO("creating new FSR 3.X feature");
+        return std::make_unique<FSR31FeatureDx12>(InHandleId, InParameters);
+
+    default:
+        LOG_INFO("creating new XeSS feature");
+        return std::make_unique<XeSSFeatureDx12>(InHandleId, InParameters);
+    }
+}
+
+static bool CreateWarmObjects()
+{
+    if (warmQueue != nullptr)
+        return true;
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    auto result = D3D12Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&warmQueue));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommandQueue: {:X}", (UINT) result);
+        return false;
+    }
+
+    warmQueue->SetName(L"WarmFeatureQueue");
+
+    result = D3D12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&warmAllocator));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommandAllocator: {:X}", (UINT) result);
+        return false;
+    }
+
+    result = D3D12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, warmAllocator, nullptr,
+                                            IID_PPV_ARGS(&warmCommandList));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommandList: {:X}", (UINT) result);
+        return false;
+    }
+
+    warmCommandList->SetName(L"WarmFeatureCommandList");
+    warmCommandList->Close();
+
+    result = D3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&warmFence));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateFence: {:X}", (UINT) result);
+        return false;
+    }
+
+    result = D3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&retireFence));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateFence: {:X}", (UINT) result);
+        return false;
+    }
+
+    warmFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+    return true;
+}
+
+// Render size of the key is the max render size, dynamic resolution stays below display size
+// unless limits are extended
+static FeatureWarmPool::Key WarmKey(const std::string& InBackend, IFeature_Dx12* InFeature)
+{
+    auto extended = Config::Instance()->ExtendedLimits.value_or_default();
+
+    return { InBackend,
+             extended ? std::max(InFeature->RenderWidth(), InFeature->DisplayWidth()) : InFeature->DisplayWidth(),
+             extended ? std::max(InFeature->RenderHeight(), InFeature->DisplayHeight()) : InFeature->DisplayHeight(),
+             InFeature->DisplayWidth(),
+             InFeature->DisplayHeight(),
+             (uint32_t) InFeature->PerfQualityValue(),
+             InFeature->GetFeatureFlags() };
+}
+
+static void WarmFeatureWorker(unsigned int InHandleId)
+{
+    // Feature init toggles skipSpoofing and skipHeapCapture, keep the toggles of game threads intact
+    State::WarmCreationScope warmScope;
+
+    FeatureWarmPool::Key key;
+    if (!warmPool.BeginCreate(key))
+    {
+        warmThreadRunning = false;
+        return;
+    }
+
+    // Allocator can't be reset while init work of a timed out feature is still running
+    auto feature = CreateDx12Feature(key.Backend, InHandleId, warmParams);
+    auto result = feature->ModuleLoaded() && warmFence->GetCompletedValue() >= warmFenceValue &&
+                  warmAllocator->Reset() == S_OK && warmCommandList->Reset(warmAllocator, nullptr) == S_OK;
+
+    if (result)
+    {
+        // Config is changed on game thread when the feature is taken
+        feature->DeferConfig();
+        result = feature->Init(D3D12Device, warmCommandList, warmParams);
+
+        // Wait for init work so feature can be used from game's queue
+        warmCommandList->Close();
+        ID3D12CommandList* lists[] = { warmCommandList };
+        warmQueue->ExecuteCommandLists(1, lists);
+        warmQueue->Signal(warmFence, ++warmFenceValue);
+
+        if (warmFence->SetEventOnCompletion(warmFenceValue, warmFenceEvent) != S_OK ||
+            WaitForSingleObject(warmFenceEvent, 5000) != WAIT_OBJECT_0)
+        {
+            LOG_ERROR("{} feature init work didn't finish", key.Backend);
+            warmTimedOut = std::move(feature);
+            result = false;
+        }
+    }
+
+    LOG_INFO("{} feature warm up result: {}", key.Backend, result);
+
+    if (result)
+        warmFeature = std::move(feature);
+
+    warmPool.Created(result);
+    warmThreadRunning = false;
+}
+
+// Joins the worker when it's done or InWait is set. Thread must not stay joinable,
+// static destruction of a joinable std::thread calls std::terminate.
+static void JoinWarmWorker(bool InWait)
+{
+    if (!warmThread.joinable() || (!InWait && warmThreadRunning))
+        return;
+
+    warmThread.join();
+
+    if (warmTimedOut != nullptr)
+        retiredFeatures.push_back({ 0, warmFenceValue, std::move(warmTimedOut), warmFence });
+}
+
+static void StartWarmWorker(unsigned int InHandleId, const FeatureWarmPool::Key& InKey)
+{
+    JoinWarmWorker(true);
+
+    delete warmParams;
+
+    warmParams = GetNGXParameters("OptiDx12");
+    warmParams->Set(NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, InKey.Flags);
+    warmParams->Set(NVSDK_NGX_Parameter_Width, InKey.RenderWidth);
+    warmParams->Set(NVSDK_NGX_Parameter_Height, InKey.RenderHeight);
+    warmParams->Set(NVSDK_NGX_Parameter_OutWidth, InKey.DisplayWidth);
+    warmParams->Set(NVSDK_NGX_Parameter_OutHeight, InKey.DisplayHeight);
+    warmParams->Set(NVSDK_NGX_Parameter_PerfQualityValue, (NVSDK_NGX_PerfQuality_Value) InKey.PerfQuality);
+
+    LOG_INFO("creating {0} feature for {1}x{2} in background", InKey.Backend, InKey.DisplayWidth,
+             InKey.DisplayHeight);
+    warmThreadRunning = true;
+    warmThread = std::thread(WarmFeatureWorker, InHandleId);
+}
+
+// InWait blocks until the GPU is done with all retired features (shutdown)
+static void ReleaseRetiredFeatures(bool InWait = false)
+{
+    auto queue = State::Instance().currentCommandQueue;
+
+    for (size_t i = 0; i < retiredFeatures.size();)
+    {
+        auto& retired = retiredFeatures[i];
+
+        if (!InWait && retired.Delay > 0 && --retired.Delay > 0)
+        {
+            i++;
+            continue;
+        }
+
+        // Without the swapchain's queue only the delay protects the feature
+        if (retired.FenceValue == 0 && queue != nullptr && retireFence != nullptr &&
+            queue->Signal(retireFence, retireFenceValue + 1) == S_OK)
+        {
+            retired.Fence = retireFence;
+            retired.FenceValue = ++retireFenceValue;
+        }
+
+        if (retired.FenceValue != 0 && retired.Fence->GetCompletedValue() < retired.FenceValue)
+        {
+            if (!InWait)
+            {
+                i++;
+                continue;
+            }
+
+            if (retired.Fence->SetEventOnCompletion(retired.FenceValue, warmFenceEvent) == S_OK)
+                WaitForSingleObject(warmFenceEvent, 5000);
+        }
+
+        LOG_DEBUG("Releasing retired {} feature", retired.Feature->Name());
+        retiredFeatures.erase(retiredFeatures.begin() + i);
+    }
+}
+
+// Games can exit without NGX shutdown, ShutdownWarmFeatures joins the worker otherwise. Joining here would deadlock
+// under the loader lock while the worker is creating a feature. On process exit the worker is already terminated,
+// detaching only keeps the static std::thread's destructor from calling std::terminate for a joinable thread.
+void DetachDx12WarmWorker()
+{
+    if (warmThread.joinable())
+        warmThread.detach();
+}
+
+static void ShutdownWarmFeatures()
+{
+    JoinWarmWorker(true);
+    ReleaseRetiredFeatures(true);
+
+    warmFeature.reset();
+    warmPool.Clear();
+
+    delete warmParams;
+    warmParams = nullptr;
+}
+
+// Returns true when current feature can keep upscaling while the new one is created or when it's swapped in.
+// When output resolution changed current feature can't be kept, only a ready feature is used.
+static bool WarmBackendChange(unsigned int InHandleId, ContextData<IFeature_Dx12>* InContext,
+                              NVSDK_NGX_Parameter* InParameters, bool InOutputChanged)
+{
+    auto& backend = State::Instance().newBackend;
+    auto dc = InContext->feature.get();
+
+    // DLSS features use game's parameters which can't be shared with a worker
+    if (!Config::Instance()->Dx12WarmBackendSwitch.value_or_default() || D3D12Device == nullptr || dc == nullptr ||
+        !dc->IsInited() || backend == "dlss" || backend == "dlssd")
+    {
+        // Don't keep an unused feature around
+        if (warmPool.State() == FeatureWarmPool::Ready)
+        {
+            warmFeature.reset();
+            warmPool.Clear();
+        }
+
+        return false;
+    }
+
+    if (!CreateWarmObjects())
+        return false;
+
+    auto key = WarmKey(backend, dc);
+
+    if (warmPool.Take(key))
+    {
+        JoinWarmWorker(true);
+
+        if (State::Instance().currentFG != nullptr && State::Instance().currentFG->IsActive())
+        {
+            State::Instance().currentFG->StopAndDestroyContext(false, false, false);
+            Hudfix_Dx12::ResetCounters();
+            State::Instance().FGchanged = true;
+        }
+
+        LOG_INFO("changing backend to warm {0} feature", backend);
+
+        retiredFeatures.push_back({ RetireDelay, 0, std::move(InContext->feature) });
+        InContext->feature = std::move(warmFeature);
+        InContext->feature->ApplyDeferredConfig();
+
+        Config::Instance()->Dx12Upscaler = backend;
+        InParameters->Set("DLSSEnabler.Dx12Backend", Dx12BackendChoice(backend));
+
+        delete warmParams;
+        warmParams = nullptr;
+
+        State::Instance().newBackend = "";
+        State::Instance().changeBackend[InHandleId] = false;
+        State::Instance().currentFeature = InContext->feature.get();
+
+        if (State::Instance().currentFG != nullptr)
+            State::Instance().currentFG->UpdateTarget();
+
+        contextRendering = false;
+        evalCounter = 0;
+
+        return true;
+    }
+
+    if (InOutputChanged)
+        return false;
+
+    switch (warmPool.Request(key))
+    {
+    case FeatureWarmPool::Start:
+        StartWarmWorker(InHandleId, key);
+        return true;
+
+    case FeatureWarmPool::Discard:
+        // Created for an older request, it was never used on GPU
+        warmFeature.reset();
+        warmPool.Clear();
+        return true;
+
+    case FeatureWarmPool::Wait:
+        return true;
+
+    default:
+        LOG_WARN("background creation of {0} failed, changing backend synchronously", backend);
+        return false;
+    }
+}
+
+// Creates the likely next feature in background, so backend or output resolution change doesn't stall
+static void WarmPreCreate(unsigned int InHandleId, ContextData<IFeature_Dx12>* InContext)
+{
+    auto dc = InContext->feature.get();
+
+    if (!Config::Instance()->Dx12WarmBackendSwitch.value_or_default() ||
+        !Config::Instance()->Dx12WarmPreCreate.value_or_default() || D3D12Device == nullptr || dc == nullptr ||
+        !dc->IsInited() || dc->Name() == "DLSSD" || InContext->changeBackendCounter != 0 || !CreateWarmObjects())
+    {
+        return;
+    }
+
+    auto current = WarmKey(Config::Instance()->Dx12Upscaler.value_or_default(), dc);
+    warmPool.Observe(current);
+
+    FeatureWarmPool::Key next;
+
+    // DLSS features use game's parameters which can't be shared with a worker
+    if (!warmPool.Predict(current, State::Instance().newBackend, next) || next.Backend == "dlss" ||
+        next.Backend == "dlssd")
+    {
+        if (warmPool.State() == FeatureWarmPool::Ready)
+        {
+            warmFeature.reset();
+            warmPool.Clear();
+        }
+
+        return;
+    }
+
+    switch (warmPool.Request(next))
+    {
+    case FeatureWarmPool::Start:
+        StartWarmWorker(InHandleId, next);
+        break;
+
+    case FeatureWarmPool::Discard:
+        // Prediction changed, feature was never used on GPU
+        warmFeature.reset();
+        warmPool.Clear();
+        break;
+
+    default:
+        break;
+    }
+}
+
+#pragma endregion
+
 #pragma region DLSS Init Calls
 
 NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Init_Ext(unsigned long long InApplicationId,
@@ -468,6 +969,10 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Init_with_ProjectID(
 NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown(void)
 {
     shutdown = true;
+
+    ShutdownWarmFeatures();
+    ReleaseDepthCopies(true);
+
     State::Instance().NvngxDx12Inited = false;
 
     // if (Dx12Contexts.size() > 0)
@@ -517,6 +1022,10 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown(void)
 NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown1(ID3D12Device* InDevice)
 {
     shutdown = true;
+
+    ShutdownWarmFeatures();
+    ReleaseDepthCopies(true);
+
     State::Instance().NvngxDx12Inited = false;
 
     DLSSGMod::D3D12_Shutdown1(InDevice);
@@ -1117,39 +1626,83 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         if (Config::Instance()->MakeDepthCopy.value_or_default())
             InParameters->Get("DLSSG.Depth", &dlssgDepth);
 
-        if (dlssgDepth)
+        D3D12_HEAP_PROPERTIES heapProperties;
+        D3D12_HEAP_FLAGS heapFlags;
+
+        if (dlssgDepth && dlssgDepth->GetHeapProperties(&heapProperties, &heapFlags) != S_OK)
         {
-            D3D12_RESOURCE_DESC desc = dlssgDepth->GetDesc();
+            LOG_ERROR("Getting heap properties has failed");
+            dlssgDepth = nullptr;
+        }
 
-            D3D12_HEAP_PROPERTIES heapProperties;
-            D3D12_HEAP_FLAGS heapFlags;
+        if (dlssgDepth && depthCopyDevice != D3D12Device)
+        {
+            ReleaseDepthCopies(true);
 
-            static ID3D12Resource* copiedDlssgDepth = nullptr;
-            if (copiedDlssgDepth != nullptr)
+            if (D3D12Device != nullptr &&
+                D3D12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&depthCopyFence)) == S_OK)
             {
-                copiedDlssgDepth->Release();
-                copiedDlssgDepth = nullptr;
+                depthCopyDevice = D3D12Device;
+                depthCopyFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
             }
+            else
+            {
+                LOG_ERROR("Can't create DLSSG depth copy fence");
+                dlssgDepth = nullptr;
+            }
+        }
+
+        if (dlssgDepth)
+        {
+            D3D12_RESOURCE_DESC desc = dlssgDepth->GetDesc();
 
-            if (dlssgDepth->GetHeapProperties(&heapProperties, &heapFlags) == S_OK)
+            DepthCopyRing::Key key { (uint64_t) D3D12Device,
+                                     desc.Width,
+                                     desc.Height,
+                                     desc.DepthOrArraySize,
+                                     desc.MipLevels,
+                                     (uint32_t) desc.Format,
+                                     desc.SampleDesc.Count,
+                                     (uint32_t) desc.Flags,
+                                     (uint32_t) heapProperties.Type };
+
+            if (dlssgDepthCopies.Acquire(key) == DepthCopyRing::Create)
             {
+                ID3D12Resource* copy = nullptr;
                 auto result = D3D12Device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &desc,
                                                                    D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
-                                                                   IID_PPV_ARGS(&copiedDlssgDepth));
+                                                                   IID_PPV_ARGS(&copy));
+
                 if (result == S_OK)
                 {
-                    InCmdList->CopyResource(copiedDlssgDepth, dlssgDepth);
-                    InParameters->Set("DLSSG.Depth",
-                                      (void*) copiedDlssgDepth); // cast to make sure it's void*, otherwise dlssg cries
+                    copy->SetName(L"DLSSG Depth Copy");
+                    LOG_DEBUG("Created DLSSG depth copy for slot {}, {}x{}", dlssgDepthCopies.CurrentSlot(),
+                              desc.Width, desc.Height);
                 }
                 else
                 {
-                    LOG_ERROR("Making a new resource for DLSSG Depth has failed");
+                    LOG_ERROR("Making a new resource for DLSSG Depth has failed: {:X}", (UINT) result);
+                    copy = nullptr;
                 }
+
+                dlssgDepthCopies.Created(copy, D3D12_RESOURCE_STATE_GENERIC_READ);
             }
-            else
+
+            ReleaseDepthCopies(false);
+
+            if (auto copy = (ID3D12Resource*) dlssgDepthCopies.Current(); copy != nullptr)
             {
-                LOG_ERROR("Getting heap properties has failed");
+                auto state = (D3D12_RESOURCE_STATES) dlssgDepthCopies.CurrentState();
+
+                if (state != D3D12_RESOURCE_STATE_COPY_DEST)
+                    ResourceBarrier(InCmdList, copy, state, D3D12_RESOURCE_STATE_COPY_DEST);
+
+                InCmdList->CopyResource(copy, dlssgDepth);
+
+                ResourceBarrier(InCmdList, copy, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_GENERIC_READ);
+                dlssgDepthCopies.SetCurrentState(D3D12_RESOURCE_STATE_GENERIC_READ);
+
+                InParameters->Set("DLSSG.Depth", (void*) copy); // cast to make sure it's void*, otherwise dlssg cries
             }
         }
 
@@ -1248,6 +1801,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         }
     }
 
+    auto outputChanged = false;
+
     if (deviceContext->feature)
     {
         auto* feature = deviceContext->feature.get();
@@ -1255,16 +1810,31 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         // FSR 3.1 supports upscaleSize that doesn't need reinit to change output resolution
         if (!(feature->Name().starts_with("FSR") && isVersionOrBetter(feature->Version(), { 3, 1, 0 })) &&
             feature->UpdateOutputResolution(InParameters))
+        {
             State::Instance().changeBackend[handleId] = true;
+            outputChanged = true;
+        }
     }
 
+    JoinWarmWorker(false);
+    ReleaseRetiredFeatures();
+
     // Change backend
     if (State::Instance().changeBackend[handleId])
     {
         if (State::Instance().newBackend == "" ||
             (!Config::Instance()->DLSSEnabled.value_or_default() && State::Instance().newBackend == "dlss"))
             State::Instance().newBackend = Config::Instance()->Dx12Upscaler.value_or_default();
+    }
 
+    // Current feature keeps upscaling until new one is ready
+    if (State::Instance().changeBackend[handleId] && deviceContext->changeBackendCounter == 0 &&
+        WarmBackendChange(handleId, deviceContext, InParameters, outputChanged))
+    {
+        LOG_DEBUG("Using {} while changing backend", deviceContext->feature->Name());
+    }
+    else if (State::Instance().changeBackend[handleId])
+    {
         deviceContext->changeBackendCounter++;
 
         LOG_INFO("changeBackend is true, counter: {0}", deviceContext->changeBackendCounter);
@@ -1341,58 +1911,18 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         // create new feature
         if (deviceContext->changeBackendCounter == 2)
         {
-            // backend selection
-            // 0 : XeSS
-            // 1 : FSR2.2
-            // 2 : FSR2.1
-            // 3 : DLSS
-            // 4 : FSR3.1
-            int upscalerChoice = -1;
+            auto& backend = State::Instance().newBackend;
+            int upscalerChoice = Dx12BackendChoice(backend);
 
             // prepare new upscaler
-            if (State::Instance().newBackend == "fsr22")
-            {
-                Config::Instance()->Dx12Upscaler = "fsr22";
-                LOG_INFO("creating new FSR 2.2.1 feature");
-                deviceContext->feature = std::make_unique<FSR2FeatureDx12>(handleId, deviceContext->createParams);
-                upscalerChoice = 1;
-            }
-            else if (State::Instance().newBackend == "fsr21")
-            {
-                Config::Instance()->Dx12Upscaler = "fsr21";
-                LOG_INFO("creating new FSR 2.1.2 feature");
-                deviceContext->feature = std::make_unique<FSR2FeatureDx12_212>(handleId, deviceContext->createParams);
-                upscalerChoice = 2;
-            }
-            else if (State::Instance().newBackend == "dlss")
-            {
-                Config::Instance()->Dx12Upscaler = "dlss";
-                LOG_INFO("creating new DLSS feature");
-                deviceContext->feature = std::make_unique<DLSSFeatureDx12>(handleId, deviceContext->createParams);
-                upscalerChoice = 3;
-            }
-            else if (State::Instance().newBackend == "dlssd")
-            {
-                LOG_INFO("creating new DLSSD feature");
-                deviceContext->feature = std::make_unique<DLSSDFeatureDx12>(handleId, deviceContext->createParams);
-            }
-            else if (State::Instance().newBackend == "fsr31")
-            {
-                Config::Instance()->Dx12Upscaler = "fsr31";
-                LOG_INFO("creating new FSR 3.X feature");
-                deviceContext->feature = std::make_unique<FSR31FeatureDx12>(handleId, deviceContext->createParams);
-                upscalerChoice = 4;
-            }
-            else
-            {
-                Config::Instance()->Dx12Upscaler = "xess";
-                LOG_INFO("creating new XeSS feature");
-                deviceContext->feature = std::make_unique<XeSSFeatureDx12>(handleId, deviceContext->createParams);
-                upscalerChoice = 0;
-            }
+            deviceContext->feature = CreateDx12Feature(backend, handleId, deviceContext->createParams);
 
             if (upscalerChoice >= 0)
+            {
+                const char* backendNames[] = { "xess", "fsr22", "fsr21", "dlss", "fsr31" };
+                Config::Instance()->Dx12Upscaler = backendNames[upscalerChoice];
                 InParameters->Set("DLSSEnabler.Dx12Backend", upscalerChoice);
+            }
 
             return NVSDK_NGX_Result_Success;
         }
@@ -1456,6 +1986,10 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
 
         // return NVSDK_NGX_Result_Success;
     }
+    else
+    {
+        WarmPreCreate(handleId, deviceContext);
+    }
 
     // if (deviceContext == nullptr)
     //{
@@ -1518,13 +2052,14 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
 
     State::Instance().SCchanged = false;
 
+    // Read once for FG and the upscaler
+    auto& inputs = deviceContext->feature->ReadInputs(InParameters, EvaluateInputs::Dx12);
+
     // FSR Camera values
     float cameraNear = 0.0f;
     float cameraFar = 0.0f;
     float cameraVFov = 0.0f;
     float meterFactor = 0.0f;
-    float mvScaleX = 0.0f;
-    float mvScaleY = 0.0f;
 
     {
         if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
@@ -1565,29 +2100,21 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
         State::Instance().lastFsrCameraFar = cameraFar;
         State::Instance().lastFsrCameraNear = cameraNear;
 
-        int reset = 0;
-        InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &mvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &mvScaleY);
-
         if (fg != nullptr)
         {
             fg->UpscaleStart();
 
             fg->SetCameraValues(cameraNear, cameraFar, cameraVFov, meterFactor);
             fg->SetFrameTimeDelta(State::Instance().lastFrameTime);
-            fg->SetMVScale(mvScaleX, mvScaleY);
-            fg->SetReset(reset);
+            fg->SetMVScale(inputs.HasMVScale ? inputs.MVScaleX : 0.0f, inputs.HasMVScale ? inputs.MVScaleY : 0.0f);
+            fg->SetReset(inputs.Reset);
 
             Hudfix_Dx12::UpscaleStart();
         }
     }
 
     // FG Prepare
-    ID3D12Resource* output = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &output) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &output);
+    auto output = (ID3D12Resource*) inputs.Output;
 
     UINT frameIndex;
     if (fg != nullptr && fg->IsActive() && State::Instance().activeFgType == OptiFG &&
@@ -1602,15 +2129,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
             fg->Mutex.unlockThis(4);
         }
 
-        bool allocatorReset = false;
         frameIndex = fg->GetIndex();
 
-#ifdef USE_QUEUE_FOR_FG
-        auto allocator = FrameGen_Dx12::fgCommandAllocators[frameIndex];
-        auto result = allocator->Reset();
-        result = FrameGen_Dx12::fgCommandList[frameIndex]->Reset(allocator, nullptr);
-        allocatorReset = true;
-#endif
         ID3D12GraphicsCommandList* commandList = nullptr;
 
 #ifdef USE_COPY_QUEUE_FOR_FG
@@ -1624,18 +2144,14 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
 
         LOG_DEBUG("(FG) copy buffers for fgUpscaledImage[{}], frame: {}", frameIndex, fg->FrameCount());
 
-        ID3D12Resource* paramVelocity = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+        auto paramVelocity = (ID3D12Resource*) inputs.MotionVectors;
 
         if (paramVelocity != nullptr)
             fg->SetVelocity(commandList, paramVelocity,
                             (D3D12_RESOURCE_STATES) Config::Instance()->MVResourceBarrier.value_or(
                                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE));
 
-        ID3D12Resource* paramDepth = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+        auto paramDepth = (ID3D12Resource*) inputs.Depth;
 
         if (paramDepth != nullptr)
         {
@@ -1668,6 +2184,10 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
                                  D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE));
         }
 
+        // Velocity & depth copies share one barrier batch, failed ones leave the params on the originals
+        if (!fg->ExecuteInputs(commandList))
+            LOG_WARN("(FG) recording input copies failed");
+
 #ifdef USE_COPY_QUEUE_FOR_FG
         auto result = FrameGen_Dx12::fgCopyCommandList[frameIndex]->Close();
         ID3D12CommandList* cl[] = { nullptr };
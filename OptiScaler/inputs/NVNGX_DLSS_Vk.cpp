@@ -180,10 +180,23 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_Init_Ext2(
     VkQueryPoolCreateInfo queryPoolInfo = {};
     queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
     queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
-    queryPoolInfo.queryCount = 2; // Start and End timestamps
+    queryPoolInfo.queryCount = HooksVk::queryRing.QueryCount(); // Start and End timestamps for each frame & pass
+
+    HooksVk::queryRing.Reset();
+    HooksVk::queryDevice = InDevice;
+    HooksVk::resetQueryPool = nullptr;
+
+    if (HooksVk::HostQueryResetEnabled(InDevice))
+        HooksVk::resetQueryPool = (PFN_vkResetQueryPool) vkGetDeviceProcAddr(InDevice, "vkResetQueryPool");
 
     vkCreateQueryPool(InDevice, &queryPoolInfo, nullptr, &HooksVk::queryPool);
 
+    // Queries must be reset before first use, later they are reset after they are read
+    if (HooksVk::queryPool != VK_NULL_HANDLE && HooksVk::resetQueryPool != nullptr)
+        HooksVk::resetQueryPool(InDevice, HooksVk::queryPool, 0, queryPoolInfo.queryCount);
+
+    LOG_DEBUG("Timestamp queries reset from host: {}", HooksVk::resetQueryPool != nullptr);
+
     VkPhysicalDeviceProperties deviceProperties;
     vkGetPhysicalDeviceProperties(InPD, &deviceProperties);
     HooksVk::timeStampPeriod = deviceProperties.limits.timestampPeriod;
@@ -1211,14 +1224,29 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
         return NVSDK_NGX_Result_Success;
     }
 
-    // Record the first timestamp (before FSR2)
-    vkCmdWriteTimestamp(InCmdList, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, HooksVk::queryPool, 0);
+    // Read once for the upscaler
+    deviceContext->ReadInputs(InParameters, EvaluateInputs::Vulkan);
+
+    auto query = TimestampRing::InvalidQuery;
+
+    // Record the first timestamp (before upscaling)
+    if (HooksVk::queryPool != VK_NULL_HANDLE)
+        query = HooksVk::queryRing.BeginPass(HooksVk::UpscalerPass);
+
+    if (query != TimestampRing::InvalidQuery)
+    {
+        // Without host query reset old results stay available until this reset runs, ring skips them
+        if (HooksVk::resetQueryPool == nullptr)
+            vkCmdResetQueryPool(InCmdList, HooksVk::queryPool, query, 2);
+
+        vkCmdWriteTimestamp(InCmdList, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, HooksVk::queryPool, query);
+    }
 
     auto upscaleResult = deviceContext->Evaluate(InCmdList, InParameters);
 
-    // Record the second timestamp (after FSR2)
-    vkCmdWriteTimestamp(InCmdList, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, HooksVk::queryPool, 1);
-    HooksVk::vkUpscaleTrig = true;
+    // Record the second timestamp (after upscaling)
+    if (query != TimestampRing::InvalidQuery)
+        vkCmdWriteTimestamp(InCmdList, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, HooksVk::queryPool, query + 1);
 
     return upscaleResult ? NVSDK_NGX_Result_Success : NVSDK_NGX_Result_Fail;
 }
@@ -0,0 +1,481 @@
+#include "FontAtlasCache.h"
+
+#include <imgui/imgui_internal.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+FontAtlasCache::~FontAtlasCache()
+{
+    if (_active == this)
+        _active = nullptr;
+
+    Unmap();
+}
+
+void FontAtlasCache::Unmap()
+{
+    if (_mapped != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(_mapped);
+        CloseHandle((HANDLE) _mapping);
+        CloseHandle((HANDLE) _file);
+#else
+        munmap((void*) _mapped, _mappedSize);
+#endif
+    }
+
+    _mapped = nullptr;
+    _mappedSize = 0;
+    _file = nullptr;
+    _mapping = nullptr;
+    _mappedGlyphs = nullptr;
+    _mappedPixels = nullptr;
+    _mappedCount = 0;
+}
+
+bool FontAtlasCache::Load(const fs::path& InPath)
+{
+    Unmap();
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+#ifdef _WIN32
+    auto file = CreateFileW(InPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize {};
+    HANDLE mapping = nullptr;
+
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= (LONGLONG) sizeof(Header))
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping != nullptr)
+        data = (const uint8_t*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (data == nullptr)
+    {
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+
+        CloseHandle(file);
+        return false;
+    }
+
+    size = (size_t) fileSize.QuadPart;
+    _file = file;
+    _mapping = mapping;
+#else
+    auto file = open(InPath.c_str(), O_RDONLY);
+
+    if (file < 0)
+        return false;
+
+    struct stat fileStat {};
+
+    if (fstat(file, &fileStat) == 0 && fileStat.st_size >= (off_t) sizeof(Header))
+    {
+        auto mapped = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (mapped != MAP_FAILED)
+        {
+            data = (const uint8_t*) mapped;
+            size = (size_t) fileStat.st_size;
+        }
+    }
+
+    close(file);
+
+    if (data == nullptr)
+        return false;
+#endif
+
+    _mapped = data;
+    _mappedSize = size;
+
+    if (!Parse(data, size, &_mappedGlyphs, &_mappedPixels, &_mappedCount))
+    {
+        Unmap();
+        return false;
+    }
+
+    return true;
+}
+
+bool FontAtlasCache::LoadBaked(const uint8_t* InData, size_t InSize)
+{
+    _bakedGlyphs = nullptr;
+    _bakedPixels = nullptr;
+    _bakedCount = 0;
+
+    if (InData == nullptr || ((uintptr_t) InData % alignof(Glyph)) != 0)
+        return false;
+
+    return Parse(InData, InSize, &_bakedGlyphs, &_bakedPixels, &_bakedCount);
+}
+
+bool FontAtlasCache::Parse(const uint8_t* InData, size_t InSize, const Glyph** OutGlyphs, const uint8_t** OutPixels,
+                           uint32_t* OutCount)
+{
+    if (InSize < sizeof(Header))
+        return false;
+
+    Header header;
+    memcpy(&header, InData, sizeof(header));
+
+    auto glyphBytes = (uint64_t) header.GlyphCount * sizeof(Glyph);
+
+    if (header.Magic != Magic || header.Version != Version || header.ImGuiVersion != IMGUI_VERSION_NUM ||
+        header.GlyphCount > MaxGlyphs || sizeof(Header) + glyphBytes + header.PixelBytes != InSize)
+    {
+        return false;
+    }
+
+    auto glyphs = (const Glyph*) (InData + sizeof(Header));
+    auto pixels = InData + sizeof(Header) + glyphBytes;
+
+    for (uint32_t i = 0; i < header.GlyphCount; i++)
+    {
+        auto& glyph = glyphs[i];
+
+        if ((uint64_t) glyph.PixelOffset + glyph.Width * glyph.Height > header.PixelBytes)
+            return false;
+
+        if (i > 0 && std::make_pair(glyphs[i - 1].Key, glyphs[i - 1].Codepoint) >=
+                         std::make_pair(glyph.Key, glyph.Codepoint))
+        {
+            return false;
+        }
+    }
+
+    *OutGlyphs = glyphs;
+    *OutPixels = pixels;
+    *OutCount = header.GlyphCount;
+
+    return true;
+}
+
+bool FontAtlasCache::Save(const fs::path& InPath)
+{
+    if (!Dirty())
+        return true;
+
+    // Merge mapped and added glyphs in key order
+    std::vector<Entry> entries;
+    entries.reserve(GlyphCount());
+
+    for (uint32_t i = 0; i < _mappedCount; i++)
+        entries.push_back({ &_mappedGlyphs[i], _mappedPixels + _mappedGlyphs[i].PixelOffset });
+
+    for (auto& glyph : _added)
+        entries.push_back({ &glyph, _addedPixels.data() + glyph.PixelOffset });
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b)
+              {
+                  return std::make_pair(a.Info->Key, a.Info->Codepoint) <
+                         std::make_pair(b.Info->Key, b.Info->Codepoint);
+              });
+
+    std::vector<Glyph> glyphs;
+    std::vector<uint8_t> pixels;
+    glyphs.reserve(entries.size());
+
+    for (auto& entry : entries)
+    {
+        auto glyph = *entry.Info;
+        glyph.PixelOffset = (uint32_t) pixels.size();
+        pixels.insert(pixels.end(), entry.Pixels, entry.Pixels + glyph.Width * glyph.Height);
+        glyphs.push_back(glyph);
+    }
+
+    Header header { Magic, Version, IMGUI_VERSION_NUM, (uint32_t) glyphs.size(), pixels.size() };
+
+    auto tempPath = InPath;
+    tempPath += ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!file)
+            return false;
+
+        file.write((const char*) &header, sizeof(header));
+        file.write((const char*) glyphs.data(), glyphs.size() * sizeof(Glyph));
+        file.write((const char*) pixels.data(), pixels.size());
+
+        if (!file)
+        {
+            file.close();
+            std::error_code ec;
+            fs::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    // Mapping must be closed before the file can be replaced
+    Unmap();
+
+    std::error_code ec;
+    fs::rename(tempPath, InPath, ec);
+
+    if (ec)
+    {
+        fs::remove(tempPath, ec);
+
+        // Old mapping is gone, keep merged glyphs in memory so they can be saved later
+        _added = std::move(glyphs);
+        _addedPixels = std::move(pixels);
+        _addedIndex.clear();
+
+        for (size_t i = 0; i < _added.size(); i++)
+            _addedIndex[{ _added[i].Key, _added[i].Codepoint }] = i;
+
+        return false;
+    }
+
+    _added.clear();
+    _addedPixels.clear();
+    _addedIndex.clear();
+
+    return Load(InPath);
+}
+
+FontAtlasCache::Entry FontAtlasCache::FindIn(const Glyph* InGlyphs, const uint8_t* InPixels, uint32_t InCount,
+                                             uint64_t InKey, uint32_t InCodepoint)
+{
+    auto key = std::make_pair(InKey, InCodepoint);
+
+    auto end = InGlyphs + InCount;
+    auto it = std::lower_bound(InGlyphs, end, key, [](const Glyph& glyph, const std::pair<uint64_t, uint32_t>& k)
+                               { return std::make_pair(glyph.Key, glyph.Codepoint) < k; });
+
+    if (it != end && it->Key == InKey && it->Codepoint == InCodepoint)
+        return { it, InPixels + it->PixelOffset };
+
+    return {};
+}
+
+FontAtlasCache::Entry FontAtlasCache::Find(uint64_t InKey, uint32_t InCodepoint) const
+{
+    auto entry = FindIn(_mappedGlyphs, _mappedPixels, _mappedCount, InKey, InCodepoint);
+
+    if (entry.Info != nullptr)
+        return entry;
+
+    entry = FindIn(_bakedGlyphs, _bakedPixels, _bakedCount, InKey, InCodepoint);
+
+    if (entry.Info != nullptr)
+        return entry;
+
+    auto added = _addedIndex.find({ InKey, InCodepoint });
+
+    if (added != _addedIndex.end())
+    {
+        auto& glyph = _added[added->second];
+        return { &glyph, _addedPixels.data() + glyph.PixelOffset };
+    }
+
+    return {};
+}
+
+bool FontAtlasCache::Add(const Glyph& InGlyph, const uint8_t* InPixels)
+{
+    if (GlyphCount() >= MaxGlyphs || Find(InGlyph.Key, InGlyph.Codepoint).Info != nullptr)
+        return false;
+
+    auto glyph = InGlyph;
+    glyph.PixelOffset = (uint32_t) _addedPixels.size();
+
+    _addedPixels.insert(_addedPixels.end(), InPixels, InPixels + glyph.Width * glyph.Height);
+    _addedIndex[{ glyph.Key, glyph.Codepoint }] = _added.size();
+    _added.push_back(glyph);
+
+    return true;
+}
+
+uint64_t FontAtlasCache::HashData(const void* InData, size_t InSize)
+{
+    // FNV-1a
+    auto bytes = (const uint8_t*) InData;
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (size_t i = 0; i < InSize; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+
+    return hash;
+}
+
+uint64_t FontAtlasCache::GlyphKey(ImFontConfig* InSrc, ImFontBaked* InBaked, uint64_t InFontHash)
+{
+    int oversampleH, oversampleV;
+    ImFontAtlasBuildGetOversampleFactors(InSrc, InBaked, &oversampleH, &oversampleV);
+
+    const float values[] = {
+        InBaked->Size,
+        InSrc->RasterizerDensity * InBaked->RasterizerDensity,
+        InSrc->SizePixels,
+        InBaked->ContainerFont->Sources[0]->SizePixels,
+        InSrc->GlyphOffset.x,
+        InSrc->GlyphOffset.y,
+        (float) oversampleH,
+        (float) oversampleV,
+        (float) InSrc->PixelSnapH,
+        (float) InSrc->PixelSnapV,
+        (float) InSrc->FontNo,
+        (float) InSrc->FontBuilderFlags,
+        (float) InBaked->ContainerFont->ContainerAtlas->FontBuilderFlags,
+    };
+
+    return InFontHash ^ HashData(values, sizeof(values));
+}
+
+bool FontAtlasCache::FontSrcInit(ImFontAtlas* InAtlas, ImFontConfig* InSrc)
+{
+    if (!_base->FontSrcInit(InAtlas, InSrc))
+        return false;
+
+    if (_active != nullptr)
+        _active->_fontHashes[InSrc] = HashData(InSrc->FontData, InSrc->FontDataSize);
+
+    return true;
+}
+
+void FontAtlasCache::FontSrcDestroy(ImFontAtlas* InAtlas, ImFontConfig* InSrc)
+{
+    if (_active != nullptr)
+        _active->_fontHashes.erase(InSrc);
+
+    _base->FontSrcDestroy(InAtlas, InSrc);
+}
+
+bool FontAtlasCache::FontBakedLoadGlyph(ImFontAtlas* InAtlas, ImFontConfig* InSrc, ImFontBaked* InBaked,
+                                        void* InLoaderData, ImWchar InCodepoint, ImFontGlyph* OutGlyph)
+{
+    auto cache = _active;
+
+    // Multiplied glyphs can't be read back from the atlas as they were rasterized
+    if (cache == nullptr || InSrc->RasterizerMultiply != 1.0f)
+        return _base->FontBakedLoadGlyph(InAtlas, InSrc, InBaked, InLoaderData, InCodepoint, OutGlyph);
+
+    auto fontHash = cache->_fontHashes.find(InSrc);
+
+    if (fontHash == cache->_fontHashes.end())
+        return _base->FontBakedLoadGlyph(InAtlas, InSrc, InBaked, InLoaderData, InCodepoint, OutGlyph);
+
+    auto key = GlyphKey(InSrc, InBaked, fontHash->second);
+    auto entry = cache->Find(key, InCodepoint);
+
+    if (entry.Info != nullptr)
+    {
+        cache->_hits++;
+
+        OutGlyph->Codepoint = InCodepoint;
+        OutGlyph->AdvanceX = entry.Info->AdvanceX;
+
+        if (entry.Info->Width == 0 || entry.Info->Height == 0)
+            return true;
+
+        auto packId = ImFontAtlasPackAddRect(InAtlas, entry.Info->Width, entry.Info->Height);
+
+        if (packId == ImFontAtlasRectId_Invalid)
+            return false;
+
+        auto rect = ImFontAtlasPackGetRect(InAtlas, packId);
+
+        OutGlyph->X0 = entry.Info->X0;
+        OutGlyph->Y0 = entry.Info->Y0;
+        OutGlyph->X1 = entry.Info->X1;
+        OutGlyph->Y1 = entry.Info->Y1;
+        OutGlyph->Visible = true;
+        OutGlyph->PackId = packId;
+        ImFontAtlasBakedSetFontGlyphBitmap(InAtlas, InBaked, InSrc, OutGlyph, rect, entry.Pixels,
+                                           ImTextureFormat_Alpha8, entry.Info->Width);
+        return true;
+    }
+
+    // Glyphs missing from the font are cheap to look up, they are not cached
+    if (!_base->FontBakedLoadGlyph(InAtlas, InSrc, InBaked, InLoaderData, InCodepoint, OutGlyph))
+        return false;
+
+    cache->_misses++;
+
+    Glyph glyph {};
+    glyph.Key = key;
+    glyph.Codepoint = InCodepoint;
+    glyph.AdvanceX = OutGlyph->AdvanceX;
+
+    // Color glyphs don't fit alpha8 cache
+    if (OutGlyph->Colored)
+        return true;
+
+    if (!OutGlyph->Visible)
+    {
+        cache->Add(glyph, nullptr);
+        return true;
+    }
+
+    // Read rasterized bitmap back from the atlas, alpha is the coverage for both formats
+    auto rect = ImFontAtlasPackGetRect(InAtlas, OutGlyph->PackId);
+    auto tex = InAtlas->TexData;
+
+    if (rect == nullptr || tex == nullptr || tex->Pixels == nullptr)
+        return true;
+
+    glyph.Width = rect->w;
+    glyph.Height = rect->h;
+    glyph.X0 = OutGlyph->X0;
+    glyph.Y0 = OutGlyph->Y0;
+    glyph.X1 = OutGlyph->X1;
+    glyph.Y1 = OutGlyph->Y1;
+
+    std::vector<uint8_t> pixels(rect->w * rect->h);
+    auto channel = tex->Format == ImTextureFormat_RGBA32 ? 3 : 0;
+
+    for (int y = 0; y < rect->h; y++)
+    {
+        auto row = tex->GetPixelsAt(rect->x, rect->y + y);
+
+        for (int x = 0; x < rect->w; x++)
+            pixels[y * rect->w + x] = row[x * tex->BytesPerPixel + channel];
+    }
+
+    cache->Add(glyph, pixels.data());
+    return true;
+}
+
+const ImFontLoader* FontAtlasCache::Loader(const ImFontLoader* InBase)
+{
+    static ImFontLoader loader;
+
+    if (_base != InBase)
+    {
+        _base = InBase;
+        loader = *InBase;
+        loader.Name = "OptiScaler font cache";
+        loader.LoaderInit = nullptr;
+        loader.LoaderShutdown = nullptr;
+        loader.FontSrcInit = FontSrcInit;
+        loader.FontSrcDestroy = FontSrcDestroy;
+        loader.FontBakedLoadGlyph = FontBakedLoadGlyph;
+    }
+
+    return &loader;
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <imgui/imgui.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Persistent cache of rasterized font glyphs for the menu.
+// Loader() wraps the font loader of the atlas (FreeType) and is set per font with ImFontConfig::FontLoader.
+// Glyphs are keyed by font data hash and everything that changes the rasterized bitmap (baked size, rasterizer
+// density, oversampling, glyph offset, snapping and loader flags). Hits are copied into the atlas without rasterizing,
+// misses are rasterized by the wrapped loader and added to the cache. Cache file is memory mapped by Load and
+// rewritten by Save when new glyphs were added.
+// Glyphs of the embedded font at common menu sizes are baked into the dll in the same format (menu/font/Hack_Baked.h)
+// and used by LoadBaked as a read only layer under the file, they are never written to the file.
+class FontAtlasCache
+{
+  public:
+    static constexpr uint32_t Magic = 0x4346534F; // OSFC
+    static constexpr uint32_t Version = 1;
+    static constexpr uint32_t MaxGlyphs = 16384;
+
+    struct Header
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t ImGuiVersion;
+        uint32_t GlyphCount;
+        uint64_t PixelBytes;
+    };
+
+    // Glyph entries are sorted by Key and Codepoint, alpha8 pixels follow them
+    struct Glyph
+    {
+        uint64_t Key;
+        uint32_t Codepoint;
+        uint16_t Width;
+        uint16_t Height;
+        float X0, Y0, X1, Y1;
+        float AdvanceX;
+        uint32_t PixelOffset;
+    };
+
+    struct Entry
+    {
+        const Glyph* Info = nullptr;
+        const uint8_t* Pixels = nullptr;
+    };
+
+  private:
+    // Memory mapped cache file
+    const uint8_t* _mapped = nullptr;
+    size_t _mappedSize = 0;
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+
+    const Glyph* _mappedGlyphs = nullptr;
+    const uint8_t* _mappedPixels = nullptr;
+    uint32_t _mappedCount = 0;
+
+    // Glyphs compiled into the dll
+    const Glyph* _bakedGlyphs = nullptr;
+    const uint8_t* _bakedPixels = nullptr;
+    uint32_t _bakedCount = 0;
+
+    // Glyphs rasterized in this session
+    std::vector<Glyph> _added;
+    std::vector<uint8_t> _addedPixels;
+    std::map<std::pair<uint64_t, uint32_t>, size_t> _addedIndex;
+
+    std::unordered_map<const ImFontConfig*, uint64_t> _fontHashes;
+
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+
+    inline static FontAtlasCache* _active = nullptr;
+    inline static const ImFontLoader* _base = nullptr;
+
+    void Unmap();
+
+    // Validates cache data, InData must be 8 byte aligned
+    static bool Parse(const uint8_t* InData, size_t InSize, const Glyph** OutGlyphs, const uint8_t** OutPixels,
+                      uint32_t* OutCount);
+    static Entry FindIn(const Glyph* InGlyphs, const uint8_t* InPixels, uint32_t InCount, uint64_t InKey,
+                        uint32_t InCodepoint);
+
+  public:
+    FontAtlasCache() = default;
+    FontAtlasCache(const FontAtlasCache&) = delete;
+    FontAtlasCache& operator=(const FontAtlasCache&) = delete;
+    ~FontAtlasCache();
+
+    // Maps cache file, invalid or outdated files are ignored
+    bool Load(const std::filesystem::path& InPath);
+
+    // Uses InData (cache file contents, 8 byte aligned) as baked glyphs, data must outlive the cache
+    bool LoadBaked(const uint8_t* InData, size_t InSize);
+
+    // Writes mapped and added glyphs to file when something was added, file is mapped again after writing.
+    // When the file can't be replaced all glyphs are kept in memory and the cache stays dirty.
+    bool Save(const std::filesystem::path& InPath);
+
+    Entry Find(uint64_t InKey, uint32_t InCodepoint) const;
+
+    // InPixels is alpha8 with InGlyph.Width pitch, PixelOffset is set by the cache
+    bool Add(const Glyph& InGlyph, const uint8_t* InPixels);
+
+    bool Dirty() const { return !_added.empty(); }
+    // Glyphs of the cache file, baked ones are not counted
+    uint32_t GlyphCount() const { return _mappedCount + (uint32_t) _added.size(); }
+    uint32_t BakedCount() const { return _bakedCount; }
+    uint64_t Hits() const { return _hits; }
+    uint64_t Misses() const { return _misses; }
+
+    // Loader() uses this cache, fonts using the loader must be destroyed before the cache
+    void Activate() { _active = this; }
+
+    // Wraps InBase (loader of the atlas), fonts of all atlases using the cache must share the same base
+    static const ImFontLoader* Loader(const ImFontLoader* InBase);
+    static uint64_t HashData(const void* InData, size_t InSize);
+    static uint64_t GlyphKey(ImFontConfig* InSrc, ImFontBaked* InBaked, uint64_t InFontHash);
+
+  private:
+    static bool FontSrcInit(ImFontAtlas* InAtlas, ImFontConfig* InSrc);
+    static void FontSrcDestroy(ImFontAtlas* InAtlas, ImFontConfig* InSrc);
+    static bool FontBakedLoadGlyph(ImFontAtlas* InAtlas, ImFontConfig* InSrc, ImFontBaked* InBaked, void* InLoaderData,
+                                   ImWchar InCodepoint, ImFontGlyph* OutGlyph);
+};
@@ -0,0 +1,39 @@
+#include "OverlayThrottle.h"
+
+#include <cmath>
+
+void OverlayThrottle::SetRate(uint32_t InRateHz) { _interval = InRateHz == 0 ? 0.0 : 1000.0 / InRateHz; }
+
+bool OverlayThrottle::ShouldUpdate(double InNow, const Snapshot& InSnapshot)
+{
+    auto update = !_valid || _interval <= 0.0 || InSnapshot.Layout != _last.Layout ||
+                  InNow - _lastUpdate >= _interval || InNow < _lastUpdate;
+
+    for (size_t i = 0; !update && i < MaxValues; i++)
+    {
+        auto last = _last.Values[i];
+        auto limit = _threshold * std::fmax(std::fabs(last), 1.0f);
+
+        // Written this way so NaN also causes an update
+        if (!(std::fabs(InSnapshot.Values[i] - last) <= limit))
+            update = true;
+    }
+
+    if (!update)
+    {
+        _skipped++;
+        return false;
+    }
+
+    _last = InSnapshot;
+    _lastUpdate = InNow;
+    _valid = true;
+    _updates++;
+
+    return true;
+}
+
+uint64_t OverlayThrottle::Combine(uint64_t InSeed, uint64_t InValue)
+{
+    return InSeed ^ (InValue + 0x9E3779B97F4A7C15ull + (InSeed << 6) + (InSeed >> 2));
+}
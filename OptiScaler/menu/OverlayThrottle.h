@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Decides when fps overlay needs to be rebuilt, otherwise draw data of last build can be submitted again.
+// Overlay is rebuilt when layout changes, a displayed value changes visibly compared to last build
+// or update interval is passed. Update rate of 0 rebuilds every frame.
+class OverlayThrottle
+{
+  public:
+    static constexpr size_t MaxValues = 4;
+
+    struct Snapshot
+    {
+        uint64_t Layout = 0;
+        std::array<float, MaxValues> Values {};
+    };
+
+  private:
+    double _interval = 0.0;
+    double _lastUpdate = 0.0;
+    float _threshold = 0.1f;
+
+    Snapshot _last;
+    bool _valid = false;
+
+    uint64_t _updates = 0;
+    uint64_t _skipped = 0;
+
+  public:
+    // 0 disables throttling
+    void SetRate(uint32_t InRateHz);
+
+    // Relative change of a value which is counted as visible
+    void SetThreshold(float InThreshold) { _threshold = InThreshold; }
+
+    // Returns true when overlay should be rebuilt, InNow is in milliseconds
+    bool ShouldUpdate(double InNow, const Snapshot& InSnapshot);
+
+    // Forces rebuild on next call (menu was drawn, device reset etc.)
+    void Invalidate() { _valid = false; }
+
+    uint64_t Updates() const { return _updates; }
+    uint64_t Skipped() const { return _skipped; }
+
+    static uint64_t Combine(uint64_t InSeed, uint64_t InValue);
+};
@@ -0,0 +1,211 @@
+#include "RetainedDrawData.h"
+
+#include <cstring>
+#include <initializer_list>
+
+static uint64_t Mix(uint64_t InSeed, uint64_t InValue)
+{
+    InSeed ^= InValue;
+    InSeed *= 0x100000001B3ull;
+    return InSeed ^ (InSeed >> 29);
+}
+
+static uint64_t MixBytes(uint64_t InSeed, const void* InData, size_t InSize)
+{
+    auto bytes = (const uint8_t*) InData;
+    uint64_t word = 0;
+
+    // Overlay has a few thousand vertices, hashing 8 bytes at a time keeps it well below the upload cost
+    for (; InSize >= sizeof(word); InSize -= sizeof(word), bytes += sizeof(word))
+    {
+        memcpy(&word, bytes, sizeof(word));
+        InSeed = Mix(InSeed, word);
+    }
+
+    word = 0;
+    memcpy(&word, bytes, InSize);
+    return Mix(InSeed, word ^ (uint64_t) InSize << 56);
+}
+
+static uint64_t MixFloats(uint64_t InSeed, std::initializer_list<float> InValues)
+{
+    for (auto value : InValues)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        InSeed = Mix(InSeed, bits);
+    }
+
+    return InSeed;
+}
+
+uint64_t RetainedDrawData::Hash(const ImDrawData* InDrawData)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    hash = MixFloats(hash, { InDrawData->DisplayPos.x, InDrawData->DisplayPos.y, InDrawData->DisplaySize.x,
+                             InDrawData->DisplaySize.y, InDrawData->FramebufferScale.x,
+                             InDrawData->FramebufferScale.y });
+
+    for (int n = 0; n < InDrawData->CmdListsCount; n++)
+    {
+        auto list = InDrawData->CmdLists[n];
+
+        hash = MixBytes(hash, list->VtxBuffer.Data, list->VtxBuffer.size_in_bytes());
+        hash = MixBytes(hash, list->IdxBuffer.Data, list->IdxBuffer.size_in_bytes());
+
+        for (const auto& cmd : list->CmdBuffer)
+        {
+            hash = MixFloats(hash, { cmd.ClipRect.x, cmd.ClipRect.y, cmd.ClipRect.z, cmd.ClipRect.w });
+            hash = Mix(hash, (uintptr_t) cmd.TexRef._TexData);
+            hash = Mix(hash, (uint64_t) cmd.TexRef._TexID);
+            hash = Mix(hash, (uint64_t) cmd.ElemCount << 32 | cmd.IdxOffset);
+            hash = Mix(hash, (uint64_t) cmd.VtxOffset);
+            hash = Mix(hash, (uintptr_t) cmd.UserCallback);
+        }
+    }
+
+    return hash;
+}
+
+void RetainedDrawData::CopyBuffers(const ImDrawData* InDrawData, ImDrawVert* OutVtx, ImDrawIdx* OutIdx)
+{
+    for (int n = 0; n < InDrawData->CmdListsCount; n++)
+    {
+        auto list = InDrawData->CmdLists[n];
+
+        memcpy(OutVtx, list->VtxBuffer.Data, list->VtxBuffer.size_in_bytes());
+        memcpy(OutIdx, list->IdxBuffer.Data, list->IdxBuffer.size_in_bytes());
+        OutVtx += list->VtxBuffer.Size;
+        OutIdx += list->IdxBuffer.Size;
+    }
+}
+
+void RetainedDrawData::Retain(const ImDrawData* InDrawData)
+{
+    _commands.clear();
+
+    uint32_t vtxOffset = 0;
+    uint32_t idxOffset = 0;
+
+    for (int n = 0; n < InDrawData->CmdListsCount; n++)
+    {
+        auto list = InDrawData->CmdLists[n];
+
+        for (const auto& cmd : list->CmdBuffer)
+        {
+            // Only ResetRenderState reaches here, replay callback sets the state it needs
+            if (cmd.UserCallback != nullptr || cmd.ElemCount == 0)
+                continue;
+
+            Command command;
+            command.ClipRect = cmd.ClipRect;
+            command.TexRef = cmd.TexRef;
+            command.ElemCount = cmd.ElemCount;
+            command.IdxOffset = cmd.IdxOffset + idxOffset;
+            command.VtxOffset = cmd.VtxOffset + vtxOffset;
+            _commands.push_back(command);
+        }
+
+        vtxOffset += list->VtxBuffer.Size;
+        idxOffset += list->IdxBuffer.Size;
+    }
+
+    _displayPos = InDrawData->DisplayPos;
+    _displaySize = InDrawData->DisplaySize;
+    _framebufferScale = InDrawData->FramebufferScale;
+    _vtxCount = (int) vtxOffset;
+    _idxCount = (int) idxOffset;
+}
+
+RetainedDrawData::UpdateResult RetainedDrawData::Update(const ImDrawData* InDrawData, int InFrameCount)
+{
+    for (int n = 0; n < InDrawData->CmdListsCount; n++)
+    {
+        for (const auto& cmd : InDrawData->CmdLists[n]->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+            {
+                _valid = false;
+                _source = nullptr;
+                return NotRetainable;
+            }
+        }
+    }
+
+    // Retained overlay frames return the same draw data without a new ImGui frame
+    if (_valid && InDrawData == _source && InFrameCount == _sourceFrame)
+    {
+        _replays++;
+        return Unchanged;
+    }
+
+    _source = InDrawData;
+    _sourceFrame = InFrameCount;
+
+    auto hash = Hash(InDrawData);
+
+    if (_valid && hash == _hash)
+    {
+        _replays++;
+        return Unchanged;
+    }
+
+    Retain(InDrawData);
+    _hash = hash;
+    _valid = true;
+    _uploads++;
+
+    return Changed;
+}
+
+ImDrawData* RetainedDrawData::Replay(ImDrawCallback InDraw, void* InRenderer)
+{
+    _context.Owner = this;
+    _context.Renderer = InRenderer;
+
+    _replayList.CmdBuffer.resize(1);
+    auto& cmd = _replayList.CmdBuffer[0];
+    cmd = ImDrawCmd();
+    cmd.UserCallback = InDraw;
+    cmd.UserCallbackData = &_context;
+
+    _replay.Valid = true;
+    _replay.CmdLists.resize(0);
+    _replay.CmdLists.push_back(&_replayList);
+    _replay.CmdListsCount = 1;
+    _replay.TotalVtxCount = 0;
+    _replay.TotalIdxCount = 0;
+    _replay.DisplayPos = _displayPos;
+    _replay.DisplaySize = _displaySize;
+    _replay.FramebufferScale = _framebufferScale;
+
+    // Backends update textures and keep per viewport buffers through these
+    _replay.OwnerViewport = _source != nullptr ? _source->OwnerViewport : nullptr;
+    _replay.Textures = _source != nullptr ? _source->Textures : nullptr;
+
+    return &_replay;
+}
+
+bool RetainedDrawData::CommandScissor(const Command& InCommand, Scissor& OutScissor) const
+{
+    auto width = _displaySize.x * _framebufferScale.x;
+    auto height = _displaySize.y * _framebufferScale.y;
+
+    auto minX = (InCommand.ClipRect.x - _displayPos.x) * _framebufferScale.x;
+    auto minY = (InCommand.ClipRect.y - _displayPos.y) * _framebufferScale.y;
+    auto maxX = (InCommand.ClipRect.z - _displayPos.x) * _framebufferScale.x;
+    auto maxY = (InCommand.ClipRect.w - _displayPos.y) * _framebufferScale.y;
+
+    // Clamped for Vulkan, which does not accept scissors outside of the framebuffer
+    minX = minX < 0.0f ? 0.0f : minX;
+    minY = minY < 0.0f ? 0.0f : minY;
+    maxX = maxX > width ? width : maxX;
+    maxY = maxY > height ? height : maxY;
+
+    if (maxX <= minX || maxY <= minY)
+        return false;
+
+    OutScissor = { (int32_t) minX, (int32_t) minY, (int32_t) maxX, (int32_t) maxY };
+    return true;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <imgui/imgui.h>
+
+#include <cstdint>
+#include <vector>
+
+// Keeps overlay draw data in renderer owned vertex/index buffers between frames.
+// Vendored ImGui backends upload vertices and indices on every RenderDrawData call. Renderers upload only when
+// Update reports a change and pass Replay() to the backend, which has no vertices and a single callback that draws
+// the retained commands from renderer's buffers after the backend has set up its render state.
+class RetainedDrawData
+{
+  public:
+    enum UpdateResult
+    {
+        Unchanged,     // Renderer's buffers are up to date
+        Changed,       // Renderer should upload the draw data with CopyBuffers
+        NotRetainable, // Draw data has user callbacks, render it with the backend
+    };
+
+    struct Command
+    {
+        ImVec4 ClipRect;
+        ImTextureRef TexRef; // Resolved when drawing, backend creates textures at the start of RenderDrawData
+        uint32_t ElemCount = 0;
+        uint32_t IdxOffset = 0; // Offsets into renderer's buffers
+        uint32_t VtxOffset = 0;
+    };
+
+    struct Scissor
+    {
+        int32_t X0, Y0, X1, Y1;
+    };
+
+    // UserCallbackData of the replay callback
+    struct Context
+    {
+        const RetainedDrawData* Owner = nullptr;
+        void* Renderer = nullptr;
+    };
+
+  private:
+    bool _valid = false;
+    uint64_t _hash = 0;
+    const ImDrawData* _source = nullptr;
+    int _sourceFrame = -1;
+
+    std::vector<Command> _commands;
+    ImVec2 _displayPos {};
+    ImVec2 _displaySize {};
+    ImVec2 _framebufferScale {};
+    int _vtxCount = 0;
+    int _idxCount = 0;
+
+    Context _context;
+    ImDrawList _replayList { nullptr };
+    ImDrawData _replay;
+
+    uint64_t _uploads = 0;
+    uint64_t _replays = 0;
+
+    void Retain(const ImDrawData* InDrawData);
+
+  public:
+    RetainedDrawData() = default;
+    RetainedDrawData(const RetainedDrawData&) = delete;
+    RetainedDrawData& operator=(const RetainedDrawData&) = delete;
+
+    // InFrameCount is ImGui::GetFrameCount(), draw data of a retained frame is not hashed again
+    UpdateResult Update(const ImDrawData* InDrawData, int InFrameCount);
+
+    // Draw data to pass to the backend, InDraw receives a Context through ImDrawCmd::UserCallbackData
+    ImDrawData* Replay(ImDrawCallback InDraw, void* InRenderer);
+
+    // Next Update reports a change, call when renderer's buffers are lost
+    void Invalidate() { _valid = false; }
+
+    // Scissor of command in framebuffer pixels, false when nothing is visible
+    bool CommandScissor(const Command& InCommand, Scissor& OutScissor) const;
+
+    const std::vector<Command>& Commands() const { return _commands; }
+    int VtxCount() const { return _vtxCount; }
+    int IdxCount() const { return _idxCount; }
+    uint64_t Uploads() const { return _uploads; }
+    uint64_t Replays() const { return _replays; }
+
+    // Writes vertices and indices of all lists contiguously, same layout the backends use
+    static void CopyBuffers(const ImDrawData* InDrawData, ImDrawVert* OutVtx, ImDrawIdx* OutIdx);
+    static uint64_t Hash(const ImDrawData* InDrawData);
+};
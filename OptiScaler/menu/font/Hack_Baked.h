@@ -0,0 +1,2198 @@
+#pragma once
+
+// FontAtlasCache data of the embedded Hack font, printable ascii at menu sizes of MenuScale 0.5 - 1.0.
+// Generated by the menu test, regenerate with OPTISCALER_UPDATE_REFERENCES=1 after ImGui or
+// FreeType updates. Data of another ImGui version is ignored by FontAtlasCache::LoadBaked.
+
+alignas(8) inline static const unsigned char hack_baked_glyphs[] = {
+    0x4f, 0x53, 0x46, 0x43, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x4a, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x54, 0x49, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x21, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x40,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x22, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x1b, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29,
+    0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x2a, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46,
+    0x09, 0x29, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x72, 0x00, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26,
+    0xb0, 0x46, 0x09, 0x29, 0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xba, 0x00, 0x00, 0x00, 0x85, 0x09,
+    0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x02, 0x01, 0x00, 0x00,
+    0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x4a, 0x01,
+    0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0x50, 0x01, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0x7c, 0x01, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x2a, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x20, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0xa8, 0x01, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x2b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xd9, 0x01, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x2c,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x0a, 0x02, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09,
+    0x29, 0x2d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x19, 0x02, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0,
+    0x46, 0x09, 0x29, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x1f, 0x02, 0x00, 0x00, 0x85, 0x09, 0x7c,
+    0x26, 0xb0, 0x46, 0x09, 0x29, 0x2f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x28, 0x02, 0x00, 0x00, 0x85,
+    0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x6e, 0x02, 0x00,
+    0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x31, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xad,
+    0x02, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x32, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0xe3, 0x02, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x22, 0x03, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x34, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x61, 0x03, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x35, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xa0, 0x03, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29,
+    0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xdf, 0x03, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46,
+    0x09, 0x29, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x1e, 0x04, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26,
+    0xb0, 0x46, 0x09, 0x29, 0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x5d, 0x04, 0x00, 0x00, 0x85, 0x09,
+    0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x39, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x9c, 0x04, 0x00, 0x00,
+    0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xdb, 0x04,
+    0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0xf0, 0x04, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0x0e, 0x05, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3d, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x20, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0x3f, 0x05, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3e, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x5b, 0x05, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x3f,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x8c, 0x05, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09,
+    0x29, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xc2, 0x05, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0,
+    0x46, 0x09, 0x29, 0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x0f, 0x06, 0x00, 0x00, 0x85, 0x09, 0x7c,
+    0x26, 0xb0, 0x46, 0x09, 0x29, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x57, 0x06, 0x00, 0x00, 0x85,
+    0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x43, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x96, 0x06, 0x00,
+    0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xd5,
+    0x06, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x45, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0x14, 0x07, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x46, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x4a, 0x07, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x47, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x80, 0x07, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x48, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xbf, 0x07, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29,
+    0x49, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xfe, 0x07, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46,
+    0x09, 0x29, 0x4a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x34, 0x08, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26,
+    0xb0, 0x46, 0x09, 0x29, 0x4b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x6a, 0x08, 0x00, 0x00, 0x85, 0x09,
+    0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x4c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xb2, 0x08, 0x00, 0x00,
+    0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe8, 0x08,
+    0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0x27, 0x09, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x4f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0x66, 0x09, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x50, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0xa5, 0x09, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x51, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xdb, 0x09, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x52,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x33, 0x0a, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09,
+    0x29, 0x53, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x7b, 0x0a, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0,
+    0x46, 0x09, 0x29, 0x54, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xba, 0x0a, 0x00, 0x00, 0x85, 0x09, 0x7c,
+    0x26, 0xb0, 0x46, 0x09, 0x29, 0x55, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf9, 0x0a, 0x00, 0x00, 0x85,
+    0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x38, 0x0b, 0x00,
+    0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x57, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x77,
+    0x0b, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x58, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0xbf, 0x0b, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x59, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x07, 0x0c, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x5a, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x4f, 0x0c, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x5b, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x8e, 0x0c, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29,
+    0x5c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xca, 0x0c, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46,
+    0x09, 0x29, 0x5d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x10, 0x0d, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26,
+    0xb0, 0x46, 0x09, 0x29, 0x5e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x4c, 0x0d, 0x00, 0x00, 0x85, 0x09,
+    0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x5f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x68, 0x0d, 0x00, 0x00,
+    0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x6f, 0x0d,
+    0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x61, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0x7b, 0x0d, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x62, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xac, 0x0d, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x63, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0xe8, 0x0d, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x64, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x19, 0x0e, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x65,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x5f, 0x0e, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09,
+    0x29, 0x66, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x90, 0x0e, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0,
+    0x46, 0x09, 0x29, 0x67, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xd6, 0x0e, 0x00, 0x00, 0x85, 0x09, 0x7c,
+    0x26, 0xb0, 0x46, 0x09, 0x29, 0x68, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x1c, 0x0f, 0x00, 0x00, 0x85,
+    0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x69, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x58, 0x0f, 0x00,
+    0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x6a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x94,
+    0x0f, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x6b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0xc8, 0x0f, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x6c, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x04, 0x10, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x6d, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x40, 0x10, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x6e, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x71, 0x10, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29,
+    0x6f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x9b, 0x10, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46,
+    0x09, 0x29, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xcc, 0x10, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26,
+    0xb0, 0x46, 0x09, 0x29, 0x71, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x08, 0x11, 0x00, 0x00, 0x85, 0x09,
+    0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x72, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x4e, 0x11, 0x00, 0x00,
+    0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x78, 0x11,
+    0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x74, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0xa2, 0x11, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x75, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xe8, 0x11, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x76, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0x12, 0x12, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x77, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x43, 0x12, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x78,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x7b, 0x12, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09,
+    0x29, 0x79, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xac, 0x12, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0,
+    0x46, 0x09, 0x29, 0x7a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf2, 0x12, 0x00, 0x00, 0x85, 0x09, 0x7c,
+    0x26, 0xb0, 0x46, 0x09, 0x29, 0x7b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x1c, 0x13, 0x00, 0x00, 0x85,
+    0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x64, 0x13, 0x00,
+    0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x7d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x7e,
+    0x13, 0x00, 0x00, 0x85, 0x09, 0x7c, 0x26, 0xb0, 0x46, 0x09, 0x29, 0x7e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0xc6, 0x13, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0x40, 0xdb, 0x13, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x21, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10,
+    0x41, 0x00, 0x00, 0xc0, 0x40, 0xdb, 0x13, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x22, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0xeb, 0x13, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32,
+    0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xf7, 0x13, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d,
+    0x80, 0x32, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x27, 0x14, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d,
+    0xf5, 0x7d, 0x80, 0x32, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x63, 0x14, 0x00, 0x00, 0x35, 0x4c,
+    0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x93, 0x14, 0x00, 0x00,
+    0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0xc3, 0x14,
+    0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40,
+    0xc9, 0x14, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+    0xc0, 0x40, 0xe7, 0x14, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x2a, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0xc0, 0x40, 0x05, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x2b, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x29, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x2c,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x4d, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80,
+    0x32, 0x2d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x5c, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5,
+    0x7d, 0x80, 0x32, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x61, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b,
+    0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x2f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x65, 0x15, 0x00, 0x00, 0x35,
+    0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x92, 0x15, 0x00,
+    0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xc2,
+    0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x32, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0,
+    0x40, 0xea, 0x15, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x33, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00,
+    0x00, 0xc0, 0x40, 0x12, 0x16, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x34, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10,
+    0x41, 0x00, 0x00, 0xc0, 0x40, 0x42, 0x16, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x35, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x72, 0x16, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32,
+    0x36, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x9a, 0x16, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d,
+    0x80, 0x32, 0x37, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xca, 0x16, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d,
+    0xf5, 0x7d, 0x80, 0x32, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xf2, 0x16, 0x00, 0x00, 0x35, 0x4c,
+    0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x39, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x22, 0x17, 0x00, 0x00,
+    0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x52, 0x17,
+    0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xc0, 0x40,
+    0x5e, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0xc0, 0x40, 0x79, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3d, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x9d, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3e, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xaf, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x3f,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xd3, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80,
+    0x32, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xf3, 0x17, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5,
+    0x7d, 0x80, 0x32, 0x41, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x29, 0x18, 0x00, 0x00, 0x35, 0x4c, 0x6b,
+    0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x42, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x59, 0x18, 0x00, 0x00, 0x35,
+    0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x43, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x89, 0x18, 0x00,
+    0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x44, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xb1,
+    0x18, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x45, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0,
+    0x40, 0xe1, 0x18, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x46, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00,
+    0x00, 0xc0, 0x40, 0x11, 0x19, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x47, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10,
+    0x41, 0x00, 0x00, 0xc0, 0x40, 0x39, 0x19, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x48, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x69, 0x19, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32,
+    0x49, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x99, 0x19, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d,
+    0x80, 0x32, 0x4a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xc1, 0x19, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d,
+    0xf5, 0x7d, 0x80, 0x32, 0x4b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xe9, 0x19, 0x00, 0x00, 0x35, 0x4c,
+    0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x4c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x19, 0x1a, 0x00, 0x00,
+    0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x4d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x49, 0x1a,
+    0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x4e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40,
+    0x79, 0x1a, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x4f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0xc0, 0x40, 0xa9, 0x1a, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x50, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xc0, 0x40, 0xd9, 0x1a, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x51, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x09, 0x1b, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x52,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x45, 0x1b, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80,
+    0x32, 0x53, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x75, 0x1b, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5,
+    0x7d, 0x80, 0x32, 0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xa5, 0x1b, 0x00, 0x00, 0x35, 0x4c, 0x6b,
+    0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x55, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xd5, 0x1b, 0x00, 0x00, 0x35,
+    0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x56, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xfd, 0x1b, 0x00,
+    0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x57, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x2d,
+    0x1c, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x58, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0,
+    0x40, 0x5d, 0x1c, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x59, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00,
+    0x00, 0xc0, 0x40, 0x8d, 0x1c, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x5a, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10,
+    0x41, 0x00, 0x00, 0xc0, 0x40, 0xbd, 0x1c, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x5b, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xed, 0x1c, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32,
+    0x5c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x15, 0x1d, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d,
+    0x80, 0x32, 0x5d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x4b, 0x1d, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d,
+    0xf5, 0x7d, 0x80, 0x32, 0x5e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x73, 0x1d, 0x00, 0x00, 0x35, 0x4c,
+    0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x5f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x85, 0x1d, 0x00, 0x00,
+    0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x8b, 0x1d,
+    0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x61, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40,
+    0x91, 0x1d, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x62, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0xc0, 0x40, 0xb5, 0x1d, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x63, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xc0, 0x40, 0xe5, 0x1d, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x64, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x03, 0x1e, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x65,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x2b, 0x1e, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80,
+    0x32, 0x66, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x4f, 0x1e, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5,
+    0x7d, 0x80, 0x32, 0x67, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x77, 0x1e, 0x00, 0x00, 0x35, 0x4c, 0x6b,
+    0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x9f, 0x1e, 0x00, 0x00, 0x35,
+    0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xc7, 0x1e, 0x00,
+    0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x6a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xef,
+    0x1e, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x6b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0,
+    0x40, 0x0d, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00,
+    0x00, 0xc0, 0x40, 0x35, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x6d, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10,
+    0x41, 0x00, 0x00, 0xc0, 0x40, 0x5d, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x6e, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x81, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32,
+    0x6f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x9f, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d,
+    0x80, 0x32, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xc3, 0x1f, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d,
+    0xf5, 0x7d, 0x80, 0x32, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xf3, 0x1f, 0x00, 0x00, 0x35, 0x4c,
+    0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x72, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x1b, 0x20, 0x00, 0x00,
+    0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x39, 0x20,
+    0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40,
+    0x57, 0x20, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x75, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0xc0, 0x40, 0x7f, 0x20, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x76, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xc0, 0x40, 0x9d, 0x20, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x77, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xc1, 0x20, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x78,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0xe5, 0x20, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80,
+    0x32, 0x79, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x09, 0x21, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5,
+    0x7d, 0x80, 0x32, 0x7a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x39, 0x21, 0x00, 0x00, 0x35, 0x4c, 0x6b,
+    0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x7b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x57, 0x21, 0x00, 0x00, 0x35,
+    0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x89, 0x21, 0x00,
+    0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x7d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x9d,
+    0x21, 0x00, 0x00, 0x35, 0x4c, 0x6b, 0x0d, 0xf5, 0x7d, 0x80, 0x32, 0x7e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0xcf, 0x21, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0x40, 0xe1, 0x21, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x21, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0xa0, 0x40, 0xe1, 0x21, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x22, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0xf3, 0x21, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35,
+    0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xfc, 0x21, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1,
+    0x65, 0x35, 0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x20, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf,
+    0x36, 0xa1, 0x65, 0x35, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x4d, 0x22, 0x00, 0x00, 0xc5, 0x31,
+    0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x71, 0x22, 0x00, 0x00,
+    0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x95, 0x22,
+    0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0x98, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0xa0, 0x40, 0xb0, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x2a, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0xc0, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x2b, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xd9, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x2c,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xf2, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65,
+    0x35, 0x2d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0xfe, 0x22, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36,
+    0xa1, 0x65, 0x35, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x03, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5,
+    0xbf, 0x36, 0xa1, 0x65, 0x35, 0x2f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x09, 0x23, 0x00, 0x00, 0xc5,
+    0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x31, 0x23, 0x00,
+    0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x4f,
+    0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x32, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0,
+    0x40, 0x6d, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x33, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0xa0, 0x40, 0x8b, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x34, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0xa0, 0x40, 0xa9, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x35, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xc7, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35,
+    0x36, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xe5, 0x23, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1,
+    0x65, 0x35, 0x37, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x03, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf,
+    0x36, 0xa1, 0x65, 0x35, 0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x21, 0x24, 0x00, 0x00, 0xc5, 0x31,
+    0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x39, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x3f, 0x24, 0x00, 0x00,
+    0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x5d, 0x24,
+    0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0x6c, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0xa0, 0x40, 0x81, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3d, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x9a, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3e, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xa9, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x3f,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xc2, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65,
+    0x35, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xda, 0x24, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36,
+    0xa1, 0x65, 0x35, 0x41, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x02, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5,
+    0xbf, 0x36, 0xa1, 0x65, 0x35, 0x42, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x26, 0x25, 0x00, 0x00, 0xc5,
+    0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x43, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x44, 0x25, 0x00,
+    0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x44, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x62,
+    0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x45, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0,
+    0x40, 0x80, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x46, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0xa0, 0x40, 0x9e, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x47, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0xa0, 0x40, 0xbc, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x48, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xda, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35,
+    0x49, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xf8, 0x25, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1,
+    0x65, 0x35, 0x4a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x16, 0x26, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf,
+    0x36, 0xa1, 0x65, 0x35, 0x4b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x34, 0x26, 0x00, 0x00, 0xc5, 0x31,
+    0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x4c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x58, 0x26, 0x00, 0x00,
+    0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x4d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x76, 0x26,
+    0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x4e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0x94, 0x26, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0xa0, 0x40, 0xb2, 0x26, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x50, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0xa0, 0x40, 0xd0, 0x26, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x51, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xee, 0x26, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x52,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x1e, 0x27, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65,
+    0x35, 0x53, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x42, 0x27, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36,
+    0xa1, 0x65, 0x35, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x60, 0x27, 0x00, 0x00, 0xc5, 0x31, 0xa5,
+    0xbf, 0x36, 0xa1, 0x65, 0x35, 0x55, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x7e, 0x27, 0x00, 0x00, 0xc5,
+    0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x56, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x9c, 0x27, 0x00,
+    0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x57, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xba,
+    0x27, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x58, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0,
+    0x40, 0xde, 0x27, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x59, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0xa0, 0x40, 0x02, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x5a, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0xa0, 0x40, 0x26, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x5b, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x44, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35,
+    0x5c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x5f, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1,
+    0x65, 0x35, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x87, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf,
+    0x36, 0xa1, 0x65, 0x35, 0x5e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x40, 0xa2, 0x28, 0x00, 0x00, 0xc5, 0x31,
+    0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x5f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xb1, 0x28, 0x00, 0x00,
+    0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0xb6, 0x28,
+    0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x61, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0xbc, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x62, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0xa0, 0x40, 0xd5, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x63, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0xa0, 0x40, 0xf8, 0x28, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x64, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x11, 0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x65,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x34, 0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65,
+    0x35, 0x66, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x4d, 0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36,
+    0xa1, 0x65, 0x35, 0x67, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x70, 0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5,
+    0xbf, 0x36, 0xa1, 0x65, 0x35, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x93, 0x29, 0x00, 0x00, 0xc5,
+    0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x69, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xb6, 0x29, 0x00,
+    0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x6a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xd2,
+    0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x6b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0,
+    0x40, 0xed, 0x29, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0xa0, 0x40, 0x10, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x6d, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0xa0, 0x40, 0x33, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x6e, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x4c, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35,
+    0x6f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x65, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1,
+    0x65, 0x35, 0x70, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x7e, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf,
+    0x36, 0xa1, 0x65, 0x35, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xa1, 0x2a, 0x00, 0x00, 0xc5, 0x31,
+    0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xc4, 0x2a, 0x00, 0x00,
+    0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xd8, 0x2a,
+    0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0xf1, 0x2a, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x75, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0xa0, 0x40, 0x14, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x76, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0xa0, 0x40, 0x2d, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x77, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x46, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x78,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x64, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65,
+    0x35, 0x79, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x7d, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36,
+    0xa1, 0x65, 0x35, 0x7a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xa0, 0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5,
+    0xbf, 0x36, 0xa1, 0x65, 0x35, 0x7b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xb9, 0x2b, 0x00, 0x00, 0xc5,
+    0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x7c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xe6, 0x2b, 0x00,
+    0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x7d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0xef,
+    0x2b, 0x00, 0x00, 0xc5, 0x31, 0xa5, 0xbf, 0x36, 0xa1, 0x65, 0x35, 0x7e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x13, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x1d, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x21, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x1d, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x22, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x27, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e,
+    0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x2b, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98,
+    0x51, 0x6e, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x3f, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa,
+    0xc7, 0x98, 0x51, 0x6e, 0x25, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x5b, 0x2c, 0x00, 0x00, 0xb2, 0xfc,
+    0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6f, 0x2c, 0x00, 0x00,
+    0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x83, 0x2c,
+    0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40,
+    0x87, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0x80, 0x40, 0x9c, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x2a, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0xaa, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x2b, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xba, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x2c,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xca, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51,
+    0x6e, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd2, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7,
+    0x98, 0x51, 0x6e, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd6, 0x2c, 0x00, 0x00, 0xb2, 0xfc, 0x6b,
+    0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x2f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xda, 0x2c, 0x00, 0x00, 0xb2,
+    0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xf2, 0x2c, 0x00,
+    0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x06,
+    0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x1a, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x33, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x2e, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x34, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x42, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x35, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x56, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e,
+    0x36, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6a, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98,
+    0x51, 0x6e, 0x37, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x7e, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa,
+    0xc7, 0x98, 0x51, 0x6e, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x92, 0x2d, 0x00, 0x00, 0xb2, 0xfc,
+    0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x39, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xa6, 0x2d, 0x00, 0x00,
+    0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xba, 0x2d,
+    0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40,
+    0xc2, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0xd0, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3d, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0xe0, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3e, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xe8, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x3f,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xf8, 0x2d, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51,
+    0x6e, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x0c, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7,
+    0x98, 0x51, 0x6e, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x24, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b,
+    0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x42, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x38, 0x2e, 0x00, 0x00, 0xb2,
+    0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x4c, 0x2e, 0x00,
+    0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x60,
+    0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x45, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x74, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x46, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x88, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x47, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x9c, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x48, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xb0, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e,
+    0x49, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xc4, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98,
+    0x51, 0x6e, 0x4a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd8, 0x2e, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa,
+    0xc7, 0x98, 0x51, 0x6e, 0x4b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xe7, 0x2e, 0x00, 0x00, 0xb2, 0xfc,
+    0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xfb, 0x2e, 0x00, 0x00,
+    0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x4d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x0f, 0x2f,
+    0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x4e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x23, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x4f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x37, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x50, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x4b, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x51, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x5f, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x52,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x77, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51,
+    0x6e, 0x53, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x8b, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7,
+    0x98, 0x51, 0x6e, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x9f, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b,
+    0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x55, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xb3, 0x2f, 0x00, 0x00, 0xb2,
+    0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x56, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xc7, 0x2f, 0x00,
+    0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x57, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xdb,
+    0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x58, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0xef, 0x2f, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x59, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x03, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x5a, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x17, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x5b, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x2b, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e,
+    0x5c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x40, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98,
+    0x51, 0x6e, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x58, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa,
+    0xc7, 0x98, 0x51, 0x6e, 0x5e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6d, 0x30, 0x00, 0x00, 0xb2, 0xfc,
+    0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x75, 0x30, 0x00, 0x00,
+    0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x79, 0x30,
+    0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x61, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x7f, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x62, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x8f, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x63, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0xa3, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x64, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xb3, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x65,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xc7, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51,
+    0x6e, 0x66, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd7, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7,
+    0x98, 0x51, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xeb, 0x30, 0x00, 0x00, 0xb2, 0xfc, 0x6b,
+    0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xff, 0x30, 0x00, 0x00, 0xb2,
+    0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x69, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x13, 0x31, 0x00,
+    0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x6a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x27,
+    0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x39, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x4d, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x6d, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x61, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x6e, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x71, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e,
+    0x6f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x81, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98,
+    0x51, 0x6e, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x91, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa,
+    0xc7, 0x98, 0x51, 0x6e, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xa5, 0x31, 0x00, 0x00, 0xb2, 0xfc,
+    0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xb9, 0x31, 0x00, 0x00,
+    0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xc9, 0x31,
+    0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0xd9, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x75, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0xf1, 0x31, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x76, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x01, 0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x77, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x11, 0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x78,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x21, 0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51,
+    0x6e, 0x79, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x31, 0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7,
+    0x98, 0x51, 0x6e, 0x7a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x45, 0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b,
+    0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x55, 0x32, 0x00, 0x00, 0xb2,
+    0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6a, 0x32, 0x00,
+    0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x7d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x76,
+    0x32, 0x00, 0x00, 0xb2, 0xfc, 0x6b, 0xfa, 0xc7, 0x98, 0x51, 0x6e, 0x7e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x92, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x40, 0x9a, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x21, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x9a, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x22, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0xb2, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a,
+    0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xbe, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66,
+    0x1e, 0x7a, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf6, 0x32, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb,
+    0xe5, 0x66, 0x1e, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x32, 0x33, 0x00, 0x00, 0xd5, 0x41,
+    0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x6a, 0x33, 0x00, 0x00,
+    0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0xa2, 0x33,
+    0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0xa8, 0x33, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xd0, 0x33, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x2a, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x20, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0xf8, 0x33, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x2b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x20, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x1c, 0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x2c,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x46, 0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e,
+    0x7a, 0x2d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x55, 0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5,
+    0x66, 0x1e, 0x7a, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x5a, 0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e,
+    0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x2f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x60, 0x34, 0x00, 0x00, 0xd5,
+    0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x96, 0x34, 0x00,
+    0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xc6,
+    0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0xee, 0x34, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x33, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x1e, 0x35, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x34, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0x4e, 0x35, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x35, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x86, 0x35, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a,
+    0x36, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xb6, 0x35, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66,
+    0x1e, 0x7a, 0x37, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe6, 0x35, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb,
+    0xe5, 0x66, 0x1e, 0x7a, 0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x16, 0x36, 0x00, 0x00, 0xd5, 0x41,
+    0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x39, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x4e, 0x36, 0x00, 0x00,
+    0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x7e, 0x36,
+    0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0x90, 0x36, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xab, 0x36, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3d, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x10, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0xdc, 0x36, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3e, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf1, 0x36, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x3f,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x22, 0x37, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e,
+    0x7a, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x4a, 0x37, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5,
+    0x66, 0x1e, 0x7a, 0x41, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x89, 0x37, 0x00, 0x00, 0xd5, 0x41, 0x3e,
+    0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xc1, 0x37, 0x00, 0x00, 0xd5,
+    0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x43, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf9, 0x37, 0x00,
+    0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x29,
+    0x38, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x45, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0x61, 0x38, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x46, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x91, 0x38, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x47, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0xc1, 0x38, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x48, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xf9, 0x38, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a,
+    0x49, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x29, 0x39, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66,
+    0x1e, 0x7a, 0x4a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x51, 0x39, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb,
+    0xe5, 0x66, 0x1e, 0x7a, 0x4b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x81, 0x39, 0x00, 0x00, 0xd5, 0x41,
+    0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x4c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xb9, 0x39, 0x00, 0x00,
+    0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x4d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe9, 0x39,
+    0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x4e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0x21, 0x3a, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x4f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0x51, 0x3a, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x50, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0x89, 0x3a, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x51, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xc1, 0x3a, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x52,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x07, 0x3b, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e,
+    0x7a, 0x53, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x3f, 0x3b, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5,
+    0x66, 0x1e, 0x7a, 0x54, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x6f, 0x3b, 0x00, 0x00, 0xd5, 0x41, 0x3e,
+    0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x55, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xa7, 0x3b, 0x00, 0x00, 0xd5,
+    0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xd7, 0x3b, 0x00,
+    0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x0f,
+    0x3c, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x58, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0x47, 0x3c, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x59, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x7f, 0x3c, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x5a, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0xb7, 0x3c, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x5b, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xef, 0x3c, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a,
+    0x5c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x21, 0x3d, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66,
+    0x1e, 0x7a, 0x5d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x60, 0x3d, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb,
+    0xe5, 0x66, 0x1e, 0x7a, 0x5e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x88, 0x3d, 0x00, 0x00, 0xd5, 0x41,
+    0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x5f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x9d, 0x3d, 0x00, 0x00,
+    0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0xa4, 0x3d,
+    0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x61, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0xac, 0x3d, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x62, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xd6, 0x3d, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x63, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0x06, 0x3e, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x64, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+    0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x2a, 0x3e, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x65,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x5a, 0x3e, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e,
+    0x7a, 0x66, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x84, 0x3e, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5,
+    0x66, 0x1e, 0x7a, 0x67, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xb4, 0x3e, 0x00, 0x00, 0xd5, 0x41, 0x3e,
+    0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe4, 0x3e, 0x00, 0x00, 0xd5,
+    0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x0c, 0x3f, 0x00,
+    0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x6a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x34,
+    0x3f, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x6b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0x5c, 0x3f, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x6c, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00,
+    0x00, 0xe0, 0x40, 0x8c, 0x3f, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x6d, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30,
+    0x41, 0x00, 0x00, 0xe0, 0x40, 0xbc, 0x3f, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x6e, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00,
+    0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe6, 0x3f, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a,
+    0x6f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0,
+    0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x04, 0x40, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66,
+    0x1e, 0x7a, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x28, 0x40, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb,
+    0xe5, 0x66, 0x1e, 0x7a, 0x71, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x58, 0x40, 0x00, 0x00, 0xd5, 0x41,
+    0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x72, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x88, 0x40, 0x00, 0x00,
+    0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xa6, 0x40,
+    0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40,
+    0xc4, 0x40, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x75, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+    0xe0, 0x40, 0xf4, 0x40, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x76, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x30, 0x41,
+    0x00, 0x00, 0xe0, 0x40, 0x12, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x77, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x3c, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x78,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x66, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e,
+    0x7a, 0x79, 0x00, 0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x90, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5,
+    0x66, 0x1e, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xc8, 0x41, 0x00, 0x00, 0xd5, 0x41, 0x3e,
+    0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x7b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0xe6, 0x41, 0x00, 0x00, 0xd5,
+    0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x22, 0x42, 0x00,
+    0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x7d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x38,
+    0x42, 0x00, 0x00, 0xd5, 0x41, 0x3e, 0xfb, 0xe5, 0x66, 0x1e, 0x7a, 0x7e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xe0,
+    0x40, 0x74, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x89, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x21, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x89, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x22, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x93, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee,
+    0x23, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x97, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4,
+    0x6a, 0xee, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x80, 0x40, 0xb0, 0x42, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba,
+    0x2c, 0xf4, 0x6a, 0xee, 0x25, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xcc, 0x42, 0x00, 0x00, 0x25, 0x9c,
+    0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x26, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xe5, 0x42, 0x00, 0x00,
+    0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0xfe, 0x42,
+    0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x80, 0x40,
+    0x02, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+    0x80, 0x40, 0x10, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x2a, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x25, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x2b, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x35, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x2c,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x80, 0x40, 0x45, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a,
+    0xee, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x4d, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c,
+    0xf4, 0x6a, 0xee, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x51, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47,
+    0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x2f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x55, 0x43, 0x00, 0x00, 0x25,
+    0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6d, 0x43, 0x00,
+    0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x81,
+    0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x95, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x33, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0xa9, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x34, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0xbd, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x35, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd1, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee,
+    0x36, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xe5, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4,
+    0x6a, 0xee, 0x37, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xf9, 0x43, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba,
+    0x2c, 0xf4, 0x6a, 0xee, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x0d, 0x44, 0x00, 0x00, 0x25, 0x9c,
+    0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x39, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x21, 0x44, 0x00, 0x00,
+    0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80,
+    0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x35, 0x44,
+    0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x80, 0x40,
+    0x3f, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x4d, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3d, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x5d, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3e, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x65, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x3f,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x75, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a,
+    0xee, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x89, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c,
+    0xf4, 0x6a, 0xee, 0x41, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xa5, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47,
+    0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x42, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xbe, 0x44, 0x00, 0x00, 0x25,
+    0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x43, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd2, 0x44, 0x00,
+    0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xe6,
+    0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x45, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0xfa, 0x44, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x46, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x0e, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x47, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x22, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x48, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x36, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee,
+    0x49, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x4a, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4,
+    0x6a, 0xee, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x5e, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba,
+    0x2c, 0xf4, 0x6a, 0xee, 0x4b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x72, 0x45, 0x00, 0x00, 0x25, 0x9c,
+    0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x8b, 0x45, 0x00, 0x00,
+    0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x4d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x9f, 0x45,
+    0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x4e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0xb3, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x4f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0xc7, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x50, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0xdb, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x51, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xef, 0x45, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x52,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x0d, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a,
+    0xee, 0x53, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x26, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c,
+    0xf4, 0x6a, 0xee, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x3a, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47,
+    0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x55, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x4e, 0x46, 0x00, 0x00, 0x25,
+    0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x56, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x62, 0x46, 0x00,
+    0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x57, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x76,
+    0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x58, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x8f, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x59, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0xa8, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x5a, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0xc1, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x5b, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xd5, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee,
+    0x5c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xea, 0x46, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4,
+    0x6a, 0xee, 0x5d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x02, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba,
+    0x2c, 0xf4, 0x6a, 0xee, 0x5e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x1e, 0x47, 0x00, 0x00, 0x25, 0x9c,
+    0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x26, 0x47, 0x00, 0x00,
+    0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x2a, 0x47,
+    0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x61, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x30, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x62, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x40, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x63, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x54, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x64, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x64, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x65,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x78, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a,
+    0xee, 0x66, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x88, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c,
+    0xf4, 0x6a, 0xee, 0x67, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x9c, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47,
+    0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xb0, 0x47, 0x00, 0x00, 0x25,
+    0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x69, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xc4, 0x47, 0x00,
+    0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x6a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xd8,
+    0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x6b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0xea, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0xfe, 0x47, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x6d, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x12, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x6e, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x22, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee,
+    0x6f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x32, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4,
+    0x6a, 0xee, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x42, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba,
+    0x2c, 0xf4, 0x6a, 0xee, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x56, 0x48, 0x00, 0x00, 0x25, 0x9c,
+    0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x72, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x6a, 0x48, 0x00, 0x00,
+    0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0x76, 0x48,
+    0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x86, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x75, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x9e, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x76, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0xae, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x77, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+    0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xbe, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x78,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xd2, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a,
+    0xee, 0x79, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0xe2, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c,
+    0xf4, 0x6a, 0xee, 0x7a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xf6, 0x48, 0x00, 0x00, 0x25, 0x9c, 0x47,
+    0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x7b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x06, 0x49, 0x00, 0x00, 0x25,
+    0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x80, 0x40, 0x22, 0x49, 0x00,
+    0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x7d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x40, 0x30,
+    0x49, 0x00, 0x00, 0x25, 0x9c, 0x47, 0xba, 0x2c, 0xf4, 0x6a, 0xee, 0x7e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80,
+    0x40, 0x4c, 0x49, 0x00, 0x00, 0x2c, 0xff, 0x60, 0x2c, 0xff, 0x60, 0x29, 0xff, 0x5e, 0x0e, 0xff, 0x46, 0x00, 0xec,
+    0x28, 0x00, 0xc9, 0x0a, 0x00, 0x08, 0x00, 0x31, 0xfa, 0x68, 0x2a, 0xee, 0x5c, 0x04, 0xff, 0x00, 0xc4, 0x40, 0x04,
+    0xff, 0x00, 0xc4, 0x40, 0x04, 0xff, 0x00, 0xc4, 0x40, 0x00, 0x00, 0x09, 0xe6, 0x00, 0xa3, 0x4d, 0x00, 0x00, 0x00,
+    0x39, 0xb6, 0x00, 0xd7, 0x18, 0x00, 0x00, 0x00, 0x6d, 0x83, 0x0e, 0xe1, 0x00, 0x00, 0x4b, 0xf0, 0xfa, 0xf4, 0xf4,
+    0xfa, 0xf0, 0x34, 0x00, 0x00, 0xdf, 0x11, 0x80, 0x6f, 0x00, 0x00, 0x00, 0x20, 0xd2, 0x00, 0xbd, 0x32, 0x00, 0x00,
+    0xf0, 0xf8, 0xfa, 0xf4, 0xfe, 0xf4, 0x85, 0x00, 0x00, 0xa1, 0x4d, 0x41, 0xae, 0x00, 0x00, 0x00, 0x02, 0xe1, 0x09,
+    0x8e, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x4c, 0x00, 0x00, 0x03, 0x67, 0xe8, 0xb6, 0x6a, 0x00, 0x8c, 0xa2,
+    0xa9, 0x53, 0x8a, 0x00, 0xd7, 0x35, 0x94, 0x20, 0x00, 0x00, 0xb3, 0xa6, 0xa9, 0x20, 0x00, 0x00, 0x1d, 0xb2, 0xfa,
+    0xd9, 0x63, 0x00, 0x00, 0x00, 0x94, 0x66, 0xe9, 0x44, 0x00, 0x00, 0x94, 0x20, 0x9a, 0x80, 0x7c, 0x24, 0x94, 0x30,
+    0xd4, 0x52, 0x80, 0xe3, 0xfe, 0xf1, 0x8e, 0x00, 0x00, 0x00, 0xc5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xae, 0x43, 0x00,
+    0x00, 0x2e, 0xd4, 0xe2, 0x44, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x34, 0x1e, 0xcb, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x37,
+    0x21, 0xcd, 0x00, 0x00, 0x25, 0x00, 0x30, 0xd6, 0xde, 0x47, 0x45, 0xa5, 0x8e, 0x00, 0x00, 0x09, 0x66, 0xaf, 0x6d,
+    0x0c, 0x00, 0x00, 0x6f, 0xa7, 0x4b, 0x20, 0xd1, 0xe6, 0x55, 0x00, 0x14, 0x00, 0x00, 0x96, 0x4e, 0x16, 0xd5, 0x01,
+    0x00, 0x00, 0x00, 0x9c, 0x4b, 0x12, 0xd4, 0x01, 0x00, 0x00, 0x00, 0x23, 0xd2, 0xe9, 0x5a, 0x00, 0x00, 0x23, 0xc8,
+    0xf4, 0xe2, 0x18, 0x00, 0x00, 0x00, 0x8d, 0x9a, 0x02, 0x1a, 0x09, 0x00, 0x00, 0x00, 0x66, 0x9a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x65, 0xef, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc8, 0x23, 0xd7, 0x19, 0x00, 0xe7, 0x07, 0x96,
+    0x6d, 0x00, 0x5d, 0xc4, 0x07, 0xe6, 0x00, 0x99, 0x80, 0x00, 0x00, 0xac, 0xc6, 0x9a, 0x00, 0x49, 0xec, 0x38, 0x01,
+    0x5e, 0xff, 0x53, 0x00, 0x00, 0x64, 0xdc, 0xf3, 0xb9, 0x7e, 0xd6, 0x06, 0xe8, 0x20, 0xe8, 0x20, 0xe8, 0x20, 0x00,
+    0x00, 0xc5, 0x30, 0x00, 0x4e, 0xb6, 0x00, 0x00, 0xb6, 0x5a, 0x00, 0x07, 0xf8, 0x1c, 0x00, 0x2e, 0xf5, 0x00, 0x00,
+    0x3f, 0xe8, 0x00, 0x00, 0x2e, 0xf6, 0x00, 0x00, 0x07, 0xf7, 0x1e, 0x00, 0x00, 0xb3, 0x5f, 0x00, 0x00, 0x4a, 0xbb,
+    0x00, 0x00, 0x00, 0xc1, 0x31, 0x09, 0xda, 0x14, 0x00, 0x00, 0x7c, 0x8b, 0x00, 0x00, 0x20, 0xec, 0x06, 0x00, 0x00,
+    0xdf, 0x3b, 0x00, 0x00, 0xb6, 0x6a, 0x00, 0x00, 0xa9, 0x7a, 0x00, 0x00, 0xb8, 0x6a, 0x00, 0x00, 0xe1, 0x3a, 0x00,
+    0x22, 0xeb, 0x05, 0x00, 0x7d, 0x8a, 0x00, 0x09, 0xd7, 0x13, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x01,
+    0x06, 0x00, 0xc5, 0x00, 0x01, 0x07, 0x18, 0xc4, 0x9e, 0xe4, 0x90, 0xc8, 0x3b, 0x00, 0x00, 0x6e, 0xff, 0x9f, 0x06,
+    0x00, 0x00, 0x01, 0xbd, 0x4d, 0xd1, 0x11, 0x00, 0x00, 0x50, 0x7a, 0x00, 0x47, 0x87, 0x00, 0x00, 0x02, 0x02, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x1c, 0x00, 0x00, 0x76, 0xf4, 0xf4, 0xfe, 0xf5, 0xf4, 0xaf, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x1f, 0xc6, 0x4b, 0x2d, 0xef,
+    0xa7, 0x00, 0x49, 0x8e, 0x1e, 0xc4, 0x25, 0x4b, 0x2a, 0x00, 0xc2, 0xf4, 0xf4, 0xf4, 0xf4, 0x07, 0x00, 0x01, 0x00,
+    0x31, 0xf6, 0x5c, 0x2e, 0xef, 0x58, 0x00, 0x00, 0x00, 0x00, 0x10, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xa5,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xe8, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x67, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdb,
+    0x42, 0x00, 0x00, 0x00, 0x00, 0x54, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x54, 0x00, 0x00, 0x00, 0x00, 0x42,
+    0xdb, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x67, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xe5, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0xba, 0xf6, 0xd5, 0x37, 0x00, 0x00, 0xab, 0xa8, 0x0a, 0x70, 0xe4, 0x05, 0x09, 0xf9, 0x30, 0x9f, 0x06,
+    0xf1, 0x3d, 0x2a, 0xfe, 0x03, 0xe9, 0x21, 0xcd, 0x65, 0x35, 0xfa, 0x00, 0xf6, 0x31, 0xc0, 0x71, 0x2a, 0xff, 0x08,
+    0xe4, 0x26, 0xcd, 0x65, 0x09, 0xf9, 0x32, 0xa2, 0x0a, 0xf0, 0x3d, 0x00, 0xab, 0xa8, 0x0a, 0x6f, 0xe4, 0x05, 0x00,
+    0x17, 0xbb, 0xf7, 0xd5, 0x37, 0x00, 0x00, 0x1d, 0xe5, 0x9c, 0x00, 0x00, 0x0e, 0xd2, 0xe7, 0x9c, 0x00, 0x00, 0x62,
+    0x95, 0x94, 0x9c, 0x00, 0x00, 0x01, 0x03, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0x00, 0x00, 0x03, 0x08, 0x97, 0x9f, 0x08, 0x03, 0x6c, 0xff, 0xff,
+    0xff, 0xff, 0x6c, 0x03, 0xa2, 0xe5, 0xf1, 0xc2, 0x32, 0x00, 0x06, 0x8f, 0x20, 0x03, 0x79, 0xe2, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x52, 0xea, 0x01, 0x00, 0x00, 0x00, 0x14, 0xe0, 0x5d, 0x00,
+    0x00, 0x00, 0x0a, 0xc5, 0x8a, 0x00, 0x00, 0x00, 0x04, 0xb5, 0x9e, 0x01, 0x00, 0x00, 0x00, 0xa4, 0xa3, 0x02, 0x00,
+    0x00, 0x00, 0x19, 0xff, 0xf5, 0xf4, 0xf4, 0xf4, 0x35, 0x00, 0xa0, 0xe7, 0xf2, 0xd4, 0x59, 0x00, 0x00, 0x33, 0x0a,
+    0x00, 0x3c, 0xfd, 0x19, 0x00, 0x00, 0x00, 0x03, 0x48, 0xf2, 0x13, 0x00, 0x00, 0x94, 0xfb, 0xf1, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x69, 0xe4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9,
+    0x55, 0x15, 0x60, 0x0c, 0x04, 0x66, 0xf3, 0x19, 0x14, 0xc5, 0xf2, 0xf2, 0xc9, 0x41, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xfc, 0x80, 0x00, 0x00, 0x00, 0x01, 0xc1, 0xd3, 0x80, 0x00, 0x00, 0x00, 0x64, 0x8c, 0xb0, 0x80, 0x00, 0x00, 0x12,
+    0xd7, 0x0f, 0xb0, 0x80, 0x00, 0x00, 0x9a, 0x67, 0x00, 0xb0, 0x80, 0x00, 0x34, 0xd0, 0x03, 0x00, 0xb0, 0x80, 0x00,
+    0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0,
+    0x80, 0x00, 0x00, 0xc8, 0xf7, 0xf4, 0xf4, 0xa0, 0x00, 0x00, 0xc8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xed, 0xf0, 0xbb, 0x2a, 0x00, 0x00, 0x37, 0x08, 0x0f, 0x90, 0xde, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xfb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfa, 0x32, 0x13, 0x43, 0x06, 0x08, 0x88, 0xde,
+    0x07, 0x1b, 0xd5, 0xf7, 0xee, 0xb9, 0x2a, 0x00, 0x00, 0x07, 0x96, 0xed, 0xf2, 0xa7, 0x00, 0x00, 0x92, 0xbf, 0x1a,
+    0x02, 0x2d, 0x00, 0x04, 0xf2, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x26, 0xf4, 0x78, 0xec, 0xdd, 0x5d, 0x00, 0x34, 0xfa,
+    0x99, 0x08, 0x3b, 0xf6, 0x25, 0x24, 0xff, 0x25, 0x00, 0x00, 0xc3, 0x62, 0x0a, 0xfc, 0x24, 0x00, 0x00, 0xc3, 0x61,
+    0x00, 0xb2, 0x97, 0x05, 0x37, 0xf5, 0x25, 0x00, 0x13, 0xb8, 0xf5, 0xdd, 0x5b, 0x00, 0x2d, 0xf4, 0xf4, 0xf4, 0xf4,
+    0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x31, 0xef, 0x07, 0x00, 0x00, 0x00, 0x00, 0x92, 0x98, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xec, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x7d, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x77, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x63, 0x00, 0x00,
+    0x00, 0x00, 0x2f, 0xc6, 0xf1, 0xda, 0x56, 0x00, 0x00, 0xd4, 0x83, 0x02, 0x44, 0xf9, 0x18, 0x01, 0xfb, 0x31, 0x00,
+    0x00, 0xf5, 0x39, 0x00, 0xaf, 0x86, 0x06, 0x4e, 0xe3, 0x0a, 0x00, 0x22, 0xde, 0xfd, 0xf4, 0x49, 0x00, 0x08, 0xe0,
+    0x61, 0x03, 0x35, 0xed, 0x2b, 0x31, 0xfe, 0x03, 0x00, 0x00, 0xc3, 0x6c, 0x12, 0xf7, 0x60, 0x01, 0x30, 0xf3, 0x42,
+    0x00, 0x4e, 0xd3, 0xf3, 0xe0, 0x74, 0x00, 0x00, 0x3c, 0xcf, 0xf4, 0xd1, 0x2b, 0x00, 0x08, 0xe6, 0x65, 0x03, 0x67,
+    0xda, 0x00, 0x2f, 0xf8, 0x01, 0x00, 0x00, 0xef, 0x36, 0x2f, 0xf9, 0x02, 0x00, 0x01, 0xf1, 0x57, 0x07, 0xe6, 0x6c,
+    0x08, 0x6e, 0xfa, 0x67, 0x00, 0x3a, 0xcc, 0xee, 0xa1, 0xc4, 0x59, 0x00, 0x00, 0x00, 0x00, 0x08, 0xed, 0x2c, 0x00,
+    0x28, 0x08, 0x0f, 0x97, 0xc4, 0x00, 0x00, 0x77, 0xf2, 0xf4, 0xaf, 0x18, 0x00, 0x27, 0xed, 0x61, 0x2c, 0xf9, 0x6c,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x27, 0xed, 0x61, 0x2d, 0xfa, 0x6e, 0x00, 0x08, 0x00, 0x00, 0x19, 0x00, 0x49,
+    0xff, 0x72, 0x39, 0xf1, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xda, 0x62, 0x2e, 0xed, 0xbb, 0x00, 0x3c,
+    0xa4, 0x11, 0xbf, 0x39, 0x65, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x69, 0x00, 0x00, 0x12, 0x70, 0xd5,
+    0xd1, 0x5b, 0x2a, 0xa4, 0xe4, 0x92, 0x32, 0x00, 0x00, 0x65, 0xf6, 0x80, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x81,
+    0xe1, 0xbb, 0x5c, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x4b, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x76,
+    0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x76, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xaf, 0x4d, 0x53, 0x05, 0x00, 0x00, 0x00, 0x00, 0x37, 0xbb, 0xe5, 0x87,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7b, 0xd8, 0xbc, 0x48, 0x00, 0x00, 0x00, 0x0d, 0x63, 0xe6, 0x9e, 0x02, 0x45,
+    0xa4, 0xe8, 0x99, 0x34, 0x00, 0x78, 0xc8, 0x63, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x43, 0xc9, 0xf1, 0xdc, 0x58, 0x00, 0x58, 0x34, 0x02, 0x5a, 0xf8, 0x08, 0x00, 0x00, 0x00, 0x3c, 0xf3, 0x05, 0x00,
+    0x00, 0x27, 0xe1, 0x58, 0x00, 0x00, 0x00, 0xd9, 0x60, 0x00, 0x00, 0x00, 0x14, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xc2, 0x1e, 0x00, 0x00, 0x00, 0x33, 0xea, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x8c,
+    0xe5, 0xe9, 0x9d, 0x0b, 0x00, 0xb6, 0x91, 0x12, 0x0d, 0xa2, 0x8a, 0x4c, 0xbe, 0x00, 0x00, 0x00, 0x13, 0xd4, 0x9f,
+    0x50, 0x03, 0x9c, 0xeb, 0xa1, 0xde, 0xc9, 0x23, 0x60, 0xae, 0x08, 0x48, 0xeb, 0xd4, 0x0f, 0x8a, 0x5d, 0x00, 0x00,
+    0xdd, 0xc4, 0x2a, 0x5f, 0xb1, 0x0b, 0x4e, 0xeb, 0x94, 0x60, 0x04, 0x9a, 0xea, 0xa6, 0xd5, 0x35, 0xd7, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8d, 0xb8, 0x2b, 0x04, 0x20, 0x00, 0x00, 0x00, 0x64, 0xcc, 0xf1, 0xdb, 0x0a, 0x00, 0x00,
+    0x3f, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd3, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x54, 0xfa,
+    0x18, 0x00, 0x00, 0x00, 0x23, 0xf9, 0x0a, 0xc6, 0x63, 0x00, 0x00, 0x00, 0x70, 0xc0, 0x00, 0x84, 0xaf, 0x00, 0x00,
+    0x00, 0xbd, 0x7d, 0x00, 0x41, 0xf4, 0x07, 0x00, 0x0e, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0x48, 0x00, 0x56, 0xe7, 0x02,
+    0x00, 0x00, 0xae, 0x95, 0x00, 0xa2, 0x98, 0x00, 0x00, 0x00, 0x5d, 0xe1, 0x00, 0x08, 0xff, 0xf6, 0xf3, 0xdc, 0x63,
+    0x00, 0x08, 0xff, 0x2c, 0x00, 0x2f, 0xf6, 0x2a, 0x08, 0xff, 0x2c, 0x00, 0x00, 0xdc, 0x55, 0x08, 0xff, 0x2c, 0x01,
+    0x3e, 0xf7, 0x25, 0x08, 0xff, 0xf6, 0xf7, 0xfd, 0x7c, 0x00, 0x08, 0xff, 0x2c, 0x00, 0x22, 0xd8, 0x57, 0x08, 0xff,
+    0x2c, 0x00, 0x00, 0x8e, 0xa0, 0x08, 0xff, 0x2c, 0x00, 0x17, 0xce, 0x7b, 0x08, 0xff, 0xf6, 0xf3, 0xe6, 0x94, 0x07,
+    0x00, 0x00, 0x6d, 0xdd, 0xf5, 0xd1, 0x2b, 0x00, 0x6a, 0xdf, 0x2e, 0x05, 0x45, 0x32, 0x00, 0xe1, 0x5f, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0x26,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xdf, 0x2e, 0x04, 0x3d, 0x2c, 0x00,
+    0x00, 0x79, 0xe3, 0xf6, 0xd3, 0x2d, 0x34, 0xff, 0xf5, 0xe8, 0x9f, 0x15, 0x00, 0x34, 0xff, 0x00, 0x19, 0xa4, 0xcb,
+    0x01, 0x34, 0xff, 0x00, 0x00, 0x09, 0xf5, 0x3c, 0x34, 0xff, 0x00, 0x00, 0x00, 0xcf, 0x6d, 0x34, 0xff, 0x00, 0x00,
+    0x00, 0xc3, 0x7c, 0x34, 0xff, 0x00, 0x00, 0x00, 0xcf, 0x6e, 0x34, 0xff, 0x00, 0x00, 0x09, 0xf5, 0x3d, 0x34, 0xff,
+    0x00, 0x19, 0xa4, 0xcc, 0x01, 0x34, 0xff, 0xf5, 0xea, 0xa0, 0x15, 0x00, 0xd8, 0xf8, 0xf4, 0xf4, 0xf4, 0x57, 0xd8,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x58, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x58, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xf8,
+    0xf4, 0xf4, 0xf4, 0x2d, 0xd8, 0x58, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x58, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x58, 0x00,
+    0x00, 0x00, 0x00, 0xd8, 0xf8, 0xf4, 0xf4, 0xf4, 0x72, 0xa0, 0xfa, 0xf4, 0xf4, 0xf4, 0x81, 0xa0, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfa, 0xf4, 0xf4, 0xf4,
+    0x26, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x96, 0xec, 0xed, 0xb1, 0x14, 0x00, 0x9d, 0xc0, 0x1a, 0x03, 0x4f,
+    0x21, 0x1b, 0xfb, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x48, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xdc, 0x00, 0x00,
+    0xe0, 0xf9, 0x7a, 0x49, 0xe7, 0x00, 0x00, 0x00, 0xa8, 0x7c, 0x1c, 0xfb, 0x25, 0x00, 0x00, 0xa8, 0x7c, 0x00, 0xa1,
+    0xba, 0x17, 0x08, 0xbe, 0x7c, 0x00, 0x0c, 0x9b, 0xee, 0xec, 0xb2, 0x25, 0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70,
+    0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x34, 0xff, 0x00, 0x00, 0x00,
+    0xc0, 0x70, 0x34, 0xff, 0xf4, 0xf4, 0xf4, 0xfd, 0x70, 0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x34, 0xff, 0x00,
+    0x00, 0x00, 0xc0, 0x70, 0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x34, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x70, 0xc6,
+    0xf4, 0xff, 0xf6, 0xf4, 0x0b, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0xc6, 0xf4, 0xff, 0xf6, 0xf4, 0x0b, 0x00, 0x00, 0xc6, 0xf4,
+    0xfa, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94,
+    0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x94, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x92,
+    0x48, 0x5c, 0x0c, 0x16, 0xdf, 0x63, 0x34, 0xc7, 0xf1, 0xf1, 0xa4, 0x07, 0x34, 0xff, 0x00, 0x00, 0x06, 0xbb, 0xa0,
+    0x01, 0x34, 0xff, 0x00, 0x03, 0xac, 0xb1, 0x04, 0x00, 0x34, 0xff, 0x00, 0x9b, 0xc0, 0x08, 0x00, 0x00, 0x34, 0xff,
+    0x8a, 0xe1, 0x0e, 0x00, 0x00, 0x00, 0x34, 0xff, 0xda, 0xf4, 0x3a, 0x00, 0x00, 0x00, 0x34, 0xff, 0x1d, 0x77, 0xd8,
+    0x08, 0x00, 0x00, 0x34, 0xff, 0x00, 0x04, 0xd0, 0x8a, 0x00, 0x00, 0x34, 0xff, 0x00, 0x00, 0x34, 0xf9, 0x36, 0x00,
+    0x34, 0xff, 0x00, 0x00, 0x00, 0x8e, 0xd4, 0x06, 0xbc, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0xbc, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x78, 0x08, 0x08, 0x08, 0x05, 0xbc,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x80, 0xff, 0x41, 0x00, 0x10, 0xfa, 0xb8, 0x80, 0xdf, 0x96, 0x00, 0x5f, 0xde, 0xb8,
+    0x80, 0x9c, 0xd4, 0x02, 0xb3, 0x89, 0xb8, 0x80, 0x98, 0x9a, 0x4d, 0xcc, 0x60, 0xb8, 0x80, 0x98, 0x43, 0xe2, 0x7e,
+    0x60, 0xb8, 0x80, 0x98, 0x03, 0xbc, 0x26, 0x60, 0xb8, 0x80, 0x98, 0x00, 0x00, 0x00, 0x60, 0xb8, 0x80, 0x98, 0x00,
+    0x00, 0x00, 0x60, 0xb8, 0x80, 0x98, 0x00, 0x00, 0x00, 0x60, 0xb8, 0x30, 0xff, 0x82, 0x00, 0x00, 0xb8, 0x6c, 0x30,
+    0xfd, 0xe0, 0x03, 0x00, 0xb8, 0x6c, 0x30, 0xf8, 0xad, 0x4f, 0x00, 0xb8, 0x6c, 0x30, 0xf8, 0x47, 0xb6, 0x00, 0xb8,
+    0x6c, 0x30, 0xf8, 0x01, 0xdc, 0x1e, 0xb8, 0x6c, 0x30, 0xf8, 0x00, 0x7a, 0x82, 0xb8, 0x6c, 0x30, 0xf8, 0x00, 0x18,
+    0xe0, 0xbb, 0x6c, 0x30, 0xf8, 0x00, 0x00, 0xae, 0xf6, 0x6c, 0x30, 0xf8, 0x00, 0x00, 0x47, 0xff, 0x6c, 0x00, 0x21,
+    0xc2, 0xf6, 0xda, 0x47, 0x00, 0x00, 0xc5, 0x93, 0x08, 0x5a, 0xf2, 0x10, 0x1c, 0xff, 0x1a, 0x00, 0x00, 0xdd, 0x57,
+    0x43, 0xf6, 0x00, 0x00, 0x00, 0xba, 0x7d, 0x4d, 0xed, 0x00, 0x00, 0x00, 0xb2, 0x89, 0x43, 0xf6, 0x00, 0x00, 0x00,
+    0xba, 0x7d, 0x1d, 0xff, 0x1a, 0x00, 0x00, 0xdc, 0x57, 0x00, 0xc8, 0x93, 0x07, 0x5a, 0xf2, 0x10, 0x00, 0x24, 0xc4,
+    0xf7, 0xda, 0x47, 0x00, 0xfc, 0xf6, 0xf4, 0xe1, 0x80, 0x00, 0xfc, 0x34, 0x00, 0x30, 0xef, 0x53, 0xfc, 0x34, 0x00,
+    0x00, 0xbb, 0x80, 0xfc, 0x34, 0x01, 0x38, 0xf2, 0x51, 0xfc, 0xf6, 0xf2, 0xda, 0x7a, 0x00, 0xfc, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0xc2, 0xf6, 0xda, 0x47, 0x00, 0x00, 0x00, 0xc5, 0x93, 0x08, 0x5a, 0xf2, 0x10, 0x00, 0x1c, 0xff,
+    0x1a, 0x00, 0x00, 0xdd, 0x57, 0x00, 0x43, 0xf6, 0x00, 0x00, 0x00, 0xba, 0x7d, 0x00, 0x4e, 0xed, 0x00, 0x00, 0x00,
+    0xb2, 0x88, 0x00, 0x43, 0xf6, 0x00, 0x00, 0x00, 0xba, 0x7b, 0x00, 0x1c, 0xff, 0x1a, 0x00, 0x00, 0xdc, 0x56, 0x00,
+    0x00, 0xc3, 0x93, 0x07, 0x5a, 0xee, 0x11, 0x00, 0x00, 0x20, 0xc1, 0xf8, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xaf, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbd, 0x96, 0x00, 0x28, 0xff, 0xf4, 0xf2, 0xcf, 0x4a,
+    0x00, 0x00, 0x28, 0xff, 0x08, 0x02, 0x65, 0xf6, 0x13, 0x00, 0x28, 0xff, 0x08, 0x00, 0x07, 0xff, 0x39, 0x00, 0x28,
+    0xff, 0x08, 0x04, 0x65, 0xed, 0x0f, 0x00, 0x28, 0xff, 0xf4, 0xfc, 0xdf, 0x28, 0x00, 0x00, 0x28, 0xff, 0x08, 0x0c,
+    0xb6, 0x8e, 0x00, 0x00, 0x28, 0xff, 0x08, 0x00, 0x24, 0xf6, 0x1c, 0x00, 0x28, 0xff, 0x08, 0x00, 0x00, 0xaf, 0x8b,
+    0x00, 0x28, 0xff, 0x08, 0x00, 0x00, 0x40, 0xf1, 0x0f, 0x00, 0x33, 0xc2, 0xf1, 0xe9, 0xa4, 0x00, 0x04, 0xe6, 0x64,
+    0x02, 0x17, 0x6d, 0x00, 0x24, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe8, 0xa4, 0x3c, 0x05, 0x00, 0x00, 0x00,
+    0x2a, 0xac, 0xf1, 0xee, 0x77, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb,
+    0x68, 0x0e, 0x7d, 0x1c, 0x00, 0x36, 0xf0, 0x34, 0x0a, 0xaf, 0xe8, 0xf4, 0xd9, 0x64, 0x00, 0xaf, 0xf4, 0xf4, 0xff,
+    0xf6, 0xf4, 0xec, 0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x38,
+    0x00, 0x00, 0x24, 0xff, 0x10, 0x00, 0x00, 0xd0, 0x60, 0x24, 0xff, 0x10, 0x00, 0x00, 0xd0, 0x60, 0x24, 0xff, 0x10,
+    0x00, 0x00, 0xd0, 0x60, 0x24, 0xff, 0x10, 0x00, 0x00, 0xd0, 0x60, 0x24, 0xff, 0x10, 0x00, 0x00, 0xd0, 0x60, 0x23,
+    0xff, 0x10, 0x00, 0x00, 0xd0, 0x5f, 0x17, 0xff, 0x12, 0x00, 0x00, 0xd3, 0x54, 0x00, 0xe0, 0x70, 0x04, 0x3a, 0xf6,
+    0x22, 0x00, 0x38, 0xcb, 0xf4, 0xe0, 0x5f, 0x00, 0x88, 0xb0, 0x00, 0x00, 0x00, 0x75, 0xc3, 0x3e, 0xf0, 0x03, 0x00,
+    0x00, 0xb7, 0x7a, 0x04, 0xf0, 0x35, 0x00, 0x04, 0xf3, 0x31, 0x00, 0xac, 0x77, 0x00, 0x3a, 0xe7, 0x01, 0x00, 0x62,
+    0xb9, 0x00, 0x7c, 0x9f, 0x00, 0x00, 0x1a, 0xf4, 0x06, 0xbd, 0x56, 0x00, 0x00, 0x00, 0xd0, 0x44, 0xf3, 0x11, 0x00,
+    0x00, 0x00, 0x86, 0xc0, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0x7c, 0x00, 0x00, 0xed, 0x36, 0x00, 0x00, 0x00,
+    0x01, 0xf9, 0x29, 0xc8, 0x54, 0x00, 0x00, 0x00, 0x18, 0xfd, 0x07, 0xa3, 0x72, 0x18, 0xff, 0x54, 0x36, 0xdf, 0x00,
+    0x7e, 0x90, 0x4a, 0xe8, 0x86, 0x53, 0xba, 0x00, 0x58, 0xae, 0x7b, 0x83, 0xb8, 0x70, 0x95, 0x00, 0x33, 0xcc, 0xac,
+    0x2b, 0xd6, 0x8e, 0x70, 0x00, 0x0e, 0xe9, 0xd1, 0x02, 0xb7, 0xc7, 0x4b, 0x00, 0x00, 0xe7, 0xbf, 0x00, 0x81, 0xfe,
+    0x26, 0x00, 0x00, 0xc3, 0x8a, 0x00, 0x4b, 0xfc, 0x05, 0x00, 0x35, 0xf2, 0x1a, 0x00, 0x00, 0x9e, 0xa0, 0x00, 0x00,
+    0x9a, 0xa0, 0x00, 0x33, 0xeb, 0x15, 0x00, 0x00, 0x13, 0xea, 0x33, 0xc4, 0x64, 0x00, 0x00, 0x00, 0x00, 0x66, 0xe7,
+    0xc5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x97, 0xea, 0x1a, 0x00,
+    0x00, 0x00, 0x5a, 0xda, 0x07, 0x88, 0xa4, 0x00, 0x00, 0x0f, 0xe7, 0x49, 0x00, 0x0e, 0xea, 0x3d, 0x00, 0x95, 0xb0,
+    0x00, 0x00, 0x00, 0x6b, 0xd0, 0x03, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x85, 0xbf, 0x00, 0x0a, 0xe5, 0x4a, 0x00, 0x18,
+    0xf2, 0x2f, 0x00, 0x00, 0x60, 0xd1, 0x02, 0x96, 0x9b, 0x00, 0x00, 0x00, 0x02, 0xce, 0x80, 0xed, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x00,
+    0x00, 0x00, 0x35, 0xf4, 0xf4, 0xf4, 0xf4, 0xfe, 0x76, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf1, 0x1c, 0x00, 0x00, 0x00,
+    0x05, 0xd4, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x79, 0xc7, 0x02, 0x00, 0x00, 0x00, 0x22, 0xf0, 0x2b, 0x00, 0x00, 0x00,
+    0x00, 0xb7, 0x82, 0x00, 0x00, 0x00, 0x00, 0x57, 0xd8, 0x07, 0x00, 0x00, 0x00, 0x0f, 0xe5, 0x3e, 0x00, 0x00, 0x00,
+    0x00, 0x5a, 0xfe, 0xf4, 0xf4, 0xf4, 0xf4, 0x90, 0x1b, 0xfb, 0xf4, 0xf4, 0x89, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c,
+    0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00,
+    0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00,
+    0x00, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x1b, 0xf7, 0xf4, 0xf4, 0x89, 0x11, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8e, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xef, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x7d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2b, 0xe9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
+    0xdc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xcb, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xd5, 0x40, 0x50, 0xf4, 0xf4, 0xf9, 0x56, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc,
+    0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00,
+    0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00, 0x00, 0xbc, 0x58, 0x00, 0x00,
+    0x00, 0xbc, 0x58, 0x50, 0xf4, 0xf4, 0xf6, 0x55, 0x00, 0x00, 0x0d, 0x7e, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xab, 0xd4,
+    0xd9, 0x0d, 0x00, 0x00, 0x6f, 0xc3, 0x08, 0x8d, 0xaa, 0x00, 0x37, 0xd1, 0x12, 0x00, 0x01, 0xaa, 0x6e, 0x6e, 0xf4,
+    0xf4, 0xf4, 0xf4, 0xf4, 0xa7, 0x15, 0x77, 0x03, 0x00, 0x00, 0x99, 0x75, 0x00, 0x00, 0x07, 0xc5, 0x27, 0x00, 0x73,
+    0xdc, 0xf0, 0xd2, 0x4c, 0x00, 0x00, 0x30, 0x0f, 0x00, 0x21, 0xe9, 0x11, 0x00, 0x45, 0xc5, 0xee, 0xf4, 0xfe, 0x36,
+    0x0c, 0xf2, 0x5c, 0x05, 0x00, 0xe2, 0x3b, 0x2c, 0xe8, 0x00, 0x00, 0x11, 0xfe, 0x3d, 0x0f, 0xf5, 0x36, 0x05, 0x9c,
+    0xf7, 0x49, 0x00, 0x61, 0xe8, 0xe9, 0x81, 0xa0, 0x76, 0xdc, 0x38, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0xdc, 0x38, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x87, 0xe5, 0xed, 0x61, 0x00, 0xdc, 0xbe, 0x10, 0x3a, 0xf5,
+    0x20, 0xdc, 0x52, 0x00, 0x00, 0xb9, 0x6c, 0xdc, 0x3b, 0x00, 0x00, 0xa1, 0x80, 0xdc, 0x51, 0x00, 0x00, 0xb9, 0x68,
+    0xdc, 0xbd, 0x0e, 0x37, 0xf4, 0x1d, 0xdc, 0x80, 0xe8, 0xec, 0x5e, 0x00, 0x00, 0x06, 0x8f, 0xea, 0xef, 0xb3, 0x05,
+    0x00, 0x8a, 0xc3, 0x18, 0x07, 0x60, 0x08, 0x00, 0xe8, 0x46, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe8, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd0, 0x19, 0x04, 0x4e, 0x07, 0x00, 0x07, 0x93,
+    0xeb, 0xf0, 0xbb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x00, 0x30, 0xce, 0xf2, 0x83, 0xf8, 0x20, 0x02, 0xd9, 0x6f, 0x09, 0x89, 0xff,
+    0x20, 0x2b, 0xf4, 0x04, 0x00, 0x15, 0xff, 0x20, 0x41, 0xe0, 0x00, 0x00, 0x00, 0xfc, 0x20, 0x2b, 0xf4, 0x04, 0x00,
+    0x15, 0xff, 0x20, 0x01, 0xdb, 0x6d, 0x08, 0x86, 0xff, 0x20, 0x00, 0x31, 0xdb, 0xf3, 0x8a, 0xea, 0x20, 0x00, 0x19,
+    0xb4, 0xf0, 0xda, 0x53, 0x00, 0x00, 0xc3, 0x97, 0x06, 0x26, 0xe9, 0x1f, 0x22, 0xfa, 0x0c, 0x00, 0x00, 0xa2, 0x69,
+    0x3c, 0xfe, 0xf4, 0xf4, 0xf4, 0xf6, 0x80, 0x1f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x08, 0x08,
+    0x40, 0x23, 0x00, 0x16, 0xa6, 0xe9, 0xf0, 0xc2, 0x28, 0x00, 0x00, 0x00, 0x8a, 0xef, 0xf4, 0x13, 0x00, 0x00, 0x21,
+    0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x40, 0xd0, 0x00, 0x00, 0x00, 0x03, 0xf4, 0xf7, 0xfd, 0xf4, 0xf4, 0x13, 0x00,
+    0x00, 0x44, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd0,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xc6, 0xf0, 0xa8, 0xc2, 0x48, 0x00, 0xae, 0x97, 0x07, 0x60, 0xff, 0x48, 0x04, 0xfb,
+    0x24, 0x00, 0x00, 0xe8, 0x48, 0x16, 0xff, 0x0d, 0x00, 0x00, 0xd1, 0x48, 0x04, 0xfb, 0x27, 0x00, 0x01, 0xe9, 0x48,
+    0x00, 0xaf, 0x9c, 0x06, 0x60, 0xfe, 0x48, 0x00, 0x18, 0xc7, 0xf5, 0xa5, 0xcf, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe2, 0x2e, 0x00, 0x2f, 0x32, 0x02, 0x50, 0xe3, 0x05, 0x00, 0x46, 0xe4, 0xf4, 0xcf, 0x39, 0x00, 0xdc, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0xdc, 0x38, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x38, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x7b, 0xdd, 0xf2,
+    0x70, 0x00, 0xdc, 0xb4, 0x07, 0x41, 0xf7, 0x05, 0xdc, 0x4d, 0x00, 0x00, 0xf3, 0x22, 0xdc, 0x38, 0x00, 0x00, 0xec,
+    0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c,
+    0x00, 0x15, 0xf1, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0xf4, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x18, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x59, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0xe2, 0xf4, 0x63, 0x00, 0x00, 0x4e, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf4, 0xf6, 0xe8,
+    0x00, 0x00, 0x2c, 0xe8, 0x00, 0x00, 0x2c, 0xe8, 0x00, 0x00, 0x2c, 0xe8, 0x00, 0x00, 0x2c, 0xe8, 0x00, 0x00, 0x2c,
+    0xe8, 0x00, 0x00, 0x2c, 0xe8, 0x00, 0x00, 0x30, 0xe1, 0x00, 0x00, 0x6f, 0xb8, 0x94, 0xf5, 0xdb, 0x32, 0xac, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0xac, 0x70, 0x00, 0x00, 0x00, 0x00, 0xac, 0x70, 0x00, 0x00, 0x00, 0x00, 0xac, 0x70, 0x00,
+    0x3e, 0xe3, 0x2e, 0xac, 0x70, 0x38, 0xe3, 0x34, 0x00, 0xac, 0xa2, 0xf0, 0x42, 0x00, 0x00, 0xac, 0xf0, 0xc3, 0x90,
+    0x00, 0x00, 0xac, 0x75, 0x17, 0xea, 0x43, 0x00, 0xac, 0x70, 0x00, 0x57, 0xe3, 0x10, 0xac, 0x70, 0x00, 0x00, 0xaa,
+    0xa6, 0xe4, 0xf6, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x34, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x6c, 0xec, 0xf4, 0x2d, 0x5c, 0xc7, 0xe5, 0xa8, 0xab, 0xea, 0x37, 0x5c, 0xc8, 0x0d, 0xf6, 0x50, 0x78, 0x91, 0x5c,
+    0xa2, 0x00, 0xdc, 0x26, 0x56, 0xa7, 0x5c, 0xa0, 0x00, 0xd8, 0x24, 0x54, 0xab, 0x5c, 0xa0, 0x00, 0xd8, 0x24, 0x54,
+    0xac, 0x5c, 0xa0, 0x00, 0xd8, 0x24, 0x54, 0xac, 0x5c, 0xa0, 0x00, 0xd8, 0x24, 0x54, 0xac, 0xdc, 0x6c, 0xde, 0xec,
+    0x68, 0x00, 0xdc, 0xb3, 0x0b, 0x41, 0xf4, 0x08, 0xdc, 0x4b, 0x00, 0x00, 0xf3, 0x23, 0xdc, 0x38, 0x00, 0x00, 0xec,
+    0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c,
+    0x00, 0x21, 0xbc, 0xf0, 0xd2, 0x42, 0x00, 0x00, 0xc4, 0x8c, 0x06, 0x53, 0xef, 0x10, 0x14, 0xff, 0x12, 0x00, 0x00,
+    0xd4, 0x4f, 0x2c, 0xfa, 0x00, 0x00, 0x00, 0xba, 0x67, 0x16, 0xff, 0x13, 0x00, 0x00, 0xd4, 0x50, 0x00, 0xc8, 0x8c,
+    0x05, 0x53, 0xf0, 0x11, 0x00, 0x24, 0xbf, 0xf1, 0xd4, 0x44, 0x00, 0xe4, 0x76, 0xe8, 0xe1, 0x5a, 0x00, 0xe4, 0xbf,
+    0x0d, 0x34, 0xf3, 0x1b, 0xe4, 0x52, 0x00, 0x00, 0xbb, 0x62, 0xe4, 0x3a, 0x00, 0x00, 0xa6, 0x78, 0xe4, 0x53, 0x00,
+    0x00, 0xbb, 0x61, 0xe4, 0xc1, 0x0d, 0x33, 0xf2, 0x19, 0xe4, 0x90, 0xea, 0xe1, 0x57, 0x00, 0xe4, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xc7, 0xf3, 0x98,
+    0xd6, 0x34, 0x00, 0xc4, 0x88, 0x06, 0x77, 0xff, 0x34, 0x14, 0xff, 0x12, 0x00, 0x07, 0xfa, 0x34, 0x2d, 0xfa, 0x00,
+    0x00, 0x00, 0xea, 0x34, 0x19, 0xff, 0x12, 0x00, 0x08, 0xfb, 0x34, 0x00, 0xca, 0x86, 0x05, 0x7a, 0xff, 0x34, 0x00,
+    0x27, 0xd6, 0xf4, 0x98, 0xe4, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4,
+    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x38, 0xc8, 0x66, 0xe7, 0xf1, 0x56, 0x38, 0xf0, 0x94, 0x0b, 0x15,
+    0x30, 0x38, 0xf9, 0x0b, 0x00, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x38, 0xdc, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x38, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc0, 0xf1, 0xe9, 0x7f, 0x00, 0x9f,
+    0x8d, 0x02, 0x0f, 0x3f, 0x00, 0x9c, 0xa9, 0x19, 0x00, 0x00, 0x00, 0x17, 0x9c, 0xe4, 0xdd, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0xf6, 0x02, 0x51, 0x1e, 0x00, 0x50, 0xe8, 0x00, 0x84, 0xe4, 0xf4, 0xd2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x9c, 0x00, 0x00, 0x00, 0x39,
+    0xf4, 0xf9, 0xfb, 0xf4, 0xf4, 0x0f, 0x00, 0x00, 0x78, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x9c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xc9,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbb, 0xf3, 0xf4, 0x0f, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00,
+    0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xdc, 0x38, 0x00, 0x00, 0xec, 0x2c, 0xd4, 0x3f, 0x00, 0x04,
+    0xfb, 0x2c, 0xad, 0x8f, 0x03, 0x70, 0xfd, 0x2c, 0x2f, 0xda, 0xf0, 0x80, 0xdc, 0x2c, 0x3e, 0xdc, 0x00, 0x00, 0x00,
+    0xa2, 0x7c, 0x02, 0xe6, 0x31, 0x00, 0x05, 0xee, 0x27, 0x00, 0x93, 0x84, 0x00, 0x47, 0xd1, 0x00, 0x00, 0x3e, 0xd7,
+    0x00, 0x9a, 0x7b, 0x00, 0x00, 0x02, 0xe6, 0x2e, 0xe9, 0x26, 0x00, 0x00, 0x00, 0x94, 0xbe, 0xd0, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xff, 0x7a, 0x00, 0x00, 0xe4, 0x29, 0x00, 0x00, 0x00, 0x00, 0xed, 0x1f, 0xad, 0x5e, 0x00, 0x00, 0x00,
+    0x21, 0xe7, 0x00, 0x75, 0x92, 0x04, 0xe7, 0x31, 0x55, 0xaf, 0x00, 0x3d, 0xc6, 0x39, 0xd1, 0x75, 0x88, 0x77, 0x00,
+    0x09, 0xf1, 0x7e, 0x4d, 0xb1, 0xbc, 0x3f, 0x00, 0x00, 0xcd, 0xda, 0x07, 0xb3, 0xeb, 0x0b, 0x00, 0x00, 0x94, 0xb7,
+    0x00, 0x77, 0xcf, 0x00, 0x00, 0x13, 0xe3, 0x39, 0x00, 0x14, 0xe6, 0x39, 0x00, 0x46, 0xd9, 0x0a, 0xaa, 0x83, 0x00,
+    0x00, 0x00, 0x91, 0xc8, 0xcb, 0x05, 0x00, 0x00, 0x00, 0x2a, 0xff, 0x64, 0x00, 0x00, 0x00, 0x03, 0xc5, 0x95, 0xe4,
+    0x17, 0x00, 0x00, 0x7d, 0xba, 0x01, 0x7c, 0xb7, 0x01, 0x36, 0xeb, 0x1c, 0x00, 0x03, 0xc8, 0x70, 0x37, 0xe8, 0x03,
+    0x00, 0x00, 0x8b, 0x96, 0x00, 0xdb, 0x42, 0x00, 0x00, 0xdf, 0x3c, 0x00, 0x82, 0x99, 0x00, 0x37, 0xe1, 0x01, 0x00,
+    0x27, 0xeb, 0x04, 0x8d, 0x88, 0x00, 0x00, 0x00, 0xcd, 0x48, 0xe1, 0x2d, 0x00, 0x00, 0x00, 0x72, 0xd1, 0xd5, 0x00,
+    0x00, 0x00, 0x00, 0x1a, 0xfd, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xc6,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0xe2, 0x34, 0x00, 0x00, 0x00, 0xa3, 0xf4, 0xf4, 0xf4, 0xff, 0x1c, 0x00, 0x00, 0x00,
+    0x73, 0xc9, 0x05, 0x00, 0x00, 0x3a, 0xe7, 0x1e, 0x00, 0x00, 0x14, 0xe1, 0x49, 0x00, 0x00, 0x02, 0xb8, 0x83, 0x00,
+    0x00, 0x00, 0x7d, 0xbc, 0x02, 0x00, 0x00, 0x00, 0xd0, 0xf8, 0xf4, 0xf4, 0xf4, 0x1a, 0x00, 0x00, 0x00, 0x7a, 0xe5,
+    0xab, 0x00, 0x00, 0x0a, 0xfc, 0x33, 0x00, 0x00, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0xf3, 0x00, 0x00, 0x00, 0x03, 0x77, 0xce, 0x00, 0x00, 0x3d, 0xf9, 0xfb, 0x4d, 0x00, 0x00, 0x00,
+    0x01, 0x68, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x83, 0xe5, 0xab, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4,
+    0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x20, 0x72, 0xeb,
+    0xa7, 0x05, 0x00, 0x00, 0x00, 0x11, 0xe4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x56, 0x00, 0x00, 0x00, 0x00, 0xbc,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x63, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc3, 0x19, 0x00, 0x00, 0x00, 0x21, 0xea,
+    0xff, 0x82, 0x00, 0x00, 0x9c, 0xb4, 0x11, 0x00, 0x00, 0x00, 0xba, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x57, 0x00,
+    0x00, 0x00, 0x10, 0xdf, 0x44, 0x00, 0x00, 0x72, 0xea, 0xaf, 0x06, 0x00, 0x00, 0x05, 0xad, 0xe5, 0x5b, 0x00, 0x30,
+    0xb5, 0x4a, 0xad, 0x19, 0xd7, 0x3e, 0x6e, 0x8c, 0x73, 0x72, 0x00, 0x30, 0xdb, 0xd2, 0x1c, 0xc8, 0x70, 0xc8, 0x70,
+    0xbe, 0x67, 0x9e, 0x4c, 0x7d, 0x31, 0x00, 0x00, 0x90, 0x4f, 0xb4, 0x67, 0x70, 0x5c, 0xac, 0x20, 0x70, 0x5c, 0xac,
+    0x20, 0x67, 0x54, 0x9e, 0x1d, 0x00, 0x00, 0xaf, 0x0d, 0xbc, 0x00, 0x00, 0x00, 0xba, 0x0f, 0xac, 0x00, 0x5e, 0xd7,
+    0xec, 0xdd, 0xe6, 0x8b, 0x00, 0x58, 0x65, 0x78, 0x44, 0x00, 0x00, 0x85, 0x39, 0xa5, 0x16, 0x00, 0xcc, 0xf0, 0xd3,
+    0xf3, 0xd0, 0x1d, 0x01, 0xba, 0x10, 0xaa, 0x00, 0x00, 0x2a, 0x91, 0x4a, 0x71, 0x00, 0x00, 0x00, 0x00, 0x74, 0x60,
+    0x00, 0x00, 0x00, 0x4e, 0xd6, 0xd2, 0x63, 0x00, 0x0a, 0xd3, 0x5b, 0x43, 0x34, 0x00, 0x0c, 0xdd, 0x62, 0x3c, 0x00,
+    0x00, 0x00, 0x59, 0xda, 0xc9, 0x43, 0x00, 0x00, 0x00, 0x50, 0x5f, 0xdf, 0x0a, 0x0d, 0x21, 0x50, 0x3e, 0xd5, 0x11,
+    0x10, 0xbe, 0xe7, 0xe3, 0x7c, 0x00, 0x00, 0x00, 0x74, 0x60, 0x00, 0x00, 0x00, 0x00, 0x27, 0x21, 0x00, 0x00, 0x41,
+    0xc9, 0x72, 0x00, 0x00, 0x00, 0xac, 0x09, 0xac, 0x07, 0x00, 0x00, 0xae, 0x07, 0xa6, 0x07, 0x00, 0x16, 0x43, 0xce,
+    0x75, 0x3a, 0x9f, 0x3e, 0x00, 0x27, 0x8e, 0x63, 0x04, 0x00, 0x6b, 0x67, 0x19, 0xb9, 0xc4, 0x22, 0x02, 0x00, 0x5a,
+    0x5c, 0x3e, 0x7a, 0x00, 0x00, 0x1b, 0xcc, 0xd1, 0x2c, 0x00, 0x68, 0xde, 0xd2, 0x06, 0x00, 0x00, 0xd4, 0x0a, 0x08,
+    0x01, 0x00, 0x00, 0xbc, 0x24, 0x00, 0x00, 0x00, 0x09, 0xbb, 0xba, 0x00, 0x00, 0x00, 0x7d, 0x5e, 0x94, 0x65, 0x37,
+    0x7e, 0xb3, 0x20, 0x0b, 0xcf, 0x74, 0x58, 0x88, 0x75, 0x00, 0x56, 0xf3, 0x07, 0x10, 0xb0, 0xd3, 0xbd, 0xb1, 0x57,
+    0x90, 0x3c, 0x90, 0x3c, 0x84, 0x37, 0x00, 0x82, 0x41, 0x08, 0xc7, 0x00, 0x4e, 0x8b, 0x00, 0x86, 0x5c, 0x00, 0x9e,
+    0x48, 0x00, 0x95, 0x50, 0x00, 0x6d, 0x73, 0x00, 0x24, 0xb1, 0x00, 0x00, 0xb4, 0x14, 0x00, 0x2e, 0x2e, 0x92, 0x31,
+    0x00, 0x29, 0xa7, 0x00, 0x00, 0xd3, 0x07, 0x00, 0xac, 0x35, 0x00, 0x99, 0x4d, 0x00, 0xa0, 0x44, 0x00, 0xc3, 0x1c,
+    0x0b, 0xca, 0x00, 0x5c, 0x6d, 0x00, 0x54, 0x08, 0x00, 0x00, 0x00, 0x72, 0x18, 0x00, 0x00, 0x1d, 0x23, 0x7c, 0x25,
+    0x3e, 0x00, 0x17, 0x92, 0xe7, 0xd0, 0x69, 0x02, 0x00, 0x18, 0xbc, 0xa9, 0x00, 0x00, 0x00, 0x8f, 0x21, 0x6c, 0x47,
+    0x00, 0x00, 0x0f, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x8c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x8c, 0x3c, 0x00, 0x00, 0x7b, 0xd0, 0xea, 0xdb, 0xd0, 0x3a, 0x00, 0x00, 0x8c, 0x3c, 0x00, 0x00, 0x00,
+    0x00, 0x8c, 0x3c, 0x00, 0x00, 0x00, 0x98, 0x5c, 0x00, 0xb6, 0xa8, 0x00, 0x1c, 0x87, 0x09, 0xa7, 0x1a, 0x00, 0x0f,
+    0x00, 0x09, 0xd0, 0xd0, 0xd0, 0x98, 0x98, 0x4f, 0xb8, 0x63, 0x00, 0x00, 0x00, 0x1b, 0xc3, 0x00, 0x00, 0x00, 0x80,
+    0x60, 0x00, 0x00, 0x03, 0xd3, 0x09, 0x00, 0x00, 0x4f, 0x92, 0x00, 0x00, 0x00, 0xb6, 0x2b, 0x00, 0x00, 0x20, 0xc1,
+    0x00, 0x00, 0x00, 0x87, 0x5c, 0x00, 0x00, 0x05, 0xd5, 0x07, 0x00, 0x00, 0x53, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x64,
+    0xdc, 0xd3, 0x2a, 0x00, 0x09, 0xde, 0x0e, 0x48, 0xae, 0x00, 0x42, 0xa9, 0x6a, 0x20, 0xeb, 0x01, 0x5a, 0x93, 0x99,
+    0x46, 0xe3, 0x0f, 0x5a, 0x92, 0x97, 0x49, 0xe4, 0x0e, 0x42, 0xaa, 0x68, 0x27, 0xeb, 0x01, 0x09, 0xde, 0x0f, 0x46,
+    0xae, 0x00, 0x00, 0x64, 0xdd, 0xd2, 0x2a, 0x00, 0x00, 0xae, 0xa0, 0x00, 0x00, 0x6e, 0xdf, 0xa0, 0x00, 0x00, 0x7e,
+    0x5a, 0xa0, 0x00, 0x00, 0x00, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x50, 0xa0, 0x00, 0x00,
+    0x00, 0x50, 0xa0, 0x00, 0x00, 0xa8, 0xea, 0xf4, 0xe0, 0x0a, 0x24, 0xca, 0xd4, 0xc3, 0x26, 0x23, 0x2d, 0x00, 0x51,
+    0xaf, 0x00, 0x00, 0x00, 0x2d, 0xc7, 0x00, 0x00, 0x00, 0x85, 0x82, 0x00, 0x00, 0x38, 0xd0, 0x0a, 0x00, 0x1a, 0xd7,
+    0x28, 0x00, 0x07, 0xc2, 0x43, 0x00, 0x00, 0x48, 0xf3, 0xd0, 0xd0, 0xb9, 0x13, 0xcb, 0xcf, 0xca, 0x3b, 0x00, 0x05,
+    0x0b, 0x00, 0x30, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x43, 0xbd, 0x00, 0x00, 0x1a, 0xd6, 0xef, 0x2d, 0x00, 0x00, 0x00,
+    0x00, 0x43, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x01, 0x1b, 0x0e, 0x00, 0x30, 0xd8, 0x00, 0x39, 0xd8, 0xd2,
+    0xce, 0x3c, 0x00, 0x00, 0x00, 0x18, 0xf3, 0x50, 0x00, 0x00, 0x00, 0x97, 0xbe, 0x50, 0x00, 0x00, 0x2f, 0x92, 0x9c,
+    0x50, 0x00, 0x00, 0xb1, 0x18, 0x9c, 0x50, 0x00, 0x4d, 0x84, 0x00, 0x9c, 0x50, 0x00, 0x7d, 0xdf, 0xdc, 0xf1, 0xe7,
+    0x33, 0x00, 0x00, 0x00, 0x9c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x50, 0x00, 0x0c, 0xf6, 0xd0, 0xd0, 0x5b, 0x0c,
+    0xcc, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0xd2, 0xb2, 0x20, 0x03, 0x16, 0x00, 0x65, 0xb6,
+    0x00, 0x00, 0x00, 0x0b, 0xe5, 0x12, 0x06, 0x00, 0x4d, 0xbc, 0x44, 0xdd, 0xd3, 0xc5, 0x28, 0x00, 0x44, 0xd8, 0xd3,
+    0x77, 0x00, 0x08, 0xde, 0x25, 0x00, 0x14, 0x00, 0x3f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xa1, 0xc3, 0xcb, 0x40,
+    0x00, 0x5b, 0xde, 0x10, 0x24, 0xdc, 0x00, 0x45, 0xaa, 0x00, 0x00, 0xdf, 0x0a, 0x0c, 0xcf, 0x07, 0x18, 0xe1, 0x00,
+    0x00, 0x60, 0xce, 0xd4, 0x50, 0x00, 0x4a, 0xd0, 0xd0, 0xd4, 0xee, 0x00, 0x00, 0x00, 0x4b, 0xa2, 0x00, 0x00, 0x00,
+    0xa0, 0x4f, 0x00, 0x00, 0x05, 0xe2, 0x08, 0x00, 0x00, 0x4a, 0xa8, 0x00, 0x00, 0x00, 0x9f, 0x54, 0x00, 0x00, 0x05,
+    0xe4, 0x0b, 0x00, 0x00, 0x49, 0xad, 0x00, 0x00, 0x00, 0x8e, 0xd5, 0xd4, 0x4e, 0x00, 0x2a, 0xce, 0x02, 0x20, 0xda,
+    0x00, 0x19, 0xcd, 0x06, 0x2d, 0xc3, 0x00, 0x00, 0x76, 0xeb, 0xec, 0x34, 0x00, 0x26, 0xca, 0x09, 0x2d, 0xcf, 0x00,
+    0x5b, 0x93, 0x00, 0x00, 0xe4, 0x0b, 0x3c, 0xc6, 0x03, 0x1f, 0xe4, 0x00, 0x00, 0x8f, 0xd6, 0xd3, 0x4d, 0x00, 0x00,
+    0x97, 0xd4, 0xc5, 0x23, 0x00, 0x3f, 0xb6, 0x01, 0x38, 0xa8, 0x00, 0x5f, 0x86, 0x00, 0x02, 0xe9, 0x00, 0x37, 0xc1,
+    0x04, 0x47, 0xfd, 0x04, 0x00, 0x82, 0xd1, 0x9f, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x09, 0xde, 0x00, 0x00, 0x11, 0x00,
+    0x70, 0x93, 0x00, 0x00, 0xbe, 0xda, 0xbb, 0x15, 0x00, 0xb5, 0x6e, 0x8d, 0x53, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x6e,
+    0x8d, 0x53, 0x00, 0x9b, 0x4f, 0x00, 0xc6, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x66, 0x00, 0xb7,
+    0xb9, 0x00, 0x12, 0x9b, 0x09, 0xa4, 0x2d, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x2c,
+    0x92, 0xca, 0x2c, 0x46, 0xba, 0x9d, 0x3d, 0x00, 0x00, 0x51, 0xbf, 0x87, 0x28, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xa4,
+    0xc1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0x7b, 0xd0, 0xd0, 0xd0, 0xd0, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7b, 0xd0, 0xd0, 0xd0, 0xd0, 0x3a, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xc8, 0x72, 0x14, 0x00, 0x00,
+    0x00, 0x09, 0x5b, 0xb5, 0xa5, 0x1c, 0x00, 0x02, 0x46, 0xa3, 0xb3, 0x22, 0x5c, 0xca, 0x85, 0x21, 0x00, 0x00, 0x22,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x90, 0xd1, 0xd8, 0x47, 0x31, 0x00, 0x3f, 0xbe, 0x00, 0x00, 0x78, 0x88, 0x00, 0x49,
+    0xbc, 0x06, 0x00, 0xae, 0x31, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x9e, 0x30, 0x00, 0x00, 0xc1, 0x41, 0x00, 0x00,
+    0x40, 0xc4, 0xce, 0x74, 0x00, 0x21, 0xc5, 0x1e, 0x01, 0x96, 0x30, 0x91, 0x32, 0x52, 0xcc, 0xad, 0x66, 0xb0, 0x01,
+    0xc4, 0x09, 0x76, 0x70, 0xaf, 0x10, 0xa3, 0x00, 0x3b, 0x70, 0xad, 0x01, 0xc4, 0x09, 0x78, 0x70, 0x84, 0x41, 0x53,
+    0xcd, 0xa6, 0x65, 0x13, 0xc9, 0x32, 0x00, 0x02, 0x00, 0x00, 0x29, 0xae, 0xd5, 0x95, 0x00, 0x00, 0x00, 0xda, 0x89,
+    0x00, 0x00, 0x00, 0x1d, 0xc6, 0xc8, 0x00, 0x00, 0x00, 0x61, 0x7b, 0xc9, 0x12, 0x00, 0x00, 0xa5, 0x3d, 0x8e, 0x53,
+    0x00, 0x00, 0xdf, 0x07, 0x4f, 0x97, 0x00, 0x2c, 0xf6, 0xdc, 0xde, 0xd9, 0x00, 0x6f, 0x80, 0x00, 0x00, 0xd0, 0x1e,
+    0xb2, 0x42, 0x00, 0x00, 0x93, 0x62, 0x3c, 0xf1, 0xcf, 0xd2, 0x5b, 0x00, 0x3c, 0xb4, 0x00, 0x0f, 0xe7, 0x00, 0x3c,
+    0xb4, 0x00, 0x1f, 0xe0, 0x00, 0x3c, 0xf1, 0xd1, 0xf4, 0x5b, 0x00, 0x3c, 0xb4, 0x00, 0x18, 0xda, 0x0c, 0x3c, 0xb4,
+    0x00, 0x00, 0xb8, 0x36, 0x3c, 0xb4, 0x00, 0x09, 0xdc, 0x1b, 0x3c, 0xf1, 0xd0, 0xd4, 0x6c, 0x00, 0x00, 0x29, 0xc5,
+    0xd7, 0xbf, 0x02, 0xd3, 0x38, 0x00, 0x32, 0x30, 0xc6, 0x00, 0x00, 0x00, 0x53, 0xa6, 0x00, 0x00, 0x00, 0x4f, 0xa5,
+    0x00, 0x00, 0x00, 0x2e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x38, 0x00, 0x27, 0x00, 0x30, 0xc6, 0xd4, 0xbd, 0x60,
+    0xeb, 0xd0, 0xa1, 0x0e, 0x00, 0x60, 0x90, 0x00, 0x71, 0xa3, 0x00, 0x60, 0x90, 0x00, 0x06, 0xef, 0x02, 0x60, 0x90,
+    0x00, 0x00, 0xe5, 0x15, 0x60, 0x90, 0x00, 0x00, 0xe5, 0x15, 0x60, 0x90, 0x00, 0x06, 0xef, 0x02, 0x60, 0x90, 0x00,
+    0x70, 0xa4, 0x00, 0x60, 0xeb, 0xd0, 0xa3, 0x0f, 0x00, 0x18, 0xf8, 0xd0, 0xd0, 0xd0, 0x00, 0x18, 0xd8, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf8, 0xd0, 0xd0, 0xb2, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf8, 0xd0, 0xd0, 0xd0, 0x10,
+    0xec, 0xd0, 0xd0, 0xd0, 0x1a, 0xec, 0x04, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x00, 0xec, 0xd0, 0xd0, 0xaf,
+    0x00, 0xec, 0x04, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0xd6, 0xd2, 0x98, 0x00, 0x0d, 0xdf, 0x1f, 0x00, 0x3f, 0x00, 0x5a, 0x9c, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x79, 0x00, 0xa5, 0xe3, 0x15, 0x5b, 0x98, 0x00, 0x00, 0xcc, 0x18,
+    0x0e, 0xde, 0x1b, 0x00, 0xce, 0x18, 0x00, 0x43, 0xd7, 0xcf, 0xa2, 0x07, 0x60, 0x90, 0x00, 0x00, 0xe0, 0x10, 0x60,
+    0x90, 0x00, 0x00, 0xe0, 0x10, 0x60, 0x90, 0x00, 0x00, 0xe0, 0x10, 0x60, 0xeb, 0xd0, 0xd0, 0xfa, 0x10, 0x60, 0x90,
+    0x00, 0x00, 0xe0, 0x10, 0x60, 0x90, 0x00, 0x00, 0xe0, 0x10, 0x60, 0x90, 0x00, 0x00, 0xe0, 0x10, 0x60, 0x90, 0x00,
+    0x00, 0xe0, 0x10, 0x10, 0xd0, 0xee, 0xdf, 0x9c, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00,
+    0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00,
+    0x10, 0xd0, 0xee, 0xdf, 0x9c, 0x00, 0x3a, 0xd0, 0xe8, 0x68, 0x00, 0x00, 0x00, 0x84, 0x68, 0x00, 0x00, 0x00, 0x84,
+    0x68, 0x00, 0x00, 0x00, 0x84, 0x68, 0x00, 0x00, 0x00, 0x84, 0x68, 0x00, 0x00, 0x00, 0x88, 0x63, 0x3e, 0x10, 0x00,
+    0xb5, 0x45, 0x53, 0xda, 0xd8, 0xae, 0x03, 0x60, 0x90, 0x00, 0x11, 0xd2, 0x34, 0x60, 0x90, 0x03, 0xb8, 0x5b, 0x00,
+    0x60, 0x90, 0x8d, 0x89, 0x00, 0x00, 0x60, 0xdb, 0xfb, 0x16, 0x00, 0x00, 0x60, 0xd7, 0x7f, 0x98, 0x00, 0x00, 0x60,
+    0x90, 0x06, 0xd9, 0x31, 0x00, 0x60, 0x90, 0x00, 0x51, 0xc4, 0x00, 0x60, 0x90, 0x00, 0x00, 0xc0, 0x5c, 0x04, 0xec,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xfd, 0xe0, 0xe0, 0xe0, 0x38, 0x9c, 0xc7, 0x00, 0x1d, 0xff, 0x48, 0x9c, 0xd6, 0x14, 0x68, 0xd7,
+    0x48, 0x9c, 0x8d, 0x5c, 0xa6, 0x9a, 0x48, 0x9c, 0x4a, 0xa6, 0xa3, 0x94, 0x48, 0x9c, 0x40, 0xb6, 0x62, 0x94, 0x48,
+    0x9c, 0x40, 0x17, 0x09, 0x94, 0x48, 0x9c, 0x40, 0x00, 0x00, 0x94, 0x48, 0x9c, 0x40, 0x00, 0x00, 0x94, 0x48, 0x5c,
+    0xf4, 0x0b, 0x00, 0xdc, 0x0c, 0x5c, 0xf3, 0x5a, 0x00, 0xdc, 0x0c, 0x5c, 0xa5, 0xb0, 0x00, 0xdc, 0x0c, 0x5c, 0x8c,
+    0xb6, 0x12, 0xdc, 0x0c, 0x5c, 0x8c, 0x61, 0x66, 0xdc, 0x0c, 0x5c, 0x8c, 0x0e, 0xb7, 0xdc, 0x0c, 0x5c, 0x8c, 0x00,
+    0xaa, 0xf1, 0x0c, 0x5c, 0x8c, 0x00, 0x51, 0xff, 0x0c, 0x00, 0x68, 0xd3, 0xce, 0x37, 0x00, 0x1c, 0xdd, 0x09, 0x38,
+    0xc9, 0x00, 0x58, 0x9e, 0x00, 0x00, 0xea, 0x0b, 0x6f, 0x8a, 0x00, 0x00, 0xd7, 0x22, 0x6f, 0x8a, 0x00, 0x00, 0xd7,
+    0x22, 0x58, 0x9e, 0x00, 0x00, 0xea, 0x0b, 0x1c, 0xdd, 0x09, 0x38, 0xc9, 0x00, 0x00, 0x69, 0xd3, 0xce, 0x37, 0x00,
+    0x34, 0xf2, 0xd0, 0xd5, 0x57, 0x00, 0x34, 0xb8, 0x00, 0x1d, 0xeb, 0x06, 0x34, 0xb8, 0x00, 0x00, 0xdc, 0x1e, 0x34,
+    0xb8, 0x00, 0x2b, 0xea, 0x05, 0x34, 0xf2, 0xd0, 0xc8, 0x48, 0x00, 0x34, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xd3, 0xcb, 0x34, 0x00, 0x1c, 0xdd, 0x09,
+    0x38, 0xc8, 0x00, 0x58, 0x9e, 0x00, 0x00, 0xea, 0x0b, 0x6f, 0x8a, 0x00, 0x00, 0xd7, 0x22, 0x6a, 0x8a, 0x00, 0x00,
+    0xd7, 0x20, 0x54, 0x9e, 0x00, 0x00, 0xe9, 0x0b, 0x13, 0xdb, 0x09, 0x38, 0xc8, 0x00, 0x00, 0x6e, 0xdc, 0xf3, 0x39,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x26, 0x58, 0xec, 0xd0, 0xc9, 0x2e, 0x00,
+    0x58, 0x98, 0x00, 0x4f, 0xbd, 0x00, 0x58, 0x98, 0x00, 0x17, 0xe3, 0x00, 0x58, 0x98, 0x00, 0x59, 0xb4, 0x00, 0x58,
+    0xec, 0xd8, 0xe0, 0x1a, 0x00, 0x58, 0x98, 0x00, 0x84, 0x79, 0x00, 0x58, 0x98, 0x00, 0x0c, 0xde, 0x0c, 0x58, 0x98,
+    0x00, 0x00, 0x89, 0x73, 0x00, 0x7e, 0xd2, 0xd8, 0x7c, 0x00, 0x33, 0xba, 0x02, 0x01, 0x30, 0x00, 0x51, 0xa3, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xdd, 0xc2, 0x6f, 0x0a, 0x00, 0x00, 0x0b, 0x58, 0xb5, 0xba, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xe3, 0x06, 0x20, 0x23, 0x00, 0x19, 0xe0, 0x00, 0x29, 0xcd, 0xd4, 0xd2, 0x51, 0x00, 0xa2, 0xd0, 0xee, 0xdf, 0xd0,
+    0x61, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0x50, 0x00, 0x00, 0x54, 0x9c, 0x00, 0x00, 0xec, 0x54, 0x9c, 0x00, 0x00, 0xec, 0x54, 0x9c, 0x00, 0x00,
+    0xec, 0x54, 0x9c, 0x00, 0x00, 0xec, 0x53, 0x9c, 0x00, 0x00, 0xeb, 0x4e, 0x9c, 0x00, 0x00, 0xe9, 0x2c, 0xc6, 0x02,
+    0x1d, 0xd2, 0x00, 0x89, 0xd6, 0xd8, 0x46, 0x9c, 0x58, 0x00, 0x00, 0xa6, 0x4b, 0x5c, 0x92, 0x00, 0x00, 0xdc, 0x0e,
+    0x1b, 0xcb, 0x00, 0x1a, 0xc9, 0x00, 0x00, 0xd6, 0x0a, 0x55, 0x89, 0x00, 0x00, 0x9a, 0x40, 0x90, 0x49, 0x00, 0x00,
+    0x5a, 0x7a, 0xc6, 0x0d, 0x00, 0x00, 0x19, 0xbd, 0xc2, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x88, 0x00, 0x00, 0xe4, 0x00,
+    0x00, 0x00, 0x45, 0x9e, 0xcf, 0x0e, 0x00, 0x00, 0x5f, 0x7d, 0xae, 0x28, 0xbb, 0x6a, 0x79, 0x5c, 0x8d, 0x42, 0xc4,
+    0x97, 0x93, 0x3b, 0x6c, 0x72, 0x94, 0xaa, 0xad, 0x1a, 0x4b, 0xba, 0x63, 0xa5, 0xc0, 0x01, 0x2a, 0xf8, 0x31, 0x82,
+    0xd0, 0x00, 0x09, 0xf9, 0x06, 0x51, 0xb8, 0x00, 0x59, 0xa3, 0x00, 0x00, 0xca, 0x30, 0x01, 0xcb, 0x25, 0x4f, 0xa2,
+    0x00, 0x00, 0x49, 0xa3, 0xc8, 0x1f, 0x00, 0x00, 0x00, 0xc7, 0x92, 0x00, 0x00, 0x00, 0x12, 0xdc, 0xbf, 0x00, 0x00,
+    0x00, 0x8f, 0x6c, 0xa5, 0x48, 0x00, 0x21, 0xd7, 0x06, 0x29, 0xca, 0x01, 0xa6, 0x5c, 0x00, 0x00, 0xa7, 0x54, 0x95,
+    0x63, 0x00, 0x00, 0xb8, 0x43, 0x1c, 0xd3, 0x02, 0x30, 0xc4, 0x00, 0x00, 0x96, 0x55, 0xa7, 0x45, 0x00, 0x00, 0x1d,
+    0xd4, 0xc3, 0x00, 0x00, 0x00, 0x00, 0xac, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x50, 0x00, 0x00, 0x51, 0xd0, 0xd0, 0xd1, 0xff, 0x10, 0x00, 0x00, 0x00, 0x5c,
+    0xa8, 0x00, 0x00, 0x00, 0x07, 0xd8, 0x21, 0x00, 0x00, 0x00, 0x73, 0x8a, 0x00, 0x00, 0x00, 0x10, 0xd9, 0x0f, 0x00,
+    0x00, 0x00, 0x8a, 0x6c, 0x00, 0x00, 0x00, 0x1d, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x7b, 0xe9, 0xd0, 0xd0, 0xd0, 0x27,
+    0x77, 0xd8, 0xd0, 0x4e, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00,
+    0x00, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00, 0x00, 0x84, 0x58, 0x00, 0x00, 0x77, 0xd8,
+    0xd0, 0x4e, 0x35, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x66, 0x79, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0xd1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x97, 0x48, 0x00, 0x00, 0x00, 0x00, 0x30, 0xaf, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x61, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcf, 0x02, 0x8f,
+    0xd0, 0xdf, 0x2f, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34,
+    0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x00, 0x00, 0xa8, 0x34, 0x8f, 0xd0, 0xdf,
+    0x2f, 0x00, 0x0c, 0xda, 0x99, 0x00, 0x00, 0x00, 0x9e, 0x5c, 0xaa, 0x4d, 0x00, 0x51, 0x8d, 0x00, 0x0b, 0xbd, 0x17,
+    0x75, 0xd0, 0xd0, 0xd0, 0xd0, 0x34, 0x58, 0x85, 0x00, 0x00, 0x94, 0x31, 0x00, 0xbd, 0xcf, 0xca, 0x3c, 0x00, 0x00,
+    0x1a, 0x00, 0x16, 0xc6, 0x00, 0x02, 0x8c, 0xce, 0xd0, 0xe4, 0x00, 0x47, 0xb3, 0x05, 0x06, 0xe4, 0x00, 0x4f, 0x94,
+    0x00, 0x58, 0xee, 0x00, 0x07, 0xba, 0xca, 0x8a, 0xcc, 0x12, 0x1c, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xbc, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0xce, 0xb9, 0xe2, 0x4d, 0x00, 0x1c, 0xf4, 0x17, 0x1a, 0xd9, 0x01, 0x1c, 0xc6, 0x00, 0x00,
+    0xce, 0x14, 0x1c, 0xc5, 0x00, 0x00, 0xce, 0x12, 0x1c, 0xf4, 0x16, 0x19, 0xd5, 0x00, 0x1c, 0xc5, 0xba, 0xe0, 0x4c,
+    0x00, 0x00, 0x44, 0xd0, 0xd1, 0x87, 0x07, 0xe1, 0x23, 0x00, 0x23, 0x34, 0xba, 0x00, 0x00, 0x00, 0x34, 0xb9, 0x00,
+    0x00, 0x00, 0x07, 0xe1, 0x22, 0x00, 0x1e, 0x00, 0x47, 0xd3, 0xd1, 0x8b, 0x00, 0x00, 0x00, 0x0c, 0xd0, 0x00, 0x00,
+    0x00, 0x0c, 0xd0, 0x00, 0x89, 0xd7, 0x9d, 0xd0, 0x2f, 0xc4, 0x01, 0x5b, 0xd0, 0x63, 0x82, 0x00, 0x16, 0xd0, 0x64,
+    0x81, 0x00, 0x16, 0xd0, 0x2f, 0xc3, 0x00, 0x59, 0xd0, 0x00, 0x8e, 0xda, 0x93, 0xcd, 0x00, 0x6a, 0xd8, 0xd2, 0x54,
+    0x00, 0x22, 0xbb, 0x04, 0x09, 0xd0, 0x04, 0x5f, 0xe6, 0xd0, 0xd0, 0xe1, 0x1c, 0x5c, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0xd3, 0x0e, 0x00, 0x34, 0x00, 0x00, 0x5f, 0xd3, 0xd7, 0xb0, 0x00, 0x00, 0x00, 0x6e, 0xd6, 0xa2, 0x00, 0x00,
+    0xd1, 0x0c, 0x00, 0x30, 0xd0, 0xf8, 0xd0, 0xa2, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+    0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x6c, 0xdc, 0xa5, 0xd2,
+    0x12, 0xd9, 0x09, 0x39, 0xf0, 0x41, 0xa2, 0x00, 0x00, 0xe1, 0x41, 0xa3, 0x00, 0x00, 0xe3, 0x12, 0xda, 0x0a, 0x37,
+    0xf0, 0x00, 0x6e, 0xdc, 0xa3, 0xd6, 0x00, 0x0b, 0x00, 0x22, 0xbf, 0x00, 0x94, 0xd3, 0xd0, 0x37, 0x18, 0xc0, 0x00,
+    0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x00, 0x18, 0xcc, 0xb0, 0xe2, 0x4c, 0x18, 0xf2, 0x14, 0x28, 0xbc, 0x18, 0xc7,
+    0x00, 0x01, 0xd5, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x00,
+    0x92, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xee, 0x38, 0x00, 0x00, 0x00, 0xa4, 0x38, 0x00, 0x00,
+    0x00, 0xa4, 0x38, 0x00, 0x00, 0x00, 0xa3, 0x38, 0x00, 0x00, 0x00, 0x8e, 0x54, 0x00, 0x00, 0x00, 0x29, 0xd3, 0xd0,
+    0x06, 0x00, 0x16, 0xa4, 0x00, 0x00, 0x00, 0x5e, 0xd0, 0xdb, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xd8,
+    0x00, 0x00, 0xd8, 0x00, 0x00, 0xd8, 0x00, 0x17, 0xc7, 0xbc, 0xd9, 0x53, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x00, 0x4e, 0xb5, 0x04, 0xe0, 0x36, 0xc1, 0x0b, 0x00, 0xea, 0xe8, 0x56, 0x00, 0x00, 0xeb,
+    0x41, 0xd5, 0x0a, 0x00, 0xe0, 0x00, 0x78, 0x8c, 0x00, 0xe0, 0x00, 0x05, 0xcf, 0x32, 0x23, 0xd0, 0xf7, 0x0c, 0x00,
+    0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x00, 0xd0, 0x0c,
+    0x00, 0x00, 0x00, 0xcf, 0x0c, 0x00, 0x00, 0x00, 0xbd, 0x26, 0x00, 0x00, 0x00, 0x4c, 0xda, 0xb2, 0x80, 0xb9, 0xd4,
+    0x9e, 0xcf, 0x04, 0x80, 0x5a, 0x99, 0x53, 0x99, 0x2b, 0x80, 0x48, 0x85, 0x40, 0x88, 0x39, 0x80, 0x48, 0x84, 0x40,
+    0x88, 0x3c, 0x80, 0x48, 0x84, 0x40, 0x88, 0x3c, 0x80, 0x48, 0x84, 0x40, 0x88, 0x3c, 0x18, 0xc1, 0xb3, 0xde, 0x4e,
+    0x18, 0xf2, 0x13, 0x28, 0xbd, 0x18, 0xc5, 0x00, 0x01, 0xd6, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x18, 0xc0, 0x00, 0x00,
+    0xd8, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x00, 0x72, 0xd4, 0xcf, 0x37, 0x00, 0x20, 0xd1, 0x06, 0x2f, 0xcc, 0x00, 0x52,
+    0x93, 0x00, 0x00, 0xe0, 0x04, 0x52, 0x93, 0x00, 0x00, 0xe1, 0x04, 0x22, 0xd5, 0x07, 0x2f, 0xcd, 0x00, 0x00, 0x78,
+    0xd5, 0xd0, 0x39, 0x00, 0x20, 0xc3, 0xbb, 0xd5, 0x46, 0x00, 0x20, 0xf7, 0x19, 0x19, 0xd5, 0x00, 0x20, 0xc7, 0x00,
+    0x00, 0xd2, 0x0e, 0x20, 0xc6, 0x00, 0x00, 0xd2, 0x0d, 0x20, 0xf6, 0x18, 0x19, 0xd4, 0x00, 0x20, 0xcf, 0xbc, 0xd6,
+    0x46, 0x00, 0x20, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd5, 0x96, 0xd3,
+    0x20, 0xd1, 0x05, 0x4e, 0xe0, 0x52, 0x92, 0x00, 0x07, 0xdf, 0x55, 0x92, 0x00, 0x07, 0xdf, 0x23, 0xd2, 0x05, 0x4f,
+    0xe0, 0x00, 0x81, 0xda, 0x97, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x9c, 0x74, 0xce,
+    0xd0, 0x09, 0x9c, 0xa5, 0x01, 0x10, 0x03, 0x9c, 0x4f, 0x00, 0x00, 0x00, 0x9c, 0x40, 0x00, 0x00, 0x00, 0x9c, 0x40,
+    0x00, 0x00, 0x00, 0x9c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x72, 0xd4, 0xd5, 0x5a, 0x00, 0xdf, 0x04, 0x01, 0x17, 0x00,
+    0xbd, 0x9c, 0x51, 0x04, 0x00, 0x04, 0x43, 0xaa, 0x90, 0x01, 0x1f, 0x00, 0x38, 0xaf, 0x02, 0xc9, 0xd4, 0xd4, 0x36,
+    0x00, 0x02, 0x9c, 0x00, 0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x51, 0xd0, 0xf7, 0xd0, 0x9f, 0x00, 0x04, 0xd4, 0x00,
+    0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x02, 0x00, 0x00, 0x00, 0x8c,
+    0xd8, 0x9f, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x18, 0xc0, 0x00, 0x00, 0xd8, 0x16, 0xc1,
+    0x00, 0x06, 0xd8, 0x04, 0xde, 0x06, 0x48, 0xd8, 0x00, 0x87, 0xdd, 0x8d, 0xce, 0x62, 0x7d, 0x00, 0x00, 0xcc, 0x16,
+    0x16, 0xc7, 0x00, 0x1b, 0xc4, 0x00, 0x00, 0xc4, 0x17, 0x67, 0x76, 0x00, 0x00, 0x78, 0x62, 0xb3, 0x28, 0x00, 0x00,
+    0x2a, 0xb6, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xda, 0x8b, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x40, 0x95, 0xb3, 0x1d,
+    0x1e, 0x0c, 0x6e, 0x62, 0x80, 0x4c, 0xac, 0x60, 0x9d, 0x2f, 0x4d, 0x7d, 0x98, 0x90, 0xc3, 0x04, 0x19, 0xd6, 0x65,
+    0x95, 0xbf, 0x00, 0x00, 0xe6, 0x24, 0x75, 0x95, 0x00, 0x2c, 0xbf, 0x01, 0x23, 0xc9, 0x04, 0x00, 0x82, 0x67, 0xb5,
+    0x36, 0x00, 0x00, 0x07, 0xd2, 0x93, 0x00, 0x00, 0x00, 0x19, 0xd7, 0xb1, 0x00, 0x00, 0x00, 0xae, 0x47, 0x98, 0x5b,
+    0x00, 0x55, 0xa5, 0x00, 0x0f, 0xd2, 0x17, 0x58, 0x8a, 0x00, 0x00, 0xbe, 0x23, 0x0a, 0xd3, 0x00, 0x16, 0xc7, 0x00,
+    0x00, 0xa5, 0x35, 0x68, 0x72, 0x00, 0x00, 0x4c, 0x8b, 0xbb, 0x1c, 0x00, 0x00, 0x05, 0xd4, 0xbe, 0x00, 0x00, 0x00,
+    0x00, 0x9f, 0x6c, 0x00, 0x00, 0x00, 0x02, 0xce, 0x18, 0x00, 0x00, 0x20, 0xdc, 0x7d, 0x00, 0x00, 0x00, 0x00, 0xc6,
+    0xd0, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x93, 0x69, 0x00, 0x00, 0x45, 0xb4, 0x00, 0x00, 0x11, 0xcf, 0x17, 0x00, 0x00,
+    0xa8, 0x4f, 0x00, 0x00, 0x0f, 0xfa, 0xd0, 0xd0, 0xa5, 0x00, 0x00, 0x51, 0xcf, 0x64, 0x00, 0x00, 0xb3, 0x34, 0x00,
+    0x00, 0x00, 0xbc, 0x20, 0x00, 0x00, 0x05, 0xda, 0x13, 0x00, 0x54, 0xea, 0xa3, 0x00, 0x00, 0x00, 0x09, 0xdc, 0x0a,
+    0x00, 0x00, 0x00, 0xbe, 0x1e, 0x00, 0x00, 0x00, 0xbb, 0x20, 0x00, 0x00, 0x00, 0xaa, 0x3d, 0x00, 0x00, 0x00, 0x41,
+    0xcc, 0x64, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c, 0x3c, 0x8c,
+    0x3c, 0x8c, 0x3c, 0xa5, 0xc3, 0x1c, 0x00, 0x00, 0x00, 0x86, 0x62, 0x00, 0x00, 0x00, 0x70, 0x6c, 0x00, 0x00, 0x00,
+    0x62, 0x9f, 0x01, 0x00, 0x00, 0x0e, 0xe3, 0xe6, 0x1a, 0x00, 0x57, 0xad, 0x03, 0x00, 0x00, 0x6e, 0x6f, 0x00, 0x00,
+    0x00, 0x70, 0x6b, 0x00, 0x00, 0x00, 0x8e, 0x5a, 0x00, 0x00, 0xa5, 0xba, 0x11, 0x00, 0x00, 0x15, 0xc3, 0x83, 0x00,
+    0x64, 0x40, 0x71, 0x4a, 0x8f, 0x47, 0x99, 0x26, 0x85, 0x20, 0x0c, 0xb9, 0x9b, 0x00, 0x00, 0xfc, 0x20, 0x00, 0xfb,
+    0x1f, 0x00, 0xe0, 0x09, 0x00, 0xa3, 0x00, 0x00, 0x13, 0x00, 0x05, 0xe6, 0x25, 0x94, 0x24, 0xb8, 0x94, 0x24, 0xb8,
+    0x17, 0x05, 0x1c, 0x00, 0x09, 0xa1, 0x4a, 0x62, 0x00, 0x56, 0xc3, 0xc7, 0xdc, 0xae, 0x1a, 0x00, 0x93, 0x18, 0xab,
+    0x00, 0x00, 0xbd, 0xeb, 0xc7, 0xe2, 0x81, 0x00, 0x0c, 0x9f, 0x55, 0x53, 0x00, 0x00, 0x3e, 0x6e, 0x8a, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x00, 0x82, 0xe5, 0xb0, 0x26, 0x25, 0xad, 0x80, 0x03, 0x0b, 0x0c, 0xc9, 0xbe,
+    0x26, 0x00, 0x00, 0x0d, 0xa2, 0xae, 0x5a, 0x0d, 0x08, 0x80, 0x30, 0x9e, 0x1d, 0xc1, 0xe4, 0xd1, 0x35, 0x00, 0x00,
+    0xb1, 0x14, 0x00, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x5e, 0xc4, 0x55, 0x00, 0x00, 0x00, 0xa3, 0x02, 0xa1, 0x00, 0x04,
+    0x00, 0x62, 0xc6, 0x96, 0x7a, 0x78, 0x00, 0x68, 0x7d, 0x74, 0xc4, 0x7c, 0x00, 0x01, 0x00, 0x93, 0x0e, 0xa6, 0x01,
+    0x00, 0x00, 0x49, 0xca, 0x98, 0x00, 0x00, 0x9f, 0xc7, 0x84, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x01, 0x00, 0x00, 0x09,
+    0xc7, 0x5e, 0x00, 0x00, 0x00, 0x91, 0x2f, 0xa1, 0x3e, 0xa1, 0x01, 0xb1, 0x2a, 0x08, 0xb5, 0x93, 0x00, 0x2f, 0xc5,
+    0xbf, 0x9a, 0xbb, 0x03, 0xb8, 0xb8, 0x1c, 0x00, 0xaa, 0x07, 0x3f, 0x82, 0x00, 0x91, 0x3c, 0x00, 0xba, 0x18, 0x00,
+    0xb9, 0x18, 0x00, 0x8f, 0x3d, 0x00, 0x3c, 0x84, 0x00, 0x00, 0xa7, 0x07, 0xa8, 0x0b, 0x55, 0x6b, 0x0f, 0xbb, 0x00,
+    0xd2, 0x00, 0xd3, 0x11, 0xba, 0x61, 0x69, 0xaf, 0x0a, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x35, 0x65, 0xa7, 0x58, 0x49,
+    0x00, 0x46, 0xf9, 0x6b, 0x00, 0x00, 0x88, 0x33, 0x9c, 0x00, 0x00, 0x25, 0x00, 0x23, 0x03, 0x00, 0x00, 0xb4, 0x00,
+    0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x78, 0xc0, 0xed, 0xc0, 0x99, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xb4,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x05, 0xec, 0x3c, 0x00, 0x73, 0x39, 0x23, 0x7e, 0x00, 0x1b, 0xc0, 0xc0, 0xc0, 0x3c,
+    0x00, 0x11, 0x00, 0x06, 0xe7, 0x1f, 0x00, 0x00, 0x00, 0x7d, 0x4f, 0x00, 0x00, 0x06, 0xc3, 0x02, 0x00, 0x00, 0x5f,
+    0x6d, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x42, 0x8c, 0x00, 0x00, 0x00, 0xaf, 0x1f, 0x00, 0x00, 0x26, 0xa8,
+    0x00, 0x00, 0x00, 0x3a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x98, 0xc3, 0xaf, 0x0a, 0x38, 0xab, 0x8a, 0x7f, 0x64, 0x64,
+    0x71, 0xcd, 0x45, 0x8f, 0x64, 0x71, 0x8e, 0x46, 0x8f, 0x38, 0xab, 0x00, 0x7f, 0x64, 0x00, 0x98, 0xc4, 0xb0, 0x0a,
+    0x00, 0x21, 0xe5, 0x48, 0x00, 0x00, 0xac, 0xaa, 0x48, 0x00, 0x00, 0x02, 0x8c, 0x48, 0x00, 0x00, 0x00, 0x8c, 0x48,
+    0x00, 0x00, 0x00, 0x8c, 0x48, 0x00, 0x00, 0xa4, 0xe1, 0xcf, 0x6f, 0x31, 0xc5, 0xc1, 0xb3, 0x0c, 0x13, 0x07, 0x00,
+    0x90, 0x57, 0x00, 0x00, 0x00, 0xb1, 0x24, 0x00, 0x00, 0x7f, 0x55, 0x00, 0x00, 0x79, 0x54, 0x00, 0x00, 0x4a, 0xe9,
+    0xc0, 0xc0, 0x54, 0x21, 0xba, 0xbe, 0xbd, 0x1a, 0x00, 0x00, 0x00, 0x84, 0x5b, 0x00, 0x39, 0xd1, 0xce, 0x08, 0x00,
+    0x00, 0x00, 0x79, 0x6d, 0x09, 0x00, 0x00, 0x67, 0x81, 0x47, 0xc5, 0xc1, 0xbd, 0x17, 0x00, 0x00, 0x60, 0xe9, 0x00,
+    0x00, 0x14, 0x97, 0xd8, 0x00, 0x00, 0x97, 0x1e, 0xd8, 0x00, 0x42, 0x7b, 0x00, 0xd8, 0x00, 0x7c, 0xb9, 0xb4, 0xf4,
+    0x89, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x20, 0xe9, 0xc0, 0xc0, 0x09, 0x20, 0xe3, 0xc5, 0x7f, 0x00, 0x07, 0x0a, 0x04,
+    0xb1, 0x46, 0x00, 0x00, 0x00, 0x69, 0x72, 0x0e, 0x00, 0x00, 0x9d, 0x4e, 0x54, 0xd2, 0xc6, 0x9c, 0x02, 0x00, 0x78,
+    0xbe, 0xb3, 0x17, 0x2b, 0xbd, 0xc0, 0xa4, 0x0b, 0x60, 0xbc, 0x02, 0x75, 0x6d, 0x65, 0x82, 0x00, 0x3e, 0x93, 0x3b,
+    0xae, 0x00, 0x64, 0x75, 0x00, 0x9c, 0xc3, 0xb8, 0x11, 0x51, 0xc0, 0xc0, 0xde, 0x73, 0x00, 0x00, 0x00, 0xb7, 0x19,
+    0x00, 0x00, 0x26, 0xac, 0x00, 0x00, 0x00, 0x90, 0x47, 0x00, 0x00, 0x0a, 0xce, 0x02, 0x00, 0x00, 0x63, 0x7b, 0x00,
+    0x00, 0x0f, 0xbc, 0xc7, 0xc8, 0x26, 0x39, 0xa3, 0x00, 0x7c, 0x65, 0x00, 0xb1, 0xd9, 0xca, 0x0a, 0x4e, 0x95, 0x00,
+    0x69, 0x7a, 0x63, 0x85, 0x00, 0x59, 0x8e, 0x0e, 0xb9, 0xc1, 0xc3, 0x22, 0x0e, 0xba, 0xc0, 0xad, 0x09, 0x65, 0x79,
+    0x00, 0x74, 0x61, 0x5e, 0x87, 0x00, 0x83, 0x8c, 0x08, 0xa2, 0xb9, 0x9f, 0x86, 0x00, 0x00, 0x00, 0x94, 0x50, 0x03,
+    0xc4, 0xc4, 0x97, 0x02, 0x03, 0xe2, 0x26, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0xde, 0x25, 0x00, 0x16, 0x00,
+    0x06, 0xb5, 0x17, 0x0c, 0xe6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0xeb, 0x49, 0x00, 0x5e, 0x4b, 0x24,
+    0x8e, 0x02, 0x00, 0x00, 0x02, 0x48, 0x81, 0x1b, 0x7d, 0xb6, 0x75, 0x18, 0x7d, 0xc4, 0x36, 0x00, 0x00, 0x00, 0x1d,
+    0x7f, 0xb9, 0x67, 0x00, 0x00, 0x00, 0x02, 0x33, 0x78, 0xc0, 0xc0, 0xc0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0xc0, 0xc0, 0xc0, 0x99, 0x6b, 0x59, 0x07, 0x00, 0x00, 0x0e, 0x65, 0xb2, 0x8e, 0x29, 0x00, 0x00, 0x27, 0xab, 0xa6,
+    0x4b, 0xb4, 0x91, 0x2b, 0x00, 0x2d, 0x08, 0x00, 0x00, 0x00, 0xa8, 0xc4, 0xc7, 0x17, 0x13, 0x00, 0x91, 0x4a, 0x00,
+    0x45, 0x9f, 0x02, 0x00, 0xc9, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0xe4, 0x05, 0x00, 0x00, 0x5f, 0xc3, 0xbb,
+    0x32, 0x43, 0x99, 0x06, 0x13, 0xac, 0xa1, 0x0b, 0x8d, 0xb8, 0xbd, 0xa0, 0x2d, 0x86, 0x02, 0xb7, 0x9f, 0x2f, 0x85,
+    0x02, 0xb9, 0x9c, 0x13, 0x90, 0xb9, 0xa9, 0x32, 0xac, 0x0f, 0x00, 0x00, 0x00, 0x47, 0xb3, 0xc3, 0x37, 0x00, 0x17,
+    0xf1, 0x40, 0x00, 0x00, 0x00, 0x68, 0x63, 0x90, 0x00, 0x00, 0x00, 0xa1, 0x03, 0xa3, 0x01, 0x00, 0x10, 0xdd, 0xb8,
+    0xd6, 0x36, 0x00, 0x5e, 0x59, 0x00, 0x31, 0x88, 0x00, 0xaf, 0x23, 0x00, 0x03, 0xce, 0x00, 0x4c, 0xe3, 0xbf, 0xc6,
+    0x32, 0x4c, 0x8c, 0x00, 0x63, 0x7c, 0x4c, 0xe3, 0xc5, 0xe1, 0x22, 0x4c, 0x8c, 0x00, 0x43, 0x9f, 0x4c, 0x8c, 0x00,
+    0x2c, 0xb4, 0x4c, 0xe3, 0xbf, 0xc5, 0x3b, 0x00, 0x65, 0xca, 0xc7, 0x5d, 0x25, 0xca, 0x07, 0x00, 0x12, 0x60, 0x85,
+    0x00, 0x00, 0x00, 0x5c, 0x84, 0x00, 0x00, 0x00, 0x22, 0xc9, 0x06, 0x00, 0x0a, 0x00, 0x63, 0xc8, 0xc2, 0x5e, 0x6c,
+    0xdb, 0xc3, 0x8d, 0x02, 0x6c, 0x6c, 0x00, 0x95, 0x59, 0x6c, 0x6c, 0x00, 0x4c, 0x93, 0x6c, 0x6c, 0x00, 0x4d, 0x92,
+    0x6c, 0x6c, 0x00, 0x94, 0x59, 0x6c, 0xdb, 0xc2, 0x8d, 0x02, 0x2c, 0xeb, 0xc0, 0xc0, 0x69, 0x2c, 0xac, 0x00, 0x00,
+    0x00, 0x2c, 0xeb, 0xc0, 0xc0, 0x51, 0x2c, 0xac, 0x00, 0x00, 0x00, 0x2c, 0xac, 0x00, 0x00, 0x00, 0x2c, 0xeb, 0xc0,
+    0xc0, 0x78, 0x04, 0xf5, 0xc0, 0xc0, 0x81, 0x04, 0xd4, 0x00, 0x00, 0x00, 0x04, 0xf5, 0xc0, 0xc0, 0x4e, 0x04, 0xd4,
+    0x00, 0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x00, 0x04, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc5, 0xb7, 0x42, 0x44,
+    0xae, 0x01, 0x00, 0x03, 0x83, 0x5d, 0x12, 0xc5, 0x8c, 0x83, 0x5b, 0x00, 0x2c, 0xa0, 0x44, 0xa8, 0x00, 0x2c, 0xa0,
+    0x00, 0x80, 0xc3, 0xc6, 0x54, 0x6c, 0x6c, 0x00, 0x40, 0x98, 0x6c, 0x6c, 0x00, 0x40, 0x98, 0x6c, 0xdb, 0xc0, 0xd0,
+    0x98, 0x6c, 0x6c, 0x00, 0x40, 0x98, 0x6c, 0x6c, 0x00, 0x40, 0x98, 0x6c, 0x6c, 0x00, 0x40, 0x98, 0x1e, 0xc0, 0xf6,
+    0xc0, 0x3f, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00,
+    0xd8, 0x00, 0x00, 0x1e, 0xc0, 0xf6, 0xc0, 0x3f, 0x00, 0x54, 0xc0, 0xf6, 0x04, 0x00, 0x00, 0x00, 0xd8, 0x04, 0x00,
+    0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x1d, 0x00, 0x02, 0xe0, 0x00, 0x63, 0xca, 0xc6, 0x77, 0x00,
+    0x6c, 0x6c, 0x00, 0x6a, 0x91, 0x00, 0x6c, 0x6c, 0x64, 0x96, 0x00, 0x00, 0x6c, 0xc1, 0xd2, 0x01, 0x00, 0x00, 0x6c,
+    0xa8, 0x9e, 0x57, 0x00, 0x00, 0x6c, 0x6c, 0x0d, 0xcf, 0x1f, 0x00, 0x6c, 0x6c, 0x00, 0x3e, 0xc1, 0x03, 0x18, 0xc0,
+    0x00, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x00, 0x18,
+    0xc0, 0x00, 0x00, 0x00, 0x18, 0xef, 0xbc, 0xbc, 0x92, 0xa4, 0xa9, 0x00, 0x80, 0xcb, 0xa4, 0xb2, 0x10, 0x9c, 0xc8,
+    0xa4, 0x5d, 0x9c, 0x63, 0xc8, 0xa4, 0x24, 0xbb, 0x0f, 0xc8, 0xa4, 0x24, 0x00, 0x00, 0xc8, 0xa4, 0x24, 0x00, 0x00,
+    0xc8, 0x6c, 0xdc, 0x02, 0x3c, 0x98, 0x6c, 0xd7, 0x4b, 0x3c, 0x98, 0x6c, 0x76, 0xab, 0x3c, 0x98, 0x6c, 0x68, 0x91,
+    0x62, 0x98, 0x6c, 0x68, 0x24, 0xcc, 0x98, 0x6c, 0x68, 0x00, 0xb4, 0x98, 0x02, 0xa0, 0xc1, 0xb3, 0x11, 0x4a, 0x9b,
+    0x00, 0x6f, 0x77, 0x77, 0x68, 0x00, 0x3d, 0xa3, 0x78, 0x68, 0x00, 0x3d, 0xa3, 0x4d, 0x9b, 0x00, 0x6f, 0x77, 0x03,
+    0xa5, 0xc2, 0xb6, 0x11, 0x48, 0xe4, 0xc0, 0xc6, 0x29, 0x48, 0x90, 0x00, 0x53, 0x9b, 0x48, 0x90, 0x00, 0x64, 0x95,
+    0x48, 0xe4, 0xc0, 0xb0, 0x1c, 0x48, 0x90, 0x00, 0x00, 0x00, 0x48, 0x90, 0x00, 0x00, 0x00, 0x02, 0xa2, 0xc2, 0xb3,
+    0x12, 0x00, 0x4b, 0x9b, 0x00, 0x6f, 0x77, 0x00, 0x77, 0x68, 0x00, 0x3d, 0xa3, 0x00, 0x77, 0x68, 0x00, 0x3d, 0xa6,
+    0x00, 0x48, 0x9b, 0x00, 0x6f, 0x79, 0x00, 0x02, 0x9e, 0xc6, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x09, 0xbb, 0x35, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x66, 0x00, 0x68, 0xdd, 0xbf, 0xc3, 0x21, 0x00, 0x68, 0x74, 0x00, 0x86, 0x68, 0x00, 0x68,
+    0xdd, 0xd2, 0xb0, 0x0a, 0x00, 0x68, 0x74, 0x05, 0xc3, 0x1c, 0x00, 0x68, 0x74, 0x00, 0x57, 0x89, 0x00, 0x68, 0x74,
+    0x00, 0x06, 0xd6, 0x08, 0x0d, 0xb1, 0xc0, 0xc5, 0x2b, 0x5d, 0x7c, 0x00, 0x03, 0x0b, 0x25, 0xbf, 0x6c, 0x22, 0x00,
+    0x00, 0x05, 0x3a, 0xab, 0x52, 0x10, 0x04, 0x00, 0x4e, 0x8d, 0x3a, 0xc8, 0xc1, 0xc6, 0x2a, 0x99, 0xc0, 0xf5, 0xc1,
+    0xba, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0x00, 0xd4,
+    0x04, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x64, 0x78, 0x00, 0x4c, 0x8c, 0x64, 0x78, 0x00, 0x4c, 0x8c, 0x64, 0x78,
+    0x00, 0x4c, 0x8c, 0x63, 0x78, 0x00, 0x4c, 0x8b, 0x52, 0x8b, 0x00, 0x5f, 0x7d, 0x0c, 0xb6, 0xc4, 0xc5, 0x1a, 0x9d,
+    0x3e, 0x00, 0x15, 0xc6, 0x4e, 0x85, 0x00, 0x5b, 0x79, 0x09, 0xc2, 0x00, 0xa2, 0x2a, 0x00, 0xaf, 0x15, 0xc4, 0x00,
+    0x00, 0x62, 0x8a, 0x8d, 0x00, 0x00, 0x16, 0xf5, 0x3f, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xb9, 0x17, 0xc2, 0x08, 0xf2,
+    0x20, 0xc8, 0x00, 0x9d, 0x4a, 0xc3, 0x52, 0xbe, 0x00, 0x75, 0x9c, 0x58, 0x9b, 0x9f, 0x00, 0x4d, 0xe8, 0x0d, 0xcc,
+    0x77, 0x00, 0x24, 0xd6, 0x00, 0xab, 0x4f, 0x00, 0x52, 0x8f, 0x00, 0x42, 0x9f, 0x00, 0x00, 0xa9, 0x32, 0xc0, 0x12,
+    0x00, 0x00, 0x19, 0xe6, 0x56, 0x00, 0x00, 0x00, 0x46, 0xce, 0x79, 0x00, 0x00, 0x0d, 0xc7, 0x10, 0xb1, 0x26, 0x00,
+    0x97, 0x4f, 0x00, 0x25, 0xbb, 0x01, 0x8c, 0x57, 0x00, 0x2f, 0xb4, 0x00, 0x0d, 0xc5, 0x07, 0xb6, 0x24, 0x00, 0x00,
+    0x5b, 0xb8, 0x83, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x09, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd8, 0x00, 0x00, 0x00, 0x57, 0xc0, 0xc0, 0xdc, 0x96, 0x00, 0x00, 0x09, 0xc5, 0x1c, 0x00, 0x00, 0x92, 0x52, 0x00,
+    0x00, 0x44, 0x98, 0x00, 0x00, 0x11, 0xbb, 0x0a, 0x00, 0x00, 0x7e, 0xdb, 0xc0, 0xc0, 0x87, 0x8f, 0xc4, 0xba, 0xa4,
+    0x20, 0x00, 0xa4, 0x20, 0x00, 0xa4, 0x20, 0x00, 0xa4, 0x20, 0x00, 0xa4, 0x20, 0x00, 0xa4, 0x20, 0x00, 0xa4, 0x20,
+    0x00, 0x8f, 0xc4, 0xba, 0x40, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x5d, 0x71, 0x00, 0x00,
+    0x00, 0x05, 0xc5, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x53, 0x00, 0x00, 0x00, 0x13, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x97,
+    0x34, 0x00, 0x00, 0x00, 0x20, 0x42, 0x99, 0xc0, 0xb4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x99, 0xc0, 0xb4, 0x00, 0x04, 0x77, 0x12, 0x00,
+    0x00, 0x8c, 0x87, 0xad, 0x01, 0x52, 0x7a, 0x00, 0x52, 0x7b, 0x50, 0x84, 0x84, 0x84, 0x67, 0x4d, 0x18, 0x00, 0x14,
+    0x9a, 0x04, 0x0c, 0xc1, 0xc0, 0xb7, 0x0f, 0x04, 0x0d, 0x00, 0x6d, 0x66, 0x12, 0xa3, 0xbf, 0xd5, 0x73, 0x61, 0x77,
+    0x00, 0x7f, 0x77, 0x21, 0xcc, 0xb9, 0x87, 0x96, 0x30, 0x94, 0x00, 0x00, 0x00, 0x30, 0x94, 0x00, 0x00, 0x00, 0x30,
+    0xc1, 0xbb, 0xc3, 0x18, 0x30, 0xc5, 0x00, 0x59, 0x83, 0x30, 0x99, 0x00, 0x2d, 0xa5, 0x30, 0xc4, 0x00, 0x58, 0x83,
+    0x30, 0xba, 0xb9, 0xc2, 0x19, 0x00, 0x6a, 0xd2, 0xc0, 0x37, 0x1d, 0xc2, 0x02, 0x00, 0x0d, 0x44, 0x8a, 0x00, 0x00,
+    0x00, 0x1d, 0xc1, 0x02, 0x00, 0x0b, 0x00, 0x6d, 0xd2, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0x00,
+    0x68, 0x60, 0x06, 0xaf, 0xbf, 0xb6, 0x60, 0x55, 0x81, 0x00, 0x99, 0x60, 0x75, 0x57, 0x00, 0x6d, 0x60, 0x53, 0x81,
+    0x00, 0x98, 0x60, 0x07, 0xb1, 0xbe, 0xae, 0x60, 0x00, 0x8f, 0xc9, 0xb9, 0x15, 0x43, 0x96, 0x00, 0x46, 0x82, 0x71,
+    0xd6, 0xc0, 0xc3, 0x92, 0x4c, 0x81, 0x00, 0x00, 0x07, 0x01, 0x93, 0xbf, 0xbf, 0x55, 0x00, 0x00, 0xa4, 0xc1, 0x42,
+    0x00, 0x06, 0xc0, 0x00, 0x00, 0x39, 0xc3, 0xef, 0xc0, 0x42, 0x00, 0x0c, 0xbc, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0x00,
+    0x00, 0x00, 0x0c, 0xbc, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0x00, 0x00, 0x00, 0x9d, 0xbf, 0xa3, 0x7c, 0x33, 0xa2, 0x00,
+    0x79, 0x7c, 0x55, 0x79, 0x00, 0x4e, 0x7c, 0x35, 0xa7, 0x00, 0x78, 0x7c, 0x00, 0x9e, 0xbe, 0xa8, 0x7a, 0x00, 0x05,
+    0x00, 0x73, 0x5c, 0x00, 0xac, 0xc4, 0xb2, 0x0a, 0x30, 0x98, 0x00, 0x00, 0x00, 0x30, 0x98, 0x00, 0x00, 0x00, 0x30,
+    0xbb, 0xb2, 0xd1, 0x10, 0x30, 0xc3, 0x00, 0x75, 0x58, 0x30, 0x99, 0x00, 0x60, 0x68, 0x30, 0x98, 0x00, 0x60, 0x68,
+    0x30, 0x98, 0x00, 0x60, 0x68, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xe2, 0x00, 0x00, 0x00, 0xc4,
+    0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x00, 0x00, 0x69, 0xcc, 0x6f, 0x00, 0x48, 0x56, 0x00, 0x00,
+    0x00, 0x72, 0xd1, 0x80, 0x00, 0x44, 0x80, 0x00, 0x44, 0x80, 0x00, 0x44, 0x80, 0x00, 0x44, 0x80, 0x00, 0x52, 0x75,
+    0xc0, 0xcc, 0x23, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x05, 0xa9, 0x41, 0x0c,
+    0xc3, 0xa5, 0x49, 0x00, 0x0c, 0xf7, 0xc2, 0x43, 0x00, 0x0c, 0xc0, 0x11, 0xc8, 0x10, 0x0c, 0xc0, 0x00, 0x48, 0xa5,
+    0x30, 0xc0, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc6, 0x51, 0x8c, 0xb7, 0xb6,
+    0xc6, 0x77, 0x8c, 0x33, 0xc7, 0x06, 0xb3, 0x8c, 0x28, 0xb4, 0x00, 0xb4, 0x8c, 0x28, 0xb4, 0x00, 0xb4, 0x8c, 0x28,
+    0xb4, 0x00, 0xb4, 0x30, 0xb2, 0xb1, 0xcd, 0x14, 0x30, 0xc2, 0x00, 0x75, 0x5a, 0x30, 0x99, 0x00, 0x60, 0x68, 0x30,
+    0x98, 0x00, 0x60, 0x68, 0x30, 0x98, 0x00, 0x60, 0x68, 0x01, 0xa1, 0xc2, 0xb7, 0x0f, 0x44, 0x99, 0x00, 0x6d, 0x70,
+    0x64, 0x6a, 0x00, 0x3f, 0x90, 0x44, 0x99, 0x00, 0x6d, 0x70, 0x01, 0xa3, 0xc3, 0xb8, 0x0f, 0x34, 0xb9, 0xbb, 0xbf,
+    0x16, 0x34, 0xc6, 0x01, 0x56, 0x7d, 0x34, 0x9a, 0x00, 0x2e, 0x9c, 0x34, 0xc6, 0x00, 0x56, 0x7c, 0x34, 0xc4, 0xbc,
+    0xbf, 0x16, 0x34, 0x94, 0x00, 0x00, 0x00, 0x34, 0x94, 0x00, 0x00, 0x00, 0x01, 0xa6, 0xbd, 0xab, 0x6c, 0x43, 0x94,
+    0x00, 0x8b, 0x6c, 0x65, 0x6a, 0x00, 0x5e, 0x6c, 0x45, 0x94, 0x00, 0x8b, 0x6c, 0x03, 0xaa, 0xbd, 0xb3, 0x6c, 0x00,
+    0x00, 0x00, 0x58, 0x6c, 0x00, 0x00, 0x00, 0x58, 0x6c, 0xb9, 0x7d, 0xc0, 0x76, 0xbc, 0x4e, 0x00, 0x05, 0xbc, 0x10,
+    0x00, 0x00, 0xbc, 0x0c, 0x00, 0x00, 0xbc, 0x0c, 0x00, 0x00, 0x00, 0xa5, 0xc1, 0xc4, 0x0d, 0x0c, 0xc5, 0x00, 0x05,
+    0x03, 0x00, 0x5f, 0xa0, 0x99, 0x0a, 0x03, 0x04, 0x00, 0x90, 0x48, 0x13, 0xc4, 0xc5, 0xba, 0x0e, 0x00, 0x10, 0x49,
+    0x00, 0x00, 0x00, 0x34, 0x94, 0x00, 0x00, 0x57, 0xcd, 0xe5, 0xc0, 0x3f, 0x00, 0x34, 0x94, 0x00, 0x00, 0x00, 0x34,
+    0x94, 0x00, 0x00, 0x00, 0x2e, 0x9d, 0x00, 0x00, 0x00, 0x07, 0xc2, 0xc0, 0x3f, 0x30, 0x98, 0x00, 0x60, 0x68, 0x30,
+    0x98, 0x00, 0x60, 0x68, 0x30, 0x98, 0x00, 0x60, 0x68, 0x23, 0xaa, 0x00, 0x83, 0x68, 0x00, 0xb2, 0xa6, 0xa4, 0x68,
+    0x6a, 0x60, 0x00, 0x36, 0x94, 0x17, 0xb0, 0x00, 0x8a, 0x3f, 0x00, 0xb7, 0x0e, 0xc4, 0x02, 0x00, 0x69, 0x8b, 0x94,
+    0x00, 0x00, 0x16, 0xf9, 0x3e, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xb1, 0x10, 0xac, 0x11, 0x6b, 0x01, 0xbc, 0x00, 0x75,
+    0x4f, 0xd6, 0x46, 0x9e, 0x00, 0x3d, 0xbf, 0x57, 0xbd, 0x67, 0x00, 0x09, 0xef, 0x06, 0xcf, 0x2f, 0x00, 0x30, 0xa7,
+    0x00, 0x84, 0x55, 0x00, 0x75, 0x8c, 0x9e, 0x00, 0x00, 0x0e, 0xf5, 0x2e, 0x00, 0x00, 0x9c, 0x60, 0xb7, 0x03, 0x54,
+    0x8e, 0x00, 0x64, 0x80, 0x63, 0x6b, 0x00, 0x27, 0xa8, 0x0f, 0xba, 0x00, 0x7e, 0x4b, 0x00, 0xa9, 0x1c, 0xbf, 0x04,
+    0x00, 0x4f, 0x9f, 0x92, 0x00, 0x00, 0x05, 0xec, 0x38, 0x00, 0x00, 0x06, 0xc5, 0x00, 0x00, 0x27, 0xbd, 0x54, 0x00,
+    0x00, 0x09, 0xc0, 0xc0, 0xe3, 0x5b, 0x00, 0x00, 0x1f, 0xc1, 0x0c, 0x00, 0x09, 0xbd, 0x24, 0x00, 0x00, 0xa0, 0x48,
+    0x00, 0x00, 0x25, 0xf1, 0xc0, 0xc0, 0x45, 0x00, 0x00, 0x7b, 0xc3, 0x0f, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00, 0x00,
+    0xc8, 0x00, 0x00, 0x00, 0x12, 0xc7, 0x00, 0x00, 0x5a, 0xe6, 0x65, 0x00, 0x00, 0x00, 0x12, 0xc5, 0x00, 0x00, 0x00,
+    0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00, 0x00, 0x79, 0xc2, 0x0f, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xae, 0x9c, 0x00, 0x00, 0x00, 0xbc, 0x12, 0x00, 0x00, 0xac, 0x1c, 0x00, 0x00, 0x9e, 0x46,
+    0x00, 0x00, 0x43, 0xf5, 0x85, 0x00, 0x9e, 0x47, 0x00, 0x00, 0xac, 0x1c, 0x00, 0x00, 0xbc, 0x12, 0x00, 0xae, 0x9a,
+    0x00, 0x00, 0x38, 0xc5, 0x8c, 0x0b, 0x9b, 0x7c, 0x17, 0x5f, 0xc4, 0x53, 0x98, 0x30, 0x95, 0x2d, 0x7c, 0x18, 0x41,
+    0x04, 0x8e, 0x30, 0x80, 0x84, 0x7a, 0x7d, 0x00, 0x7a, 0x63, 0x14, 0x59, 0xc0, 0xc0, 0x52, 0x05, 0x71, 0x78, 0x00,
+    0xa1, 0xb1, 0xbd, 0x25, 0x68, 0x4b, 0x3c, 0x00, 0x00, 0x69, 0x3c, 0x00, 0x49, 0xab, 0x74, 0x00, 0x3f, 0xbb, 0x37,
+    0x00, 0x00, 0x52, 0x97, 0x28, 0x3c, 0xa7, 0xa9, 0x16, 0x00, 0x60, 0x28, 0x00, 0x00, 0x04, 0x01, 0x00, 0x68, 0x70,
+    0x00, 0x00, 0x6b, 0x71, 0x21, 0x20, 0x01, 0x40, 0x23, 0x00, 0x43, 0x25, 0x7b, 0x33, 0x00, 0x36, 0x7a, 0x50, 0x27,
+    0xa5, 0x50, 0x00, 0x2d, 0x5c, 0x00, 0x00, 0x6f, 0x85, 0x13, 0x53, 0x88, 0x0c, 0x9c, 0x56, 0x5f, 0x89, 0xa7, 0x4c,
+    0x74, 0x10, 0x6e, 0x0f, 0x00, 0x70, 0x0e, 0x00, 0x88, 0x00, 0x08, 0x85, 0x00, 0x15, 0x79, 0x00, 0x00, 0x89, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x2b, 0x10, 0x5e, 0x17, 0x11, 0x74, 0x00, 0x8f, 0x00, 0x8e, 0x01, 0x85, 0x3e, 0x44, 0x3a,
+    0x01, 0x00, 0x5d, 0x00, 0x00, 0x41, 0xb7, 0x7f, 0x13, 0x03, 0x8a, 0x63, 0x00, 0x14, 0x14, 0x29, 0x00, 0x00, 0x4d,
+    0x0b, 0x00, 0x00, 0x70, 0x10, 0x00, 0x6f, 0xc5, 0x9e, 0x36, 0x00, 0x70, 0x10, 0x00, 0x02, 0x00, 0x8d, 0x3f, 0x47,
+    0x33, 0x2e, 0x00, 0x38, 0x90, 0x90, 0x02, 0x0a, 0x00, 0x8f, 0x2e, 0x00, 0x00, 0x86, 0x09, 0x00, 0x08, 0x87, 0x00,
+    0x00, 0x5b, 0x34, 0x00, 0x00, 0x90, 0x00, 0x00, 0x22, 0x6d, 0x00, 0x00, 0x7a, 0x12, 0x00, 0x00, 0x26, 0xa5, 0x95,
+    0x00, 0x81, 0x76, 0x7f, 0x20, 0x95, 0x77, 0x76, 0x36, 0x81, 0x35, 0x74, 0x21, 0x26, 0x9b, 0x90, 0x00, 0x00, 0xaa,
+    0x4c, 0x00, 0x21, 0x8b, 0x4c, 0x00, 0x00, 0x48, 0x4c, 0x00, 0x00, 0x48, 0x4c, 0x00, 0x1e, 0xb5, 0xb6, 0x21, 0x55,
+    0x9d, 0x9e, 0x00, 0x00, 0x00, 0x96, 0x07, 0x00, 0x11, 0x89, 0x00, 0x04, 0x8b, 0x0b, 0x00, 0x76, 0xb0, 0x98, 0x10,
+    0x48, 0x9d, 0xa0, 0x00, 0x00, 0x00, 0x94, 0x0d, 0x00, 0x85, 0xa7, 0x00, 0x00, 0x00, 0x7f, 0x25, 0x57, 0x8c, 0xa5,
+    0x08, 0x00, 0x39, 0xb6, 0x00, 0x01, 0x78, 0x98, 0x00, 0x59, 0x2b, 0x98, 0x00, 0x83, 0x94, 0xd4, 0x30, 0x00, 0x00,
+    0x98, 0x00, 0x64, 0xa6, 0x7d, 0x00, 0x61, 0xa0, 0x6d, 0x00, 0x02, 0x00, 0x95, 0x0f, 0x00, 0x00, 0x83, 0x15, 0x64,
+    0x8d, 0x88, 0x00, 0x1b, 0x9f, 0x84, 0x00, 0x78, 0x84, 0x7e, 0x00, 0x96, 0x25, 0x73, 0x25, 0x85, 0x16, 0x66, 0x30,
+    0x28, 0x98, 0x97, 0x03, 0x5a, 0x98, 0xd1, 0x19, 0x00, 0x00, 0x95, 0x00, 0x00, 0x27, 0x6e, 0x00, 0x00, 0x7e, 0x1b,
+    0x00, 0x00, 0x9a, 0x00, 0x00, 0x3a, 0xaa, 0xa8, 0x04, 0x77, 0x27, 0x86, 0x11, 0x26, 0xc0, 0xa4, 0x00, 0x88, 0x13,
+    0x6e, 0x27, 0x4d, 0x9b, 0xa7, 0x0c, 0x4f, 0x9c, 0x8c, 0x00, 0x94, 0x0b, 0x87, 0x1d, 0x30, 0x92, 0xa6, 0x31, 0x00,
+    0x00, 0x85, 0x17, 0x35, 0x90, 0x87, 0x00, 0x89, 0x31, 0x0e, 0x02, 0x89, 0x32, 0x10, 0x02, 0x00, 0x00, 0x99, 0x31,
+    0x12, 0x02, 0x04, 0x00, 0x8e, 0x4a, 0x3e, 0x40, 0x3d, 0x00, 0x00, 0x00, 0x0e, 0x1a, 0x33, 0x7d, 0x75, 0x16, 0x5d,
+    0x7e, 0x44, 0x02, 0x00, 0x00, 0x41, 0x2f, 0x6f, 0x98, 0x98, 0x36, 0x6f, 0x98, 0x98, 0x36, 0x27, 0x01, 0x00, 0x00,
+    0x3b, 0x82, 0x6e, 0x11, 0x11, 0x65, 0x86, 0x27, 0x53, 0x1c, 0x00, 0x00, 0x29, 0x94, 0xac, 0x00, 0x00, 0x00, 0x99,
+    0x02, 0x00, 0x62, 0x3a, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x8f, 0x15, 0x00, 0x10, 0x7e, 0x89, 0x15, 0x79, 0x5c,
+    0x8f, 0x6b, 0x6f, 0x83, 0x0b, 0x72, 0x6f, 0x4b, 0x7a, 0x50, 0x77, 0x13, 0x00, 0x00, 0x09, 0x78, 0x8b, 0x03, 0x00,
+    0xa5, 0x4d, 0x00, 0x03, 0x8d, 0x87, 0x00, 0x38, 0x5b, 0x93, 0x00, 0x7d, 0xa0, 0xc8, 0x1c, 0x9c, 0x00, 0x3d, 0x61,
+    0x84, 0xa1, 0xaa, 0x08, 0x84, 0x14, 0x7e, 0x24, 0x84, 0x9f, 0xc2, 0x05, 0x84, 0x14, 0x59, 0x42, 0x84, 0x98, 0xa9,
+    0x1d, 0x15, 0xa7, 0x9b, 0x1b, 0x70, 0x2d, 0x00, 0x00, 0x8f, 0x0d, 0x00, 0x00, 0x73, 0x29, 0x00, 0x00, 0x13, 0x99,
+    0x8e, 0x1a, 0x98, 0x98, 0x82, 0x00, 0x98, 0x00, 0x81, 0x1d, 0x98, 0x00, 0x65, 0x39, 0x98, 0x00, 0x80, 0x1e, 0x98,
+    0x90, 0x80, 0x00, 0x6c, 0xa9, 0x98, 0x1c, 0x6c, 0x2c, 0x00, 0x00, 0x6c, 0xa9, 0x98, 0x0e, 0x6c, 0x2c, 0x00, 0x00,
+    0x6c, 0xa9, 0x98, 0x23, 0x50, 0xb5, 0x98, 0x28, 0x50, 0x48, 0x00, 0x00, 0x50, 0xb5, 0x98, 0x0b, 0x50, 0x48, 0x00,
+    0x00, 0x50, 0x48, 0x00, 0x00, 0x21, 0xa4, 0x93, 0x0e, 0x8d, 0x13, 0x00, 0x00, 0x9d, 0x00, 0xa1, 0x2f, 0x8b, 0x0e,
+    0x54, 0x3c, 0x21, 0x99, 0x9d, 0x23, 0x98, 0x00, 0x60, 0x38, 0x98, 0x00, 0x60, 0x38, 0x98, 0x98, 0xbf, 0x38, 0x98,
+    0x00, 0x60, 0x38, 0x98, 0x00, 0x60, 0x38, 0x3d, 0xca, 0xa3, 0x04, 0x00, 0x7c, 0x1c, 0x00, 0x00, 0x7c, 0x1c, 0x00,
+    0x00, 0x7c, 0x1c, 0x00, 0x3d, 0xca, 0xa3, 0x04, 0x00, 0x89, 0xb9, 0x00, 0x00, 0x98, 0x00, 0x00, 0x98, 0x00, 0x00,
+    0x93, 0x74, 0x89, 0x6f, 0x98, 0x00, 0x85, 0x2e, 0x98, 0x61, 0x50, 0x00, 0x98, 0xc8, 0x22, 0x00, 0x98, 0x10, 0x9e,
+    0x00, 0x98, 0x00, 0x69, 0x4b, 0x60, 0x3c, 0x00, 0x00, 0x60, 0x3c, 0x00, 0x00, 0x60, 0x3c, 0x00, 0x00, 0x60, 0x3c,
+    0x00, 0x00, 0x60, 0xb0, 0x98, 0x34, 0xb9, 0x31, 0x90, 0x5c, 0x8e, 0x69, 0x9c, 0x5c, 0x8c, 0x8c, 0x6d, 0x5c, 0x8c,
+    0x17, 0x33, 0x5c, 0x8c, 0x00, 0x30, 0x5c, 0x97, 0x55, 0x5c, 0x38, 0x94, 0x80, 0x5c, 0x38, 0x94, 0x6c, 0x6f, 0x38,
+    0x94, 0x19, 0xc2, 0x38, 0x94, 0x00, 0xb9, 0x38, 0x2e, 0xa6, 0x9c, 0x00, 0x8d, 0x0f, 0x70, 0x2d, 0x9e, 0x00, 0x5b,
+    0x42, 0x8e, 0x0c, 0x6e, 0x2d, 0x2f, 0x9a, 0x97, 0x00, 0x80, 0xa2, 0xb3, 0x11, 0x80, 0x18, 0x72, 0x3d, 0x80, 0x9e,
+    0x90, 0x06, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x00, 0x00, 0x2e, 0xa6, 0x9c, 0x00, 0x8d, 0x0f, 0x70, 0x2c, 0x9e,
+    0x00, 0x5b, 0x43, 0x8e, 0x0d, 0x6e, 0x30, 0x2c, 0x9d, 0xab, 0x02, 0x00, 0x00, 0x85, 0x25, 0x94, 0x9a, 0xa7, 0x03,
+    0x94, 0x04, 0x97, 0x18, 0x94, 0x9f, 0x97, 0x00, 0x94, 0x04, 0x92, 0x0d, 0x94, 0x04, 0x37, 0x6a, 0x40, 0xa7, 0x9b,
+    0x00, 0x8c, 0x13, 0x00, 0x00, 0x22, 0x9d, 0x8e, 0x02, 0x00, 0x00, 0x70, 0x2d, 0x58, 0x8b, 0xa5, 0x09, 0x82, 0xca,
+    0xa3, 0x49, 0x00, 0x7c, 0x1c, 0x00, 0x00, 0x7c, 0x1c, 0x00, 0x00, 0x7c, 0x1c, 0x00, 0x00, 0x7c, 0x1c, 0x00, 0x90,
+    0x08, 0x68, 0x30, 0x90, 0x08, 0x68, 0x30, 0x90, 0x08, 0x68, 0x30, 0x8b, 0x0a, 0x6a, 0x29, 0x41, 0x96, 0x9d, 0x05,
+    0x99, 0x00, 0x46, 0x52, 0x72, 0x20, 0x7f, 0x13, 0x30, 0x5c, 0x8c, 0x00, 0x01, 0x88, 0x82, 0x00, 0x00, 0xa1, 0x4c,
+    0x00, 0x90, 0x00, 0x04, 0x8c, 0x8a, 0x93, 0x4e, 0x6d, 0x84, 0x7c, 0x94, 0x4b, 0x7d, 0x69, 0xbb, 0x2a, 0x69, 0x4f,
+    0xae, 0x09, 0x78, 0x27, 0x6c, 0x32, 0x0a, 0x95, 0x88, 0x00, 0x00, 0xa0, 0x4d, 0x00, 0x25, 0x7d, 0x94, 0x00, 0x96,
+    0x0c, 0x54, 0x4b, 0x90, 0x0c, 0x5d, 0x42, 0x24, 0x72, 0x95, 0x00, 0x00, 0x9b, 0x41, 0x00, 0x00, 0x7c, 0x1c, 0x00,
+    0x00, 0x7c, 0x1c, 0x00, 0x5c, 0x98, 0xd2, 0x2b, 0x00, 0x0f, 0x92, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x24, 0x72, 0x00,
+    0x00, 0x9b, 0x9e, 0x98, 0x2d, 0x09, 0x9c, 0x60, 0x0c, 0x7c, 0x00, 0x0c, 0x7c, 0x00, 0x0c, 0x7c, 0x00, 0x0c, 0x7c,
+    0x00, 0x0c, 0x7c, 0x00, 0x09, 0x9f, 0x64, 0x6e, 0x22, 0x00, 0x00, 0x13, 0x7c, 0x00, 0x00, 0x00, 0x8d, 0x03, 0x00,
+    0x00, 0x46, 0x49, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x00, 0x79, 0x14, 0x14, 0x80, 0x79, 0x00, 0x00, 0x8c, 0x00,
+    0x00, 0x8c, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x8c, 0x14, 0x80, 0x79, 0x02, 0xaa, 0x62, 0x00, 0x67,
+    0x2a, 0x71, 0x1f, 0x4a, 0x68, 0x68, 0x23, 0x07, 0x41, 0x00, 0x00, 0x74, 0x0b, 0x32, 0x90, 0x97, 0x01, 0x23, 0x89,
+    0xb8, 0x1c, 0x85, 0x07, 0x85, 0x20, 0x54, 0x8d, 0xa7, 0x34, 0x70, 0x1c, 0x00, 0x00, 0x70, 0x98, 0xa4, 0x04, 0x70,
+    0x2b, 0x5c, 0x35, 0x70, 0x28, 0x59, 0x35, 0x70, 0x8e, 0x9c, 0x04, 0x17, 0xa3, 0x97, 0x05, 0x6f, 0x25, 0x00, 0x00,
+    0x6f, 0x20, 0x00, 0x00, 0x18, 0x98, 0x88, 0x05, 0x00, 0x00, 0x7c, 0x10, 0x3a, 0xa2, 0xc4, 0x10, 0x8e, 0x03, 0x8b,
+    0x10, 0x8d, 0x02, 0x88, 0x10, 0x3c, 0x94, 0xc0, 0x10, 0x27, 0x98, 0x9d, 0x0c, 0x88, 0x80, 0x93, 0x2e, 0x8e, 0x0a,
+    0x00, 0x00, 0x2b, 0x98, 0x94, 0x19, 0x00, 0x6f, 0x86, 0x04, 0x3f, 0xc2, 0x7c, 0x03, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x29, 0xa3, 0xb4, 0x24, 0x81, 0x13, 0x77, 0x24, 0x82, 0x11, 0x75, 0x24,
+    0x2b, 0x9c, 0xb8, 0x1d, 0x16, 0x81, 0x8e, 0x01, 0x6c, 0x1c, 0x00, 0x00, 0x6c, 0x8f, 0xa8, 0x00, 0x6c, 0x27, 0x78,
+    0x0f, 0x6c, 0x1c, 0x74, 0x14, 0x6c, 0x1c, 0x74, 0x14, 0x00, 0x6c, 0x07, 0x00, 0x1c, 0xc2, 0x0c, 0x00, 0x00, 0x80,
+    0x0c, 0x00, 0x00, 0x7d, 0x10, 0x00, 0x00, 0x40, 0x9e, 0x1b, 0x00, 0x20, 0x53, 0x01, 0x86, 0x74, 0x00, 0x14, 0x74,
+    0x00, 0x14, 0x74, 0x00, 0x17, 0x72, 0x29, 0xa3, 0x3a, 0x58, 0x38, 0x00, 0x00, 0x58, 0x3e, 0x95, 0x0d, 0x58, 0xcc,
+    0x2f, 0x00, 0x58, 0x64, 0x87, 0x00, 0x58, 0x38, 0x71, 0x34, 0x3c, 0xbe, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+    0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x5f, 0x94, 0x0c, 0x95, 0xa9, 0x9a, 0x2c, 0x81, 0x6e, 0x3c, 0x50,
+    0x80, 0x6c, 0x38, 0x54, 0x80, 0x6c, 0x38, 0x54, 0x6c, 0x7b, 0x9d, 0x00, 0x6c, 0x23, 0x77, 0x0f, 0x6c, 0x1c, 0x74,
+    0x14, 0x6c, 0x1c, 0x74, 0x14, 0x30, 0xa4, 0x9d, 0x01, 0x88, 0x0a, 0x6d, 0x29, 0x88, 0x08, 0x6a, 0x29, 0x30, 0x96,
+    0x95, 0x01, 0x70, 0x88, 0x92, 0x02, 0x70, 0x24, 0x5c, 0x31, 0x70, 0x26, 0x5d, 0x31, 0x70, 0x92, 0x97, 0x02, 0x70,
+    0x18, 0x00, 0x00, 0x2f, 0xa0, 0xbb, 0x18, 0x87, 0x09, 0x84, 0x18, 0x89, 0x07, 0x81, 0x18, 0x35, 0x96, 0xbf, 0x18,
+    0x00, 0x00, 0x74, 0x18, 0x1c, 0xa7, 0x7a, 0x23, 0x1c, 0x81, 0x00, 0x00, 0x1c, 0x70, 0x00, 0x00, 0x1c, 0x70, 0x00,
+    0x00, 0x2a, 0xa5, 0x76, 0x00, 0x3c, 0x88, 0x19, 0x00, 0x00, 0x2b, 0xb1, 0x01, 0x38, 0x7e, 0x96, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x4b, 0xc2, 0x7c, 0x03, 0x00, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+    0x7a, 0x85, 0x04, 0x6c, 0x1c, 0x74, 0x14, 0x6c, 0x1c, 0x74, 0x14, 0x68, 0x1f, 0x7e, 0x14, 0x2f, 0x9d, 0xb1, 0x14,
+    0x86, 0x09, 0x61, 0x2d, 0x44, 0x48, 0x8c, 0x00, 0x06, 0x87, 0x86, 0x00, 0x00, 0xa4, 0x4d, 0x00, 0x86, 0x00, 0x06,
+    0x81, 0x83, 0x6b, 0x49, 0x54, 0x7d, 0x6e, 0xad, 0x22, 0x55, 0x64, 0xb7, 0x00, 0x59, 0x3b, 0x88, 0x10, 0x00, 0x9d,
+    0x5e, 0x00, 0x05, 0xa2, 0x6e, 0x00, 0x73, 0x2a, 0x7d, 0x1f, 0x7d, 0x12, 0x5c, 0x35, 0x28, 0x65, 0x8c, 0x00, 0x00,
+    0x98, 0x79, 0x00, 0x00, 0x84, 0x27, 0x00, 0x40, 0x93, 0x00, 0x00, 0x2c, 0x88, 0xd0, 0x07, 0x00, 0x2d, 0x72, 0x00,
+    0x03, 0x99, 0x04, 0x00, 0x5a, 0xac, 0x84, 0x06, 0x00, 0x3d, 0x74, 0x00, 0x8a, 0x01, 0x00, 0x8f, 0x00, 0x57, 0xa6,
+    0x00, 0x00, 0x8e, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x3d, 0x77, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70,
+    0x10, 0x70, 0x10, 0x1d, 0x8c, 0x06, 0x00, 0x00, 0x63, 0x28, 0x00, 0x00, 0x5c, 0x37, 0x00, 0x00, 0x21, 0xca, 0x23,
+    0x00, 0x5c, 0x37, 0x00, 0x00, 0x63, 0x28, 0x00, 0x1e, 0x8e, 0x06, 0x00, 0x53, 0x84, 0x1e, 0x44, 0x54, 0x26, 0x9e,
+    0x17, 0x60, 0xff, 0x10, 0x60, 0xff, 0x10, 0x54, 0xfe, 0x07, 0x2f, 0xe5, 0x00, 0x09, 0xc2, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xbc, 0x16, 0x54, 0xe4, 0x20, 0x28, 0xcc, 0x10, 0xe0, 0x28, 0xcc, 0x10, 0xe0, 0x24, 0xbc, 0x0e, 0xce, 0x00,
+    0x00, 0x47, 0x98, 0x12, 0xca, 0x00, 0x00, 0x00, 0x8b, 0x51, 0x56, 0x88, 0x00, 0x4a, 0xd0, 0xf5, 0xd4, 0xec, 0xdd,
+    0x92, 0x00, 0x0c, 0xd3, 0x00, 0xd2, 0x0e, 0x00, 0x00, 0x40, 0xa0, 0x0b, 0xd3, 0x00, 0x00, 0xcc, 0xe6, 0xe3, 0xdc,
+    0xed, 0xd0, 0x10, 0x00, 0xbe, 0x21, 0x89, 0x56, 0x00, 0x00, 0x0b, 0xd4, 0x00, 0xcc, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x25, 0xa2, 0xfd, 0xac, 0x48, 0x00, 0xd2, 0x41, 0xa8, 0x1a, 0x34, 0x00, 0xdc, 0x45, 0xa8,
+    0x00, 0x00, 0x00, 0x33, 0xbb, 0xf1, 0xa4, 0x29, 0x00, 0x00, 0x00, 0xaa, 0x49, 0xe4, 0x01, 0x37, 0x00, 0xa8, 0x19,
+    0xf4, 0x05, 0xa5, 0xdf, 0xf0, 0xd8, 0x59, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x2e, 0xc1, 0xb9, 0x19, 0x00, 0x00, 0x00, 0xae, 0x1c, 0x40, 0x8f, 0x00, 0x00, 0x00, 0xb2, 0x1b, 0x40, 0x91,
+    0x0e, 0x82, 0x56, 0x30, 0xc7, 0xc2, 0x8a, 0x9f, 0x2c, 0x00, 0x01, 0x5b, 0xa6, 0x7f, 0xc6, 0xa9, 0x0b, 0x82, 0x52,
+    0x00, 0xbc, 0x0f, 0x66, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x57, 0x76, 0x00, 0x00, 0x00, 0x55, 0xd4, 0xbf, 0x12,
+    0x00, 0x37, 0xd5, 0xd4, 0xa2, 0x00, 0x00, 0x00, 0xa9, 0x58, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x82, 0x87, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x96, 0xee, 0x3e, 0x00, 0x00, 0x00, 0x64, 0x9b, 0x30, 0xde, 0x1a, 0x58, 0x80, 0xa5, 0x52, 0x00,
+    0x5a, 0xc5, 0x86, 0x54, 0x72, 0xb1, 0x07, 0x00, 0xa9, 0xe2, 0x03, 0x04, 0x8f, 0xd8, 0xd0, 0xa4, 0xcc, 0x4e, 0x20,
+    0xd4, 0x20, 0xd4, 0x1d, 0xc3, 0x00, 0x1a, 0xc7, 0x02, 0x00, 0x99, 0x5b, 0x00, 0x09, 0xee, 0x09, 0x00, 0x41, 0xc9,
+    0x00, 0x00, 0x5d, 0xb1, 0x00, 0x00, 0x53, 0xba, 0x00, 0x00, 0x23, 0xe4, 0x00, 0x00, 0x00, 0xcd, 0x2e, 0x00, 0x00,
+    0x54, 0x98, 0x00, 0x00, 0x00, 0x69, 0x02, 0x25, 0xc1, 0x01, 0x00, 0x00, 0xa5, 0x51, 0x00, 0x00, 0x4b, 0xb6, 0x00,
+    0x00, 0x12, 0xf5, 0x02, 0x00, 0x00, 0xf9, 0x14, 0x00, 0x04, 0xfe, 0x0a, 0x00, 0x2d, 0xda, 0x00, 0x00, 0x77, 0x86,
+    0x00, 0x04, 0xd0, 0x1a, 0x00, 0x20, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x12, 0x37, 0x08, 0xb6,
+    0x0a, 0x41, 0x0e, 0x78, 0xc8, 0xf3, 0xb7, 0x57, 0x00, 0x00, 0xab, 0xb5, 0x62, 0x00, 0x00, 0x5b, 0x76, 0x04, 0xb1,
+    0x1b, 0x00, 0x11, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x18, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xd0, 0x00, 0x00, 0x00, 0x6b, 0xd0, 0xd4, 0xf7, 0xd0, 0xd0, 0x34, 0x00, 0x00, 0x18,
+    0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd0, 0x00, 0x00, 0x00, 0x41, 0xc4, 0x18, 0x51, 0xf9, 0x53, 0x00, 0x94,
+    0x2e, 0x64, 0x8c, 0x00, 0x17, 0x00, 0x00, 0xb6, 0xd0, 0xd0, 0xd0, 0x7b, 0x44, 0xc3, 0x0b, 0x57, 0xe3, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x65, 0xa6, 0x00, 0x00, 0x00, 0x03, 0xda, 0x2d, 0x00, 0x00, 0x00, 0x59, 0xb1, 0x00, 0x00, 0x00,
+    0x01, 0xd1, 0x37, 0x00, 0x00, 0x00, 0x4d, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x00, 0x41, 0xc7,
+    0x00, 0x00, 0x00, 0x00, 0xbb, 0x4d, 0x00, 0x00, 0x00, 0x33, 0xcf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0xd1, 0xdc,
+    0xb4, 0x0e, 0x00, 0xcd, 0x55, 0x00, 0x9c, 0x86, 0x20, 0xf3, 0x0a, 0x9b, 0x3f, 0xdc, 0x3c, 0xdc, 0x28, 0xde, 0x25,
+    0xfa, 0x3c, 0xdc, 0x26, 0xe0, 0x25, 0xf9, 0x20, 0xf4, 0x09, 0xa0, 0x3f, 0xdc, 0x00, 0xcd, 0x56, 0x00, 0x9a, 0x86,
+    0x00, 0x33, 0xd2, 0xdc, 0xb4, 0x0f, 0x00, 0x49, 0xfb, 0x48, 0x00, 0x33, 0xe2, 0xe8, 0x48, 0x00, 0x60, 0x3b, 0xd0,
+    0x48, 0x00, 0x00, 0x00, 0xd0, 0x48, 0x00, 0x00, 0x00, 0xd0, 0x48, 0x00, 0x00, 0x00, 0xd0, 0x48, 0x00, 0x00, 0x00,
+    0xd0, 0x48, 0x00, 0x79, 0xe4, 0xfa, 0xeb, 0xdc, 0x0f, 0xb7, 0xdb, 0xd2, 0xa3, 0x0d, 0x0f, 0x49, 0x00, 0x01, 0xa5,
+    0x87, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xa5, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0x54, 0x00, 0x00, 0x03, 0xae, 0x95, 0x00,
+    0x00, 0x01, 0xa1, 0xa7, 0x02, 0x00, 0x00, 0x95, 0xa5, 0x03, 0x00, 0x00, 0x27, 0xff, 0xd3, 0xd0, 0xd0, 0xa2, 0x00,
+    0xb9, 0xd0, 0xcf, 0xb7, 0x1f, 0x00, 0x13, 0x00, 0x00, 0x7e, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x92, 0x9a, 0x00, 0x00,
+    0xa2, 0xeb, 0xce, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x91, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe8, 0x12, 0x1e, 0x00,
+    0x00, 0x7c, 0xbd, 0x20, 0xcf, 0xd2, 0xd5, 0xb7, 0x21, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x30,
+    0xad, 0xfc, 0x1c, 0x00, 0x00, 0x05, 0xc3, 0x1d, 0xfc, 0x1c, 0x00, 0x00, 0x7f, 0x6f, 0x00, 0xfc, 0x1c, 0x00, 0x2d,
+    0xc4, 0x02, 0x00, 0xfc, 0x1c, 0x00, 0x67, 0xe1, 0xd8, 0xd8, 0xff, 0xdc, 0x28, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1c, 0x00, 0x00, 0xe0, 0xd6, 0xd0, 0xd0, 0x34, 0x00, 0xe0, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xd0, 0xd3, 0x91, 0x0c, 0x00, 0x1e, 0x00, 0x0d, 0xb0, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0xc7, 0x0d, 0x0f, 0x00, 0x03, 0x9d, 0x98, 0x29, 0xdb, 0xd6, 0xd6, 0xa5, 0x10, 0x00,
+    0x1c, 0xb6, 0xdd, 0xd8, 0x50, 0x00, 0xc2, 0x7c, 0x00, 0x02, 0x14, 0x1c, 0xef, 0x07, 0x00, 0x00, 0x00, 0x40, 0xcd,
+    0x93, 0xd3, 0xb6, 0x26, 0x3e, 0xfd, 0x4b, 0x00, 0x69, 0xc6, 0x25, 0xf8, 0x00, 0x00, 0x20, 0xf5, 0x00, 0xd4, 0x38,
+    0x00, 0x59, 0xcd, 0x00, 0x2f, 0xc5, 0xcf, 0xc8, 0x31, 0x30, 0xd0, 0xd0, 0xd0, 0xe2, 0xd3, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0x79, 0x00, 0x00, 0x00, 0x0d, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x67, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x51,
+    0x00, 0x00, 0x00, 0x30, 0xe9, 0x05, 0x00, 0x00, 0x00, 0x95, 0x8b, 0x00, 0x00, 0x00, 0x09, 0xef, 0x29, 0x00, 0x00,
+    0x00, 0x5f, 0xd5, 0xd0, 0xc8, 0x30, 0x00, 0x08, 0xfa, 0x26, 0x00, 0x6e, 0xbb, 0x00, 0x03, 0xe4, 0x32, 0x00, 0x7c,
+    0xa0, 0x00, 0x00, 0x3e, 0xed, 0xe4, 0xd4, 0x13, 0x00, 0x0e, 0xe5, 0x32, 0x00, 0x77, 0xb4, 0x00, 0x3e, 0xdc, 0x00,
+    0x00, 0x21, 0xf9, 0x00, 0x1d, 0xf5, 0x25, 0x00, 0x62, 0xd1, 0x00, 0x00, 0x61, 0xd6, 0xd1, 0xc6, 0x31, 0x00, 0x00,
+    0x68, 0xd7, 0xcf, 0xa7, 0x0c, 0x21, 0xef, 0x17, 0x00, 0x8a, 0x83, 0x46, 0xd0, 0x00, 0x00, 0x49, 0xd3, 0x1c, 0xf0,
+    0x24, 0x01, 0x98, 0xee, 0x00, 0x55, 0xcc, 0xce, 0x7e, 0xef, 0x00, 0x00, 0x00, 0x00, 0x47, 0xcc, 0x00, 0x15, 0x00,
+    0x09, 0xc2, 0x68, 0x00, 0x94, 0xd7, 0xe1, 0x8d, 0x03, 0x4e, 0xed, 0x22, 0x3a, 0xbd, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4e, 0xed, 0x22, 0x3a, 0xbd, 0x18, 0x51, 0xc0, 0x17, 0x69, 0xec, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x43, 0xc7, 0x21, 0x52, 0xf9, 0x64, 0x00, 0x89, 0x42, 0x58, 0xa8, 0x01, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x00, 0x26, 0x8a, 0xe3, 0x34, 0x07, 0x5a, 0xbf, 0xca, 0x6c, 0x12, 0x00, 0x82,
+    0xf1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5b, 0xc0, 0xc9, 0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8b, 0xe3,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x6b, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x34, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6b, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x34, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xd3,
+    0x6f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x26, 0x86, 0xdb, 0xa4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b, 0xfe, 0x3e,
+    0x00, 0x26, 0x85, 0xdb, 0xa5, 0x40, 0x00, 0x71, 0xd4, 0x70, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x64, 0xcf, 0xd3, 0xc9, 0x28, 0x35, 0x05, 0x00, 0x8f, 0x9b, 0x00, 0x00, 0x0d, 0xc9, 0x5d, 0x00, 0x08,
+    0xc9, 0x6c, 0x00, 0x00, 0x45, 0xc4, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x00, 0x00, 0x00, 0x4d, 0xa8, 0x00, 0x00, 0x00,
+    0x5d, 0xd2, 0x00, 0x00, 0x00, 0x1e, 0x9f, 0xd5, 0xc8, 0x56, 0x00, 0x0b, 0xd1, 0x53, 0x04, 0x0e, 0xb8, 0x26, 0x7c,
+    0x69, 0x12, 0xac, 0xcb, 0xb1, 0x60, 0xba, 0x14, 0x8b, 0x6a, 0x01, 0xa4, 0x6c, 0xd1, 0x01, 0xb6, 0x20, 0x00, 0x60,
+    0x6c, 0xc1, 0x1b, 0x8b, 0x6a, 0x01, 0xa6, 0x6c, 0x70, 0x7d, 0x12, 0xae, 0xcb, 0xa3, 0x61, 0x05, 0xc7, 0x6e, 0x0c,
+    0x00, 0x02, 0x00, 0x00, 0x0e, 0x84, 0xce, 0xd5, 0x76, 0x00, 0x00, 0x00, 0x78, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0xb9, 0x7e, 0x00, 0x00, 0x00, 0x18, 0xeb, 0x3b, 0xce, 0x00, 0x00, 0x00, 0x67, 0xa6, 0x02, 0xec, 0x1e, 0x00,
+    0x00, 0xb6, 0x5d, 0x00, 0xa6, 0x6d, 0x00, 0x0c, 0xf7, 0xdc, 0xd8, 0xe6, 0xbc, 0x00, 0x55, 0xc5, 0x00, 0x00, 0x11,
+    0xf7, 0x11, 0xa4, 0x7c, 0x00, 0x00, 0x00, 0xc5, 0x5c, 0x18, 0xff, 0xd0, 0xce, 0xca, 0x3c, 0x00, 0x18, 0xff, 0x04,
+    0x00, 0x53, 0xd4, 0x00, 0x18, 0xff, 0x04, 0x00, 0x68, 0xc8, 0x00, 0x18, 0xff, 0xd0, 0xde, 0xeb, 0x36, 0x00, 0x18,
+    0xff, 0x04, 0x00, 0x4b, 0xde, 0x05, 0x18, 0xff, 0x04, 0x00, 0x00, 0xf1, 0x29, 0x18, 0xff, 0x04, 0x00, 0x2b, 0xf6,
+    0x0e, 0x18, 0xff, 0xd0, 0xd0, 0xcd, 0x4e, 0x00, 0x00, 0x0a, 0x98, 0xda, 0xdb, 0xa2, 0x00, 0xa0, 0x9c, 0x01, 0x00,
+    0x3c, 0x0d, 0xfa, 0x1a, 0x00, 0x00, 0x00, 0x31, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xf3, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0xfb, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9c, 0x01, 0x00, 0x2d, 0x00, 0x0d, 0xa0, 0xd3, 0xd6, 0xa3, 0x40,
+    0xf9, 0xd0, 0xcc, 0x6f, 0x02, 0x00, 0x40, 0xdc, 0x00, 0x0f, 0xba, 0x77, 0x00, 0x40, 0xdc, 0x00, 0x00, 0x46, 0xdb,
+    0x00, 0x40, 0xdc, 0x00, 0x00, 0x25, 0xfd, 0x01, 0x40, 0xdc, 0x00, 0x00, 0x26, 0xfe, 0x02, 0x40, 0xdc, 0x00, 0x00,
+    0x47, 0xdc, 0x00, 0x40, 0xdc, 0x00, 0x0f, 0xbc, 0x7a, 0x00, 0x40, 0xf9, 0xd0, 0xce, 0x72, 0x02, 0x00, 0xec, 0xd8,
+    0xd0, 0xd0, 0xbc, 0x00, 0xec, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xec, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xec, 0xd8, 0xd0,
+    0xd0, 0x98, 0x00, 0xec, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xec, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xec, 0x2c, 0x00, 0x00,
+    0x00, 0x00, 0xec, 0xd8, 0xd0, 0xd0, 0xd0, 0x03, 0xbc, 0xe2, 0xd0, 0xd0, 0xd0, 0x0d, 0xbc, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xbc, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xe2, 0xd0, 0xd0, 0x95, 0x00, 0xbc, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0xb8, 0xdb, 0xd3, 0x77, 0x00, 0x01, 0xcd, 0x6c, 0x00, 0x02, 0x46, 0x00, 0x3a, 0xe6, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xbe, 0x00, 0x2d, 0xd0, 0xe8, 0x03, 0x3b, 0xe1, 0x01, 0x00,
+    0x08, 0xff, 0x04, 0x01, 0xd0, 0x65, 0x00, 0x0b, 0xff, 0x04, 0x00, 0x1c, 0xb7, 0xda, 0xd0, 0x8b, 0x01, 0x40, 0xdc,
+    0x00, 0x00, 0x20, 0xfc, 0x40, 0xdc, 0x00, 0x00, 0x20, 0xfc, 0x40, 0xdc, 0x00, 0x00, 0x20, 0xfc, 0x40, 0xf9, 0xd0,
+    0xd0, 0xd6, 0xfc, 0x40, 0xdc, 0x00, 0x00, 0x20, 0xfc, 0x40, 0xdc, 0x00, 0x00, 0x20, 0xfc, 0x40, 0xdc, 0x00, 0x00,
+    0x20, 0xfc, 0x40, 0xdc, 0x00, 0x00, 0x20, 0xfc, 0xbc, 0xd9, 0xfb, 0xd0, 0x7e, 0x00, 0x34, 0xe8, 0x00, 0x00, 0x00,
+    0x34, 0xe8, 0x00, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00,
+    0x00, 0x34, 0xe8, 0x00, 0x00, 0xbc, 0xd9, 0xfb, 0xd0, 0x7e, 0x00, 0x00, 0xc9, 0xd0, 0xfa, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0xe4, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0xe4, 0x38, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x33, 0x38, 0x24, 0x00, 0x1e, 0xfa, 0x13, 0x41, 0xd2, 0xd6, 0xdc, 0x71,
+    0x00, 0x40, 0xdc, 0x00, 0x00, 0x3a, 0xe2, 0x2e, 0x40, 0xdc, 0x00, 0x32, 0xe1, 0x35, 0x00, 0x40, 0xdc, 0x2b, 0xe1,
+    0x3b, 0x00, 0x00, 0x40, 0xed, 0xe7, 0xa2, 0x00, 0x00, 0x00, 0x40, 0xf9, 0x56, 0xe8, 0x42, 0x00, 0x00, 0x40, 0xdc,
+    0x00, 0x53, 0xe2, 0x10, 0x00, 0x40, 0xdc, 0x00, 0x00, 0xa8, 0xa5, 0x00, 0x40, 0xdc, 0x00, 0x00, 0x14, 0xe9, 0x56,
+    0xd4, 0x48, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x48, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x48, 0x00, 0x00, 0x00, 0x00, 0xd4,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x48, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x48, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0xeb, 0xe4, 0xe4, 0xe4, 0x31, 0x88, 0xfe, 0x1c, 0x00, 0x69, 0xff, 0x40, 0x88, 0xd2,
+    0x73, 0x00, 0xbb, 0xd8, 0x40, 0x88, 0x85, 0xbe, 0x1c, 0xb0, 0xc8, 0x40, 0x88, 0x7c, 0xa4, 0x97, 0x59, 0xc8, 0x40,
+    0x88, 0x7c, 0x4b, 0xf4, 0x0b, 0xc8, 0x40, 0x88, 0x7c, 0x03, 0x20, 0x00, 0xc8, 0x40, 0x88, 0x7c, 0x00, 0x00, 0x00,
+    0xc8, 0x40, 0x88, 0x7c, 0x00, 0x00, 0x00, 0xc8, 0x40, 0x3c, 0xff, 0x5c, 0x00, 0x18, 0xf8, 0x3c, 0xf1, 0xc6, 0x00,
+    0x18, 0xf8, 0x3c, 0xd4, 0xbd, 0x32, 0x18, 0xf8, 0x3c, 0xd4, 0x52, 0x9d, 0x18, 0xf8, 0x3c, 0xd4, 0x03, 0xda, 0x29,
+    0xf8, 0x3c, 0xd4, 0x00, 0x7c, 0x8a, 0xf8, 0x3c, 0xd4, 0x00, 0x17, 0xe6, 0xf8, 0x3c, 0xd4, 0x00, 0x00, 0xa6, 0xf8,
+    0x00, 0x36, 0xcb, 0xd3, 0xba, 0x1b, 0x00, 0x06, 0xe9, 0x42, 0x00, 0x87, 0xa9, 0x00, 0x3a, 0xe8, 0x00, 0x00, 0x2c,
+    0xf2, 0x00, 0x56, 0xd0, 0x00, 0x00, 0x14, 0xff, 0x0e, 0x57, 0xcf, 0x00, 0x00, 0x14, 0xff, 0x0d, 0x3b, 0xe8, 0x00,
+    0x00, 0x2c, 0xf2, 0x00, 0x06, 0xea, 0x42, 0x00, 0x87, 0xa9, 0x00, 0x00, 0x37, 0xcc, 0xd3, 0xba, 0x1b, 0x00, 0x10,
+    0xff, 0xd2, 0xd0, 0xc9, 0x39, 0x00, 0x10, 0xff, 0x0c, 0x00, 0x5d, 0xe0, 0x00, 0x10, 0xff, 0x0c, 0x00, 0x1a, 0xff,
+    0x09, 0x10, 0xff, 0x0c, 0x00, 0x72, 0xd9, 0x00, 0x10, 0xff, 0xd2, 0xd1, 0xb4, 0x2d, 0x00, 0x10, 0xff, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+    0xcb, 0xd3, 0xba, 0x1b, 0x00, 0x06, 0xe9, 0x42, 0x00, 0x87, 0xa9, 0x00, 0x3b, 0xe8, 0x00, 0x00, 0x2c, 0xf2, 0x00,
+    0x56, 0xd0, 0x00, 0x00, 0x14, 0xff, 0x0e, 0x50, 0xcf, 0x00, 0x00, 0x14, 0xff, 0x0b, 0x35, 0xe8, 0x00, 0x00, 0x2c,
+    0xf0, 0x00, 0x02, 0xdf, 0x42, 0x00, 0x87, 0xa7, 0x00, 0x00, 0x3e, 0xd4, 0xdf, 0xdc, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xc4, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x21, 0x38, 0xfa, 0xd0, 0xd4, 0xae, 0x16, 0x00, 0x38,
+    0xe4, 0x00, 0x01, 0xa1, 0x9a, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x61, 0xc6, 0x00, 0x38, 0xe4, 0x00, 0x04, 0xaa, 0x8f,
+    0x00, 0x38, 0xfa, 0xd0, 0xef, 0xaf, 0x06, 0x00, 0x38, 0xe4, 0x00, 0x0f, 0xd2, 0x4a, 0x00, 0x38, 0xe4, 0x00, 0x00,
+    0x41, 0xdc, 0x06, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xb8, 0x70, 0x00, 0x4f, 0xcd, 0xd1, 0xd8, 0x5a, 0x13, 0xea, 0x1e,
+    0x00, 0x0c, 0x2f, 0x2f, 0xe7, 0x09, 0x00, 0x00, 0x00, 0x03, 0xba, 0xe6, 0x9c, 0x4e, 0x00, 0x00, 0x01, 0x38, 0x7d,
+    0xda, 0x95, 0x00, 0x00, 0x00, 0x00, 0x24, 0xef, 0x11, 0x3c, 0x00, 0x00, 0x54, 0xd1, 0x15, 0xbf, 0xd9, 0xd1, 0xc5,
+    0x32, 0x9c, 0xd0, 0xd9, 0xfc, 0xd0, 0xd0, 0x61, 0x00, 0x00, 0x30, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec, 0x00, 0x00, 0x00,
+    0x34, 0xe8, 0x00, 0x00, 0x30, 0xec, 0x34, 0xe8, 0x00, 0x00, 0x30, 0xec, 0x34, 0xe8, 0x00, 0x00, 0x30, 0xec, 0x34,
+    0xe8, 0x00, 0x00, 0x30, 0xec, 0x33, 0xe8, 0x00, 0x00, 0x30, 0xeb, 0x2e, 0xe8, 0x00, 0x00, 0x31, 0xe6, 0x0c, 0xf3,
+    0x22, 0x00, 0x64, 0xb8, 0x00, 0x5a, 0xd3, 0xd8, 0xc7, 0x28, 0x8b, 0x95, 0x00, 0x00, 0x00, 0xde, 0x41, 0x3f, 0xda,
+    0x00, 0x00, 0x23, 0xf0, 0x05, 0x03, 0xee, 0x1f, 0x00, 0x68, 0xa9, 0x00, 0x00, 0xa7, 0x64, 0x00, 0xad, 0x5d, 0x00,
+    0x00, 0x5b, 0xa9, 0x02, 0xec, 0x14, 0x00, 0x00, 0x12, 0xe8, 0x38, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xae, 0x79,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x2d, 0x00, 0x00, 0xed, 0x22, 0x00, 0x00, 0x00, 0x68, 0xa3, 0xc6, 0x41, 0x00,
+    0x00, 0x00, 0x86, 0x7c, 0x9f, 0x60, 0x53, 0xfd, 0x0c, 0xa5, 0x55, 0x78, 0x7f, 0x87, 0xd3, 0x40, 0xc4, 0x2e, 0x51,
+    0x9e, 0xb9, 0x62, 0x76, 0xe1, 0x09, 0x2a, 0xbe, 0xc1, 0x19, 0xb0, 0xdd, 0x00, 0x06, 0xf3, 0x97, 0x00, 0xd6, 0xb9,
+    0x00, 0x00, 0xdc, 0x5d, 0x00, 0xa5, 0x93, 0x00, 0x3a, 0xe4, 0x0c, 0x00, 0x18, 0xea, 0x28, 0x00, 0x98, 0x89, 0x00,
+    0xa4, 0x7d, 0x00, 0x00, 0x10, 0xe0, 0x64, 0xd2, 0x05, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00,
+    0xa6, 0xe4, 0x73, 0x00, 0x00, 0x00, 0x4a, 0xd4, 0x1b, 0xe4, 0x1e, 0x00, 0x0d, 0xe1, 0x3b, 0x00, 0x71, 0xb1, 0x00,
+    0x95, 0x98, 0x00, 0x00, 0x04, 0xd6, 0x50, 0x81, 0xa6, 0x00, 0x00, 0x0a, 0xe3, 0x39, 0x09, 0xe0, 0x36, 0x00, 0x7e,
+    0xa0, 0x00, 0x00, 0x55, 0xc3, 0x19, 0xe5, 0x18, 0x00, 0x00, 0x00, 0xbe, 0xd2, 0x72, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x34, 0xe8, 0x00, 0x00, 0x00, 0x3a, 0xd0, 0xd0, 0xd0, 0xdf, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x7e,
+    0x00, 0x00, 0x00, 0x00, 0x5a, 0xd0, 0x05, 0x00, 0x00, 0x00, 0x13, 0xe5, 0x32, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x46, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x0b, 0xdc, 0x36, 0x00, 0x00, 0x00, 0x00, 0x62, 0xf6,
+    0xd0, 0xd0, 0xd0, 0xd0, 0x1a, 0x36, 0xe2, 0xd0, 0xd0, 0x23, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x3c, 0xc4, 0x00, 0x00,
+    0x00, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x3c, 0xc4, 0x00,
+    0x00, 0x00, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x3c, 0xc4, 0x00, 0x00, 0x00, 0x36, 0xe2, 0xd0, 0xd0, 0x23, 0x18, 0xe4,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe1, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa2, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xdc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x5d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xd5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xc7, 0x00, 0x5b, 0xd0, 0xd1, 0xe0, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x0c,
+    0xf8, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00,
+    0x0c, 0xf8, 0x5b, 0xd0, 0xd1, 0xe0, 0x00, 0x00, 0x8b, 0xf9, 0x45, 0x00, 0x00, 0x00, 0x5e, 0xbf, 0x2f, 0xd8, 0x26,
+    0x00, 0x39, 0xc1, 0x0c, 0x00, 0x2e, 0xc7, 0x10, 0x64, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x2a, 0x22, 0xcc, 0x15, 0x00,
+    0x00, 0x33, 0xb0, 0x03, 0x00, 0x92, 0xd0, 0xcd, 0xbb, 0x22, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x5d, 0xa7, 0x00, 0x00,
+    0x67, 0xc6, 0xd0, 0xda, 0xca, 0x00, 0x28, 0xe6, 0x1e, 0x00, 0x4a, 0xcc, 0x00, 0x2f, 0xdc, 0x04, 0x01, 0xac, 0xd2,
+    0x00, 0x00, 0x91, 0xdb, 0xbf, 0x59, 0xf0, 0x06, 0xf4, 0x10, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x95, 0xd1, 0xd7, 0x2b, 0x00, 0xf4, 0x6b, 0x00, 0x5e, 0xc5, 0x00, 0xf4, 0x1a, 0x00, 0x0d, 0xfc, 0x04,
+    0xf4, 0x19, 0x00, 0x0c, 0xfc, 0x03, 0xf4, 0x6a, 0x00, 0x5d, 0xc2, 0x00, 0xf1, 0x87, 0xd0, 0xd5, 0x29, 0x00, 0x00,
+    0x1c, 0xb4, 0xd5, 0xd3, 0x67, 0x00, 0xc1, 0x7a, 0x00, 0x01, 0x2e, 0x0e, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0xfd,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x79, 0x00, 0x00, 0x25, 0x00, 0x1e, 0xb9, 0xd6, 0xd1, 0x69, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x54, 0xb0, 0x00, 0x56, 0xdb, 0xca, 0xa4, 0xb0, 0x13, 0xec, 0x1f, 0x00,
+    0xb2, 0xb0, 0x44, 0xc6, 0x00, 0x00, 0x61, 0xb0, 0x46, 0xc5, 0x00, 0x00, 0x61, 0xb0, 0x12, 0xef, 0x1e, 0x00, 0xb0,
+    0xb0, 0x00, 0x5a, 0xe2, 0xca, 0x93, 0xb0, 0x00, 0x3c, 0xcb, 0xd3, 0xc7, 0x35, 0x00, 0x0c, 0xe0, 0x22, 0x00, 0x2a,
+    0xd9, 0x00, 0x45, 0xf4, 0xd0, 0xd0, 0xd0, 0xe6, 0x09, 0x41, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe7, 0x42,
+    0x00, 0x02, 0x3a, 0x00, 0x00, 0x35, 0xc2, 0xd1, 0xd8, 0x8f, 0x00, 0x00, 0x00, 0x1d, 0xcc, 0xd0, 0x85, 0x00, 0x00,
+    0x6b, 0x9a, 0x00, 0x00, 0x13, 0xd0, 0xe5, 0xea, 0xd0, 0x85, 0x00, 0x00, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x74,
+    0x8c, 0x00, 0x00, 0x00, 0x00, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x74, 0x8c,
+    0x00, 0x00, 0x00, 0x39, 0xd9, 0xce, 0x94, 0xd4, 0x01, 0xdd, 0x40, 0x00, 0x89, 0xd4, 0x1d, 0xec, 0x00, 0x00, 0x38,
+    0xd4, 0x1d, 0xed, 0x00, 0x00, 0x39, 0xd4, 0x01, 0xdd, 0x43, 0x00, 0x8b, 0xd4, 0x00, 0x3a, 0xda, 0xca, 0x9d, 0xcc,
+    0x00, 0x0a, 0x00, 0x00, 0x6c, 0x9c, 0x00, 0x62, 0xd4, 0xd2, 0xb9, 0x1a, 0xf0, 0x10, 0x00, 0x00, 0x00, 0xf0, 0x10,
+    0x00, 0x00, 0x00, 0xf0, 0x85, 0xcb, 0xdc, 0x25, 0xf0, 0x63, 0x00, 0x77, 0x9a, 0xf0, 0x18, 0x00, 0x49, 0xb9, 0xf0,
+    0x10, 0x00, 0x48, 0xbc, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0x00, 0x3c, 0xa1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xd9, 0xcc, 0x00, 0x00, 0x00, 0x34, 0xcc, 0x00, 0x00, 0x00, 0x34, 0xcc, 0x00,
+    0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x00, 0x1b, 0xe7, 0x06, 0x00, 0x00, 0x00, 0x8b, 0xd9, 0xc6, 0x00, 0x00, 0x79,
+    0x63, 0x00, 0x00, 0x00, 0x00, 0x23, 0xd0, 0xe5, 0x90, 0x00, 0x00, 0x70, 0x90, 0x00, 0x00, 0x70, 0x90, 0x00, 0x00,
+    0x70, 0x90, 0x00, 0x00, 0x70, 0x90, 0x00, 0x00, 0x70, 0x8f, 0x00, 0x00, 0x8f, 0x77, 0x92, 0xd1, 0xc7, 0x16, 0xc4,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x44, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x44, 0x02, 0x9b, 0x96, 0x01, 0xc4, 0x48,
+    0xa6, 0x88, 0x00, 0x00, 0xc4, 0xdb, 0xe8, 0x0c, 0x00, 0x00, 0xc4, 0x77, 0x90, 0xa3, 0x00, 0x00, 0xc4, 0x44, 0x06,
+    0xce, 0x61, 0x00, 0xc4, 0x44, 0x00, 0x26, 0xe9, 0x2a, 0x03, 0xd0, 0xe3, 0x98, 0x00, 0x00, 0x00, 0x00, 0x68, 0x98,
+    0x00, 0x00, 0x00, 0x00, 0x68, 0x98, 0x00, 0x00, 0x00, 0x00, 0x68, 0x98, 0x00, 0x00, 0x00, 0x00, 0x68, 0x98, 0x00,
+    0x00, 0x00, 0x00, 0x67, 0x98, 0x00, 0x00, 0x00, 0x00, 0x52, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb8, 0xd5, 0x9c,
+    0x68, 0xc3, 0xd6, 0x94, 0xc5, 0xbe, 0x00, 0x68, 0x97, 0x29, 0xec, 0x02, 0xce, 0x1c, 0x68, 0x80, 0x14, 0xd8, 0x00,
+    0xbc, 0x2c, 0x68, 0x80, 0x14, 0xd8, 0x00, 0xbc, 0x30, 0x68, 0x80, 0x14, 0xd8, 0x00, 0xbc, 0x30, 0x68, 0x80, 0x14,
+    0xd8, 0x00, 0xbc, 0x30, 0xee, 0x7a, 0xce, 0xd7, 0x2c, 0xf0, 0x60, 0x00, 0x75, 0x9d, 0xf0, 0x16, 0x00, 0x49, 0xb9,
+    0xf0, 0x10, 0x00, 0x48, 0xbc, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0x00, 0x42, 0xce, 0xd2,
+    0xb9, 0x1b, 0x08, 0xe8, 0x34, 0x00, 0x7e, 0xac, 0x2f, 0xdd, 0x00, 0x00, 0x26, 0xea, 0x30, 0xdd, 0x00, 0x00, 0x26,
+    0xeb, 0x09, 0xe9, 0x37, 0x00, 0x7e, 0xb0, 0x00, 0x44, 0xcf, 0xd2, 0xbd, 0x1f, 0xf4, 0x83, 0xcd, 0xc8, 0x27, 0x00,
+    0xf8, 0x6d, 0x00, 0x5c, 0xbe, 0x00, 0xf8, 0x19, 0x00, 0x10, 0xf9, 0x02, 0xf8, 0x19, 0x00, 0x10, 0xf8, 0x01, 0xf8,
+    0x6f, 0x00, 0x5c, 0xbe, 0x00, 0xf8, 0x92, 0xce, 0xc8, 0x28, 0x00, 0xf8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xd6, 0xca, 0x93, 0xc0, 0x08, 0xe9, 0x32, 0x00, 0xa2, 0xc0, 0x30, 0xdd, 0x00,
+    0x00, 0x4d, 0xc0, 0x33, 0xdc, 0x00, 0x00, 0x4e, 0xc0, 0x09, 0xee, 0x30, 0x00, 0xa2, 0xc0, 0x00, 0x4d, 0xdf, 0xc9,
+    0x99, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc0, 0x5c, 0x9f, 0xa5, 0xd1, 0xc9,
+    0x5c, 0xf1, 0x2e, 0x00, 0x18, 0x5c, 0xb9, 0x00, 0x00, 0x00, 0x5c, 0xa8, 0x00, 0x00, 0x00, 0x5c, 0xa8, 0x00, 0x00,
+    0x00, 0x5c, 0xa8, 0x00, 0x00, 0x00, 0x41, 0xce, 0xd0, 0xd1, 0x35, 0xc1, 0x4b, 0x00, 0x0a, 0x14, 0x82, 0xcc, 0x76,
+    0x36, 0x00, 0x00, 0x26, 0x65, 0xd9, 0x64, 0x26, 0x00, 0x00, 0x84, 0x88, 0xa0, 0xd7, 0xd1, 0xbb, 0x18, 0x00, 0x00,
+    0x70, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x58, 0x00, 0x00, 0x3a, 0xd0, 0xef, 0xe0, 0xd0, 0x82, 0x00, 0x00, 0xa8,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x58, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x98, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0xd6, 0xd1, 0x82, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0xf0, 0x10, 0x00, 0x48, 0xbc, 0xf0,
+    0x10, 0x00, 0x48, 0xbc, 0xee, 0x11, 0x00, 0x4f, 0xbc, 0xd2, 0x45, 0x00, 0x9f, 0xbc, 0x51, 0xe4, 0xce, 0x85, 0xbc,
+    0x46, 0xc4, 0x00, 0x00, 0x10, 0xec, 0x0a, 0x03, 0xe5, 0x1f, 0x00, 0x64, 0xa1, 0x00, 0x00, 0x8d, 0x78, 0x00, 0xbf,
+    0x45, 0x00, 0x00, 0x30, 0xd2, 0x1b, 0xe4, 0x03, 0x00, 0x00, 0x00, 0xd3, 0xa0, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x76,
+    0xff, 0x31, 0x00, 0x00, 0xe2, 0x1c, 0x00, 0x00, 0x00, 0x61, 0x99, 0xa5, 0x54, 0x06, 0x30, 0x00, 0x99, 0x5c, 0x69,
+    0x8c, 0x49, 0xf0, 0x08, 0xd1, 0x1f, 0x2c, 0xc4, 0x90, 0x8b, 0x53, 0xe0, 0x00, 0x01, 0xe4, 0xb0, 0x1e, 0xd1, 0xa6,
+    0x00, 0x00, 0xb2, 0x89, 0x00, 0xd2, 0x6a, 0x00, 0x18, 0xdb, 0x27, 0x00, 0x67, 0xb5, 0x01, 0x00, 0x3f, 0xce, 0x36,
+    0xd9, 0x13, 0x00, 0x00, 0x00, 0x7c, 0xf7, 0x38, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x6f,
+    0xb1, 0x16, 0xdc, 0x2f, 0x00, 0x37, 0xdb, 0x11, 0x00, 0x3e, 0xd9, 0x10, 0x3c, 0xd2, 0x00, 0x00, 0x09, 0xeb, 0x18,
+    0x00, 0xd1, 0x39, 0x00, 0x5f, 0xaa, 0x00, 0x00, 0x68, 0x9f, 0x00, 0xc4, 0x42, 0x00, 0x00, 0x0c, 0xe7, 0x38, 0xd8,
+    0x00, 0x00, 0x00, 0x00, 0x94, 0xe3, 0x71, 0x00, 0x00, 0x00, 0x00, 0x33, 0xf9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x73,
+    0xa3, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xcc, 0x1c, 0x00, 0x00, 0x00, 0x9f, 0xd0, 0xd0, 0xe6, 0xab, 0x00, 0x00, 0x14,
+    0xda, 0x40, 0x00, 0x05, 0xc1, 0x66, 0x00, 0x00, 0x98, 0x92, 0x00, 0x00, 0x6b, 0xba, 0x03, 0x00, 0x00, 0xe3, 0xdb,
+    0xd0, 0xd0, 0x8b, 0x00, 0x00, 0x0b, 0xb1, 0xd1, 0x3d, 0x00, 0x00, 0x49, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x54, 0xb0,
+    0x00, 0x00, 0x00, 0x00, 0x7e, 0x9f, 0x00, 0x00, 0x41, 0xdd, 0xf0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x56, 0xae, 0x00, 0x00, 0x00, 0x00, 0x53, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x03, 0x00,
+    0x00, 0x00, 0x03, 0xa1, 0xd1, 0x3d, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c,
+    0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x1c, 0xd4, 0x78, 0xd2, 0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf9, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x67, 0xfe, 0xdd,
+    0x0d, 0x00, 0x00, 0xdb, 0x5b, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00,
+    0x00, 0x1a, 0xf3, 0x00, 0x00, 0x00, 0x78, 0xd0, 0x6b, 0x00, 0x00, 0x00, 0x07, 0xab, 0xc3, 0x23, 0x00, 0x8c, 0x36,
+    0x58, 0x87, 0x29, 0xc8, 0x0d, 0xc8, 0x16, 0x72, 0x4f, 0x00, 0x53, 0xcc, 0x7a, 0x00, 0x64, 0x80, 0x60, 0x7d, 0x45,
+    0x65, 0x1e, 0x38, 0x5c, 0x7d, 0x94, 0x94, 0x8d, 0x8d, 0x00, 0x62, 0x33, 0x7c, 0x00, 0x55, 0xcb, 0xae, 0xa8, 0x11,
+    0x00, 0x8c, 0x7f, 0x0d, 0x00, 0x95, 0xc1, 0xca, 0x66, 0x00, 0x54, 0x3a, 0x83, 0x00, 0x00, 0x00, 0x2f, 0x87, 0x04,
+    0x34, 0x9b, 0x97, 0x39, 0x2d, 0xa7, 0x86, 0x05, 0x00, 0x13, 0x8e, 0x94, 0x31, 0x87, 0xb8, 0x6a, 0x00, 0x24, 0x74,
+    0x00, 0x00, 0x01, 0x05, 0x00, 0x69, 0x82, 0x13, 0x00, 0x00, 0x66, 0x7f, 0x1e, 0x41, 0x00, 0x00, 0x39, 0x3d, 0x00,
+    0x00, 0x46, 0x16, 0x7c, 0x71, 0x00, 0x00, 0x0b, 0x8d, 0x8e, 0x00, 0x14, 0xae, 0x81, 0x00, 0x00, 0x14, 0x88, 0x00,
+    0x00, 0x00, 0x6e, 0x7d, 0x45, 0x5e, 0x02, 0x9e, 0x00, 0x91, 0x98, 0x00, 0x52, 0x96, 0x94, 0xaa, 0x01, 0x3c, 0x5c,
+    0x39, 0x57, 0x45, 0x49, 0x9c, 0x01, 0xa3, 0x00, 0xa3, 0x00, 0xa0, 0x00, 0x7c, 0x22, 0x10, 0x35, 0x2a, 0x66, 0x00,
+    0x00, 0x9d, 0x00, 0x00, 0x9b, 0x08, 0x00, 0x8a, 0x16, 0x00, 0x9b, 0x00, 0x0c, 0x94, 0x00, 0x24, 0x21, 0x00, 0x00,
+    0x26, 0x42, 0x00, 0x39, 0x98, 0xa8, 0x46, 0x00, 0x85, 0x89, 0x02, 0x07, 0x28, 0x1b, 0x15, 0x00, 0x27, 0x3d, 0x00,
+    0x00, 0x38, 0x58, 0x00, 0x6a, 0xae, 0xbb, 0x80, 0x00, 0x38, 0x58, 0x00, 0x01, 0x01, 0x5a, 0x91, 0x16, 0x75, 0x32,
+    0x03, 0x2f, 0x98, 0x98, 0x44, 0x05, 0x0a, 0x5d, 0x78, 0x00, 0x00, 0x3d, 0x67, 0x00, 0x00, 0x9a, 0x09, 0x00, 0x21,
+    0x82, 0x00, 0x00, 0x89, 0x1a, 0x00, 0x0e, 0x95, 0x00, 0x00, 0x6e, 0x32, 0x00, 0x00, 0x16, 0xa6, 0xa5, 0x2b, 0x6e,
+    0x6a, 0x64, 0x90, 0x86, 0x61, 0x62, 0xa8, 0x6e, 0x47, 0x34, 0x90, 0x17, 0xa4, 0xa2, 0x2b, 0x00, 0x79, 0xa0, 0x00,
+    0x0c, 0x6b, 0xa0, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x0e, 0x9c, 0xd9, 0x66, 0x4c, 0x99, 0xb2,
+    0x2f, 0x00, 0x00, 0x40, 0x74, 0x00, 0x01, 0x96, 0x1b, 0x00, 0x82, 0x31, 0x00, 0x62, 0xc3, 0x98, 0x53, 0x39, 0x98,
+    0xb0, 0x35, 0x00, 0x00, 0x37, 0x7e, 0x00, 0x5f, 0xd0, 0x24, 0x00, 0x00, 0x18, 0x99, 0x4e, 0x90, 0xa4, 0x4a, 0x00,
+    0x10, 0xdb, 0x24, 0x00, 0x7f, 0x94, 0x24, 0x41, 0x50, 0x88, 0x24, 0x82, 0x98, 0xcf, 0x8a, 0x00, 0x00, 0x88, 0x24,
+    0x50, 0xbb, 0x9c, 0x24, 0x4f, 0xaf, 0x9d, 0x12, 0x01, 0x00, 0x42, 0x7c, 0x00, 0x00, 0x2a, 0x87, 0x5f, 0x97, 0xa8,
+    0x22, 0x0d, 0x98, 0x92, 0x2c, 0x66, 0x92, 0x98, 0x21, 0x85, 0x50, 0x15, 0x96, 0x71, 0x3e, 0x07, 0xa0, 0x18, 0xa4,
+    0x9e, 0x3d, 0x52, 0x9c, 0xb1, 0x88, 0x00, 0x00, 0x7e, 0x2b, 0x00, 0x02, 0xa9, 0x00, 0x00, 0x48, 0x67, 0x00, 0x00,
+    0xa3, 0x0e, 0x00, 0x28, 0xab, 0xa7, 0x41, 0x62, 0x51, 0x2f, 0x7d, 0x17, 0xc5, 0xc3, 0x28, 0x81, 0x3a, 0x11, 0xa4,
+    0x3e, 0xac, 0xa3, 0x57, 0x40, 0xa1, 0x98, 0x29, 0x88, 0x31, 0x2d, 0x8d, 0x24, 0xa0, 0x7c, 0xa1, 0x00, 0x00, 0x2c,
+    0x85, 0x24, 0x99, 0xaa, 0x1c, 0x58, 0x7f, 0x06, 0x0c, 0x00, 0x00, 0x58, 0x7f, 0x06, 0x0c, 0x00, 0x00, 0x69, 0x81,
+    0x0b, 0x10, 0x01, 0x03, 0x58, 0x9b, 0x0e, 0x7f, 0x46, 0x0e, 0x00, 0x03, 0x4c, 0x7e, 0x67, 0x94, 0x48, 0x03, 0x2f,
+    0x89, 0x8a, 0x36, 0x00, 0x00, 0x0c, 0x4e, 0x6a, 0x98, 0x98, 0x80, 0x6d, 0x9c, 0x9c, 0x83, 0x6b, 0x5b, 0x08, 0x00,
+    0x00, 0x3b, 0x8c, 0x80, 0x28, 0x83, 0x8f, 0x3f, 0x46, 0x14, 0x00, 0x00, 0x1c, 0x90, 0xb1, 0x3e, 0x00, 0x00, 0x60,
+    0x52, 0x00, 0x2c, 0x86, 0x00, 0x00, 0x1c, 0x18, 0x00, 0x00, 0x61, 0x58, 0x00, 0x02, 0x6d, 0x85, 0x45, 0x6c, 0x2b,
+    0x00, 0x95, 0x80, 0x31, 0x8f, 0xb6, 0x7f, 0x8e, 0x06, 0x91, 0x84, 0x2c, 0x7e, 0x8e, 0x62, 0x3e, 0x00, 0x00, 0x00,
+    0x5e, 0x86, 0x40, 0x00, 0x7f, 0x99, 0x00, 0x00, 0x00, 0xa0, 0x9f, 0x03, 0x00, 0x1d, 0x8c, 0x6b, 0x3f, 0x00, 0x6b,
+    0xae, 0x9f, 0x8d, 0x00, 0xac, 0x06, 0x00, 0xb3, 0x00, 0x70, 0xb0, 0xa7, 0x4b, 0x70, 0x3c, 0x24, 0x97, 0x70, 0xad,
+    0xbe, 0x4d, 0x70, 0x3c, 0x02, 0xab, 0x70, 0xad, 0x9b, 0x71, 0x08, 0x9e, 0x95, 0x62, 0x5a, 0x55, 0x00, 0x00, 0x7e,
+    0x31, 0x00, 0x00, 0x5e, 0x54, 0x00, 0x00, 0x07, 0x9a, 0x8e, 0x5f, 0x8c, 0xa6, 0xa5, 0x1d, 0x8c, 0x24, 0x27, 0x90,
+    0x8c, 0x24, 0x06, 0xb0, 0x8c, 0x24, 0x26, 0x90, 0x8c, 0xa2, 0xa3, 0x1d, 0x58, 0xbe, 0x9c, 0x63, 0x58, 0x58, 0x00,
+    0x00, 0x58, 0xbb, 0x98, 0x50, 0x58, 0x58, 0x00, 0x00, 0x58, 0xbb, 0x98, 0x6a, 0x38, 0xca, 0x9c, 0x72, 0x38, 0x78,
+    0x00, 0x00, 0x38, 0xc8, 0x98, 0x4e, 0x38, 0x78, 0x00, 0x00, 0x38, 0x78, 0x00, 0x00, 0x14, 0xa0, 0x90, 0x4e, 0x7e,
+    0x35, 0x00, 0x00, 0xa0, 0x11, 0x66, 0x8c, 0x7e, 0x33, 0x00, 0xa4, 0x14, 0xa0, 0x8d, 0x7c, 0x8c, 0x24, 0x00, 0xac,
+    0x8c, 0x24, 0x00, 0xac, 0x8c, 0xa6, 0x98, 0xac, 0x8c, 0x24, 0x00, 0xac, 0x8c, 0x24, 0x00, 0xac, 0x33, 0xb8, 0xc4,
+    0x46, 0x00, 0x48, 0x68, 0x00, 0x00, 0x48, 0x68, 0x00, 0x00, 0x48, 0x68, 0x00, 0x31, 0xb5, 0xc2, 0x44, 0x00, 0x75,
+    0xca, 0x34, 0x00, 0x00, 0x78, 0x34, 0x00, 0x00, 0x78, 0x34, 0x00, 0x00, 0x7d, 0x2a, 0x70, 0x90, 0xa4, 0x05, 0x8c,
+    0x24, 0x3e, 0x88, 0x00, 0x8c, 0x58, 0x91, 0x01, 0x00, 0x8c, 0xc6, 0x6a, 0x00, 0x00, 0x8c, 0x24, 0xa5, 0x23, 0x00,
+    0x8c, 0x24, 0x19, 0xb1, 0x02, 0x48, 0x68, 0x00, 0x00, 0x48, 0x68, 0x00, 0x00, 0x48, 0x68, 0x00, 0x00, 0x48, 0x68,
+    0x00, 0x00, 0x48, 0xc2, 0x98, 0x7d, 0xb1, 0x5a, 0x3c, 0xd0, 0xa0, 0x7b, 0x7a, 0xa2, 0xa0, 0x69, 0x7d, 0xa0, 0xa0,
+    0x0c, 0x14, 0xa0, 0xa0, 0x00, 0x00, 0xa0, 0x88, 0x87, 0x00, 0xa8, 0x88, 0xac, 0x06, 0xa8, 0x88, 0x58, 0x59, 0xa8,
+    0x88, 0x20, 0x90, 0xa8, 0x88, 0x20, 0x64, 0xab, 0x1d, 0xa7, 0xa6, 0x32, 0x7d, 0x33, 0x11, 0xa0, 0x96, 0x1c, 0x00,
+    0xb5, 0x7d, 0x33, 0x11, 0xa0, 0x1e, 0xa6, 0xa5, 0x33, 0x6c, 0xb2, 0xae, 0x5d, 0x6c, 0x40, 0x14, 0xb3, 0x6c, 0xb2,
+    0xa0, 0x3c, 0x6c, 0x40, 0x00, 0x00, 0x6c, 0x40, 0x00, 0x00, 0x1d, 0xa7, 0xa6, 0x32, 0x00, 0x7d, 0x33, 0x11, 0xa0,
+    0x00, 0x96, 0x1c, 0x00, 0xb6, 0x00, 0x7e, 0x33, 0x11, 0xa4, 0x00, 0x1e, 0xa7, 0xba, 0x39, 0x00, 0x00, 0x00, 0x4e,
+    0x78, 0x00, 0x84, 0xa8, 0xb0, 0x3c, 0x00, 0x84, 0x28, 0x3e, 0x87, 0x00, 0x84, 0xa2, 0xc6, 0x19, 0x00, 0x84, 0x28,
+    0x4a, 0x68, 0x00, 0x84, 0x28, 0x00, 0xb1, 0x05, 0x30, 0xa8, 0x93, 0x40, 0x7b, 0x35, 0x00, 0x00, 0x16, 0x92, 0xa4,
+    0x30, 0x00, 0x00, 0x0e, 0xa3, 0x50, 0x95, 0xa5, 0x50, 0x83, 0xb6, 0xc4, 0x99, 0x00, 0x44, 0x68, 0x00, 0x00, 0x44,
+    0x68, 0x00, 0x00, 0x44, 0x68, 0x00, 0x00, 0x44, 0x68, 0x00, 0x80, 0x2c, 0x08, 0xa4, 0x80, 0x2c, 0x08, 0xa4, 0x80,
+    0x2c, 0x08, 0xa4, 0x7a, 0x2e, 0x0c, 0x9c, 0x2e, 0xa6, 0xa3, 0x44, 0xa4, 0x0b, 0x00, 0xaf, 0x5f, 0x49, 0x27, 0x82,
+    0x16, 0x8a, 0x6c, 0x37, 0x00, 0x99, 0x9b, 0x02, 0x00, 0x7c, 0x96, 0x00, 0xa4, 0x00, 0x00, 0x97, 0x10, 0x9d, 0x61,
+    0x81, 0xa0, 0x00, 0x95, 0x7c, 0x7e, 0x97, 0x00, 0x7a, 0x8c, 0x79, 0x8e, 0x00, 0x53, 0x7e, 0x5b, 0x77, 0x00, 0x69,
+    0x4d, 0x1a, 0x9a, 0x00, 0x02, 0xa3, 0x96, 0x16, 0x00, 0x00, 0x70, 0x9f, 0x00, 0x00, 0x13, 0xa4, 0x7e, 0x2d, 0x00,
+    0x97, 0x23, 0x0b, 0xa9, 0x01, 0x91, 0x23, 0x10, 0xa7, 0x00, 0x14, 0x99, 0x86, 0x29, 0x00, 0x00, 0x72, 0x8d, 0x00,
+    0x00, 0x00, 0x48, 0x68, 0x00, 0x00, 0x00, 0x48, 0x68, 0x00, 0x00, 0x57, 0x9c, 0xb0, 0x9e, 0x00, 0x00, 0x9a, 0x1b,
+    0x00, 0x53, 0x5d, 0x00, 0x13, 0x99, 0x00, 0x00, 0x8d, 0xae, 0x98, 0x74, 0x9c, 0x7c, 0x15, 0xa0, 0x00, 0x00, 0xa0,
+    0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x9e, 0x80, 0x16, 0x5c, 0x4b, 0x00, 0x00, 0x05,
+    0xa0, 0x00, 0x00, 0x00, 0x77, 0x2c, 0x00, 0x00, 0x11, 0x91, 0x00, 0x00, 0x00, 0x8c, 0x15, 0x00, 0x00, 0x25, 0x78,
+    0x06, 0x80, 0xa4, 0x09, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x00, 0x90,
+    0x0c, 0x00, 0x00, 0x90, 0x0c, 0x06, 0x80, 0xa4, 0x09, 0x00, 0x93, 0xa3, 0x02, 0x5e, 0x4b, 0x32, 0x74, 0x4a, 0x6c,
+    0x6c, 0x57, 0x00, 0x50, 0x00, 0x00, 0x54, 0x3c, 0x25, 0x8b, 0x9c, 0x39, 0x19, 0x89, 0x8a, 0x8c, 0x7a, 0x29, 0x2b,
+    0x90, 0x41, 0xa4, 0x85, 0x9c, 0x5c, 0x44, 0x00, 0x00, 0x5c, 0xa9, 0xa2, 0x43, 0x5c, 0x53, 0x04, 0xa2, 0x5c, 0x51,
+    0x03, 0xa1, 0x5c, 0xa3, 0x9b, 0x42, 0x0b, 0x9b, 0x8f, 0x48, 0x5b, 0x4d, 0x00, 0x00, 0x5c, 0x4a, 0x00, 0x00, 0x0c,
+    0x98, 0x87, 0x45, 0x00, 0x00, 0x20, 0x80, 0x2a, 0xa7, 0x98, 0x80, 0x88, 0x1f, 0x2f, 0x80, 0x87, 0x1e, 0x2d, 0x80,
+    0x29, 0xa2, 0x92, 0x80, 0x18, 0x96, 0x92, 0x53, 0x7c, 0x90, 0x84, 0x82, 0x80, 0x2d, 0x00, 0x00, 0x1c, 0xa0, 0x8b,
+    0x68, 0x00, 0x4b, 0xa0, 0x3f, 0x38, 0xb8, 0x98, 0x3c, 0x00, 0x70, 0x30, 0x00, 0x00, 0x70, 0x30, 0x00, 0x00, 0x70,
+    0x30, 0x00, 0x19, 0xa6, 0x88, 0x96, 0x6e, 0x39, 0x17, 0x98, 0x6f, 0x38, 0x18, 0x98, 0x1a, 0xa4, 0x89, 0x90, 0x09,
+    0x80, 0x91, 0x39, 0x58, 0x44, 0x00, 0x00, 0x58, 0x9e, 0xaa, 0x3d, 0x58, 0x51, 0x1d, 0x82, 0x58, 0x44, 0x18, 0x88,
+    0x58, 0x44, 0x18, 0x88, 0x00, 0x44, 0x44, 0x00, 0x0c, 0xa4, 0x58, 0x00, 0x00, 0x48, 0x58, 0x00, 0x00, 0x45, 0x5c,
+    0x00, 0x00, 0x14, 0xaf, 0x5b, 0x00, 0x00, 0x86, 0x00, 0x70, 0xb8, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00,
+    0xa2, 0x1c, 0x93, 0x81, 0x3c, 0x64, 0x00, 0x00, 0x3c, 0x64, 0x72, 0x4d, 0x3c, 0xc7, 0x7d, 0x00, 0x3c, 0x7b, 0xa6,
+    0x10, 0x3c, 0x64, 0x22, 0x9a, 0x32, 0xb4, 0x38, 0x00, 0x00, 0x68, 0x38, 0x00, 0x00, 0x68, 0x38, 0x00, 0x00, 0x66,
+    0x3b, 0x00, 0x00, 0x2f, 0xac, 0x48, 0x99, 0x9b, 0x94, 0x88, 0x91, 0x36, 0x5d, 0x8e, 0x90, 0x34, 0x5c, 0x90, 0x90,
+    0x34, 0x5c, 0x90, 0x58, 0x92, 0x97, 0x3f, 0x58, 0x4d, 0x1b, 0x83, 0x58, 0x44, 0x18, 0x88, 0x58, 0x44, 0x18, 0x88,
+    0x20, 0xa6, 0xa3, 0x34, 0x7b, 0x2f, 0x0c, 0x9a, 0x7c, 0x2d, 0x0a, 0x9a, 0x22, 0xa1, 0x9c, 0x36, 0x5c, 0xa2, 0x8b,
+    0x40, 0x5c, 0x52, 0x02, 0x9e, 0x5c, 0x55, 0x04, 0x9f, 0x5c, 0xab, 0x99, 0x40, 0x5c, 0x44, 0x00, 0x00, 0x21, 0xa7,
+    0x8d, 0x8c, 0x7b, 0x2d, 0x25, 0x8c, 0x7c, 0x2c, 0x24, 0x8c, 0x24, 0xa4, 0x8e, 0x8c, 0x00, 0x00, 0x14, 0x8c, 0xbd,
+    0x7c, 0x60, 0xb4, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x17, 0xad, 0x87, 0x27, 0x23, 0xa6, 0x34, 0x00,
+    0x00, 0x1b, 0x89, 0x54, 0x2c, 0x86, 0xa3, 0x32, 0x00, 0x15, 0x04, 0x00, 0x00, 0x90, 0x10, 0x00, 0x48, 0xc8, 0x88,
+    0x3c, 0x00, 0x90, 0x10, 0x00, 0x00, 0x8e, 0x12, 0x00, 0x00, 0x54, 0x9b, 0x3c, 0x58, 0x44, 0x18, 0x88, 0x58, 0x44,
+    0x18, 0x88, 0x53, 0x48, 0x23, 0x88, 0x1d, 0xae, 0x81, 0x88, 0x81, 0x21, 0x0b, 0x97, 0x2b, 0x74, 0x55, 0x4b, 0x00,
+    0x9d, 0x99, 0x06, 0x00, 0x7e, 0x98, 0x00, 0x99, 0x00, 0x00, 0x8e, 0x0b, 0x96, 0x40, 0x58, 0x95, 0x00, 0x75, 0x88,
+    0x70, 0x8d, 0x00, 0x3c, 0x97, 0x74, 0x5f, 0x00, 0x44, 0x68, 0x48, 0x65, 0x00, 0x85, 0x9d, 0x00, 0x00, 0x97, 0xa1,
+    0x04, 0x64, 0x4f, 0x32, 0x7f, 0x74, 0x32, 0x08, 0x9b, 0x13, 0x8e, 0x5b, 0x43, 0x00, 0x94, 0xa0, 0x01, 0x00, 0x4f,
+    0x76, 0x00, 0x34, 0xab, 0x13, 0x00, 0x1e, 0x84, 0xad, 0x6d, 0x00, 0x0b, 0xa2, 0x06, 0x00, 0x92, 0x21, 0x00, 0x40,
+    0xc2, 0x84, 0x3f, 0x00, 0x1b, 0x8e, 0x21, 0x00, 0x58, 0x48, 0x00, 0x00, 0x64, 0x3f, 0x00, 0x48, 0xbb, 0x0e, 0x00,
+    0x00, 0x63, 0x3f, 0x00, 0x00, 0x58, 0x48, 0x00, 0x00, 0x1b, 0x91, 0x23, 0x38, 0x5c, 0x38, 0x5c, 0x38, 0x5c, 0x38,
+    0x5c, 0x38, 0x5c, 0x38, 0x5c, 0x38, 0x5c, 0x10, 0x8d, 0x2d, 0x00, 0x00, 0x28, 0x78, 0x00, 0x00, 0x1e, 0x88, 0x00,
+    0x00, 0x01, 0xc4, 0x6b, 0x00, 0x1f, 0x88, 0x00, 0x00, 0x28, 0x78, 0x00, 0x10, 0x8c, 0x2d, 0x00, 0x48, 0x96, 0x19,
+    0x6d, 0x65, 0x0b, 0x8d, 0x60
+};
@@ -1,7 +1,10 @@
 #include "menu_common.h"
 
+#include "font/Hack_Baked.h"
 #include "font/Hack_Compressed.h"
 
+#include <imgui/misc/freetype/imgui_freetype.h>
+
 #include <hooks/HooksDx.h>
 
 #include <proxies/XeSS_Proxy.h>
@@ -16,6 +19,8 @@
 
 #include <imgui/imgui_internal.h>
 
+#include <bit>
+
 constexpr float fontSize = 14.0f; // just changing this doesn't make other elements scale ideally
 static ImVec2 overlayPosition(-1000.0f, -1000.0f);
 static bool _hdrTonemapApplied = false;
@@ -1238,6 +1243,14 @@ static void MenuSizeCheck(ImGuiIO io)
 static double lastTime = 0.0;
 static UINT64 uwpTargetFrame = 0;
 
+ImDrawData* MenuCommon::FrameDrawData()
+{
+    if (!_frameRetained)
+        ImGui::Render();
+
+    return ImGui::GetDrawData();
+}
+
 bool MenuCommon::RenderMenu()
 {
     if (!_isInited)
@@ -1332,9 +1345,70 @@ bool MenuCommon::RenderMenu()
         inputFpsCycle = false;
     }
 
+    // Save newly rasterized glyphs, at most every 600 frames
+    if (_fontCache.Dirty() && ImGui::GetFrameCount() >= _fontCacheSaveFrame)
+    {
+        _fontCacheSaveFrame = ImGui::GetFrameCount() + 600;
+
+        if (!_fontCache.Save(Util::DllPath().parent_path() / "OptiScaler.fontcache"))
+            LOG_WARN("Can't save font cache");
+        else
+            LOG_DEBUG("Saved font cache, glyphs: {}, hits: {}, misses: {}", _fontCache.GlyphCount(), _fontCache.Hits(),
+                      _fontCache.Misses());
+    }
+
     // FPS Overlay font
     auto fpsScale = Config::Instance()->FpsScale.value_or(Config::Instance()->MenuScale.value_or_default());
 
+    // Only fps overlay is visible, keep last draw data if nothing changed visibly
+    // Frame time graphs (type 2 and up) scroll every frame, they are always rebuilt
+    _frameRetained = false;
+    if (Config::Instance()->ShowFps.value_or_default() && !_isVisible && ImGui::GetDrawData() != nullptr &&
+        Config::Instance()->FpsOverlayType.value_or_default() < 2)
+    {
+        float frameCnt = 0;
+        float avgFrameTime = 0;
+        for (size_t i = 299; i > 199; i--)
+        {
+            if (State::Instance().frameTimes[i] > 0.0)
+            {
+                avgFrameTime += State::Instance().frameTimes[i];
+                frameCnt++;
+            }
+        }
+
+        // No frame times yet, nothing to compare
+        if (frameCnt > 0)
+            avgFrameTime /= frameCnt;
+        else
+            _overlayThrottle.Invalidate();
+
+        OverlayThrottle::Snapshot snapshot;
+        snapshot.Values = { avgFrameTime > 0.0f ? 1000.0f / avgFrameTime : 0.0f, avgFrameTime, 0.0f, 0.0f };
+
+        auto layout = OverlayThrottle::Combine(0, Config::Instance()->FpsOverlayType.value_or_default());
+        layout = OverlayThrottle::Combine(layout, Config::Instance()->FpsOverlayPos.value_or_default());
+        layout = OverlayThrottle::Combine(layout, Config::Instance()->FpsOverlayHorizontal.value_or_default());
+        layout = OverlayThrottle::Combine(layout, std::bit_cast<uint32_t>(fpsScale));
+        layout = OverlayThrottle::Combine(layout, (uint64_t) io.DisplaySize.x << 32 | (uint64_t) io.DisplaySize.y);
+        layout = OverlayThrottle::Combine(layout, State::Instance().isHdrActive);
+        layout = OverlayThrottle::Combine(layout, (size_t) currentFeature);
+        layout = OverlayThrottle::Combine(layout, currentFeature != nullptr && currentFeature->IsFrozen());
+        snapshot.Layout = layout;
+
+        _overlayThrottle.SetRate(Config::Instance()->FpsOverlayUpdateRate.value_or_default());
+
+        if (!_overlayThrottle.ShouldUpdate(now, snapshot))
+        {
+            _frameRetained = true;
+            return true;
+        }
+    }
+    else
+    {
+        _overlayThrottle.Invalidate();
+    }
+
     if (Config::Instance()->FpsScale.has_value())
     {
         ImGuiStyle& style = ImGui::GetStyle();
@@ -3096,6 +3170,35 @@ bool MenuCommon::RenderMenu()
                     {
                         Config::Instance()->FramerateLimit = _limitFps;
                     }
+
+                    if (bool adaptive = Config::Instance()->FramerateLimitAdaptive.value_or_default();
+                        ImGui::Checkbox("Adaptive Limit", &adaptive))
+                        Config::Instance()->FramerateLimitAdaptive = adaptive;
+                    ShowHelpMarker("When the limit can't be reached and frames queue up,\nraises Reflex's interval to "
+                                   "just above the achieved frame time\nLowers latency when GPU bound");
+
+                    if (State::Instance().reflexLimitsFps)
+                    {
+                        auto timeline = ReflexHooks::latencyTimeline();
+
+                        if (timeline.HistoryCount() > 0)
+                        {
+                            ImGui::Text("Latency p50 / p99: %.1f / %.1f ms",
+                                        timeline.Percentile(LatencyTimeline::Latency, 50) / 1000.0f,
+                                        timeline.Percentile(LatencyTimeline::Latency, 99) / 1000.0f);
+                            ImGui::Text("Sim: %.1f, Submit: %.1f, Present: %.1f ms",
+                                        timeline.Percentile(LatencyTimeline::Simulation, 50) / 1000.0f,
+                                        timeline.Percentile(LatencyTimeline::RenderSubmit, 50) / 1000.0f,
+                                        timeline.Percentile(LatencyTimeline::Present, 50) / 1000.0f);
+
+                            if (ReflexHooks::injectedIntervalUs() != ReflexHooks::targetIntervalUs())
+                            {
+                                ImGui::Text("Interval: %.2f ms (target %.2f ms)",
+                                            ReflexHooks::injectedIntervalUs() / 1000.0f,
+                                            ReflexHooks::targetIntervalUs() / 1000.0f);
+                            }
+                        }
+                    }
                 }
 
                 if (currentFeature != nullptr && !currentFeature->IsFrozen())
@@ -3141,12 +3244,20 @@ bool MenuCommon::RenderMenu()
 
                             ImGui::BeginDisabled(_ssUseFsr || _ssRatio < 1.0f);
                             {
-                                const char* ds_modes[] = { "Bicubic", "Lanczos", "Catmull-Rom", "MAGC" };
-                                const std::string ds_modesDesc[] = { "", "", "", "" };
+                                const char* ds_modes[] = { "Bicubic", "Lanczos",      "Catmull-Rom",
+                                                           "MAGC",    "Lanczos Sep.", "Catmull-Rom Sep." };
+                                const std::string ds_modesDesc[] = {
+                                    "",
+                                    "",
+                                    "",
+                                    "",
+                                    "Two pass separable Lanczos, faster at high ratios (Dx12, Lanczos on Dx11)",
+                                    "Two pass separable Catmull-Rom, faster at high ratios (Dx12, Catmull-Rom on Dx11)"
+                                };
 
                                 ImGui::PushItemWidth(75.0f * Config::Instance()->MenuScale.value());
                                 PopulateCombo("Downscaler", &Config::Instance()->OutputScalingDownscaler, ds_modes,
-                                              ds_modesDesc, 4);
+                                              ds_modesDesc, 6);
                                 ImGui::PopItemWidth();
                             }
                             ImGui::EndDisabled();
@@ -3186,10 +3297,20 @@ bool MenuCommon::RenderMenu()
                         if (currentFeature != nullptr && !currentFeature->IsFrozen())
                         {
                             ImGui::Text(
-                                "Output Scaling is %s, Target Res: %dx%d\nJitter Count: %d",
+                                "Output Scaling is %s, Target Res: %dx%d\nJitter Count: %d, Implied Ratio: %.2f",
                                 Config::Instance()->OutputScalingEnabled.value_or_default() ? "ENABLED" : "DISABLED",
                                 (uint32_t) (currentFeature->DisplayWidth() * _ssRatio),
-                                (uint32_t) (currentFeature->DisplayHeight() * _ssRatio), currentFeature->JitterCount());
+                                (uint32_t) (currentFeature->DisplayHeight() * _ssRatio), currentFeature->JitterCount(),
+                                currentFeature->Jitter().ImpliedRatio());
+
+                            auto jitterUnits = currentFeature->Jitter().JitterUnits();
+
+                            if (jitterUnits == JitterAnalyzer::Units::Ndc || jitterUnits == JitterAnalyzer::Units::Uv)
+                            {
+                                ImGui::TextColored(ImVec4(1.f, 0.8f, 0.f, 1.f),
+                                                   "Jitter is in %s units instead of pixels",
+                                                   jitterUnits == JitterAnalyzer::Units::Ndc ? "NDC" : "UV");
+                            }
                         }
 
                         ImGui::EndDisabled();
@@ -4257,13 +4378,35 @@ void MenuCommon::Init(HWND InHwnd, bool isUWP)
         ImFontConfig fontConfig;
         // fontConfig.FontBuilderFlags |= ImGuiFreeTypeBuilderFlags_LightHinting;
 
+        if (Config::Instance()->FontCache.value_or_default())
+        {
+            auto cachePath = Util::DllPath().parent_path() / "OptiScaler.fontcache";
+
+            if (_fontCache.Load(cachePath))
+                LOG_INFO("Loaded {} cached font glyphs", _fontCache.GlyphCount());
+
+            // Embedded font at common menu sizes doesn't need the file
+            if (!_fontCache.LoadBaked(hack_baked_glyphs, sizeof(hack_baked_glyphs)))
+                LOG_WARN("Baked font glyphs are outdated");
+
+            _fontCache.Activate();
+            fontConfig.FontLoader = FontAtlasCache::Loader(ImGuiFreeType::GetFontLoader());
+        }
+
         if (Config::Instance()->TTFFontPath.has_value())
         {
+            // NoLoadError, missing font falls back to default one below
+            fontConfig.Flags |= ImFontFlags_NoLoadError;
             io.FontDefault =
                 atlas->AddFontFromFileTTF(wstring_to_string(Config::Instance()->TTFFontPath.value()).c_str(), fontSize,
                                           &fontConfig, io.Fonts->GetGlyphRangesDefault());
+            fontConfig.Flags &= ~ImFontFlags_NoLoadError;
+
+            if (io.FontDefault == nullptr)
+                LOG_WARN("Can't load TTFFontPath, using default font");
         }
-        else
+
+        if (io.FontDefault == nullptr)
         {
             io.FontDefault = atlas->AddFontFromMemoryCompressedBase85TTF(hack_compressed_compressed_data_base85,
                                                                          fontSize, &fontConfig);
@@ -5,6 +5,8 @@
 #include <Config.h>
 #include <resource.h>
 #include <Logger.h>
+#include "OverlayThrottle.h"
+#include "FontAtlasCache.h"
 
 #include <imgui/imgui.h>
 #include <imgui/imgui_impl_win32.h>
@@ -50,6 +52,14 @@ class MenuCommon
 
     inline static UINT64 _frameCount = 0;
 
+    // Retained fps overlay
+    inline static OverlayThrottle _overlayThrottle;
+    inline static bool _frameRetained = false;
+
+    // Menu font glyph cache
+    inline static FontAtlasCache _fontCache;
+    inline static int _fontCacheSaveFrame = 300;
+
     // reflex
     inline static float _limitFps = INFINITY;
 
@@ -146,6 +156,10 @@ class MenuCommon
     static void VulkanInited() { _vulkanReady = true; }
     static bool IsInited() { return _isInited; }
     static bool IsVisible() { return _isVisible; }
+
+    // Draw data to submit, ImGui::Render is skipped on retained frames and last draw data is returned.
+    // Overlay renderers keep its vertices in their own buffers and upload only when it changes (RetainedDrawData)
+    static ImDrawData* FrameDrawData();
     static HWND Handle() { return _handle; }
 
     static bool RenderMenu();
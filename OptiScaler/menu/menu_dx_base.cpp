@@ -15,7 +15,7 @@ bool MenuDxBase::RenderMenu()
 
     if (MenuCommon::RenderMenu())
     {
-        ImGui::Render();
+        MenuCommon::FrameDrawData();
         return true;
     }
 
@@ -20,6 +20,8 @@ bool MenuOverlayBase::IsInited() { return MenuCommon::IsInited(); }
 
 bool MenuOverlayBase::IsVisible() { return MenuCommon::IsVisible(); }
 
+ImDrawData* MenuOverlayBase::FrameDrawData() { return MenuCommon::FrameDrawData(); }
+
 void MenuOverlayBase::Init(HWND InHandle, bool isUWP)
 {
     if (!Config::Instance()->OverlayMenu.value_or_default())
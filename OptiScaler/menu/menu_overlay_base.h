@@ -5,6 +5,8 @@
 #include <d3d12.h>
 #include <dxgi1_6.h>
 
+struct ImDrawData;
+
 class MenuOverlayBase
 {
   public:
@@ -16,6 +18,7 @@ class MenuOverlayBase
 
     static bool IsInited();
     static bool IsVisible();
+    static ImDrawData* FrameDrawData();
 
     static void Init(HWND InHandle, bool isUWP);
     static bool RenderMenu();
@@ -1,5 +1,6 @@
 #include "menu_overlay_base.h"
 #include "menu_overlay_dx.h"
+#include "RetainedDrawData.h"
 
 #include <Util.h>
 #include <Logger.h>
@@ -47,6 +48,26 @@ static std::mutex _dx12CleanMutex;
 
 static IID streamlineRiid {};
 
+// retained overlay buffers, uploaded only when draw data changes
+static RetainedDrawData _dx11Retained;
+static ID3D11Buffer* _dx11RetainedVB = nullptr;
+static ID3D11Buffer* _dx11RetainedIB = nullptr;
+static int _dx11RetainedVtxSize = 0;
+static int _dx11RetainedIdxSize = 0;
+
+struct RetainedBuffersDx12
+{
+    ID3D12Resource* VB = nullptr;
+    ID3D12Resource* IB = nullptr;
+    int VtxSize = 0;
+    int IdxSize = 0;
+};
+
+// One per frame in flight, a buffer is written again only after the other frames have used theirs
+static RetainedDrawData _dx12Retained;
+static RetainedBuffersDx12 _dx12RetainedBuffers[NUM_BACK_BUFFERS] = {};
+static UINT _dx12RetainedIndex = 0;
+
 static bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnknown** ppRealObject)
 {
     if (streamlineRiid.Data1 == 0)
@@ -80,6 +101,295 @@ static int GetCorrectDXGIFormat(int eCurrentFormat)
     return eCurrentFormat;
 }
 
+static void ReleaseRetainedDx11()
+{
+    if (_dx11RetainedVB != nullptr)
+    {
+        _dx11RetainedVB->Release();
+        _dx11RetainedVB = nullptr;
+    }
+
+    if (_dx11RetainedIB != nullptr)
+    {
+        _dx11RetainedIB->Release();
+        _dx11RetainedIB = nullptr;
+    }
+
+    _dx11RetainedVtxSize = 0;
+    _dx11RetainedIdxSize = 0;
+    _dx11Retained.Invalidate();
+}
+
+static bool CreateRetainedBufferDx11(UINT size, UINT bindFlags, ID3D11Buffer** buffer)
+{
+    D3D11_BUFFER_DESC desc = {};
+    desc.Usage = D3D11_USAGE_DYNAMIC;
+    desc.ByteWidth = size;
+    desc.BindFlags = bindFlags;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    auto result = g_pd3dDevice->CreateBuffer(&desc, nullptr, buffer);
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateBuffer: {0:X}", (unsigned long) result);
+        return false;
+    }
+
+    return true;
+}
+
+static bool UploadRetainedDx11(ImDrawData* drawData)
+{
+    if (_dx11RetainedVB == nullptr || _dx11RetainedVtxSize < drawData->TotalVtxCount)
+    {
+        if (_dx11RetainedVB != nullptr)
+        {
+            _dx11RetainedVB->Release();
+            _dx11RetainedVB = nullptr;
+        }
+
+        if (!CreateRetainedBufferDx11((drawData->TotalVtxCount + 5000) * sizeof(ImDrawVert),
+                                      D3D11_BIND_VERTEX_BUFFER, &_dx11RetainedVB))
+            return false;
+
+        _dx11RetainedVtxSize = drawData->TotalVtxCount + 5000;
+    }
+
+    if (_dx11RetainedIB == nullptr || _dx11RetainedIdxSize < drawData->TotalIdxCount)
+    {
+        if (_dx11RetainedIB != nullptr)
+        {
+            _dx11RetainedIB->Release();
+            _dx11RetainedIB = nullptr;
+        }
+
+        if (!CreateRetainedBufferDx11((drawData->TotalIdxCount + 10000) * sizeof(ImDrawIdx), D3D11_BIND_INDEX_BUFFER,
+                                      &_dx11RetainedIB))
+            return false;
+
+        _dx11RetainedIdxSize = drawData->TotalIdxCount + 10000;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE vtx {};
+    D3D11_MAPPED_SUBRESOURCE idx {};
+
+    if (g_pd3dDeviceContext->Map(_dx11RetainedVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &vtx) != S_OK)
+        return false;
+
+    if (g_pd3dDeviceContext->Map(_dx11RetainedIB, 0, D3D11_MAP_WRITE_DISCARD, 0, &idx) != S_OK)
+    {
+        g_pd3dDeviceContext->Unmap(_dx11RetainedVB, 0);
+        return false;
+    }
+
+    RetainedDrawData::CopyBuffers(drawData, (ImDrawVert*) vtx.pData, (ImDrawIdx*) idx.pData);
+
+    g_pd3dDeviceContext->Unmap(_dx11RetainedVB, 0);
+    g_pd3dDeviceContext->Unmap(_dx11RetainedIB, 0);
+
+    return true;
+}
+
+// Called by the backend after it has set up shaders, blend and viewport
+static void DrawRetainedDx11(const ImDrawList*, const ImDrawCmd* cmd)
+{
+    auto context = (const RetainedDrawData::Context*) cmd->UserCallbackData;
+    auto state = (ImGui_ImplDX11_RenderState*) ImGui::GetPlatformIO().Renderer_RenderState;
+    auto deviceContext = state->DeviceContext;
+
+    UINT stride = sizeof(ImDrawVert);
+    UINT offset = 0;
+    deviceContext->IASetVertexBuffers(0, 1, &_dx11RetainedVB, &stride, &offset);
+    deviceContext->IASetIndexBuffer(_dx11RetainedIB,
+                                    sizeof(ImDrawIdx) == 2 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT, 0);
+
+    RetainedDrawData::Scissor scissor;
+
+    for (const auto& command : context->Owner->Commands())
+    {
+        if (!context->Owner->CommandScissor(command, scissor))
+            continue;
+
+        const D3D11_RECT rect = { scissor.X0, scissor.Y0, scissor.X1, scissor.Y1 };
+        deviceContext->RSSetScissorRects(1, &rect);
+
+        auto srv = (ID3D11ShaderResourceView*) command.TexRef.GetTexID();
+        deviceContext->PSSetShaderResources(0, 1, &srv);
+        deviceContext->DrawIndexed(command.ElemCount, command.IdxOffset, command.VtxOffset);
+    }
+}
+
+static ImDrawData* RetainedDrawDataDx11(ImDrawData* drawData)
+{
+    auto update = _dx11Retained.Update(drawData, ImGui::GetFrameCount());
+
+    if (update == RetainedDrawData::NotRetainable)
+        return drawData;
+
+    if (update == RetainedDrawData::Changed && !UploadRetainedDx11(drawData))
+    {
+        _dx11Retained.Invalidate();
+        return drawData;
+    }
+
+    return _dx11Retained.Replay(DrawRetainedDx11, nullptr);
+}
+
+static void ReleaseRetainedDx12()
+{
+    for (auto& buffers : _dx12RetainedBuffers)
+    {
+        if (buffers.VB != nullptr)
+            buffers.VB->Release();
+
+        if (buffers.IB != nullptr)
+            buffers.IB->Release();
+
+        buffers = {};
+    }
+
+    _dx12RetainedIndex = 0;
+    _dx12Retained.Invalidate();
+}
+
+static bool CreateRetainedBufferDx12(UINT64 size, ID3D12Resource** buffer)
+{
+    D3D12_HEAP_PROPERTIES props = {};
+    props.Type = D3D12_HEAP_TYPE_UPLOAD;
+    props.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    props.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+
+    D3D12_RESOURCE_DESC desc = {};
+    desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    desc.Width = size;
+    desc.Height = 1;
+    desc.DepthOrArraySize = 1;
+    desc.MipLevels = 1;
+    desc.Format = DXGI_FORMAT_UNKNOWN;
+    desc.SampleDesc.Count = 1;
+    desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    auto result = g_pd3dDeviceParam->CreateCommittedResource(&props, D3D12_HEAP_FLAG_NONE, &desc,
+                                                             D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+                                                             IID_PPV_ARGS(buffer));
+    if (result != S_OK)
+    {
+        LOG_ERROR("CreateCommittedResource: {0:X}", (unsigned long) result);
+        return false;
+    }
+
+    return true;
+}
+
+static bool UploadRetainedDx12(ImDrawData* drawData)
+{
+    auto index = (_dx12RetainedIndex + 1) % NUM_BACK_BUFFERS;
+    auto& buffers = _dx12RetainedBuffers[index];
+
+    if (buffers.VB == nullptr || buffers.VtxSize < drawData->TotalVtxCount)
+    {
+        if (buffers.VB != nullptr)
+        {
+            buffers.VB->Release();
+            buffers.VB = nullptr;
+        }
+
+        if (!CreateRetainedBufferDx12((drawData->TotalVtxCount + 5000) * sizeof(ImDrawVert), &buffers.VB))
+            return false;
+
+        buffers.VtxSize = drawData->TotalVtxCount + 5000;
+    }
+
+    if (buffers.IB == nullptr || buffers.IdxSize < drawData->TotalIdxCount)
+    {
+        if (buffers.IB != nullptr)
+        {
+            buffers.IB->Release();
+            buffers.IB = nullptr;
+        }
+
+        if (!CreateRetainedBufferDx12((drawData->TotalIdxCount + 10000) * sizeof(ImDrawIdx), &buffers.IB))
+            return false;
+
+        buffers.IdxSize = drawData->TotalIdxCount + 10000;
+    }
+
+    void* vtx = nullptr;
+    void* idx = nullptr;
+    D3D12_RANGE range = {};
+
+    if (buffers.VB->Map(0, &range, &vtx) != S_OK)
+        return false;
+
+    if (buffers.IB->Map(0, &range, &idx) != S_OK)
+    {
+        buffers.VB->Unmap(0, nullptr);
+        return false;
+    }
+
+    RetainedDrawData::CopyBuffers(drawData, (ImDrawVert*) vtx, (ImDrawIdx*) idx);
+
+    buffers.VB->Unmap(0, nullptr);
+    buffers.IB->Unmap(0, nullptr);
+
+    _dx12RetainedIndex = index;
+    return true;
+}
+
+// Called by the backend after it has set up root signature, pipeline and viewport
+static void DrawRetainedDx12(const ImDrawList*, const ImDrawCmd* cmd)
+{
+    auto context = (const RetainedDrawData::Context*) cmd->UserCallbackData;
+    auto buffers = (const RetainedBuffersDx12*) context->Renderer;
+    auto state = (ImGui_ImplDX12_RenderState*) ImGui::GetPlatformIO().Renderer_RenderState;
+    auto commandList = state->CommandList;
+
+    D3D12_VERTEX_BUFFER_VIEW vbv = {};
+    vbv.BufferLocation = buffers->VB->GetGPUVirtualAddress();
+    vbv.SizeInBytes = buffers->VtxSize * sizeof(ImDrawVert);
+    vbv.StrideInBytes = sizeof(ImDrawVert);
+    commandList->IASetVertexBuffers(0, 1, &vbv);
+
+    D3D12_INDEX_BUFFER_VIEW ibv = {};
+    ibv.BufferLocation = buffers->IB->GetGPUVirtualAddress();
+    ibv.SizeInBytes = buffers->IdxSize * sizeof(ImDrawIdx);
+    ibv.Format = sizeof(ImDrawIdx) == 2 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+    commandList->IASetIndexBuffer(&ibv);
+
+    RetainedDrawData::Scissor scissor;
+
+    for (const auto& command : context->Owner->Commands())
+    {
+        if (!context->Owner->CommandScissor(command, scissor))
+            continue;
+
+        const D3D12_RECT rect = { scissor.X0, scissor.Y0, scissor.X1, scissor.Y1 };
+        commandList->RSSetScissorRects(1, &rect);
+
+        D3D12_GPU_DESCRIPTOR_HANDLE texture = {};
+        texture.ptr = (UINT64) command.TexRef.GetTexID();
+        commandList->SetGraphicsRootDescriptorTable(1, texture);
+        commandList->DrawIndexedInstanced(command.ElemCount, 1, command.IdxOffset, command.VtxOffset, 0);
+    }
+}
+
+static ImDrawData* RetainedDrawDataDx12(ImDrawData* drawData)
+{
+    auto update = _dx12Retained.Update(drawData, ImGui::GetFrameCount());
+
+    if (update == RetainedDrawData::NotRetainable)
+        return drawData;
+
+    if (update == RetainedDrawData::Changed && !UploadRetainedDx12(drawData))
+    {
+        _dx12Retained.Invalidate();
+        return drawData;
+    }
+
+    return _dx12Retained.Replay(DrawRetainedDx12, &_dx12RetainedBuffers[_dx12RetainedIndex]);
+}
+
 static void CreateRenderTargetDx12(ID3D12Device* device, IDXGISwapChain* pSwapChain)
 {
     LOG_FUNC();
@@ -181,6 +491,7 @@ static void CleanupRenderTargetDx12(bool clearQueue)
         }
 
         g_pd3dSrvDescHeapAlloc.Destroy();
+        ReleaseRetainedDx12();
 
         // if (g_pd3dDeviceParam != nullptr)
         //{
@@ -226,6 +537,8 @@ static void CleanupRenderTargetDx11(bool shutDown)
         g_pd3dRenderTarget = nullptr;
     }
 
+    ReleaseRetainedDx11();
+
     if (g_pd3dDevice != nullptr)
     {
         g_pd3dDevice->Release();
@@ -288,10 +601,10 @@ static void RenderImGui_DX11(IDXGISwapChain* pSwapChain)
 
             if (MenuOverlayBase::RenderMenu())
             {
-                ImGui::Render();
+                auto drawData = RetainedDrawDataDx11(MenuOverlayBase::FrameDrawData());
 
                 g_pd3dDeviceContext->OMSetRenderTargets(1, &g_pd3dRenderTarget, NULL);
-                ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+                ImGui_ImplDX11_RenderDrawData(drawData);
             }
         }
     }
@@ -469,7 +782,7 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
 
             if (MenuOverlayBase::RenderMenu())
             {
-                ImGui::Render();
+                auto drawData = RetainedDrawDataDx12(MenuOverlayBase::FrameDrawData());
 
                 UINT backBufferIdx = pSwapChain->GetCurrentBackBufferIndex();
                 ID3D12CommandAllocator* commandAllocator = g_commandAllocators[backBufferIdx];
@@ -503,7 +816,7 @@ static void RenderImGui_DX12(IDXGISwapChain* pSwapChainPlain)
                 g_pd3dCommandList->OMSetRenderTargets(1, &g_mainRenderTargetDescriptor[backBufferIdx], FALSE, NULL);
                 g_pd3dCommandList->SetDescriptorHeaps(1, &g_pd3dSrvDescHeap);
 
-                ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), g_pd3dCommandList);
+                ImGui_ImplDX12_RenderDrawData(drawData, g_pd3dCommandList);
 
                 barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
                 barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
@@ -1,5 +1,6 @@
 #include "menu_overlay_base.h"
 #include "menu_overlay_vk.h"
+#include "RetainedDrawData.h"
 
 #include <Util.h>
 #include <Config.h>
@@ -25,6 +26,209 @@ static VkRenderPass _vkRenderPass = VK_NULL_HANDLE;
 static uint32_t _scImageCount;
 static ULONG64 _frameCount;
 
+struct RetainedBuffersVk
+{
+    VkBuffer VB = VK_NULL_HANDLE;
+    VkBuffer IB = VK_NULL_HANDLE;
+    VkDeviceMemory VBMemory = VK_NULL_HANDLE;
+    VkDeviceMemory IBMemory = VK_NULL_HANDLE;
+    VkDeviceSize VBSize = 0;
+    VkDeviceSize IBSize = 0;
+};
+
+// retained overlay buffers, one per swapchain image like the backend's, uploaded only when draw data changes
+static RetainedDrawData _vkRetained;
+static std::vector<RetainedBuffersVk> _vkRetainedBuffers;
+static uint32_t _vkRetainedIndex = 0;
+
+static void ReleaseRetainedBufferVk(VkBuffer& buffer, VkDeviceMemory& memory)
+{
+    if (buffer != VK_NULL_HANDLE)
+    {
+        vkDestroyBuffer(_ImVulkan_Info.Device, buffer, VK_NULL_HANDLE);
+        buffer = VK_NULL_HANDLE;
+    }
+
+    if (memory != VK_NULL_HANDLE)
+    {
+        vkFreeMemory(_ImVulkan_Info.Device, memory, VK_NULL_HANDLE);
+        memory = VK_NULL_HANDLE;
+    }
+}
+
+static void ReleaseRetainedVk()
+{
+    for (auto& buffers : _vkRetainedBuffers)
+    {
+        ReleaseRetainedBufferVk(buffers.VB, buffers.VBMemory);
+        ReleaseRetainedBufferVk(buffers.IB, buffers.IBMemory);
+    }
+
+    _vkRetainedBuffers.clear();
+    _vkRetainedIndex = 0;
+}
+
+static bool CreateRetainedBufferVk(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer,
+                                   VkDeviceMemory& memory)
+{
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    auto result = vkCreateBuffer(_ImVulkan_Info.Device, &bufferInfo, VK_NULL_HANDLE, &buffer);
+    if (result != VK_SUCCESS)
+    {
+        LOG_ERROR("vkCreateBuffer error: {0:X}", (UINT) result);
+        return false;
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(_ImVulkan_Info.Device, buffer, &requirements);
+
+    VkPhysicalDeviceMemoryProperties properties;
+    vkGetPhysicalDeviceMemoryProperties(_ImVulkan_Info.PhysicalDevice, &properties);
+
+    // Coherent so nothing needs to be flushed after the rare uploads
+    const VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    uint32_t memoryType = UINT32_MAX;
+
+    for (uint32_t i = 0; i < properties.memoryTypeCount; i++)
+    {
+        if ((requirements.memoryTypeBits & (1u << i)) && (properties.memoryTypes[i].propertyFlags & flags) == flags)
+        {
+            memoryType = i;
+            break;
+        }
+    }
+
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = memoryType;
+
+    result = memoryType == UINT32_MAX ? VK_ERROR_FEATURE_NOT_PRESENT
+                                      : vkAllocateMemory(_ImVulkan_Info.Device, &allocInfo, VK_NULL_HANDLE, &memory);
+
+    if (result == VK_SUCCESS)
+        result = vkBindBufferMemory(_ImVulkan_Info.Device, buffer, memory, 0);
+
+    if (result != VK_SUCCESS)
+    {
+        LOG_ERROR("Retained buffer memory error: {0:X}", (UINT) result);
+        ReleaseRetainedBufferVk(buffer, memory);
+        return false;
+    }
+
+    return true;
+}
+
+static bool UploadRetainedVk(ImDrawData* drawData)
+{
+    if (_vkRetainedBuffers.size() != _ImVulkan_Info.ImageCount)
+    {
+        ReleaseRetainedVk();
+        _vkRetainedBuffers.resize(_ImVulkan_Info.ImageCount);
+    }
+
+    auto index = (_vkRetainedIndex + 1) % (uint32_t) _vkRetainedBuffers.size();
+    auto& buffers = _vkRetainedBuffers[index];
+
+    VkDeviceSize vtxSize = (drawData->TotalVtxCount + 5000) * sizeof(ImDrawVert);
+    VkDeviceSize idxSize = (drawData->TotalIdxCount + 10000) * sizeof(ImDrawIdx);
+
+    if (buffers.VB == VK_NULL_HANDLE || buffers.VBSize < drawData->TotalVtxCount * sizeof(ImDrawVert))
+    {
+        ReleaseRetainedBufferVk(buffers.VB, buffers.VBMemory);
+        buffers.VBSize = 0;
+
+        if (!CreateRetainedBufferVk(vtxSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, buffers.VB, buffers.VBMemory))
+            return false;
+
+        buffers.VBSize = vtxSize;
+    }
+
+    if (buffers.IB == VK_NULL_HANDLE || buffers.IBSize < drawData->TotalIdxCount * sizeof(ImDrawIdx))
+    {
+        ReleaseRetainedBufferVk(buffers.IB, buffers.IBMemory);
+        buffers.IBSize = 0;
+
+        if (!CreateRetainedBufferVk(idxSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, buffers.IB, buffers.IBMemory))
+            return false;
+
+        buffers.IBSize = idxSize;
+    }
+
+    void* vtx = nullptr;
+    void* idx = nullptr;
+
+    if (vkMapMemory(_ImVulkan_Info.Device, buffers.VBMemory, 0, VK_WHOLE_SIZE, 0, &vtx) != VK_SUCCESS)
+        return false;
+
+    if (vkMapMemory(_ImVulkan_Info.Device, buffers.IBMemory, 0, VK_WHOLE_SIZE, 0, &idx) != VK_SUCCESS)
+    {
+        vkUnmapMemory(_ImVulkan_Info.Device, buffers.VBMemory);
+        return false;
+    }
+
+    RetainedDrawData::CopyBuffers(drawData, (ImDrawVert*) vtx, (ImDrawIdx*) idx);
+
+    vkUnmapMemory(_ImVulkan_Info.Device, buffers.VBMemory);
+    vkUnmapMemory(_ImVulkan_Info.Device, buffers.IBMemory);
+
+    _vkRetainedIndex = index;
+    return true;
+}
+
+// Called by the backend after it has bound the pipeline, viewport and push constants
+static void DrawRetainedVk(const ImDrawList*, const ImDrawCmd* cmd)
+{
+    auto context = (const RetainedDrawData::Context*) cmd->UserCallbackData;
+    auto buffers = (const RetainedBuffersVk*) context->Renderer;
+    auto state = (ImGui_ImplVulkan_RenderState*) ImGui::GetPlatformIO().Renderer_RenderState;
+    auto commandBuffer = state->CommandBuffer;
+
+    VkDeviceSize offset = 0;
+    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &buffers->VB, &offset);
+    vkCmdBindIndexBuffer(commandBuffer, buffers->IB, 0,
+                         sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+
+    RetainedDrawData::Scissor scissor;
+
+    for (const auto& command : context->Owner->Commands())
+    {
+        if (!context->Owner->CommandScissor(command, scissor))
+            continue;
+
+        VkRect2D rect;
+        rect.offset = { scissor.X0, scissor.Y0 };
+        rect.extent = { (uint32_t) (scissor.X1 - scissor.X0), (uint32_t) (scissor.Y1 - scissor.Y0) };
+        vkCmdSetScissor(commandBuffer, 0, 1, &rect);
+
+        auto descriptorSet = (VkDescriptorSet) command.TexRef.GetTexID();
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, state->PipelineLayout, 0, 1,
+                                &descriptorSet, 0, nullptr);
+        vkCmdDrawIndexed(commandBuffer, command.ElemCount, 1, command.IdxOffset, command.VtxOffset, 0);
+    }
+}
+
+static ImDrawData* RetainedDrawDataVk(ImDrawData* drawData)
+{
+    auto update = _vkRetained.Update(drawData, ImGui::GetFrameCount());
+
+    if (update == RetainedDrawData::NotRetainable)
+        return drawData;
+
+    if (update == RetainedDrawData::Changed && !UploadRetainedVk(drawData))
+    {
+        _vkRetained.Invalidate();
+        return drawData;
+    }
+
+    return _vkRetained.Replay(DrawRetainedVk, &_vkRetainedBuffers[_vkRetainedIndex]);
+}
+
 static void CreateVulkanObjects(VkDevice device, VkPhysicalDevice pd, VkInstance instance, HWND hwnd,
                                 const VkSwapchainCreateInfoKHR* pCreateInfo, VkSwapchainKHR* pSwapchain)
 {
@@ -443,6 +647,8 @@ void MenuOverlayVk::DestroyVulkanObjects(bool shutdown)
         }
     }
 
+    ReleaseRetainedVk();
+    _vkRetained.Invalidate();
     _ImVulkan_Info = {};
 
     _vkCleanMutex.unlock();
@@ -506,8 +712,8 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
                     vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
                 }
 
-                ImGui::Render();
-                ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), fd->CommandBuffer);
+                ImGui_ImplVulkan_RenderDrawData(RetainedDrawDataVk(MenuOverlayBase::FrameDrawData()),
+                                                fd->CommandBuffer);
 
                 // Submit command buffer
                 vkCmdEndRenderPass(fd->CommandBuffer);
@@ -545,7 +751,7 @@ bool MenuOverlayVk::QueuePresent(VkQueue queue, VkPresentInfoKHR* pPresentInfo)
             else
             {
                 // To make RenderMenu happy as it expects this
-                ImGui::Render();
+                MenuOverlayBase::FrameDrawData();
             }
         }
     }
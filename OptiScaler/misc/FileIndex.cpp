@@ -0,0 +1,265 @@
+#include "FileIndex.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+static constexpr const char* CacheHeader = "FileIndex 1";
+static constexpr fs::path::value_type Separators[] = { '/', '\\', 0 };
+
+static std::string ToUtf8(const fs::path& InPath)
+{
+    auto u8 = InPath.u8string();
+    return std::string(reinterpret_cast<const char*>(u8.data()), u8.size());
+}
+
+static fs::path FromUtf8(const std::string& InString)
+{
+    return fs::path(std::u8string(reinterpret_cast<const char8_t*>(InString.data()), InString.size()));
+}
+
+static int64_t LastWrite(const fs::path& InPath, bool& OutValid)
+{
+    std::error_code ec;
+    auto time = fs::last_write_time(InPath, ec);
+    OutValid = !ec;
+    return ec ? 0 : (int64_t) time.time_since_epoch().count();
+}
+
+FileIndex::FileIndex(fs::path InRoot, int InMaxDepth) : _root(std::move(InRoot)), _maxDepth(InMaxDepth) {}
+
+FileIndex::Key FileIndex::Fold(const fs::path& InFileName)
+{
+    Key key = InFileName.native();
+
+    for (auto& c : key)
+    {
+        if (c >= 'A' && c <= 'Z')
+            c = c + ('a' - 'A');
+    }
+
+    return key;
+}
+
+void FileIndex::Watch(const std::vector<fs::path>& InFileNames)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& name : InFileNames)
+        _names.try_emplace(Fold(name));
+}
+
+FileIndex::Result FileIndex::Find(const fs::path& InFileName) { return Find(std::vector<fs::path> { InFileName })[0]; }
+
+std::vector<FileIndex::Result> FileIndex::Find(const std::vector<fs::path>& InFileNames)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    bool walk = false;
+
+    for (const auto& name : InFileNames)
+    {
+        auto& entry = _names[Fold(name)];
+        walk |= !entry.searched;
+    }
+
+    // Incomplete walks are not saved, names they didn't find are searched again next time
+    if (walk && Walk() && _cacheFile.has_value())
+        Save(_cacheFile.value());
+
+    std::vector<Result> results;
+    results.reserve(InFileNames.size());
+
+    for (const auto& name : InFileNames)
+        results.push_back(_names[Fold(name)].path);
+
+    return results;
+}
+
+bool FileIndex::Walk()
+{
+    _walkCount++;
+    _directories.clear();
+
+    // Most files are rejected by their name length without folding the name
+    size_t pending = 0;
+    uint64_t pendingLengths = 0;
+
+    for (auto& [key, entry] : _names)
+    {
+        if (entry.searched)
+            continue;
+
+        pending++;
+        pendingLengths |= key.size() < 64 ? (1ull << key.size()) : ~0ull;
+    }
+
+    bool valid;
+    auto rootTime = LastWrite(_root, valid);
+
+    if (valid)
+        _directories.push_back({ _root, rootTime });
+
+    std::error_code ec;
+    fs::recursive_directory_iterator it(_root, fs::directory_options::skip_permission_denied, ec);
+
+    for (; !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        const auto& dirEntry = *it;
+        std::error_code typeEc;
+
+        if (dirEntry.is_directory(typeEc))
+        {
+            if (it.depth() + 1 >= _maxDepth)
+                it.disable_recursion_pending();
+            else if (auto time = LastWrite(dirEntry.path(), valid); valid)
+                _directories.push_back({ dirEntry.path(), time });
+
+            continue;
+        }
+
+        if (pending == 0)
+            continue;
+
+        const auto& native = dirEntry.path().native();
+        auto separator = native.find_last_of(Separators);
+        auto nameStart = separator == Key::npos ? 0 : separator + 1;
+        auto nameLength = native.size() - nameStart;
+
+        if (nameLength < 64 && (pendingLengths & (1ull << nameLength)) == 0)
+            continue;
+
+        auto found = _names.find(Fold(native.substr(nameStart)));
+
+        if (found == _names.end() || found->second.searched || found->second.path.has_value())
+            continue;
+
+        found->second.path = dirEntry.path();
+        found->second.searched = true;
+        pending--;
+    }
+
+    // Iterator stops at the first error (folder removed while walking, out of handles...), files after
+    // it were never seen so only found names are final
+    if (ec)
+        return false;
+
+    for (auto& [key, entry] : _names)
+        entry.searched = true;
+
+    return true;
+}
+
+bool FileIndex::SetCacheFile(const fs::path& InCacheFile)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _cacheFile = InCacheFile;
+    _loadedFromCache = Load(InCacheFile);
+
+    return _loadedFromCache;
+}
+
+bool FileIndex::Load(const fs::path& InCacheFile)
+{
+    std::ifstream file(InCacheFile, std::ios::binary);
+
+    if (!file.is_open())
+        return false;
+
+    std::string line;
+
+    if (!std::getline(file, line) || line != CacheHeader)
+        return false;
+
+    std::unordered_map<Key, Entry> names;
+    std::vector<Directory> directories;
+    bool rootMatches = false;
+    bool depthMatches = false;
+
+    while (std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string type;
+        std::getline(fields, type, '\t');
+
+        if (type == "root")
+        {
+            std::string root;
+            std::getline(fields, root);
+            rootMatches = FromUtf8(root) == _root;
+        }
+        else if (type == "depth")
+        {
+            int depth = 0;
+            fields >> depth;
+            depthMatches = depth == _maxDepth;
+        }
+        else if (type == "name")
+        {
+            std::string found, name, path;
+            std::getline(fields, found, '\t');
+            std::getline(fields, name, '\t');
+            std::getline(fields, path);
+
+            Entry entry { true, std::nullopt };
+
+            if (found == "1")
+                entry.path = FromUtf8(path);
+
+            names[FromUtf8(name).native()] = entry;
+        }
+        else if (type == "dir")
+        {
+            std::string time, path;
+            std::getline(fields, time, '\t');
+            std::getline(fields, path);
+
+            // Any added, removed or renamed entry changes the time of its folder
+            bool valid;
+            auto dirPath = FromUtf8(path);
+            auto lastWrite = (int64_t) std::strtoll(time.c_str(), nullptr, 10);
+
+            if (LastWrite(dirPath, valid) != lastWrite || !valid)
+                return false;
+
+            directories.push_back({ dirPath, lastWrite });
+        }
+    }
+
+    if (!rootMatches || !depthMatches || directories.empty())
+        return false;
+
+    // Names watched before loading are kept for the next walk
+    for (auto& [key, entry] : names)
+        _names[key] = entry;
+
+    _directories = std::move(directories);
+
+    return true;
+}
+
+bool FileIndex::Save(const fs::path& InCacheFile) const
+{
+    std::ofstream file(InCacheFile, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+        return false;
+
+    file << CacheHeader << '\n';
+    file << "root\t" << ToUtf8(_root) << '\n';
+    file << "depth\t" << _maxDepth << '\n';
+
+    for (const auto& [key, entry] : _names)
+    {
+        file << "name\t" << (entry.path.has_value() ? "1" : "0") << '\t' << ToUtf8(fs::path(key)) << '\t'
+             << (entry.path.has_value() ? ToUtf8(entry.path.value()) : "") << '\n';
+    }
+
+    for (const auto& directory : _directories)
+        file << "dir\t" << directory.lastWrite << '\t' << ToUtf8(directory.path) << '\n';
+
+    return file.good();
+}
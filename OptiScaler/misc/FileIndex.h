@@ -0,0 +1,76 @@
+#pragma once
+
+// File name index of a directory tree for Util::FindFilePath.
+// Tree is walked once for all watched names, later queries are answered from memory and only names
+// which were never looked up before cause another walk. Optionally persisted to a cache file which is
+// used as long as modification times of all walked directories are unchanged.
+// Nothing in here depends on Windows headers so it can be built anywhere.
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class FileIndex
+{
+  public:
+    // Depth of folders under root which are searched, deep enough for UE plugin binaries
+    static constexpr int DefaultMaxDepth = 12;
+
+    using Result = std::optional<std::filesystem::path>;
+
+    // Names are compared case insensitive (ASCII), first found file in walk order is returned
+    Result Find(const std::filesystem::path& InFileName);
+
+    // One walk at most for all names, results are in same order with names
+    std::vector<Result> Find(const std::vector<std::filesystem::path>& InFileNames);
+
+    // Adds names to next walk without walking, lets later single name queries share one walk
+    void Watch(const std::vector<std::filesystem::path>& InFileNames);
+
+    // Loads the cache if it's valid for this root, index is saved there after every walk
+    bool SetCacheFile(const std::filesystem::path& InCacheFile);
+
+    const std::filesystem::path& Root() const { return _root; }
+    uint32_t WalkCount() const { return _walkCount; }
+    bool LoadedFromCache() const { return _loadedFromCache; }
+
+    FileIndex(std::filesystem::path InRoot, int InMaxDepth = DefaultMaxDepth);
+
+  private:
+    using Key = std::filesystem::path::string_type;
+
+    struct Entry
+    {
+        bool searched = false;
+        Result path;
+    };
+
+    struct Directory
+    {
+        std::filesystem::path path;
+        int64_t lastWrite;
+    };
+
+    std::filesystem::path _root;
+    int _maxDepth;
+
+    std::mutex _mutex;
+    std::unordered_map<Key, Entry> _names;
+    std::vector<Directory> _directories;
+    std::optional<std::filesystem::path> _cacheFile;
+
+    uint32_t _walkCount = 0;
+    bool _loadedFromCache = false;
+
+    static Key Fold(const std::filesystem::path& InFileName);
+
+    // Finds every watched name which was not searched yet, names are only marked as searched when
+    // whole tree was walked. Returns false when the walk stopped on an error.
+    bool Walk();
+    bool Load(const std::filesystem::path& InCacheFile);
+    bool Save(const std::filesystem::path& InCacheFile) const;
+};
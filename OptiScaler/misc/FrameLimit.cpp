@@ -1,6 +1,7 @@
 #include "FrameLimit.h"
 
 #include "Config.h"
+#include "State.h"
 #include "hooks/HooksDx.h"
 
 inline uint64_t FrameLimit::get_timestamp()
@@ -65,9 +66,22 @@ void FrameLimit::sleep()
     if (auto fpsCap = Config::Instance()->FramerateLimit.value_or_default(); fpsCap != 0.0f)
     {
         uint64_t min_interval_us = std::clamp((uint64_t) (1'000'000 / fpsCap), 0ULL, 100'000'000ULL);
+
         static uint64_t previous_frame_time = 0;
         uint64_t current_time = get_timestamp();
         uint64_t frame_time = current_time - previous_frame_time;
+
+        // Evenly spaced real frames when game can't reach the cap
+        if (Config::Instance()->FGAdaptivePacing.value_or_default() && State::Instance().activeFgType == OptiFG &&
+            State::Instance().currentFG != nullptr && State::Instance().currentFG->IsActive())
+        {
+            // Frame time without the limiter's sleep
+            auto& pacing = State::Instance().fgPacing;
+            pacing.SampleWork(frame_time / 1'000'000.0);
+
+            auto interval = pacing.LimiterInterval(min_interval_us / 1000.0);
+            min_interval_us = std::clamp((uint64_t) (interval * 1000.0), min_interval_us, 100'000'000ULL);
+        }
         if (frame_time < 1000 * min_interval_us)
         {
             if (auto res = combined_sleep(min_interval_us * 1000 - frame_time); res)
@@ -0,0 +1,158 @@
+#include "LatencyTimeline.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Frame ids further than this ahead of the last one are treated as a restart
+static constexpr uint64_t MaxFrameIdJump = 1000;
+
+void LatencyTimeline::Record(uint64_t InFrameId, uint32_t InMarker, uint64_t InTimeUs)
+{
+    // Out of band markers can be sent by Streamline with ids of its own, they only count presents
+    if (InMarker == OutOfBandPresentStart)
+    {
+        _presentIds[_presentNext] = InFrameId;
+        _presentNext = (_presentNext + 1) % PresentHistorySize;
+        _presentCount = std::min(_presentCount + 1, PresentHistorySize);
+        return;
+    }
+
+    // Input, flash, ping and out of band render submit markers don't belong to the frame timeline
+    if (InMarker > PresentEnd)
+        return;
+
+    if (_hasFrameId && (InFrameId + MaxFrames < _lastFrameId || InFrameId > _lastFrameId + MaxFrameIdJump))
+    {
+        // Frames in flight and the interval are meaningless across a restart, history is kept
+        _frames = {};
+        _lastFrameId = InFrameId;
+        _lastSimulationStart = 0;
+        _restarts++;
+    }
+
+    if (!_hasFrameId || InFrameId > _lastFrameId)
+        _lastFrameId = InFrameId;
+
+    _hasFrameId = true;
+
+    auto& frame = FrameFor(InFrameId);
+    auto& time = frame.Times[InMarker];
+
+    // Keep first start and last end if a marker is repeated
+    bool isStart = InMarker == SimulationStart || InMarker == RenderSubmitStart || InMarker == PresentStart;
+
+    if (!isStart || time == 0)
+        time = InTimeUs;
+
+    if (InMarker == PresentEnd)
+        Complete(frame);
+}
+
+LatencyTimeline::Frame& LatencyTimeline::FrameFor(uint64_t InFrameId)
+{
+    auto& frame = _frames[InFrameId % MaxFrames];
+
+    // Older frame in the slot never reached present end, it's dropped
+    if (!frame.Used || frame.FrameId != InFrameId)
+    {
+        frame = {};
+        frame.FrameId = InFrameId;
+        frame.Used = true;
+    }
+
+    return frame;
+}
+
+void LatencyTimeline::Complete(Frame& InFrame)
+{
+    auto span = [&InFrame](Marker InStart, Marker InEnd) -> uint32_t
+    {
+        auto start = InFrame.Times[InStart];
+        auto end = InFrame.Times[InEnd];
+
+        if (start == 0 || end < start)
+            return 0;
+
+        return (uint32_t) std::min<uint64_t>(end - start, UINT32_MAX);
+    };
+
+    FrameStats stats;
+    stats.FrameId = InFrame.FrameId;
+    stats.Us[Simulation] = span(SimulationStart, SimulationEnd);
+    stats.Us[RenderSubmit] = span(RenderSubmitStart, RenderSubmitEnd);
+    stats.Us[Present] = span(PresentStart, PresentEnd);
+    stats.Us[Latency] = span(SimulationStart, PresentEnd);
+
+    auto simulationStart = InFrame.Times[SimulationStart];
+
+    if (simulationStart != 0)
+    {
+        if (_lastSimulationStart != 0 && simulationStart > _lastSimulationStart)
+            stats.Us[Interval] = (uint32_t) std::min<uint64_t>(simulationStart - _lastSimulationStart, UINT32_MAX);
+
+        _lastSimulationStart = simulationStart;
+    }
+
+    _history[_historyNext] = stats;
+    _historyNext = (_historyNext + 1) % HistorySize;
+    _historyCount = std::min(_historyCount + 1, HistorySize);
+    _completed++;
+
+    InFrame = {};
+}
+
+uint32_t LatencyTimeline::Percentile(Metric InMetric, float InPercentile, uint32_t InFrames) const
+{
+    if (InMetric >= MetricCount)
+        return 0;
+
+    std::array<uint32_t, HistorySize> values;
+    uint32_t count = 0;
+    auto frames = std::min(InFrames, _historyCount);
+
+    // Newest to oldest
+    for (uint32_t i = 1; i <= frames; i++)
+    {
+        if (auto value = _history[(_historyNext + HistorySize - i) % HistorySize].Us[InMetric]; value != 0)
+            values[count++] = value;
+    }
+
+    if (count == 0)
+        return 0;
+
+    // Nearest rank
+    auto rank = (uint32_t) std::ceil(std::clamp(InPercentile, 0.0f, 100.0f) / 100.0f * count);
+    auto index = rank == 0 ? 0 : rank - 1;
+
+    std::nth_element(values.begin(), values.begin() + index, values.begin() + count);
+    return values[index];
+}
+
+float LatencyTimeline::PresentsPerFrame() const
+{
+    if (_presentCount == 0)
+        return 0.0f;
+
+    // Oldest to newest, every change of id starts a new frame
+    uint32_t frames = 1;
+    auto first = (_presentNext + PresentHistorySize - _presentCount) % PresentHistorySize;
+
+    for (uint32_t i = 1; i < _presentCount; i++)
+    {
+        if (_presentIds[(first + i) % PresentHistorySize] != _presentIds[(first + i - 1) % PresentHistorySize])
+            frames++;
+    }
+
+    return (float) _presentCount / frames;
+}
+
+bool LatencyTimeline::Last(FrameStats& OutStats) const
+{
+    if (_historyCount == 0)
+        return false;
+
+    OutStats = _history[(_historyNext + HistorySize - 1) % HistorySize];
+    return true;
+}
+
+void LatencyTimeline::Reset() { *this = LatencyTimeline(); }
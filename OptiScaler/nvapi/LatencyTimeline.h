@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Per frame timeline of Reflex latency markers (SetLatencyMarker / SetAsyncFrameMarker).
+// Markers are collected by frame id, when the present of a frame ends its simulation, render submit and present
+// durations are stored to a history which percentiles are calculated from.
+// With DLSSG the out of band present markers of generated frames reuse the frame id of the real frame, those are
+// counted as extra presents of the same frame. Frame ids which go backwards or jump far ahead (FG toggled, level
+// loads) restart the timeline.
+// Nothing in here depends on NvAPI or Windows headers so it can be built anywhere.
+class LatencyTimeline
+{
+  public:
+    // Same values with NV_LATENCY_MARKER_TYPE and NV_VULKAN_LATENCY_MARKER_TYPE
+    enum Marker : uint32_t
+    {
+        SimulationStart = 0,
+        SimulationEnd = 1,
+        RenderSubmitStart = 2,
+        RenderSubmitEnd = 3,
+        PresentStart = 4,
+        PresentEnd = 5,
+        InputSample = 6,
+        TriggerFlash = 7,
+        PcLatencyPing = 8,
+        OutOfBandRenderSubmitStart = 9,
+        OutOfBandRenderSubmitEnd = 10,
+        OutOfBandPresentStart = 11,
+        OutOfBandPresentEnd = 12,
+    };
+
+    enum Metric : uint32_t
+    {
+        Simulation = 0, // Simulation start to end
+        RenderSubmit,   // Render submit start to end
+        Present,        // Present start to end, grows when the render queue is full
+        Latency,        // Simulation start to present end
+        Interval,       // Simulation start to simulation start of the previous completed frame
+        MetricCount,
+    };
+
+    struct FrameStats
+    {
+        uint64_t FrameId = 0;
+        std::array<uint32_t, MetricCount> Us {}; // 0 when markers of the metric were missing
+    };
+
+    static constexpr uint32_t MaxFrames = 16;   // Frames in flight which are tracked
+    static constexpr uint32_t HistorySize = 128; // Completed frames used for percentiles
+    static constexpr uint32_t PresentHistorySize = 64;
+
+    void Record(uint64_t InFrameId, uint32_t InMarker, uint64_t InTimeUs);
+
+    // Percentile (0-100) of a metric over the last completed frames, 0 when there is no history
+    uint32_t Percentile(Metric InMetric, float InPercentile, uint32_t InFrames = HistorySize) const;
+
+    // Out of band presents per frame id over recent presents, 2 or more with frame generation.
+    // 0 when the game doesn't send them.
+    float PresentsPerFrame() const;
+
+    bool Last(FrameStats& OutStats) const;
+    uint32_t HistoryCount() const { return _historyCount; }
+    uint64_t CompletedCount() const { return _completed; }
+    uint64_t RestartCount() const { return _restarts; }
+
+    void Reset();
+
+  private:
+    struct Frame
+    {
+        uint64_t FrameId = 0;
+        bool Used = false;
+        std::array<uint64_t, PresentEnd + 1> Times {}; // 0 when marker was not seen
+    };
+
+    std::array<Frame, MaxFrames> _frames {};
+    std::array<FrameStats, HistorySize> _history {};
+    uint32_t _historyCount = 0;
+    uint32_t _historyNext = 0;
+
+    std::array<uint64_t, PresentHistorySize> _presentIds {};
+    uint32_t _presentCount = 0;
+    uint32_t _presentNext = 0;
+
+    uint64_t _lastFrameId = 0;
+    bool _hasFrameId = false;
+    uint64_t _lastSimulationStart = 0;
+    uint64_t _completed = 0;
+    uint64_t _restarts = 0;
+
+    Frame& FrameFor(uint64_t InFrameId);
+    void Complete(Frame& InFrame);
+};
@@ -1,5 +1,6 @@
 #include "ReflexHooks.h"
 #include <Config.h>
+#include <Util.h>
 
 #include "fakenvapi.h"
 
@@ -45,6 +46,7 @@ NvAPI_Status ReflexHooks::hkNvAPI_D3D_SetLatencyMarker(IUnknown* pDev,
     LOG_FUNC();
 #endif
     _updatesWithoutMarker = 0;
+    recordMarker(pSetLatencyMarkerParams->frameID, pSetLatencyMarkerParams->markerType);
 
     // Some games just stop sending any async markers when DLSSG is disabled, so a reset is needed
     if (_lastAsyncMarkerFrameId + 10 < pSetLatencyMarkerParams->frameID)
@@ -61,6 +63,7 @@ NvAPI_Status ReflexHooks::hkNvAPI_D3D12_SetAsyncFrameMarker(ID3D12CommandQueue*
 #endif
 
     _lastAsyncMarkerFrameId = pSetAsyncFrameMarkerParams->frameID;
+    recordMarker(pSetAsyncFrameMarkerParams->frameID, pSetAsyncFrameMarkerParams->markerType);
 
     if (pSetAsyncFrameMarkerParams->markerType == OUT_OF_BAND_PRESENT_START)
     {
@@ -105,6 +108,7 @@ NvAPI_Status ReflexHooks::hkNvAPI_Vulkan_SetLatencyMarker(HANDLE vkDevice,
 #endif
 
     _updatesWithoutMarker = 0;
+    recordMarker(pSetLatencyMarkerParams->frameID, pSetLatencyMarkerParams->markerType);
 
     return o_NvAPI_Vulkan_SetLatencyMarker(vkDevice, pSetLatencyMarkerParams);
 }
@@ -125,6 +129,14 @@ NvAPI_Status ReflexHooks::hkNvAPI_Vulkan_SetSleepMode(HANDLE vkDevice,
     return o_NvAPI_Vulkan_SetSleepMode(vkDevice, pSetSleepModeParams);
 }
 
+void ReflexHooks::recordMarker(uint64_t frameId, uint32_t markerType)
+{
+    auto now = (uint64_t) (Util::MillisecondsNow() * 1000.0);
+
+    std::lock_guard<std::mutex> lock(_timelineMutex);
+    _timeline.Record(frameId, markerType, now);
+}
+
 void ReflexHooks::hookReflex(PFN_NvApi_QueryInterface& queryInterface)
 {
 #ifdef _DEBUG
@@ -256,6 +268,26 @@ void ReflexHooks::update(bool optiFg_FgState, bool isVulkan)
         setFPSLimit(currentFps);
         lastFps = currentFps;
     }
+
+    // Stretch the interval while the target can't be reached and frames queue up
+    auto interval = _targetIntervalUs;
+
+    if (Config::Instance()->FramerateLimitAdaptive.value_or_default() && _targetIntervalUs != 0)
+    {
+        std::lock_guard<std::mutex> lock(_timelineMutex);
+
+        if (_intervalController.Target() != _targetIntervalUs)
+            _intervalController.SetTarget(_targetIntervalUs);
+
+        interval = _intervalController.Update(_timeline);
+    }
+
+    if (interval != _minimumIntervalUs)
+    {
+        LOG_DEBUG("Adaptive limit interval: {} us, target: {} us", interval, _targetIntervalUs);
+        _minimumIntervalUs = interval;
+        applyMinimumInterval();
+    }
 }
 
 // 0 - disables the fps cap
@@ -263,10 +295,22 @@ void ReflexHooks::setFPSLimit(float fps)
 {
     LOG_INFO("Set FPS Limit to: {}", fps);
     if (fps == 0.0)
-        _minimumIntervalUs = 0;
+        _targetIntervalUs = 0;
     else
-        _minimumIntervalUs = static_cast<uint32_t>(std::round(1'000'000 / fps));
+        _targetIntervalUs = static_cast<uint32_t>(std::round(1'000'000 / fps));
+
+    // Adaptive limit starts from the new target
+    {
+        std::lock_guard<std::mutex> lock(_timelineMutex);
+        _intervalController.SetTarget(_targetIntervalUs);
+    }
 
+    _minimumIntervalUs = _targetIntervalUs;
+    applyMinimumInterval();
+}
+
+void ReflexHooks::applyMinimumInterval()
+{
     if (_lastSleepDev != nullptr)
     {
         NV_SET_SLEEP_MODE_PARAMS temp {};
@@ -283,3 +327,9 @@ void ReflexHooks::setFPSLimit(float fps)
         o_NvAPI_Vulkan_SetSleepMode(_lastVkSleepDev, &temp);
     }
 }
+
+LatencyTimeline ReflexHooks::latencyTimeline()
+{
+    std::lock_guard<std::mutex> lock(_timelineMutex);
+    return _timeline;
+}
@@ -2,17 +2,27 @@
 
 #include <d3d12.h>
 #include "NvApiTypes.h"
+#include "LatencyTimeline.h"
+#include "SleepIntervalController.h"
+
+#include <mutex>
 
 class ReflexHooks
 {
     inline static bool _inited = false;
-    inline static uint32_t _minimumIntervalUs = 0;
+    inline static uint32_t _minimumIntervalUs = 0; // Injected, differs from target when adaptive limit is active
+    inline static uint32_t _targetIntervalUs = 0;
     inline static NV_SET_SLEEP_MODE_PARAMS _lastSleepParams {};
     inline static IUnknown* _lastSleepDev = nullptr;
     inline static bool _dlssgDetected = false;
     inline static uint64_t _lastAsyncMarkerFrameId = 0;
     inline static uint64_t _updatesWithoutMarker = 0;
 
+    // Markers come from game threads, update from present
+    inline static std::mutex _timelineMutex;
+    inline static LatencyTimeline _timeline;
+    inline static SleepIntervalController _intervalController;
+
     inline static NV_VULKAN_SET_SLEEP_MODE_PARAMS _lastVkSleepParams {};
     inline static HANDLE _lastVkSleepDev = nullptr;
 
@@ -39,6 +49,11 @@ class ReflexHooks
     static NvAPI_Status hkNvAPI_Vulkan_SetSleepMode(HANDLE vkDevice,
                                                     NV_VULKAN_SET_SLEEP_MODE_PARAMS* pSetSleepModeParams);
 
+    static void recordMarker(uint64_t frameId, uint32_t markerType);
+
+    // Sends _minimumIntervalUs with last sleep params
+    static void applyMinimumInterval();
+
   public:
     static void hookReflex(PFN_NvApi_QueryInterface& queryInterface);
     static bool isDlssgDetected();
@@ -51,4 +66,9 @@ class ReflexHooks
 
     // 0 - disables the fps cap
     inline static void setFPSLimit(float fps);
+
+    // Copy of the latency marker timeline for display
+    static LatencyTimeline latencyTimeline();
+    static uint32_t targetIntervalUs() { return _targetIntervalUs; }
+    static uint32_t injectedIntervalUs() { return _minimumIntervalUs; }
 };
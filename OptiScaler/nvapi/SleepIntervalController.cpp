@@ -0,0 +1,123 @@
+#include "SleepIntervalController.h"
+
+#include <algorithm>
+
+// Frame time over the target which still counts as reaching it
+static constexpr float TargetTolerance = 1.05f;
+
+// Raised interval is this much over the achieved frame time so the GPU never waits for the CPU
+static constexpr float RaiseMargin = 1.03f;
+
+// Step used when going back towards the target
+static constexpr float LowerStep = 0.99f;
+
+// Present waits shorter than this are not counted as queued frames
+static constexpr uint32_t MinQueuedPresentUs = 1000;
+
+// Evaluations after a raise before the queue should be drained
+static constexpr uint32_t DrainEvaluations = 2;
+
+// Floor is this much over the frame time measured while queued
+static constexpr float FloorMargin = 1.01f;
+
+// Probe goes this much under the floor and is held this long, deep enough that a queue fills while it's held
+// when the GPU frame time didn't change
+static constexpr float ProbeStep = 0.97f;
+static constexpr uint32_t ProbeEvaluations = 6;
+
+void SleepIntervalController::SetTarget(uint32_t InTargetUs)
+{
+    _targetUs = InTargetUs;
+    _intervalUs = InTargetUs;
+    _queued = false;
+    _floorUs = 0;
+    _hold = 0;
+    _backoff = 0;
+}
+
+uint32_t SleepIntervalController::Update(const LatencyTimeline& InTimeline)
+{
+    if (_targetUs == 0)
+        return 0;
+
+    auto completed = InTimeline.CompletedCount();
+
+    if (completed < _lastEvaluated + EvaluateFrames)
+        return _intervalUs;
+
+    _lastEvaluated = completed;
+
+    // Only frames since last change, older ones were paced by another interval
+    auto frameUs = InTimeline.Percentile(LatencyTimeline::Interval, 50, EvaluateFrames);
+    auto presentUs = InTimeline.Percentile(LatencyTimeline::Present, 50, EvaluateFrames);
+    auto latencyUs = InTimeline.Percentile(LatencyTimeline::Latency, 50, EvaluateFrames);
+
+    // Not enough markers to decide, stay at target
+    if (frameUs == 0 || latencyUs == 0)
+    {
+        _intervalUs = _targetUs;
+        _queued = false;
+        return _intervalUs;
+    }
+
+    _queued = presentUs > std::max(MinQueuedPresentUs, frameUs / 10) || latencyUs > frameUs + frameUs / 2;
+    bool belowTarget = frameUs > _targetUs * TargetTolerance;
+
+    if (_queued && _intervalUs < _floorUs)
+    {
+        // Failed probe, GPU frame time didn't change
+        _intervalUs = _floorUs;
+        _backoff = std::min(std::max(1u, _backoff * 2), MaxHoldEvaluations);
+        _hold = std::max(_backoff, DrainEvaluations);
+    }
+    else if (_queued && belowTarget)
+    {
+        // Frames paced by a raised interval drain the queue by themselves, raise again only when the GPU got slower
+        // or the queue doesn't drain
+        if (frameUs > _intervalUs + _intervalUs / 100 || _hold == 0)
+        {
+            auto raised = (uint32_t) (std::max(frameUs, _intervalUs) * RaiseMargin);
+            _intervalUs = std::clamp(raised, _targetUs, std::max(MaxIntervalUs, _targetUs));
+            _floorUs = std::clamp((uint32_t) (frameUs * FloorMargin), _targetUs, _intervalUs);
+            _hold = DrainEvaluations;
+            _backoff = 0;
+        }
+        else
+        {
+            _hold--;
+        }
+    }
+    else if (_intervalUs > _targetUs)
+    {
+        auto lowered = std::max(_targetUs, (uint32_t) (_intervalUs * LowerStep));
+
+        if (_hold > 0)
+        {
+            _hold--;
+        }
+        else if (_intervalUs > _floorUs)
+        {
+            _intervalUs = std::max(_floorUs, lowered);
+        }
+        else if (_intervalUs < _floorUs)
+        {
+            // Probe held without queueing, GPU got faster. Floor is unknown until frames queue again.
+            _floorUs = 0;
+            _intervalUs = lowered;
+        }
+        else
+        {
+            _intervalUs = std::max(_targetUs, (uint32_t) (_intervalUs * ProbeStep));
+            _hold = ProbeEvaluations;
+        }
+    }
+
+    // Back at target, next raise starts over
+    if (_intervalUs == _targetUs)
+    {
+        _floorUs = 0;
+        _backoff = 0;
+    }
+
+    return _intervalUs;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "LatencyTimeline.h"
+
+#include <cstdint>
+
+// Picks the minimum interval injected into Reflex sleep mode from the latency marker timeline.
+// While the target frame rate is reached the target interval is used as is. When the game can't reach it and frames
+// queue up (present blocks, latency grows over the frame time) the interval is raised just above the achieved frame
+// time so the CPU waits instead of the queue, then lowered back in small steps to find the headroom again.
+// Steps down stop at a floor just over the frame time measured while queued. Going under it is a probe which is held
+// until a queue would show up, a failed probe goes back to the floor and doubles the wait before the next one, so a
+// steady GPU bound load settles instead of cycling between raises and steps down.
+// Nothing in here depends on NvAPI or Windows headers so it can be built anywhere.
+class SleepIntervalController
+{
+  public:
+    // New completed frames needed before the interval is changed again
+    static constexpr uint32_t EvaluateFrames = 30;
+
+    // Upper limit of raised interval (10 fps)
+    static constexpr uint32_t MaxIntervalUs = 100'000;
+
+    // Longest wait at the floor after failed probes, in evaluations
+    static constexpr uint32_t MaxHoldEvaluations = 32;
+
+    // 0 disables the controller, Update returns 0 then
+    void SetTarget(uint32_t InTargetUs);
+    uint32_t Target() const { return _targetUs; }
+
+    // Returns the interval which should be injected
+    uint32_t Update(const LatencyTimeline& InTimeline);
+
+    uint32_t Interval() const { return _intervalUs; }
+    bool Queued() const { return _queued; }
+
+    // Lowest interval used without probing, 0 when unknown
+    uint32_t Floor() const { return _floorUs; }
+
+  private:
+    uint32_t _targetUs = 0;
+    uint32_t _intervalUs = 0;
+    uint64_t _lastEvaluated = 0;
+    bool _queued = false;
+
+    uint32_t _floorUs = 0;
+    uint32_t _hold = 0;    // Evaluations left before next step down
+    uint32_t _backoff = 0; // Hold after the last failed probe
+};
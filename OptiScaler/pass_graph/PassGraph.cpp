@@ -0,0 +1,372 @@
+#include "PassGraph.h"
+
+size_t PassGraph::Plan::BarrierCount() const
+{
+    size_t count = FinalBarriers.size();
+
+    for (const auto& step : Steps)
+        count += step.Barriers.size();
+
+    return count;
+}
+
+PassGraph::ResourceId PassGraph::Import(const char* InName, uint32_t InInitialState, uint32_t InFinalState)
+{
+    if (_resourceCount == _resources.size())
+        _resources.emplace_back();
+
+    auto& resource = _resources[_resourceCount];
+    resource = {};
+    resource.Name = InName;
+    resource.InitialState = InInitialState;
+    resource.FinalState = InFinalState;
+
+    return (ResourceId) _resourceCount++;
+}
+
+PassGraph::ResourceId PassGraph::CreateTransient(const char* InName, const TransientDesc& InDesc)
+{
+    if (_resourceCount == _resources.size())
+        _resources.emplace_back();
+
+    auto& resource = _resources[_resourceCount];
+    resource = {};
+    resource.Name = InName;
+    resource.Transient = true;
+    resource.InitialState = _traits.Initial;
+    resource.Desc = InDesc;
+
+    return (ResourceId) _resourceCount++;
+}
+
+PassGraph::PassId PassGraph::AddPass(const char* InName, bool InNeverCull)
+{
+    if (_passCount == _passes.size())
+        _passes.emplace_back();
+
+    // Accesses are cleared, not reassigned, to keep their capacity
+    auto& pass = _passes[_passCount];
+    pass.Name = InName;
+    pass.NeverCull = InNeverCull;
+    pass.Accesses.clear();
+
+    return (PassId) _passCount++;
+}
+
+bool PassGraph::Read(PassId InPass, ResourceId InResource, uint32_t InState)
+{
+    if (InPass >= _passCount || InResource >= _resourceCount)
+        return false;
+
+    _passes[InPass].Accesses.push_back({ InResource, InState, true, false });
+    return true;
+}
+
+bool PassGraph::Write(PassId InPass, ResourceId InResource, uint32_t InState)
+{
+    if (InPass >= _passCount || InResource >= _resourceCount)
+        return false;
+
+    _passes[InPass].Accesses.push_back({ InResource, InState, false, true });
+    return true;
+}
+
+void PassGraph::Reset()
+{
+    _resourceCount = 0;
+    _passCount = 0;
+}
+
+bool PassGraph::MergeAccesses(const Pass& InPass, std::vector<Access>& OutAccesses) const
+{
+    OutAccesses.clear();
+
+    for (const auto& access : InPass.Accesses)
+    {
+        Access* merged = nullptr;
+
+        for (auto& existing : OutAccesses)
+        {
+            if (existing.Resource == access.Resource)
+            {
+                merged = &existing;
+                break;
+            }
+        }
+
+        if (merged == nullptr)
+        {
+            OutAccesses.push_back(access);
+            continue;
+        }
+
+        if (merged->State == access.State)
+        {
+            merged->Read |= access.Read;
+            merged->Write |= access.Write;
+            continue;
+        }
+
+        // Different states are only allowed for read only access
+        if (merged->Write || access.Write || !IsReadState(merged->State) || !IsReadState(access.State))
+            return false;
+
+        merged->State |= access.State;
+    }
+
+    return true;
+}
+
+bool PassGraph::Compile(Plan& OutPlan) const
+{
+    // Steps are resized below, their barrier vectors keep the capacity of previous compiles
+    for (auto& step : OutPlan.Steps)
+        step.Barriers.clear();
+
+    OutPlan.FinalBarriers.clear();
+    OutPlan.CulledPasses.clear();
+    OutPlan.PhysicalDescs.clear();
+
+    const auto passCount = _passCount;
+    const auto resourceCount = _resourceCount;
+
+    auto& accesses = _scratch.Accesses;
+
+    if (accesses.size() < passCount)
+        accesses.resize(passCount);
+
+    for (size_t i = 0; i < passCount; i++)
+    {
+        if (!MergeAccesses(_passes[i], accesses[i]))
+        {
+            OutPlan.Steps.clear();
+            return false;
+        }
+    }
+
+    // Culling, walk backwards and keep passes which write imported or needed resources
+    auto& live = _scratch.Live;
+    auto& needed = _scratch.Needed;
+    live.assign(passCount, false);
+    needed.assign(resourceCount, false);
+
+    for (size_t i = passCount; i-- > 0;)
+    {
+        bool isLive = _passes[i].NeverCull;
+
+        for (const auto& access : accesses[i])
+        {
+            if (access.Write && (!_resources[access.Resource].Transient || needed[access.Resource]))
+                isLive = true;
+        }
+
+        if (!isLive)
+            continue;
+
+        live[i] = true;
+
+        for (const auto& access : accesses[i])
+        {
+            if (access.Read)
+                needed[access.Resource] = true;
+        }
+    }
+
+    auto& livePasses = _scratch.LivePasses;
+    livePasses.clear();
+
+    for (size_t i = 0; i < passCount; i++)
+    {
+        if (live[i])
+            livePasses.push_back((PassId) i);
+        else
+            OutPlan.CulledPasses.push_back((PassId) i);
+    }
+
+    // Lifetimes in steps, transient must be written before read
+    auto& firstUse = _scratch.FirstUse;
+    auto& lastUse = _scratch.LastUse;
+    firstUse.assign(resourceCount, Invalid);
+    lastUse.assign(resourceCount, Invalid);
+
+    for (uint32_t step = 0; step < livePasses.size(); step++)
+    {
+        for (const auto& access : accesses[livePasses[step]])
+        {
+            auto id = access.Resource;
+
+            if (firstUse[id] == Invalid)
+            {
+                if (_resources[id].Transient && access.Read)
+                {
+                    OutPlan.Steps.clear();
+                    return false;
+                }
+
+                firstUse[id] = step;
+            }
+
+            lastUse[id] = step;
+        }
+    }
+
+    // Assign transients to physical slots, a slot is reused when its previous user is done
+    OutPlan.PhysicalSlot.assign(resourceCount, Invalid);
+    auto& slotLastUse = _scratch.SlotLastUse;
+    auto& slotState = _scratch.SlotState;
+    auto& slotLastResource = _scratch.SlotLastResource;
+    slotLastUse.clear();
+    slotState.clear();
+    slotLastResource.clear();
+
+    for (uint32_t step = 0; step < livePasses.size(); step++)
+    {
+        for (const auto& access : accesses[livePasses[step]])
+        {
+            auto id = access.Resource;
+
+            if (!_resources[id].Transient || firstUse[id] != step || OutPlan.PhysicalSlot[id] != Invalid)
+                continue;
+
+            uint32_t slot = Invalid;
+
+            for (uint32_t i = 0; i < OutPlan.PhysicalDescs.size(); i++)
+            {
+                if (slotLastUse[i] < step && OutPlan.PhysicalDescs[i] == _resources[id].Desc)
+                {
+                    slot = i;
+                    break;
+                }
+            }
+
+            if (slot == Invalid)
+            {
+                slot = (uint32_t) OutPlan.PhysicalDescs.size();
+                OutPlan.PhysicalDescs.push_back(_resources[id].Desc);
+                slotLastUse.push_back(0);
+                slotState.push_back(_traits.Initial);
+                slotLastResource.push_back(id);
+            }
+
+            OutPlan.PhysicalSlot[id] = slot;
+            slotLastUse[slot] = lastUse[id];
+        }
+    }
+
+    // Barrier planning
+    auto& current = _scratch.Current;
+    auto& lastStep = _scratch.LastStep;
+    auto& lastWrite = _scratch.LastWrite;
+    current.resize(resourceCount);
+    lastStep.assign(resourceCount, Invalid);
+    lastWrite.assign(resourceCount, false);
+
+    for (size_t i = 0; i < resourceCount; i++)
+        current[i] = _resources[i].InitialState;
+
+    OutPlan.Steps.resize(livePasses.size());
+
+    for (uint32_t step = 0; step < livePasses.size(); step++)
+    {
+        auto& planStep = OutPlan.Steps[step];
+        planStep.Pass = livePasses[step];
+
+        for (const auto& access : accesses[planStep.Pass])
+        {
+            auto id = access.Resource;
+            auto slot = OutPlan.PhysicalSlot[id];
+
+            // Transient continues from the state previous user of slot left
+            if (slot != Invalid && firstUse[id] == step)
+            {
+                current[id] = slotState[slot];
+                slotLastResource[slot] = id;
+            }
+
+            uint32_t target = access.State;
+
+            if (!access.Write && IsReadState(target))
+            {
+                if (IsReadState(current[id]) && (current[id] & target) == target)
+                {
+                    target = current[id];
+                }
+                else
+                {
+                    // Combine following reads until next write, so they don't need their own barriers
+                    for (uint32_t next = step + 1; next < livePasses.size(); next++)
+                    {
+                        bool written = false;
+
+                        for (const auto& nextAccess : accesses[livePasses[next]])
+                        {
+                            if (nextAccess.Resource != id)
+                                continue;
+
+                            if (nextAccess.Write || !IsReadState(nextAccess.State))
+                                written = true;
+                            else
+                                target |= nextAccess.State;
+                        }
+
+                        if (written)
+                            break;
+                    }
+                }
+            }
+
+            if (current[id] != target)
+            {
+                Barrier barrier { id, BarrierType::Transition, BarrierFlags::None, current[id], target };
+
+                // Split barrier when there are passes between previous (or graph start for imported) and this use
+                uint32_t beginStep = lastStep[id] != Invalid ? lastStep[id] + 1 : (slot == Invalid ? 0 : step);
+
+                if (beginStep < step)
+                {
+                    barrier.Flags = BarrierFlags::BeginOnly;
+                    OutPlan.Steps[beginStep].Barriers.push_back(barrier);
+                    barrier.Flags = BarrierFlags::EndOnly;
+                }
+
+                planStep.Barriers.push_back(barrier);
+            }
+            else if (_traits.UnorderedAccess != 0 && target == _traits.UnorderedAccess && lastStep[id] != Invalid &&
+                     (access.Write || lastWrite[id]))
+            {
+                planStep.Barriers.push_back({ id, BarrierType::UnorderedAccess, BarrierFlags::None, target, target });
+            }
+
+            current[id] = target;
+            lastStep[id] = step;
+            lastWrite[id] = access.Write;
+
+            if (slot != Invalid)
+                slotState[slot] = target;
+        }
+    }
+
+    // Imported resources to their final states
+    for (ResourceId id = 0; id < resourceCount; id++)
+    {
+        const auto& resource = _resources[id];
+
+        if (resource.Transient || resource.FinalState == Invalid || current[id] == resource.FinalState)
+            continue;
+
+        OutPlan.FinalBarriers.push_back(
+            { id, BarrierType::Transition, BarrierFlags::None, current[id], resource.FinalState });
+    }
+
+    // Physical resources are kept between frames, return them to initial state
+    for (uint32_t slot = 0; slot < slotState.size(); slot++)
+    {
+        if (slotState[slot] == _traits.Initial)
+            continue;
+
+        OutPlan.FinalBarriers.push_back({ slotLastResource[slot], BarrierType::Transition, BarrierFlags::None,
+                                          slotState[slot], _traits.Initial });
+    }
+
+    return true;
+}
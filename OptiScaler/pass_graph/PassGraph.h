@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// API independent pass graph compiler.
+// Passes are added in execution order and declare which resources they read and write in which state.
+// Compile culls passes which don't contribute to imported resources, plans batched (and split where possible)
+// barriers and assigns transient resources to reusable physical slots.
+// States are opaque bitmasks (D3D12_RESOURCE_STATES for PassGraph_Dx12), API specifics come from StateTraits.
+// Graph is declared every frame, Reset and Compile keep their storage so a graph of the same shape doesn't allocate
+// again. Names are not copied, they must outlive the graph (string literals).
+class PassGraph
+{
+  public:
+    using ResourceId = uint32_t;
+    using PassId = uint32_t;
+
+    static constexpr uint32_t Invalid = UINT32_MAX;
+
+    struct StateTraits
+    {
+        uint32_t ReadMask = 0;        // States which can be combined for read only access
+        uint32_t UnorderedAccess = 0; // Needs UAV barrier between consecutive accesses with a write
+        uint32_t Initial = 0;         // State of newly created transient resources
+    };
+
+    struct TransientDesc
+    {
+        uint64_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t Format = 0;
+        uint32_t Flags = 0;
+
+        bool operator==(const TransientDesc& other) const
+        {
+            return Width == other.Width && Height == other.Height && Format == other.Format && Flags == other.Flags;
+        }
+    };
+
+    enum class BarrierType
+    {
+        Transition,
+        UnorderedAccess,
+    };
+
+    enum class BarrierFlags
+    {
+        None,
+        BeginOnly,
+        EndOnly,
+    };
+
+    struct Barrier
+    {
+        ResourceId Resource = Invalid;
+        BarrierType Type = BarrierType::Transition;
+        BarrierFlags Flags = BarrierFlags::None;
+        uint32_t StateBefore = 0;
+        uint32_t StateAfter = 0;
+    };
+
+    struct Step
+    {
+        PassId Pass = Invalid;
+        std::vector<Barrier> Barriers; // Recorded as one batch before the pass
+    };
+
+    struct Plan
+    {
+        std::vector<Step> Steps;
+        std::vector<Barrier> FinalBarriers; // Imported resources to final state, physical slots to initial state
+        std::vector<PassId> CulledPasses;
+
+        // Indexed by ResourceId, Invalid for imported and culled resources
+        std::vector<uint32_t> PhysicalSlot;
+        std::vector<TransientDesc> PhysicalDescs;
+
+        size_t BarrierCount() const;
+    };
+
+    PassGraph() = default;
+    explicit PassGraph(StateTraits InTraits) : _traits(InTraits) {}
+
+    // InFinalState = Invalid keeps the state after the last pass
+    ResourceId Import(const char* InName, uint32_t InInitialState, uint32_t InFinalState = Invalid);
+    ResourceId CreateTransient(const char* InName, const TransientDesc& InDesc);
+
+    // InNeverCull for passes with side effects outside of the graph
+    PassId AddPass(const char* InName, bool InNeverCull = false);
+    bool Read(PassId InPass, ResourceId InResource, uint32_t InState);
+    bool Write(PassId InPass, ResourceId InResource, uint32_t InState);
+
+    // Returns false when graph is invalid (transient read before written or conflicting states in a pass).
+    // OutPlan is reused, pass the same plan every frame to keep its storage
+    bool Compile(Plan& OutPlan) const;
+
+    void Reset();
+
+    size_t PassCount() const { return _passCount; }
+    size_t ResourceCount() const { return _resourceCount; }
+    const char* PassName(PassId InPass) const { return _passes[InPass].Name; }
+    const char* ResourceName(ResourceId InResource) const { return _resources[InResource].Name; }
+    bool IsTransient(ResourceId InResource) const { return _resources[InResource].Transient; }
+
+  private:
+    struct Resource
+    {
+        const char* Name = "";
+        bool Transient = false;
+        uint32_t InitialState = 0;
+        uint32_t FinalState = Invalid;
+        TransientDesc Desc;
+    };
+
+    struct Access
+    {
+        ResourceId Resource = Invalid;
+        uint32_t State = 0;
+        bool Read = false;
+        bool Write = false;
+    };
+
+    struct Pass
+    {
+        const char* Name = "";
+        bool NeverCull = false;
+        std::vector<Access> Accesses;
+    };
+
+    // Compile temporaries, kept between compiles
+    struct Scratch
+    {
+        std::vector<std::vector<Access>> Accesses;
+        std::vector<bool> Live;
+        std::vector<bool> Needed;
+        std::vector<PassId> LivePasses;
+        std::vector<uint32_t> FirstUse;
+        std::vector<uint32_t> LastUse;
+        std::vector<uint32_t> SlotLastUse;
+        std::vector<uint32_t> SlotState;
+        std::vector<ResourceId> SlotLastResource;
+        std::vector<uint32_t> Current;
+        std::vector<uint32_t> LastStep;
+        std::vector<bool> LastWrite;
+    };
+
+    StateTraits _traits;
+
+    // Elements after the counts are left from previous frames and reused by next declarations
+    std::vector<Resource> _resources;
+    std::vector<Pass> _passes;
+    size_t _resourceCount = 0;
+    size_t _passCount = 0;
+
+    mutable Scratch _scratch;
+
+    bool IsReadState(uint32_t InState) const
+    {
+        return InState != 0 && (InState & ~_traits.ReadMask) == 0;
+    }
+
+    // One access per resource, reads of a pass are combined
+    bool MergeAccesses(const Pass& InPass, std::vector<Access>& OutAccesses) const;
+};
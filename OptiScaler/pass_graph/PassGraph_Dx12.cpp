@@ -0,0 +1,128 @@
+#include "PassGraph_Dx12.h"
+
+#include <State.h>
+
+static constexpr uint32_t ReadStates =
+    D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_INDEX_BUFFER |
+    D3D12_RESOURCE_STATE_DEPTH_READ | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE |
+    D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT |
+    D3D12_RESOURCE_STATE_COPY_SOURCE | D3D12_RESOURCE_STATE_RESOLVE_SOURCE;
+
+PassGraph_Dx12::PassGraph_Dx12(std::string InName)
+    : _name(InName), _graph({ ReadStates, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON })
+{
+}
+
+PassGraph_Dx12::ResourceId PassGraph_Dx12::Import(const char* InName, ID3D12Resource* InResource,
+                                                  D3D12_RESOURCE_STATES InInitialState,
+                                                  D3D12_RESOURCE_STATES InFinalState)
+{
+    auto id = _graph.Import(InName, InInitialState, InFinalState);
+
+    _imported.resize(_graph.ResourceCount(), nullptr);
+    _imported[id] = InResource;
+
+    return id;
+}
+
+PassGraph_Dx12::PassId PassGraph_Dx12::AddPass(const char* InName, PassFunc InFunc, bool InNeverCull)
+{
+    auto id = _graph.AddPass(InName, InNeverCull);
+
+    _passFuncs.resize(_graph.PassCount());
+    _passFuncs[id] = InFunc;
+
+    return id;
+}
+
+bool PassGraph_Dx12::Read(PassId InPass, ResourceId InResource, D3D12_RESOURCE_STATES InState)
+{
+    return _graph.Read(InPass, InResource, InState);
+}
+
+bool PassGraph_Dx12::Write(PassId InPass, ResourceId InResource, D3D12_RESOURCE_STATES InState)
+{
+    return _graph.Write(InPass, InResource, InState);
+}
+
+ID3D12Resource* PassGraph_Dx12::ResolveResource(ResourceId InResource) const
+{
+    if (InResource >= _imported.size())
+        return nullptr;
+
+    return _imported[InResource];
+}
+
+void PassGraph_Dx12::RecordBarriers(ID3D12GraphicsCommandList* InCmdList,
+                                    const std::vector<PassGraph::Barrier>& InBarriers)
+{
+    if (InBarriers.empty())
+        return;
+
+    _barriers.clear();
+
+    for (const auto& barrier : InBarriers)
+    {
+        D3D12_RESOURCE_BARRIER d3dBarrier = {};
+
+        if (barrier.Type == PassGraph::BarrierType::UnorderedAccess)
+        {
+            d3dBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+            d3dBarrier.UAV.pResource = ResolveResource(barrier.Resource);
+        }
+        else
+        {
+            d3dBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            d3dBarrier.Transition.pResource = ResolveResource(barrier.Resource);
+            d3dBarrier.Transition.StateBefore = (D3D12_RESOURCE_STATES) barrier.StateBefore;
+            d3dBarrier.Transition.StateAfter = (D3D12_RESOURCE_STATES) barrier.StateAfter;
+            d3dBarrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+
+            if (barrier.Flags == PassGraph::BarrierFlags::BeginOnly)
+                d3dBarrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+            else if (barrier.Flags == PassGraph::BarrierFlags::EndOnly)
+                d3dBarrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+        }
+
+        _barriers.push_back(d3dBarrier);
+    }
+
+    InCmdList->ResourceBarrier((UINT) _barriers.size(), _barriers.data());
+}
+
+bool PassGraph_Dx12::Execute(ID3D12GraphicsCommandList* InCmdList)
+{
+    bool result = InCmdList != nullptr && _graph.Compile(_plan);
+
+    if (!result)
+    {
+        LOG_ERROR("[{0}] Graph compile failed!", _name);
+    }
+    else
+    {
+        for (const auto& culled : _plan.CulledPasses)
+            LOG_TRACE("[{0}] Culled pass: {1}", _name, _graph.PassName(culled));
+
+        for (const auto& step : _plan.Steps)
+        {
+            RecordBarriers(InCmdList, step.Barriers);
+
+            if (!result)
+                continue;
+
+            if (_passFuncs[step.Pass] && !_passFuncs[step.Pass](InCmdList))
+            {
+                LOG_WARN("[{0}] Pass failed: {1}", _name, _graph.PassName(step.Pass));
+                result = false;
+            }
+        }
+
+        RecordBarriers(InCmdList, _plan.FinalBarriers);
+    }
+
+    _graph.Reset();
+    _imported.clear();
+    _passFuncs.clear();
+
+    return result;
+}
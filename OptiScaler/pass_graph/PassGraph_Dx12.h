@@ -0,0 +1,82 @@
+#pragma once
+
+#include <pch.h>
+
+#include "PassGraph.h"
+
+#include <d3d12.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+// Records a PassGraph on a D3D12 command list.
+// Graph is declared every frame on the same object, pass & barrier storage is reused between frames.
+// Only imported resources are supported, transient resources of PassGraph are not recorded.
+class PassGraph_Dx12
+{
+  public:
+    using ResourceId = PassGraph::ResourceId;
+    using PassId = PassGraph::PassId;
+
+    // Pass callback stored inline, std::function would allocate for most captures every frame.
+    // Captures must be trivially copyable (pointers, references, plain structs) and fit into Capacity.
+    class PassFunc
+    {
+      public:
+        static constexpr size_t Capacity = 128;
+
+        PassFunc() = default;
+
+        template <typename Func> PassFunc(Func InFunc)
+        {
+            static_assert(sizeof(Func) <= Capacity, "Pass captures don't fit into PassFunc");
+            static_assert(std::is_trivially_copyable_v<Func> && std::is_trivially_destructible_v<Func>,
+                          "Pass captures must be trivially copyable");
+
+            new (_storage) Func(InFunc);
+            _invoke = [](const void* InStorage, ID3D12GraphicsCommandList* InCmdList) -> bool
+            { return (*static_cast<const Func*>(InStorage))(InCmdList); };
+        }
+
+        explicit operator bool() const { return _invoke != nullptr; }
+        bool operator()(ID3D12GraphicsCommandList* InCmdList) const { return _invoke(_storage, InCmdList); }
+
+      private:
+        alignas(std::max_align_t) unsigned char _storage[Capacity] {};
+        bool (*_invoke)(const void* InStorage, ID3D12GraphicsCommandList* InCmdList) = nullptr;
+    };
+
+  private:
+    std::string _name = "";
+
+    PassGraph _graph;
+    PassGraph::Plan _plan;
+    std::vector<ID3D12Resource*> _imported;
+    std::vector<PassFunc> _passFuncs;
+    std::vector<D3D12_RESOURCE_BARRIER> _barriers;
+
+    ID3D12Resource* ResolveResource(ResourceId InResource) const;
+    void RecordBarriers(ID3D12GraphicsCommandList* InCmdList, const std::vector<PassGraph::Barrier>& InBarriers);
+
+  public:
+    // Names are not copied, use string literals
+    ResourceId Import(const char* InName, ID3D12Resource* InResource, D3D12_RESOURCE_STATES InInitialState,
+                      D3D12_RESOURCE_STATES InFinalState);
+
+    PassId AddPass(const char* InName, PassFunc InFunc, bool InNeverCull = false);
+    bool Read(PassId InPass, ResourceId InResource, D3D12_RESOURCE_STATES InState);
+    bool Write(PassId InPass, ResourceId InResource, D3D12_RESOURCE_STATES InState);
+
+    ID3D12Resource* Resource(ResourceId InResource) const { return ResolveResource(InResource); }
+
+    // Passes declared since last Execute
+    size_t PassCount() const { return _graph.PassCount(); }
+
+    // Compiles, records and clears the declared graph. Returns false when compile or a pass fails,
+    // passes after a failed one are skipped but their barriers are recorded to keep states consistent.
+    bool Execute(ID3D12GraphicsCommandList* InCmdList);
+
+    size_t LastBarrierCount() const { return _plan.BarrierCount(); }
+
+    explicit PassGraph_Dx12(std::string InName);
+};
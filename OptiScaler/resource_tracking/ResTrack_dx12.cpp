@@ -5,6 +5,7 @@
 #include <Util.h>
 
 #include <menu/menu_overlay_dx.h>
+#include <proxies/D3D12_Proxy.h>
 
 #include <algorithm>
 #include <future>
@@ -42,6 +43,8 @@ typedef void (*PFN_CreateSampler)(ID3D12Device* This, const D3D12_SAMPLER_DESC*
 
 typedef HRESULT (*PFN_CreateDescriptorHeap)(ID3D12Device* This, D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc,
                                             REFIID riid, void** ppvHeap);
+typedef HRESULT (*PFN_CreateRootSignature)(ID3D12Device* This, UINT nodeMask, const void* pBlobWithRootSignature,
+                                           SIZE_T blobLengthInBytes, REFIID riid, void** ppvRootSignature);
 typedef void (*PFN_CopyDescriptors)(ID3D12Device* This, UINT NumDestDescriptorRanges,
                                     D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
                                     UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
@@ -70,6 +73,33 @@ typedef void (*PFN_Dispatch)(ID3D12GraphicsCommandList* This, UINT ThreadGroupCo
                              UINT ThreadGroupCountZ);
 typedef void (*PFN_ExecuteBundle)(ID3D12GraphicsCommandList* This, ID3D12GraphicsCommandList* pCommandList);
 
+// Command list hooks for FG input handoff
+typedef void (*PFN_SetGraphicsRootSignature)(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature);
+typedef void (*PFN_SetComputeRootSignature)(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature);
+typedef void (*PFN_CopyTextureRegion)(ID3D12GraphicsCommandList* This, const D3D12_TEXTURE_COPY_LOCATION* pDst,
+                                      UINT DstX, UINT DstY, UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                      const D3D12_BOX* pSrcBox);
+typedef void (*PFN_CopyResource)(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                 ID3D12Resource* pSrcResource);
+typedef void (*PFN_ResolveSubresource)(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                       UINT DstSubresource, ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                       DXGI_FORMAT Format);
+typedef void (*PFN_ClearDepthStencilView)(ID3D12GraphicsCommandList* This, D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView,
+                                          D3D12_CLEAR_FLAGS ClearFlags, FLOAT Depth, UINT8 Stencil, UINT NumRects,
+                                          const D3D12_RECT* pRects);
+typedef void (*PFN_ClearRenderTargetView)(ID3D12GraphicsCommandList* This, D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView,
+                                          const FLOAT ColorRGBA[4], UINT NumRects, const D3D12_RECT* pRects);
+typedef void (*PFN_ClearUnorderedAccessViewUint)(ID3D12GraphicsCommandList* This,
+                                                 D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                 D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                                 const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+typedef void (*PFN_ClearUnorderedAccessViewFloat)(ID3D12GraphicsCommandList* This,
+                                                  D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                  D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                                  const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+typedef void (*PFN_DiscardResource)(ID3D12GraphicsCommandList* This, ID3D12Resource* pResource,
+                                    const D3D12_DISCARD_REGION* pRegion);
+
 typedef void (*PFN_ExecuteCommandLists)(ID3D12CommandQueue* This, UINT NumCommandLists,
                                         ID3D12CommandList* const* ppCommandLists);
 
@@ -84,6 +114,7 @@ static PFN_CreateConstantBufferView o_CreateConstantBufferView = nullptr;
 static PFN_CreateSampler o_CreateSampler = nullptr;
 
 static PFN_CreateDescriptorHeap o_CreateDescriptorHeap = nullptr;
+static PFN_CreateRootSignature o_CreateRootSignature = nullptr;
 static PFN_CopyDescriptors o_CopyDescriptors = nullptr;
 static PFN_CopyDescriptorsSimple o_CopyDescriptorsSimple = nullptr;
 
@@ -99,6 +130,34 @@ static PFN_Release o_Release = nullptr;
 static PFN_OMSetRenderTargets o_OMSetRenderTargets = nullptr;
 static PFN_SetGraphicsRootDescriptorTable o_SetGraphicsRootDescriptorTable = nullptr;
 static PFN_SetComputeRootDescriptorTable o_SetComputeRootDescriptorTable = nullptr;
+static PFN_SetGraphicsRootSignature o_SetGraphicsRootSignature = nullptr;
+static PFN_SetComputeRootSignature o_SetComputeRootSignature = nullptr;
+
+static PFN_CopyTextureRegion o_CopyTextureRegion = nullptr;
+static PFN_CopyResource o_CopyResource = nullptr;
+static PFN_ResolveSubresource o_ResolveSubresource = nullptr;
+static PFN_ClearDepthStencilView o_ClearDepthStencilView = nullptr;
+static PFN_ClearRenderTargetView o_ClearRenderTargetView = nullptr;
+static PFN_ClearUnorderedAccessViewUint o_ClearUnorderedAccessViewUint = nullptr;
+static PFN_ClearUnorderedAccessViewFloat o_ClearUnorderedAccessViewFloat = nullptr;
+static PFN_DiscardResource o_DiscardResource = nullptr;
+
+// UAV ranges of a root signature's descriptor tables, indexed by root parameter.
+// Offset is from the table base, Count is UINT_MAX for unbounded ranges.
+struct HandoffUavRange
+{
+    UINT Offset = 0;
+    UINT Count = 0;
+};
+
+using HandoffRootLayout = std::vector<std::vector<HandoffUavRange>>;
+
+static ankerl::unordered_dense::map<ID3D12RootSignature*, HandoffRootLayout> handoffRootLayouts;
+static std::shared_mutex handoffRootMutex;
+
+// Root signatures are set and tables bound by the thread recording the command list
+static thread_local ankerl::unordered_dense::map<ID3D12GraphicsCommandList*, ID3D12RootSignature*> handoffGraphicsRoot;
+static thread_local ankerl::unordered_dense::map<ID3D12GraphicsCommandList*, ID3D12RootSignature*> handoffComputeRoot;
 
 // heaps
 // static std::vector<HeapInfo> fgHeaps;
@@ -560,6 +619,180 @@ bool ResTrack_Dx12::IsFGCommandList(IUnknown* cmdList)
     return fg->IsFGCommandList(cmdList);
 }
 
+bool ResTrack_Dx12::IsInputHandoffActive()
+{
+    if (!Config::Instance()->FGInputHandoff.value_or_default())
+        return false;
+
+    auto fg = State::Instance().currentFG;
+    return fg != nullptr && fg->Handoff.IsWatching();
+}
+
+void ResTrack_Dx12::ReportHandoffWrite(ID3D12Resource* resource)
+{
+    // FG might be destroyed after IsInputHandoffActive
+    auto fg = State::Instance().currentFG;
+
+    if (fg != nullptr && resource != nullptr)
+        fg->Handoff.Written(resource);
+}
+
+void ResTrack_Dx12::ReportHandoffWrite(HeapInfo* heap, SIZE_T cpuHandle)
+{
+    if (heap == nullptr)
+        return;
+
+    auto capturedBuffer = heap->GetByCpuHandle(cpuHandle);
+
+    if (capturedBuffer != nullptr)
+        ReportHandoffWrite(capturedBuffer->buffer);
+}
+
+void ResTrack_Dx12::ReportHandoffTable(ID3D12GraphicsCommandList* cmdList, bool compute, UINT rootParameterIndex,
+                                       HeapInfo* heap, SIZE_T gpuHandle)
+{
+    if (heap == nullptr)
+        return;
+
+    auto baseIndex = (UINT) ((gpuHandle - heap->gpuStart) / heap->increment);
+
+    auto& boundRoots = compute ? handoffComputeRoot : handoffGraphicsRoot;
+    auto boundRoot = boundRoots.find(cmdList);
+
+    std::shared_lock<std::shared_mutex> lock(handoffRootMutex);
+
+    auto layout = boundRoot != boundRoots.end() ? handoffRootLayouts.find(boundRoot->second) : handoffRootLayouts.end();
+
+    // Root signature created before the hooks or not deserialized, table size is unknown
+    if (layout == handoffRootLayouts.end() || rootParameterIndex >= layout->second.size())
+    {
+        lock.unlock();
+        ReportHandoffHeap(heap, baseIndex);
+        return;
+    }
+
+    for (const auto& range : layout->second[rootParameterIndex])
+    {
+        // Bindless tables can reach the rest of the heap
+        if (range.Count == UINT_MAX)
+        {
+            ReportHandoffHeap(heap, baseIndex + range.Offset);
+            continue;
+        }
+
+        for (UINT i = 0; i < range.Count; i++)
+        {
+            auto capturedBuffer = heap->GetByGpuHandle(gpuHandle + (range.Offset + i) * heap->increment);
+
+            if (capturedBuffer != nullptr && capturedBuffer->type == UAV)
+                ReportHandoffWrite(capturedBuffer->buffer);
+        }
+    }
+}
+
+void ResTrack_Dx12::ReportHandoffHeap(HeapInfo* heap, UINT firstIndex)
+{
+    // FG might be destroyed after IsInputHandoffActive
+    auto fg = State::Instance().currentFG;
+
+    if (fg == nullptr || firstIndex >= heap->numDescriptors)
+        return;
+
+    auto first = &heap->info[firstIndex];
+    auto last = &heap->info[heap->numDescriptors - 1];
+
+    for (uint32_t input = 0; input < FGInputHandoff::Count; input++)
+    {
+        auto resource = (ID3D12Resource*) fg->Handoff.Watched((FGInputHandoff::Input) input);
+
+        if (resource == nullptr)
+            continue;
+
+        bool written = false;
+
+        {
+            std::lock_guard<std::mutex> lock(_trMutex);
+
+            auto tracked = _trackedResources.find(resource);
+
+            if (tracked == _trackedResources.end())
+                continue;
+
+            // Any UAV of the resource which the table can reach, entries of overwritten descriptors are skipped
+            for (auto info : tracked->second)
+            {
+                if (info >= first && info <= last && info->buffer == resource && info->type == UAV)
+                {
+                    written = true;
+                    break;
+                }
+            }
+        }
+
+        if (written)
+            ReportHandoffWrite(resource);
+    }
+}
+
+void ResTrack_Dx12::StoreHandoffRootLayout(ID3D12RootSignature* rootSignature, const void* blob, SIZE_T blobLength)
+{
+    auto createDeserializer = D3d12Proxy::D3D12CreateVersionedRootSignatureDeserializer_();
+    ID3D12VersionedRootSignatureDeserializer* deserializer = nullptr;
+    const D3D12_VERSIONED_ROOT_SIGNATURE_DESC* desc = nullptr;
+
+    HandoffRootLayout layout;
+    bool parsed = false;
+
+    if (createDeserializer != nullptr && createDeserializer(blob, blobLength, IID_PPV_ARGS(&deserializer)) == S_OK)
+    {
+        auto result = deserializer->GetRootSignatureDescAtVersion(D3D_ROOT_SIGNATURE_VERSION_1_1, &desc);
+        parsed = result == S_OK && desc != nullptr;
+
+        if (!parsed)
+            LOG_WARN("GetRootSignatureDescAtVersion error: {:X}", (UINT) result);
+
+        for (UINT p = 0; parsed && p < desc->Desc_1_1.NumParameters; p++)
+        {
+            const auto& parameter = desc->Desc_1_1.pParameters[p];
+            layout.emplace_back();
+
+            if (parameter.ParameterType != D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+                continue;
+
+            UINT offset = 0;
+
+            for (UINT r = 0; r < parameter.DescriptorTable.NumDescriptorRanges; r++)
+            {
+                const auto& range = parameter.DescriptorTable.pDescriptorRanges[r];
+
+                if (range.OffsetInDescriptorsFromTableStart != D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND)
+                    offset = range.OffsetInDescriptorsFromTableStart;
+
+                if (range.RangeType == D3D12_DESCRIPTOR_RANGE_TYPE_UAV)
+                    layout[p].push_back({ offset, range.NumDescriptors });
+
+                // Nothing can be appended after an unbounded range
+                if (range.NumDescriptors == UINT_MAX)
+                    break;
+
+                offset += range.NumDescriptors;
+            }
+        }
+
+        deserializer->Release();
+    }
+
+    // Unparsed ones are removed, a new root signature can get the address of a released one
+    std::unique_lock<std::shared_mutex> lock(handoffRootMutex);
+
+    if (parsed)
+        handoffRootLayouts[rootSignature] = std::move(layout);
+    else
+        handoffRootLayouts.erase(rootSignature);
+}
+
+bool ResTrack_Dx12::IsHooked() { return o_OMSetRenderTargets != nullptr; }
+
 #pragma endregion
 
 #pragma region Resource input hooks
@@ -722,6 +955,30 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
         heap->SetByCpuHandle(DestDescriptor.ptr, resInfo);
 }
 
+void ResTrack_Dx12::hkCreateDepthStencilView(ID3D12Device* This, ID3D12Resource* pResource,
+                                             const D3D12_DEPTH_STENCIL_VIEW_DESC* pDesc,
+                                             D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+    o_CreateDepthStencilView(This, pResource, pDesc, DestDescriptor);
+
+    // Only tracked for FG input handoff
+    auto heap = GetHeapByCpuHandle(DestDescriptor.ptr);
+    if (heap == nullptr)
+        return;
+
+    if (pResource == nullptr)
+    {
+        heap->ClearByCpuHandle(DestDescriptor.ptr);
+        return;
+    }
+
+    ResourceInfo resInfo {};
+    FillResourceInfo(pResource, &resInfo);
+    resInfo.type = DSV;
+
+    heap->SetByCpuHandle(DestDescriptor.ptr, resInfo);
+}
+
 #pragma endregion
 
 void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumCommandLists,
@@ -733,6 +990,9 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
         return;
 
     IFGFeature_Dx12* fg = State::Instance().currentFG;
+    fg->ExecutePrepare(This, NumCommandLists, ppCommandLists);
+    Hudfix_Dx12::CommandListsSubmitted(This, NumCommandLists, ppCommandLists);
+
     if (!fg->ReadyForExecute())
     {
         for (size_t i = 0; i < NumCommandLists; i++)
@@ -781,12 +1041,16 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
 {
     auto result = o_CreateDescriptorHeap(This, pDescriptorHeapDesc, riid, ppvHeap);
 
-    if (State::Instance().skipHeapCapture)
+    if (State::Instance().skipHeapCapture || State::InWarmCreation())
         return result;
 
     // try to calculate handle ranges for heap
+    // depth stencil heaps are only needed for detecting depth writes
+    auto trackDsv = pDescriptorHeapDesc->Type == D3D12_DESCRIPTOR_HEAP_TYPE_DSV &&
+                    Config::Instance()->FGInputHandoff.value_or_default();
+
     if (result == S_OK && (pDescriptorHeapDesc->Type == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV ||
-                           pDescriptorHeapDesc->Type == D3D12_DESCRIPTOR_HEAP_TYPE_RTV))
+                           pDescriptorHeapDesc->Type == D3D12_DESCRIPTOR_HEAP_TYPE_RTV || trackDsv))
     {
         auto heap = (ID3D12DescriptorHeap*) (*ppvHeap);
         auto increment = This->GetDescriptorHandleIncrementSize(pDescriptorHeapDesc->Type);
@@ -820,6 +1084,22 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
     return result;
 }
 
+HRESULT ResTrack_Dx12::hkCreateRootSignature(ID3D12Device* This, UINT nodeMask, const void* pBlobWithRootSignature,
+                                             SIZE_T blobLengthInBytes, REFIID riid, void** ppvRootSignature)
+{
+    auto result =
+        o_CreateRootSignature(This, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid, ppvRootSignature);
+
+    // Descriptor table sizes for FG input handoff
+    if (result == S_OK && ppvRootSignature != nullptr && *ppvRootSignature != nullptr)
+    {
+        StoreHandoffRootLayout((ID3D12RootSignature*) *ppvRootSignature, pBlobWithRootSignature,
+                               blobLengthInBytes);
+    }
+
+    return result;
+}
+
 ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
 {
     if (State::Instance().isShuttingDown)
@@ -1150,9 +1430,26 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
 
 #pragma region Shader input hooks
 
+void ResTrack_Dx12::hkSetGraphicsRootSignature(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature)
+{
+    handoffGraphicsRoot[This] = pRootSignature;
+    o_SetGraphicsRootSignature(This, pRootSignature);
+}
+
+void ResTrack_Dx12::hkSetComputeRootSignature(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature)
+{
+    handoffComputeRoot[This] = pRootSignature;
+    o_SetComputeRootSignature(This, pRootSignature);
+}
+
 void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                      D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    // Pixel shader UAV writes to FG inputs
+    if (BaseDescriptor.ptr != 0 && IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffTable(This, false, RootParameterIndex, GetHeapByGpuHandleGR(BaseDescriptor.ptr),
+                           BaseDescriptor.ptr);
+
     if (BaseDescriptor.ptr == 0 || !IsHudFixActive() || Hudfix_Dx12::SkipHudlessChecks())
     {
         o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
@@ -1223,6 +1520,25 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
                                          BOOL RTsSingleHandleToDescriptorRange,
                                          D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor)
 {
+    // Writes to FG inputs between upscaler and FG dispatch
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+    {
+        if (pDepthStencilDescriptor != nullptr)
+            ReportHandoffWrite(GetHeapByCpuHandle(pDepthStencilDescriptor->ptr), pDepthStencilDescriptor->ptr);
+
+        for (size_t i = 0; pRenderTargetDescriptors != nullptr && i < NumRenderTargetDescriptors; i++)
+        {
+            auto ptr = RTsSingleHandleToDescriptorRange ? pRenderTargetDescriptors[0].ptr
+                                                        : pRenderTargetDescriptors[i].ptr;
+            auto heap = GetHeapByCpuHandleRTV(ptr);
+
+            if (heap != nullptr && RTsSingleHandleToDescriptorRange)
+                ptr += i * heap->increment;
+
+            ReportHandoffWrite(heap, ptr);
+        }
+    }
+
     if (NumRenderTargetDescriptors == 0 || pRenderTargetDescriptors == nullptr || !IsHudFixActive() ||
         Hudfix_Dx12::SkipHudlessChecks())
     {
@@ -1318,6 +1634,10 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
 void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                     D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    if (BaseDescriptor.ptr != 0 && IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffTable(This, true, RootParameterIndex, GetHeapByGpuHandleCR(BaseDescriptor.ptr),
+                           BaseDescriptor.ptr);
+
     if (BaseDescriptor.ptr == 0 || !IsHudFixActive() || Hudfix_Dx12::SkipHudlessChecks())
     {
         o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
@@ -1388,6 +1708,96 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
 
 #pragma endregion
 
+#pragma region Copy and clear hooks
+
+// Only hooked for FG input handoff, writes which are not done by shaders
+
+void ResTrack_Dx12::hkCopyTextureRegion(ID3D12GraphicsCommandList* This, const D3D12_TEXTURE_COPY_LOCATION* pDst,
+                                        UINT DstX, UINT DstY, UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                        const D3D12_BOX* pSrcBox)
+{
+    if (pDst != nullptr && IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pDst->pResource);
+
+    o_CopyTextureRegion(This, pDst, DstX, DstY, DstZ, pSrc, pSrcBox);
+}
+
+void ResTrack_Dx12::hkCopyResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                   ID3D12Resource* pSrcResource)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pDstResource);
+
+    o_CopyResource(This, pDstResource, pSrcResource);
+}
+
+void ResTrack_Dx12::hkResolveSubresource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                         UINT DstSubresource, ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                         DXGI_FORMAT Format)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pDstResource);
+
+    o_ResolveSubresource(This, pDstResource, DstSubresource, pSrcResource, SrcSubresource, Format);
+}
+
+void ResTrack_Dx12::hkClearDepthStencilView(ID3D12GraphicsCommandList* This,
+                                            D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView, D3D12_CLEAR_FLAGS ClearFlags,
+                                            FLOAT Depth, UINT8 Stencil, UINT NumRects, const D3D12_RECT* pRects)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(GetHeapByCpuHandle(DepthStencilView.ptr), DepthStencilView.ptr);
+
+    o_ClearDepthStencilView(This, DepthStencilView, ClearFlags, Depth, Stencil, NumRects, pRects);
+}
+
+void ResTrack_Dx12::hkClearRenderTargetView(ID3D12GraphicsCommandList* This,
+                                            D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+                                            UINT NumRects, const D3D12_RECT* pRects)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(GetHeapByCpuHandleRTV(RenderTargetView.ptr), RenderTargetView.ptr);
+
+    o_ClearRenderTargetView(This, RenderTargetView, ColorRGBA, NumRects, pRects);
+}
+
+void ResTrack_Dx12::hkClearUnorderedAccessViewUint(ID3D12GraphicsCommandList* This,
+                                                   D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                   D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle,
+                                                   ID3D12Resource* pResource, const UINT Values[4], UINT NumRects,
+                                                   const D3D12_RECT* pRects)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pResource);
+
+    o_ClearUnorderedAccessViewUint(This, ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects,
+                                   pRects);
+}
+
+void ResTrack_Dx12::hkClearUnorderedAccessViewFloat(ID3D12GraphicsCommandList* This,
+                                                    D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                    D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle,
+                                                    ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects,
+                                                    const D3D12_RECT* pRects)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pResource);
+
+    o_ClearUnorderedAccessViewFloat(This, ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects,
+                                    pRects);
+}
+
+void ResTrack_Dx12::hkDiscardResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pResource,
+                                      const D3D12_DISCARD_REGION* pRegion)
+{
+    if (IsInputHandoffActive() && !IsFGCommandList(This))
+        ReportHandoffWrite(pResource);
+
+    o_DiscardResource(This, pResource, pRegion);
+}
+
+#pragma endregion
+
 #pragma region Shader finalizer hooks
 
 // Capture if render target matches, wait for DrawIndexed
@@ -1696,6 +2106,21 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
 
             o_ExecuteBundle = (PFN_ExecuteBundle) pVTable[27];
 
+            // writes to FG inputs without shaders
+            if (Config::Instance()->FGInputHandoff.value_or_default())
+            {
+                o_SetComputeRootSignature = (PFN_SetComputeRootSignature) pVTable[29];
+                o_SetGraphicsRootSignature = (PFN_SetGraphicsRootSignature) pVTable[30];
+                o_CopyTextureRegion = (PFN_CopyTextureRegion) pVTable[16];
+                o_CopyResource = (PFN_CopyResource) pVTable[17];
+                o_ResolveSubresource = (PFN_ResolveSubresource) pVTable[19];
+                o_ClearDepthStencilView = (PFN_ClearDepthStencilView) pVTable[47];
+                o_ClearRenderTargetView = (PFN_ClearRenderTargetView) pVTable[48];
+                o_ClearUnorderedAccessViewUint = (PFN_ClearUnorderedAccessViewUint) pVTable[49];
+                o_ClearUnorderedAccessViewFloat = (PFN_ClearUnorderedAccessViewFloat) pVTable[50];
+                o_DiscardResource = (PFN_DiscardResource) pVTable[51];
+            }
+
             if (o_OMSetRenderTargets != nullptr)
             {
                 DetourTransactionBegin();
@@ -1722,6 +2147,36 @@ void ResTrack_Dx12::HookCommandList(ID3D12Device* InDevice)
                 if (o_ExecuteBundle != nullptr)
                     DetourAttach(&(PVOID&) o_ExecuteBundle, hkExecuteBundle);
 
+                if (o_SetComputeRootSignature != nullptr)
+                    DetourAttach(&(PVOID&) o_SetComputeRootSignature, hkSetComputeRootSignature);
+
+                if (o_SetGraphicsRootSignature != nullptr)
+                    DetourAttach(&(PVOID&) o_SetGraphicsRootSignature, hkSetGraphicsRootSignature);
+
+                if (o_CopyTextureRegion != nullptr)
+                    DetourAttach(&(PVOID&) o_CopyTextureRegion, hkCopyTextureRegion);
+
+                if (o_CopyResource != nullptr)
+                    DetourAttach(&(PVOID&) o_CopyResource, hkCopyResource);
+
+                if (o_ResolveSubresource != nullptr)
+                    DetourAttach(&(PVOID&) o_ResolveSubresource, hkResolveSubresource);
+
+                if (o_ClearDepthStencilView != nullptr)
+                    DetourAttach(&(PVOID&) o_ClearDepthStencilView, hkClearDepthStencilView);
+
+                if (o_ClearRenderTargetView != nullptr)
+                    DetourAttach(&(PVOID&) o_ClearRenderTargetView, hkClearRenderTargetView);
+
+                if (o_ClearUnorderedAccessViewUint != nullptr)
+                    DetourAttach(&(PVOID&) o_ClearUnorderedAccessViewUint, hkClearUnorderedAccessViewUint);
+
+                if (o_ClearUnorderedAccessViewFloat != nullptr)
+                    DetourAttach(&(PVOID&) o_ClearUnorderedAccessViewFloat, hkClearUnorderedAccessViewFloat);
+
+                if (o_DiscardResource != nullptr)
+                    DetourAttach(&(PVOID&) o_DiscardResource, hkDiscardResource);
+
                 DetourTransactionCommit();
             }
 
@@ -1795,6 +2250,10 @@ void ResTrack_Dx12::HookDevice(ID3D12Device* device)
     o_CopyDescriptors = (PFN_CopyDescriptors) pVTable[23];
     o_CopyDescriptorsSimple = (PFN_CopyDescriptorsSimple) pVTable[24];
 
+    // descriptor table sizes for FG input handoff
+    if (Config::Instance()->FGInputHandoff.value_or_default())
+        o_CreateRootSignature = (PFN_CreateRootSignature) pVTable[16];
+
     // Apply the detour
     if (o_CreateDescriptorHeap != nullptr)
     {
@@ -1804,6 +2263,9 @@ void ResTrack_Dx12::HookDevice(ID3D12Device* device)
         if (o_CreateDescriptorHeap != nullptr)
             DetourAttach(&(PVOID&) o_CreateDescriptorHeap, hkCreateDescriptorHeap);
 
+        if (o_CreateRootSignature != nullptr)
+            DetourAttach(&(PVOID&) o_CreateRootSignature, hkCreateRootSignature);
+
         if (o_CreateRenderTargetView != nullptr)
             DetourAttach(&(PVOID&) o_CreateRenderTargetView, hkCreateRenderTargetView);
 
@@ -1813,6 +2275,9 @@ void ResTrack_Dx12::HookDevice(ID3D12Device* device)
         if (o_CreateUnorderedAccessView != nullptr)
             DetourAttach(&(PVOID&) o_CreateUnorderedAccessView, hkCreateUnorderedAccessView);
 
+        if (o_CreateDepthStencilView != nullptr && Config::Instance()->FGInputHandoff.value_or_default())
+            DetourAttach(&(PVOID&) o_CreateDepthStencilView, hkCreateDepthStencilView);
+
         if (o_CopyDescriptors != nullptr)
             DetourAttach(&(PVOID&) o_CopyDescriptors, hkCopyDescriptors);
 
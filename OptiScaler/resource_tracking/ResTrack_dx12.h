@@ -233,6 +233,14 @@ class ResTrack_Dx12
 
     static bool IsFGCommandList(IUnknown* cmdList);
 
+    static bool IsInputHandoffActive();
+    static void ReportHandoffWrite(ID3D12Resource* resource);
+    static void ReportHandoffWrite(HeapInfo* heap, SIZE_T cpuHandle);
+    static void ReportHandoffTable(ID3D12GraphicsCommandList* cmdList, bool compute, UINT rootParameterIndex,
+                                   HeapInfo* heap, SIZE_T gpuHandle);
+    static void ReportHandoffHeap(HeapInfo* heap, UINT firstIndex);
+    static void StoreHandoffRootLayout(ID3D12RootSignature* rootSignature, const void* blob, SIZE_T blobLength);
+
     static void hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptorRanges,
                                   D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
                                   UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
@@ -251,6 +259,8 @@ class ResTrack_Dx12
                                      D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor);
     static void hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                 D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor);
+    static void hkSetGraphicsRootSignature(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature);
+    static void hkSetComputeRootSignature(ID3D12GraphicsCommandList* This, ID3D12RootSignature* pRootSignature);
 
     static void hkDrawInstanced(ID3D12GraphicsCommandList* This, UINT VertexCountPerInstance, UINT InstanceCount,
                                 UINT StartVertexLocation, UINT StartInstanceLocation);
@@ -261,6 +271,30 @@ class ResTrack_Dx12
 
     static void hkExecuteBundle(ID3D12GraphicsCommandList* This, ID3D12GraphicsCommandList* pCommandList);
 
+    static void hkCopyTextureRegion(ID3D12GraphicsCommandList* This, const D3D12_TEXTURE_COPY_LOCATION* pDst,
+                                    UINT DstX, UINT DstY, UINT DstZ, const D3D12_TEXTURE_COPY_LOCATION* pSrc,
+                                    const D3D12_BOX* pSrcBox);
+    static void hkCopyResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                               ID3D12Resource* pSrcResource);
+    static void hkResolveSubresource(ID3D12GraphicsCommandList* This, ID3D12Resource* pDstResource,
+                                     UINT DstSubresource, ID3D12Resource* pSrcResource, UINT SrcSubresource,
+                                     DXGI_FORMAT Format);
+    static void hkClearDepthStencilView(ID3D12GraphicsCommandList* This, D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView,
+                                        D3D12_CLEAR_FLAGS ClearFlags, FLOAT Depth, UINT8 Stencil, UINT NumRects,
+                                        const D3D12_RECT* pRects);
+    static void hkClearRenderTargetView(ID3D12GraphicsCommandList* This, D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView,
+                                        const FLOAT ColorRGBA[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkClearUnorderedAccessViewUint(ID3D12GraphicsCommandList* This,
+                                               D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                               D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                               const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkClearUnorderedAccessViewFloat(ID3D12GraphicsCommandList* This,
+                                                D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+                                                D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource,
+                                                const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects);
+    static void hkDiscardResource(ID3D12GraphicsCommandList* This, ID3D12Resource* pResource,
+                                  const D3D12_DISCARD_REGION* pRegion);
+
     static void hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource* pResource,
                                          D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
                                          D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor);
@@ -270,12 +304,17 @@ class ResTrack_Dx12
     static void hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resource* pResource,
                                             ID3D12Resource* pCounterResource, D3D12_UNORDERED_ACCESS_VIEW_DESC* pDesc,
                                             D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor);
+    static void hkCreateDepthStencilView(ID3D12Device* This, ID3D12Resource* pResource,
+                                         const D3D12_DEPTH_STENCIL_VIEW_DESC* pDesc,
+                                         D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor);
 
     static void hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumCommandLists,
                                       ID3D12CommandList* const* ppCommandLists);
 
     static HRESULT hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc,
                                           REFIID riid, void** ppvHeap);
+    static HRESULT hkCreateRootSignature(ID3D12Device* This, UINT nodeMask, const void* pBlobWithRootSignature,
+                                         SIZE_T blobLengthInBytes, REFIID riid, void** ppvRootSignature);
 
     static ULONG hkRelease(ID3D12Resource* This);
 
@@ -312,4 +351,7 @@ class ResTrack_Dx12
     static void PresentDone();
     static void SetUpscalerCmdList(ID3D12GraphicsCommandList* cmdList);
     static void SetHudlessCmdList(ID3D12GraphicsCommandList* cmdList);
+
+    // Command list hooks are needed to detect writes to FG inputs
+    static bool IsHooked();
 };
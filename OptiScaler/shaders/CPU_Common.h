@@ -0,0 +1,315 @@
+#pragma once
+
+// Portable helpers for the CPU reference versions of the compute shaders.
+// Nothing in here (or in the *_Cpu files) depends on Windows or D3D headers so they can be built anywhere.
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+// CPU_SHADER_NO_SIMD forces the scalar paths, used by the tests to check them against the vector ones
+#if !defined(CPU_SHADER_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPU_SHADER_SSE 1
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define CPU_SHADER_AVX2 1
+#endif
+#endif
+
+template <typename T> struct CpuImage
+{
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    uint32_t Channels = 4;
+    std::vector<T> Data;
+
+    CpuImage() = default;
+    CpuImage(uint32_t InWidth, uint32_t InHeight, uint32_t InChannels = 4) { Resize(InWidth, InHeight, InChannels); }
+
+    void Resize(uint32_t InWidth, uint32_t InHeight, uint32_t InChannels = 4)
+    {
+        Width = InWidth;
+        Height = InHeight;
+        Channels = InChannels;
+        Data.assign((size_t) InWidth * InHeight * InChannels, T {});
+    }
+
+    bool IsValid() const { return Width > 0 && Height > 0 && Channels > 0 && Data.size() >= PixelCount() * Channels; }
+    size_t PixelCount() const { return (size_t) Width * Height; }
+    bool Contains(int64_t x, int64_t y) const { return x >= 0 && y >= 0 && x < Width && y < Height; }
+
+    T* Pixel(uint32_t x, uint32_t y) { return Data.data() + ((size_t) y * Width + x) * Channels; }
+    const T* Pixel(uint32_t x, uint32_t y) const { return Data.data() + ((size_t) y * Width + x) * Channels; }
+};
+
+using CpuTexture = CpuImage<float>;        // float channels, like Texture2D<float4>
+using CpuPackedTexture = CpuImage<uint32_t>; // one packed value per pixel, like RWTexture2D<uint>
+
+// 4 wide float vector, one pixel (rgba) per register
+struct CpuFloat4
+{
+#ifdef CPU_SHADER_SSE
+    __m128 v;
+
+    static CpuFloat4 Zero() { return { _mm_setzero_ps() }; }
+    static CpuFloat4 Splat(float s) { return { _mm_set1_ps(s) }; }
+    static CpuFloat4 Set(float x, float y, float z, float w) { return { _mm_setr_ps(x, y, z, w) }; }
+
+    float X() const { return _mm_cvtss_f32(v); }
+    float Y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+    float Z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))); }
+    float W() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+    CpuFloat4 operator+(const CpuFloat4& o) const { return { _mm_add_ps(v, o.v) }; }
+    CpuFloat4 operator-(const CpuFloat4& o) const { return { _mm_sub_ps(v, o.v) }; }
+    CpuFloat4 operator*(const CpuFloat4& o) const { return { _mm_mul_ps(v, o.v) }; }
+    CpuFloat4 operator/(const CpuFloat4& o) const { return { _mm_div_ps(v, o.v) }; }
+    CpuFloat4 operator*(float s) const { return { _mm_mul_ps(v, _mm_set1_ps(s)) }; }
+
+    static CpuFloat4 Min(const CpuFloat4& a, const CpuFloat4& b) { return { _mm_min_ps(a.v, b.v) }; }
+    static CpuFloat4 Max(const CpuFloat4& a, const CpuFloat4& b) { return { _mm_max_ps(a.v, b.v) }; }
+#else
+    float v[4];
+
+    static CpuFloat4 Zero() { return { { 0.0f, 0.0f, 0.0f, 0.0f } }; }
+    static CpuFloat4 Splat(float s) { return { { s, s, s, s } }; }
+    static CpuFloat4 Set(float x, float y, float z, float w) { return { { x, y, z, w } }; }
+
+    float X() const { return v[0]; }
+    float Y() const { return v[1]; }
+    float Z() const { return v[2]; }
+    float W() const { return v[3]; }
+
+    CpuFloat4 operator+(const CpuFloat4& o) const { return Set(v[0] + o.v[0], v[1] + o.v[1], v[2] + o.v[2], v[3] + o.v[3]); }
+    CpuFloat4 operator-(const CpuFloat4& o) const { return Set(v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2], v[3] - o.v[3]); }
+    CpuFloat4 operator*(const CpuFloat4& o) const { return Set(v[0] * o.v[0], v[1] * o.v[1], v[2] * o.v[2], v[3] * o.v[3]); }
+    CpuFloat4 operator/(const CpuFloat4& o) const { return Set(v[0] / o.v[0], v[1] / o.v[1], v[2] / o.v[2], v[3] / o.v[3]); }
+    CpuFloat4 operator*(float s) const { return Set(v[0] * s, v[1] * s, v[2] * s, v[3] * s); }
+
+    static CpuFloat4 Min(const CpuFloat4& a, const CpuFloat4& b)
+    {
+        return Set(std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]),
+                   std::min(a.v[3], b.v[3]));
+    }
+
+    static CpuFloat4 Max(const CpuFloat4& a, const CpuFloat4& b)
+    {
+        return Set(std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]),
+                   std::max(a.v[3], b.v[3]));
+    }
+#endif
+
+    CpuFloat4& operator+=(const CpuFloat4& o) { return *this = *this + o; }
+    CpuFloat4& operator*=(const CpuFloat4& o) { return *this = *this * o; }
+    CpuFloat4& operator*=(float s) { return *this = *this * s; }
+
+    static CpuFloat4 Saturate(const CpuFloat4& a) { return Min(Max(a, Zero()), Splat(1.0f)); }
+
+    float MaxRGB() const { return std::max(X(), std::max(Y(), Z())); }
+};
+
+// Texture2D.Load() semantics, out of bounds reads return 0
+inline CpuFloat4 CpuLoad(const CpuTexture& InTexture, int64_t x, int64_t y)
+{
+    if (!InTexture.Contains(x, y))
+        return CpuFloat4::Zero();
+
+    auto p = InTexture.Pixel((uint32_t) x, (uint32_t) y);
+
+    switch (InTexture.Channels)
+    {
+    case 1:
+        return CpuFloat4::Set(p[0], 0.0f, 0.0f, 0.0f);
+    case 2:
+        return CpuFloat4::Set(p[0], p[1], 0.0f, 0.0f);
+    case 3:
+        return CpuFloat4::Set(p[0], p[1], p[2], 0.0f);
+    default:
+#ifdef CPU_SHADER_SSE
+        return { _mm_loadu_ps(p) };
+#else
+        return CpuFloat4::Set(p[0], p[1], p[2], p[3]);
+#endif
+    }
+}
+
+// Load with coordinates clamped to the texture (matches the explicit clamp() calls in the shaders)
+inline CpuFloat4 CpuLoadClamped(const CpuTexture& InTexture, int64_t x, int64_t y)
+{
+    x = std::clamp<int64_t>(x, 0, (int64_t) InTexture.Width - 1);
+    y = std::clamp<int64_t>(y, 0, (int64_t) InTexture.Height - 1);
+    return CpuLoad(InTexture, x, y);
+}
+
+// RWTexture2D store semantics, out of bounds writes are dropped.
+// InComponents limits the written channels (float3 UAV writes leave alpha untouched)
+inline void CpuStore(CpuTexture& OutTexture, int64_t x, int64_t y, const CpuFloat4& InValue, uint32_t InComponents = 4)
+{
+    if (!OutTexture.Contains(x, y))
+        return;
+
+    auto p = OutTexture.Pixel((uint32_t) x, (uint32_t) y);
+    auto count = std::min(InComponents, OutTexture.Channels);
+
+#ifdef CPU_SHADER_SSE
+    if (count == 4)
+    {
+        _mm_storeu_ps(p, InValue.v);
+        return;
+    }
+#endif
+
+    float values[4] = { InValue.X(), InValue.Y(), InValue.Z(), InValue.W() };
+    for (uint32_t i = 0; i < count; i++)
+        p[i] = values[i];
+}
+
+// Bilinear SampleLevel() with a clamping sampler, uv is normalized
+inline CpuFloat4 CpuSampleLinearClamp(const CpuTexture& InTexture, float u, float v)
+{
+    float x = u * InTexture.Width - 0.5f;
+    float y = v * InTexture.Height - 0.5f;
+
+    float fx = std::floor(x);
+    float fy = std::floor(y);
+    float tx = x - fx;
+    float ty = y - fy;
+
+    auto x0 = (int64_t) fx;
+    auto y0 = (int64_t) fy;
+
+    auto c00 = CpuLoadClamped(InTexture, x0, y0);
+    auto c10 = CpuLoadClamped(InTexture, x0 + 1, y0);
+    auto c01 = CpuLoadClamped(InTexture, x0, y0 + 1);
+    auto c11 = CpuLoadClamped(InTexture, x0 + 1, y0 + 1);
+
+    auto top = c00 * (1.0f - tx) + c10 * tx;
+    auto bottom = c01 * (1.0f - tx) + c11 * tx;
+    return top * (1.0f - ty) + bottom * ty;
+}
+
+inline float CpuFrac(float x) { return x - std::floor(x); }
+
+inline float CpuSaturate(float x) { return std::min(std::max(x, 0.0f), 1.0f); }
+
+inline uint32_t CpuAsUint(float f)
+{
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float CpuAsFloat(uint32_t u)
+{
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Splits the dispatch area into tiles (thread groups) and runs them on worker threads.
+// InFunction is called as InFunction(x0, y0, x1, y1) with exclusive x1/y1.
+template <typename Fn>
+inline void CpuDispatchTiles(uint32_t InWidth, uint32_t InHeight, uint32_t InTileWidth, uint32_t InTileHeight,
+                             Fn&& InFunction, uint32_t InThreadCount = 0)
+{
+    if (InWidth == 0 || InHeight == 0 || InTileWidth == 0 || InTileHeight == 0)
+        return;
+
+    const uint32_t tilesX = (InWidth + InTileWidth - 1) / InTileWidth;
+    const uint32_t tilesY = (InHeight + InTileHeight - 1) / InTileHeight;
+    const uint32_t tileCount = tilesX * tilesY;
+
+    if (InThreadCount == 0)
+        InThreadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    InThreadCount = std::min(InThreadCount, tileCount);
+
+    std::atomic<uint32_t> nextTile { 0 };
+
+    auto worker = [&]()
+    {
+        for (uint32_t tile = nextTile.fetch_add(1); tile < tileCount; tile = nextTile.fetch_add(1))
+        {
+            uint32_t x0 = (tile % tilesX) * InTileWidth;
+            uint32_t y0 = (tile / tilesX) * InTileHeight;
+            InFunction(x0, y0, std::min(x0 + InTileWidth, InWidth), std::min(y0 + InTileHeight, InHeight));
+        }
+    };
+
+    if (InThreadCount <= 1)
+    {
+        worker();
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(InThreadCount - 1);
+
+    for (uint32_t i = 1; i < InThreadCount; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// Result of comparing two images, used for checking against golden outputs
+struct CpuImageDiff
+{
+    double MaxAbsDiff = 0.0;
+    double MeanAbsDiff = 0.0;
+    size_t MismatchCount = 0; // values with difference above the tolerance
+    bool SizeMismatch = false;
+};
+
+inline CpuImageDiff CpuCompareImages(const CpuTexture& InA, const CpuTexture& InB, float InTolerance,
+                                     uint32_t InComponents = 4)
+{
+    CpuImageDiff result {};
+
+    if (InA.Width != InB.Width || InA.Height != InB.Height)
+    {
+        result.SizeMismatch = true;
+        return result;
+    }
+
+    auto components = std::min({ InComponents, InA.Channels, InB.Channels });
+    double total = 0.0;
+    size_t count = 0;
+
+    for (uint32_t y = 0; y < InA.Height; y++)
+    {
+        for (uint32_t x = 0; x < InA.Width; x++)
+        {
+            auto a = InA.Pixel(x, y);
+            auto b = InB.Pixel(x, y);
+
+            for (uint32_t c = 0; c < components; c++)
+            {
+                double diff = std::abs((double) a[c] - (double) b[c]);
+
+                if (std::isnan(diff))
+                    diff = std::isnan(a[c]) && std::isnan(b[c]) ? 0.0 : INFINITY;
+
+                result.MaxAbsDiff = std::max(result.MaxAbsDiff, diff);
+
+                if (diff > InTolerance)
+                    result.MismatchCount++;
+
+                total += diff;
+                count++;
+            }
+        }
+    }
+
+    result.MeanAbsDiff = count > 0 ? total / count : 0.0;
+    return result;
+}
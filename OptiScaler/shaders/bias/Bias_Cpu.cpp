@@ -0,0 +1,24 @@
+#include "Bias_Cpu.h"
+
+bool Bias_Cpu::Dispatch(const CpuTexture& InResource, float InBias, CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    const float bias = std::clamp(InBias, 0.0f, 0.9f);
+    const auto mul = CpuFloat4::Set(bias, 1.0f, 1.0f, 1.0f);
+
+    CpuDispatchTiles(
+        InResource.Width, InResource.Height, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                    CpuStore(OutResource, x, y, CpuLoad(InResource, x, y) * mul, 3);
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of biasShader (Bias_Common.h)
+class Bias_Cpu
+{
+  public:
+    static constexpr uint32_t NumThreadsX = 32;
+    static constexpr uint32_t NumThreadsY = 32;
+
+    // Dispatch area is the size of InResource like Bias_Dx12, InBias is clamped the same way
+    static bool Dispatch(const CpuTexture& InResource, float InBias, CpuTexture& OutResource,
+                         uint32_t InThreadCount = 0);
+};
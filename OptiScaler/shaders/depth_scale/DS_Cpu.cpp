@@ -0,0 +1,63 @@
+#include "DS_Cpu.h"
+
+bool DS_Cpu::Dispatch(const CpuTexture& InResource, float InDepthScale, uint32_t InWidth, uint32_t InHeight,
+                      CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid() || InResource.Channels != 1 || OutResource.Channels != 1)
+        return false;
+
+    // Only the part both textures cover needs the vector loop, rest is handled like the gpu would
+    const uint32_t width = std::min({ InWidth, InResource.Width, OutResource.Width });
+    const float rcpScale = 1.0f / InDepthScale;
+
+    CpuDispatchTiles(
+        InWidth, InHeight, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1 && y < OutResource.Height; y++)
+            {
+                uint32_t x = x0;
+
+                if (y < InResource.Height)
+                {
+                    const float* src = InResource.Pixel(0, y);
+                    float* dst = OutResource.Pixel(0, y);
+                    uint32_t end = std::min(x1, width);
+
+#if defined(CPU_SHADER_AVX2)
+                    const __m256 scale8 = _mm256_set1_ps(rcpScale);
+                    const __m256 zero8 = _mm256_setzero_ps();
+                    const __m256 one8 = _mm256_set1_ps(1.0f);
+
+                    for (; x + 8 <= end; x += 8)
+                    {
+                        __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src + x), scale8);
+                        _mm256_storeu_ps(dst + x, _mm256_min_ps(_mm256_max_ps(v, zero8), one8));
+                    }
+#endif
+
+#if defined(CPU_SHADER_SSE)
+                    const __m128 scale4 = _mm_set1_ps(rcpScale);
+                    const __m128 zero4 = _mm_setzero_ps();
+                    const __m128 one4 = _mm_set1_ps(1.0f);
+
+                    for (; x + 4 <= end; x += 4)
+                    {
+                        __m128 v = _mm_mul_ps(_mm_loadu_ps(src + x), scale4);
+                        _mm_storeu_ps(dst + x, _mm_min_ps(_mm_max_ps(v, zero4), one4));
+                    }
+#endif
+
+                    for (; x < end; x++)
+                        dst[x] = CpuSaturate(src[x] * rcpScale);
+                }
+
+                // Outside of the source, Load returns 0
+                for (; x < x1 && x < OutResource.Width; x++)
+                    OutResource.Pixel(x, y)[0] = CpuSaturate(CpuLoad(InResource, x, y).X() * rcpScale);
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of the depth scale shader (DS_Common.h)
+class DS_Cpu
+{
+  public:
+    static constexpr uint32_t NumThreadsX = 16;
+    static constexpr uint32_t NumThreadsY = 16;
+
+    // Single channel textures, InWidth/InHeight is the dispatch area (display or render size on DS_Dx12)
+    static bool Dispatch(const CpuTexture& InResource, float InDepthScale, uint32_t InWidth, uint32_t InHeight,
+                         CpuTexture& OutResource, uint32_t InThreadCount = 0);
+};
@@ -0,0 +1,42 @@
+#include "DT_Cpu.h"
+
+bool DT_Cpu::Dispatch(const CpuTexture& InResource, CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid() || InResource.Channels != 1 || OutResource.Channels != 1)
+        return false;
+
+    const uint32_t width = std::min(InResource.Width, OutResource.Width);
+    const uint32_t height = std::min(InResource.Height, OutResource.Height);
+
+    CpuDispatchTiles(
+        width, height, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                const float* src = InResource.Pixel(0, y);
+                float* dst = OutResource.Pixel(0, y);
+                uint32_t x = x0;
+
+#if defined(CPU_SHADER_AVX2)
+                const __m256 one8 = _mm256_set1_ps(1.0f);
+
+                for (; x + 8 <= x1; x += 8)
+                    _mm256_storeu_ps(dst + x, _mm256_sub_ps(one8, _mm256_loadu_ps(src + x)));
+#endif
+
+#if defined(CPU_SHADER_SSE)
+                const __m128 one4 = _mm_set1_ps(1.0f);
+
+                for (; x + 4 <= x1; x += 4)
+                    _mm_storeu_ps(dst + x, _mm_sub_ps(one4, _mm_loadu_ps(src + x)));
+#endif
+
+                for (; x < x1; x++)
+                    dst[x] = 1.0f - src[x];
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of the depth invert shader (DT_Common.h)
+class DT_Cpu
+{
+  public:
+    static constexpr uint32_t NumThreadsX = 512;
+    static constexpr uint32_t NumThreadsY = 1;
+
+    // Single channel textures, dispatch area is the size of InResource like DepthTransfer_Dx11
+    static bool Dispatch(const CpuTexture& InResource, CpuTexture& OutResource, uint32_t InThreadCount = 0);
+};
@@ -3,20 +3,43 @@
 #include <d3dcompiler.h>
 #include <DirectXMath.h>
 
-inline static std::string ftR10G10B10A2Code = R"(
+#include "FT_Formats.h"
+
+// Each thread converts a 2x2 quad, 8x8 groups cover 16x16 pixels.
+// Shader strings below only add the Pack function for their format.
+inline static std::string ftTransferCode = R"(
 Texture2D<float4> SourceTexture : register(t0); 
-RWTexture2D<uint> DestinationTexture : register(u0); // R10G10B10A2_UNORM destination texture
+RWTexture2D<uint> DestinationTexture : register(u0);
+
+#define PIXELS_PER_THREAD 2
 
-// Shader to perform the conversion
-[numthreads(512, 1, 1)]
+[numthreads(8, 8, 1)]
 void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
 {
-    // Read from the source texture
-    float4 srcColor = SourceTexture.Load(int3(dispatchThreadID.xy, 0));
+    uint2 basePos = dispatchThreadID.xy * PIXELS_PER_THREAD;
 
-    // Clamp color channels to [0, 1] range, as R10G10B10A2_UNORM is normalized
-    srcColor = saturate(srcColor); // Ensures all values are between 0 and 1
+    [unroll]
+    for (uint y = 0; y < PIXELS_PER_THREAD; y++)
+    {
+        [unroll]
+        for (uint x = 0; x < PIXELS_PER_THREAD; x++)
+        {
+            uint2 pos = basePos + uint2(x, y);
+
+            // Clamp color channels to [0, 1] range, as destination formats are normalized
+            float4 srcColor = saturate(SourceTexture.Load(int3(pos, 0)));
+
+            // Out of bounds writes are discarded
+            DestinationTexture[pos] = Pack(srcColor);
+        }
+    }
+}
+)";
 
+inline static std::string ftR10G10B10A2Code = R"(
+// R10G10B10A2_UNORM destination texture
+uint Pack(float4 srcColor)
+{
     // Convert each channel to its corresponding bit range
     uint R = (uint)(srcColor.r * 1023.0f); // 10 bits for Red
     uint G = (uint)(srcColor.g * 1023.0f); // 10 bits for Green
@@ -24,27 +47,14 @@ void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
     uint A = (uint)(srcColor.a * 3.0f);    // 2 bits for Alpha
 
     // Pack the values into a single 32-bit unsigned int
-    uint packedColor = R | G << 10 | B << 20 | A << 30;
-
-    // Write the packed color to the destination texture
-    DestinationTexture[dispatchThreadID.xy] = packedColor;
+    return R | G << 10 | B << 20 | A << 30;
 }
-)";
+)" + ftTransferCode;
 
 inline static std::string ftR8G8B8A8Code = R"(
-Texture2D<float4> SourceTexture : register(t0); 
-RWTexture2D<uint> DestinationTexture : register(u0); // R8G8B8A8_UNORM destination texture
-
-// Shader to perform the conversion
-[numthreads(512, 1, 1)]
-void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
+// R8G8B8A8_UNORM destination texture
+uint Pack(float4 srcColor)
 {
-    // Read from the source texture
-    float4 srcColor = SourceTexture.Load(int3(dispatchThreadID.xy, 0));
-
-    // Clamp color channels to [0, 1] range, as R8G8B8A8_UNORM is normalized
-    srcColor = saturate(srcColor); // Ensures all values are between 0 and 1
-
     // Convert each channel to its corresponding bit range
     uint R = (uint)(srcColor.r * 255.0f); // 8 bits for Red
     uint G = (uint)(srcColor.g * 255.0f); // 8 bits for Green
@@ -52,27 +62,14 @@ void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
     uint A = (uint)(srcColor.a * 255.0f); // 8 bits for Alpha
 
     // Pack the values into a single 32-bit unsigned int
-    uint packedColor = R | G << 8 | B << 16 | A << 24;
-
-    // Write the packed color to the destination texture
-    DestinationTexture[dispatchThreadID.xy] = packedColor;
+    return R | G << 8 | B << 16 | A << 24;
 }
-)";
+)" + ftTransferCode;
 
 inline static std::string ftB8G8R8A8Code = R"(
-Texture2D<float4> SourceTexture : register(t0); 
-RWTexture2D<uint> DestinationTexture : register(u0); // B8R8G8A8_UNORM destination texture
-
-// Shader to perform the conversion
-[numthreads(512, 1, 1)]
-void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
+// B8R8G8A8_UNORM destination texture
+uint Pack(float4 srcColor)
 {
-    // Read from the source texture
-    float4 srcColor = SourceTexture.Load(int3(dispatchThreadID.xy, 0));
-
-    // Clamp color channels to [0, 1] range, as R8G8B8A8_UNORM is normalized
-    srcColor = saturate(srcColor); // Ensures all values are between 0 and 1
-
     // Convert each channel to its corresponding bit range
     uint R = (uint)(srcColor.r * 255.0f); // 8 bits for Red
     uint G = (uint)(srcColor.g * 255.0f); // 8 bits for Green
@@ -80,12 +77,28 @@ void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
     uint A = (uint)(srcColor.a * 255.0f); // 8 bits for Alpha
 
     // Pack the values into a single 32-bit unsigned int
-    uint packedColor = B | R << 8 | G << 16 | A << 24;
+    return B | R << 8 | G << 16 | A << 24;
+}
+)" + ftTransferCode;
+
+// Shader code of FT_FormatInfo::Shader, nullptr for FT_Shader::None
+inline static const std::string* FT_GetShaderCode(FT_Shader shader)
+{
+    switch (shader)
+    {
+    case FT_Shader::R10G10B10A2:
+        return &ftR10G10B10A2Code;
+
+    case FT_Shader::R8G8B8A8:
+        return &ftR8G8B8A8Code;
 
-    // Write the packed color to the destination texture
-    DestinationTexture[dispatchThreadID.xy] = packedColor;
+    case FT_Shader::B8G8R8A8:
+        return &ftB8G8R8A8Code;
+
+    default:
+        return nullptr;
+    }
 }
-)";
 
 inline static ID3DBlob* FT_CompileShader(const char* shaderCode, const char* entryPoint, const char* target)
 {
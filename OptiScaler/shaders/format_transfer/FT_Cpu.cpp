@@ -0,0 +1,57 @@
+#include "FT_Cpu.h"
+
+uint32_t FT_Cpu::Pack(const CpuFloat4& InColor, Format InFormat)
+{
+    auto color = CpuFloat4::Saturate(InColor);
+
+#ifdef CPU_SHADER_SSE
+    // Scale and truncate all channels at once, same as the (uint) casts of the shader
+    __m128 scale = InFormat == Format::R10G10B10A2 ? _mm_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f)
+                                                   : _mm_set1_ps(255.0f);
+    alignas(16) uint32_t c[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(c), _mm_cvttps_epi32(_mm_mul_ps(color.v, scale)));
+#else
+    float scale = InFormat == Format::R10G10B10A2 ? 1023.0f : 255.0f;
+    uint32_t c[4] = { (uint32_t) (color.X() * scale), (uint32_t) (color.Y() * scale), (uint32_t) (color.Z() * scale),
+                      (uint32_t) (color.W() * (InFormat == Format::R10G10B10A2 ? 3.0f : 255.0f)) };
+#endif
+
+    switch (InFormat)
+    {
+    case Format::R10G10B10A2:
+        return c[0] | c[1] << 10 | c[2] << 20 | c[3] << 30;
+
+    case Format::B8G8R8A8:
+        // Matches ftB8G8R8A8Code
+        return c[2] | c[0] << 8 | c[1] << 16 | c[3] << 24;
+
+    default:
+        return c[0] | c[1] << 8 | c[2] << 16 | c[3] << 24;
+    }
+}
+
+bool FT_Cpu::Dispatch(const CpuTexture& InResource, Format InFormat, uint32_t InWidth, uint32_t InHeight,
+                      CpuPackedTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid() || OutResource.Channels != 1)
+        return false;
+
+    const uint32_t width = std::min(InWidth, OutResource.Width);
+    const uint32_t height = std::min(InHeight, OutResource.Height);
+
+    CpuDispatchTiles(
+        width, height, NumThreadsX * PixelsPerThread, NumThreadsY * PixelsPerThread,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                uint32_t* dst = OutResource.Pixel(0, y);
+
+                for (uint32_t x = x0; x < x1; x++)
+                    dst[x] = Pack(CpuLoad(InResource, x, y), InFormat);
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
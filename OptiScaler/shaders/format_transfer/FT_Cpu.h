@@ -0,0 +1,26 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of the format transfer shaders (FT_Common.h)
+class FT_Cpu
+{
+  public:
+    enum class Format
+    {
+        R10G10B10A2,
+        R8G8B8A8,
+        B8G8R8A8,
+    };
+
+    // Runtime compiled shaders, each thread converts a 2x2 quad
+    static constexpr uint32_t NumThreadsX = 8;
+    static constexpr uint32_t NumThreadsY = 8;
+    static constexpr uint32_t PixelsPerThread = 2;
+
+    // InWidth/InHeight is the dispatch area (output buffer size on FT_Dx12)
+    static bool Dispatch(const CpuTexture& InResource, Format InFormat, uint32_t InWidth, uint32_t InHeight,
+                         CpuPackedTexture& OutResource, uint32_t InThreadCount = 0);
+
+    static uint32_t Pack(const CpuFloat4& InColor, Format InFormat);
+};
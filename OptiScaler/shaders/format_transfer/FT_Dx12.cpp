@@ -186,9 +186,8 @@ bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     UINT dispatchWidth = 0;
     UINT dispatchHeight = 0;
 
-    dispatchWidth =
-        static_cast<UINT>((State::Instance().currentFeature->DisplayWidth() + InNumThreadsX - 1) / InNumThreadsX);
-    dispatchHeight = (State::Instance().currentFeature->DisplayHeight() + InNumThreadsY - 1) / InNumThreadsY;
+    // Output buffer is created with the size of input
+    FT_GetDispatchSize(_layout, outDesc.Width, outDesc.Height, dispatchWidth, dispatchHeight);
 
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
@@ -291,11 +290,38 @@ FT_Dx12::FT_Dx12(std::string InName, ID3D12Device* InDevice, DXGI_FORMAT InForma
         return;
     }
 
-    // Compile shader blobs
-    ID3DBlob* _recEncodeShader = nullptr;
+    // Runtime compiled shaders use the 8x8 layout. Precompiled blobs are still the 512x1 version, they are only
+    // used when compiling fails (no d3dcompiler)
+    auto formatInfo = FT_GetFormatInfo(InFormat);
 
-    if (Config::Instance()->UsePrecompiledShaders.value_or_default())
+    auto shaderCode = formatInfo != nullptr ? FT_GetShaderCode(formatInfo->Shader) : nullptr;
+
+    if (shaderCode == nullptr)
+    {
+        LOG_ERROR("[{0}] texture format is not found!", _name);
+        return;
+    }
+
+    ID3DBlob* _recEncodeShader = FT_CompileShader(shaderCode->c_str(), "CSMain", "cs_5_0");
+
+    if (_recEncodeShader != nullptr)
     {
+        // create pso objects
+        if (!CreateComputeShader(InDevice, _rootSignature, &_pipelineState, _recEncodeShader))
+            LOG_ERROR("[{0}] CreateComputeShader error!", _name);
+
+        _recEncodeShader->Release();
+        _recEncodeShader = nullptr;
+    }
+    else
+    {
+        LOG_WARN("[{0}] CompileShader error, using precompiled shader", _name);
+    }
+
+    if (_pipelineState == nullptr)
+    {
+        _layout = FT_PrecompiledLayout;
+
         D3D12_COMPUTE_PIPELINE_STATE_DESC computePsoDesc = {};
         computePsoDesc.pRootSignature = _rootSignature;
         computePsoDesc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
@@ -336,45 +362,6 @@ FT_Dx12::FT_Dx12(std::string InName, ID3D12Device* InDevice, DXGI_FORMAT InForma
             return;
         }
     }
-    else
-    {
-        if (InFormat == DXGI_FORMAT_R10G10B10A2_UNORM)
-        {
-            _recEncodeShader = FT_CompileShader(ftR10G10B10A2Code.c_str(), "CSMain", "cs_5_0");
-        }
-        else if (InFormat == DXGI_FORMAT_R8G8B8A8_UNORM || InFormat == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB)
-        {
-            _recEncodeShader = FT_CompileShader(ftR8G8B8A8Code.c_str(), "CSMain", "cs_5_0");
-        }
-        else if (InFormat == DXGI_FORMAT_B8G8R8A8_UNORM)
-        {
-            _recEncodeShader = FT_CompileShader(ftB8G8R8A8Code.c_str(), "CSMain", "cs_5_0");
-        }
-        else
-        {
-            LOG_ERROR("[{0}] texture format is not found!", _name);
-            return;
-        }
-
-        if (_recEncodeShader == nullptr)
-        {
-            LOG_ERROR("[{0}] CompileShader error!", _name);
-            return;
-        }
-
-        // create pso objects
-        if (!CreateComputeShader(InDevice, _rootSignature, &_pipelineState, _recEncodeShader))
-        {
-            LOG_ERROR("[{0}] CreateComputeShader error!", _name);
-            return;
-        }
-
-        if (_recEncodeShader != nullptr)
-        {
-            _recEncodeShader->Release();
-            _recEncodeShader = nullptr;
-        }
-    }
 
     D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
     heapDesc.NumDescriptors = 2; // SRV + UAV
@@ -21,8 +21,8 @@ class FT_Dx12
     D3D12_GPU_DESCRIPTOR_HANDLE _gpuUavHandle[2] { { NULL }, { NULL } };
     int _counter = 0;
 
-    uint32_t InNumThreadsX = 512;
-    uint32_t InNumThreadsY = 1;
+    // Precompiled shaders use 512x1 groups with 1 pixel per thread
+    FT_ShaderLayout _layout = FT_RuntimeLayout;
 
     ID3D12Device* _device = nullptr;
     ID3D12Resource* _buffer = nullptr;
@@ -44,5 +44,11 @@ class FT_Dx12
 
     bool IsFormatCompatible(DXGI_FORMAT InFormat);
 
+    // How InSource should be transferred to InTarget, see FT_FormatTable
+    static FT_TransferMode TransferMode(DXGI_FORMAT InSource, DXGI_FORMAT InTarget)
+    {
+        return FT_GetTransferMode(InSource, InTarget);
+    }
+
     ~FT_Dx12();
 };
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <dxgiformat.h>
+
+#include <cstdint>
+
+// Format compatibility table and dispatch layout of the format transfer shaders.
+// Nothing in here depends on Windows headers other than the DXGI_FORMAT enum so it can be built anywhere.
+
+enum class FT_TransferMode
+{
+    None,        // Same format
+    Copy,        // Same typeless family and same component type, CopyResource is enough
+    Compute,     // Needs conversion shader
+    Unsupported, // No shader for target format
+};
+
+// Conversion shader of a target format, same packing with FT_Cpu::Format
+enum class FT_Shader
+{
+    None,
+    R10G10B10A2,
+    R8G8B8A8,
+    B8G8R8A8,
+};
+
+// How the bits of a channel are read, UNORM_SRGB is stored as unorm
+enum class FT_Component
+{
+    Typeless,
+    Unorm,
+    Float,
+};
+
+struct FT_FormatInfo
+{
+    DXGI_FORMAT Format;
+    DXGI_FORMAT Family; // Typeless format of the cast family
+    FT_Component Component;
+    FT_Shader Shader; // Conversion shader when used as target, None if not supported
+};
+
+// Formats which can be seen as hudless or swapchain formats
+inline static const FT_FormatInfo FT_FormatTable[] = {
+    { DXGI_FORMAT_R32G32B32A32_TYPELESS, DXGI_FORMAT_R32G32B32A32_TYPELESS, FT_Component::Typeless, FT_Shader::None },
+    { DXGI_FORMAT_R32G32B32A32_FLOAT, DXGI_FORMAT_R32G32B32A32_TYPELESS, FT_Component::Float, FT_Shader::None },
+    { DXGI_FORMAT_R32G32B32_TYPELESS, DXGI_FORMAT_R32G32B32_TYPELESS, FT_Component::Typeless, FT_Shader::None },
+    { DXGI_FORMAT_R32G32B32_FLOAT, DXGI_FORMAT_R32G32B32_TYPELESS, FT_Component::Float, FT_Shader::None },
+    { DXGI_FORMAT_R16G16B16A16_TYPELESS, DXGI_FORMAT_R16G16B16A16_TYPELESS, FT_Component::Typeless, FT_Shader::None },
+    { DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_R16G16B16A16_TYPELESS, FT_Component::Float, FT_Shader::None },
+    { DXGI_FORMAT_R16G16B16A16_UNORM, DXGI_FORMAT_R16G16B16A16_TYPELESS, FT_Component::Unorm, FT_Shader::None },
+    { DXGI_FORMAT_R11G11B10_FLOAT, DXGI_FORMAT_R11G11B10_FLOAT, FT_Component::Float, FT_Shader::None },
+    { DXGI_FORMAT_R10G10B10A2_TYPELESS, DXGI_FORMAT_R10G10B10A2_TYPELESS, FT_Component::Typeless,
+      FT_Shader::R10G10B10A2 },
+    { DXGI_FORMAT_R10G10B10A2_UNORM, DXGI_FORMAT_R10G10B10A2_TYPELESS, FT_Component::Unorm, FT_Shader::R10G10B10A2 },
+    { DXGI_FORMAT_R8G8B8A8_TYPELESS, DXGI_FORMAT_R8G8B8A8_TYPELESS, FT_Component::Typeless, FT_Shader::R8G8B8A8 },
+    { DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R8G8B8A8_TYPELESS, FT_Component::Unorm, FT_Shader::R8G8B8A8 },
+    { DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, DXGI_FORMAT_R8G8B8A8_TYPELESS, FT_Component::Unorm, FT_Shader::R8G8B8A8 },
+    { DXGI_FORMAT_B8G8R8A8_TYPELESS, DXGI_FORMAT_B8G8R8A8_TYPELESS, FT_Component::Typeless, FT_Shader::B8G8R8A8 },
+    { DXGI_FORMAT_B8G8R8A8_UNORM, DXGI_FORMAT_B8G8R8A8_TYPELESS, FT_Component::Unorm, FT_Shader::B8G8R8A8 },
+    { DXGI_FORMAT_B8G8R8A8_UNORM_SRGB, DXGI_FORMAT_B8G8R8A8_TYPELESS, FT_Component::Unorm, FT_Shader::B8G8R8A8 },
+};
+
+inline static const FT_FormatInfo* FT_GetFormatInfo(DXGI_FORMAT format)
+{
+    for (const auto& info : FT_FormatTable)
+    {
+        if (info.Format == format)
+            return &info;
+    }
+
+    return nullptr;
+}
+
+// Cast compatible formats are copied as is when their channels are read the same way (or one side is typeless),
+// compute path is only used for real conversions. R16G16B16A16 FLOAT and UNORM share a family but copying the
+// bits would change the colors.
+inline static FT_TransferMode FT_GetTransferMode(DXGI_FORMAT source, DXGI_FORMAT target)
+{
+    if (source == target)
+        return FT_TransferMode::None;
+
+    auto sourceInfo = FT_GetFormatInfo(source);
+    auto targetInfo = FT_GetFormatInfo(target);
+
+    if (targetInfo == nullptr)
+        return FT_TransferMode::Unsupported;
+
+    if (sourceInfo != nullptr && sourceInfo->Family == targetInfo->Family &&
+        (sourceInfo->Component == targetInfo->Component || sourceInfo->Component == FT_Component::Typeless ||
+         targetInfo->Component == FT_Component::Typeless))
+    {
+        return FT_TransferMode::Copy;
+    }
+
+    return targetInfo->Shader != FT_Shader::None ? FT_TransferMode::Compute : FT_TransferMode::Unsupported;
+}
+
+struct FT_ShaderLayout
+{
+    uint32_t NumThreadsX;
+    uint32_t NumThreadsY;
+    uint32_t PixelsPerThread; // Square of pixels converted by each thread
+};
+
+// Runtime compiled shaders (ftTransferCode) and the precompiled blobs
+inline constexpr FT_ShaderLayout FT_RuntimeLayout { 8, 8, 2 };
+inline constexpr FT_ShaderLayout FT_PrecompiledLayout { 512, 1, 1 };
+
+// Thread group counts covering InWidth x InHeight
+inline static void FT_GetDispatchSize(const FT_ShaderLayout& InLayout, uint64_t InWidth, uint32_t InHeight,
+                                      uint32_t& OutGroupsX, uint32_t& OutGroupsY)
+{
+    auto groupWidth = InLayout.NumThreadsX * InLayout.PixelsPerThread;
+    auto groupHeight = InLayout.NumThreadsY * InLayout.PixelsPerThread;
+    OutGroupsX = static_cast<uint32_t>((InWidth + groupWidth - 1) / groupWidth);
+    OutGroupsY = (InHeight + groupHeight - 1) / groupHeight;
+}
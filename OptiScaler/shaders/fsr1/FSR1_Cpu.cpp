@@ -0,0 +1,295 @@
+#include "FSR1_Cpu.h"
+
+#define A_CPU
+#include "ffx_fsr1.h"
+
+static_assert(sizeof(FSR1_Cpu::EasuConstants) == 20 * sizeof(uint32_t));
+static_assert(sizeof(FSR1_Cpu::RcasConstants) == 8 * sizeof(uint32_t));
+
+// Gather4 with a linear clamp sampler, returns the 4 texels in gather order
+//  w z
+//  x y
+static inline void Gather(const CpuTexture& InResource, float u, float v, CpuFloat4 (&OutTexels)[4])
+{
+    auto x0 = (int64_t) std::floor(u * InResource.Width - 0.5f);
+    auto y0 = (int64_t) std::floor(v * InResource.Height - 0.5f);
+
+    OutTexels[0] = CpuLoadClamped(InResource, x0, y0 + 1);
+    OutTexels[1] = CpuLoadClamped(InResource, x0 + 1, y0 + 1);
+    OutTexels[2] = CpuLoadClamped(InResource, x0 + 1, y0);
+    OutTexels[3] = CpuLoadClamped(InResource, x0, y0);
+}
+
+// Luma times 2
+static inline float Luma2(const CpuFloat4& c) { return c.Z() * 0.5f + (c.X() * 0.5f + c.Y()); }
+
+static inline void EasuSet(float& dirX, float& dirY, float& len, float w, float lA, float lB, float lC, float lD,
+                           float lE)
+{
+    float dc = lD - lC;
+    float cb = lC - lB;
+    float lenX = FSR1_Cpu::APrxLoRcp(std::max(std::abs(dc), std::abs(cb)));
+    float dX = lD - lB;
+    dirX += dX * w;
+    lenX = CpuSaturate(std::abs(dX) * lenX);
+    len += lenX * lenX * w;
+
+    float ec = lE - lC;
+    float ca = lC - lA;
+    float lenY = FSR1_Cpu::APrxLoRcp(std::max(std::abs(ec), std::abs(ca)));
+    float dY = lE - lA;
+    dirY += dY * w;
+    lenY = CpuSaturate(std::abs(dY) * lenY);
+    len += lenY * lenY * w;
+}
+
+static inline void EasuTap(CpuFloat4& aC, float& aW, float offX, float offY, float dirX, float dirY, float lenX,
+                           float lenY, float lob, float clp, const CpuFloat4& c)
+{
+    float vX = ((offX * dirX) + (offY * dirY)) * lenX;
+    float vY = ((offX * -dirY) + (offY * dirX)) * lenY;
+
+    float d2 = std::min(vX * vX + vY * vY, clp);
+
+    float wB = (2.0f / 5.0f) * d2 - 1.0f;
+    float wA = lob * d2 - 1.0f;
+    wB *= wB;
+    wA *= wA;
+    wB = (25.0f / 16.0f) * wB - (25.0f / 16.0f - 1.0f);
+
+    float w = wB * wA;
+    aC += c * w;
+    aW += w;
+}
+
+FSR1_Cpu::EasuConstants FSR1_Cpu::EasuCon(float InViewportWidth, float InViewportHeight, float InInputWidth,
+                                          float InInputHeight, float InOutputWidth, float InOutputHeight)
+{
+    EasuConstants constants {};
+    FsrEasuCon(constants.const0, constants.const1, constants.const2, constants.const3, InViewportWidth,
+               InViewportHeight, InInputWidth, InInputHeight, InOutputWidth, InOutputHeight);
+    return constants;
+}
+
+FSR1_Cpu::RcasConstants FSR1_Cpu::RcasCon(float InSharpnessStops)
+{
+    RcasConstants constants {};
+    FsrRcasCon(constants.const0, InSharpnessStops);
+    return constants;
+}
+
+bool FSR1_Cpu::InsideRadius(const uint32_t* InCentre, uint32_t InSquaredRadius, uint32_t InGroupX, uint32_t InGroupY)
+{
+    uint32_t dcX = InCentre[0] - ((InGroupX << 4u) + 8u);
+    uint32_t dcY = InCentre[1] - ((InGroupY << 4u) + 8u);
+    return dcX * dcX + dcY * dcY <= InSquaredRadius;
+}
+
+CpuFloat4 FSR1_Cpu::BilinearPixel(const CpuTexture& InResource, const EasuConstants& InConstants, uint32_t x,
+                                  uint32_t y)
+{
+    const auto& con0 = InConstants.const0;
+    const auto& con1 = InConstants.const1;
+
+    float u = CpuAsFloat(con1[0]) * (x * CpuAsFloat(con0[0]) + CpuAsFloat(con0[2]) + 0.5f);
+    float v = CpuAsFloat(con1[1]) * (y * CpuAsFloat(con0[1]) + CpuAsFloat(con0[3]) + 0.5f);
+
+    auto c = CpuSampleLinearClamp(InResource, u, v);
+    return CpuFloat4::Set(c.X(), c.Y(), c.Z(), 1.0f);
+}
+
+CpuFloat4 FSR1_Cpu::EasuPixel(const CpuTexture& InResource, const EasuConstants& InConstants, uint32_t x, uint32_t y)
+{
+    const auto& con0 = InConstants.const0;
+    const auto& con1 = InConstants.const1;
+    const auto& con2 = InConstants.const2;
+    const auto& con3 = InConstants.const3;
+
+    // Get position of 'f'
+    float ppX = x * CpuAsFloat(con0[0]) + CpuAsFloat(con0[2]);
+    float ppY = y * CpuAsFloat(con0[1]) + CpuAsFloat(con0[3]);
+    float fpX = std::floor(ppX);
+    float fpY = std::floor(ppY);
+    ppX -= fpX;
+    ppY -= fpY;
+
+    // 12-tap kernel
+    //    b c
+    //  e f g h
+    //  i j k l
+    //    n o
+    float p0X = fpX * CpuAsFloat(con1[0]) + CpuAsFloat(con1[2]);
+    float p0Y = fpY * CpuAsFloat(con1[1]) + CpuAsFloat(con1[3]);
+
+    CpuFloat4 bczz[4], ijfe[4], klhg[4], zzon[4];
+    Gather(InResource, p0X, p0Y, bczz);
+    Gather(InResource, p0X + CpuAsFloat(con2[0]), p0Y + CpuAsFloat(con2[1]), ijfe);
+    Gather(InResource, p0X + CpuAsFloat(con2[2]), p0Y + CpuAsFloat(con2[3]), klhg);
+    Gather(InResource, p0X + CpuAsFloat(con3[0]), p0Y + CpuAsFloat(con3[1]), zzon);
+
+    const auto& b = bczz[0];
+    const auto& c = bczz[1];
+    const auto& i = ijfe[0];
+    const auto& j = ijfe[1];
+    const auto& f = ijfe[2];
+    const auto& e = ijfe[3];
+    const auto& k = klhg[0];
+    const auto& l = klhg[1];
+    const auto& h = klhg[2];
+    const auto& g = klhg[3];
+    const auto& o = zzon[2];
+    const auto& n = zzon[3];
+
+    float bL = Luma2(b), cL = Luma2(c), iL = Luma2(i), jL = Luma2(j), fL = Luma2(f), eL = Luma2(e);
+    float kL = Luma2(k), lL = Luma2(l), hL = Luma2(h), gL = Luma2(g), oL = Luma2(o), nL = Luma2(n);
+
+    // Accumulate for bilinear interpolation
+    float dirX = 0.0f;
+    float dirY = 0.0f;
+    float len = 0.0f;
+    EasuSet(dirX, dirY, len, (1.0f - ppX) * (1.0f - ppY), bL, eL, fL, gL, jL);
+    EasuSet(dirX, dirY, len, ppX * (1.0f - ppY), cL, fL, gL, hL, kL);
+    EasuSet(dirX, dirY, len, (1.0f - ppX) * ppY, fL, iL, jL, kL, nL);
+    EasuSet(dirX, dirY, len, ppX * ppY, gL, jL, kL, lL, oL);
+
+    // Normalize with approximation, and cleanup close to zero
+    float dirR = dirX * dirX + dirY * dirY;
+    bool zro = dirR < (1.0f / 32768.0f);
+    dirR = zro ? 1.0f : APrxLoRsq(dirR);
+    dirX = zro ? 1.0f : dirX;
+    dirX *= dirR;
+    dirY *= dirR;
+
+    // Transform from {0 to 2} to {0 to 1} range, and shape with square
+    len = len * 0.5f;
+    len *= len;
+
+    // Stretch kernel {1.0 vert|horz, to sqrt(2.0) on diagonal}
+    float stretch = (dirX * dirX + dirY * dirY) * APrxLoRcp(std::max(std::abs(dirX), std::abs(dirY)));
+    float len2X = 1.0f + (stretch - 1.0f) * len;
+    float len2Y = 1.0f - 0.5f * len;
+    float lob = 0.5f + ((1.0f / 4.0f - 0.04f) - 0.5f) * len;
+    float clp = APrxLoRcp(lob);
+
+    // Min/max of 4 nearest
+    auto min4 = CpuFloat4::Min(CpuFloat4::Min(f, g), CpuFloat4::Min(j, k));
+    auto max4 = CpuFloat4::Max(CpuFloat4::Max(f, g), CpuFloat4::Max(j, k));
+
+    auto aC = CpuFloat4::Zero();
+    float aW = 0.0f;
+    EasuTap(aC, aW, 0.0f - ppX, -1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, b);
+    EasuTap(aC, aW, 1.0f - ppX, -1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, c);
+    EasuTap(aC, aW, -1.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, i);
+    EasuTap(aC, aW, 0.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, j);
+    EasuTap(aC, aW, 0.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, f);
+    EasuTap(aC, aW, -1.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, e);
+    EasuTap(aC, aW, 1.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, k);
+    EasuTap(aC, aW, 2.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, l);
+    EasuTap(aC, aW, 2.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, h);
+    EasuTap(aC, aW, 1.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, g);
+    EasuTap(aC, aW, 1.0f - ppX, 2.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, o);
+    EasuTap(aC, aW, 0.0f - ppX, 2.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, n);
+
+    // Normalize and dering
+    auto pix = CpuFloat4::Min(max4, CpuFloat4::Max(min4, aC * (1.0f / aW)));
+    return CpuFloat4::Set(pix.X(), pix.Y(), pix.Z(), 1.0f);
+}
+
+CpuFloat4 FSR1_Cpu::RcasPixel(const CpuTexture& InResource, const RcasConstants& InConstants, int64_t x, int64_t y)
+{
+    //    b
+    //  d e f
+    //    h
+    auto b = CpuLoad(InResource, x, y - 1);
+    auto d = CpuLoad(InResource, x - 1, y);
+    auto e = CpuLoad(InResource, x, y);
+    auto f = CpuLoad(InResource, x + 1, y);
+    auto h = CpuLoad(InResource, x, y + 1);
+
+    // Min and max of ring
+    auto mn4 = CpuFloat4::Min(CpuFloat4::Min(b, d), CpuFloat4::Min(f, h));
+    auto mx4 = CpuFloat4::Max(CpuFloat4::Max(b, d), CpuFloat4::Max(f, h));
+
+    // Limiters, these need to be high precision RCPs
+    auto hitMin = CpuFloat4::Min(mn4, e) / (mx4 * 4.0f);
+    auto hitMax = (CpuFloat4::Splat(1.0f) - CpuFloat4::Max(mx4, e)) / (mn4 * 4.0f - CpuFloat4::Splat(4.0f));
+    auto lobeRGB = CpuFloat4::Max(CpuFloat4::Zero() - hitMin, hitMax);
+
+    const float rcasLimit = 0.25f - (1.0f / 16.0f);
+    float lobe = std::max(-rcasLimit, std::min(lobeRGB.MaxRGB(), 0.0f)) * CpuAsFloat(InConstants.const0[0]);
+
+    // Resolve, which needs the medium precision rcp approximation to avoid visible tonality changes
+    float rcpL = APrxMedRcp(4.0f * lobe + 1.0f);
+    auto pix = ((b + d + h + f) * lobe + e) * rcpL;
+
+    return CpuFloat4::Set(pix.X(), pix.Y(), pix.Z(), 1.0f);
+}
+
+bool FSR1_Cpu::DispatchEasu(const CpuTexture& InResource, const EasuConstants& InConstants, CpuTexture& OutResource,
+                            uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    const int64_t offsetX = (int32_t) InConstants.const3[2];
+    const int64_t offsetY = (int32_t) InConstants.const3[3];
+
+    CpuDispatchTiles(
+        OutResource.Width, OutResource.Height, BlockSize, BlockSize,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            bool easu = InsideRadius(InConstants.projCentre, InConstants.squaredRadius, x0 / BlockSize,
+                                     y0 / BlockSize);
+
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    auto pix = easu ? EasuPixel(InResource, InConstants, x, y)
+                                    : BilinearPixel(InResource, InConstants, x, y);
+
+                    CpuStore(OutResource, x + offsetX, y + offsetY, pix);
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
+
+bool FSR1_Cpu::DispatchRcas(const CpuTexture& InResource, const RcasConstants& InConstants, CpuTexture& OutResource,
+                            uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    const int64_t offsetX = (int32_t) InConstants.const0[2];
+    const int64_t offsetY = (int32_t) InConstants.const0[3];
+    const float debugMul = 1.0f - InConstants.debugMode * 0.3f;
+
+    CpuDispatchTiles(
+        OutResource.Width, OutResource.Height, BlockSize, BlockSize,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            bool sharpen = InsideRadius(InConstants.projCentre, InConstants.squaredRadius, x0 / BlockSize,
+                                        y0 / BlockSize);
+
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    int64_t px = x + offsetX;
+                    int64_t py = y + offsetY;
+
+                    if (sharpen)
+                        CpuStore(OutResource, px, py, RcasPixel(InResource, InConstants, px, py));
+                    else
+                        CpuStore(OutResource, px, py,
+                                 CpuLoad(InResource, px, py) * CpuFloat4::Set(1.0f, debugMul, debugMul, 1.0f));
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of fsr_easu.hlsl and fsr_rcas.hlsl (32-bit paths of ffx_fsr1.h)
+class FSR1_Cpu
+{
+  public:
+    // Same layout as UpscaleShaderConstants
+    struct EasuConstants
+    {
+        uint32_t const0[4];
+        uint32_t const1[4];
+        uint32_t const2[4];
+        uint32_t const3[4]; // store output offset in final 2
+        uint32_t projCentre[2];
+        uint32_t squaredRadius;
+        uint32_t _padding;
+    };
+
+    // Same layout as SharpenShaderConstants
+    struct RcasConstants
+    {
+        uint32_t const0[4]; // store output offset in final 2
+        uint32_t projCentre[2];
+        uint32_t squaredRadius;
+        uint32_t debugMode;
+    };
+
+    // 64 threads, each one writes 4 pixels of a 16x16 block
+    static constexpr uint32_t BlockSize = 16;
+
+    // Wrappers of FsrEasuCon & FsrRcasCon
+    static EasuConstants EasuCon(float InViewportWidth, float InViewportHeight, float InInputWidth,
+                                 float InInputHeight, float InOutputWidth, float InOutputHeight);
+    static RcasConstants RcasCon(float InSharpnessStops);
+
+    // Dispatch area is the size of OutResource
+    static bool DispatchEasu(const CpuTexture& InResource, const EasuConstants& InConstants, CpuTexture& OutResource,
+                             uint32_t InThreadCount = 0);
+    static bool DispatchRcas(const CpuTexture& InResource, const RcasConstants& InConstants, CpuTexture& OutResource,
+                             uint32_t InThreadCount = 0);
+
+    static CpuFloat4 EasuPixel(const CpuTexture& InResource, const EasuConstants& InConstants, uint32_t x, uint32_t y);
+    static CpuFloat4 BilinearPixel(const CpuTexture& InResource, const EasuConstants& InConstants, uint32_t x,
+                                   uint32_t y);
+    static CpuFloat4 RcasPixel(const CpuTexture& InResource, const RcasConstants& InConstants, int64_t x, int64_t y);
+
+    // Approximations from ffx_a.h, needed to get bit exact-ish results
+    static float APrxLoRcp(float a) { return CpuAsFloat(0x7ef07ebbu - CpuAsUint(a)); }
+    static float APrxMedRcp(float a)
+    {
+        float b = CpuAsFloat(0x7ef19fffu - CpuAsUint(a));
+        return b * (-b * a + 2.0f);
+    }
+    static float APrxLoRsq(float a) { return CpuAsFloat(0x5f347d74u - (CpuAsUint(a) >> 1)); }
+
+  private:
+    // Group radius test of the shaders, done with uint math like on the gpu
+    static bool InsideRadius(const uint32_t* InCentre, uint32_t InSquaredRadius, uint32_t InGroupX, uint32_t InGroupY);
+};
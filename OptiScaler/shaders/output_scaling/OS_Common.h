@@ -10,6 +10,20 @@ struct alignas(256) Constants
     int32_t destHeight;
 };
 
+// Separable Lanczos / Catmull-Rom, one instance per pass
+struct alignas(256) SeparableConstants
+{
+    int32_t srcWidth;
+    int32_t srcHeight;
+    int32_t destWidth;
+    int32_t destHeight;
+    float scale;      // source pixels per destination pixel on the filtered axis
+    int32_t taps;     // multiple of 4
+    int32_t useCache; // group's source span fits in groupshared memory
+    int32_t padding;
+    float weights[64 * 24]; // 64 phases, 24 taps max
+};
+
 // Lanczos with luminance correction
 inline static std::string downsampleCodeLanczos = R"(
 cbuffer Params : register(b0) 
@@ -433,6 +447,140 @@ void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
 }
 )";
 
+// Separable Lanczos / Catmull-Rom with per phase weight tables
+// CSHorizontal filters source rows into an intermediate texture (DstWidth x SrcHeight), CSVertical filters its columns
+inline static std::string downsampleCodeSeparable = R"(
+cbuffer Params : register(b0)
+{
+    int _SrcWidth;    // Source texture width
+    int _SrcHeight;   // Source texture height
+    int _DstWidth;    // Destination texture width
+    int _DstHeight;   // Destination texture height
+    float _Scale;     // Source pixels per destination pixel on the filtered axis
+    int _Taps;        // Taps per output pixel, multiple of 4
+    int _UseCache;    // Source span of the group fits in groupshared memory
+    int _Padding;
+    float4 _Weights[64 * 6]; // 64 phases, 24 taps max, normalized on cpu
+};
+
+Texture2D<float4> InputTexture : register(t0);
+RWTexture2D<float4> OutputTexture : register(u0);
+
+#define GROUP_SIZE 64
+#define GROUP_LINES 4
+#define CACHE_SIZE 320
+#define PHASES 64
+#define WEIGHT_VECTORS 6
+
+// Source texels of each line handled by the group
+groupshared float4 g_Cache[GROUP_LINES][CACHE_SIZE];
+
+float luminance(float3 color)
+{
+    return dot(color, float3(0.2126, 0.7152, 0.0722));
+}
+
+float4 FetchSource(int pos, int lineIndex, bool vertical)
+{
+    if (vertical)
+        return InputTexture.Load(int3(lineIndex, clamp(pos, 0, _SrcHeight - 1), 0));
+
+    return InputTexture.Load(int3(clamp(pos, 0, _SrcWidth - 1), lineIndex, 0));
+}
+
+float4 Tap(int pos, int lineIndex, uint localLine, int cacheStart, bool vertical)
+{
+    if (_UseCache > 0)
+        return g_Cache[localLine][pos - cacheStart];
+
+    return FetchSource(pos, lineIndex, vertical);
+}
+
+// Scale the color to match the average luminance if it deviates too much
+float4 CorrectLuminance(float4 color, float avgLuminance)
+{
+    float currentLuminance = luminance(color.rgb);
+
+    if (abs(currentLuminance - avgLuminance) > 0.5)
+        color.rgb *= avgLuminance / max(currentLuminance, 1e-5);
+
+    return color;
+}
+
+int FirstTap(float pos)
+{
+    return int(floor((pos + 0.5) * _Scale - 0.5)) - _Taps / 2 + 1;
+}
+
+int FillCache(uint groupStart, uint threadIndex, int lineIndex, uint localLine, bool vertical)
+{
+    int cacheStart = FirstTap(groupStart);
+
+    if (_UseCache > 0)
+    {
+        int span = min(int(ceil(GROUP_SIZE * _Scale)) + _Taps + 1, CACHE_SIZE);
+
+        for (int i = int(threadIndex); i < span; i += GROUP_SIZE)
+            g_Cache[localLine][i] = FetchSource(cacheStart + i, lineIndex, vertical);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    return cacheStart;
+}
+
+float4 Filter(uint outPos, int lineIndex, uint localLine, int cacheStart, bool vertical)
+{
+    float centre = (outPos + 0.5) * _Scale - 0.5;
+    int first = FirstTap(outPos);
+    uint phase = min(uint(frac(centre) * PHASES), (uint)(PHASES - 1));
+
+    // Luminance estimate from the 4 taps closest to the centre, reused for the whole kernel
+    float avgLuminance = 0.0;
+
+    for (int n = _Taps / 2 - 2; n <= _Taps / 2 + 1; n++)
+        avgLuminance += luminance(Tap(first + n, lineIndex, localLine, cacheStart, vertical).rgb);
+
+    avgLuminance *= 0.25;
+
+    float4 color = 0.0;
+
+    for (int i = 0; i < _Taps; i += 4)
+    {
+        float4 w = _Weights[phase * WEIGHT_VECTORS + i / 4];
+
+        color += CorrectLuminance(Tap(first + i, lineIndex, localLine, cacheStart, vertical), avgLuminance) * w.x;
+        color += CorrectLuminance(Tap(first + i + 1, lineIndex, localLine, cacheStart, vertical), avgLuminance) * w.y;
+        color += CorrectLuminance(Tap(first + i + 2, lineIndex, localLine, cacheStart, vertical), avgLuminance) * w.z;
+        color += CorrectLuminance(Tap(first + i + 3, lineIndex, localLine, cacheStart, vertical), avgLuminance) * w.w;
+    }
+
+    return color;
+}
+
+[numthreads(GROUP_SIZE, GROUP_LINES, 1)]
+void CSHorizontal(uint3 DTid : SV_DispatchThreadID, uint3 GTid : SV_GroupThreadID, uint3 Gid : SV_GroupID)
+{
+    int cacheStart = FillCache(Gid.x * GROUP_SIZE, GTid.x, DTid.y, GTid.y, false);
+
+    if (DTid.x >= (uint)_DstWidth || DTid.y >= (uint)_SrcHeight)
+        return;
+
+    OutputTexture[DTid.xy] = Filter(DTid.x, DTid.y, GTid.y, cacheStart, false);
+}
+
+[numthreads(GROUP_LINES, GROUP_SIZE, 1)]
+void CSVertical(uint3 DTid : SV_DispatchThreadID, uint3 GTid : SV_GroupThreadID, uint3 Gid : SV_GroupID)
+{
+    int cacheStart = FillCache(Gid.y * GROUP_SIZE, GTid.y, DTid.x, GTid.x, true);
+
+    if (DTid.x >= (uint)_DstWidth || DTid.y >= (uint)_DstHeight)
+        return;
+
+    OutputTexture[DTid.xy] = Filter(DTid.y, DTid.x, GTid.x, cacheStart, true);
+}
+)";
+
 inline static std::string upsampleCode = R"(
 //
 // Copyright (c) Microsoft. All rights reserved.
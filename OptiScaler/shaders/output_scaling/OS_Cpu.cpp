@@ -0,0 +1,437 @@
+#include "OS_Cpu.h"
+
+#include <array>
+#include <memory>
+
+static inline float Luminance(const CpuFloat4& color)
+{
+    return color.X() * 0.2126f + color.Y() * 0.7152f + color.Z() * 0.0722f;
+}
+
+// Scale the color to match the average luminance if it deviates too much, same as the shaders
+static inline CpuFloat4 LuminanceCorrect(const CpuFloat4& color, float avgLuminance)
+{
+    float currentLuminance = Luminance(color);
+
+    if (std::abs(currentLuminance - avgLuminance) <= 0.5f)
+        return color;
+
+    float luminanceScale = avgLuminance / std::max(currentLuminance, 1e-5f);
+    return color * CpuFloat4::Set(luminanceScale, luminanceScale, luminanceScale, 1.0f);
+}
+
+// Average luminance of the clamped 4x4 neighborhood
+static inline float AverageLuminance(const CpuTexture& InResource, const OS_Cpu::Constants& InConstants, float baseX,
+                                     float baseY)
+{
+    float avgLuminance = 0.0f;
+
+    for (int dy = -1; dy <= 2; dy++)
+    {
+        for (int dx = -1; dx <= 2; dx++)
+        {
+            auto sx = std::clamp<int64_t>((int64_t) (baseX + dx), 0, InConstants.srcWidth - 1);
+            auto sy = std::clamp<int64_t>((int64_t) (baseY + dy), 0, InConstants.srcHeight - 1);
+            avgLuminance += Luminance(CpuLoad(InResource, sx, sy));
+        }
+    }
+
+    return avgLuminance / 16.0f;
+}
+
+float OS_Cpu::LanczosKernel(float x, float radius)
+{
+    const float pi = 3.14159265359f;
+
+    if (x == 0.0f)
+        return 1.0f;
+
+    if (x > radius)
+        return 0.0f;
+
+    x *= pi;
+    return (std::sin(x) / x) * (std::sin(x / radius) / (x / radius));
+}
+
+float OS_Cpu::CatmullRomKernel(float x)
+{
+    x = std::abs(x);
+
+    if (x < 1.0f)
+        return (1.5f * x - 2.5f) * x * x + 1.0f;
+
+    if (x < 2.0f)
+        return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+
+    return 0.0f;
+}
+
+float OS_Cpu::MagcKernel(float x)
+{
+    x = std::abs(x);
+
+    if (x <= 1.0f)
+        return 1.0f - 2.0f * x * x + x * x * x;
+
+    if (x <= 2.0f)
+        return 4.0f - 8.0f * x + 5.0f * x * x - x * x * x;
+
+    return 0.0f;
+}
+
+float OS_Cpu::BicubicKernel(float x)
+{
+    const float a = -0.75f;
+    float absX = std::abs(x);
+
+    if (absX <= 1.0f)
+        return (a + 2.0f) * absX * absX * absX - (a + 3.0f) * absX * absX + 1.0f;
+
+    if (absX < 2.0f)
+        return a * absX * absX * absX - 5.0f * a * absX * absX + 8.0f * a * absX - 4.0f * a;
+
+    return 0.0f;
+}
+
+const float* OS_Cpu::UpsampleWeights(float InPhase)
+{
+    static const auto table = []()
+    {
+        const float A = -0.5f;
+        auto w1 = [A](float x) { return x * x * ((A + 2) * x - (A + 3)) + 1.0f; };
+        auto w2 = [A](float x) { return A * (x * (x * (x - 5) + 8) - 4); };
+
+        std::array<std::array<float, 4>, 16> weights {};
+
+        for (int i = 0; i < 16; i++)
+        {
+            float d1 = (i + 0.5f) / 16.0f;
+            weights[i] = { w2(1.0f + d1), w1(d1), w1(1.0f - d1), w2(2.0f - d1) };
+        }
+
+        return weights;
+    }();
+
+    auto index = std::min((uint32_t) (InPhase * 16.0f), 15u);
+    return table[index].data();
+}
+
+CpuFloat4 OS_Cpu::Lanczos(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y)
+{
+    const float lanczosRadius = 3.0f;
+
+    float scaleX = (float) InConstants.srcWidth / (float) InConstants.destWidth;
+    float scaleY = (float) InConstants.srcHeight / (float) InConstants.destHeight;
+    float sourceX = x * scaleX;
+    float sourceY = y * scaleY;
+
+    float avgLuminance = AverageLuminance(InResource, InConstants, sourceX, sourceY);
+
+    auto color = CpuFloat4::Zero();
+    float totalWeight = 0.0f;
+
+    for (int oy = -3; oy <= 3; oy++)
+    {
+        float sampleY = std::clamp(sourceY + oy, 0.0f, (float) (InConstants.srcHeight - 1));
+        float kernelY = LanczosKernel(std::abs(sampleY - sourceY), lanczosRadius);
+
+        for (int ox = -3; ox <= 3; ox++)
+        {
+            float sampleX = std::clamp(sourceX + ox, 0.0f, (float) (InConstants.srcWidth - 1));
+
+            auto sampleColor = CpuLoad(InResource, (int64_t) sampleX, (int64_t) sampleY);
+            sampleColor = LuminanceCorrect(sampleColor, avgLuminance);
+
+            // Shader stores the scalar product in a float2 and multiplies .x by .y, so weight ends up squared
+            float weight = LanczosKernel(std::abs(sampleX - sourceX), lanczosRadius) * kernelY;
+            weight *= weight;
+
+            color += sampleColor * weight;
+            totalWeight += weight;
+        }
+    }
+
+    return color * (1.0f / totalWeight);
+}
+
+CpuFloat4 OS_Cpu::Separable4x4(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y,
+                               float (*InKernel)(float))
+{
+    float scaleX = (float) InConstants.srcWidth / (float) InConstants.destWidth;
+    float scaleY = (float) InConstants.srcHeight / (float) InConstants.destHeight;
+    float sourceX = x * scaleX;
+    float sourceY = y * scaleY;
+
+    auto baseX = (int64_t) sourceX;
+    auto baseY = (int64_t) sourceY;
+    float fractionX = CpuFrac(sourceX);
+    float fractionY = CpuFrac(sourceY);
+
+    float avgLuminance = AverageLuminance(InResource, InConstants, (float) baseX, (float) baseY);
+
+    float weightsX[4];
+    float weightsY[4];
+
+    for (int i = 0; i < 4; i++)
+    {
+        weightsX[i] = InKernel((float) (i - 1) - fractionX);
+        weightsY[i] = InKernel((float) (i - 1) - fractionY);
+    }
+
+    auto color = CpuFloat4::Zero();
+    float totalWeight = 0.0f;
+
+    for (int dy = -1; dy <= 2; dy++)
+    {
+        auto sy = std::clamp<int64_t>(baseY + dy, 0, InConstants.srcHeight - 1);
+
+        for (int dx = -1; dx <= 2; dx++)
+        {
+            auto sx = std::clamp<int64_t>(baseX + dx, 0, InConstants.srcWidth - 1);
+            auto sampleColor = LuminanceCorrect(CpuLoad(InResource, sx, sy), avgLuminance);
+
+            float weight = weightsX[dx + 1] * weightsY[dy + 1];
+            color += sampleColor * weight;
+            totalWeight += weight;
+        }
+    }
+
+    return color * (1.0f / totalWeight);
+}
+
+CpuFloat4 OS_Cpu::Bicubic(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y)
+{
+    float pixelX = (x / (InConstants.destWidth - 1.0f)) * InConstants.srcWidth;
+    float pixelY = (y / (InConstants.destHeight - 1.0f)) * InConstants.srcHeight;
+    float texelX = std::floor(pixelX);
+    float texelY = std::floor(pixelY);
+
+    float tx = pixelX - texelX;
+    float ty = pixelY - texelY;
+    tx = tx * tx * (3.0f - 2.0f * tx);
+    ty = ty * ty * (3.0f - 2.0f * ty);
+
+    // No clamping here, out of bounds loads return 0 like on the gpu
+    float avgLuminance = 0.0f;
+
+    for (int dy = -1; dy <= 2; dy++)
+    {
+        for (int dx = -1; dx <= 2; dx++)
+            avgLuminance += Luminance(CpuLoad(InResource, (int64_t) (texelX + dx), (int64_t) (texelY + dy)));
+    }
+
+    avgLuminance /= 16.0f;
+
+    auto result = CpuFloat4::Zero();
+
+    for (int dy = -1; dy <= 2; dy++)
+    {
+        float weightY = BicubicKernel(dy - ty);
+
+        for (int dx = -1; dx <= 2; dx++)
+        {
+            auto color = CpuLoad(InResource, (int64_t) (texelX + dx), (int64_t) (texelY + dy));
+            color = LuminanceCorrect(color, avgLuminance);
+            result += color * (BicubicKernel(dx - tx) * weightY);
+        }
+    }
+
+    return result;
+}
+
+// Separable math of upsampleCode without the LDS tiling
+CpuFloat4 OS_Cpu::Upsample(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y)
+{
+    float scaleX = (float) InConstants.srcWidth / (float) InConstants.destWidth;
+    float scaleY = (float) InConstants.srcHeight / (float) InConstants.destHeight;
+
+    float topLeftX = (x + 0.5f) * scaleX - 1.5f;
+    float topLeftY = (y + 0.5f) * scaleY - 1.5f;
+    auto baseX = (int64_t) std::floor(topLeftX);
+    auto baseY = (int64_t) std::floor(topLeftY);
+
+    auto xWeights = UpsampleWeights(CpuFrac(topLeftX));
+    auto yWeights = UpsampleWeights(CpuFrac(topLeftY));
+
+    auto result = CpuFloat4::Zero();
+
+    for (int j = 0; j < 4; j++)
+    {
+        auto row = CpuFloat4::Zero();
+
+        for (int i = 0; i < 4; i++)
+            row += CpuLoad(InResource, baseX + i, baseY + j) * xWeights[i];
+
+        result += row * yWeights[j];
+    }
+
+    return result;
+}
+
+void OS_Cpu::BuildSeparableAxis(Kernel InKernel, uint32_t InSrcSize, uint32_t InDstSize, SeparableAxis& OutAxis)
+{
+    const bool lanczos = InKernel != Kernel::SeparableCatmullRom;
+    const float radius = lanczos ? 3.0f : 2.0f;
+
+    OutAxis.Scale = (float) InSrcSize / (float) std::max(InDstSize, 1u);
+
+    // Kernel is widened by the scale when downsampling, limited by what the table can hold
+    float filterScale = std::clamp(OutAxis.Scale, 1.0f, (SeparableMaxTaps / 2) / radius);
+    uint32_t taps = 2 * (uint32_t) std::ceil(radius * filterScale);
+
+    OutAxis.Taps = std::min((taps + 3) & ~3u, SeparableMaxTaps);
+    OutAxis.UseCache =
+        (uint32_t) std::ceil(SeparableGroupSize * OutAxis.Scale) + OutAxis.Taps + 1 <= SeparableCacheSize;
+
+    for (uint32_t p = 0; p < SeparablePhases; p++)
+    {
+        float phase = (p + 0.5f) / SeparablePhases;
+        float total = 0.0f;
+
+        for (uint32_t i = 0; i < SeparableMaxTaps; i++)
+        {
+            float weight = 0.0f;
+
+            if (i < OutAxis.Taps)
+            {
+                // Distance of the tap (first + i) from the sample centre in kernel space
+                float distance = std::abs(((float) i - (float) (OutAxis.Taps / 2 - 1) - phase) / filterScale);
+                weight = lanczos ? LanczosKernel(distance, radius) : CatmullRomKernel(distance);
+            }
+
+            OutAxis.Weights[p][i] = weight;
+            total += weight;
+        }
+
+        if (total == 0.0f)
+            continue;
+
+        for (uint32_t i = 0; i < OutAxis.Taps; i++)
+            OutAxis.Weights[p][i] /= total;
+    }
+}
+
+void OS_Cpu::SeparablePass(const CpuTexture& InResource, const SeparableAxis& InAxis, bool InVertical,
+                           uint32_t InSrcSize, uint32_t InWidth, uint32_t InHeight, CpuTexture& OutResource,
+                           uint32_t InThreadCount)
+{
+    const int64_t taps = InAxis.Taps;
+
+    auto fetch = [&](int64_t pos, uint32_t line)
+    {
+        pos = std::clamp<int64_t>(pos, 0, (int64_t) InSrcSize - 1);
+        return InVertical ? CpuLoad(InResource, line, pos) : CpuLoad(InResource, pos, line);
+    };
+
+    auto filter = [&](uint32_t outPos, uint32_t line)
+    {
+        float centre = (outPos + 0.5f) * InAxis.Scale - 0.5f;
+        int64_t first = (int64_t) std::floor(centre) - taps / 2 + 1;
+        auto phase = std::min((uint32_t) (CpuFrac(centre) * SeparablePhases), SeparablePhases - 1);
+
+        // Luminance estimate from the 4 taps closest to the centre
+        float avgLuminance = 0.0f;
+
+        for (int64_t n = taps / 2 - 2; n <= taps / 2 + 1; n++)
+            avgLuminance += Luminance(fetch(first + n, line));
+
+        avgLuminance *= 0.25f;
+
+        auto color = CpuFloat4::Zero();
+
+        for (int64_t i = 0; i < taps; i++)
+            color += LuminanceCorrect(fetch(first + i, line), avgLuminance) * InAxis.Weights[phase][i];
+
+        return color;
+    };
+
+    const uint32_t tileWidth = InVertical ? SeparableGroupLines : SeparableGroupSize;
+    const uint32_t tileHeight = InVertical ? SeparableGroupSize : SeparableGroupLines;
+
+    CpuDispatchTiles(
+        InWidth, InHeight, tileWidth, tileHeight,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                    CpuStore(OutResource, x, y, InVertical ? filter(y, x) : filter(x, y));
+            }
+        },
+        InThreadCount);
+}
+
+bool OS_Cpu::Dispatch(const CpuTexture& InResource, Kernel InKernel, Constants InConstants, CpuTexture& OutResource,
+                      uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    if (InConstants.srcWidth <= 0 || InConstants.srcHeight <= 0)
+    {
+        InConstants.srcWidth = InResource.Width;
+        InConstants.srcHeight = InResource.Height;
+    }
+
+    if (InConstants.destWidth <= 0 || InConstants.destHeight <= 0)
+    {
+        InConstants.destWidth = OutResource.Width;
+        InConstants.destHeight = OutResource.Height;
+    }
+
+    // Horizontal pass into an intermediate texture, then vertical pass into the output.
+    // Gpu keeps the intermediate in R16G16B16A16_FLOAT so results differ by half precision rounding.
+    if (IsSeparable(InKernel))
+    {
+        auto axisX = std::make_unique<SeparableAxis>();
+        auto axisY = std::make_unique<SeparableAxis>();
+        BuildSeparableAxis(InKernel, InConstants.srcWidth, InConstants.destWidth, *axisX);
+        BuildSeparableAxis(InKernel, InConstants.srcHeight, InConstants.destHeight, *axisY);
+
+        CpuTexture intermediate(InConstants.destWidth, InConstants.srcHeight, 4);
+        SeparablePass(InResource, *axisX, false, InConstants.srcWidth, InConstants.destWidth, InConstants.srcHeight,
+                      intermediate, InThreadCount);
+        SeparablePass(intermediate, *axisY, true, InConstants.srcHeight, InConstants.destWidth,
+                      InConstants.destHeight, OutResource, InThreadCount);
+
+        return true;
+    }
+
+    CpuDispatchTiles(
+        InConstants.destWidth, InConstants.destHeight, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    switch (InKernel)
+                    {
+                    case Kernel::Lanczos:
+                        CpuStore(OutResource, x, y, Lanczos(InResource, InConstants, x, y));
+                        break;
+
+                    case Kernel::CatmullRom:
+                        CpuStore(OutResource, x, y, Separable4x4(InResource, InConstants, x, y, CatmullRomKernel));
+                        break;
+
+                    case Kernel::Magc:
+                        CpuStore(OutResource, x, y, Separable4x4(InResource, InConstants, x, y, MagcKernel));
+                        break;
+
+                    case Kernel::Upsample:
+                        // float3 UAV, alpha is not written
+                        CpuStore(OutResource, x, y, Upsample(InResource, InConstants, x, y), 3);
+                        break;
+
+                    default:
+                        CpuStore(OutResource, x, y, Bicubic(InResource, InConstants, x, y));
+                        break;
+                    }
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of the output scaling shaders (OS_Common.h)
+class OS_Cpu
+{
+  public:
+    // Values match OutputScalingDownscaler, Upsample is the shader OS_Dx12 uses when upsampling
+    enum class Kernel : int32_t
+    {
+        Bicubic = 0,
+        Lanczos = 1,
+        CatmullRom = 2,
+        Magc = 3,
+        SeparableLanczos = 4,
+        SeparableCatmullRom = 5,
+        Upsample = 100,
+    };
+
+    // Same as the shader cbuffer, 0 means size of the bound texture
+    struct Constants
+    {
+        int32_t srcWidth = 0;
+        int32_t srcHeight = 0;
+        int32_t destWidth = 0;
+        int32_t destHeight = 0;
+    };
+
+    // Per phase weight table of one axis of the separable modes, also used to fill SeparableConstants on gpu
+    static constexpr uint32_t SeparablePhases = 64;
+    static constexpr uint32_t SeparableMaxTaps = 24;
+    static constexpr uint32_t SeparableGroupSize = 64;
+    static constexpr uint32_t SeparableGroupLines = 4;
+    static constexpr uint32_t SeparableCacheSize = 320;
+
+    struct SeparableAxis
+    {
+        float Scale = 1.0f; // source pixels per destination pixel
+        uint32_t Taps = 4;  // multiple of 4
+        bool UseCache = true;
+        float Weights[SeparablePhases][SeparableMaxTaps] {};
+    };
+
+    static constexpr uint32_t NumThreadsX = 16;
+    static constexpr uint32_t NumThreadsY = 16;
+
+    static bool IsSeparable(Kernel InKernel)
+    {
+        return InKernel == Kernel::SeparableLanczos || InKernel == Kernel::SeparableCatmullRom;
+    }
+
+    static void BuildSeparableAxis(Kernel InKernel, uint32_t InSrcSize, uint32_t InDstSize, SeparableAxis& OutAxis);
+
+    // OutResource must be allocated with the output size
+    static bool Dispatch(const CpuTexture& InResource, Kernel InKernel, Constants InConstants, CpuTexture& OutResource,
+                         uint32_t InThreadCount = 0);
+
+    static float LanczosKernel(float x, float radius);
+    static float CatmullRomKernel(float x);
+    static float MagcKernel(float x);
+    static float BicubicKernel(float x);
+
+    // 16 phase weight table of the upsample shader (A = -0.5)
+    static const float* UpsampleWeights(float InPhase);
+
+  private:
+    static CpuFloat4 Lanczos(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y);
+    static CpuFloat4 Separable4x4(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y,
+                                  float (*InKernel)(float));
+    static CpuFloat4 Bicubic(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y);
+    static CpuFloat4 Upsample(const CpuTexture& InResource, const Constants& InConstants, uint32_t x, uint32_t y);
+
+    // One pass of downsampleCodeSeparable, InVertical selects CSVertical
+    static void SeparablePass(const CpuTexture& InResource, const SeparableAxis& InAxis, bool InVertical,
+                              uint32_t InSrcSize, uint32_t InWidth, uint32_t InHeight, CpuTexture& OutResource,
+                              uint32_t InThreadCount);
+};
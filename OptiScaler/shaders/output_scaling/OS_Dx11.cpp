@@ -243,6 +243,16 @@ OS_Dx11::OS_Dx11(std::string InName, ID3D11Device* InDevice, bool InUpsample)
 
     LOG_DEBUG("{0} start!", _name);
 
+    auto downscaler = Config::Instance()->OutputScalingDownscaler.value_or_default();
+
+    // Separable versions are Dx12 only, use the 2D version of the same filter
+    if (!_upsample && (downscaler == 4 || downscaler == 5))
+    {
+        LOG_WARN("[{0}] Separable downscaler {1} is not supported on Dx11, using {2}", _name, downscaler,
+                 downscaler == 4 ? "Lanczos" : "Catmull-Rom");
+        downscaler -= 3;
+    }
+
     if (Config::Instance()->UsePrecompiledShaders.value_or_default() ||
         Config::Instance()->OutputScalingUseFsr.value_or_default())
     {
@@ -264,7 +274,7 @@ OS_Dx11::OS_Dx11(std::string InName, ID3D11Device* InDevice, bool InUpsample)
             }
             else
             {
-                switch (Config::Instance()->OutputScalingDownscaler.value_or_default())
+                switch (downscaler)
                 {
                 case 0:
                     hr = _device->CreateComputeShader(reinterpret_cast<const void*>(bcds_bicubic_cso),
@@ -311,7 +321,7 @@ OS_Dx11::OS_Dx11(std::string InName, ID3D11Device* InDevice, bool InUpsample)
         }
         else
         {
-            switch (Config::Instance()->OutputScalingDownscaler.value_or_default())
+            switch (downscaler)
             {
             case 0:
                 shaderBlob = OS_CompileShader(downsampleCodeBC.c_str(), "CSMain", "cs_5_0");
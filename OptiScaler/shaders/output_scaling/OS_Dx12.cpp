@@ -129,6 +129,203 @@ void OS_Dx12::SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12_RES
     _bufferState = InState;
 }
 
+bool OS_Dx12::CreateIntermediateResource(ID3D12Device* InDevice, uint32_t InWidth, uint32_t InHeight)
+{
+    if (_intermediate != nullptr)
+    {
+        auto desc = _intermediate->GetDesc();
+
+        if (desc.Width == InWidth && desc.Height == InHeight)
+            return true;
+
+        _intermediate->Release();
+        _intermediate = nullptr;
+    }
+
+    LOG_DEBUG("[{0}] {1}x{2}", _name, InWidth, InHeight);
+
+    // Half float keeps the negative lobes of the first pass
+    auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
+    auto texDesc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R16G16B16A16_FLOAT, InWidth, InHeight, 1, 1, 1, 0,
+                                                D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+
+    auto hr = InDevice->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &texDesc,
+                                                D3D12_RESOURCE_STATE_UNORDERED_ACCESS, nullptr,
+                                                IID_PPV_ARGS(&_intermediate));
+
+    if (hr != S_OK)
+    {
+        LOG_ERROR("[{0}] CreateCommittedResource result: {1:x}", _name, hr);
+        return false;
+    }
+
+    _intermediate->SetName(L"OS_Intermediate");
+    _intermediateState = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+    return true;
+}
+
+static_assert(sizeof(SeparableConstants::weights) == sizeof(OS_Cpu::SeparableAxis::Weights));
+
+// Constant buffer of separable modes holds horizontal & vertical pass constants of both _counter slots
+static UINT64 SeparableConstantsOffset(int InSlot, bool InVertical)
+{
+    return (InSlot * 2 + (InVertical ? 1 : 0)) * sizeof(SeparableConstants);
+}
+
+bool OS_Dx12::UploadSeparableConstants(int InSlot, uint32_t InSrcWidth, uint32_t InSrcHeight, uint32_t InDstWidth,
+                                       uint32_t InDstHeight)
+{
+    // Weight tables only change with resolution, slot is not rewritten while previous frame might still read it
+    auto size = _separableSize[InSlot];
+
+    if (size[0] == InSrcWidth && size[1] == InSrcHeight && size[2] == InDstWidth && size[3] == InDstHeight)
+        return true;
+
+    UINT8* pCBDataBegin = nullptr;
+    CD3DX12_RANGE readRange(0, 0); // We do not intend to read from this resource on the CPU
+    auto hr = _constantBuffer->Map(0, &readRange, reinterpret_cast<void**>(&pCBDataBegin));
+
+    if (hr != S_OK || pCBDataBegin == nullptr)
+    {
+        LOG_ERROR("[{0}] constantBuffer->Map error {1:x}", _name, (UINT) hr);
+        return false;
+    }
+
+    auto axis = std::make_unique<OS_Cpu::SeparableAxis>();
+    auto constants = std::make_unique<SeparableConstants>();
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        bool vertical = pass == 1;
+
+        if (vertical)
+            OS_Cpu::BuildSeparableAxis(_separableKernel, InSrcHeight, InDstHeight, *axis);
+        else
+            OS_Cpu::BuildSeparableAxis(_separableKernel, InSrcWidth, InDstWidth, *axis);
+
+        *constants = {};
+        constants->srcWidth = InSrcWidth;
+        constants->srcHeight = InSrcHeight;
+        constants->destWidth = InDstWidth;
+        constants->destHeight = InDstHeight;
+        constants->scale = axis->Scale;
+        constants->taps = axis->Taps;
+        constants->useCache = axis->UseCache ? 1 : 0;
+        memcpy(constants->weights, axis->Weights, sizeof(constants->weights));
+
+        memcpy(pCBDataBegin + SeparableConstantsOffset(InSlot, vertical), constants.get(), sizeof(SeparableConstants));
+
+        LOG_DEBUG("[{0}] {1} pass, scale: {2}, taps: {3}, cache: {4}", _name, vertical ? "Vertical" : "Horizontal",
+                  axis->Scale, axis->Taps, axis->UseCache);
+    }
+
+    _constantBuffer->Unmap(0, nullptr);
+
+    size[0] = InSrcWidth;
+    size[1] = InSrcHeight;
+    size[2] = InDstWidth;
+    size[3] = InDstHeight;
+
+    return true;
+}
+
+bool OS_Dx12::DispatchSeparable(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList,
+                                ID3D12Resource* InResource, ID3D12Resource* OutResource)
+{
+    auto feature = State::Instance().currentFeature;
+    uint32_t srcWidth = feature->TargetWidth();
+    uint32_t srcHeight = feature->TargetHeight();
+    uint32_t dstWidth = feature->DisplayWidth();
+    uint32_t dstHeight = feature->DisplayHeight();
+
+    _counter++;
+    _counter = _counter % 2;
+
+    if (!CreateIntermediateResource(InDevice, dstWidth, srcHeight) ||
+        !UploadSeparableConstants(_counter, srcWidth, srcHeight, dstWidth, dstHeight))
+    {
+        return false;
+    }
+
+    // SRV, UAV & CBV of horizontal pass followed by the ones of vertical pass
+    auto increment = InDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    auto cpuStart = _srvHeap[_counter]->GetCPUDescriptorHandleForHeapStart();
+    auto gpuStart = _srvHeap[_counter]->GetGPUDescriptorHandleForHeapStart();
+
+    auto cpuHandle = [&](UINT index) { return CD3DX12_CPU_DESCRIPTOR_HANDLE(cpuStart, index, increment); };
+    auto gpuHandle = [&](UINT index) { return CD3DX12_GPU_DESCRIPTOR_HANDLE(gpuStart, index, increment); };
+
+    auto inDesc = InResource->GetDesc();
+    auto outDesc = OutResource->GetDesc();
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = 1;
+
+    D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+    uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+    uavDesc.Texture2D.MipSlice = 0;
+
+    D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
+    cbvDesc.SizeInBytes = sizeof(SeparableConstants);
+
+    // Horizontal pass, InResource -> _intermediate
+    srvDesc.Format = TranslateTypelessFormats(inDesc.Format);
+    InDevice->CreateShaderResourceView(InResource, &srvDesc, cpuHandle(0));
+
+    uavDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+    InDevice->CreateUnorderedAccessView(_intermediate, nullptr, &uavDesc, cpuHandle(1));
+
+    cbvDesc.BufferLocation = _constantBuffer->GetGPUVirtualAddress() + SeparableConstantsOffset(_counter, false);
+    InDevice->CreateConstantBufferView(&cbvDesc, cpuHandle(2));
+
+    // Vertical pass, _intermediate -> OutResource
+    srvDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+    InDevice->CreateShaderResourceView(_intermediate, &srvDesc, cpuHandle(3));
+
+    uavDesc.Format = TranslateTypelessFormats(outDesc.Format);
+    InDevice->CreateUnorderedAccessView(OutResource, nullptr, &uavDesc, cpuHandle(4));
+
+    cbvDesc.BufferLocation = _constantBuffer->GetGPUVirtualAddress() + SeparableConstantsOffset(_counter, true);
+    InDevice->CreateConstantBufferView(&cbvDesc, cpuHandle(5));
+
+    auto transitionIntermediate = [&](D3D12_RESOURCE_STATES state)
+    {
+        if (_intermediateState == state)
+            return;
+
+        auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(_intermediate, _intermediateState, state);
+        InCmdList->ResourceBarrier(1, &barrier);
+        _intermediateState = state;
+    };
+
+    ID3D12DescriptorHeap* heaps[] = { _srvHeap[_counter] };
+    InCmdList->SetDescriptorHeaps(_countof(heaps), heaps);
+    InCmdList->SetComputeRootSignature(_rootSignature);
+
+    transitionIntermediate(D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    InCmdList->SetPipelineState(_pipelineState);
+    InCmdList->SetComputeRootDescriptorTable(0, gpuHandle(0));
+    InCmdList->SetComputeRootDescriptorTable(1, gpuHandle(1));
+    InCmdList->SetComputeRootDescriptorTable(2, gpuHandle(2));
+    InCmdList->Dispatch((dstWidth + OS_Cpu::SeparableGroupSize - 1) / OS_Cpu::SeparableGroupSize,
+                        (srcHeight + OS_Cpu::SeparableGroupLines - 1) / OS_Cpu::SeparableGroupLines, 1);
+
+    transitionIntermediate(D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+
+    InCmdList->SetPipelineState(_pipelineStateV);
+    InCmdList->SetComputeRootDescriptorTable(0, gpuHandle(3));
+    InCmdList->SetComputeRootDescriptorTable(1, gpuHandle(4));
+    InCmdList->SetComputeRootDescriptorTable(2, gpuHandle(5));
+    InCmdList->Dispatch((dstWidth + OS_Cpu::SeparableGroupLines - 1) / OS_Cpu::SeparableGroupLines,
+                        (dstHeight + OS_Cpu::SeparableGroupSize - 1) / OS_Cpu::SeparableGroupSize, 1);
+
+    return true;
+}
+
 bool OS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
                        ID3D12Resource* OutResource)
 {
@@ -137,6 +334,9 @@ bool OS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
 
     LOG_DEBUG("[{0}] Start!", _name);
 
+    if (_separable)
+        return DispatchSeparable(InDevice, InCmdList, InResource, OutResource);
+
     _counter++;
     _counter = _counter % 2;
 
@@ -345,7 +545,16 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
 
     rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
 
-    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(Constants));
+    auto downscaler = Config::Instance()->OutputScalingDownscaler.value_or_default();
+    _separable = !_upsample && !Config::Instance()->OutputScalingUseFsr.value_or_default() &&
+                 OS_Cpu::IsSeparable((OS_Cpu::Kernel) downscaler);
+
+    if (_separable)
+        _separableKernel = (OS_Cpu::Kernel) downscaler;
+
+    // Separable modes keep constants of both passes for each _counter slot
+    D3D12_RESOURCE_DESC desc =
+        CD3DX12_RESOURCE_DESC::Buffer(_separable ? 2 * 2 * sizeof(SeparableConstants) : sizeof(Constants));
     auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
     InDevice->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ,
                                       nullptr, IID_PPV_ARGS(&_constantBuffer));
@@ -393,8 +602,9 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
     }
 
     // don't wanna compile fsr easu on runtime :)
-    if (Config::Instance()->UsePrecompiledShaders.value_or_default() ||
-        Config::Instance()->OutputScalingUseFsr.value_or_default())
+    // separable modes don't have precompiled versions
+    if (!_separable && (Config::Instance()->UsePrecompiledShaders.value_or_default() ||
+                        Config::Instance()->OutputScalingUseFsr.value_or_default()))
     {
         D3D12_COMPUTE_PIPELINE_STATE_DESC computePsoDesc = {};
         computePsoDesc.pRootSignature = _rootSignature;
@@ -453,6 +663,27 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
             return;
         }
     }
+    else if (_separable)
+    {
+        ID3DBlob* horizontalShader = OS_CompileShader(downsampleCodeSeparable.c_str(), "CSHorizontal", "cs_5_0");
+        ID3DBlob* verticalShader = OS_CompileShader(downsampleCodeSeparable.c_str(), "CSVertical", "cs_5_0");
+
+        bool created = horizontalShader != nullptr && verticalShader != nullptr &&
+                       CreateComputeShader(InDevice, _rootSignature, &_pipelineState, horizontalShader) &&
+                       CreateComputeShader(InDevice, _rootSignature, &_pipelineStateV, verticalShader);
+
+        if (horizontalShader != nullptr)
+            horizontalShader->Release();
+
+        if (verticalShader != nullptr)
+            verticalShader->Release();
+
+        if (!created)
+        {
+            LOG_ERROR("[{0}] Separable shader creation error!", _name);
+            return;
+        }
+    }
     else
     {
         // Compile shader blobs
@@ -509,7 +740,7 @@ OS_Dx12::OS_Dx12(std::string InName, ID3D12Device* InDevice, bool InUpsample)
     }
 
     D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-    heapDesc.NumDescriptors = 3; // SRV + UAV + CBV
+    heapDesc.NumDescriptors = _separable ? 6 : 3; // SRV + UAV + CBV (per pass)
     heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
     heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
 
@@ -587,6 +818,12 @@ OS_Dx12::~OS_Dx12()
         _pipelineState = nullptr;
     }
 
+    if (_pipelineStateV != nullptr)
+    {
+        _pipelineStateV->Release();
+        _pipelineStateV = nullptr;
+    }
+
     if (_rootSignature != nullptr)
     {
         _rootSignature->Release();
@@ -622,4 +859,10 @@ OS_Dx12::~OS_Dx12()
         _constantBuffer->Release();
         _constantBuffer = nullptr;
     }
+
+    if (_intermediate != nullptr)
+    {
+        _intermediate->Release();
+        _intermediate = nullptr;
+    }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <pch.h>
 
 #include "OS_Common.h"
+#include "OS_Cpu.h"
 
 #include <d3d12.h>
 #include <d3dx/d3dx12.h>
@@ -33,6 +34,20 @@ class OS_Dx12
     ID3D12Resource* _buffer = nullptr;
     D3D12_RESOURCE_STATES _bufferState = D3D12_RESOURCE_STATE_COMMON;
 
+    // Separable downscalers, horizontal pass writes to _intermediate and vertical pass reads from it
+    bool _separable = false;
+    OS_Cpu::Kernel _separableKernel = OS_Cpu::Kernel::SeparableLanczos;
+    ID3D12PipelineState* _pipelineStateV = nullptr;
+    ID3D12Resource* _intermediate = nullptr;
+    D3D12_RESOURCE_STATES _intermediateState = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    uint32_t _separableSize[2][4] {}; // src & dst size of the weight tables uploaded to each _counter slot
+
+    bool CreateIntermediateResource(ID3D12Device* InDevice, uint32_t InWidth, uint32_t InHeight);
+    bool UploadSeparableConstants(int InSlot, uint32_t InSrcWidth, uint32_t InSrcHeight, uint32_t InDstWidth,
+                                  uint32_t InDstHeight);
+    bool DispatchSeparable(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                           ID3D12Resource* OutResource);
+
   public:
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, uint32_t InWidth, uint32_t InHeight,
                               D3D12_RESOURCE_STATES InState);
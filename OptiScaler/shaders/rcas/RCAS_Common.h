@@ -154,6 +154,183 @@ void CSMain(uint3 DTid : SV_DispatchThreadID)
 }
 )";
 
+// Tiled version of rcasCode, each 8x8 group caches its 10x10 source block once, fetches
+// motion once at tile centre and skips sharpening when the block has no local contrast.
+// Filter math uses min16float, drivers without fp16 support run it as float.
+static std::string rcasTiledCode = R"(
+cbuffer Params : register(b0)
+{
+    float Sharpness;
+    float Contrast;
+
+    // Motion Vector Stuff
+    int DynamicSharpenEnabled;
+    int DisplaySizeMV;
+    int Debug;
+    
+    float MotionSharpness;
+    float MotionTextureScale;
+    float MvScaleX;
+    float MvScaleY;
+    float Threshold;
+    float ScaleLimit;
+    int DisplayWidth;
+    int DisplayHeight;
+
+    // Tiles with luma range below this are copied
+    float TileSkipThreshold;
+};
+
+Texture2D<float3> Source : register(t0);
+Texture2D<float2> Motion : register(t1);
+RWTexture2D<float3> Dest : register(u0);
+
+#define TILE_SIZE 8
+#define CACHE_SIZE (TILE_SIZE + 2)
+
+groupshared float3 cachedColor[CACHE_SIZE * CACHE_SIZE];
+groupshared uint tileLumaMin;
+groupshared uint tileLumaMax;
+groupshared float tileSharpness;
+
+float getRCASLuma(float3 rgb)
+{
+    return dot(rgb, float3(0.5, 1.0, 0.5));
+}
+
+min16float3 getCached(int x, int y)
+{
+    return (min16float3) cachedColor[(y + 1) * CACHE_SIZE + x + 1];
+}
+
+float getTileSharpness(uint2 pos)
+{
+    float setSharpness = Sharpness;
+  
+    if (DynamicSharpenEnabled > 0)
+    {
+        float2 mv;
+        float motion;
+        float add = 0.0f;
+
+        if (DisplaySizeMV > 0)
+            mv = Motion.Load(int3(pos.x, pos.y, 0)).rg;
+        else
+            mv = Motion.Load(int3(pos.x * MotionTextureScale, pos.y * MotionTextureScale, 0)).rg;
+
+        motion = max(abs(mv.r * MvScaleX), abs(mv.g * MvScaleY));
+
+        if (motion > Threshold)
+            add = (motion / (ScaleLimit - Threshold)) * MotionSharpness;
+    
+        if ((add > MotionSharpness && MotionSharpness > 0.0f) || (add < MotionSharpness && MotionSharpness < 0.0f))
+            add = MotionSharpness;
+    
+        setSharpness = clamp(setSharpness + add, 0.0f, 1.3f);
+    }
+
+    return setSharpness;
+}
+
+[numthreads(TILE_SIZE, TILE_SIZE, 1)]
+void CSMain(uint3 DTid : SV_DispatchThreadID, uint3 GTid : SV_GroupThreadID, uint3 Gid : SV_GroupID,
+            uint GI : SV_GroupIndex)
+{
+    int2 tileOrigin = int2(Gid.xy * TILE_SIZE);
+
+    if (GI == 0)
+    {
+        tileLumaMin = 0x7F7FFFFF; // FLT_MAX
+        tileLumaMax = 0;
+        tileSharpness = getTileSharpness(Gid.xy * TILE_SIZE + TILE_SIZE / 2);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    // Cache block with 1 pixel apron, out of bounds loads return 0 like rcasCode
+    for (uint i = GI; i < CACHE_SIZE * CACHE_SIZE; i += TILE_SIZE * TILE_SIZE)
+    {
+        int2 pos = tileOrigin + int2(i % CACHE_SIZE, i / CACHE_SIZE) - 1;
+        float3 color = Source.Load(int3(pos, 0)).rgb;
+        cachedColor[i] = color;
+
+        // Positive floats keep their order as uint
+        uint luma = asuint(max(getRCASLuma(color), 0.0f));
+        InterlockedMin(tileLumaMin, luma);
+        InterlockedMax(tileLumaMax, luma);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    float setSharpness = tileSharpness;
+    bool flatTile = (asfloat(tileLumaMax) - asfloat(tileLumaMin)) < TileSkipThreshold;
+    int x = GTid.x;
+    int y = GTid.y;
+
+    min16float3 e = getCached(x, y);
+  
+    // skip sharpening if set value == 0 or whole tile is flat
+    if (setSharpness == 0.0f || flatTile)
+    {
+        if (Debug > 0 && DynamicSharpenEnabled > 0 && Sharpness > 0)
+        {
+            if (setSharpness == 0.0f)
+                e.g *= 1 + (12.0f * Sharpness);
+            else
+                e.b *= 1 + (12.0f * Sharpness);
+        }
+
+        Dest[DTid.xy] = e;
+        return;
+    }
+
+    min16float3 b = getCached(x, y - 1);
+    min16float3 d = getCached(x - 1, y);
+    min16float3 f = getCached(x + 1, y);
+    min16float3 h = getCached(x, y + 1);
+  
+    // Min and max of ring.
+    min16float3 minRGB = min(min(b, d), min(f, h));
+    min16float3 maxRGB = max(max(b, d), max(f, h));
+  
+    // Immediate constants for peak range.
+    min16float2 peakC = min16float2(1.0, -4.0);
+  
+    // Standard RCAS limiters
+    min16float3 hitMin = minRGB * rcp(4.0 * maxRGB);
+    min16float3 hitMax = (peakC.xxx - maxRGB) * rcp(4.0 * minRGB + peakC.yyy);
+    min16float3 lobeRGB = max(-hitMin, hitMax);
+    float lobe = max(-0.1875, min(max(lobeRGB.r, max(lobeRGB.g, lobeRGB.b)), 0.0)) * setSharpness;
+    
+    // Apply contrast adaptation only if Contrast > 0
+    if (Contrast >= -10.0)
+    {
+        // Only green is used as representative
+        float amp = saturate(min(minRGB.g, 2.0 - maxRGB.g) / max(maxRGB.g, 1e-5));
+        amp = rsqrt(amp);
+        
+        float peak = -3.0 * Contrast + 8.0;
+        float contrastFactor = 1.0 / max(amp * peak, 1.0);
+        
+        lobe *= lerp(1.0, contrastFactor, Contrast);
+    }
+    
+    // Resolve with medium precision rcp
+    min16float rcpL = (min16float) rcp(4.0 * lobe + 1.0);
+    min16float3 output = ((b + d + f + h) * (min16float) lobe + e) * rcpL;
+  
+    if (Debug > 0 && DynamicSharpenEnabled > 0)
+    {
+        if (Sharpness < setSharpness)
+            output.r *= 1 + (12.0f * (setSharpness - Sharpness));
+        else
+            output.g *= 1 + (12.0f * (Sharpness - setSharpness));
+    }
+  
+    Dest[DTid.xy] = output;
+}
+)";
+
 static ID3DBlob* RCAS_CompileShader(const char* shaderCode, const char* entryPoint, const char* target)
 {
     ID3DBlob* shaderBlob = nullptr;
@@ -0,0 +1,191 @@
+#include "RCAS_Cpu.h"
+
+#include <limits>
+
+float RCAS_Cpu::EvaluateSharpness(const CpuTexture* InMotionVectors, const Constants& InConstants, uint32_t x,
+                                  uint32_t y)
+{
+    float setSharpness = InConstants.Sharpness;
+
+    if (InConstants.DynamicSharpenEnabled && InMotionVectors != nullptr)
+    {
+        CpuFloat4 mv;
+        float add = 0.0f;
+
+        if (InConstants.DisplaySizeMV)
+            mv = CpuLoad(*InMotionVectors, x, y);
+        else
+            mv = CpuLoad(*InMotionVectors, (int64_t) (x * InConstants.MotionTextureScale),
+                         (int64_t) (y * InConstants.MotionTextureScale));
+
+        float motion = std::max(std::abs(mv.X() * InConstants.MvScaleX), std::abs(mv.Y() * InConstants.MvScaleY));
+
+        if (motion > InConstants.Threshold)
+            add = (motion / (InConstants.ScaleLimit - InConstants.Threshold)) * InConstants.MotionSharpness;
+
+        if ((add > InConstants.MotionSharpness && InConstants.MotionSharpness > 0.0f) ||
+            (add < InConstants.MotionSharpness && InConstants.MotionSharpness < 0.0f))
+            add = InConstants.MotionSharpness;
+
+        setSharpness = std::clamp(setSharpness + add, 0.0f, 1.3f);
+    }
+
+    return setSharpness;
+}
+
+CpuFloat4 RCAS_Cpu::EvaluatePixel(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                                  const Constants& InConstants, uint32_t x, uint32_t y)
+{
+    return SharpenPixel(InResource, InConstants, EvaluateSharpness(InMotionVectors, InConstants, x, y), x, y);
+}
+
+CpuFloat4 RCAS_Cpu::SharpenPixel(const CpuTexture& InResource, const Constants& InConstants, float InSharpness,
+                                 uint32_t x, uint32_t y)
+{
+    float setSharpness = InSharpness;
+    auto e = CpuLoad(InResource, x, y);
+    bool debug = InConstants.Debug && InConstants.DynamicSharpenEnabled;
+
+    // skip sharpening if set value == 0
+    if (setSharpness == 0.0f)
+    {
+        if (debug && InConstants.Sharpness > 0)
+            e *= CpuFloat4::Set(1.0f, 1.0f + (12.0f * InConstants.Sharpness), 1.0f, 1.0f);
+
+        return e;
+    }
+
+    auto b = CpuLoad(InResource, x, (int64_t) y - 1);
+    auto d = CpuLoad(InResource, (int64_t) x - 1, y);
+    auto f = CpuLoad(InResource, (int64_t) x + 1, y);
+    auto h = CpuLoad(InResource, x, (int64_t) y + 1);
+
+    // Min and max of ring
+    auto minRGB = CpuFloat4::Min(CpuFloat4::Min(b, d), CpuFloat4::Min(f, h));
+    auto maxRGB = CpuFloat4::Max(CpuFloat4::Max(b, d), CpuFloat4::Max(f, h));
+
+    // Standard RCAS limiters, alpha lane is ignored
+    auto hitMin = minRGB / (maxRGB * 4.0f);
+    auto hitMax = (CpuFloat4::Splat(1.0f) - maxRGB) / (minRGB * 4.0f - CpuFloat4::Splat(4.0f));
+    auto lobeRGB = CpuFloat4::Max(CpuFloat4::Zero() - hitMin, hitMax);
+    float lobe = std::max(-0.1875f, std::min(lobeRGB.MaxRGB(), 0.0f)) * setSharpness;
+
+    if (InConstants.Contrast >= -10.0f)
+    {
+        // Only green is used by the shader
+        float minG = minRGB.Y();
+        float maxG = maxRGB.Y();
+        float amp = CpuSaturate(std::min(minG, 2.0f - maxG) / std::max(maxG, 1e-5f));
+        amp = 1.0f / std::sqrt(amp);
+
+        float peak = -3.0f * InConstants.Contrast + 8.0f;
+        float contrastFactor = 1.0f / std::max(amp * peak, 1.0f);
+
+        lobe *= 1.0f + (contrastFactor - 1.0f) * InConstants.Contrast;
+    }
+
+    float rcpL = 1.0f / (4.0f * lobe + 1.0f);
+    auto output = ((b + d + f + h) * lobe + e) * rcpL;
+
+    if (debug)
+    {
+        if (InConstants.Sharpness < setSharpness)
+            output *= CpuFloat4::Set(1.0f + (12.0f * (setSharpness - InConstants.Sharpness)), 1.0f, 1.0f, 1.0f);
+        else
+            output *= CpuFloat4::Set(1.0f, 1.0f + (12.0f * (InConstants.Sharpness - setSharpness)), 1.0f, 1.0f);
+    }
+
+    return output;
+}
+
+bool RCAS_Cpu::Dispatch(const CpuTexture& InResource, const CpuTexture* InMotionVectors, const Constants& InConstants,
+                        CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid())
+        return false;
+
+    if (InConstants.DynamicSharpenEnabled && (InMotionVectors == nullptr || !InMotionVectors->IsValid()))
+        return false;
+
+    if (!OutResource.IsValid())
+        OutResource.Resize(InResource.Width, InResource.Height, InResource.Channels);
+
+    CpuDispatchTiles(
+        InResource.Width, InResource.Height, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                    CpuStore(OutResource, x, y, EvaluatePixel(InResource, InMotionVectors, InConstants, x, y), 3);
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
+
+bool RCAS_Cpu::DispatchTiled(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                             const Constants& InConstants, CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid())
+        return false;
+
+    if (InConstants.DynamicSharpenEnabled && (InMotionVectors == nullptr || !InMotionVectors->IsValid()))
+        return false;
+
+    if (!OutResource.IsValid())
+        OutResource.Resize(InResource.Width, InResource.Height, InResource.Channels);
+
+    bool debug = InConstants.Debug && InConstants.DynamicSharpenEnabled;
+
+    CpuDispatchTiles(
+        InResource.Width, InResource.Height, TileSize, TileSize,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            float setSharpness =
+                EvaluateSharpness(InMotionVectors, InConstants, x0 + TileSize / 2, y0 + TileSize / 2);
+
+            // Luma range of tile with 1 pixel apron, out of bounds pixels are 0 like the shader
+            float lumaMin = std::numeric_limits<float>::max();
+            float lumaMax = 0.0f;
+
+            for (int64_t y = (int64_t) y0 - 1; y <= (int64_t) (y0 + TileSize); y++)
+            {
+                for (int64_t x = (int64_t) x0 - 1; x <= (int64_t) (x0 + TileSize); x++)
+                {
+                    auto color = CpuLoad(InResource, x, y);
+                    float luma = std::max(color.X() * 0.5f + color.Y() + color.Z() * 0.5f, 0.0f);
+                    lumaMin = std::min(lumaMin, luma);
+                    lumaMax = std::max(lumaMax, luma);
+                }
+            }
+
+            bool flatTile = (lumaMax - lumaMin) < InConstants.TileSkipThreshold;
+
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    CpuFloat4 output;
+
+                    if (flatTile && setSharpness != 0.0f)
+                    {
+                        output = CpuLoad(InResource, x, y);
+
+                        if (debug && InConstants.Sharpness > 0)
+                            output *= CpuFloat4::Set(1.0f, 1.0f, 1.0f + (12.0f * InConstants.Sharpness), 1.0f);
+                    }
+                    else
+                    {
+                        output = SharpenPixel(InResource, InConstants, setSharpness, x, y);
+                    }
+
+                    CpuStore(OutResource, x, y, output, 3);
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
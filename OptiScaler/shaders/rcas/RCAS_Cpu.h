@@ -0,0 +1,57 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of rcasCode and rcasTiledCode (RCAS_Common.h), same math and same thread group tiling.
+// Tiled version runs in float, same as rcasTiledCode on hardware without fp16 support.
+class RCAS_Cpu
+{
+  public:
+    // Layout and meaning follows the shader cbuffer
+    struct Constants
+    {
+        float Sharpness = 0.3f;
+        float Contrast = -100.0f; // < -10 disables contrast adaptation
+
+        // Motion Vector Stuff
+        bool DynamicSharpenEnabled = false;
+        bool DisplaySizeMV = true;
+        bool Debug = false;
+
+        float MotionSharpness = 0.4f;
+        float MotionTextureScale = 1.0f;
+        float MvScaleX = 1.0f;
+        float MvScaleY = 1.0f;
+        float Threshold = 0.0f;
+        float ScaleLimit = 10.0f;
+        int DisplayWidth = 0;
+        int DisplayHeight = 0;
+
+        // Only used by DispatchTiled
+        float TileSkipThreshold = 0.01f;
+    };
+
+    static constexpr uint32_t NumThreadsX = 32;
+    static constexpr uint32_t NumThreadsY = 32;
+    static constexpr uint32_t TileSize = 8;
+
+    // Dispatch area is the size of InResource like RCAS_Dx12, InMotionVectors is only needed with
+    // DynamicSharpenEnabled. OutResource is resized when empty.
+    static bool Dispatch(const CpuTexture& InResource, const CpuTexture* InMotionVectors, const Constants& InConstants,
+                         CpuTexture& OutResource, uint32_t InThreadCount = 0);
+
+    // Same as Dispatch for rcasTiledCode, sharpness is evaluated once per 8x8 tile and tiles
+    // with luma range below TileSkipThreshold are copied
+    static bool DispatchTiled(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                              const Constants& InConstants, CpuTexture& OutResource, uint32_t InThreadCount = 0);
+
+    static CpuFloat4 EvaluatePixel(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                                   const Constants& InConstants, uint32_t x, uint32_t y);
+
+    // Sharpness after motion adjustment at x, y
+    static float EvaluateSharpness(const CpuTexture* InMotionVectors, const Constants& InConstants, uint32_t x,
+                                   uint32_t y);
+
+    static CpuFloat4 SharpenPixel(const CpuTexture& InResource, const Constants& InConstants, float InSharpness,
+                                  uint32_t x, uint32_t y);
+};
@@ -182,6 +182,7 @@ bool RCAS_Dx11::Dispatch(ID3D11Device* InDevice, ID3D11DeviceContext* InContext,
     constants.Threshold = Config::Instance()->MotionThreshold.value_or_default();
     constants.ScaleLimit = Config::Instance()->MotionScaleLimit.value_or_default();
     constants.DisplaySizeMV = InConstants.DisplaySizeMV ? 1 : 0;
+    constants.TileSkipThreshold = Config::Instance()->RcasTileSkipThreshold.value_or_default();
 
     if (InConstants.RenderWidth == 0 || InConstants.DisplayWidth == 0)
         constants.MotionTextureScale = 1.0f;
@@ -233,7 +234,16 @@ RCAS_Dx11::RCAS_Dx11(std::string InName, ID3D11Device* InDevice) : _name(InName)
 
     LOG_DEBUG("{0} start!", _name);
 
-    if (Config::Instance()->UsePrecompiledShaders.value_or_default())
+    _tiled = Config::Instance()->RcasTiled.value_or_default();
+
+    if (_tiled)
+    {
+        InNumThreadsX = 8;
+        InNumThreadsY = 8;
+    }
+
+    // There is no precompiled version of tiled shader
+    if (Config::Instance()->UsePrecompiledShaders.value_or_default() && !_tiled)
     {
         auto hr = _device->CreateComputeShader(reinterpret_cast<const void*>(rcas_cso), sizeof(rcas_cso), nullptr,
                                                &_computeShader);
@@ -246,7 +256,8 @@ RCAS_Dx11::RCAS_Dx11(std::string InName, ID3D11Device* InDevice) : _name(InName)
     else
     {
         // Compile shader blobs
-        ID3DBlob* shaderBlob = RCAS_CompileShader(rcasCode.c_str(), "CSMain", "cs_5_0");
+        ID3DBlob* shaderBlob =
+            RCAS_CompileShader(_tiled ? rcasTiledCode.c_str() : rcasCode.c_str(), "CSMain", "cs_5_0");
         if (shaderBlob == nullptr)
         {
             LOG_ERROR("[{0}] RCAS_CompileShader error!", _name);
@@ -26,6 +26,9 @@ class RCAS_Dx11
         float ScaleLimit;
         int DisplayWidth;
         int DisplayHeight;
+
+        // Only used by rcasTiledCode
+        float TileSkipThreshold;
     };
 
     std::string _name = "";
@@ -48,6 +51,8 @@ class RCAS_Dx11
     uint32_t InNumThreadsX = 32;
     uint32_t InNumThreadsY = 32;
 
+    bool _tiled = false;
+
     bool InitializeViews(ID3D11Texture2D* InResource, ID3D11Texture2D* InMotionVectors, ID3D11Texture2D* OutResource);
 
   public:
@@ -241,6 +241,7 @@ bool RCAS_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCm
     constants.Threshold = Config::Instance()->MotionThreshold.value_or_default();
     constants.ScaleLimit = Config::Instance()->MotionScaleLimit.value_or_default();
     constants.DisplaySizeMV = InConstants.DisplaySizeMV ? 1 : 0;
+    constants.TileSkipThreshold = Config::Instance()->RcasTileSkipThreshold.value_or_default();
 
     if (InConstants.RenderWidth == 0 || InConstants.DisplayWidth == 0)
         constants.MotionTextureScale = 1.0f;
@@ -415,7 +416,16 @@ RCAS_Dx12::RCAS_Dx12(std::string InName, ID3D12Device* InDevice) : _name(InName)
         return;
     }
 
-    if (Config::Instance()->UsePrecompiledShaders.value_or_default())
+    _tiled = Config::Instance()->RcasTiled.value_or_default();
+
+    if (_tiled)
+    {
+        InNumThreadsX = 8;
+        InNumThreadsY = 8;
+    }
+
+    // There is no precompiled version of tiled shader
+    if (Config::Instance()->UsePrecompiledShaders.value_or_default() && !_tiled)
     {
         D3D12_COMPUTE_PIPELINE_STATE_DESC computePsoDesc = {};
         computePsoDesc.pRootSignature = _rootSignature;
@@ -433,7 +443,8 @@ RCAS_Dx12::RCAS_Dx12(std::string InName, ID3D12Device* InDevice) : _name(InName)
     else
     {
         // Compile shader blobs
-        ID3DBlob* _recEncodeShader = RCAS_CompileShader(rcasCode.c_str(), "CSMain", "cs_5_0");
+        ID3DBlob* _recEncodeShader =
+            RCAS_CompileShader(_tiled ? rcasTiledCode.c_str() : rcasCode.c_str(), "CSMain", "cs_5_0");
 
         if (_recEncodeShader == nullptr)
         {
@@ -28,6 +28,9 @@ class RCAS_Dx12
         float ScaleLimit;
         int DisplayWidth;
         int DisplayHeight;
+
+        // Only used by rcasTiledCode
+        float TileSkipThreshold;
     };
 
     std::string _name = "";
@@ -57,6 +60,8 @@ class RCAS_Dx12
     UINT InNumThreadsX = 32;
     UINT InNumThreadsY = 32;
 
+    bool _tiled = false;
+
   public:
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, D3D12_RESOURCE_STATES InState);
     void SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12_RESOURCE_STATES InState);
@@ -0,0 +1,111 @@
+#include "RCAS_OS_Cpu.h"
+
+bool RCAS_OS_Cpu::Dispatch(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                           const RCAS_Cpu::Constants& InRcasConstants, OS_Cpu::Constants InOsConstants,
+                           CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    if (InRcasConstants.DynamicSharpenEnabled && (InMotionVectors == nullptr || !InMotionVectors->IsValid()))
+        return false;
+
+    if (InOsConstants.srcWidth <= 0 || InOsConstants.srcHeight <= 0)
+    {
+        InOsConstants.srcWidth = InResource.Width;
+        InOsConstants.srcHeight = InResource.Height;
+    }
+
+    if (InOsConstants.destWidth <= 0 || InOsConstants.destHeight <= 0)
+    {
+        InOsConstants.destWidth = OutResource.Width;
+        InOsConstants.destHeight = OutResource.Height;
+    }
+
+    const float scaleX = (float) InOsConstants.srcWidth / (float) InOsConstants.destWidth;
+    const float scaleY = (float) InOsConstants.srcHeight / (float) InOsConstants.destHeight;
+
+    // Shader tile is 19x19 which is enough while upsampling, sized by scale here so downsampling works too
+    const uint32_t cacheWidth = (uint32_t) std::ceil(NumThreadsX * scaleX) + 4;
+    const uint32_t cacheHeight = (uint32_t) std::ceil(NumThreadsY * scaleY) + 4;
+
+    CpuDispatchTiles(
+        InOsConstants.destWidth, InOsConstants.destHeight, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            auto upperLeftX = (int64_t) std::floor((x0 + 0.5f) * scaleX - 1.5f);
+            auto upperLeftY = (int64_t) std::floor((y0 + 0.5f) * scaleY - 1.5f);
+
+            // Sharpened source tile, texels outside of source are 0 like the RCAS buffer reads
+            std::vector<CpuFloat4> cache((size_t) cacheWidth * cacheHeight, CpuFloat4::Zero());
+
+            for (uint32_t j = 0; j < cacheHeight; j++)
+            {
+                for (uint32_t i = 0; i < cacheWidth; i++)
+                {
+                    int64_t sx = upperLeftX + i;
+                    int64_t sy = upperLeftY + j;
+
+                    if (InResource.Contains(sx, sy))
+                    {
+                        cache[(size_t) j * cacheWidth + i] = RCAS_Cpu::EvaluatePixel(
+                            InResource, InMotionVectors, InRcasConstants, (uint32_t) sx, (uint32_t) sy);
+                    }
+                }
+            }
+
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                float topLeftY = (y + 0.5f) * scaleY - 1.5f;
+                auto tileY = (int64_t) std::floor(topLeftY) - upperLeftY;
+                auto yWeights = OS_Cpu::UpsampleWeights(CpuFrac(topLeftY));
+
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    float topLeftX = (x + 0.5f) * scaleX - 1.5f;
+                    auto tileX = (int64_t) std::floor(topLeftX) - upperLeftX;
+                    auto xWeights = OS_Cpu::UpsampleWeights(CpuFrac(topLeftX));
+
+                    auto result = CpuFloat4::Zero();
+
+                    for (int j = 0; j < 4; j++)
+                    {
+                        auto row = CpuFloat4::Zero();
+                        auto line = cache.data() + (size_t) (tileY + j) * cacheWidth + tileX;
+
+                        for (int i = 0; i < 4; i++)
+                            row += line[i] * xWeights[i];
+
+                        result += row * yWeights[j];
+                    }
+
+                    // float3 UAV, alpha is not written
+                    CpuStore(OutResource, x, y, result, 3);
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
+
+CpuImageDiff RCAS_OS_Cpu::CompareWithSequential(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                                                const RCAS_Cpu::Constants& InRcasConstants,
+                                                const OS_Cpu::Constants& InOsConstants, uint32_t InDestWidth,
+                                                uint32_t InDestHeight, float InTolerance)
+{
+    CpuTexture sharpened;
+    CpuTexture sequential(InDestWidth, InDestHeight, 4);
+    CpuTexture fused(InDestWidth, InDestHeight, 4);
+
+    if (!RCAS_Cpu::Dispatch(InResource, InMotionVectors, InRcasConstants, sharpened) ||
+        !OS_Cpu::Dispatch(sharpened, OS_Cpu::Kernel::Upsample, InOsConstants, sequential) ||
+        !Dispatch(InResource, InMotionVectors, InRcasConstants, InOsConstants, fused))
+    {
+        CpuImageDiff result {};
+        result.SizeMismatch = true;
+        return result;
+    }
+
+    return CpuCompareImages(sequential, fused, InTolerance, 3);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <shaders/rcas/RCAS_Cpu.h>
+#include <shaders/output_scaling/OS_Cpu.h>
+
+// CPU reference of rcasUpsampleCode (RCAS_OS_Common.h), RCAS_Cpu math applied to the source tile of each
+// 16x16 group and OS_Cpu::Kernel::Upsample math on the sharpened tile.
+class RCAS_OS_Cpu
+{
+  public:
+    static constexpr uint32_t NumThreadsX = 16;
+    static constexpr uint32_t NumThreadsY = 16;
+
+    // OutResource must be allocated with the output size, InMotionVectors is only needed with DynamicSharpenEnabled
+    static bool Dispatch(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                         const RCAS_Cpu::Constants& InRcasConstants, OS_Cpu::Constants InOsConstants,
+                         CpuTexture& OutResource, uint32_t InThreadCount = 0);
+
+    // Runs RCAS_Cpu::Dispatch + OS_Cpu::Dispatch (Upsample) and Dispatch on same inputs and compares rgb of the outputs
+    static CpuImageDiff CompareWithSequential(const CpuTexture& InResource, const CpuTexture* InMotionVectors,
+                                              const RCAS_Cpu::Constants& InRcasConstants,
+                                              const OS_Cpu::Constants& InOsConstants, uint32_t InDestWidth,
+                                              uint32_t InDestHeight, float InTolerance);
+};
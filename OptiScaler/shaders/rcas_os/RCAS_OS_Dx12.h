@@ -0,0 +1,70 @@
+#pragma once
+
+#include <pch.h>
+
+#include "RCAS_OS_Common.h"
+
+#include <d3d12.h>
+#include <d3dx/d3dx12.h>
+
+// RCAS and bicubic output upscaling in one pass, replaces RCAS_Dx12 + OS_Dx12 when OS_Dx12 is upsampling
+// without FSR. Reads the upscaler output and writes the final output, no intermediate buffer is needed.
+class RCAS_OS_Dx12
+{
+  private:
+    struct alignas(256) InternalConstants
+    {
+        int32_t SrcWidth;
+        int32_t SrcHeight;
+        int32_t DstWidth;
+        int32_t DstHeight;
+
+        float Sharpness;
+        float Contrast;
+
+        // Motion Vector Stuff
+        int DynamicSharpenEnabled;
+        int DisplaySizeMV;
+        int Debug;
+
+        float MotionSharpness;
+        float MotionTextureScale;
+        float MvScaleX;
+        float MvScaleY;
+        float Threshold;
+        float ScaleLimit;
+    };
+
+    std::string _name = "";
+    bool _init = false;
+    int _counter = 0;
+
+    ID3D12RootSignature* _rootSignature = nullptr;
+    ID3D12PipelineState* _pipelineState = nullptr;
+    ID3D12DescriptorHeap* _srvHeap[2] = { nullptr, nullptr };
+    D3D12_CPU_DESCRIPTOR_HANDLE _cpuSrvHandle[2] { { NULL }, { NULL } };
+    D3D12_CPU_DESCRIPTOR_HANDLE _cpuSrvHandle2[2] { { NULL }, { NULL } };
+    D3D12_CPU_DESCRIPTOR_HANDLE _cpuUavHandle[2] { { NULL }, { NULL } };
+    D3D12_CPU_DESCRIPTOR_HANDLE _cpuCbvHandle[2] { { NULL }, { NULL } };
+    D3D12_GPU_DESCRIPTOR_HANDLE _gpuSrvHandle[2] { { NULL }, { NULL } };
+    D3D12_GPU_DESCRIPTOR_HANDLE _gpuSrvHandle2[2] { { NULL }, { NULL } };
+    D3D12_GPU_DESCRIPTOR_HANDLE _gpuUavHandle[2] { { NULL }, { NULL } };
+    D3D12_GPU_DESCRIPTOR_HANDLE _gpuCbvHandle[2] { { NULL }, { NULL } };
+
+    ID3D12Device* _device = nullptr;
+    ID3D12Resource* _constantBuffer = nullptr;
+
+    UINT InNumThreadsX = 16;
+    UINT InNumThreadsY = 16;
+
+  public:
+    // InResource is the upscaler output (TargetWidth x TargetHeight), OutResource is DisplayWidth x DisplayHeight
+    bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                  ID3D12Resource* InMotionVectors, RcasConstants InConstants, ID3D12Resource* OutResource);
+
+    bool IsInit() const { return _init; }
+
+    RCAS_OS_Dx12(std::string InName, ID3D12Device* InDevice);
+
+    ~RCAS_OS_Dx12();
+};
@@ -0,0 +1,37 @@
+#include "RF_Cpu.h"
+
+bool RF_Cpu::Dispatch(const CpuTexture& InResource, const Constants& InConstants, uint32_t InWidth, uint32_t InHeight,
+                      CpuTexture& OutResource, uint32_t InThreadCount)
+{
+    if (!InResource.IsValid() || !OutResource.IsValid())
+        return false;
+
+    const auto velocityMul = CpuFloat4::Set(1.0f, -1.0f, 0.0f, 0.0f);
+
+    CpuDispatchTiles(
+        InWidth, InHeight, NumThreadsX, NumThreadsY,
+        [&](uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+        {
+            for (uint32_t y = y0; y < y1; y++)
+            {
+                if (y < InConstants.offset || y > (InConstants.height + InConstants.offset))
+                    continue;
+
+                // uint math like the shader, wrapped values end up out of bounds and get dropped
+                uint32_t destY = InConstants.height - y - InConstants.offset;
+
+                for (uint32_t x = x0; x < x1; x++)
+                {
+                    auto color = CpuLoad(InResource, x, y);
+
+                    if (InConstants.velocity != 0)
+                        color *= velocityMul;
+
+                    CpuStore(OutResource, x, destY, color, 3);
+                }
+            }
+        },
+        InThreadCount);
+
+    return true;
+}
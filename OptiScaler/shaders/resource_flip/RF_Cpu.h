@@ -0,0 +1,24 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+// CPU reference of rfCode (RF_Common.h)
+class RF_Cpu
+{
+  public:
+    // Same as the shader cbuffer, RF_Dx12 sets width/height as size - 1
+    struct Constants
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t offset;
+        uint32_t velocity;
+    };
+
+    static constexpr uint32_t NumThreadsX = 16;
+    static constexpr uint32_t NumThreadsY = 16;
+
+    // InWidth/InHeight is the dispatch area (display or render size on RF_Dx12)
+    static bool Dispatch(const CpuTexture& InResource, const Constants& InConstants, uint32_t InWidth,
+                         uint32_t InHeight, CpuTexture& OutResource, uint32_t InThreadCount = 0);
+};
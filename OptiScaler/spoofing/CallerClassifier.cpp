@@ -0,0 +1,140 @@
+#include "CallerClassifier.h"
+
+#include <algorithm>
+
+void CallerClassifier::SetModules(std::vector<ModuleRange> InModules)
+{
+    std::sort(InModules.begin(), InModules.end(),
+              [](const ModuleRange& a, const ModuleRange& b) { return a.Begin < b.Begin; });
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _modules = std::move(InModules);
+    _decisions.clear();
+    _generation++;
+}
+
+uint32_t CallerClassifier::Lookup(uint64_t InAddress) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return LookupLocked(InAddress);
+}
+
+uint32_t CallerClassifier::Classify(const void* const* InFrames, uint32_t InCount) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    uint32_t categories = 0;
+
+    for (uint32_t i = 0; i < InCount; i++)
+        categories |= LookupLocked((uint64_t) (uintptr_t) InFrames[i]);
+
+    return categories;
+}
+
+uint32_t CallerClassifier::LookupLocked(uint64_t InAddress) const
+{
+    // Last module which begins at or before the address
+    auto it = std::upper_bound(_modules.begin(), _modules.end(), InAddress,
+                               [](uint64_t address, const ModuleRange& module) { return address < module.Begin; });
+
+    if (it == _modules.begin())
+        return 0;
+
+    --it;
+    return InAddress < it->End ? it->Categories : 0;
+}
+
+uint64_t CallerClassifier::Hash(const void* const* InFrames, uint32_t InCount)
+{
+    // FNV-1a over the addresses, each one mixed first so nearby addresses spread over all bits
+    uint64_t hash = 0xcbf29ce484222325ull ^ InCount;
+
+    for (uint32_t i = 0; i < InCount; i++)
+    {
+        uint64_t value = (uint64_t) (uintptr_t) InFrames[i];
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+
+        hash = (hash ^ value) * 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+uint32_t CallerClassifier::ModuleCategories(const std::string& InModulePath)
+{
+    uint32_t categories = 0;
+
+    if (InModulePath.rfind("\\sl.") != std::string::npos)
+        categories |= Streamline;
+
+    if (InModulePath.rfind("\\libxe") != std::string::npos)
+        categories |= XeSS;
+
+    if (InModulePath.rfind("\\amd_fidelityfx") != std::string::npos)
+        categories |= Ffx;
+
+    if (InModulePath.rfind("\\ffx_fsr") != std::string::npos)
+        categories |= Fsr;
+
+    return categories;
+}
+
+bool CallerClassifier::Find(uint64_t InHash, bool& OutDecision, uint64_t& OutGeneration) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    OutGeneration = _generation;
+
+    auto found = _decisions.find(InHash);
+
+    if (found == _decisions.end())
+        return false;
+
+    OutDecision = found->second;
+    return true;
+}
+
+void CallerClassifier::Store(uint64_t InHash, bool InDecision, uint64_t InGeneration)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (InGeneration != _generation)
+        return;
+
+    if (_decisions.size() >= MaxDecisions)
+        _decisions.clear();
+
+    _decisions[InHash] = InDecision;
+}
+
+bool CallerClassifier::Refresh()
+{
+    if (!_stale.exchange(false))
+        return false;
+
+    ClearDecisions();
+    return true;
+}
+
+void CallerClassifier::ClearDecisions()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _decisions.clear();
+    _generation++;
+}
+
+size_t CallerClassifier::ModuleCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _modules.size();
+}
+
+size_t CallerClassifier::DecisionCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _decisions.size();
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Caller checks of DXGI spoofing (Dxgi_Spoofing.h SkipSpoofing).
+// Return addresses of a captured stack are mapped to module categories with a sorted module range table and the
+// decision made for a stack is remembered by a hash of its return addresses, so symbol lookups only run the first
+// time a call stack is seen. Table and decisions are dropped when a dll is loaded or unloaded.
+// Nothing in here depends on Windows headers so it can be built anywhere.
+class CallerClassifier
+{
+  public:
+    struct ModuleRange
+    {
+        uint64_t Begin = 0;
+        uint64_t End = 0; // Exclusive
+        uint32_t Categories = 0;
+    };
+
+    // Module categories of the file based check
+    enum Category : uint32_t
+    {
+        Streamline = 1u << 0,
+        XeSS = 1u << 1,
+        Ffx = 1u << 2,
+        Fsr = 1u << 3,
+    };
+
+    // Decisions are dropped when this many stacks are cached, games only use a handful
+    static constexpr size_t MaxDecisions = 1024;
+
+    // Replaces the module table, ranges can be in any order but shouldn't overlap. Drops cached decisions.
+    void SetModules(std::vector<ModuleRange> InModules);
+
+    // Categories of the module which contains the address, 0 when it's in none of them
+    uint32_t Lookup(uint64_t InAddress) const;
+
+    // Categories of all frames combined
+    uint32_t Classify(const void* const* InFrames, uint32_t InCount) const;
+
+    static uint64_t Hash(const void* const* InFrames, uint32_t InCount);
+
+    // Categories of a module by its full path (GetModuleFileNameA), 0 for modules which never change a decision
+    static uint32_t ModuleCategories(const std::string& InModulePath);
+
+    // OutGeneration should be passed to Store, a decision made before a refresh is not stored
+    bool Find(uint64_t InHash, bool& OutDecision, uint64_t& OutGeneration) const;
+    void Store(uint64_t InHash, bool InDecision, uint64_t InGeneration);
+
+    // Only sets a flag, safe to call from a dll notification while the loader lock is held
+    void Invalidate() { _stale.store(true); }
+
+    // True once after Invalidate (and on first call), decisions are dropped and module table should be rebuilt
+    bool Refresh();
+
+    void ClearDecisions();
+
+    size_t ModuleCount() const;
+    size_t DecisionCount() const;
+
+  private:
+    mutable std::mutex _mutex;
+    std::vector<ModuleRange> _modules;
+    std::unordered_map<uint64_t, bool> _decisions;
+    uint64_t _generation = 0;
+    std::atomic<bool> _stale = true;
+
+    uint32_t LookupLocked(uint64_t InAddress) const;
+};
@@ -12,12 +12,17 @@
 
 #define METHOD_BASED_SPOOFING_CHECK
 
+#ifndef METHOD_BASED_SPOOFING_CHECK
+// #define FILE_BASED_SPOOFING_CHECK
+#endif
+
 #ifdef METHOD_BASED_SPOOFING_CHECK
 #include <DbgHelp.h>
 #endif
 
-#ifndef METHOD_BASED_SPOOFING_CHECK
-// #define FILE_BASED_SPOOFING_CHECK
+#if defined(METHOD_BASED_SPOOFING_CHECK) || defined(FILE_BASED_SPOOFING_CHECK)
+#include <Psapi.h>
+#include <spoofing/CallerClassifier.h>
 #endif
 
 #pragma intrinsic(_ReturnAddress)
@@ -54,125 +59,226 @@ void AttachToFactory(IUnknown* unkFactory);
 
 #pragma region DXGI Adapter methods
 
+#if defined(METHOD_BASED_SPOOFING_CHECK) || defined(FILE_BASED_SPOOFING_CHECK)
+
+// Decisions of already seen call stacks, symbol lookups only run for new stacks. Shared by all translation units
+// so there is one dll notification.
+inline CallerClassifier spoofingCallers;
+
+// Module table of the file based check, compiled with the method based one too so it keeps building
+inline void RefreshSpoofingModules()
+{
+    HANDLE process = GetCurrentProcess();
+    std::vector<HMODULE> handles(256);
+    DWORD needed = 0;
+
+    while (EnumProcessModules(process, handles.data(), (DWORD) (handles.size() * sizeof(HMODULE)), &needed) &&
+           needed > handles.size() * sizeof(HMODULE))
+    {
+        handles.resize(needed / sizeof(HMODULE));
+    }
+
+    handles.resize(std::min<size_t>(handles.size(), needed / sizeof(HMODULE)));
+
+    std::vector<CallerClassifier::ModuleRange> modules;
+
+    for (auto handle : handles)
+    {
+        char moduleName[MAX_PATH];
+        MODULEINFO info {};
+
+        if (!GetModuleFileNameA(handle, moduleName, MAX_PATH) ||
+            !GetModuleInformation(process, handle, &info, sizeof(info)))
+            continue;
+
+        // Others would never change a decision
+        if (auto categories = CallerClassifier::ModuleCategories(moduleName); categories != 0)
+        {
+            auto base = (uint64_t) (uintptr_t) info.lpBaseOfDll;
+            modules.push_back({ base, base + info.SizeOfImage, categories });
+        }
+    }
+
+    LOG_DEBUG("{} of {} modules are upscaler modules", modules.size(), handles.size());
+    spoofingCallers.SetModules(std::move(modules));
+}
+
+// Not in the SDK headers, a load or unload only invalidates the cache
+typedef VOID(CALLBACK* PFN_LdrDllNotification)(ULONG NotificationReason, const void* NotificationData, PVOID Context);
+typedef LONG(NTAPI* PFN_LdrRegisterDllNotification)(ULONG Flags, PFN_LdrDllNotification NotificationFunction,
+                                                    PVOID Context, PVOID* Cookie);
+typedef LONG(NTAPI* PFN_LdrUnregisterDllNotification)(PVOID Cookie);
+
+inline PVOID spoofingNotificationCookie = nullptr;
+
+inline VOID CALLBACK SpoofingDllNotification(ULONG NotificationReason, const void* NotificationData, PVOID Context)
+{
+    spoofingCallers.Invalidate();
+}
+
+// Decisions are only cached when loads and unloads can be seen
+inline bool SpoofingDecisionCacheActive()
+{
+    static bool active = []
+    {
+        auto ntdll = GetModuleHandleA("ntdll.dll");
+        PFN_LdrRegisterDllNotification registerNotification = nullptr;
+
+        if (ntdll != nullptr)
+            registerNotification = (PFN_LdrRegisterDllNotification) GetProcAddress(ntdll, "LdrRegisterDllNotification");
+
+        if (registerNotification == nullptr ||
+            registerNotification(0, SpoofingDllNotification, nullptr, &spoofingNotificationCookie) != 0)
+        {
+            LOG_WARN("Can't register dll notification, spoofing decisions won't be cached");
+            return false;
+        }
+
+        return true;
+    }();
+
+    // Unregistered while unloading
+    return active && spoofingNotificationCookie != nullptr;
+}
+
+// Called from DLL_PROCESS_DETACH, otherwise next load or unload would call the callback in the freed dll
+inline void UnregisterSpoofingDllNotification()
+{
+    if (spoofingNotificationCookie == nullptr)
+        return;
+
+    auto ntdll = GetModuleHandleA("ntdll.dll");
+    PFN_LdrUnregisterDllNotification unregisterNotification = nullptr;
+
+    if (ntdll != nullptr)
+        unregisterNotification =
+            (PFN_LdrUnregisterDllNotification) GetProcAddress(ntdll, "LdrUnregisterDllNotification");
+
+    if (unregisterNotification != nullptr && unregisterNotification(spoofingNotificationCookie) == 0)
+        spoofingNotificationCookie = nullptr;
+}
+#else
+inline void UnregisterSpoofingDllNotification() {}
+#endif
+
 inline static bool SkipSpoofing()
 {
     auto skip = !Config::Instance()->DxgiSpoofing.value_or_default() ||
-                State::Instance().skipSpoofing; // || State::Instance().isRunningOnLinux;
+                State::Instance().skipSpoofing ||
+                State::InWarmCreation(); // || State::Instance().isRunningOnLinux;
 
     if (skip)
     {
         LOG_TRACE("DxgiSpoofing: {}, skipSpoofing: {}, skipping spoofing",
-                  Config::Instance()->DxgiSpoofing.value_or_default(), State::Instance().skipSpoofing);
+                  Config::Instance()->DxgiSpoofing.value_or_default(), (bool) State::Instance().skipSpoofing);
 
         return true;
     }
 
-#ifdef METHOD_BASED_SPOOFING_CHECK || FILE_BASED_SPOOFING_CHECK
+#if defined(METHOD_BASED_SPOOFING_CHECK) || defined(FILE_BASED_SPOOFING_CHECK)
+#ifdef METHOD_BASED_SPOOFING_CHECK
+    // Blacklist is only checked when there is one
+    if (!Config::Instance()->DxgiBlacklist.has_value())
+        return skip;
 
-    HANDLE process = GetCurrentProcess();
+    // Decisions were made for the blacklist they were checked against
+    static std::string lastBlacklist;
+    static std::mutex blacklistMutex;
 
-#ifdef FILE_BASED_SPOOFING_CHECK
-    if (!skip /*&& Config::Instance()->DxgiBlacklist.has_value()*/ && process != nullptr)
     {
-        skip = true;
-
-        // File based spoofing
-        SymInitialize(process, NULL, TRUE);
-
-        // Capture stack trace
-        const int maxFrames = 64;
-        void* stack[maxFrames];
-        USHORT frames = CaptureStackBackTrace(0, maxFrames, stack, NULL);
+        std::lock_guard<std::mutex> lock(blacklistMutex);
 
-        size_t pos_streamline = std::string::npos;
-        size_t pos_intel = std::string::npos;
-        size_t pos_ffx = std::string::npos;
-        size_t pos_fsr = std::string::npos;
-
-        for (USHORT i = 0; i < frames; ++i)
+        if (lastBlacklist != Config::Instance()->DxgiBlacklist.value())
         {
-            DWORD64 address = (DWORD64) (stack[i]);
-            DWORD64 moduleBase = SymGetModuleBase64(process, address);
+            lastBlacklist = Config::Instance()->DxgiBlacklist.value();
+            spoofingCallers.ClearDecisions();
+        }
+    }
+#endif
 
-            if (moduleBase)
-            {
-                char moduleName[MAX_PATH];
-                if (GetModuleFileNameA((HINSTANCE) moduleBase, moduleName, MAX_PATH))
-                {
-                    std::string module(moduleName);
+    // Walk the call stack to find the DLL that is calling the hooked function
+    const int maxFrames = 64;
+    void* callers[maxFrames];
+    USHORT frames = CaptureStackBackTrace(0, maxFrames, callers, NULL);
 
-                    if (pos_streamline == std::string::npos)
-                        pos_streamline = module.rfind("\\sl.");
+    bool cacheActive = SpoofingDecisionCacheActive();
 
-                    if (pos_intel == std::string::npos)
-                        pos_intel = module.rfind("\\libxe");
+#ifdef FILE_BASED_SPOOFING_CHECK
+    if (spoofingCallers.Refresh() || !cacheActive)
+        RefreshSpoofingModules();
+#else
+    spoofingCallers.Refresh();
+#endif
 
-                    if (pos_ffx == std::string::npos)
-                        pos_ffx = module.rfind("\\amd_fidelityfx");
+    auto stackHash = CallerClassifier::Hash(callers, frames);
+    uint64_t generation = 0;
 
-                    if (pos_fsr == std::string::npos)
-                        pos_fsr = module.rfind("\\ffx_fsr");
-                }
-            }
-        }
+    if (cacheActive && spoofingCallers.Find(stackHash, skip, generation))
+    {
+        LOG_TRACE("cached decision, skip: {}", skip);
+        return skip;
+    }
 
-        SymCleanup(process);
+#ifdef FILE_BASED_SPOOFING_CHECK
+    // File based spoofing
+    auto categories = spoofingCallers.Classify(callers, frames);
 
-        //&& pos_streamline == std::string::npos;
-        skip = pos_intel != std::string::npos && pos_ffx != std::string::npos && pos_fsr != std::string::npos;
+    //&& !(categories & CallerClassifier::Streamline);
+    skip = (categories & CallerClassifier::XeSS) && (categories & CallerClassifier::Ffx) &&
+           (categories & CallerClassifier::Fsr);
 #endif
 
 #ifdef METHOD_BASED_SPOOFING_CHECK
-        if (!skip && Config::Instance()->DxgiBlacklist.has_value() && process != nullptr)
-        {
-            skip = true;
+    HANDLE process = GetCurrentProcess();
 
-            // Walk the call stack to find the DLL that is calling the hooked function
-            void* callers[100];
+    if (!skip && process != nullptr)
+    {
+        skip = true;
 
-            unsigned short frames = CaptureStackBackTrace(0, 100, callers, NULL);
+        if (SymInitialize(process, NULL, TRUE))
+        {
+            SYMBOL_INFO* symbol = (SYMBOL_INFO*) calloc(sizeof(SYMBOL_INFO) + 256 * sizeof(char), 1);
 
-            if (SymInitialize(process, NULL, TRUE))
+            if (symbol != nullptr)
             {
-                SYMBOL_INFO* symbol = (SYMBOL_INFO*) calloc(sizeof(SYMBOL_INFO) + 256 * sizeof(char), 1);
+                symbol->MaxNameLen = 255;
+                symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
 
-                if (symbol != nullptr)
+                for (unsigned int i = 0; i < frames; i++)
                 {
-                    symbol->MaxNameLen = 255;
-                    symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
-
-                    for (unsigned int i = 0; i < frames; i++)
+                    if (SymFromAddr(process, (DWORD64) callers[i], 0, symbol))
                     {
-                        if (SymFromAddr(process, (DWORD64) callers[i], 0, symbol))
-                        {
-                            auto sn = std::string(symbol->Name);
-                            auto pos = Config::Instance()->DxgiBlacklist.value().rfind(sn);
+                        auto sn = std::string(symbol->Name);
+                        auto pos = Config::Instance()->DxgiBlacklist.value().rfind(sn);
 
-                            LOG_DEBUG("checking for: {0} ({1})", sn, i);
+                        LOG_DEBUG("checking for: {0} ({1})", sn, i);
 
-                            if (pos != std::string::npos)
-                            {
-                                LOG_INFO("spoofing for: {0}", sn);
-                                skip = false;
-                                break;
-                            }
+                        if (pos != std::string::npos)
+                        {
+                            LOG_INFO("spoofing for: {0}", sn);
+                            skip = false;
+                            break;
                         }
                     }
-
-                    free(symbol);
                 }
 
-                SymCleanup(process);
+                free(symbol);
             }
-#endif
 
-            if (skip)
-                LOG_DEBUG("skipping spoofing, blacklisting active");
+            SymCleanup(process);
         }
+    }
 #endif
 
-        return skip;
-    }
+    if (skip)
+        LOG_DEBUG("skipping spoofing, blacklisting active");
+
+    if (cacheActive)
+        spoofingCallers.Store(stackHash, skip, generation);
+#endif
+
+    return skip;
+}
 
     inline static HRESULT hkGetDesc3(IDXGIAdapter4 * This, DXGI_ADAPTER_DESC3 * pDesc)
     {
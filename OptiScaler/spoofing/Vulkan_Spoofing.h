@@ -111,7 +111,7 @@ inline static void hkvkGetPhysicalDeviceProperties(VkPhysicalDevice physical_dev
                                  Config::Instance()->TargetDeviceId.value() == properties->deviceID;
 
     // Spoof
-    if (!State::Instance().skipSpoofing && targetVendorIdMatches && targetDeviceIdMatches)
+    if (!State::Instance().skipSpoofing && !State::InWarmCreation() && targetVendorIdMatches && targetDeviceIdMatches)
     {
         auto deviceName = wstring_to_string(Config::Instance()->SpoofedGPUName.value_or_default());
         std::strcpy(properties->deviceName, deviceName.c_str());
@@ -148,7 +148,7 @@ inline static void hkvkGetPhysicalDeviceProperties2(VkPhysicalDevice phys_dev, V
                                  Config::Instance()->TargetDeviceId.value() == properties2->properties.deviceID;
 
     // Spoof
-    if (!State::Instance().skipSpoofing && targetVendorIdMatches && targetDeviceIdMatches)
+    if (!State::Instance().skipSpoofing && !State::InWarmCreation() && targetVendorIdMatches && targetDeviceIdMatches)
     {
         auto deviceName = wstring_to_string(Config::Instance()->SpoofedGPUName.value_or_default());
         std::strcpy(properties2->properties.deviceName, deviceName.c_str());
@@ -204,7 +204,7 @@ inline static void hkvkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice phys_dev
                                  Config::Instance()->TargetDeviceId.value() == properties2->properties.deviceID;
 
     // Spoof
-    if (!State::Instance().skipSpoofing && targetVendorIdMatches && targetDeviceIdMatches)
+    if (!State::Instance().skipSpoofing && !State::InWarmCreation() && targetVendorIdMatches && targetDeviceIdMatches)
     {
         auto deviceName = wstring_to_string(Config::Instance()->SpoofedGPUName.value_or_default());
         std::strcpy(properties2->properties.deviceName, deviceName.c_str());
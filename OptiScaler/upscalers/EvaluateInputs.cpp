@@ -0,0 +1,87 @@
+#include "EvaluateInputs.h"
+
+static bool GetResource(const NVSDK_NGX_Parameter* InParameters, const char* InName, EvaluateInputs::Api InApi,
+                        void*& OutResource)
+{
+    OutResource = nullptr;
+
+    // Typed query first, parameters set as void* are returned by it too
+    if (InApi == EvaluateInputs::Dx12 &&
+        InParameters->Get(InName, (ID3D12Resource**) &OutResource) == NVSDK_NGX_Result_Success)
+        return true;
+
+    if (InApi == EvaluateInputs::Dx11 &&
+        InParameters->Get(InName, (ID3D11Resource**) &OutResource) == NVSDK_NGX_Result_Success)
+        return true;
+
+    return InParameters->Get(InName, &OutResource) == NVSDK_NGX_Result_Success;
+}
+
+void EvaluateInputs::ReadRenderSize(const NVSDK_NGX_Parameter* InParameters)
+{
+    HasSubrect = InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &SubrectWidth) ==
+                     NVSDK_NGX_Result_Success &&
+                 InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, &SubrectHeight) ==
+                     NVSDK_NGX_Result_Success;
+
+    if (!HasSubrect)
+    {
+        HasSize = InParameters->Get(NVSDK_NGX_Parameter_Width, &Width) == NVSDK_NGX_Result_Success &&
+                  InParameters->Get(NVSDK_NGX_Parameter_Height, &Height) == NVSDK_NGX_Result_Success;
+
+        HasOutSize = HasSize &&
+                     InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &OutWidth) == NVSDK_NGX_Result_Success &&
+                     InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &OutHeight) == NVSDK_NGX_Result_Success;
+    }
+
+    // Both are read even if one is missing, backends used to query them separately
+    auto hasJitterX = InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &JitterX) == NVSDK_NGX_Result_Success;
+    auto hasJitterY = InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &JitterY) == NVSDK_NGX_Result_Success;
+    HasJitter = hasJitterX && hasJitterY;
+}
+
+void EvaluateInputs::Read(const NVSDK_NGX_Parameter* InParameters, Api InApi)
+{
+    *this = {};
+
+    if (InParameters == nullptr)
+        return;
+
+    GetResource(InParameters, NVSDK_NGX_Parameter_Color, InApi, Color);
+    GetResource(InParameters, NVSDK_NGX_Parameter_MotionVectors, InApi, MotionVectors);
+    GetResource(InParameters, NVSDK_NGX_Parameter_Output, InApi, Output);
+    GetResource(InParameters, NVSDK_NGX_Parameter_Depth, InApi, Depth);
+    GetResource(InParameters, NVSDK_NGX_Parameter_ExposureTexture, InApi, Exposure);
+    GetResource(InParameters, "FSR.transparencyAndComposition", InApi, TransparencyAndComposition);
+    GetResource(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, InApi, BiasColorMask);
+    HasReactive = GetResource(InParameters, "FSR.reactive", InApi, Reactive);
+
+    ReadRenderSize(InParameters);
+
+    HasMVScale = InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
+                 InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success;
+
+    if (!HasMVScale)
+    {
+        MVScaleX = 1.0f;
+        MVScaleY = 1.0f;
+    }
+
+    InParameters->Get(NVSDK_NGX_Parameter_Reset, &Reset);
+
+    HasFrameTimeDelta =
+        InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &FrameTimeDelta) == NVSDK_NGX_Result_Success;
+
+    HasPreExposure = InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &PreExposure) == NVSDK_NGX_Result_Success;
+
+    if (!HasPreExposure)
+        PreExposure = 1.0f;
+
+    HasExposureScale =
+        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &ExposureScale) == NVSDK_NGX_Result_Success;
+
+    if (!HasExposureScale)
+        ExposureScale = 1.0f;
+
+    HasSharpness = InParameters->Get(NVSDK_NGX_Parameter_Sharpness, &Sharpness) == NVSDK_NGX_Result_Success;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+#include <nvsdk_ngx.h>
+#include <nvsdk_ngx_defs.h>
+
+// Per frame inputs of an evaluate call, read once from the NVNGX parameters by the inputs layer
+// so backends don't query the same parameters again (every query locks and searches the parameter map).
+// Resources are ID3D11Resource*, ID3D12Resource* or NVSDK_NGX_Resource_VK* depending on Api.
+struct EvaluateInputs
+{
+    enum Api : uint32_t
+    {
+        Dx11 = 0,
+        Dx12,
+        Vulkan,
+    };
+
+    void* Color = nullptr;
+    void* MotionVectors = nullptr;
+    void* Output = nullptr;
+    void* Depth = nullptr;
+    void* Exposure = nullptr;
+    void* TransparencyAndComposition = nullptr;
+    void* Reactive = nullptr;
+    void* BiasColorMask = nullptr;
+    bool HasReactive = false; // FSR.reactive is set, even if it's null
+
+    float JitterX = 0.0f;
+    float JitterY = 0.0f;
+    bool HasJitter = false;
+
+    float MVScaleX = 1.0f;
+    float MVScaleY = 1.0f;
+    bool HasMVScale = false;
+
+    unsigned int Reset = 0;
+
+    float FrameTimeDelta = 0.0f; // NVSDK_NGX_Parameter_FrameTimeDeltaInMsec
+    bool HasFrameTimeDelta = false;
+
+    float PreExposure = 1.0f;
+    bool HasPreExposure = false;
+
+    float ExposureScale = 1.0f;
+    bool HasExposureScale = false;
+
+    float Sharpness = 0.0f;
+    bool HasSharpness = false;
+
+    unsigned int SubrectWidth = 0;
+    unsigned int SubrectHeight = 0;
+    bool HasSubrect = false;
+
+    unsigned int Width = 0;
+    unsigned int Height = 0;
+    bool HasSize = false;
+
+    unsigned int OutWidth = 0;
+    unsigned int OutHeight = 0;
+    bool HasOutSize = false;
+
+    void Read(const NVSDK_NGX_Parameter* InParameters, Api InApi);
+
+    // Only render size & jitter, used when evaluate is called without inputs
+    void ReadRenderSize(const NVSDK_NGX_Parameter* InParameters);
+};
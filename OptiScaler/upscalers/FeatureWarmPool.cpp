@@ -0,0 +1,142 @@
+#include "FeatureWarmPool.h"
+
+#include <algorithm>
+
+FeatureWarmPool::Action FeatureWarmPool::Request(const Key& InKey)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto state = _state.load();
+
+    switch (state)
+    {
+    case Requested:
+    case Creating:
+        // Worker can't be cancelled, result will be discarded if the key changed
+        return Wait;
+
+    case Ready:
+        return _key.Covers(InKey) ? Wait : Discard;
+
+    case Failed:
+        if (_key.Covers(InKey))
+            return Synchronous;
+
+        break;
+
+    default:
+        break;
+    }
+
+    _key = InKey;
+    _state.store(Requested);
+
+    return Start;
+}
+
+bool FeatureWarmPool::BeginCreate(Key& OutKey)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_state.load() != Requested)
+        return false;
+
+    OutKey = _key;
+    _state.store(Creating);
+
+    return true;
+}
+
+void FeatureWarmPool::Created(bool InSuccess)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_state.load() != Creating)
+        return;
+
+    if (!InSuccess)
+        _failed++;
+
+    _state.store(InSuccess ? Ready : Failed);
+}
+
+bool FeatureWarmPool::Take(const Key& InKey)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_state.load() != Ready || !_key.Covers(InKey))
+        return false;
+
+    _state.store(Empty);
+    _taken++;
+
+    return true;
+}
+
+void FeatureWarmPool::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto state = _state.load();
+    if (state == Ready || state == Failed)
+        _state.store(Empty);
+}
+
+bool FeatureWarmPool::IsBusy() const
+{
+    auto state = _state.load();
+    return state == Requested || state == Creating;
+}
+
+FeatureWarmPool::Key FeatureWarmPool::ReadyKey() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _key;
+}
+
+void FeatureWarmPool::Observe(const Key& InCurrent)
+{
+    auto sameOutput = [&InCurrent](const Key& entry)
+    { return entry.DisplayWidth == InCurrent.DisplayWidth && entry.DisplayHeight == InCurrent.DisplayHeight; };
+
+    auto it = std::find_if(_outputHistory.begin(), _outputHistory.end(), sameOutput);
+
+    // Bucket keeps the largest render size used with the output resolution
+    auto key = InCurrent;
+
+    if (it != _outputHistory.end())
+    {
+        key.RenderWidth = std::max(key.RenderWidth, it->RenderWidth);
+        key.RenderHeight = std::max(key.RenderHeight, it->RenderHeight);
+        _outputHistory.erase(it);
+    }
+
+    _outputHistory.insert(_outputHistory.begin(), key);
+
+    if (_outputHistory.size() > MaxOutputHistory)
+        _outputHistory.pop_back();
+}
+
+bool FeatureWarmPool::Predict(const Key& InCurrent, const std::string& InSelectedBackend, Key& OutKey) const
+{
+    if (!InSelectedBackend.empty() && InSelectedBackend != InCurrent.Backend)
+    {
+        OutKey = InCurrent;
+        OutKey.Backend = InSelectedBackend;
+        return true;
+    }
+
+    for (auto& entry : _outputHistory)
+    {
+        if (entry.DisplayWidth == InCurrent.DisplayWidth && entry.DisplayHeight == InCurrent.DisplayHeight)
+            continue;
+
+        OutKey = entry;
+        OutKey.Backend = InCurrent.Backend;
+        OutKey.PerfQuality = InCurrent.PerfQuality;
+        OutKey.Flags = InCurrent.Flags;
+        return true;
+    }
+
+    return false;
+}
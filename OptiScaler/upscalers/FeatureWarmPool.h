@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Lifecycle of an upscaler feature which is created in background while the current one keeps upscaling.
+// Evaluate thread requests a feature for a key (backend & creation parameters), worker creates it and
+// evaluate thread takes it when it's ready and the key still matches.
+// Empty -> Requested -> Creating -> Ready -> (Take) Empty, failed creation is not retried for the same key.
+// Predict picks the likely next feature to create before it's needed: the backend selected in the menu but
+// not applied yet, otherwise the previously used output resolution (dynamic output).
+// Only the state is kept here, created feature is owned by the caller.
+class FeatureWarmPool
+{
+  public:
+    static constexpr size_t MaxOutputHistory = 4;
+
+    enum SlotState : uint32_t
+    {
+        Empty = 0,
+        Requested,
+        Creating,
+        Ready,
+        Failed,
+    };
+
+    // RenderWidth/Height are the max render size (DRS bucket) the feature is created for
+    struct Key
+    {
+        std::string Backend;
+        uint32_t RenderWidth = 0;
+        uint32_t RenderHeight = 0;
+        uint32_t DisplayWidth = 0;
+        uint32_t DisplayHeight = 0;
+        uint32_t PerfQuality = 0;
+        int Flags = 0;
+
+        bool operator==(const Key& other) const
+        {
+            return Backend == other.Backend && RenderWidth == other.RenderWidth && RenderHeight == other.RenderHeight &&
+                   DisplayWidth == other.DisplayWidth && DisplayHeight == other.DisplayHeight &&
+                   PerfQuality == other.PerfQuality && Flags == other.Flags;
+        }
+
+        // Feature created for this key can be used for InWanted, smaller render sizes fit in the bucket
+        bool Covers(const Key& InWanted) const
+        {
+            return Backend == InWanted.Backend && RenderWidth >= InWanted.RenderWidth &&
+                   RenderHeight >= InWanted.RenderHeight && DisplayWidth == InWanted.DisplayWidth &&
+                   DisplayHeight == InWanted.DisplayHeight && PerfQuality == InWanted.PerfQuality &&
+                   Flags == InWanted.Flags;
+        }
+    };
+
+    enum Action : uint32_t
+    {
+        Wait = 0,    // Feature for the key is being created, keep using current one
+        Start,       // Worker should be started for the key
+        Discard,     // Ready feature has a different key, caller should release it and request again
+        Synchronous, // Creation failed for the key, change backend the old way
+    };
+
+  private:
+    mutable std::mutex _mutex;
+    std::atomic<uint32_t> _state { Empty };
+    Key _key;
+
+    // Most recent first, one entry per output resolution
+    std::vector<Key> _outputHistory;
+
+    uint64_t _taken = 0;
+    uint64_t _failed = 0;
+
+  public:
+    // Called from evaluate thread for the wanted feature
+    Action Request(const Key& InKey);
+
+    // Worker side, returns false when there is no pending request
+    bool BeginCreate(Key& OutKey);
+    void Created(bool InSuccess);
+
+    // Returns true when a ready feature covering InKey can be used, slot becomes empty
+    bool Take(const Key& InKey);
+
+    // Forgets ready or failed feature, caller releases it
+    void Clear();
+
+    // Evaluate thread, records the key of the feature in use
+    void Observe(const Key& InCurrent);
+
+    // Likely next feature for InCurrent, InSelectedBackend is the backend selected in the menu ("" if none)
+    bool Predict(const Key& InCurrent, const std::string& InSelectedBackend, Key& OutKey) const;
+
+    SlotState State() const { return (SlotState) _state.load(); }
+    bool IsBusy() const;
+    Key ReadyKey() const;
+    uint64_t TakenCount() const { return _taken; }
+    uint64_t FailedCount() const { return _failed; }
+};
@@ -0,0 +1,29 @@
+#include "FrameRing.h"
+
+#include <algorithm>
+
+FrameRing::FrameRing(uint32_t InDepth) : _depth(std::clamp(InDepth, 2u, MaxDepth)) {}
+
+FrameRing::Frame FrameRing::Begin(uint64_t InCompletedValue)
+{
+    Frame frame {};
+    frame.Slot = _slot;
+
+    if (_slotValues[_slot] > InCompletedValue)
+    {
+        frame.WaitValue = _slotValues[_slot];
+        _cpuWaits++;
+    }
+
+    return frame;
+}
+
+uint64_t FrameRing::Submit()
+{
+    _lastValue++;
+    _slotValues[_slot] = _lastValue;
+    _slot = (_slot + 1) % _depth;
+
+    return _lastValue;
+}
+
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Fence value bookkeeping for a ring of per frame resources (command allocators, lists etc.)
+// Each submitted frame gets a new fence value, a slot can only be reused after the value it
+// was submitted with is completed. CPU only needs to wait when all slots are in flight.
+class FrameRing
+{
+  public:
+    static constexpr uint32_t MaxDepth = 4;
+
+    struct Frame
+    {
+        uint32_t Slot = 0;
+        uint64_t WaitValue = 0; // 0 when slot is free, otherwise CPU should wait for this fence value
+    };
+
+  private:
+    uint32_t _depth = 2;
+    uint32_t _slot = 0;
+    uint64_t _lastValue = 0;
+    uint64_t _cpuWaits = 0;
+    std::array<uint64_t, MaxDepth> _slotValues {};
+
+  public:
+    // Slot of the frame being recorded
+    uint32_t Slot() const { return _slot; }
+    uint32_t Depth() const { return _depth; }
+
+    // Fence value of last submitted frame, waiting for it drains the ring
+    uint64_t LastValue() const { return _lastValue; }
+    uint64_t CpuWaitCount() const { return _cpuWaits; }
+
+    // Checks if current slot is still in flight with the completed fence value
+    Frame Begin(uint64_t InCompletedValue);
+
+    // Stores next fence value to current slot, advances ring and returns the value to signal
+    uint64_t Submit();
+
+    FrameRing() = default;
+    explicit FrameRing(uint32_t InDepth);
+};
@@ -157,42 +157,48 @@ bool IFeature::SetInitParameters(NVSDK_NGX_Parameter* InParameters)
 
 void IFeature::GetRenderResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth, unsigned int* OutHeight)
 {
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, OutWidth) !=
-            NVSDK_NGX_Result_Success ||
-        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, OutHeight) !=
-            NVSDK_NGX_Result_Success)
+    EvaluateInputs inputs {};
+    inputs.ReadRenderSize(InParameters);
+
+    GetRenderResolution(inputs, OutWidth, OutHeight);
+
+    if (!_readsInputs)
+        AnalyzeJitter(inputs);
+}
+
+void IFeature::GetRenderResolution(const EvaluateInputs& InInputs, unsigned int* OutWidth, unsigned int* OutHeight)
+{
+    if (InInputs.HasSubrect)
+    {
+        *OutWidth = InInputs.SubrectWidth;
+        *OutHeight = InInputs.SubrectHeight;
+    }
+    else
     {
         LOG_WARN("No subrect dimension info!");
 
-        unsigned int width;
-        unsigned int height;
-        unsigned int outWidth;
-        unsigned int outHeight;
-
         do
         {
-            if (InParameters->Get(NVSDK_NGX_Parameter_Width, &width) == NVSDK_NGX_Result_Success &&
-                InParameters->Get(NVSDK_NGX_Parameter_Height, &height) == NVSDK_NGX_Result_Success)
+            if (InInputs.HasSize)
             {
-                if (InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &outWidth) == NVSDK_NGX_Result_Success &&
-                    InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &outHeight) == NVSDK_NGX_Result_Success)
+                if (InInputs.HasOutSize)
                 {
-                    if (width < outWidth)
+                    if (InInputs.Width < InInputs.OutWidth)
                     {
-                        *OutWidth = width;
-                        *OutHeight = height;
+                        *OutWidth = InInputs.Width;
+                        *OutHeight = InInputs.Height;
                         break;
                     }
 
-                    *OutWidth = outWidth;
-                    *OutHeight = outHeight;
+                    *OutWidth = InInputs.OutWidth;
+                    *OutHeight = InInputs.OutHeight;
                 }
                 else
                 {
-                    if (width < RenderWidth())
+                    if (InInputs.Width < RenderWidth())
                     {
-                        *OutWidth = width;
-                        *OutHeight = height;
+                        *OutWidth = InInputs.Width;
+                        *OutHeight = InInputs.Height;
                         break;
                     }
 
@@ -219,13 +225,64 @@ void IFeature::GetRenderResolution(NVSDK_NGX_Parameter* InParameters, unsigned i
     //	InParameters->Set(NVSDK_NGX_Parameter_Scale, 1.0f);
     //	InParameters->Set(NVSDK_NGX_Parameter_SuperSampling_ScaleFactor, 1.0f);
     // }
+}
+
+const EvaluateInputs& IFeature::ReadInputs(const NVSDK_NGX_Parameter* InParameters, EvaluateInputs::Api InApi)
+{
+    _inputs.Read(InParameters, InApi);
+    _readsInputs = true;
+
+    AnalyzeJitter(_inputs);
+
+    // Upscalers expect jitter in render pixels, analyzer uses the raw values
+    if (_inputs.HasJitter && Config::Instance()->JitterUnitCorrection.value_or_default())
+    {
+        _inputs.JitterX *= _jitter.PixelScaleX(_renderWidth);
+        _inputs.JitterY *= _jitter.PixelScaleY(_renderHeight);
+    }
+
+    return _inputs;
+}
+
+void IFeature::AnalyzeJitter(const EvaluateInputs& InInputs)
+{
+    if (!InInputs.HasJitter)
+        return;
+
+    _jitter.AddSample(InInputs.JitterX, InInputs.JitterY, _renderWidth, _renderHeight);
+
+    if (_jitter.ResetDetected())
+        LOG_DEBUG("Jitter sequence reset, phase count: {}", _jitter.Period());
+
+    if (_jitter.Period() != _loggedJitterPeriod)
+    {
+        _loggedJitterPeriod = _jitter.Period();
+
+        if (_loggedJitterPeriod > 1 && _renderWidth > 0)
+        {
+            LOG_INFO("Jitter phase count: {}, implied ratio: {:.2f}, current ratio: {:.2f}", _loggedJitterPeriod,
+                     _jitter.ImpliedRatio(), (float) _displayWidth / (float) _renderWidth);
+        }
+        else
+        {
+            LOG_INFO("Jitter phase count: {}", _loggedJitterPeriod);
+        }
+    }
 
-    JitterInfo ji {};
-    if (_jitterInfo.size() < 350 &&
-        InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &ji.x) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &ji.y) == NVSDK_NGX_Result_Success)
+    if (_jitter.JitterUnits() != _loggedJitterUnits)
     {
-        _jitterInfo.insert(std::make_pair(ji.x, ji.y));
+        _loggedJitterUnits = _jitter.JitterUnits();
+
+        if (_loggedJitterUnits == JitterAnalyzer::Units::Ndc || _loggedJitterUnits == JitterAnalyzer::Units::Uv)
+        {
+            LOG_WARN("Jitter is in {} units instead of pixels, correction: {}",
+                     _loggedJitterUnits == JitterAnalyzer::Units::Ndc ? "NDC" : "UV",
+                     Config::Instance()->JitterUnitCorrection.value_or_default());
+        }
+        else if (_loggedJitterUnits == JitterAnalyzer::Units::Pixels)
+        {
+            LOG_INFO("Jitter is in pixels, flipped X: {}, flipped Y: {}", _jitter.FlippedX(), _jitter.FlippedY());
+        }
     }
 }
 
@@ -247,6 +304,26 @@ float IFeature::GetSharpness(const NVSDK_NGX_Parameter* InParameters)
     return sharpness;
 }
 
+float IFeature::GetSharpness(const EvaluateInputs& InInputs)
+{
+    if (Config::Instance()->OverrideSharpness.value_or_default())
+        return Config::Instance()->Sharpness.value_or_default();
+
+    if (!InInputs.HasSharpness)
+        return 0.0f;
+
+    return std::clamp(InInputs.Sharpness, 0.0f, 1.0f);
+}
+
+void IFeature::ApplyDeferredConfig()
+{
+    for (auto& write : _deferredConfig)
+        write();
+
+    _deferredConfig.clear();
+    _deferConfig = false;
+}
+
 void IFeature::TickFrozenCheck()
 {
     static long updatesWithoutFramecountChange = 0;
@@ -4,7 +4,11 @@
 #include <nvsdk_ngx.h>
 #include <nvsdk_ngx_defs.h>
 
-#include <unordered_set>
+#include "EvaluateInputs.h"
+#include "JitterAnalyzer.h"
+
+#include <functional>
+#include <vector>
 
 #define DLSS_MOD_ID_OFFSET 1000000
 
@@ -29,23 +33,17 @@ class IFeature
 
     NVSDK_NGX_PerfQuality_Value _perfQualityValue;
 
-    struct JitterInfo
-    {
-        float x;
-        float y;
-    };
+    JitterAnalyzer _jitter;
+    uint32_t _loggedJitterPeriod = 0;
+    JitterAnalyzer::Units _loggedJitterUnits = JitterAnalyzer::Units::Unknown;
 
-    struct hashFunction
-    {
-        size_t operator()(const std::pair<float, float>& p) const
-        {
-            size_t h1 = std::hash<float>()(p.first);
-            size_t h2 = std::hash<float>()(p.second);
-            return h1 ^ (h2 << 1);
-        }
-    };
+    // Features read inputs once per frame in ReadInputs and analyze jitter there,
+    // GetRenderResolution only analyzes it for the ones which don't
+    bool _readsInputs = false;
 
-    std::unordered_set<std::pair<float, float>, hashFunction> _jitterInfo;
+    // Config changes of Init while it runs on a worker, Config is only written from the game thread
+    bool _deferConfig = false;
+    std::vector<std::function<void()>> _deferredConfig;
 
   protected:
     bool _initParameters = false;
@@ -71,14 +69,29 @@ class IFeature
     bool _featureFrozen = false;
     bool _moduleLoaded = false;
 
+    // Filled by ReadInputs before Evaluate
+    EvaluateInputs _inputs;
+
     void SetHandle(unsigned int InHandleId);
     bool SetInitParameters(NVSDK_NGX_Parameter* InParameters);
     void GetRenderResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth, unsigned int* OutHeight);
+    void GetRenderResolution(const EvaluateInputs& InInputs, unsigned int* OutWidth, unsigned int* OutHeight);
+    void AnalyzeJitter(const EvaluateInputs& InInputs);
     void GetDynamicOutputResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* width, unsigned int* height);
     float GetSharpness(const NVSDK_NGX_Parameter* InParameters);
+    float GetSharpness(const EvaluateInputs& InInputs);
 
     virtual void SetInit(bool InValue) { _isInited = InValue; }
 
+    // Config writes of Init go through this, they are kept until ApplyDeferredConfig when deferred
+    template <typename Func> void SetConfig(Func InWrite)
+    {
+        if (_deferConfig)
+            _deferredConfig.push_back(InWrite);
+        else
+            InWrite();
+    }
+
   public:
     NVSDK_NGX_Handle* Handle() const { return _handle; };
     static unsigned int GetNextHandleId() { return handleCounter++; }
@@ -87,7 +100,11 @@ class IFeature
     virtual feature_version Version() = 0;
     virtual std::string Name() const = 0;
 
-    size_t JitterCount() { return _jitterInfo.size(); }
+    size_t JitterCount() { return _jitter.Period(); }
+    const JitterAnalyzer& Jitter() const { return _jitter; }
+
+    // Reads the per frame inputs once for the following Evaluate call
+    const EvaluateInputs& ReadInputs(const NVSDK_NGX_Parameter* InParameters, EvaluateInputs::Api InApi);
 
     void TickFrozenCheck();
     bool IsFrozen() const { return _featureFrozen; };
@@ -119,6 +136,11 @@ class IFeature
     bool LowResMV() { return _initFlags.LowResMV; }
     bool SharpenEnabled() { return _initFlags.SharpenEnabled; }
 
+    // Call before Init on a worker thread, ApplyDeferredConfig must be called on the game thread
+    // before the feature is used. Features which are never used just drop the changes.
+    void DeferConfig() { _deferConfig = true; }
+    void ApplyDeferredConfig();
+
     IFeature(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters) { SetHandle(InHandleId); }
 
     virtual void Shutdown() = 0;
@@ -44,6 +44,27 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
 
     originalTexture->GetDesc(&desc);
 
+    // Let CreateTexture2D hook promote textures like this one when game recreates them
+    if (desc.MiscFlags == 0 && Config::Instance()->Dx11PromoteSharedTextures.value_or_default())
+    {
+        SharedTextureCache::TextureDesc key {};
+        key.Width = desc.Width;
+        key.Height = desc.Height;
+        key.Format = (uint32_t) desc.Format;
+        key.BindFlags = desc.BindFlags;
+        SharedTexturePromotion::Instance().Add(key);
+    }
+
+    // Cached textures are owned by the cache, copy paths below create their own
+    if (OutResource->Cached)
+    {
+        OutResource->SharedTexture = nullptr;
+        OutResource->Dx12Resource = nullptr;
+        OutResource->Dx11Handle = NULL;
+        OutResource->Dx12Handle = NULL;
+        OutResource->Cached = false;
+    }
+
     // check shared nt handle usage later
     if (!(desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED) && !(desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE) &&
         !InDontUseNTShared)
@@ -194,74 +215,179 @@ bool IFeature_Dx11wDx12::CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11
                 Dx11DeviceContext->CopyResource(OutResource->SharedTexture, InResource);
         }
     }
-    else
+    else if (!OpenCachedTexture(originalTexture, desc, OutResource))
     {
-        if (OutResource->SharedTexture != InResource)
+        originalTexture->Release();
+        return false;
+    }
+
+    originalTexture->Release();
+    return true;
+}
+
+bool IFeature_Dx11wDx12::OpenCachedTexture(ID3D11Texture2D* InTexture, const D3D11_TEXTURE2D_DESC& InDesc,
+                                           D3D11_TEXTURE2D_RESOURCE_C* OutResource)
+{
+    SharedTextureCache::TextureDesc key {};
+    key.Width = InDesc.Width;
+    key.Height = InDesc.Height;
+    key.Format = (uint32_t) InDesc.Format;
+    key.BindFlags = InDesc.BindFlags;
+    key.MiscFlags = InDesc.MiscFlags;
+
+    auto entry = _textureCache.Find(InTexture, key, _frameCount);
+
+    if (entry == nullptr)
+    {
+        SharedTextureCache::Entry newEntry {};
+        newEntry.Source = InTexture;
+        newEntry.Desc = key;
+
+        IDXGIResource1* resource = nullptr;
+        auto result = InTexture->QueryInterface(IID_PPV_ARGS(&resource));
+
+        if (result != S_OK || resource == nullptr)
         {
-            IDXGIResource1* resource;
+            LOG_ERROR("QueryInterface(resource) error: {0:x}", result);
+            return false;
+        }
 
-            result = originalTexture->QueryInterface(IID_PPV_ARGS(&resource));
+        HANDLE handle = NULL;
 
-            if (result != S_OK || resource == nullptr)
-            {
-                LOG_ERROR("QueryInterface(resource) error: {0:x}", result);
-                return false;
-            }
+        // Get shared handle, texture's own flags decide the path as promotion follows DontUseNTShared
+        // and GetSharedHandle fails for NT handle textures
+        if ((InDesc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE) != 0)
+        {
+            result = resource->CreateSharedHandle(NULL, DXGI_SHARED_RESOURCE_READ | DXGI_SHARED_RESOURCE_WRITE, NULL,
+                                                  &handle);
+            newEntry.OwnsHandle = true;
+        }
+        else
+        {
+            result = resource->GetSharedHandle(&handle);
+        }
 
-            // Get shared handle
-            if ((desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED) != 0 &&
-                (desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE) != 0)
-            {
-                DWORD access = DXGI_SHARED_RESOURCE_READ;
+        resource->Release();
 
-                if (!InCopy)
-                    access |= DXGI_SHARED_RESOURCE_WRITE;
+        if (result != S_OK)
+        {
+            LOG_ERROR("GetSharedHandle error: {0:x}", result);
+            return false;
+        }
 
-                result = resource->CreateSharedHandle(NULL, access, NULL, &OutResource->Dx11Handle);
-            }
-            else
-            {
-                result = resource->GetSharedHandle(&OutResource->Dx11Handle);
-            }
+        ID3D12Resource* dx12Resource = nullptr;
+        result = Dx12Device->OpenSharedHandle(handle, IID_PPV_ARGS(&dx12Resource));
 
-            if (result != S_OK)
-            {
-                LOG_ERROR("GetSharedHandle error: {0:x}", result);
-                return false;
-            }
+        if (result != S_OK)
+        {
+            LOG_ERROR("OpenSharedHandle error: {0:x}", result);
 
-            resource->Release();
+            if (newEntry.OwnsHandle)
+                CloseHandle(handle);
 
-            OutResource->SharedTexture = (ID3D11Texture2D*) InResource;
+            return false;
         }
+
+        // Keep the texture alive while it's cached so its address can't be reused
+        InTexture->AddRef();
+
+        newEntry.Handle = handle;
+        newEntry.Resource = dx12Resource;
+        entry = _textureCache.Insert(newEntry, _frameCount);
+
+        LOG_DEBUG("Cached shared texture {0:X} ({1}x{2}), cache size: {3}", (size_t) InTexture, InDesc.Width,
+                  InDesc.Height, _textureCache.Size());
     }
 
-    originalTexture->Release();
+    // Copies of the copy path are not needed anymore, slot's previous frame is completed after the ring wait
+    if (!OutResource->Cached)
+    {
+        if (OutResource->SharedTexture != nullptr)
+            OutResource->SharedTexture->Release();
+
+        if (OutResource->Dx12Resource != nullptr)
+            OutResource->Dx12Resource->Release();
+
+        if (OutResource->Dx12Handle != NULL && (OutResource->Desc.MiscFlags & D3D11_RESOURCE_MISC_SHARED_NTHANDLE))
+            CloseHandle(OutResource->Dx12Handle);
+
+        OutResource->Desc = {};
+    }
+
+    OutResource->SharedTexture = InTexture;
+    OutResource->Dx12Resource = (ID3D12Resource*) entry->Resource;
+    OutResource->Dx11Handle = entry->Handle;
+    OutResource->Dx12Handle = entry->Handle;
+    OutResource->Cached = true;
+
     return true;
 }
 
+void IFeature_Dx11wDx12::ReleaseCachedTextures(std::vector<SharedTextureCache::Entry>& InEntries)
+{
+    for (auto& entry : InEntries)
+    {
+        for (auto& textures : _sharedTextures)
+        {
+            D3D11_TEXTURE2D_RESOURCE_C* resources[] = { &textures.Color,    &textures.Mv,  &textures.Depth,
+                                                        &textures.Reactive, &textures.Exp, &textures.Out };
+
+            for (auto resource : resources)
+            {
+                if (!resource->Cached || resource->Dx12Resource != entry.Resource)
+                    continue;
+
+                resource->SharedTexture = nullptr;
+                resource->Dx12Resource = nullptr;
+                resource->Dx11Handle = NULL;
+                resource->Dx12Handle = NULL;
+                resource->Cached = false;
+            }
+        }
+
+        ((ID3D12Resource*) entry.Resource)->Release();
+
+        if (entry.OwnsHandle)
+            CloseHandle(entry.Handle);
+
+        ((ID3D11Texture2D*) entry.Source)->Release();
+    }
+
+    InEntries.clear();
+}
+
 void IFeature_Dx11wDx12::ReleaseSharedResources()
 {
-    SAFE_RELEASE(dx11Color.SharedTexture);
-    SAFE_RELEASE(dx11Mv.SharedTexture);
-    SAFE_RELEASE(dx11Out.SharedTexture);
-    SAFE_RELEASE(dx11Depth.SharedTexture);
-    SAFE_RELEASE(dx11Reactive.SharedTexture);
-    SAFE_RELEASE(dx11Exp.SharedTexture);
-    SAFE_RELEASE(dx11Color.Dx12Resource);
-    SAFE_RELEASE(dx11Mv.Dx12Resource);
-    SAFE_RELEASE(dx11Out.Dx12Resource);
-    SAFE_RELEASE(dx11Depth.Dx12Resource);
-    SAFE_RELEASE(dx11Reactive.Dx12Resource);
-    SAFE_RELEASE(dx11Exp.Dx12Resource);
+    WaitForFrames();
+
+    _textureCache.Clear(_evictedTextures);
+    ReleaseCachedTextures(_evictedTextures);
+
+    for (auto& textures : _sharedTextures)
+    {
+        SAFE_RELEASE(textures.Color.SharedTexture);
+        SAFE_RELEASE(textures.Mv.SharedTexture);
+        SAFE_RELEASE(textures.Out.SharedTexture);
+        SAFE_RELEASE(textures.Depth.SharedTexture);
+        SAFE_RELEASE(textures.Reactive.SharedTexture);
+        SAFE_RELEASE(textures.Exp.SharedTexture);
+        SAFE_RELEASE(textures.Color.Dx12Resource);
+        SAFE_RELEASE(textures.Mv.Dx12Resource);
+        SAFE_RELEASE(textures.Out.Dx12Resource);
+        SAFE_RELEASE(textures.Depth.Dx12Resource);
+        SAFE_RELEASE(textures.Reactive.Dx12Resource);
+        SAFE_RELEASE(textures.Exp.Dx12Resource);
+    }
 
     ReleaseSyncResources();
 
-    SAFE_RELEASE(Dx12CommandList[0]);
-    SAFE_RELEASE(Dx12CommandList[1]);
+    for (size_t i = 0; i < FrameRing::MaxDepth; i++)
+    {
+        SAFE_RELEASE(Dx12CommandList[i]);
+        SAFE_RELEASE(Dx12CommandAllocator[i]);
+    }
+
     SAFE_RELEASE(Dx12CommandQueue);
-    SAFE_RELEASE(Dx12CommandAllocator[0]);
-    SAFE_RELEASE(Dx12CommandAllocator[1]);
     SAFE_RELEASE(Dx12Fence);
 
     if (Dx12FenceEvent)
@@ -418,64 +544,44 @@ HRESULT IFeature_Dx11wDx12::CreateDx12Device(D3D_FEATURE_LEVEL InFeatureLevel)
         }
     }
 
+    // Ring depth can only change while there are no allocators
     if (Dx12CommandAllocator[0] == nullptr)
-    {
-        result =
-            Dx12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&Dx12CommandAllocator[0]));
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("CreateCommandAllocator error: {0:x}", result);
-            State::Instance().vulkanSkipHooks = false;
-            State::Instance().skipSpoofing = false;
-            return E_NOINTERFACE;
-        }
-    }
+        _frameRing = FrameRing((uint32_t) Config::Instance()->Dx11FramesInFlight.value_or_default());
 
-    if (Dx12CommandAllocator[1] == nullptr)
+    for (uint32_t i = 0; i < _frameRing.Depth(); i++)
     {
-        result =
-            Dx12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&Dx12CommandAllocator[1]));
-
-        if (result != S_OK)
+        if (Dx12CommandAllocator[i] == nullptr)
         {
-            LOG_ERROR("CreateCommandAllocator error: {0:x}", result);
-            State::Instance().vulkanSkipHooks = false;
-            State::Instance().skipSpoofing = false;
-            return E_NOINTERFACE;
-        }
-    }
-
-    if (Dx12CommandList[0] == nullptr)
-    {
-        // CreateCommandList
-        result = Dx12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, Dx12CommandAllocator[0], nullptr,
-                                               IID_PPV_ARGS(&Dx12CommandList[0]));
+            result = Dx12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                        IID_PPV_ARGS(&Dx12CommandAllocator[i]));
 
-        if (result != S_OK)
-        {
-            LOG_ERROR("CreateCommandList error: {0:x}", result);
-            State::Instance().vulkanSkipHooks = false;
-            State::Instance().skipSpoofing = false;
-            return E_NOINTERFACE;
+            if (result != S_OK)
+            {
+                LOG_ERROR("CreateCommandAllocator error: {0:x}", result);
+                State::Instance().vulkanSkipHooks = false;
+                State::Instance().skipSpoofing = false;
+                return E_NOINTERFACE;
+            }
         }
-    }
 
-    if (Dx12CommandList[1] == nullptr)
-    {
-        // CreateCommandList
-        result = Dx12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, Dx12CommandAllocator[1], nullptr,
-                                               IID_PPV_ARGS(&Dx12CommandList[1]));
-
-        if (result != S_OK)
+        if (Dx12CommandList[i] == nullptr)
         {
-            LOG_ERROR("CreateCommandList error: {0:x}", result);
-            State::Instance().vulkanSkipHooks = false;
-            State::Instance().skipSpoofing = false;
-            return E_NOINTERFACE;
+            // CreateCommandList
+            result = Dx12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, Dx12CommandAllocator[i],
+                                                   nullptr, IID_PPV_ARGS(&Dx12CommandList[i]));
+
+            if (result != S_OK)
+            {
+                LOG_ERROR("CreateCommandList error: {0:x}", result);
+                State::Instance().vulkanSkipHooks = false;
+                State::Instance().skipSpoofing = false;
+                return E_NOINTERFACE;
+            }
         }
     }
 
+    LOG_DEBUG("Frames in flight: {0}", _frameRing.Depth());
+
     if (Dx12Fence == nullptr)
     {
         result = Dx12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&Dx12Fence));
@@ -504,34 +610,73 @@ HRESULT IFeature_Dx11wDx12::CreateDx12Device(D3D_FEATURE_LEVEL InFeatureLevel)
     return S_OK;
 }
 
-bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParameters)
+bool IFeature_Dx11wDx12::ProcessDx11Textures(const EvaluateInputs& InInputs)
 {
-    // Wait for last frame
-    if (Dx12Fence->GetCompletedValue() < _frameCount)
+    // Only wait when the ring is exhausted and the slot's previous frame is still in flight. This one stays on CPU,
+    // allocator reset needs the GPU to be done with it. Dx11 <-> Dx12 ordering is done with GPU waits on the
+    // shared fence, see QueueDx12WaitForDx11 & QueueDx11WaitForDx12
+    auto ringFrame = _frameRing.Begin(Dx12Fence->GetCompletedValue());
+
+    if (ringFrame.WaitValue != 0)
     {
-        Dx12Fence->SetEventOnCompletion(_frameCount, Dx12FenceEvent);
+        LOG_DEBUG("Ring exhausted, waiting for fence value: {0}", ringFrame.WaitValue);
+        Dx12Fence->SetEventOnCompletion(ringFrame.WaitValue, Dx12FenceEvent);
         WaitForSingleObject(Dx12FenceEvent, INFINITE);
     }
 
-    auto frame = _frameCount % 2;
+    auto frame = ringFrame.Slot;
+
+    auto& textures = _sharedTextures[frame];
+    dx11Color = &textures.Color;
+    dx11Mv = &textures.Mv;
+    dx11Depth = &textures.Depth;
+    dx11Reactive = &textures.Reactive;
+    dx11Exp = &textures.Exp;
+    dx11Out = &textures.Out;
+
+    // Frames which could use evicted textures are completed after the ring wait
+    if (_textureCache.Collect(_frameCount, _evictedTextures) > 0)
+        ReleaseCachedTextures(_evictedTextures);
+
+    auto result = Dx12CommandAllocator[frame]->Reset();
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("Dx12CommandAllocator[{0}]->Reset error: {1:x}", frame, (unsigned int) result);
+        return false;
+    }
+
+    result = Dx12CommandList[frame]->Reset(Dx12CommandAllocator[frame], nullptr);
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("Dx12CommandList[{0}]->Reset error: {1:x}", frame, (unsigned int) result);
+        return false;
+    }
+
+    if (!RecordDx11Textures(InInputs, frame))
+    {
+        Dx12CommandList[frame]->Close();
+        return false;
+    }
 
-    Dx12CommandAllocator[frame]->Reset();
-    Dx12CommandList[frame]->Reset(Dx12CommandAllocator[frame], nullptr);
+    return true;
+}
 
+bool IFeature_Dx11wDx12::RecordDx11Textures(const EvaluateInputs& InInputs, uint32_t InFrame)
+{
     HRESULT result;
 
     auto dontUseNTS = Config::Instance()->DontUseNTShared.value_or_default();
 
 #pragma region Texture copies
 
-    ID3D11Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D11Resource* paramColor = (ID3D11Resource*) InInputs.Color;
 
     if (paramColor)
     {
         LOG_DEBUG("Color exist..");
-        if (CopyTextureFrom11To12(paramColor, &dx11Color, true, dontUseNTS) == false)
+        if (CopyTextureFrom11To12(paramColor, dx11Color, true, dontUseNTS) == false)
             return false;
     }
     else
@@ -540,14 +685,12 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         return false;
     }
 
-    ID3D11Resource* paramMv;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramMv) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramMv);
+    ID3D11Resource* paramMv = (ID3D11Resource*) InInputs.MotionVectors;
 
     if (paramMv)
     {
         LOG_DEBUG("MotionVectors exist..");
-        if (CopyTextureFrom11To12(paramMv, &dx11Mv, true, dontUseNTS) == false)
+        if (CopyTextureFrom11To12(paramMv, dx11Mv, true, dontUseNTS) == false)
             return false;
     }
     else
@@ -556,13 +699,12 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         return false;
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput[_frameCount % 2]) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput[_frameCount % 2]);
+    paramOutput[InFrame] = (ID3D11Resource*) InInputs.Output;
 
-    if (paramOutput[_frameCount % 2])
+    if (paramOutput[InFrame])
     {
         LOG_DEBUG("Output exist..");
-        if (CopyTextureFrom11To12(paramOutput[_frameCount % 2], &dx11Out, false,
+        if (CopyTextureFrom11To12(paramOutput[InFrame], dx11Out, false,
                                   Config::Instance()->DontUseNTShared.value_or(true)) == false)
             return false;
     }
@@ -572,15 +714,13 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         return false;
     }
 
-    ID3D11Resource* paramDepth;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+    ID3D11Resource* paramDepth = (ID3D11Resource*) InInputs.Depth;
 
     if (paramDepth)
     {
         LOG_DEBUG("Depth exist..");
 
-        if (CopyTextureFrom11To12(paramDepth, &dx11Depth, true, true) == false)
+        if (CopyTextureFrom11To12(paramDepth, dx11Depth, true, true) == false)
             return false;
     }
     else
@@ -593,14 +733,13 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExposure) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExposure);
+        paramExposure = (ID3D11Resource*) InInputs.Exposure;
 
         if (paramExposure)
         {
             LOG_DEBUG("ExposureTexture exist..");
 
-            if (CopyTextureFrom11To12(paramExposure, &dx11Exp, true, dontUseNTS) == false)
+            if (CopyTextureFrom11To12(paramExposure, dx11Exp, true, dontUseNTS) == false)
                 return false;
         }
         else
@@ -611,10 +750,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
         }
     }
 
-    ID3D11Resource* paramReactiveMask = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-        NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+    ID3D11Resource* paramReactiveMask = (ID3D11Resource*) InInputs.BiasColorMask;
 
     if (!Config::Instance()->DisableReactiveMask.value_or(paramReactiveMask == nullptr))
     {
@@ -623,7 +759,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             Config::Instance()->DisableReactiveMask.set_volatile_value(false);
             LOG_DEBUG("Input Bias mask exist..");
 
-            if (CopyTextureFrom11To12(paramReactiveMask, &dx11Reactive, true, dontUseNTS) == false)
+            if (CopyTextureFrom11To12(paramReactiveMask, dx11Reactive, true, dontUseNTS) == false)
                 return false;
         }
         // This is only needed for XeSS
@@ -670,39 +806,20 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             }
         }
 
-        // Fence
-        LOG_DEBUG("Dx11 Signal & Dx12 Wait!");
-
-        result = Dx11DeviceContext->Signal(dx11FenceTextureCopy, _fenceValue);
-        Dx11DeviceContext->Flush();
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("Dx11DeviceContext->Signal(dx11FenceTextureCopy, 10) : {0:x}!", result);
+        if (!QueueDx12WaitForDx11())
             return false;
-        }
-
-        // Gpu Sync
-        result = Dx12CommandQueue->Wait(dx12FenceTextureCopy, _fenceValue);
-        _fenceValue++;
-
-        if (result != S_OK)
-        {
-            LOG_ERROR("Dx12CommandQueue->Wait(dx12fence_1, 10) : {0:x}!", result);
-            return false;
-        }
     }
 
 #pragma region shared handles
 
     LOG_DEBUG("SharedHandles start!");
 
-    if (paramColor && dx11Color.Dx12Handle != dx11Color.Dx11Handle)
+    if (paramColor && dx11Color->Dx12Handle != dx11Color->Dx11Handle)
     {
-        if (dx11Color.Dx12Handle != NULL)
-            CloseHandle(dx11Color.Dx12Handle);
+        if (dx11Color->Dx12Handle != NULL)
+            CloseHandle(dx11Color->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Color.Dx11Handle, IID_PPV_ARGS(&dx11Color.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Color->Dx11Handle, IID_PPV_ARGS(&dx11Color->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -710,15 +827,15 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Color.Dx12Handle = dx11Color.Dx11Handle;
+        dx11Color->Dx12Handle = dx11Color->Dx11Handle;
     }
 
-    if (paramMv && dx11Mv.Dx12Handle != dx11Mv.Dx11Handle)
+    if (paramMv && dx11Mv->Dx12Handle != dx11Mv->Dx11Handle)
     {
-        if (dx11Mv.Dx12Handle != NULL)
-            CloseHandle(dx11Mv.Dx12Handle);
+        if (dx11Mv->Dx12Handle != NULL)
+            CloseHandle(dx11Mv->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Mv.Dx11Handle, IID_PPV_ARGS(&dx11Mv.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Mv->Dx11Handle, IID_PPV_ARGS(&dx11Mv->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -726,15 +843,15 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Mv.Dx11Handle = dx11Mv.Dx12Handle;
+        dx11Mv->Dx12Handle = dx11Mv->Dx11Handle;
     }
 
-    if (paramOutput[_frameCount % 2] && dx11Out.Dx12Handle != dx11Out.Dx11Handle)
+    if (paramOutput[InFrame] && dx11Out->Dx12Handle != dx11Out->Dx11Handle)
     {
-        if (dx11Out.Dx12Handle != NULL)
-            CloseHandle(dx11Out.Dx12Handle);
+        if (dx11Out->Dx12Handle != NULL)
+            CloseHandle(dx11Out->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Out.Dx11Handle, IID_PPV_ARGS(&dx11Out.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Out->Dx11Handle, IID_PPV_ARGS(&dx11Out->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -742,15 +859,15 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Out.Dx12Handle = dx11Out.Dx11Handle;
+        dx11Out->Dx12Handle = dx11Out->Dx11Handle;
     }
 
-    if (paramDepth && dx11Depth.Dx12Handle != dx11Depth.Dx11Handle)
+    if (paramDepth && dx11Depth->Dx12Handle != dx11Depth->Dx11Handle)
     {
-        if (dx11Depth.Dx12Handle != NULL)
-            CloseHandle(dx11Depth.Dx12Handle);
+        if (dx11Depth->Dx12Handle != NULL)
+            CloseHandle(dx11Depth->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Depth.Dx11Handle, IID_PPV_ARGS(&dx11Depth.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Depth->Dx11Handle, IID_PPV_ARGS(&dx11Depth->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -758,21 +875,21 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        auto desc = dx11Depth.Dx12Resource->GetDesc();
+        auto desc = dx11Depth->Dx12Resource->GetDesc();
 
-        dx11Depth.Dx12Handle = dx11Depth.Dx11Handle;
+        dx11Depth->Dx12Handle = dx11Depth->Dx11Handle;
     }
 
     if (AutoExposure())
     {
         LOG_DEBUG("AutoExposure enabled!");
     }
-    else if (paramExposure && dx11Exp.Dx12Handle != dx11Exp.Dx11Handle)
+    else if (paramExposure && dx11Exp->Dx12Handle != dx11Exp->Dx11Handle)
     {
-        if (dx11Exp.Dx12Handle != NULL)
-            CloseHandle(dx11Exp.Dx12Handle);
+        if (dx11Exp->Dx12Handle != NULL)
+            CloseHandle(dx11Exp->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Exp.Dx11Handle, IID_PPV_ARGS(&dx11Exp.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Exp->Dx11Handle, IID_PPV_ARGS(&dx11Exp->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -780,16 +897,16 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Exp.Dx12Handle = dx11Exp.Dx11Handle;
+        dx11Exp->Dx12Handle = dx11Exp->Dx11Handle;
     }
 
     if (!Config::Instance()->DisableReactiveMask.value_or(false) && paramReactiveMask &&
-        dx11Reactive.Dx12Handle != dx11Reactive.Dx11Handle)
+        dx11Reactive->Dx12Handle != dx11Reactive->Dx11Handle)
     {
-        if (dx11Reactive.Dx12Handle != NULL)
-            CloseHandle(dx11Reactive.Dx12Handle);
+        if (dx11Reactive->Dx12Handle != NULL)
+            CloseHandle(dx11Reactive->Dx12Handle);
 
-        result = Dx12Device->OpenSharedHandle(dx11Reactive.Dx11Handle, IID_PPV_ARGS(&dx11Reactive.Dx12Resource));
+        result = Dx12Device->OpenSharedHandle(dx11Reactive->Dx11Handle, IID_PPV_ARGS(&dx11Reactive->Dx12Resource));
 
         if (result != S_OK)
         {
@@ -797,7 +914,7 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
             return false;
         }
 
-        dx11Reactive.Dx12Handle = dx11Reactive.Dx11Handle;
+        dx11Reactive->Dx12Handle = dx11Reactive->Dx11Handle;
     }
 
 #pragma endregion
@@ -805,21 +922,72 @@ bool IFeature_Dx11wDx12::ProcessDx11Textures(const NVSDK_NGX_Parameter* InParame
     return true;
 }
 
-bool IFeature_Dx11wDx12::CopyBackOutput()
+bool IFeature_Dx11wDx12::QueueDx12WaitForDx11()
 {
-    // Fence ones
+    // Every handoff uses a new value, a value which is already signaled would make the wait a no-op
+    auto value = ++_fenceValue;
+
+    LOG_DEBUG("Dx11 Signal & Dx12 Wait, value: {}", value);
+
+    auto result = Dx11DeviceContext->Signal(dx11FenceTextureCopy, value);
+
+    if (result != S_OK)
     {
-        // wait for fsr on dx12
-        Dx11DeviceContext->Wait(dx11FenceTextureCopy, _fenceValue);
-        _fenceValue++;
+        LOG_ERROR("Dx11DeviceContext->Signal(dx11FenceTextureCopy, {}) : {:x}!", value, (UINT) result);
+        return false;
+    }
+
+    // Submit the signal, otherwise Dx12 queue waits until the game flushes its context
+    Dx11DeviceContext->Flush();
 
-        // Copy Back
-        Dx11DeviceContext->CopyResource(paramOutput[_frameCount % 2], dx11Out.SharedTexture);
+    result = Dx12CommandQueue->Wait(dx12FenceTextureCopy, value);
+
+    if (result != S_OK)
+    {
+        LOG_ERROR("Dx12CommandQueue->Wait(dx12FenceTextureCopy, {}) : {:x}!", value, (UINT) result);
+        return false;
     }
 
     return true;
 }
 
+void IFeature_Dx11wDx12::QueueDx11WaitForDx12()
+{
+    auto value = ++_fenceValue;
+
+    LOG_DEBUG("Dx12 Signal & Dx11 Wait, value: {}", value);
+
+    Dx12CommandQueue->Signal(dx12FenceTextureCopy, value);
+    Dx11DeviceContext->Wait(dx11FenceTextureCopy, value);
+}
+
+bool IFeature_Dx11wDx12::CopyBackOutput()
+{
+    // Copy Back, cached output is game's own texture and already written by Dx12
+    if (!dx11Out->Cached)
+        Dx11DeviceContext->CopyResource(paramOutput[_frameRing.Slot()], dx11Out->SharedTexture);
+
+    return true;
+}
+
+void IFeature_Dx11wDx12::SubmitFrame()
+{
+    auto value = _frameRing.Submit();
+    Dx12CommandQueue->Signal(Dx12Fence, value);
+}
+
+void IFeature_Dx11wDx12::WaitForFrames()
+{
+    if (Dx12Fence == nullptr || Dx12FenceEvent == nullptr || _frameRing.LastValue() == 0)
+        return;
+
+    if (Dx12Fence->GetCompletedValue() < _frameRing.LastValue())
+    {
+        Dx12Fence->SetEventOnCompletion(_frameRing.LastValue(), Dx12FenceEvent);
+        WaitForSingleObject(Dx12FenceEvent, INFINITE);
+    }
+}
+
 bool IFeature_Dx11wDx12::BaseInit(ID3D11Device* InDevice, ID3D11DeviceContext* InContext,
                                   NVSDK_NGX_Parameter* InParameters)
 {
@@ -1,5 +1,7 @@
 #pragma once
 #include "IFeature_Dx11.h"
+#include "FrameRing.h"
+#include "SharedTextureCache.h"
 
 #include <menu/menu_dx11.h>
 
@@ -33,6 +35,7 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
         ID3D12Resource* Dx12Resource = nullptr;
         HANDLE Dx11Handle = NULL;
         HANDLE Dx12Handle = NULL;
+        bool Cached = false; // Game's own shared texture, owned by _textureCache
     };
 
     // D3D11
@@ -42,24 +45,46 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
     // D3D11with12
     ID3D12Device* Dx12Device = nullptr;
     ID3D12CommandQueue* Dx12CommandQueue = nullptr;
-    ID3D12CommandAllocator* Dx12CommandAllocator[2] = { nullptr, nullptr };
-    ID3D12GraphicsCommandList* Dx12CommandList[2] = { nullptr, nullptr };
+    ID3D12CommandAllocator* Dx12CommandAllocator[FrameRing::MaxDepth] = {};
+    ID3D12GraphicsCommandList* Dx12CommandList[FrameRing::MaxDepth] = {};
     ID3D12Fence* Dx12Fence = nullptr;
     HANDLE Dx12FenceEvent = nullptr;
 
-    D3D11_TEXTURE2D_RESOURCE_C dx11Color = {};
-    D3D11_TEXTURE2D_RESOURCE_C dx11Mv = {};
-    D3D11_TEXTURE2D_RESOURCE_C dx11Depth = {};
-    D3D11_TEXTURE2D_RESOURCE_C dx11Reactive = {};
-    D3D11_TEXTURE2D_RESOURCE_C dx11Exp = {};
-    D3D11_TEXTURE2D_RESOURCE_C dx11Out = {};
+    // Allocators, lists and output params are indexed with FrameRing::Slot()
+    FrameRing _frameRing;
 
-    ID3D11Resource* paramOutput[2] = { nullptr, nullptr };
+    using D3D11_SHARED_TEXTURES_C = struct D3D11_SHARED_TEXTURES_C
+    {
+        D3D11_TEXTURE2D_RESOURCE_C Color = {};
+        D3D11_TEXTURE2D_RESOURCE_C Mv = {};
+        D3D11_TEXTURE2D_RESOURCE_C Depth = {};
+        D3D11_TEXTURE2D_RESOURCE_C Reactive = {};
+        D3D11_TEXTURE2D_RESOURCE_C Exp = {};
+        D3D11_TEXTURE2D_RESOURCE_C Out = {};
+    };
+
+    // Shared textures are ringed like the allocators, copies of a frame can't overwrite
+    // inputs of a previous frame which is still in flight
+    D3D11_SHARED_TEXTURES_C _sharedTextures[FrameRing::MaxDepth] = {};
+
+    // Current slot's textures, set by ProcessDx11Textures
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Color = &_sharedTextures[0].Color;
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Mv = &_sharedTextures[0].Mv;
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Depth = &_sharedTextures[0].Depth;
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Reactive = &_sharedTextures[0].Reactive;
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Exp = &_sharedTextures[0].Exp;
+    D3D11_TEXTURE2D_RESOURCE_C* dx11Out = &_sharedTextures[0].Out;
+
+    ID3D11Resource* paramOutput[FrameRing::MaxDepth] = {};
 
     ID3D11Fence* dx11FenceTextureCopy = nullptr;
     ID3D12Fence* dx12FenceTextureCopy = nullptr;
     HANDLE dx11SHForTextureCopy = nullptr;
-    ULONG _fenceValue = 0;
+    UINT64 _fenceValue = 0;
+
+    // Game textures which are already shareable are opened once and used without copies
+    SharedTextureCache _textureCache { 16, 120, FrameRing::MaxDepth + 1 };
+    std::vector<SharedTextureCache::Entry> _evictedTextures;
 
     std::unique_ptr<OS_Dx12> OutputScaler = nullptr;
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
@@ -72,9 +97,30 @@ class IFeature_Dx11wDx12 : public virtual IFeature_Dx11
 
     bool CopyTextureFrom11To12(ID3D11Resource* InResource, D3D11_TEXTURE2D_RESOURCE_C* OutResource, bool InCopy,
                                bool InDepth);
-    bool ProcessDx11Textures(const NVSDK_NGX_Parameter* InParameters);
+    bool OpenCachedTexture(ID3D11Texture2D* InTexture, const D3D11_TEXTURE2D_DESC& InDesc,
+                           D3D11_TEXTURE2D_RESOURCE_C* OutResource);
+    void ReleaseCachedTextures(std::vector<SharedTextureCache::Entry>& InEntries);
+
+    // Resets the slot's command list and records the input copies into it.
+    // On failure the command list is left closed, callers must not close or execute it.
+    bool ProcessDx11Textures(const EvaluateInputs& InInputs);
+    bool RecordDx11Textures(const EvaluateInputs& InInputs, uint32_t InFrame);
+
+    // GPU to GPU waits on the shared fence, nothing is waited on CPU.
+    // Dx12 queue waits for the input copies of Dx11 context, called by ProcessDx11Textures
+    bool QueueDx12WaitForDx11();
+
+    // Dx11 context waits for the Dx12 upscale, call after ExecuteCommandLists
+    void QueueDx11WaitForDx12();
+
     bool CopyBackOutput();
 
+    // Signals Dx12Fence for the recorded frame and advances the ring, call after ExecuteCommandLists
+    void SubmitFrame();
+
+    // Waits on CPU until all submitted frames are completed
+    void WaitForFrames();
+
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
 
@@ -2,6 +2,7 @@
 #include <pch.h>
 
 #include "State.h"
+#include <Config.h>
 
 void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                                     D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const
@@ -15,6 +16,155 @@ void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
     InCommandList->ResourceBarrier(1, &barrier);
 }
 
+void IFeature_Dx12::CreateFusedRcas()
+{
+    if (!Config::Instance()->OutputScalingFusedRcas.value_or_default() ||
+        Config::Instance()->OutputScalingUseFsr.value_or_default() || OutputScaler == nullptr ||
+        !OutputScaler->IsUpsampling())
+        return;
+
+    FusedRcas = std::make_unique<RCAS_OS_Dx12>("RCAS Output Scaling", Device);
+}
+
+bool IFeature_Dx12::UseFusedRcas(bool InOutputScaling, bool InRcasEnabled) const
+{
+    if (!InOutputScaling || !InRcasEnabled || FusedRcas == nullptr || !FusedRcas->IsInit() ||
+        !Config::Instance()->OutputScalingFusedRcas.value_or_default() ||
+        Config::Instance()->OutputScalingUseFsr.value_or_default())
+        return false;
+
+    return _sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
+                                 Config::Instance()->MotionSharpness.value_or_default() > 0.0f);
+}
+
+bool IFeature_Dx12::RecordPostPasses(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InUpscaled,
+                                     ID3D12Resource* InMotion, ID3D12Resource* InOutput, bool InRcas,
+                                     bool InOutputScaling, bool InFusedRcas)
+{
+    if (!InRcas && !InOutputScaling)
+        return true;
+
+    if (PostGraph == nullptr)
+        PostGraph = std::make_unique<PassGraph_Dx12>("PostGraph");
+
+    // All targets are in UAV state after upscale and returned to it, RCAS & OutputScaler state tracking
+    // stays valid. Motion vectors are not tracked, their state is handled by MVResourceBarrier.
+    auto upscaledId = PostGraph->Import("Upscaled", InUpscaled, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                                        D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    auto outputId = InUpscaled == InOutput
+                        ? upscaledId
+                        : PostGraph->Import("Output", InOutput, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    auto scalerId = upscaledId;
+
+    if (InRcas && InOutputScaling)
+    {
+        scalerId = PostGraph->Import("OutputScaler", OutputScaler->Buffer(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                                     D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+
+    bool rcasFailed = false;
+    bool fusedFailed = false;
+    bool scalerFailed = false;
+
+    RcasConstants rcasConstants {};
+
+    if (InRcas || InFusedRcas)
+    {
+        rcasConstants.Sharpness = _sharpness;
+        rcasConstants.DisplayWidth = TargetWidth();
+        rcasConstants.DisplayHeight = TargetHeight();
+
+        if (_inputs.HasMVScale)
+        {
+            rcasConstants.MvScaleX = _inputs.MVScaleX;
+            rcasConstants.MvScaleY = _inputs.MVScaleY;
+        }
+
+        rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
+        rcasConstants.RenderHeight = RenderHeight();
+        rcasConstants.RenderWidth = RenderWidth();
+    }
+
+    if (InRcas)
+    {
+        auto rcasOutput = InOutputScaling ? OutputScaler->Buffer() : InOutput;
+
+        auto pass = PostGraph->AddPass("RCAS",
+                                       [&, rcasConstants, rcasOutput](auto cmdList)
+                                       {
+                                           rcasFailed = !RCAS->Dispatch(Device, cmdList, InUpscaled, InMotion,
+                                                                        rcasConstants, rcasOutput);
+                                           return !rcasFailed;
+                                       });
+
+        PostGraph->Read(pass, upscaledId, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+        PostGraph->Write(pass, InOutputScaling ? scalerId : outputId, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+
+    if (InFusedRcas)
+    {
+        // Upscaler output is OutputScaler->Buffer(), sharpened while it's scaled to the output
+        auto pass = PostGraph->AddPass("RCAS + OutputScaling",
+                                       [&, rcasConstants](auto cmdList)
+                                       {
+                                           LOG_DEBUG("sharpening & scaling output...");
+                                           fusedFailed = !FusedRcas->Dispatch(Device, cmdList, InUpscaled, InMotion,
+                                                                              rcasConstants, InOutput);
+
+                                           if (!fusedFailed)
+                                               return true;
+
+                                           // Dispatch fails before recording anything, scale without sharpening
+                                           // inside the same pass so the graph's barriers stay valid
+                                           LOG_WARN("fused RCAS failed, scaling output without sharpening");
+                                           scalerFailed = !OutputScaler->Dispatch(Device, cmdList, InUpscaled,
+                                                                                  InOutput);
+                                           return !scalerFailed;
+                                       });
+
+        PostGraph->Read(pass, upscaledId, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+        PostGraph->Write(pass, outputId, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+    else if (InOutputScaling)
+    {
+        auto pass = PostGraph->AddPass("OutputScaling",
+                                       [&](auto cmdList)
+                                       {
+                                           LOG_DEBUG("scaling output...");
+                                           scalerFailed = !OutputScaler->Dispatch(
+                                               Device, cmdList, OutputScaler->Buffer(), InOutput);
+                                           return !scalerFailed;
+                                       });
+
+        PostGraph->Read(pass, scalerId, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+        PostGraph->Write(pass, outputId, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+
+    auto result = PostGraph->Execute(InCommandList);
+
+    if (rcasFailed)
+    {
+        Config::Instance()->RcasEnabled.set_volatile_value(false);
+        return false;
+    }
+
+    // Separate RCAS & OutputScaling passes will be used from next frame,
+    // output of this frame was scaled without sharpening
+    if (fusedFailed)
+        Config::Instance()->OutputScalingFusedRcas.set_volatile_value(false);
+
+    if (scalerFailed)
+    {
+        Config::Instance()->OutputScalingEnabled.set_volatile_value(false);
+        State::Instance().changeBackend[Handle()->Id] = true;
+        return false;
+    }
+
+    // Invalid graph, nothing was dispatched
+    return result;
+}
+
 IFeature_Dx12::IFeature_Dx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters) {}
 
 void IFeature_Dx12::Shutdown() {}
@@ -35,6 +185,9 @@ IFeature_Dx12::~IFeature_Dx12()
     if (RCAS != nullptr && RCAS.get() != nullptr)
         RCAS.reset();
 
+    if (FusedRcas != nullptr && FusedRcas.get() != nullptr)
+        FusedRcas.reset();
+
     if (Bias != nullptr && Bias.get() != nullptr)
         Bias.reset();
 }
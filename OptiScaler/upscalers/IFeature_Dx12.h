@@ -7,7 +7,9 @@
 #include <menu/menu_dx12.h>
 #include <shaders/output_scaling/OS_Dx12.h>
 #include <shaders/rcas/RCAS_Dx12.h>
+#include <shaders/rcas_os/RCAS_OS_Dx12.h>
 #include <shaders/bias/Bias_Dx12.h>
+#include <pass_graph/PassGraph_Dx12.h>
 
 class IFeature_Dx12 : public virtual IFeature
 {
@@ -16,11 +18,28 @@ class IFeature_Dx12 : public virtual IFeature
     static inline std::unique_ptr<Menu_Dx12> Imgui = nullptr;
     std::unique_ptr<OS_Dx12> OutputScaler = nullptr;
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
+    std::unique_ptr<RCAS_OS_Dx12> FusedRcas = nullptr;
     std::unique_ptr<Bias_Dx12> Bias = nullptr;
+    std::unique_ptr<PassGraph_Dx12> PostGraph = nullptr;
 
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const;
 
+    // Creates FusedRcas when OutputScaler is the bicubic upsampler, call after creating OutputScaler
+    void CreateFusedRcas();
+
+    // RCAS is applied by FusedRcas while output scaling, RCAS buffer and pass are skipped.
+    // InRcasEnabled is RcasEnabled with the backend's default
+    bool UseFusedRcas(bool InOutputScaling, bool InRcasEnabled) const;
+
+    // Records RCAS, fused RCAS + OutputScaling and OutputScaling passes with PostGraph.
+    // InUpscaled is the upscaler output, all targets are in UAV state before and after.
+    // Returns false when the graph or a pass failed, failing feature is disabled from next frame.
+    // When the fused pass fails output is scaled by OutputScaler inside the same pass.
+    bool RecordPostPasses(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InUpscaled,
+                          ID3D12Resource* InMotion, ID3D12Resource* InOutput, bool InRcas, bool InOutputScaling,
+                          bool InFusedRcas);
+
   public:
     virtual bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
                       NVSDK_NGX_Parameter* InParameters) = 0;
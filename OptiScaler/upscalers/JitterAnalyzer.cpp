@@ -0,0 +1,231 @@
+#include "JitterAnalyzer.h"
+
+#include <bit>
+#include <cmath>
+#include <algorithm>
+
+// Halton grids, every index below MaxPeriod lands exactly on them
+static constexpr uint32_t HaltonGridX = 256; // 2^8
+static constexpr uint32_t HaltonGridY = 243; // 3^5
+
+// Reverses the base InBase digits of InValue, turns a Halton value (InValue / InGridSize) back to its index
+static uint32_t ReverseDigits(uint32_t InValue, uint32_t InBase, uint32_t InGridSize)
+{
+    uint32_t result = 0;
+
+    for (uint32_t size = InGridSize; size > 1; size /= InBase)
+    {
+        result = result * InBase + InValue % InBase;
+        InValue /= InBase;
+    }
+
+    return result;
+}
+
+void JitterAnalyzer::AddSample(float InX, float InY, uint32_t InRenderWidth, uint32_t InRenderHeight)
+{
+    Sample sample { InX, InY };
+
+    // Tolerance follows the jitter magnitude so pixel, NDC and UV sequences are handled the same way
+    _magnitude = std::max({ std::abs(InX), std::abs(InY), _magnitude * 0.995f });
+    const float epsilon = _magnitude * 2e-3f;
+
+    // Frames in a row every lag has repeated itself
+    const uint32_t lagCount = (uint32_t) std::min<uint64_t>(MaxPeriod, _frames);
+
+    for (uint32_t lag = 1; lag <= lagCount; lag++)
+    {
+        if (Equal(_ring[(_head - lag) & RingMask], sample, epsilon))
+            _streak[lag] = (uint16_t) std::min<uint32_t>(_streak[lag] + 1, UINT16_MAX);
+        else
+            _streak[lag] = 0;
+    }
+
+    _ring[_head & RingMask] = sample;
+    _head++;
+    _frames++;
+
+    UpdateLock(sample, epsilon);
+    UpdateUnits(sample, InRenderWidth, InRenderHeight);
+}
+
+void JitterAnalyzer::Reset() { *this = JitterAnalyzer(); }
+
+float JitterAnalyzer::ImpliedRatio() const
+{
+    if (_period < 2)
+        return 0.0f;
+
+    return std::sqrt(_period / 8.0f);
+}
+
+bool JitterAnalyzer::Equal(const Sample& InA, const Sample& InB, float InEpsilon) const
+{
+    return std::abs(InA.x - InB.x) <= InEpsilon && std::abs(InA.y - InB.y) <= InEpsilon;
+}
+
+void JitterAnalyzer::UpdateLock(const Sample& InSample, float InEpsilon)
+{
+    _resetDetected = false;
+
+    if (_period != 0)
+    {
+        const uint32_t next = (_phase + 1) % _period;
+
+        if (Equal(_cycle[next], InSample, InEpsilon))
+        {
+            _phase = next;
+            _misses = 0;
+            return;
+        }
+
+        bool drop = false;
+        bool found = false;
+
+        for (uint32_t i = 0; i < _period; i++)
+        {
+            if (!Equal(_cycle[i], InSample, InEpsilon))
+                continue;
+
+            found = true;
+
+            // Second jump inside one period, sequence got shorter (phase count changed)
+            if (_lastResetFrame != 0 && _frames - _lastResetFrame < _period)
+            {
+                drop = true;
+                break;
+            }
+
+            _phase = i;
+            _misses = 0;
+            _resetCount++;
+            _lastResetFrame = _frames;
+            _resetDetected = true;
+            return;
+        }
+
+        if (!found)
+        {
+            // Single bad frames are ignored, sequence stays in lock
+            _phase = next;
+            drop = ++_misses >= MaxMisses;
+        }
+
+        if (!drop)
+            return;
+
+        _period = 0;
+    }
+
+    // Smallest lag which repeated a whole period, streaks keep running while locked so a changed
+    // sequence is picked up again as soon as it repeats
+    for (uint32_t lag = 1; lag <= MaxPeriod; lag++)
+    {
+        if (_streak[lag] < std::max(lag, MinConfirm))
+            continue;
+
+        _period = lag;
+        _phase = lag - 1;
+        _misses = 0;
+        _lastResetFrame = 0;
+
+        for (uint32_t i = 0; i < lag; i++)
+            _cycle[i] = _ring[(_head - lag + i) & RingMask];
+
+        return;
+    }
+}
+
+void JitterAnalyzer::TrackIndex(IndexTracker& InTracker, float InValue, uint32_t InBase, uint32_t InGridSize)
+{
+    uint32_t index = UINT32_MAX;
+    float value = InValue + 0.5f;
+
+    if (value >= 0.0f && value < 1.0f)
+    {
+        float grid = value * InGridSize;
+        float rounded = std::floor(grid + 0.5f);
+
+        if (std::abs(grid - rounded) <= 0.25f && rounded < InGridSize)
+            index = ReverseDigits((uint32_t) rounded, InBase, InGridSize);
+    }
+
+    bool hit = index != UINT32_MAX && InTracker.last != UINT32_MAX &&
+               (index + InGridSize - InTracker.last) % InGridSize == 1;
+
+    InTracker.hits = (InTracker.hits << 1) | (hit ? 1 : 0);
+    InTracker.last = index;
+}
+
+void JitterAnalyzer::UpdateUnits(const Sample& InSample, uint32_t InRenderWidth, uint32_t InRenderHeight)
+{
+    // Every units & sign combination is tested, the one which walks the Halton indexes one by one wins
+    for (uint32_t i = 0; i < HypothesisCount; i++)
+    {
+        auto units = (Units) (i / 2 + (uint32_t) Units::Pixels);
+        float sign = (i & 1) ? -1.0f : 1.0f;
+        float scaleX = UnitScale(units, InRenderWidth);
+        float scaleY = UnitScale(units, InRenderHeight);
+
+        // Render size is unknown, skip the hypothesis with an out of range value
+        TrackIndex(_trackersX[i], scaleX > 0.0f ? InSample.x * scaleX * sign : -1.0f, 2, HaltonGridX);
+        TrackIndex(_trackersY[i], scaleY > 0.0f ? InSample.y * scaleY * sign : -1.0f, 3, HaltonGridY);
+    }
+
+    _units = Units::Unknown;
+    _flippedX = false;
+    _flippedY = false;
+
+    // Too short to tell apart from noise
+    if (_period < MinConfirm)
+        return;
+
+    // Index goes back at every wrap of the sequence, allow 2 more misses for resets
+    const uint32_t wraps = (32 + _period - 1) / _period;
+    const int threshold = 32 - (int) wraps - 2;
+
+    int bestX = -1;
+    int bestY = -1;
+    int bestHitsX = threshold - 1;
+    int bestHitsY = threshold - 1;
+
+    for (uint32_t i = 0; i < HypothesisCount; i++)
+    {
+        int hitsX = std::popcount(_trackersX[i].hits);
+        int hitsY = std::popcount(_trackersY[i].hits);
+
+        if (hitsX > bestHitsX)
+        {
+            bestX = i;
+            bestHitsX = hitsX;
+        }
+
+        if (hitsY > bestHitsY)
+        {
+            bestY = i;
+            bestHitsY = hitsY;
+        }
+    }
+
+    if (bestX < 0 || bestY < 0 || bestX / 2 != bestY / 2)
+        return;
+
+    _units = (Units) (bestX / 2 + (uint32_t) Units::Pixels);
+    _flippedX = (bestX & 1) != 0;
+    _flippedY = (bestY & 1) != 0;
+}
+
+float JitterAnalyzer::UnitScale(Units InUnits, uint32_t InSize)
+{
+    switch (InUnits)
+    {
+    case Units::Ndc:
+        return InSize * 0.5f;
+
+    case Units::Uv:
+        return (float) InSize;
+
+    default:
+        return 1.0f;
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+// Analyzes the per frame jitter offsets of the game: sequence period (phase count), implied upscale ratio,
+// units and sign compared to the Halton(2, 3) sequence and sequence resets.
+// Uses fixed size storage, AddSample does a bounded amount of work and never allocates.
+// Nothing in here depends on Windows headers so it can be built anywhere.
+
+#include <cstdint>
+#include <array>
+
+class JitterAnalyzer
+{
+  public:
+    // Longest sequence that can be detected, 8 * ratio^2 phases covers up to 4x upscaling
+    static constexpr uint32_t MaxPeriod = 128;
+
+    enum class Units : uint32_t
+    {
+        Unknown = 0,
+        Pixels, // -0.5 - 0.5 render pixels, what upscalers expect
+        Ndc,    // pixels * 2 / render size
+        Uv,     // pixels / render size
+    };
+
+    // Adds the jitter of one frame, render size is used to test the NDC and UV hypothesis
+    void AddSample(float InX, float InY, uint32_t InRenderWidth, uint32_t InRenderHeight);
+
+    // Clears everything, next sample is handled as the first one
+    void Reset();
+
+    // Phase count of the sequence, 0 while not detected, 1 for a constant jitter
+    uint32_t Period() const { return _period; }
+
+    // Display / render ratio the phase count is calculated for (phase count = 8 * ratio^2), 0 if unknown
+    float ImpliedRatio() const;
+
+    // Units of the jitter, only known when the sequence is Halton(2, 3) based
+    Units JitterUnits() const { return _units; }
+
+    // Axis is negated compared to Halton(2, 3) - 0.5, only meaningful when JitterUnits is known
+    bool FlippedX() const { return _flippedX; }
+    bool FlippedY() const { return _flippedY; }
+
+    // Multiplier to convert jitter to render pixels, 1.0 when units are Pixels or Unknown
+    float PixelScaleX(uint32_t InRenderWidth) const { return UnitScale(_units, InRenderWidth); }
+    float PixelScaleY(uint32_t InRenderHeight) const { return UnitScale(_units, InRenderHeight); }
+
+    // Sequence jumped to another phase with the last sample (restarted or skipped ahead)
+    bool ResetDetected() const { return _resetDetected; }
+    uint32_t ResetCount() const { return _resetCount; }
+
+    uint64_t SampleCount() const { return _frames; }
+
+  private:
+    struct Sample
+    {
+        float x;
+        float y;
+    };
+
+    // Halton index tracking of one axis for one units/sign hypothesis
+    struct IndexTracker
+    {
+        uint32_t last = UINT32_MAX; // UINT32_MAX when last sample was not on the Halton grid
+        uint32_t hits = 0;          // bit per frame, set when index advanced by one
+    };
+
+    static constexpr uint32_t RingMask = MaxPeriod - 1;
+    static constexpr uint32_t UnitCount = 3; // Pixels, Ndc, Uv
+    static constexpr uint32_t HypothesisCount = UnitCount * 2;
+
+    // A lag must match this many frames in a row before a short sequence is accepted
+    static constexpr uint32_t MinConfirm = 4;
+
+    // Frames not matching the locked sequence before it's dropped
+    static constexpr uint32_t MaxMisses = 3;
+
+    std::array<Sample, MaxPeriod> _ring {};
+    std::array<uint16_t, MaxPeriod + 1> _streak {}; // indexed by lag
+    std::array<Sample, MaxPeriod> _cycle {};
+    std::array<IndexTracker, HypothesisCount> _trackersX {};
+    std::array<IndexTracker, HypothesisCount> _trackersY {};
+
+    uint32_t _head = 0;
+    uint64_t _frames = 0;
+    float _magnitude = 0.0f;
+
+    uint32_t _period = 0;
+    uint32_t _phase = 0;
+    uint32_t _misses = 0;
+    uint64_t _lastResetFrame = 0;
+    uint32_t _resetCount = 0;
+    bool _resetDetected = false;
+
+    Units _units = Units::Unknown;
+    bool _flippedX = false;
+    bool _flippedY = false;
+
+    bool Equal(const Sample& InA, const Sample& InB, float InEpsilon) const;
+    void UpdateLock(const Sample& InSample, float InEpsilon);
+    void UpdateUnits(const Sample& InSample, uint32_t InRenderWidth, uint32_t InRenderHeight);
+
+    static float UnitScale(Units InUnits, uint32_t InSize);
+    static void TrackIndex(IndexTracker& InTracker, float InValue, uint32_t InBase, uint32_t InGridSize);
+};
@@ -0,0 +1,128 @@
+#include "SharedTextureCache.h"
+
+#include <algorithm>
+
+SharedTextureCache::SharedTextureCache(size_t InCapacity, uint64_t InMaxAge, uint64_t InMinAge)
+    : _capacity(InCapacity), _maxAge(std::max(InMaxAge, InMinAge)), _minAge(InMinAge)
+{
+}
+
+SharedTextureCache::Entry* SharedTextureCache::Find(const void* InSource, const TextureDesc& InDesc, uint64_t InFrame)
+{
+    for (auto& entry : _entries)
+    {
+        if (entry.Source != InSource || entry.Stale)
+            continue;
+
+        // Same pointer with different desc is a new texture at the old address
+        if (!(entry.Desc == InDesc))
+        {
+            entry.Stale = true;
+            break;
+        }
+
+        entry.LastUsed = InFrame;
+        _hits++;
+        return &entry;
+    }
+
+    _misses++;
+    return nullptr;
+}
+
+SharedTextureCache::Entry* SharedTextureCache::Insert(const Entry& InEntry, uint64_t InFrame)
+{
+    // List keeps earlier Find results valid
+    _entries.push_back(InEntry);
+
+    auto& entry = _entries.back();
+    entry.Stale = false;
+    entry.LastUsed = InFrame;
+
+    return &entry;
+}
+
+size_t SharedTextureCache::Collect(uint64_t InFrame, std::vector<Entry>& OutEvicted)
+{
+    auto before = OutEvicted.size();
+
+    auto evictable = [&](const Entry& entry) { return InFrame >= entry.LastUsed + _minAge; };
+
+    for (auto it = _entries.begin(); it != _entries.end();)
+    {
+        if (evictable(*it) && (it->Stale || InFrame >= it->LastUsed + _maxAge))
+        {
+            OutEvicted.push_back(*it);
+            it = _entries.erase(it);
+            continue;
+        }
+
+        it++;
+    }
+
+    while (_entries.size() > _capacity)
+    {
+        auto oldest = _entries.end();
+
+        for (auto it = _entries.begin(); it != _entries.end(); it++)
+        {
+            if (!evictable(*it))
+                continue;
+
+            if (oldest == _entries.end() || it->LastUsed < oldest->LastUsed)
+                oldest = it;
+        }
+
+        // Everything is recently used, let the cache grow
+        if (oldest == _entries.end())
+            break;
+
+        OutEvicted.push_back(*oldest);
+        _entries.erase(oldest);
+    }
+
+    return OutEvicted.size() - before;
+}
+
+void SharedTextureCache::Clear(std::vector<Entry>& OutEvicted)
+{
+    OutEvicted.insert(OutEvicted.end(), _entries.begin(), _entries.end());
+    _entries.clear();
+}
+
+void SharedTexturePromotion::Add(const SharedTextureCache::TextureDesc& InDesc)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (std::find(_descs.begin(), _descs.end(), InDesc) != _descs.end())
+        return;
+
+    if (_descs.size() >= Capacity)
+        _descs.erase(_descs.begin());
+
+    _descs.push_back(InDesc);
+}
+
+bool SharedTexturePromotion::Matches(const SharedTextureCache::TextureDesc& InDesc) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::find(_descs.begin(), _descs.end(), InDesc) != _descs.end();
+}
+
+void SharedTexturePromotion::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _descs.clear();
+}
+
+size_t SharedTexturePromotion::Size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _descs.size();
+}
+
+SharedTexturePromotion& SharedTexturePromotion::Instance()
+{
+    static SharedTexturePromotion instance;
+    return instance;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <vector>
+
+// API independent bookkeeping for game textures which are opened on the Dx12 side once and used without copies.
+// Entries are keyed by the source texture pointer and its description, payload (handle, Dx12 resource) is owned
+// by the caller and returned with evicted entries for release.
+// Entries are only evicted after they are not used for MinAge frames, so resources still in flight are kept.
+// Returned entries stay valid until they are evicted.
+class SharedTextureCache
+{
+  public:
+    struct TextureDesc
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t Format = 0;
+        uint32_t BindFlags = 0;
+        uint32_t MiscFlags = 0;
+
+        bool operator==(const TextureDesc& other) const
+        {
+            return Width == other.Width && Height == other.Height && Format == other.Format &&
+                   BindFlags == other.BindFlags && MiscFlags == other.MiscFlags;
+        }
+    };
+
+    struct Entry
+    {
+        const void* Source = nullptr;
+        TextureDesc Desc;
+        void* Handle = nullptr;
+        void* Resource = nullptr;
+        bool OwnsHandle = false; // NT handles need to be closed
+        bool Stale = false;      // Source was seen with a different desc
+        uint64_t LastUsed = 0;
+    };
+
+  private:
+    std::list<Entry> _entries;
+    size_t _capacity = 16;
+    uint64_t _maxAge = 120;
+    uint64_t _minAge = 4;
+
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+
+  public:
+    // Returns entry for the source and marks it as used in InFrame, nullptr on miss
+    Entry* Find(const void* InSource, const TextureDesc& InDesc, uint64_t InFrame);
+
+    Entry* Insert(const Entry& InEntry, uint64_t InFrame);
+
+    // Evicts stale entries, entries not used for MaxAge frames and least recently used ones over capacity
+    size_t Collect(uint64_t InFrame, std::vector<Entry>& OutEvicted);
+
+    // Moves all entries to OutEvicted, caller must make sure they are not in use
+    void Clear(std::vector<Entry>& OutEvicted);
+
+    size_t Size() const { return _entries.size(); }
+    uint64_t Hits() const { return _hits; }
+    uint64_t Misses() const { return _misses; }
+
+    SharedTextureCache() = default;
+    SharedTextureCache(size_t InCapacity, uint64_t InMaxAge, uint64_t InMinAge);
+};
+
+// Descriptions of upscaler inputs and outputs which had to be copied because they were not shareable.
+// Only textures created with one of these descriptions are promoted to shared by the CreateTexture2D hook,
+// other game textures are created as requested. Used from game's threads, access is locked.
+class SharedTexturePromotion
+{
+  public:
+    static constexpr size_t Capacity = 16;
+
+  private:
+    mutable std::mutex _mutex;
+    std::vector<SharedTextureCache::TextureDesc> _descs;
+
+  public:
+    // Oldest description is dropped when full
+    void Add(const SharedTextureCache::TextureDesc& InDesc);
+    bool Matches(const SharedTextureCache::TextureDesc& InDesc) const;
+    void Clear();
+    size_t Size() const;
+
+    static SharedTexturePromotion& Instance();
+};
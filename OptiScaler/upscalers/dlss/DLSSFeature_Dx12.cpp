@@ -78,6 +78,7 @@ bool DLSSFeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* In
             Imgui = std::make_unique<Menu_Dx12>(Util::GetProcessWindow(), InDevice);
 
         OutputScaler = std::make_unique<OS_Dx12>("OutputScaling", InDevice, (TargetWidth() < DisplayWidth()));
+        CreateFusedRcas();
     }
 
     SetInit(initResult);
@@ -151,8 +152,14 @@ bool DLSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
         // RCAS sharpness & preperation
         _sharpness = GetSharpness(InParameters);
+        bool useFusedRcas = UseFusedRcas(useSS, Config::Instance()->RcasEnabled.value_or(rcasEnabled));
 
-        if (Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
+        if (useFusedRcas)
+        {
+            // Disable DLSS sharpness
+            InParameters->Set(NVSDK_NGX_Parameter_Sharpness, 0.0f);
+        }
+        else if (Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
             (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
                                    Config::Instance()->MotionSharpness.value_or_default() > 0.0f)) &&
             RCAS->IsInit() && RCAS->CreateBufferResource(Device, setBuffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
@@ -174,61 +181,14 @@ bool DLSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
             return false;
         }
 
-        // Apply CAS
-        if (Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
-            (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
-                                   Config::Instance()->MotionSharpness.value_or_default() > 0.0f)) &&
-            RCAS->CanRender())
-        {
-            if (setBuffer != RCAS->Buffer())
-                ResourceBarrier(InCommandList, setBuffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-            RCAS->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-            RcasConstants rcasConstants {};
+        // Apply RCAS and output scaling, FusedRcas applies RCAS in the output scaling pass
+        bool useRcas = !useFusedRcas && Config::Instance()->RcasEnabled.value_or(rcasEnabled) &&
+                       (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or_default() &&
+                                              Config::Instance()->MotionSharpness.value_or_default() > 0.0f)) &&
+                       RCAS->CanRender();
 
-            rcasConstants.Sharpness = _sharpness;
-            rcasConstants.DisplayWidth = TargetWidth();
-            rcasConstants.DisplayHeight = TargetHeight();
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
-            rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
-            rcasConstants.RenderHeight = RenderHeight();
-            rcasConstants.RenderWidth = RenderWidth();
-
-            if (useSS)
-            {
-                if (!RCAS->Dispatch(Device, InCommandList, setBuffer, paramMotion, rcasConstants,
-                                    OutputScaler->Buffer()))
-                {
-                    Config::Instance()->RcasEnabled.set_volatile_value(false);
-                    return true;
-                }
-            }
-            else
-            {
-                if (!RCAS->Dispatch(Device, InCommandList, setBuffer, paramMotion, rcasConstants, paramOutput))
-                {
-                    Config::Instance()->RcasEnabled.set_volatile_value(false);
-                    return true;
-                }
-            }
-        }
-
-        // Downsampling
-        if (useSS)
-        {
-            LOG_DEBUG("downscaling output...");
-            OutputScaler->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-            if (!OutputScaler->Dispatch(Device, InCommandList, OutputScaler->Buffer(), paramOutput))
-            {
-                Config::Instance()->OutputScalingEnabled.set_volatile_value(false);
-                State::Instance().changeBackend[Handle()->Id] = true;
-                return true;
-            }
-        }
+        if (!RecordPostPasses(InCommandList, setBuffer, paramMotion, paramOutput, useRcas, useSS, useFusedRcas))
+            return true;
 
         // imgui
         if (!Config::Instance()->OverlayMenu.value_or_default() && _frameCount > 30 && paramOutput != nullptr)
@@ -27,9 +27,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         // to prevent creation dx12 device if we are going to recreate feature
         if (LowResMV())
         {
-            ID3D11Resource* paramVelocity = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+            ID3D11Resource* paramVelocity = (ID3D11Resource*) _inputs.MotionVectors;
         }
 
         if (AutoExposure())
@@ -38,9 +36,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         }
         else
         {
-            ID3D11Resource* paramExpo = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExpo) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExpo);
+            ID3D11Resource* paramExpo = (ID3D11Resource*) _inputs.Exposure;
 
             if (paramExpo == nullptr)
             {
@@ -49,10 +45,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             }
         }
 
-        ID3D11Resource* paramReactiveMask = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        ID3D11Resource* paramReactiveMask = (ID3D11Resource*) _inputs.BiasColorMask;
         _accessToReactiveMask = paramReactiveMask != nullptr;
 
         if (!Config::Instance()->DisableReactiveMask.has_value())
@@ -130,13 +123,13 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
 
     FfxFsr2DispatchDescription params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = _inputs.JitterX;
+    params.jitterOffset.y = _inputs.JitterY;
 
     if (Config::Instance()->OverrideSharpness.value_or_default())
         _sharpness = Config::Instance()->Sharpness.value_or_default();
     else
-        _sharpness = GetSharpness(InParameters);
+        _sharpness = GetSharpness(_inputs);
 
     if (Config::Instance()->RcasEnabled.value_or_default())
     {
@@ -152,18 +145,16 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         params.sharpness = _sharpness;
     }
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = (_inputs.Reset == 1);
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(_inputs, &params.renderSize.width, &params.renderSize.height);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
-    auto frame = _frameCount % 2;
-    auto cmdList = Dx12CommandList[frame];
+    auto cmdList = Dx12CommandList[_frameRing.Slot()];
+    bool cmdListClosed = false;
 
     params.commandList = ffxGetCommandListDX12(cmdList);
 
@@ -172,9 +163,10 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     do
     {
 
-        if (!ProcessDx11Textures(InParameters))
+        if (!ProcessDx11Textures(_inputs))
         {
             LOG_ERROR("Can't process Dx11 textures!");
+            cmdListClosed = true;
             break;
         }
 
@@ -184,30 +176,30 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         }
 
         params.color =
-            ffxGetResourceDX12(&_context, dx11Color.Dx12Resource, L"FSR2_Color", FFX_RESOURCE_STATE_COMPUTE_READ);
+            ffxGetResourceDX12(&_context, dx11Color->Dx12Resource, L"FSR2_Color", FFX_RESOURCE_STATE_COMPUTE_READ);
         params.motionVectors =
-            ffxGetResourceDX12(&_context, dx11Mv.Dx12Resource, L"FSR2_Motion", FFX_RESOURCE_STATE_COMPUTE_READ);
+            ffxGetResourceDX12(&_context, dx11Mv->Dx12Resource, L"FSR2_Motion", FFX_RESOURCE_STATE_COMPUTE_READ);
         params.depth =
-            ffxGetResourceDX12(&_context, dx11Depth.Dx12Resource, L"FSR2_Depth", FFX_RESOURCE_STATE_COMPUTE_READ);
+            ffxGetResourceDX12(&_context, dx11Depth->Dx12Resource, L"FSR2_Depth", FFX_RESOURCE_STATE_COMPUTE_READ);
         params.exposure =
-            ffxGetResourceDX12(&_context, dx11Exp.Dx12Resource, L"FSR2_Exp", FFX_RESOURCE_STATE_COMPUTE_READ);
+            ffxGetResourceDX12(&_context, dx11Exp->Dx12Resource, L"FSR2_Exp", FFX_RESOURCE_STATE_COMPUTE_READ);
 
-        if (dx11Reactive.Dx12Resource != nullptr)
+        if (dx11Reactive->Dx12Resource != nullptr)
         {
             if (Config::Instance()->FsrUseMaskForTransparency.value_or_default())
                 params.transparencyAndComposition =
-                    ffxGetResourceDX12(&_context, dx11Reactive.Dx12Resource, (wchar_t*) L"FSR2_Transparency",
+                    ffxGetResourceDX12(&_context, dx11Reactive->Dx12Resource, (wchar_t*) L"FSR2_Transparency",
                                        FFX_RESOURCE_STATE_COMPUTE_READ);
 
             if (Bias->IsInit() &&
-                Bias->CreateBufferResource(Dx12Device, dx11Reactive.Dx12Resource,
+                Bias->CreateBufferResource(Dx12Device, dx11Reactive->Dx12Resource,
                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
                 Bias->CanRender())
             {
                 Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
                 if (Config::Instance()->DlssReactiveMaskBias.value_or_default() > 0.0f &&
-                    Bias->Dispatch(Dx12Device, cmdList, dx11Reactive.Dx12Resource,
+                    Bias->Dispatch(Dx12Device, cmdList, dx11Reactive->Dx12Resource,
                                    Config::Instance()->DlssReactiveMaskBias.value_or_default(), Bias->Buffer()))
                 {
                     Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
@@ -220,7 +212,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         // OutputScaling
         if (useSS)
         {
-            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out.Dx12Resource, TargetWidth(), TargetHeight(),
+            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out->Dx12Resource, TargetWidth(), TargetHeight(),
                                                    D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
             {
                 OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
@@ -229,14 +221,14 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             }
             else
             {
-                params.output = ffxGetResourceDX12(&_context, dx11Out.Dx12Resource, L"FSR2_Out",
+                params.output = ffxGetResourceDX12(&_context, dx11Out->Dx12Resource, L"FSR2_Out",
                                                    FFX_RESOURCE_STATE_UNORDERED_ACCESS);
             }
         }
         else
         {
             params.output =
-                ffxGetResourceDX12(&_context, dx11Out.Dx12Resource, L"FSR2_Out", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+                ffxGetResourceDX12(&_context, dx11Out->Dx12Resource, L"FSR2_Out", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
         }
 
         // RCAS
@@ -259,15 +251,11 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         _hasTM = params.transparencyAndComposition.resource != nullptr;
         _hasOutput = params.output.resource != nullptr;
 
-        float MVScaleX = 1.0f;
-        float MVScaleY = 1.0f;
-
-        if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) != NVSDK_NGX_Result_Success ||
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) != NVSDK_NGX_Result_Success)
+        if (!_inputs.HasMVScale)
             LOG_WARN("Can't get motion vector scales!");
 
-        params.motionVectorScale.x = MVScaleX;
-        params.motionVectorScale.y = MVScaleY;
+        params.motionVectorScale.x = _inputs.MVScaleX;
+        params.motionVectorScale.y = _inputs.MVScaleY;
 
         if (DepthInverted())
         {
@@ -289,13 +277,13 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         else
             params.cameraFovAngleVertical = 1.0471975511966f;
 
-        if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-                NVSDK_NGX_Result_Success ||
-            params.frameTimeDelta < 1.0f)
+        if (_inputs.HasFrameTimeDelta)
+            params.frameTimeDelta = _inputs.FrameTimeDelta;
+
+        if (!_inputs.HasFrameTimeDelta || params.frameTimeDelta < 1.0f)
             params.frameTimeDelta = (float) GetDeltaTime();
 
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-            params.preExposure = 1.0f;
+        params.preExposure = _inputs.PreExposure;
 
         LOG_DEBUG("Dispatch!!");
         ffxresult = ffxFsr2ContextDispatch(&_context, &params);
@@ -324,8 +312,13 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             rcasConstants.Sharpness = _sharpness;
             rcasConstants.DisplayWidth = TargetWidth();
             rcasConstants.DisplayHeight = TargetHeight();
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+
+            if (_inputs.HasMVScale)
+            {
+                rcasConstants.MvScaleX = _inputs.MVScaleX;
+                rcasConstants.MvScaleY = _inputs.MVScaleY;
+            }
+
             rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
             rcasConstants.RenderHeight = RenderHeight();
             rcasConstants.RenderWidth = RenderWidth();
@@ -344,7 +337,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             {
                 if (!RCAS->Dispatch(Dx12Device, cmdList, (ID3D12Resource*) params.output.resource,
                                     (ID3D12Resource*) params.motionVectors.resource, rcasConstants,
-                                    dx11Out.Dx12Resource))
+                                    dx11Out->Dx12Resource))
                 {
                     Config::Instance()->RcasEnabled.set_volatile_value(false);
                     break;
@@ -357,7 +350,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             LOG_DEBUG("scaling output...");
             OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
-            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out.Dx12Resource))
+            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out->Dx12Resource))
             {
                 Config::Instance()->OutputScalingEnabled.set_volatile_value(false);
                 State::Instance().changeBackend[Handle()->Id] = true;
@@ -368,10 +361,15 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     } while (false);
 
     // Execute dx12 commands to process fsr
-    cmdList->Close();
-    ID3D12CommandList* ppCommandLists[] = { cmdList };
-    Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
-    Dx12CommandQueue->Signal(dx12FenceTextureCopy, _fenceValue);
+    // ProcessDx11Textures closes the command list when it fails
+    if (!cmdListClosed)
+    {
+        cmdList->Close();
+        ID3D12CommandList* ppCommandLists[] = { cmdList };
+        Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+    }
+
+    QueueDx11WaitForDx12();
 
     auto evalResult = false;
 
@@ -414,7 +412,7 @@ bool FSR2FeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     } while (false);
 
     _frameCount++;
-    Dx12CommandQueue->Signal(Dx12Fence, _frameCount);
+    SubmitFrame();
 
     return evalResult;
 }
@@ -114,21 +114,18 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
 
     FfxFsr2DispatchDescription params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = _inputs.JitterX;
+    params.jitterOffset.y = _inputs.JitterY;
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = (_inputs.Reset == 1);
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(_inputs, &params.renderSize.width, &params.renderSize.height);
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
     params.commandList = ffxGetCommandListVK(InCmdBuffer);
 
-    void* paramColor;
-    InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor);
+    void* paramColor = _inputs.Color;
 
     if (paramColor)
     {
@@ -148,8 +145,7 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
         return false;
     }
 
-    void* paramVelocity;
-    InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity);
+    void* paramVelocity = _inputs.MotionVectors;
 
     if (paramVelocity)
     {
@@ -169,8 +165,7 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
         return false;
     }
 
-    void* paramOutput;
-    InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput);
+    void* paramOutput = _inputs.Output;
 
     if (paramOutput)
     {
@@ -190,8 +185,7 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
         return false;
     }
 
-    void* paramDepth;
-    InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth);
+    void* paramDepth = _inputs.Depth;
 
     if (paramDepth)
     {
@@ -218,7 +212,7 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
     }
     else
     {
-        InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExp);
+        paramExp = _inputs.Exposure;
 
         if (paramExp)
         {
@@ -241,10 +235,7 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
         }
     }
 
-    void* paramReactiveMask = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-        NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+    void* paramReactiveMask = _inputs.BiasColorMask;
 
     if (paramReactiveMask && Config::Instance()->FsrUseMaskForTransparency.value_or_default())
     {
@@ -291,11 +282,10 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
     _accessToReactiveMask = paramReactiveMask != nullptr;
     _hasOutput = params.output.resource != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    float MVScaleX = _inputs.MVScaleX;
+    float MVScaleY = _inputs.MVScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (_inputs.HasMVScale)
     {
         params.motionVectorScale.x = MVScaleX;
         params.motionVectorScale.y = MVScaleY;
@@ -315,8 +305,8 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
     }
     else
     {
-        float shapness = 0.0f;
-        if (InParameters->Get(NVSDK_NGX_Parameter_Sharpness, &shapness) == NVSDK_NGX_Result_Success)
+        float shapness = _inputs.Sharpness;
+        if (_inputs.HasSharpness)
         {
             _sharpness = shapness;
 
@@ -352,13 +342,13 @@ bool FSR2FeatureVk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter* I
     else
         params.cameraFovAngleVertical = 1.0471975511966f;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-            NVSDK_NGX_Result_Success ||
-        params.frameTimeDelta < 1.0f)
+    if (_inputs.HasFrameTimeDelta)
+        params.frameTimeDelta = _inputs.FrameTimeDelta;
+
+    if (!_inputs.HasFrameTimeDelta || params.frameTimeDelta < 1.0f)
         params.frameTimeDelta = (float) GetDeltaTime();
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-        params.preExposure = 1.0f;
+    params.preExposure = _inputs.PreExposure;
 
     LOG_DEBUG("Dispatch!!");
     auto result = ffxFsr2ContextDispatch(&_context, &params);
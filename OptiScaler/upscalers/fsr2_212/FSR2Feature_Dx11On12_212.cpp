@@ -27,9 +27,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         // to prevent creation dx12 device if we are going to recreate feature
         if (LowResMV())
         {
-            ID3D11Resource* paramVelocity = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+            ID3D11Resource* paramVelocity = (ID3D11Resource*) _inputs.MotionVectors;
         }
 
         if (AutoExposure())
@@ -38,9 +36,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         }
         else
         {
-            ID3D11Resource* paramExpo = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExpo) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExpo);
+            ID3D11Resource* paramExpo = (ID3D11Resource*) _inputs.Exposure;
 
             if (paramExpo == nullptr)
             {
@@ -49,10 +45,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
             }
         }
 
-        ID3D11Resource* paramReactiveMask = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        ID3D11Resource* paramReactiveMask = (ID3D11Resource*) _inputs.BiasColorMask;
         _accessToReactiveMask = paramReactiveMask != nullptr;
 
         if (!Config::Instance()->DisableReactiveMask.has_value())
@@ -130,13 +123,13 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
 
     Fsr212::FfxFsr2DispatchDescription params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = _inputs.JitterX;
+    params.jitterOffset.y = _inputs.JitterY;
 
     if (Config::Instance()->OverrideSharpness.value_or_default())
         _sharpness = Config::Instance()->Sharpness.value_or_default();
     else
-        _sharpness = GetSharpness(InParameters);
+        _sharpness = GetSharpness(_inputs);
 
     if (Config::Instance()->RcasEnabled.value_or_default())
     {
@@ -152,18 +145,16 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         params.sharpness = _sharpness;
     }
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = (_inputs.Reset == 1);
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(_inputs, &params.renderSize.width, &params.renderSize.height);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
-    auto frame = _frameCount % 2;
-    auto cmdList = Dx12CommandList[frame];
+    auto cmdList = Dx12CommandList[_frameRing.Slot()];
+    bool cmdListClosed = false;
 
     params.commandList = Fsr212::ffxGetCommandListDX12_212(cmdList);
 
@@ -171,9 +162,10 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
 
     do
     {
-        if (!ProcessDx11Textures(InParameters))
+        if (!ProcessDx11Textures(_inputs))
         {
             LOG_ERROR("Can't process Dx11 textures!");
+            cmdListClosed = true;
             break;
         }
 
@@ -182,31 +174,32 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
             break;
         }
 
-        params.color = Fsr212::ffxGetResourceDX12_212(&_context, dx11Color.Dx12Resource, (wchar_t*) L"FSR2_Color",
+        params.color = Fsr212::ffxGetResourceDX12_212(&_context, dx11Color->Dx12Resource, (wchar_t*) L"FSR2_Color",
                                                       Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
-        params.motionVectors = Fsr212::ffxGetResourceDX12_212(&_context, dx11Mv.Dx12Resource, (wchar_t*) L"FSR2_Motion",
-                                                              Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
-        params.depth = Fsr212::ffxGetResourceDX12_212(&_context, dx11Depth.Dx12Resource, (wchar_t*) L"FSR2_Depth",
+        params.motionVectors =
+            Fsr212::ffxGetResourceDX12_212(&_context, dx11Mv->Dx12Resource, (wchar_t*) L"FSR2_Motion",
+                                           Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
+        params.depth = Fsr212::ffxGetResourceDX12_212(&_context, dx11Depth->Dx12Resource, (wchar_t*) L"FSR2_Depth",
                                                       Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
-        params.exposure = Fsr212::ffxGetResourceDX12_212(&_context, dx11Exp.Dx12Resource, (wchar_t*) L"FSR2_Exp",
+        params.exposure = Fsr212::ffxGetResourceDX12_212(&_context, dx11Exp->Dx12Resource, (wchar_t*) L"FSR2_Exp",
                                                          Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
 
-        if (dx11Reactive.Dx12Resource != nullptr)
+        if (dx11Reactive->Dx12Resource != nullptr)
         {
             if (Config::Instance()->FsrUseMaskForTransparency.value_or_default())
                 params.transparencyAndComposition = Fsr212::ffxGetResourceDX12_212(
-                    &_context, dx11Reactive.Dx12Resource, (wchar_t*) L"FSR2_Transparency",
+                    &_context, dx11Reactive->Dx12Resource, (wchar_t*) L"FSR2_Transparency",
                     Fsr212::FFX_RESOURCE_STATE_COMPUTE_READ);
 
             if (Bias->IsInit() &&
-                Bias->CreateBufferResource(Dx12Device, dx11Reactive.Dx12Resource,
+                Bias->CreateBufferResource(Dx12Device, dx11Reactive->Dx12Resource,
                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
                 Bias->CanRender())
             {
                 Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
                 if (Config::Instance()->DlssReactiveMaskBias.value_or_default() > 0.0f &&
-                    Bias->Dispatch(Dx12Device, cmdList, dx11Reactive.Dx12Resource,
+                    Bias->Dispatch(Dx12Device, cmdList, dx11Reactive->Dx12Resource,
                                    Config::Instance()->DlssReactiveMaskBias.value_or_default(), Bias->Buffer()))
                 {
                     Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
@@ -220,7 +213,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         // OutputScaling
         if (useSS)
         {
-            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out.Dx12Resource, TargetWidth(), TargetHeight(),
+            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out->Dx12Resource, TargetWidth(), TargetHeight(),
                                                    D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
             {
                 OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
@@ -229,11 +222,11 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
                                                    Fsr212::FFX_RESOURCE_STATE_UNORDERED_ACCESS);
             }
             else
-                params.output = Fsr212::ffxGetResourceDX12_212(&_context, dx11Out.Dx12Resource, (wchar_t*) L"FSR2_Out",
+                params.output = Fsr212::ffxGetResourceDX12_212(&_context, dx11Out->Dx12Resource, (wchar_t*) L"FSR2_Out",
                                                                Fsr212::FFX_RESOURCE_STATE_UNORDERED_ACCESS);
         }
         else
-            params.output = Fsr212::ffxGetResourceDX12_212(&_context, dx11Out.Dx12Resource, (wchar_t*) L"FSR2_Out",
+            params.output = Fsr212::ffxGetResourceDX12_212(&_context, dx11Out->Dx12Resource, (wchar_t*) L"FSR2_Out",
                                                            Fsr212::FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
         // RCAS
@@ -256,11 +249,10 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         _hasTM = params.transparencyAndComposition.resource != nullptr;
         _hasOutput = params.output.resource != nullptr;
 
-        float MVScaleX = 1.0f;
-        float MVScaleY = 1.0f;
+        float MVScaleX = _inputs.MVScaleX;
+        float MVScaleY = _inputs.MVScaleY;
 
-        if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+        if (_inputs.HasMVScale)
         {
             params.motionVectorScale.x = MVScaleX;
             params.motionVectorScale.y = MVScaleY;
@@ -293,13 +285,13 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
         else
             params.cameraFovAngleVertical = 1.0471975511966f;
 
-        if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-                NVSDK_NGX_Result_Success ||
-            params.frameTimeDelta < 1.0f)
+        if (_inputs.HasFrameTimeDelta)
+            params.frameTimeDelta = _inputs.FrameTimeDelta;
+
+        if (!_inputs.HasFrameTimeDelta || params.frameTimeDelta < 1.0f)
             params.frameTimeDelta = (float) GetDeltaTime();
 
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-            params.preExposure = 1.0f;
+        params.preExposure = _inputs.PreExposure;
 
         LOG_DEBUG("Dispatch!!");
         ffxresult = Fsr212::ffxFsr2ContextDispatch212(&_context, &params);
@@ -328,8 +320,13 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
             rcasConstants.Sharpness = _sharpness;
             rcasConstants.DisplayWidth = TargetWidth();
             rcasConstants.DisplayHeight = TargetHeight();
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+
+            if (_inputs.HasMVScale)
+            {
+                rcasConstants.MvScaleX = _inputs.MVScaleX;
+                rcasConstants.MvScaleY = _inputs.MVScaleY;
+            }
+
             rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
             rcasConstants.RenderHeight = RenderHeight();
             rcasConstants.RenderWidth = RenderWidth();
@@ -348,7 +345,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
             {
                 if (!RCAS->Dispatch(Dx12Device, cmdList, (ID3D12Resource*) params.output.resource,
                                     (ID3D12Resource*) params.motionVectors.resource, rcasConstants,
-                                    dx11Out.Dx12Resource))
+                                    dx11Out->Dx12Resource))
                 {
                     Config::Instance()->RcasEnabled.set_volatile_value(false);
                     break;
@@ -361,7 +358,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
             LOG_DEBUG("scaling output...");
             OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
-            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out.Dx12Resource))
+            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out->Dx12Resource))
             {
                 Config::Instance()->OutputScalingEnabled.set_volatile_value(false);
                 State::Instance().changeBackend[Handle()->Id] = true;
@@ -372,10 +369,15 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
 
     } while (false);
 
-    cmdList->Close();
-    ID3D12CommandList* ppCommandLists[] = { cmdList };
-    Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
-    Dx12CommandQueue->Signal(dx12FenceTextureCopy, _fenceValue);
+    // ProcessDx11Textures closes the command list when it fails
+    if (!cmdListClosed)
+    {
+        cmdList->Close();
+        ID3D12CommandList* ppCommandLists[] = { cmdList };
+        Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+    }
+
+    QueueDx11WaitForDx12();
 
     auto evalResult = false;
 
@@ -418,7 +420,7 @@ bool FSR2FeatureDx11on12_212::Evaluate(ID3D11DeviceContext* InDeviceContext, NVS
     } while (false);
 
     _frameCount++;
-    Dx12CommandQueue->Signal(Dx12Fence, _frameCount);
+    SubmitFrame();
 
     return evalResult;
 }
@@ -301,17 +301,14 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
     xess_result_t xessResult;
     xess_d3d11_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = _inputs.JitterX;
+    params.jitterOffsetY = _inputs.JitterY;
+    params.exposureScale = _inputs.ExposureScale;
+    params.resetHistory = _inputs.Reset;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success)
-        params.exposureScale = 1.0f;
+    GetRenderResolution(_inputs, &params.inputWidth, &params.inputHeight);
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
-
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
-
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(_inputs);
 
     float ssMulti = Config::Instance()->OutputScalingMultiplier.value_or(1.5f);
 
@@ -319,9 +316,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    ID3D11Resource* paramColor = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D11Resource* paramColor = (ID3D11Resource*) _inputs.Color;
 
     if (paramColor)
     {
@@ -334,9 +329,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
         return false;
     }
 
-    ID3D11Resource* paramVelocity = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+    ID3D11Resource* paramVelocity = (ID3D11Resource*) _inputs.MotionVectors;
 
     if (paramVelocity)
     {
@@ -349,9 +342,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
         return false;
     }
 
-    ID3D11Resource* paramOutput = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D11Resource* paramOutput = (ID3D11Resource*) _inputs.Output;
 
     if (paramOutput)
     {
@@ -382,9 +373,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
         return false;
     }
 
-    ID3D11Resource* paramDepth = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+    ID3D11Resource* paramDepth = (ID3D11Resource*) _inputs.Depth;
 
     if (paramDepth)
     {
@@ -402,9 +391,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
 
     if (!AutoExposure())
     {
-        ID3D11Resource* paramExp = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExp) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExp);
+        ID3D11Resource* paramExp = (ID3D11Resource*) _inputs.Exposure;
 
         if (paramExp)
         {
@@ -426,10 +413,7 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
 
     if (!Config::Instance()->DisableReactiveMask.value_or(true))
     {
-        ID3D11Resource* paramReactiveMask = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        ID3D11Resource* paramReactiveMask = (ID3D11Resource*) _inputs.BiasColorMask;
 
         if (paramReactiveMask)
         {
@@ -453,11 +437,10 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
     _hasExposure = params.pExposureScaleTexture != nullptr;
     _accessToReactiveMask = params.pResponsivePixelMaskTexture != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    float MVScaleX = _inputs.MVScaleX;
+    float MVScaleY = _inputs.MVScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (_inputs.HasMVScale)
     {
         xessResult = XeSSProxy::D3D11SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
 
@@ -503,8 +486,13 @@ bool XeSSFeature_Dx11::Evaluate(ID3D11DeviceContext* DeviceContext, NVSDK_NGX_Pa
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+
+        if (_inputs.HasMVScale)
+        {
+            rcasConstants.MvScaleX = _inputs.MVScaleX;
+            rcasConstants.MvScaleY = _inputs.MVScaleY;
+        }
+
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
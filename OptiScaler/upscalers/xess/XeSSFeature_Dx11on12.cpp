@@ -38,15 +38,11 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     if (!_baseInit)
     {
         // to prevent creation dx12 device if we are going to recreate feature
-        ID3D11Resource* paramVelocity = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+        ID3D11Resource* paramVelocity = (ID3D11Resource*) _inputs.MotionVectors;
 
         if (!AutoExposure())
         {
-            ID3D11Resource* paramExpo = nullptr;
-            if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExpo) != NVSDK_NGX_Result_Success)
-                InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExpo);
+            ID3D11Resource* paramExpo = (ID3D11Resource*) _inputs.Exposure;
 
             if (paramExpo == nullptr)
             {
@@ -55,10 +51,7 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             }
         }
 
-        ID3D11Resource* paramReactiveMask = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        ID3D11Resource* paramReactiveMask = (ID3D11Resource*) _inputs.BiasColorMask;
         _accessToReactiveMask = paramReactiveMask != nullptr;
 
         if (!Config::Instance()->DisableReactiveMask.has_value())
@@ -164,30 +157,28 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     xess_result_t xessResult;
     xess_d3d12_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = _inputs.JitterX;
+    params.jitterOffsetY = _inputs.JitterY;
+    params.exposureScale = _inputs.ExposureScale;
+    params.resetHistory = _inputs.Reset;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success)
-        params.exposureScale = 1.0f;
+    GetRenderResolution(_inputs, &params.inputWidth, &params.inputHeight);
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
-
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
-
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(_inputs);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or(false) && LowResMV();
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    auto frame = _frameCount % 2;
-    auto cmdList = Dx12CommandList[frame];
+    auto cmdList = Dx12CommandList[_frameRing.Slot()];
+    bool cmdListClosed = false;
 
     do
     {
-        if (!ProcessDx11Textures(InParameters))
+        if (!ProcessDx11Textures(_inputs))
         {
             LOG_ERROR("Can't process Dx11 textures!");
+            cmdListClosed = true;
             break;
         }
 
@@ -196,25 +187,25 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             break;
         }
 
-        params.pColorTexture = dx11Color.Dx12Resource;
+        params.pColorTexture = dx11Color->Dx12Resource;
         _hasColor = params.pColorTexture != nullptr;
-        params.pVelocityTexture = dx11Mv.Dx12Resource;
+        params.pVelocityTexture = dx11Mv->Dx12Resource;
         _hasMV = params.pVelocityTexture != nullptr;
 
         if (useSS)
         {
-            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out.Dx12Resource, TargetWidth(), TargetHeight(),
+            if (OutputScaler->CreateBufferResource(Dx12Device, dx11Out->Dx12Resource, TargetWidth(), TargetHeight(),
                                                    D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
             {
                 OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
                 params.pOutputTexture = OutputScaler->Buffer();
             }
             else
-                params.pOutputTexture = dx11Out.Dx12Resource;
+                params.pOutputTexture = dx11Out->Dx12Resource;
         }
         else
         {
-            params.pOutputTexture = dx11Out.Dx12Resource;
+            params.pOutputTexture = dx11Out->Dx12Resource;
         }
 
         // RCAS
@@ -229,21 +220,21 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
         }
 
         _hasOutput = params.pOutputTexture != nullptr;
-        params.pDepthTexture = dx11Depth.Dx12Resource;
+        params.pDepthTexture = dx11Depth->Dx12Resource;
         _hasDepth = params.pDepthTexture != nullptr;
-        params.pExposureScaleTexture = dx11Exp.Dx12Resource;
+        params.pExposureScaleTexture = dx11Exp->Dx12Resource;
         _hasExposure = params.pExposureScaleTexture != nullptr;
 
-        if (dx11Reactive.Dx12Resource != nullptr)
+        if (dx11Reactive->Dx12Resource != nullptr)
         {
             if (Config::Instance()->DlssReactiveMaskBias.value_or(0.0f) > 0.0f && Bias->IsInit() &&
-                Bias->CreateBufferResource(Dx12Device, dx11Reactive.Dx12Resource,
+                Bias->CreateBufferResource(Dx12Device, dx11Reactive->Dx12Resource,
                                            D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
                 Bias->CanRender())
             {
                 Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
-                if (Bias->Dispatch(Dx12Device, cmdList, dx11Reactive.Dx12Resource,
+                if (Bias->Dispatch(Dx12Device, cmdList, dx11Reactive->Dx12Resource,
                                    Config::Instance()->DlssReactiveMaskBias.value_or(0.0f), Bias->Buffer()))
                 {
                     Bias->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
@@ -252,13 +243,9 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             }
         }
 
-        float MVScaleX;
-        float MVScaleY;
-
-        if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+        if (_inputs.HasMVScale)
         {
-            xessResult = XeSSProxy::SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
+            xessResult = XeSSProxy::SetVelocityScale()(_xessContext, _inputs.MVScaleX, _inputs.MVScaleY);
 
             if (xessResult != XESS_RESULT_SUCCESS)
             {
@@ -312,8 +299,13 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             rcasConstants.Sharpness = _sharpness;
             rcasConstants.DisplayWidth = TargetWidth();
             rcasConstants.DisplayHeight = TargetHeight();
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+
+            if (_inputs.HasMVScale)
+            {
+                rcasConstants.MvScaleX = _inputs.MVScaleX;
+                rcasConstants.MvScaleY = _inputs.MVScaleY;
+            }
+
             rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
             rcasConstants.RenderHeight = RenderHeight();
             rcasConstants.RenderWidth = RenderWidth();
@@ -330,7 +322,7 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             else
             {
                 if (!RCAS->Dispatch(Dx12Device, cmdList, params.pOutputTexture, params.pVelocityTexture, rcasConstants,
-                                    dx11Out.Dx12Resource))
+                                    dx11Out->Dx12Resource))
                 {
                     Config::Instance()->RcasEnabled = false;
                     break;
@@ -343,7 +335,7 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
             LOG_DEBUG("scaling output...");
             OutputScaler->SetBufferState(cmdList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
-            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out.Dx12Resource))
+            if (!OutputScaler->Dispatch(Dx12Device, cmdList, OutputScaler->Buffer(), dx11Out->Dx12Resource))
             {
                 Config::Instance()->OutputScalingEnabled = false;
                 State::Instance().changeBackend[_handle->Id] = true;
@@ -354,10 +346,15 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
 
     } while (false);
 
-    cmdList->Close();
-    ID3D12CommandList* ppCommandLists[] = { cmdList };
-    Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
-    Dx12CommandQueue->Signal(dx12FenceTextureCopy, _fenceValue);
+    // ProcessDx11Textures closes the command list when it fails
+    if (!cmdListClosed)
+    {
+        cmdList->Close();
+        ID3D12CommandList* ppCommandLists[] = { cmdList };
+        Dx12CommandQueue->ExecuteCommandLists(1, ppCommandLists);
+    }
+
+    QueueDx11WaitForDx12();
 
     auto evalResult = false;
 
@@ -400,7 +397,7 @@ bool XeSSFeatureDx11on12::Evaluate(ID3D11DeviceContext* InDeviceContext, NVSDK_N
     } while (false);
 
     _frameCount++;
-    Dx12CommandQueue->Signal(Dx12Fence, _frameCount);
+    SubmitFrame();
 
     return evalResult;
 }
@@ -20,6 +20,7 @@ bool XeSSFeatureDx12::Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* In
             Imgui = std::make_unique<Menu_Dx12>(Util::GetProcessWindow(), InDevice);
 
         OutputScaler = std::make_unique<OS_Dx12>("Output Scaling", InDevice, (TargetWidth() < DisplayWidth()));
+        CreateFusedRcas();
         RCAS = std::make_unique<RCAS_Dx12>("RCAS", InDevice);
         Bias = std::make_unique<Bias_Dx12>("Bias", InDevice);
 
@@ -69,27 +70,23 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     xess_d3d12_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = _inputs.JitterX;
+    params.jitterOffsetY = _inputs.JitterY;
+    params.exposureScale = _inputs.ExposureScale;
+    params.resetHistory = _inputs.Reset;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success)
-        params.exposureScale = 1.0f;
+    GetRenderResolution(_inputs, &params.inputWidth, &params.inputHeight);
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
-
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
-
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(_inputs);
 
     float ssMulti = Config::Instance()->OutputScalingMultiplier.value_or(1.5f);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or(false) && LowResMV();
+    bool useFusedRcas = UseFusedRcas(useSS, Config::Instance()->RcasEnabled.value_or(true));
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = (ID3D12Resource*) _inputs.Color;
 
     if (paramColor)
     {
@@ -117,8 +114,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &params.pVelocityTexture) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &params.pVelocityTexture);
+    params.pVelocityTexture = (ID3D12Resource*) _inputs.MotionVectors;
 
     if (params.pVelocityTexture)
     {
@@ -144,10 +140,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = (ID3D12Resource*) _inputs.Output;
 
     if (paramOutput)
     {
@@ -175,7 +168,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         else
             params.pOutputTexture = paramOutput;
 
-        if (Config::Instance()->RcasEnabled.value_or(true) &&
+        if (!useFusedRcas && Config::Instance()->RcasEnabled.value_or(true) &&
             (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or(false) &&
                                    Config::Instance()->MotionSharpness.value_or(0.4) > 0.0f)) &&
             RCAS->IsInit() &&
@@ -191,8 +184,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &params.pDepthTexture) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &params.pDepthTexture);
+    params.pDepthTexture = (ID3D12Resource*) _inputs.Depth;
 
     if (params.pDepthTexture)
     {
@@ -217,9 +209,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     if (!AutoExposure())
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &params.pExposureScaleTexture) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &params.pExposureScaleTexture);
+        params.pExposureScaleTexture = (ID3D12Resource*) _inputs.Exposure;
 
         if (params.pExposureScaleTexture)
         {
@@ -243,17 +233,16 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     ID3D12Resource* paramReactiveMask = nullptr;
 
-    if (isVersionOrBetter(Version(), { 2, 0, 1 }) &&
-        InParameters->Get("FSR.reactive", &paramReactiveMask) == NVSDK_NGX_Result_Success)
+    if (isVersionOrBetter(Version(), { 2, 0, 1 }) && _inputs.HasReactive)
     {
+        paramReactiveMask = (ID3D12Resource*) _inputs.Reactive;
+
         if (!Config::Instance()->DisableReactiveMask.value_or(!isVersionOrBetter(Version(), { 2, 0, 1 })))
             params.pResponsivePixelMaskTexture = paramReactiveMask;
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, &paramReactiveMask) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask);
+        paramReactiveMask = (ID3D12Resource*) _inputs.BiasColorMask;
 
         if (!Config::Instance()->DisableReactiveMask.value_or(!isVersionOrBetter(Version(), { 2, 0, 1 })) &&
             paramReactiveMask)
@@ -299,11 +288,10 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     _hasExposure = params.pExposureScaleTexture != nullptr;
     _accessToReactiveMask = paramReactiveMask != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    float MVScaleX = _inputs.MVScaleX;
+    float MVScaleY = _inputs.MVScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (_inputs.HasMVScale)
     {
         xessResult = XeSSProxy::SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
 
@@ -338,61 +326,15 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    // Apply RCAS
-    if (Config::Instance()->RcasEnabled.value_or(true) &&
-        (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or(false) &&
-                               Config::Instance()->MotionSharpness.value_or(0.4) > 0.0f)) &&
-        RCAS->CanRender())
-    {
-        if (params.pOutputTexture != RCAS->Buffer())
-            ResourceBarrier(InCommandList, params.pOutputTexture, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-        RCAS->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-        RcasConstants rcasConstants {};
+    // Apply RCAS and output scaling
+    bool useRcas = !useFusedRcas && Config::Instance()->RcasEnabled.value_or(true) &&
+                   (_sharpness > 0.0f || (Config::Instance()->MotionSharpnessEnabled.value_or(false) &&
+                                          Config::Instance()->MotionSharpness.value_or(0.4) > 0.0f)) &&
+                   RCAS->CanRender();
 
-        rcasConstants.Sharpness = _sharpness;
-        rcasConstants.DisplayWidth = TargetWidth();
-        rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
-        rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
-        rcasConstants.RenderHeight = RenderHeight();
-        rcasConstants.RenderWidth = RenderWidth();
-
-        if (useSS)
-        {
-            if (!RCAS->Dispatch(Device, InCommandList, params.pOutputTexture, params.pVelocityTexture, rcasConstants,
-                                OutputScaler->Buffer()))
-            {
-                Config::Instance()->RcasEnabled = false;
-                return true;
-            }
-        }
-        else
-        {
-            if (!RCAS->Dispatch(Device, InCommandList, params.pOutputTexture, params.pVelocityTexture, rcasConstants,
-                                paramOutput))
-            {
-                Config::Instance()->RcasEnabled = false;
-                return true;
-            }
-        }
-    }
-
-    if (useSS)
-    {
-        LOG_DEBUG("scaling output...");
-        OutputScaler->SetBufferState(InCommandList, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-
-        if (!OutputScaler->Dispatch(Device, InCommandList, OutputScaler->Buffer(), paramOutput))
-        {
-            Config::Instance()->OutputScalingEnabled = false;
-            State::Instance().changeBackend[_handle->Id] = true;
-            return true;
-        }
-    }
+    if (!RecordPostPasses(InCommandList, params.pOutputTexture, params.pVelocityTexture, paramOutput, useRcas, useSS,
+                          useFusedRcas))
+        return true;
 
     // imgui
     if (!Config::Instance()->OverlayMenu.value_or(true) && _frameCount > 30)
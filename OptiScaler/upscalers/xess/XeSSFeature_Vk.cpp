@@ -412,17 +412,14 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
     xess_result_t xessResult;
     xess_vk_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = _inputs.JitterX;
+    params.jitterOffsetY = _inputs.JitterY;
+    params.exposureScale = _inputs.ExposureScale;
+    params.resetHistory = _inputs.Reset;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success)
-        params.exposureScale = 1.0f;
+    GetRenderResolution(_inputs, &params.inputWidth, &params.inputHeight);
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
-
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
-
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(_inputs);
 
     float ssMulti = Config::Instance()->OutputScalingMultiplier.value_or(1.5f);
 
@@ -430,9 +427,8 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    NVSDK_NGX_Resource_VK* paramColor = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor) == NVSDK_NGX_Result_Success &&
-        paramColor != nullptr)
+    NVSDK_NGX_Resource_VK* paramColor = (NVSDK_NGX_Resource_VK*) _inputs.Color;
+    if (paramColor != nullptr)
     {
         LOG_DEBUG("Color exist..");
         params.colorTexture = NV_to_XeSS(paramColor);
@@ -443,9 +439,8 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
         return false;
     }
 
-    NVSDK_NGX_Resource_VK* paramVelocity = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity) == NVSDK_NGX_Result_Success &&
-        paramVelocity != nullptr)
+    NVSDK_NGX_Resource_VK* paramVelocity = (NVSDK_NGX_Resource_VK*) _inputs.MotionVectors;
+    if (paramVelocity != nullptr)
     {
         LOG_DEBUG("MotionVectors exist..");
         params.velocityTexture = NV_to_XeSS(paramVelocity);
@@ -456,9 +451,8 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
         return false;
     }
 
-    NVSDK_NGX_Resource_VK* paramOutput = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput) == NVSDK_NGX_Result_Success &&
-        paramOutput != nullptr)
+    NVSDK_NGX_Resource_VK* paramOutput = (NVSDK_NGX_Resource_VK*) _inputs.Output;
+    if (paramOutput != nullptr)
     {
         LOG_DEBUG("Output exist..");
         params.outputTexture = NV_to_XeSS(paramOutput);
@@ -469,9 +463,8 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
         return false;
     }
 
-    NVSDK_NGX_Resource_VK* paramDepth = nullptr;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth) == NVSDK_NGX_Result_Success &&
-        paramDepth != nullptr)
+    NVSDK_NGX_Resource_VK* paramDepth = (NVSDK_NGX_Resource_VK*) _inputs.Depth;
+    if (paramDepth != nullptr)
     {
         LOG_DEBUG("Depth exist..");
         params.depthTexture = NV_to_XeSS(paramDepth);
@@ -487,9 +480,8 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
 
     if (!AutoExposure())
     {
-        NVSDK_NGX_Resource_VK* paramExp = nullptr;
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExp) == NVSDK_NGX_Result_Success &&
-            paramExp != nullptr)
+        NVSDK_NGX_Resource_VK* paramExp = (NVSDK_NGX_Resource_VK*) _inputs.Exposure;
+        if (paramExp != nullptr)
         {
             LOG_DEBUG("ExposureTexture exist..");
             params.exposureScaleTexture = NV_to_XeSS(paramExp);
@@ -506,17 +498,18 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
         LOG_DEBUG("AutoExposure enabled!");
 
     NVSDK_NGX_Resource_VK* paramReactiveMask = nullptr;
-    if (isVersionOrBetter(Version(), { 2, 0, 1 }) &&
-        InParameters->Get("FSR.reactive", (void**) &paramReactiveMask) == NVSDK_NGX_Result_Success)
+    if (isVersionOrBetter(Version(), { 2, 0, 1 }) && _inputs.HasReactive)
     {
+        paramReactiveMask = (NVSDK_NGX_Resource_VK*) _inputs.Reactive;
+
         if (!Config::Instance()->DisableReactiveMask.value_or(true))
             params.responsivePixelMaskTexture = NV_to_XeSS(paramReactiveMask);
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask, (void**) &paramReactiveMask) ==
-                NVSDK_NGX_Result_Success &&
-            paramReactiveMask != nullptr)
+        paramReactiveMask = (NVSDK_NGX_Resource_VK*) _inputs.BiasColorMask;
+
+        if (paramReactiveMask != nullptr)
         {
             LOG_DEBUG("Input Bias mask exist..");
             Config::Instance()->DisableReactiveMask = false;
@@ -543,11 +536,10 @@ bool XeSSFeature_Vk::Evaluate(VkCommandBuffer InCmdBuffer, NVSDK_NGX_Parameter*
     _hasExposure = params.exposureScaleTexture.image != VK_NULL_HANDLE;
     _accessToReactiveMask = params.responsivePixelMaskTexture.image != VK_NULL_HANDLE;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    float MVScaleX = _inputs.MVScaleX;
+    float MVScaleY = _inputs.MVScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (_inputs.HasMVScale)
     {
         xessResult = XeSSProxy::SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
 
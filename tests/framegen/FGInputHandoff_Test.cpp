@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <framegen/FGInputHandoff.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+// Frame loop of IFGFeature_Dx12 + FSRFG_Dx12 with resources reduced to the frame number they hold.
+// Upscaler evaluate registers the inputs and copies them when not handed off, game passes may write the inputs
+// before FG, FG checks Consumed before reading. Each generated frame must read the data of its upscaler evaluate.
+class HandoffSimulator
+{
+  public:
+    struct Buffer
+    {
+        uint64_t Content = 0;
+    };
+
+    struct Frame
+    {
+        bool Generated = false;
+        bool VelocityHandedOff = false;
+        bool DepthHandedOff = false;
+        bool Correct = true;
+    };
+
+    FGInputHandoff Handoff;
+    std::array<Buffer, 2> Velocity {};
+    Buffer Depth {};
+    bool Tracking = true;
+
+    // InVelocityWrite / InDepthWrite: game writes the inputs between upscaler and FG
+    Frame RunFrame(uint64_t InFrame, bool InVelocityWrite, bool InDepthWrite)
+    {
+        Frame result {};
+
+        // Game renders the inputs, velocity is ping-ponged
+        auto& velocity = Velocity[InFrame % Velocity.size()];
+        velocity.Content = InFrame;
+        Depth.Content = InFrame;
+
+        // Upscaler evaluate, SetVelocity & SetDepth
+        result.VelocityHandedOff = Handoff.Register(FGInputHandoff::Velocity, &velocity, Tracking);
+        result.DepthHandedOff = Handoff.Register(FGInputHandoff::Depth, &Depth, Tracking);
+        auto velocityCopy = velocity.Content;
+        auto depthCopy = Depth.Content;
+
+        // Unrelated write to the other velocity buffer, next frame's inputs
+        Handoff.Written(&Velocity[(InFrame + 1) % Velocity.size()]);
+
+        if (InVelocityWrite)
+        {
+            velocity.Content = ~0ull;
+            Handoff.Written(&velocity);
+        }
+
+        if (InDepthWrite)
+        {
+            Depth.Content = ~0ull;
+            Handoff.Written(&Depth);
+        }
+
+        // FG dispatch, decision is made before inputs are read
+        result.Generated = Handoff.Consumed();
+
+        if (result.Generated)
+        {
+            auto readVelocity = result.VelocityHandedOff ? velocity.Content : velocityCopy;
+            auto readDepth = result.DepthHandedOff ? Depth.Content : depthCopy;
+            result.Correct = readVelocity == InFrame && readDepth == InFrame;
+        }
+
+        return result;
+    }
+};
+
+TEST(FGInputHandoff, UntrackedAlwaysCopies)
+{
+    FGInputHandoff handoff;
+    int velocity = 0;
+
+    for (uint32_t i = 0; i < FGInputHandoff::ProbationFrames * 2; i++)
+    {
+        EXPECT_FALSE(handoff.Register(FGInputHandoff::Velocity, &velocity, false));
+        EXPECT_TRUE(handoff.Consumed());
+    }
+
+    EXPECT_FALSE(handoff.IsHandedOff(FGInputHandoff::Velocity));
+}
+
+TEST(FGInputHandoff, HandedOffAfterProbation)
+{
+    HandoffSimulator sim;
+
+    for (uint64_t frame = 1; frame <= FGInputHandoff::ProbationFrames * 3; frame++)
+    {
+        auto result = sim.RunFrame(frame, false, false);
+
+        EXPECT_TRUE(result.Generated);
+        EXPECT_TRUE(result.Correct);
+
+        // Both ping-pong buffers go through probation separately
+        EXPECT_EQ(result.VelocityHandedOff, frame > FGInputHandoff::ProbationFrames * 2) << frame;
+        EXPECT_EQ(result.DepthHandedOff, frame > FGInputHandoff::ProbationFrames) << frame;
+    }
+
+    EXPECT_EQ(sim.Handoff.HazardCount(FGInputHandoff::Velocity), 0u);
+}
+
+TEST(FGInputHandoff, WriteDuringProbationBlocksHandoff)
+{
+    HandoffSimulator sim;
+
+    // Copies are still made, frame is fine
+    auto result = sim.RunFrame(1, false, true);
+    EXPECT_TRUE(result.Generated);
+    EXPECT_TRUE(result.Correct);
+    EXPECT_EQ(sim.Handoff.HazardCount(FGInputHandoff::Depth), 1u);
+
+    for (uint64_t frame = 2; frame < 64; frame++)
+    {
+        result = sim.RunFrame(frame, false, false);
+        EXPECT_TRUE(result.Correct);
+        EXPECT_FALSE(sim.Handoff.IsHandedOff(FGInputHandoff::Depth));
+    }
+}
+
+TEST(FGInputHandoff, HazardFrameIsNotGenerated)
+{
+    HandoffSimulator sim;
+    uint64_t frame = 1;
+
+    for (; frame <= FGInputHandoff::ProbationFrames * 2 + 1; frame++)
+        sim.RunFrame(frame, false, false);
+
+    ASSERT_TRUE(sim.Handoff.IsHandedOff(FGInputHandoff::Depth));
+
+    // Game starts writing depth after upscaler, inputs are already used without copy
+    auto result = sim.RunFrame(frame++, false, true);
+    EXPECT_TRUE(result.DepthHandedOff);
+    EXPECT_FALSE(result.Generated);
+
+    // Copies from the next frame on
+    for (uint32_t i = 0; i < 16; i++, frame++)
+    {
+        result = sim.RunFrame(frame, false, true);
+        EXPECT_TRUE(result.Generated) << frame;
+        EXPECT_TRUE(result.Correct) << frame;
+    }
+
+    EXPECT_FALSE(sim.Handoff.IsHandedOff(FGInputHandoff::Depth));
+}
+
+TEST(FGInputHandoff, PingPongBuffersKeepState)
+{
+    HandoffSimulator sim;
+    uint64_t frame = 1;
+
+    for (; frame <= FGInputHandoff::ProbationFrames * 2 + 1; frame++)
+        sim.RunFrame(frame, false, false);
+
+    // Only one of the velocity buffers is written
+    auto written = frame % 2;
+    EXPECT_FALSE(sim.RunFrame(frame, true, false).Generated);
+    EXPECT_TRUE(sim.RunFrame(frame + 1, false, false).Generated);
+    frame += 2;
+
+    for (uint32_t i = 0; i < 8; i++, frame++)
+    {
+        auto result = sim.RunFrame(frame, false, false);
+        EXPECT_TRUE(result.Generated);
+        EXPECT_EQ(sim.Handoff.IsHandedOff(FGInputHandoff::Velocity), frame % 2 != written) << frame;
+    }
+}
+
+TEST(FGInputHandoff, WritesOutsideWindowAreIgnored)
+{
+    FGInputHandoff handoff;
+    int depth = 0;
+
+    for (uint32_t i = 0; i <= FGInputHandoff::ProbationFrames; i++)
+    {
+        handoff.Register(FGInputHandoff::Depth, &depth, true);
+        EXPECT_TRUE(handoff.Consumed());
+
+        // Next frame's rendering
+        handoff.Written(&depth);
+    }
+
+    EXPECT_FALSE(handoff.IsWatching());
+    EXPECT_TRUE(handoff.IsHandedOff(FGInputHandoff::Depth));
+    EXPECT_EQ(handoff.HazardCount(FGInputHandoff::Depth), 0u);
+}
+
+// Resource tracking scans descriptor heaps for the watched resources when a table's size is unknown
+TEST(FGInputHandoff, WatchedOnlyInsideWindow)
+{
+    FGInputHandoff handoff;
+    int velocity = 0;
+
+    EXPECT_EQ(handoff.Watched(FGInputHandoff::Velocity), nullptr);
+
+    handoff.Register(FGInputHandoff::Velocity, &velocity, true);
+    EXPECT_EQ(handoff.Watched(FGInputHandoff::Velocity), &velocity);
+    EXPECT_EQ(handoff.Watched(FGInputHandoff::Depth), nullptr);
+
+    handoff.Consumed();
+    EXPECT_EQ(handoff.Watched(FGInputHandoff::Velocity), nullptr);
+}
+
+TEST(FGInputHandoff, RandomHazardsNeverReadOverwrittenInputs)
+{
+    std::mt19937 rng(1234);
+    std::bernoulli_distribution hazard(0.02);
+
+    HandoffSimulator sim;
+    uint64_t generated = 0;
+    uint64_t handedOff = 0;
+
+    for (uint64_t frame = 1; frame <= 5000; frame++)
+    {
+        // Swap tracked resources now and then, like a resolution change
+        if (frame % 1000 == 0)
+            sim.Handoff.Register(FGInputHandoff::Velocity, nullptr, false);
+
+        auto velocityWrite = hazard(rng);
+        auto depthWrite = hazard(rng);
+        auto result = sim.RunFrame(frame, velocityWrite, depthWrite);
+
+        EXPECT_TRUE(result.Correct) << frame;
+        generated += result.Generated;
+        handedOff += (result.VelocityHandedOff || result.DepthHandedOff) && result.Generated;
+    }
+
+    EXPECT_GT(generated, 4900u);
+    EXPECT_GT(handedOff, 0u);
+}
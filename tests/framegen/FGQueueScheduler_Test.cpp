@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <framegen/FGQueueScheduler.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+// Game and FG queues sharing one fence, GPU is stepped by the test so it can run behind the CPU.
+class SimulatedGpu
+{
+  public:
+    struct Op
+    {
+        enum Type
+        {
+            Signal,
+            Wait,
+            Work,
+        } OpType;
+
+        uint64_t Value;
+    };
+
+    std::deque<Op> Game;
+    std::deque<Op> FG;
+    uint64_t Fence = 0;
+    std::vector<std::string> Log;
+
+    bool Step(std::deque<Op>& InQueue, const char* InName)
+    {
+        if (InQueue.empty())
+            return false;
+
+        auto op = InQueue.front();
+
+        if (op.OpType == Op::Wait && Fence < op.Value)
+            return false;
+
+        InQueue.pop_front();
+
+        if (op.OpType == Op::Signal)
+            Fence = std::max(Fence, op.Value);
+        else if (op.OpType == Op::Work)
+            Log.push_back(std::string(InName) + std::to_string(op.Value));
+
+        return true;
+    }
+
+    bool StepAll()
+    {
+        auto fg = Step(FG, "fg");
+        auto game = Step(Game, "game");
+        return fg || game;
+    }
+
+    // CPU wait on the fence, false on deadlock
+    bool RunUntil(uint64_t InValue)
+    {
+        while (Fence < InValue)
+        {
+            if (!StepAll())
+                return false;
+        }
+
+        return true;
+    }
+
+    int Position(const std::string& InName) const
+    {
+        auto it = std::find(Log.begin(), Log.end(), InName);
+        return it == Log.end() ? -1 : (int) (it - Log.begin());
+    }
+};
+
+// Frame of FSRFG_Dx12 with prepare on FG queue, same order of calls as IFGFeature_Dx12
+static void RecordFrame(FGQueueScheduler& InScheduler, SimulatedGpu& InGpu, uint32_t InFrame)
+{
+    auto slot = InFrame % 4;
+
+    auto waitValue = InScheduler.Begin(slot, InGpu.Fence);
+    ASSERT_TRUE(waitValue == 0 || InGpu.RunUntil(waitValue));
+    ASSERT_TRUE(InScheduler.SlotFree(slot, InGpu.Fence));
+
+    // EndPrepare
+    ASSERT_TRUE(InScheduler.Recorded(slot));
+
+    // Game submits the list with upscaler, ExecutePrepare
+    InGpu.Game.push_back({ SimulatedGpu::Op::Work, InFrame * 10ull });
+    auto submission = InScheduler.Submit();
+    ASSERT_EQ(submission.Slot, slot);
+    ASSERT_EQ(submission.DoneValue, submission.InputValue + 1);
+
+    InGpu.Game.push_back({ SimulatedGpu::Op::Signal, submission.InputValue });
+    InGpu.FG.push_back({ SimulatedGpu::Op::Wait, submission.InputValue });
+    InGpu.FG.push_back({ SimulatedGpu::Op::Work, InFrame * 10ull + 1 });
+    InGpu.FG.push_back({ SimulatedGpu::Op::Signal, submission.DoneValue });
+
+    // Game work overlapping with prepare
+    InGpu.Game.push_back({ SimulatedGpu::Op::Work, InFrame * 10ull + 2 });
+
+    // WaitForFGQueue before present
+    auto presentWait = InScheduler.TakeWait();
+    ASSERT_EQ(presentWait, submission.DoneValue);
+    ASSERT_EQ(InScheduler.TakeWait(), 0u);
+
+    InGpu.Game.push_back({ SimulatedGpu::Op::Wait, presentWait });
+    InGpu.Game.push_back({ SimulatedGpu::Op::Work, InFrame * 10ull + 3 });
+}
+
+TEST(FGQueueScheduler, PrepareRunsBetweenUpscalerAndPresent)
+{
+    FGQueueScheduler scheduler(FGQueueScheduler::Async, 4);
+    SimulatedGpu gpu;
+
+    for (uint32_t frame = 1; frame <= 12; frame++)
+    {
+        RecordFrame(scheduler, gpu, frame);
+
+        // GPU runs behind CPU
+        if (frame % 2 == 0)
+        {
+            for (int i = 0; i < 6; i++)
+                gpu.StepAll();
+        }
+    }
+
+    while (gpu.StepAll())
+    {
+    }
+
+    EXPECT_TRUE(gpu.Game.empty());
+    EXPECT_TRUE(gpu.FG.empty());
+    EXPECT_EQ(gpu.Fence, scheduler.LastValue());
+
+    for (uint32_t frame = 1; frame <= 12; frame++)
+    {
+        auto upscaler = gpu.Position("game" + std::to_string(frame * 10));
+        auto prepare = gpu.Position("fg" + std::to_string(frame * 10 + 1));
+        auto present = gpu.Position("game" + std::to_string(frame * 10 + 3));
+
+        ASSERT_GE(upscaler, 0);
+        EXPECT_LT(upscaler, prepare) << frame;
+        EXPECT_LT(prepare, present) << frame;
+    }
+
+    EXPECT_GT(scheduler.CpuWaitCount(), 0u);
+}
+
+TEST(FGQueueScheduler, SlotIsBusyUntilFenceReachesItsValue)
+{
+    FGQueueScheduler scheduler(FGQueueScheduler::Direct, 2);
+
+    scheduler.Begin(0, 0);
+    ASSERT_TRUE(scheduler.Recorded(0));
+    auto submission = scheduler.Submit();
+
+    // GPU stalled, a timed out CPU wait must not free the slot
+    EXPECT_EQ(scheduler.Begin(0, submission.InputValue), submission.DoneValue);
+    EXPECT_FALSE(scheduler.SlotFree(0, submission.InputValue));
+    EXPECT_TRUE(scheduler.SlotFree(1, submission.InputValue));
+
+    EXPECT_TRUE(scheduler.SlotFree(0, submission.DoneValue));
+    EXPECT_EQ(scheduler.Begin(0, submission.DoneValue), 0u);
+}
+
+TEST(FGQueueScheduler, PendingRecordingIsNotReplaced)
+{
+    FGQueueScheduler scheduler(FGQueueScheduler::Direct, 4);
+
+    // Prepare waits for the game's list
+    scheduler.Begin(1, 0);
+    ASSERT_TRUE(scheduler.Recorded(1));
+
+    // Hudless list of the same frame goes to game queue
+    EXPECT_FALSE(scheduler.Recorded(1));
+    EXPECT_FALSE(scheduler.Recorded(2));
+
+    auto submission = scheduler.Submit();
+    EXPECT_EQ(submission.Slot, 1u);
+    EXPECT_NE(submission.DoneValue, 0u);
+
+    EXPECT_TRUE(scheduler.Recorded(2));
+    EXPECT_EQ(scheduler.Submit().Slot, 2u);
+    EXPECT_EQ(scheduler.DroppedCount(), 0u);
+}
+
+TEST(FGQueueScheduler, UnsubmittedRecordingIsDropped)
+{
+    FGQueueScheduler scheduler(FGQueueScheduler::Async, 4);
+
+    ASSERT_TRUE(scheduler.Recorded(1));
+
+    // Game never submitted the list with upscaler inputs
+    scheduler.Begin(2, 0);
+
+    EXPECT_EQ(scheduler.DroppedCount(), 1u);
+    EXPECT_FALSE(scheduler.HasRecorded());
+    EXPECT_EQ(scheduler.Submit().DoneValue, 0u);
+    EXPECT_EQ(scheduler.TakeWait(), 0u);
+}
+
+TEST(FGQueueScheduler, SlotCountIsClamped)
+{
+    FGQueueScheduler scheduler(FGQueueScheduler::Async, 100);
+
+    for (uint32_t i = 0; i < FGQueueScheduler::MaxSlots * 2; i++)
+    {
+        scheduler.Begin(i, scheduler.LastValue());
+        ASSERT_TRUE(scheduler.Recorded(i));
+        EXPECT_LT(scheduler.Submit().Slot, FGQueueScheduler::MaxSlots);
+    }
+
+    EXPECT_FALSE(FGQueueScheduler(FGQueueScheduler::Inline, 4).UsesQueue());
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <framegen/FramePacingModel.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Offline version of FrameLimit::sleep + present hook. Game work time comes from a generator, limiter sleeps up to
+// the model's interval and the present interval is fed back like the present hook does.
+class PacingSimulator
+{
+  public:
+    struct Stats
+    {
+        double MeanInterval = 0.0;
+        double StdDevInterval = 0.0;
+        double LastLimiterInterval = 0.0;
+    };
+
+    FramePacingModel Model;
+    std::mt19937 Rng { 42 };
+
+    // InWorkMs: mean work time, InJitterMs: standard deviation of it
+    Stats Run(uint32_t InFrames, double InCapMs, double InWorkMs, double InJitterMs)
+    {
+        std::normal_distribution<double> work(InWorkMs, InJitterMs);
+        std::vector<double> intervals;
+        Stats stats {};
+
+        for (uint32_t i = 0; i < InFrames; i++)
+        {
+            auto workTime = std::max(0.1, work(Rng));
+
+            Model.SampleWork(workTime);
+            stats.LastLimiterInterval = Model.LimiterInterval(InCapMs);
+
+            auto interval = std::max(workTime, stats.LastLimiterInterval);
+            Model.Sample(interval);
+            intervals.push_back(interval);
+        }
+
+        for (auto interval : intervals)
+            stats.MeanInterval += interval;
+
+        stats.MeanInterval /= intervals.size();
+
+        for (auto interval : intervals)
+            stats.StdDevInterval += (interval - stats.MeanInterval) * (interval - stats.MeanInterval);
+
+        stats.StdDevInterval = std::sqrt(stats.StdDevInterval / intervals.size());
+
+        return stats;
+    }
+};
+
+static constexpr double Cap60 = 1000.0 / 60.0;
+
+TEST(FramePacing, ColdModelUsesCap)
+{
+    FramePacingModel model;
+    EXPECT_DOUBLE_EQ(model.LimiterInterval(Cap60), Cap60);
+
+    for (uint32_t i = 0; i < FramePacingModel::WarmupSamples - 1; i++)
+        model.SampleWork(30.0);
+
+    EXPECT_DOUBLE_EQ(model.LimiterInterval(Cap60), Cap60);
+}
+
+TEST(FramePacing, CapIsKeptWhenGameReachesIt)
+{
+    PacingSimulator sim;
+
+    // Noisy game well under the cap, present intervals come from the limiter itself
+    auto stats = sim.Run(2000, Cap60, 12.0, 2.0);
+
+    EXPECT_DOUBLE_EQ(stats.LastLimiterInterval, Cap60);
+    EXPECT_NEAR(stats.MeanInterval, Cap60, 0.01);
+    EXPECT_TRUE(sim.Model.IsWarm());
+}
+
+TEST(FramePacing, CapIsKeptWhenGameIsJustUnderIt)
+{
+    PacingSimulator sim;
+
+    // Some frames miss the cap, median still makes it
+    auto stats = sim.Run(2000, Cap60, 15.5, 1.0);
+
+    EXPECT_DOUBLE_EQ(stats.LastLimiterInterval, Cap60);
+    EXPECT_LT(stats.MeanInterval, Cap60 + 0.2);
+}
+
+TEST(FramePacing, RaisedWhenGameCantReachCap)
+{
+    PacingSimulator limited;
+    auto stats = limited.Run(2000, Cap60, 20.0, 2.0);
+
+    // Around 75th percentile of work time
+    EXPECT_GT(stats.LastLimiterInterval, 20.0);
+    EXPECT_LT(stats.LastLimiterInterval, 20.0 + 2.0 * 2.0);
+
+    // More even than running at the cap
+    PacingSimulator capOnly;
+    std::normal_distribution<double> work(20.0, 2.0);
+    std::vector<double> intervals;
+    double mean = 0.0, variance = 0.0;
+
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        intervals.push_back(std::max(Cap60, std::max(0.1, work(capOnly.Rng))));
+        mean += intervals.back();
+    }
+
+    mean /= intervals.size();
+
+    for (auto interval : intervals)
+        variance += (interval - mean) * (interval - mean);
+
+    EXPECT_LT(stats.StdDevInterval, std::sqrt(variance / intervals.size()));
+}
+
+TEST(FramePacing, DecaysBackToCap)
+{
+    PacingSimulator sim;
+
+    auto stats = sim.Run(500, Cap60, 22.0, 1.0);
+    ASSERT_GT(stats.LastLimiterInterval, 21.0);
+
+    // Game speeds up, window refills and interval steps down to the cap
+    stats = sim.Run(FramePacingModel::WorkWindow, Cap60, 10.0, 1.0);
+    EXPECT_LT(stats.LastLimiterInterval, 21.0);
+
+    stats = sim.Run(200, Cap60, 10.0, 1.0);
+    EXPECT_DOUBLE_EQ(stats.LastLimiterInterval, Cap60);
+}
+
+TEST(FramePacing, DoesNotRatchet)
+{
+    PacingSimulator sim;
+
+    // Alternating heavy and light scenes, interval should follow both ways
+    for (int i = 0; i < 5; i++)
+    {
+        auto heavy = sim.Run(300, Cap60, 25.0, 1.0);
+        EXPECT_GT(heavy.LastLimiterInterval, 24.0);
+
+        auto light = sim.Run(300, Cap60, 8.0, 1.0);
+        EXPECT_DOUBLE_EQ(light.LastLimiterInterval, Cap60);
+    }
+}
+
+TEST(FramePacing, TuningFollowsNoise)
+{
+    PacingSimulator steady;
+    steady.Run(500, 0.0, 16.0, 0.1);
+    auto steadyTuning = steady.Model.CurrentTuning();
+
+    PacingSimulator noisy;
+    noisy.Run(500, 0.0, 16.0, 2.0);
+    auto noisyTuning = noisy.Model.CurrentTuning();
+
+    EXPECT_LT(steadyTuning.SafetyMarginInMs, noisyTuning.SafetyMarginInMs);
+    EXPECT_LT(steadyTuning.VarianceFactor, noisyTuning.VarianceFactor);
+}
+
+TEST(FramePacing, OutliersAreRejectedUntilTheyPersist)
+{
+    FramePacingModel model;
+
+    for (uint32_t i = 0; i < 64; i++)
+        model.Sample(16.0);
+
+    EXPECT_FALSE(model.Sample(200.0));
+    EXPECT_NEAR(model.Mean(), 16.0, 0.01);
+
+    for (uint32_t i = 0; i < FramePacingModel::OutlierRestart; i++)
+        model.Sample(33.0);
+
+    EXPECT_NEAR(model.Mean(), 33.0, 0.01);
+
+    // 200ms hitch starts the run too
+    EXPECT_EQ(model.OutlierCount(), FramePacingModel::OutlierRestart);
+}
@@ -0,0 +1,354 @@
+#include <gtest/gtest.h>
+
+#include <hooks/DllNameMatcher.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Lists of DllNames.h, dllNames as filled by AddDllName when working as dxgi.dll
+struct NameList
+{
+    std::vector<std::string> Names;
+    uint32_t Category;
+};
+
+static std::vector<std::string> Both(const std::string& InName) { return { InName + ".dll", InName }; }
+
+static std::vector<NameList> NameLists()
+{
+    return {
+        { { "optiscaler_dontload.dll", "optiscaler_dontload", "dxgi.dll", "dxgi", "optiscaler.asi", "optiscaler" },
+          DllNameMatcher::OptiScaler },
+        { Both("nvngx"), DllNameMatcher::Nvngx },
+        { Both("nvngx_dlss"), DllNameMatcher::NvngxDlss },
+        { Both("nvapi64"), DllNameMatcher::NvApi },
+        { Both("sl.interposer"), DllNameMatcher::SlInterposer },
+        { Both("sl.dlss"), DllNameMatcher::SlDlss },
+        { Both("sl.dlss_g"), DllNameMatcher::SlDlssg },
+        { { ".bin" }, DllNameMatcher::NgxOtaBin },
+        { { "eosovh-win32-shipping.dll", "eosovh-win32-shipping", "eosovh-win64-shipping.dll", "eosovh-win64-shipping",
+            "gameoverlayrenderer64", "gameoverlayrenderer64.dll", "gameoverlayrenderer", "gameoverlayrenderer.dll",
+            "owclient.dll", "owclient", "galaxy.dll", "galaxy", "galaxy64.dll", "galaxy64", "discordoverlay.dll",
+            "discordoverlay", "discordoverlay64.dll", "discordoverlay64", "overlay64", "overlay64.dll", "overlay",
+            "overlay.dll" },
+          DllNameMatcher::BlockOverlay },
+        { { "eosovh-win32-shipping.dll", "eosovh-win32-shipping", "eosovh-win64-shipping.dll", "eosovh-win64-shipping",
+            "gameoverlayrenderer64", "gameoverlayrenderer64.dll", "gameoverlayrenderer", "gameoverlayrenderer.dll",
+            "socialclubd3d12renderer", "socialclubd3d12renderer.dll", "owutils.dll", "owutils", "galaxy.dll", "galaxy",
+            "galaxy64.dll", "galaxy64", "discordoverlay.dll", "discordoverlay", "discordoverlay64.dll",
+            "discordoverlay64", "overlay64", "overlay64.dll", "overlay", "overlay.dll" },
+          DllNameMatcher::Overlay },
+        { Both("d3d11"), DllNameMatcher::Dx11 },
+        { Both("d3d12"), DllNameMatcher::Dx12 },
+        { Both("vulkan-1"), DllNameMatcher::Vulkan },
+        { Both("dxgi"), DllNameMatcher::Dxgi },
+        { Both("ffx_fsr2_api_x64"), DllNameMatcher::Fsr2 },
+        { Both("ffx_fsr2_api_dx12_x64"), DllNameMatcher::Fsr2BE },
+        { Both("ffx_fsr3upscaler_x64"), DllNameMatcher::Fsr3 },
+        { Both("ffx_backend_dx12_x64"), DllNameMatcher::Fsr3BE },
+        { Both("libxess"), DllNameMatcher::Xess },
+        { Both("libxess_dx11"), DllNameMatcher::XessDx11 },
+        { Both("amd_fidelityfx_dx12"), DllNameMatcher::FfxDx12 },
+        { Both("amd_fidelityfx_vk"), DllNameMatcher::FfxVk },
+    };
+}
+
+// LoadLibrary hooks before DllNameMatcher, lowercased path and CheckDllName (rfind) against every list
+static uint32_t LegacyMatch(const std::vector<NameList>& InLists, const std::string& InPath)
+{
+    std::string path(InPath);
+    std::transform(path.begin(), path.end(), path.begin(), [](char c) { return (char) ::tolower((unsigned char) c); });
+
+    uint32_t categories = DllNameMatcher::None;
+
+    for (const auto& list : InLists)
+    {
+        for (const auto& name : list.Names)
+        {
+            auto pos = path.rfind(name);
+
+            if (pos != std::string::npos && pos == (path.size() - name.size()))
+            {
+                categories |= list.Category;
+                break;
+            }
+        }
+    }
+
+    return categories;
+}
+
+// Modules a game loads while starting, with the paths LoadLibrary gets them with
+static std::vector<std::string> ModuleCorpus()
+{
+    const char* modules[] = {
+        "kernel32.dll", "KERNELBASE.dll", "ntdll.dll", "user32.dll", "gdi32.dll", "win32u.dll", "advapi32.dll",
+        "msvcp140.dll", "vcruntime140.dll", "vcruntime140_1.dll", "ucrtbase.dll", "combase.dll", "ole32.dll",
+        "oleaut32.dll", "shell32.dll", "shlwapi.dll", "setupapi.dll", "cfgmgr32.dll", "bcrypt.dll", "crypt32.dll",
+        "ws2_32.dll", "winhttp.dll", "wininet.dll", "winmm.dll", "version.dll", "dbghelp.dll", "dwmapi.dll",
+        "uxtheme.dll", "imm32.dll", "hid.dll", "xinput1_4.dll", "dinput8.dll", "d3dcompiler_47.dll",
+        "dxcompiler.dll", "dxil.dll", "D3D12Core.dll", "d3d12.dll", "D3D12", "d3d11.dll", "dxgi.dll", "DXGI",
+        "dxcore.dll", "nvapi64.dll", "nvldumdx.dll", "nvwgf2umx.dll", "nvgpucomp64.dll", "amdxc64.dll",
+        "igxelpicd64.dll", "vulkan-1.dll", "nvoglv64.dll", "nvngx.dll", "_nvngx.dll", "nvngx_dlss.dll",
+        "nvngx_dlssg.dll", "nvngx_dlssd.dll", "sl.interposer.dll", "sl.common.dll", "sl.dlss.dll", "sl.dlss_g.dll",
+        "sl.reflex.dll", "sl.pcl.dll", "libxess.dll", "libxess_dx11.dll", "libxell.dll", "libxess_fg.dll",
+        "amd_fidelityfx_dx12.dll", "amd_fidelityfx_vk.dll", "ffx_fsr2_api_x64.dll", "ffx_fsr2_api_dx12_x64.dll",
+        "ffx_fsr3upscaler_x64.dll", "ffx_backend_dx12_x64.dll", "GFSDK_Aftermath_Lib.x64.dll",
+        "steam_api64.dll", "gameoverlayrenderer64.dll", "EOSSDK-Win64-Shipping.dll", "EOSOVH-Win64-Shipping.dll",
+        "galaxy64.dll", "DiscordOverlay64.dll", "overlay64.dll", "owclient.dll", "RTSSHooks64.dll",
+        "bink2w64.dll", "fmod.dll", "fmodstudio.dll", "PhysX3_x64.dll", "tbb12.dll", "oo2core_9_win64.dll",
+        "amd_ags_x64.dll", "NvLowLatencyVk.dll", "OptiScaler.asi", "optiscaler_dontload.dll",
+    };
+
+    const char* folders[] = { "", "C:\\Windows\\System32\\", "C:\\WINDOWS\\SYSTEM32\\",
+                              "D:\\SteamLibrary\\steamapps\\common\\Game\\",
+                              "D:\\SteamLibrary\\steamapps\\common\\Game\\Engine\\Binaries\\ThirdParty\\Win64\\",
+                              "C:/Program Files/Epic Games/Game/Binaries/Win64/",
+                              "C:\\ProgramData\\NVIDIA\\NGX\\models\\dlss\\versions\\20316673\\files\\" };
+
+    std::vector<std::string> corpus;
+
+    for (const auto& folder : folders)
+    {
+        for (const auto& module : modules)
+            corpus.push_back(std::string(folder) + module);
+    }
+
+    corpus.push_back("C:\\ProgramData\\NVIDIA\\NGX\\models\\dlss\\versions\\20316673\\files\\160_e658700.bin");
+    corpus.push_back("nvngx.dl");
+    corpus.push_back("myoverlay.dll");
+    corpus.push_back("");
+
+    return corpus;
+}
+
+// Random names near the listed ones, mixed case and with listed names as suffix
+static std::vector<std::string> GeneratedCorpus(const std::vector<NameList>& InLists, size_t InCount)
+{
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_.-\\/ ";
+    std::mt19937 rng(1);
+    std::vector<std::string> corpus;
+
+    for (size_t i = 0; i < InCount; i++)
+    {
+        std::string path;
+        auto length = rng() % 40;
+
+        for (uint32_t c = 0; c < length; c++)
+            path += alphabet[rng() % (sizeof(alphabet) - 1)];
+
+        if (rng() % 3 == 0)
+        {
+            auto& list = InLists[rng() % InLists.size()].Names;
+            auto name = list[rng() % list.size()];
+
+            for (auto& c : name)
+                c = (rng() % 2) ? (char) ::toupper((unsigned char) c) : c;
+
+            path += name;
+        }
+
+        corpus.push_back(path);
+    }
+
+    return corpus;
+}
+
+static std::unique_ptr<DllNameMatcher> BuildMatcher(const std::vector<NameList>& InLists)
+{
+    auto matcher = std::make_unique<DllNameMatcher>();
+
+    for (const auto& list : InLists)
+        EXPECT_TRUE(matcher->Add(list.Names, list.Category));
+
+    return matcher;
+}
+
+TEST(DllNameMatcher, Categories)
+{
+    auto lists = NameLists();
+    auto matcher = BuildMatcher(lists);
+
+    EXPECT_EQ(matcher->Match("C:\\Windows\\System32\\KERNEL32.DLL"), DllNameMatcher::None);
+    EXPECT_EQ(matcher->Match("D3D12.DLL"), DllNameMatcher::Dx12);
+    EXPECT_EQ(matcher->Match(L"c:/game/NVNGX_DLSS.dll"), DllNameMatcher::NvngxDlss);
+    EXPECT_EQ(matcher->Match("dxgi"), DllNameMatcher::Dxgi | DllNameMatcher::OptiScaler);
+    EXPECT_EQ(matcher->Match("galaxy64.dll"), DllNameMatcher::Overlay | DllNameMatcher::BlockOverlay);
+    EXPECT_EQ(matcher->Match("owclient.dll"), DllNameMatcher::BlockOverlay);
+    EXPECT_EQ(matcher->Match("x\\sl.dlss_g.dll"), DllNameMatcher::SlDlssg);
+    EXPECT_EQ(matcher->Match("nvngx.dl"), DllNameMatcher::None);
+    EXPECT_EQ(matcher->Match(""), DllNameMatcher::None);
+    EXPECT_EQ(matcher->Match((const char*) nullptr), DllNameMatcher::None);
+    EXPECT_EQ(matcher->Match((const wchar_t*) nullptr), DllNameMatcher::None);
+
+    // Non ASCII characters never match, even when they truncate to a listed character
+    EXPECT_EQ(matcher->Match(L"d3d12.dl\u016C"), DllNameMatcher::None);
+    EXPECT_FALSE(matcher->Add("d3d12\xE9.dll", DllNameMatcher::Dx12));
+    EXPECT_FALSE(matcher->Add("", DllNameMatcher::Dx12));
+}
+
+TEST(DllNameMatcher, SameResultsAsLegacy)
+{
+    auto lists = NameLists();
+    auto matcher = BuildMatcher(lists);
+
+    auto corpus = ModuleCorpus();
+    auto generated = GeneratedCorpus(lists, 200000);
+    corpus.insert(corpus.end(), generated.begin(), generated.end());
+
+    size_t matches = 0;
+
+    for (const auto& path : corpus)
+    {
+        auto expected = LegacyMatch(lists, path);
+        matches += expected != DllNameMatcher::None ? 1 : 0;
+
+        ASSERT_EQ(matcher->Match(path.c_str()), expected) << path;
+
+        std::wstring wide(path.begin(), path.end());
+        ASSERT_EQ(matcher->Match(wide.c_str()), expected) << path;
+    }
+
+    // Corpus has both outcomes
+    EXPECT_GT(matches, 10000u);
+    EXPECT_LT(matches, corpus.size() / 2);
+}
+
+TEST(DllNameMatcher, Capacity)
+{
+    auto matcher = std::make_unique<DllNameMatcher>();
+    uint32_t added = 0;
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        if (!matcher->Add("module" + std::to_string(i * 7919) + ".dll", DllNameMatcher::Overlay))
+            break;
+
+        added++;
+    }
+
+    EXPECT_GT(added, 50u);
+    EXPECT_LT(added, 1000u);
+
+    // Failed Add doesn't leave a part of the name behind
+    auto nodes = matcher->NodeCount();
+    EXPECT_FALSE(matcher->Add("averylongmodulenamewhichdoesnotfitanymore.dll", DllNameMatcher::Dx12));
+    EXPECT_EQ(matcher->NodeCount(), nodes);
+    EXPECT_EQ(matcher->Match("averylongmodulenamewhichdoesnotfitanymore.dll"), DllNameMatcher::None);
+
+    for (uint32_t i = 0; i < added; i++)
+        EXPECT_EQ(matcher->Match(("module" + std::to_string(i * 7919) + ".dll").c_str()), DllNameMatcher::Overlay);
+}
+
+// AddDllName while LoadLibrary hooks are matching on other threads, built with -fsanitize=thread this also
+// checks there is no data race
+TEST(DllNameMatcher, AddWhileMatching)
+{
+    auto lists = NameLists();
+    auto matcher = BuildMatcher(lists);
+
+    std::vector<std::string> added;
+
+    // Proxy names OptiScaler could be loaded as, the trie has room for a few dozen after the lists
+    for (uint32_t i = 0; i < 40; i++)
+        added.push_back("proxy" + std::to_string(i) + (i % 2 ? ".asi" : ".dll"));
+
+    auto corpus = ModuleCorpus();
+    std::atomic<uint32_t> published { 0 };
+    std::atomic<bool> done { false };
+    std::atomic<uint64_t> errors { 0 };
+
+    auto reader = [&]()
+    {
+        std::mt19937 rng(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        while (!done.load())
+        {
+            auto count = published.load(std::memory_order_acquire);
+
+            // Names added before are always found, later ones only with their own category
+            for (uint32_t i = 0; i < added.size(); i++)
+            {
+                auto result = matcher->Match(added[i].c_str());
+
+                if (i < count ? result != DllNameMatcher::OptiScaler
+                              : (result & ~(uint32_t) DllNameMatcher::OptiScaler) != 0)
+                {
+                    errors++;
+                }
+            }
+
+            auto& path = corpus[rng() % corpus.size()];
+
+            if (matcher->Match(path.c_str()) != LegacyMatch(lists, path))
+                errors++;
+        }
+    };
+
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; i++)
+        readers.emplace_back(reader);
+
+    for (uint32_t i = 0; i < added.size(); i++)
+    {
+        // Readers are joined below, no early return
+        EXPECT_TRUE(matcher->Add(added[i], DllNameMatcher::OptiScaler)) << added[i];
+        published.store(i + 1, std::memory_order_release);
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    done = true;
+
+    for (auto& thread : readers)
+        thread.join();
+
+    EXPECT_EQ(errors.load(), 0u);
+}
+
+// Cost of both checks for the module corpus, timings are written as test properties
+TEST(DllNameMatcher, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto lists = NameLists();
+    auto matcher = BuildMatcher(lists);
+    auto corpus = ModuleCorpus();
+
+    uint64_t legacyResult = 0;
+    uint64_t matcherResult = 0;
+
+    auto start = Clock::now();
+
+    for (int i = 0; i < 50; i++)
+    {
+        for (const auto& path : corpus)
+            legacyResult += LegacyMatch(lists, path);
+    }
+
+    auto legacyTime = Clock::now() - start;
+    start = Clock::now();
+
+    for (int i = 0; i < 50; i++)
+    {
+        for (const auto& path : corpus)
+            matcherResult += matcher->Match(path.c_str());
+    }
+
+    auto matcherTime = Clock::now() - start;
+
+    EXPECT_EQ(matcherResult, legacyResult);
+
+    auto calls = (double) corpus.size() * 50;
+    RecordProperty("legacy_ns_per_call",
+                   std::to_string(std::chrono::duration<double, std::nano>(legacyTime).count() / calls));
+    RecordProperty("matcher_ns_per_call",
+                   std::to_string(std::chrono::duration<double, std::nano>(matcherTime).count() / calls));
+    RecordProperty("nodes", (int) matcher->NodeCount());
+}
@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <hooks/ProcOverrideTable.h>
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Module list of the process, GetModuleHandleW of Kernel_Hooks
+class SimulatedLoader
+{
+  public:
+    inline static std::map<std::wstring, void*> Loaded;
+    inline static uint32_t Resolves = 0;
+    inline static uintptr_t NextBase = 0x10000;
+
+    static void* Resolve(const wchar_t* InModuleName)
+    {
+        Resolves++;
+
+        auto it = Loaded.find(InModuleName);
+        return it == Loaded.end() ? nullptr : it->second;
+    }
+
+    // Modules are loaded at a new address every time like after ASLR
+    static void* Load(const std::wstring& InName)
+    {
+        auto handle = (void*) NextBase;
+        NextBase += 0x10000;
+        Loaded[InName] = handle;
+        return handle;
+    }
+
+    static void* Unload(const std::wstring& InName)
+    {
+        auto handle = Loaded[InName];
+        Loaded.erase(InName);
+        return handle;
+    }
+
+    static void Reset()
+    {
+        Loaded.clear();
+        Resolves = 0;
+    }
+};
+
+class ProcOverrideTableTest : public ::testing::Test
+{
+  protected:
+    ProcOverrideTable Table { SimulatedLoader::Resolve };
+    int Replacements[8] {};
+
+    void SetUp() override { SimulatedLoader::Reset(); }
+};
+
+TEST_F(ProcOverrideTableTest, Lookup)
+{
+    ASSERT_TRUE(Table.Add(L"gdi32.dll", "D3DKMTEnumAdapters2", &Replacements[0]));
+    ASSERT_TRUE(Table.Add(L"gdi32.dll", "D3DKMTQueryAdapterInfo", &Replacements[1]));
+    ASSERT_TRUE(Table.Add(L"kernelbase.dll", "D3DKMTEnumAdapters2", &Replacements[2]));
+    EXPECT_EQ(Table.Count(), 3u);
+
+    auto gdi = SimulatedLoader::Load(L"gdi32.dll");
+    auto kernelBase = SimulatedLoader::Load(L"kernelbase.dll");
+
+    EXPECT_EQ(Table.Find(gdi, "D3DKMTEnumAdapters2"), &Replacements[0]);
+    EXPECT_EQ(Table.Find(gdi, "D3DKMTQueryAdapterInfo"), &Replacements[1]);
+    EXPECT_EQ(Table.Find(kernelBase, "D3DKMTEnumAdapters2"), &Replacements[2]);
+
+    // Replacing an existing override doesn't add an entry
+    ASSERT_TRUE(Table.Add(L"gdi32.dll", "D3DKMTEnumAdapters2", &Replacements[3]));
+    EXPECT_EQ(Table.Count(), 3u);
+    EXPECT_EQ(Table.Find(gdi, "D3DKMTEnumAdapters2"), &Replacements[3]);
+}
+
+TEST_F(ProcOverrideTableTest, Misses)
+{
+    Table.Add(L"gdi32.dll", "D3DKMTEnumAdapters2", &Replacements[0]);
+
+    // Nothing resolved while module isn't loaded
+    EXPECT_EQ(Table.Find((void*) 0x1000, "D3DKMTEnumAdapters2"), nullptr);
+
+    auto gdi = SimulatedLoader::Load(L"gdi32.dll");
+    auto other = SimulatedLoader::Load(L"d3d12.dll");
+
+    EXPECT_EQ(Table.Find(gdi, "D3DKMTEnumAdapters"), nullptr);
+    EXPECT_EQ(Table.Find(gdi, "D3DKMTEnumAdapters23"), nullptr);
+    EXPECT_EQ(Table.Find(gdi, ""), nullptr);
+    EXPECT_EQ(Table.Find(gdi, nullptr), nullptr);
+    EXPECT_EQ(Table.Find(nullptr, "D3DKMTEnumAdapters2"), nullptr);
+    EXPECT_EQ(Table.Find(other, "D3DKMTEnumAdapters2"), nullptr);
+
+    // Resolved handle is cached, other modules only compare it
+    auto resolves = SimulatedLoader::Resolves;
+
+    for (int i = 0; i < 1000; i++)
+        EXPECT_EQ(Table.Find(other, "D3D12CreateDevice"), nullptr);
+
+    EXPECT_EQ(SimulatedLoader::Resolves, resolves);
+
+    // Empty table doesn't resolve anything
+    ProcOverrideTable empty(SimulatedLoader::Resolve);
+    EXPECT_EQ(empty.Find(gdi, "D3DKMTEnumAdapters2"), nullptr);
+    EXPECT_EQ(SimulatedLoader::Resolves, resolves);
+}
+
+TEST_F(ProcOverrideTableTest, CollidingBuckets)
+{
+    // Names landing in the same bucket are probed linearly
+    std::vector<std::string> names;
+
+    for (int i = 0; names.size() < 4; i++)
+    {
+        auto name = "Export" + std::to_string(i);
+
+        if ((ProcOverrideTable::Hash(name.c_str()) & (ProcOverrideTable::MaxEntries - 1)) == 3)
+            names.push_back(name);
+    }
+
+    for (size_t i = 0; i < names.size(); i++)
+        ASSERT_TRUE(Table.Add(L"gdi32.dll", names[i].c_str(), &Replacements[i]));
+
+    auto gdi = SimulatedLoader::Load(L"gdi32.dll");
+
+    for (size_t i = 0; i < names.size(); i++)
+        EXPECT_EQ(Table.Find(gdi, names[i].c_str()), &Replacements[i]);
+
+    // Same bucket, not in table
+    for (int i = 0;; i++)
+    {
+        auto name = "Missing" + std::to_string(i);
+
+        if ((ProcOverrideTable::Hash(name.c_str()) & (ProcOverrideTable::MaxEntries - 1)) == 3)
+        {
+            EXPECT_EQ(Table.Find(gdi, name.c_str()), nullptr);
+            break;
+        }
+    }
+}
+
+TEST_F(ProcOverrideTableTest, Capacity)
+{
+    static char names[ProcOverrideTable::MaxEntries][16];
+    uint32_t added = 0;
+
+    // Table is kept half empty so misses stop at an empty slot
+    for (uint32_t i = 0; i < ProcOverrideTable::MaxEntries; i++)
+    {
+        snprintf(names[i], sizeof(names[i]), "Export%u", i);
+        added += Table.Add(L"gdi32.dll", names[i], &Replacements[0]) ? 1 : 0;
+    }
+
+    EXPECT_EQ(added, ProcOverrideTable::MaxEntries / 2);
+    EXPECT_EQ(Table.Count(), ProcOverrideTable::MaxEntries / 2);
+
+    auto gdi = SimulatedLoader::Load(L"gdi32.dll");
+
+    for (uint32_t i = 0; i < ProcOverrideTable::MaxEntries; i++)
+        EXPECT_EQ(Table.Find(gdi, names[i]) != nullptr, i < added) << names[i];
+
+    // Modules
+    ProcOverrideTable modules(SimulatedLoader::Resolve);
+    static wchar_t moduleNames[ProcOverrideTable::MaxModules + 1][16];
+
+    for (uint32_t i = 0; i <= ProcOverrideTable::MaxModules; i++)
+    {
+        swprintf(moduleNames[i], 16, L"module%u.dll", i);
+        EXPECT_EQ(modules.Add(moduleNames[i], "Export", &Replacements[0]), i < ProcOverrideTable::MaxModules);
+    }
+
+    EXPECT_FALSE(modules.Add(nullptr, "Export", &Replacements[0]));
+    EXPECT_FALSE(modules.Add(L"gdi32.dll", nullptr, &Replacements[0]));
+}
+
+TEST_F(ProcOverrideTableTest, UnloadAndReload)
+{
+    Table.Add(L"gdi32.dll", "D3DKMTEnumAdapters2", &Replacements[0]);
+
+    auto first = SimulatedLoader::Load(L"gdi32.dll");
+    EXPECT_EQ(Table.Find(first, "D3DKMTEnumAdapters2"), &Replacements[0]);
+
+    // FreeLibrary hook
+    SimulatedLoader::Unload(L"gdi32.dll");
+    EXPECT_TRUE(Table.Invalidate(first));
+    EXPECT_FALSE(Table.Invalidate(first));
+    EXPECT_FALSE(Table.Invalidate(nullptr));
+
+    EXPECT_EQ(Table.Find(first, "D3DKMTEnumAdapters2"), nullptr);
+
+    // Loaded again at another address, old handle might be reused by another module
+    auto second = SimulatedLoader::Load(L"gdi32.dll");
+    auto reused = SimulatedLoader::Load(L"other.dll");
+    SimulatedLoader::Loaded[L"other.dll"] = first;
+    (void) reused;
+
+    EXPECT_EQ(Table.Find(first, "D3DKMTEnumAdapters2"), nullptr);
+    EXPECT_EQ(Table.Find(second, "D3DKMTEnumAdapters2"), &Replacements[0]);
+
+    // Freeing an unrelated module keeps the cached handle
+    auto resolves = SimulatedLoader::Resolves;
+    EXPECT_FALSE(Table.Invalidate(first));
+    EXPECT_EQ(Table.Find(second, "D3DKMTEnumAdapters2"), &Replacements[0]);
+    EXPECT_EQ(SimulatedLoader::Resolves, resolves);
+}
+
+TEST_F(ProcOverrideTableTest, RandomLoadUnloadSequence)
+{
+    const std::vector<std::wstring> modules = { L"gdi32.dll", L"kernelbase.dll", L"d3d12.dll", L"dxgi.dll" };
+    const std::vector<std::string> exports = { "D3DKMTEnumAdapters2", "D3DKMTQueryAdapterInfo", "CreateDXGIFactory1",
+                                               "D3D12CreateDevice", "GetProcAddress" };
+
+    // Overrides of the first three modules, d3d12.dll doesn't have any
+    std::map<std::pair<std::wstring, std::string>, void*> overrides;
+    int index = 0;
+
+    for (size_t m = 0; m < 3; m++)
+    {
+        for (size_t e = m; e < exports.size(); e += 2)
+        {
+            auto replacement = &Replacements[index++ % 8];
+            overrides[{ modules[m], exports[e] }] = replacement;
+            ASSERT_TRUE(Table.Add(modules[m].c_str(), exports[e].c_str(), replacement));
+        }
+    }
+
+    std::mt19937 rng(7);
+    std::vector<void*> stale;
+
+    for (int step = 0; step < 20000; step++)
+    {
+        auto& module = modules[rng() % modules.size()];
+
+        switch (rng() % 4)
+        {
+        case 0:
+            if (!SimulatedLoader::Loaded.contains(module))
+                SimulatedLoader::Load(module);
+
+            break;
+
+        case 1:
+            if (SimulatedLoader::Loaded.contains(module))
+            {
+                auto handle = SimulatedLoader::Unload(module);
+                Table.Invalidate(handle);
+                stale.push_back(handle);
+            }
+
+            break;
+
+        default:
+        {
+            auto& name = exports[rng() % exports.size()];
+
+            // Loaded module
+            if (SimulatedLoader::Loaded.contains(module))
+            {
+                auto it = overrides.find({ module, name });
+                auto expected = it == overrides.end() ? nullptr : it->second;
+
+                ASSERT_EQ(Table.Find(SimulatedLoader::Loaded[module], name.c_str()), expected) << step;
+            }
+
+            // Handle of a freed module
+            if (!stale.empty())
+            {
+                ASSERT_EQ(Table.Find(stale[rng() % stale.size()], name.c_str()), nullptr) << step;
+            }
+
+            break;
+        }
+        }
+    }
+}
@@ -0,0 +1,287 @@
+#include <gtest/gtest.h>
+
+#include <hooks/TimestampRing.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+// Query pool and queue of HooksVk + NVNGX_DLSS_Vk. Command buffers run Latency frames after they are recorded,
+// queries keep their availability until a reset runs like on a Vulkan device.
+class SimulatedQueries
+{
+  public:
+    struct Query
+    {
+        bool Available = false;
+        uint64_t Value = 0;
+    };
+
+    struct Op
+    {
+        enum Type
+        {
+            Reset,
+            Write,
+        } OpType;
+
+        uint32_t Query;
+        uint64_t Duration; // Ticks of work before the write
+    };
+
+    struct CommandBuffer
+    {
+        uint64_t ExecuteFrame;
+        std::vector<Op> Ops;
+    };
+
+    TimestampRing Ring;
+    std::vector<Query> Pool;
+    std::deque<CommandBuffer> Queue;
+    std::map<uint64_t, std::vector<uint64_t>> Truth; // frame id + 1 -> pass durations
+
+    bool HostReset = false;
+    uint32_t Latency = 2;
+    uint64_t Clock = 1000;
+    uint64_t Frame = 0;
+    uint64_t Resolved = 0;
+    uint64_t Wrong = 0;
+
+    SimulatedQueries(uint32_t InFrames, uint32_t InPasses, bool InHostReset)
+        : Ring(InFrames, InPasses), Pool(Ring.QueryCount()), HostReset(InHostReset)
+    {
+        // Pool created, host reset makes everything unavailable
+        if (HostReset)
+            Pool.assign(Pool.size(), {});
+    }
+
+    void Execute(const CommandBuffer& InBuffer)
+    {
+        for (auto& op : InBuffer.Ops)
+        {
+            Clock += op.Duration;
+
+            if (op.OpType == Op::Reset)
+                Pool[op.Query] = {};
+            else
+                Pool[op.Query] = { true, Clock };
+        }
+    }
+
+    // One game frame, InSubmit false simulates a command buffer which is never submitted
+    void RunFrame(bool InSubmit = true)
+    {
+        CommandBuffer buffer { Frame + Latency, {} };
+        std::vector<uint64_t> durations(Ring.Passes(), 0);
+
+        for (uint32_t pass = 0; pass < Ring.Passes(); pass++)
+        {
+            auto query = Ring.BeginPass(pass);
+
+            if (query == TimestampRing::InvalidQuery)
+                continue;
+
+            durations[pass] = 100 + (Frame * 7 + pass * 13) % 50;
+
+            if (!HostReset)
+                buffer.Ops.push_back({ Op::Reset, query, 0 });
+
+            buffer.Ops.push_back({ Op::Write, query, 10 });
+            buffer.Ops.push_back({ Op::Write, query + 1, durations[pass] });
+        }
+
+        Truth[Frame + 1] = durations;
+
+        if (InSubmit)
+            Queue.push_back(buffer);
+
+        while (!Queue.empty() && Queue.front().ExecuteFrame <= Frame)
+        {
+            Execute(Queue.front());
+            Queue.pop_front();
+        }
+
+        Present();
+        Frame++;
+    }
+
+    // ReadTimestamps + EndFrame + ResetTimestamps of hkvkQueuePresentKHR
+    void Present()
+    {
+        TimestampRing::Pending pending;
+        auto done = false;
+
+        while (!done && Ring.OldestPending(pending))
+        {
+            for (uint32_t pass = 0; pass < Ring.Passes(); pass++)
+            {
+                if ((pending.PassMask & (1u << pass)) == 0)
+                    continue;
+
+                auto& begin = Pool[Ring.Query(pending.Slot, pass)];
+                auto& end = Pool[Ring.Query(pending.Slot, pass) + 1];
+
+                if (!begin.Available || !end.Available ||
+                    !Ring.Resolve(pending.Slot, pass, begin.Value, end.Value))
+                {
+                    done = true;
+                    break;
+                }
+
+                Resolved++;
+
+                if (Ring.LastTicks(pass) != Truth[Ring.LastFrame(pass)][pass])
+                    Wrong++;
+            }
+        }
+
+        Ring.EndFrame();
+
+        auto mask = Ring.TakeResetMask();
+
+        for (uint32_t slot = 0; HostReset && slot < TimestampRing::MaxFrames; slot++)
+        {
+            if ((mask & (1u << slot)) == 0)
+                continue;
+
+            for (uint32_t i = 0; i < Ring.Passes() * 2; i++)
+                Pool[Ring.Query(slot, 0) + i] = {};
+        }
+    }
+};
+
+TEST(TimestampRing, QueryLayout)
+{
+    TimestampRing ring(3, 2);
+
+    EXPECT_EQ(ring.QueryCount(), 12u);
+    EXPECT_EQ(ring.Query(0, 1), 2u);
+    EXPECT_EQ(ring.Query(2, 1), 10u);
+
+    // Clamped
+    EXPECT_EQ(TimestampRing(100, 100).QueryCount(), TimestampRing::MaxFrames * TimestampRing::MaxPasses * 2);
+    EXPECT_EQ(TimestampRing(0, 0).Frames(), 2u);
+}
+
+TEST(TimestampRing, OnePairPerPassAndFrame)
+{
+    TimestampRing ring(3, 2);
+
+    auto query = ring.BeginPass(0);
+    EXPECT_EQ(query, ring.Query(0, 0));
+
+    // Second evaluate in the same frame isn't timed, writing the pair twice needs another reset
+    EXPECT_EQ(ring.BeginPass(0), TimestampRing::InvalidQuery);
+    EXPECT_EQ(ring.BeginPass(1), ring.Query(0, 1));
+    EXPECT_EQ(ring.BeginPass(2), TimestampRing::InvalidQuery);
+    EXPECT_EQ(ring.SkippedCount(), 1u);
+
+    ring.EndFrame();
+    EXPECT_EQ(ring.BeginPass(0), ring.Query(1, 0));
+}
+
+TEST(TimestampRing, StaleResultsAreRejected)
+{
+    TimestampRing ring(2, 1);
+
+    ring.BeginPass(0);
+    ring.EndFrame();
+    ASSERT_TRUE(ring.Resolve(0, 0, 1000, 1100));
+    EXPECT_EQ(ring.LastTicks(0), 100u);
+    EXPECT_EQ(ring.LastFrame(0), 1u);
+
+    ring.BeginPass(0);
+    ring.EndFrame();
+    ring.BeginPass(0);
+    ring.EndFrame();
+
+    // Slot 0 is used again, command buffer reset didn't run and previous values are still available
+    EXPECT_FALSE(ring.Resolve(0, 0, 1000, 1100));
+    EXPECT_EQ(ring.StaleCount(), 1u);
+
+    TimestampRing::Pending pending;
+    ASSERT_TRUE(ring.OldestPending(pending));
+    EXPECT_EQ(pending.FrameId, 1u);
+
+    EXPECT_TRUE(ring.Resolve(1, 0, 2000, 2050));
+    EXPECT_TRUE(ring.Resolve(0, 0, 3000, 3070));
+    EXPECT_EQ(ring.LastTicks(0), 70u);
+    EXPECT_EQ(ring.LastFrame(0), 3u);
+}
+
+TEST(TimestampRing, CommandBufferResetNeverReturnsOldFrames)
+{
+    for (uint32_t latency = 0; latency < 6; latency++)
+    {
+        SimulatedQueries sim(3, 2, false);
+        sim.Latency = latency;
+
+        for (int i = 0; i < 500; i++)
+            sim.RunFrame();
+
+        EXPECT_EQ(sim.Wrong, 0u) << latency;
+        EXPECT_GT(sim.Resolved, 100u) << latency;
+        EXPECT_EQ(sim.Ring.DroppedCount(), 0u) << latency;
+
+        // Slot is polled a frame after it's recorded, its reset runs latency frames after recording
+        if (latency > 1)
+        {
+            EXPECT_GT(sim.Ring.StaleCount(), 0u) << latency;
+        }
+    }
+}
+
+TEST(TimestampRing, HostResetNeverSeesStaleValues)
+{
+    for (uint32_t latency = 0; latency < 6; latency++)
+    {
+        SimulatedQueries sim(3, 2, true);
+        sim.Latency = latency;
+
+        for (int i = 0; i < 500; i++)
+            sim.RunFrame();
+
+        EXPECT_EQ(sim.Wrong, 0u) << latency;
+        EXPECT_EQ(sim.Ring.StaleCount(), 0u) << latency;
+        EXPECT_GT(sim.Resolved, 100u) << latency;
+    }
+}
+
+TEST(TimestampRing, SlowGpuSkipsFramesInsteadOfOverwriting)
+{
+    SimulatedQueries sim(3, 1, true);
+    sim.Latency = 5;
+
+    for (int i = 0; i < 300; i++)
+        sim.RunFrame();
+
+    EXPECT_EQ(sim.Wrong, 0u);
+    EXPECT_GT(sim.Ring.SkippedCount(), 0u);
+    EXPECT_EQ(sim.Ring.DroppedCount(), 0u);
+}
+
+TEST(TimestampRing, UnsubmittedFrameIsDropped)
+{
+    for (auto hostReset : { false, true })
+    {
+        SimulatedQueries sim(3, 1, hostReset);
+
+        for (int i = 0; i < 10; i++)
+            sim.RunFrame();
+
+        auto resolved = sim.Resolved;
+        sim.RunFrame(false);
+
+        for (uint32_t i = 0; i < TimestampRing::MaxPendingFrames + 8; i++)
+            sim.RunFrame();
+
+        EXPECT_EQ(sim.Ring.DroppedCount(), 1u) << hostReset;
+
+        // Timing continues after the drop
+        for (int i = 0; i < 20; i++)
+            sim.RunFrame();
+
+        EXPECT_GT(sim.Resolved, resolved + 10) << hostReset;
+        EXPECT_EQ(sim.Wrong, 0u) << hostReset;
+    }
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <hooks/WidePathMatcher.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Counts heap allocations of the test binary, matcher calls must not allocate
+static std::atomic<uint64_t> allocations { 0 };
+
+void* operator new(size_t InSize)
+{
+    allocations++;
+
+    if (auto result = std::malloc(InSize == 0 ? 1 : InSize))
+        return result;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* InPtr) noexcept { std::free(InPtr); }
+void operator delete(void* InPtr, size_t) noexcept { std::free(InPtr); }
+
+// Checks of Kernel_Hooks before WidePathMatcher (wstring_to_string + to_lower_in_place + contains)
+class LegacyMatcher
+{
+    std::string _windowsDir;
+
+    static std::string Narrow(const std::wstring& InWide)
+    {
+        std::string result(InWide.length(), 0);
+        std::transform(InWide.begin(), InWide.end(), result.begin(), [](wchar_t c) { return (char) c; });
+        return result;
+    }
+
+    static void Lower(std::string& InString)
+    {
+        std::transform(InString.begin(), InString.end(), InString.begin(),
+                       [](char c) { return (char) ::tolower((unsigned char) c); });
+    }
+
+    static void NormalizePath(std::string& InPath)
+    {
+        while (!InPath.empty() && (InPath.back() == '\\' || InPath.back() == '/'))
+            InPath.pop_back();
+    }
+
+    bool IsInsideWindowsDirectory(const std::string& InPath) const
+    {
+        std::string pathToCheck(InPath);
+        std::string windowsPath(_windowsDir);
+
+        NormalizePath(pathToCheck);
+        NormalizePath(windowsPath);
+
+        Lower(pathToCheck);
+        Lower(windowsPath);
+
+        return pathToCheck.compare(0, windowsPath.size(), windowsPath) == 0 &&
+               (pathToCheck.size() == windowsPath.size() || pathToCheck[windowsPath.size()] == '\\' ||
+                pathToCheck[windowsPath.size()] == '/');
+    }
+
+  public:
+    explicit LegacyMatcher(const std::wstring& InWindowsDir) : _windowsDir(Narrow(InWindowsDir)) {}
+
+    bool Match(const wchar_t* InPath) const
+    {
+        auto path = Narrow(std::wstring(InPath));
+        Lower(path);
+
+        // contains() of the original check is C++23, tests are built as C++20
+        return path.find("nvngx.dll") != std::string::npos && path.find("_nvngx.dll") == std::string::npos &&
+               !IsInsideWindowsDirectory(path);
+    }
+};
+
+// Hook side check of Kernel_Hooks
+static bool MatchHook(const WidePathMatcher& InWindows, const wchar_t* InPath)
+{
+    return WidePathMatcher::IsNvngxPath(InPath) && !InWindows.IsInside(InPath);
+}
+
+// Paths a game touches while starting and streaming assets
+static std::vector<std::wstring> GamePaths()
+{
+    std::vector<std::wstring> paths = {
+        L"C:\\Windows\\System32\\nvngx.dll",
+        L"C:\\WINDOWS\\system32\\DriverStore\\FileRepository\\nv_dispi.inf_amd64_1\\nvngx.dll",
+        L"C:\\Windows\\System32\\kernel32.dll",
+        L"C:\\Windows",
+        L"c:\\windows\\",
+        L"C:\\Windows\\\\nvngx.dll",
+        L"C:/Windows/System32/nvngx.dll",
+        L"C:\\WindowsApps\\nvngx.dll",
+        L"C:\\Windows.old\\nvngx.dll",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\nvngx.dll",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\NVNGX.DLL",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\NvNgX.DlL",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\nvngx_dlss.dll",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\_nvngx.dll",
+        L"D:\\Games\\a_nvngx.dll\\nvngx.dll",
+        L"D:\\Games\\nvngx.dll\\_nvngx.dll",
+        L"D:\\Games\\nvngx.dll.bak",
+        L"D:\\Games\\nvnvngx.dll",
+        L"D:\\Games\\nvngx.dl",
+        L"nvngx.dll",
+        L"_nvngx.dll",
+        L"",
+        L"\\\\?\\D:\\Games\\Game\\nvngx.dll",
+        L"\\\\?\\C:\\Windows\\System32\\nvngx.dll",
+        L"D:\\Games\\\u014EVNGX.dll",
+        L"D:\\Games\\\u015Fnvngx.dll",
+        L"D:\\Games\\\u0120nvngx.dll",
+        L"D:\\\u00DCbersetzung\\nvngx.dll",
+        L"C:\\Users\\Player\\AppData\\Local\\Game\\Saved\\Config\\Windows\\Engine.ini",
+        L"C:\\Users\\Player\\Documents\\My Games\\Game\\settings.cfg",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\Engine\\Binaries\\ThirdParty\\NVIDIA\\NGX\\Win64\\nvngx_dlss.dll",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\Engine\\Binaries\\ThirdParty\\NVIDIA\\NGX\\Win64\\nvngx_dlssg.dll",
+        L"D:\\SteamLibrary\\steamapps\\common\\Game\\Engine\\Plugins\\Runtime\\Nvidia\\DLSS\\Binaries\\nvngx.dll",
+    };
+
+    const wchar_t* folders[] = { L"Content\\Paks", L"Content\\Movies", L"Data\\Textures", L"Data\\Audio\\Banks",
+                                 L"Shaders\\Cache" };
+    const wchar_t* extensions[] = { L".pak", L".utoc", L".ucas", L".bk2", L".dds", L".bnk", L".bin" };
+
+    for (int i = 0; i < 5000; i++)
+    {
+        std::wstring path = L"D:\\SteamLibrary\\steamapps\\common\\Game\\";
+        path += folders[i % 5];
+        path += L"\\chunk" + std::to_wstring(i) + extensions[i % 7];
+        paths.push_back(path);
+    }
+
+    return paths;
+}
+
+// Random paths made of characters near the matched ones, including non-ASCII characters which
+// truncate to them
+static std::vector<std::wstring> GeneratedPaths(size_t InCount)
+{
+    static const wchar_t alphabet[] = L"nvgxdl._\\/:NVGXDLwiWI\u014E\u0100\u015F\u012E\u016C\u0120";
+    std::mt19937 rng(1);
+    std::vector<std::wstring> paths;
+
+    for (size_t i = 0; i < InCount; i++)
+    {
+        std::wstring path;
+
+        if (rng() % 3 == 0)
+            path = (rng() % 2) ? L"C:\\Windows" : L"c:\\WINDOWS";
+
+        auto length = rng() % 24;
+        for (uint32_t c = 0; c < length; c++)
+            path += alphabet[rng() % (sizeof(alphabet) / sizeof(wchar_t) - 1)];
+
+        if (rng() % 4 == 0)
+            path += (rng() % 2) ? L"nvngx.dll" : L"NVNGX.DLL";
+
+        paths.push_back(path);
+    }
+
+    return paths;
+}
+
+TEST(WidePathMatcher, FoldMatchesNarrowing)
+{
+    for (uint32_t c = 0; c < 0x10000; c++)
+    {
+        auto narrowed = (char) (wchar_t) c;
+        auto expected = (char) ::tolower((unsigned char) narrowed);
+        EXPECT_EQ((char) WidePathMatcher::Fold((wchar_t) c), expected) << c;
+    }
+}
+
+TEST(WidePathMatcher, Prefix)
+{
+    WidePathMatcher matcher(L"C:\\Windows\\");
+
+    EXPECT_TRUE(matcher.HasPrefix());
+    EXPECT_TRUE(matcher.IsInside(L"c:\\windows"));
+    EXPECT_TRUE(matcher.IsInside(L"C:\\WINDOWS\\System32"));
+    EXPECT_TRUE(matcher.IsInside(L"C:\\Windows/System32"));
+    EXPECT_FALSE(matcher.IsInside(L"C:\\WindowsApps"));
+    EXPECT_FALSE(matcher.IsInside(L"C:\\Window"));
+    EXPECT_FALSE(matcher.IsInside(nullptr));
+
+    EXPECT_FALSE(WidePathMatcher().IsInside(L"C:\\Windows"));
+    EXPECT_FALSE(WidePathMatcher().HasPrefix());
+    EXPECT_FALSE(WidePathMatcher::IsNvngxPath(nullptr));
+}
+
+TEST(WidePathMatcher, SameResultsAsLegacy)
+{
+    for (auto windowsDir : { L"C:\\Windows", L"C:\\WINDOWS\\", L"D:\\Win" })
+    {
+        LegacyMatcher legacy(windowsDir);
+        WidePathMatcher windows(windowsDir);
+
+        auto paths = GamePaths();
+        auto generated = GeneratedPaths(200000);
+        paths.insert(paths.end(), generated.begin(), generated.end());
+
+        size_t matches = 0;
+
+        for (auto& path : paths)
+        {
+            auto expected = legacy.Match(path.c_str());
+            matches += expected ? 1 : 0;
+
+            ASSERT_EQ(MatchHook(windows, path.c_str()), expected) << std::string(path.begin(), path.end());
+        }
+
+        // Corpus has both outcomes
+        EXPECT_GT(matches, 1000u);
+        EXPECT_LT(matches, paths.size() / 2);
+    }
+}
+
+TEST(WidePathMatcher, NoAllocations)
+{
+    WidePathMatcher windows(L"C:\\Windows");
+    auto paths = GamePaths();
+
+    size_t matches = 0;
+    auto allocationsBefore = allocations.load();
+
+    for (auto& path : paths)
+        matches += MatchHook(windows, path.c_str()) ? 1 : 0;
+
+    EXPECT_EQ(allocations.load() - allocationsBefore, 0u);
+    EXPECT_GT(matches, 0u);
+}
+
+// Cost of both checks for streamed asset paths, timings are written as test properties.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark* --gtest_output=xml
+TEST(WidePathMatcher, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    LegacyMatcher legacy(L"C:\\Windows");
+    WidePathMatcher windows(L"C:\\Windows");
+    auto paths = GamePaths();
+
+    size_t legacyMatches = 0;
+    size_t matches = 0;
+
+    auto allocationsBefore = allocations.load();
+    auto start = Clock::now();
+
+    for (int i = 0; i < 20; i++)
+    {
+        for (auto& path : paths)
+            legacyMatches += legacy.Match(path.c_str()) ? 1 : 0;
+    }
+
+    auto legacyAllocations = allocations.load() - allocationsBefore;
+    auto legacyTime = Clock::now() - start;
+
+    start = Clock::now();
+
+    for (int i = 0; i < 20; i++)
+    {
+        for (auto& path : paths)
+            matches += MatchHook(windows, path.c_str()) ? 1 : 0;
+    }
+
+    auto matcherTime = Clock::now() - start;
+
+    EXPECT_EQ(matches, legacyMatches);
+
+    auto calls = (double) paths.size() * 20;
+    RecordProperty("legacy_ns_per_call",
+                   std::to_string(std::chrono::duration<double, std::nano>(legacyTime).count() / calls));
+    RecordProperty("legacy_allocations_per_call", std::to_string(legacyAllocations / calls));
+    RecordProperty("matcher_ns_per_call",
+                   std::to_string(std::chrono::duration<double, std::nano>(matcherTime).count() / calls));
+}
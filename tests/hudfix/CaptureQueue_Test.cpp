@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <hudfix/CaptureQueue.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(CaptureQueue, MultipleProducers)
+{
+    CaptureQueue queue;
+    constexpr uint64_t PerThread = 2000;
+    constexpr uint64_t Threads = 4;
+
+    std::vector<std::thread> producers;
+
+    for (uint64_t t = 0; t < Threads; t++)
+    {
+        producers.emplace_back(
+            [&queue, t]
+            {
+                for (uint64_t i = 0; i < PerThread; i++)
+                {
+                    CaptureQueue::Request request;
+                    request.FrameId = t * PerThread + i;
+
+                    while (!queue.Push(request))
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    std::set<uint64_t> seen;
+    std::vector<uint64_t> lastOfThread(Threads, 0);
+    CaptureQueue::Request request;
+
+    while (seen.size() < PerThread * Threads)
+    {
+        if (!queue.Pop(request))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_TRUE(seen.insert(request.FrameId).second) << request.FrameId;
+
+        // Each producer's requests keep their order
+        auto thread = request.FrameId / PerThread;
+        ASSERT_GT(request.FrameId + 1, lastOfThread[thread]);
+        lastOfThread[thread] = request.FrameId + 1;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    EXPECT_FALSE(queue.Pop(request));
+}
+
+TEST(CaptureQueue, Capacity)
+{
+    CaptureQueue queue;
+    CaptureQueue::Request request;
+
+    for (uint32_t i = 0; i < CaptureQueue::Capacity; i++)
+        ASSERT_TRUE(queue.Push(request));
+
+    EXPECT_FALSE(queue.Push(request));
+
+    queue.Reset();
+    EXPECT_TRUE(queue.Push(request));
+    EXPECT_TRUE(queue.Pop(request));
+    EXPECT_FALSE(queue.Pop(request));
+}
+
+TEST(CaptureQueue, SlotLifecycle)
+{
+    CaptureQueue queue;
+    uint64_t fence = 0;
+
+    queue.Recorded(1, 10);
+    EXPECT_EQ(queue.State(1), CaptureQueue::SlotRecorded);
+
+    // Nothing on Hudfix queue to wait yet
+    EXPECT_EQ(queue.ReadyWaitValue(1, fence), 0u);
+    EXPECT_EQ(queue.SlotWaitValue(1, fence), 0u);
+
+    auto value = queue.Submitted(1);
+    EXPECT_EQ(queue.State(1), CaptureQueue::SlotSubmitted);
+    EXPECT_EQ(queue.ReadyWaitValue(1, fence), value);
+    EXPECT_EQ(queue.SlotWaitValue(1, fence), value);
+
+    // GPU done
+    fence = value;
+    EXPECT_EQ(queue.ReadyWaitValue(1, fence), 0u);
+    EXPECT_EQ(queue.State(1), CaptureQueue::SlotReady);
+    EXPECT_EQ(queue.SlotWaitValue(1, fence), 0u);
+
+    // Fence values grow over slots
+    EXPECT_GT(queue.Submitted(3), value);
+}
+
+TEST(CaptureQueue, ReadySlotIsStillBusyUntilFence)
+{
+    CaptureQueue queue;
+
+    queue.Recorded(2, 1);
+    auto value = queue.Submitted(2);
+
+    // Next capture of the slot fails and is marked ready, previous transfer can still be running
+    queue.Recorded(2, 5);
+    queue.MarkReady(2);
+
+    EXPECT_EQ(queue.ReadyWaitValue(2, 0), 0u);
+    EXPECT_EQ(queue.SlotWaitValue(2, 0), value);
+    EXPECT_EQ(queue.SlotWaitValue(2, value), 0u);
+}
+
+TEST(CaptureQueue, ResetKeepsFenceValues)
+{
+    CaptureQueue queue;
+
+    queue.Recorded(0, 1);
+    auto value = queue.Submitted(0);
+    queue.Reset();
+
+    EXPECT_EQ(queue.State(0), CaptureQueue::SlotFree);
+    EXPECT_EQ(queue.SlotWaitValue(0, 0), value);
+    EXPECT_GT(queue.Submitted(0), value);
+}
+
+TEST(CaptureQueue, BusySlotIsDropped)
+{
+    CaptureQueue queue;
+    uint64_t completed = 0;
+
+    queue.Recorded(3, 1);
+    auto value = queue.Submitted(3);
+
+    // Next capture of the slot arrives while previous transfer is still on Hudfix queue
+    queue.Recorded(3, 5);
+    ASSERT_NE(queue.SlotWaitValue(3, completed), 0u);
+
+    EXPECT_EQ(queue.Drop(3), 1u);
+    EXPECT_EQ(queue.State(3), CaptureQueue::SlotReady);
+
+    // FG doesn't wait for a dropped capture, slot is reusable once the old transfer is done
+    EXPECT_EQ(queue.ReadyWaitValue(3, completed), 0u);
+    EXPECT_EQ(queue.SlotWaitValue(3, completed), value);
+
+    completed = value;
+    EXPECT_EQ(queue.SlotWaitValue(3, completed), 0u);
+
+    // Drops are counted over slots and resets
+    queue.Reset();
+    EXPECT_EQ(queue.Drop(0), 2u);
+    EXPECT_EQ(queue.DroppedCount(), 2u);
+}
@@ -0,0 +1,313 @@
+#include <gtest/gtest.h>
+
+#include <inputs/DepthCopyRing.h>
+
+#include <map>
+#include <memory>
+
+// Committed resource creation and resource states of the device, counts creations and releases.
+// GPU finishes the work of a frame while the next one is recorded, Completed is the fence value it reached.
+class FakeAllocator
+{
+  public:
+    enum State : uint32_t
+    {
+        GenericRead = 1,
+        CopyDest = 2,
+    };
+
+    struct Resource
+    {
+        DepthCopyRing::Key Desc;
+        uint32_t State = 0;
+    };
+
+    std::map<void*, std::unique_ptr<Resource>> Live;
+    uint32_t Creations = 0;
+    uint32_t Releases = 0;
+    uint32_t Barriers = 0;
+    uint32_t WrongBarriers = 0;
+    bool Fail = false;
+
+    uint64_t Signaled = 0;
+    uint64_t Completed = 0;
+    uint64_t FrameFence = 0; // last value signaled by the previous frame
+    bool Stalled = false;
+
+    void* Create(const DepthCopyRing::Key& InDesc, uint32_t InState)
+    {
+        if (Fail)
+            return nullptr;
+
+        auto resource = std::make_unique<Resource>(Resource { InDesc, InState });
+        auto handle = (void*) resource.get();
+        Live[handle] = std::move(resource);
+        Creations++;
+
+        return handle;
+    }
+
+    void Release(void* InResource)
+    {
+        if (InResource == nullptr)
+            return;
+
+        ASSERT_TRUE(Live.contains(InResource));
+        Live.erase(InResource);
+        Releases++;
+    }
+
+    // Debug layer check, before state must match the actual state
+    void Barrier(void* InResource, uint32_t InBefore, uint32_t InAfter)
+    {
+        auto& resource = *Live.at(InResource);
+
+        if (resource.State != InBefore)
+            WrongBarriers++;
+
+        resource.State = InAfter;
+        Barriers++;
+    }
+};
+
+// DLSSG depth copy of NVSDK_NGX_D3D12_EvaluateFeature, returns the copy passed to frame generation
+static void* CopyDepth(DepthCopyRing& InRing, FakeAllocator& InAllocator, const DepthCopyRing::Key& InDesc)
+{
+    if (!InAllocator.Stalled)
+        InAllocator.Completed = InAllocator.FrameFence;
+
+    if (InRing.Acquire(InDesc) == DepthCopyRing::Create)
+        InRing.Created(InAllocator.Create(InDesc, FakeAllocator::GenericRead), FakeAllocator::GenericRead);
+
+    // ReleaseDepthCopies
+    if (InRing.NeedsSignal())
+        InRing.Signaled(++InAllocator.Signaled);
+
+    while (auto released = InRing.Release(InAllocator.Completed))
+        InAllocator.Release(released);
+
+    InAllocator.FrameFence = InAllocator.Signaled;
+
+    auto copy = InRing.Current();
+
+    if (copy == nullptr)
+        return nullptr;
+
+    if (InRing.CurrentState() != FakeAllocator::CopyDest)
+        InAllocator.Barrier(copy, InRing.CurrentState(), FakeAllocator::CopyDest);
+
+    // CopyResource
+    EXPECT_TRUE(InAllocator.Live.at(copy)->Desc == InDesc);
+
+    InAllocator.Barrier(copy, FakeAllocator::CopyDest, FakeAllocator::GenericRead);
+    InRing.SetCurrentState(FakeAllocator::GenericRead);
+
+    return copy;
+}
+
+static const DepthCopyRing::Key Depth1080p { 1, 1920, 1080, 1, 1, 40, 1, 2, 1 };
+
+TEST(DepthCopyRing, SteadyStateReusesResources)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring;
+
+    for (int frame = 0; frame < 1000; frame++)
+        ASSERT_NE(CopyDepth(ring, allocator, Depth1080p), nullptr);
+
+    // One resource per slot instead of one per frame
+    EXPECT_EQ(allocator.Creations, ring.SlotCount());
+    EXPECT_EQ(allocator.Releases, 0u);
+    EXPECT_EQ(ring.CreatedCount(), ring.SlotCount());
+    EXPECT_EQ(ring.ReusedCount(), 1000u - ring.SlotCount());
+    EXPECT_EQ(allocator.WrongBarriers, 0u);
+    EXPECT_EQ(allocator.Barriers, 2000u);
+}
+
+TEST(DepthCopyRing, ConsumerNeverReadsCopyBeingWritten)
+{
+    for (uint32_t slots = 2; slots <= DepthCopyRing::MaxSlots; slots++)
+    {
+        FakeAllocator allocator;
+        DepthCopyRing ring(slots);
+
+        ASSERT_EQ(ring.SlotCount(), slots);
+
+        // Frame generation reads the copy of frame N while frame N + 1 is recorded
+        void* consumed = nullptr;
+
+        for (int frame = 0; frame < 100; frame++)
+        {
+            auto written = CopyDepth(ring, allocator, Depth1080p);
+
+            ASSERT_NE(written, nullptr);
+            ASSERT_NE(written, consumed) << slots << " " << frame;
+
+            consumed = written;
+        }
+
+        EXPECT_EQ(allocator.Creations, slots);
+    }
+}
+
+TEST(DepthCopyRing, DescriptionChangeRecreatesSlots)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring;
+
+    for (int frame = 0; frame < 10; frame++)
+        CopyDepth(ring, allocator, Depth1080p);
+
+    void (*changes[])(DepthCopyRing::Key&) = { [](DepthCopyRing::Key& key) { key.Width = 2560; },
+                                               [](DepthCopyRing::Key& key) { key.Height = 1440; },
+                                               [](DepthCopyRing::Key& key) { key.Format = 20; },
+                                               [](DepthCopyRing::Key& key) { key.SampleCount = 4; },
+                                               [](DepthCopyRing::Key& key) { key.Flags = 0; },
+                                               [](DepthCopyRing::Key& key) { key.HeapType = 2; },
+                                               [](DepthCopyRing::Key& key) { key.Device = 2; } };
+
+    auto creations = allocator.Creations;
+
+    for (auto change : changes)
+    {
+        auto desc = Depth1080p;
+        change(desc);
+
+        for (int frame = 0; frame < 10; frame++)
+            CopyDepth(ring, allocator, desc);
+
+        // Each slot once, old resources are released when their slot comes around
+        EXPECT_EQ(allocator.Creations, creations + ring.SlotCount());
+        EXPECT_EQ(allocator.Live.size(), ring.SlotCount());
+        creations = allocator.Creations;
+
+        for (auto& [handle, resource] : allocator.Live)
+            EXPECT_TRUE(resource->Desc == desc);
+    }
+
+    EXPECT_EQ(allocator.Releases, allocator.Creations - ring.SlotCount());
+    EXPECT_EQ(allocator.WrongBarriers, 0u);
+}
+
+TEST(DepthCopyRing, AlternatingSizesKeepOldCopyUntilFence)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring;
+
+    auto small = Depth1080p;
+    auto large = Depth1080p;
+    large.Width = 3840;
+    large.Height = 2160;
+
+    auto first = CopyDepth(ring, allocator, small);
+
+    // Next frame uses the other slot, copy of previous frame stays alive for the consumer
+    CopyDepth(ring, allocator, large);
+    EXPECT_TRUE(allocator.Live.contains(first));
+
+    // Retired, released when the GPU reached the fence signaled after it
+    CopyDepth(ring, allocator, large);
+    EXPECT_TRUE(allocator.Live.contains(first));
+    EXPECT_EQ(ring.RetiredCount(), 1u);
+
+    CopyDepth(ring, allocator, large);
+    EXPECT_FALSE(allocator.Live.contains(first));
+    EXPECT_EQ(ring.RetiredCount(), 0u);
+}
+
+TEST(DepthCopyRing, RetiredCopiesWaitForFence)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring;
+
+    for (int frame = 0; frame < 4; frame++)
+        CopyDepth(ring, allocator, Depth1080p);
+
+    // GPU is behind, replaced copies may still be read
+    allocator.Stalled = true;
+
+    auto large = Depth1080p;
+    large.Width = 3840;
+
+    for (int frame = 0; frame < 10; frame++)
+        ASSERT_NE(CopyDepth(ring, allocator, large), nullptr);
+
+    EXPECT_EQ(allocator.Releases, 0u);
+    EXPECT_EQ(ring.RetiredCount(), ring.SlotCount());
+    EXPECT_EQ(allocator.Live.size(), ring.SlotCount() * 2);
+
+    allocator.Stalled = false;
+    CopyDepth(ring, allocator, large);
+
+    EXPECT_EQ(allocator.Releases, ring.SlotCount());
+    EXPECT_EQ(ring.RetiredCount(), 0u);
+}
+
+TEST(DepthCopyRing, FailedCreationIsRetried)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring;
+
+    allocator.Fail = true;
+    EXPECT_EQ(CopyDepth(ring, allocator, Depth1080p), nullptr);
+    EXPECT_EQ(ring.CreatedCount(), 0u);
+
+    allocator.Fail = false;
+    EXPECT_NE(CopyDepth(ring, allocator, Depth1080p), nullptr);
+
+    // Slot of the failed creation, nothing to retire
+    EXPECT_EQ(ring.Acquire(Depth1080p), DepthCopyRing::Create);
+    EXPECT_FALSE(ring.NeedsSignal());
+    ring.Created(allocator.Create(Depth1080p, FakeAllocator::GenericRead), FakeAllocator::GenericRead);
+
+    EXPECT_EQ(ring.Acquire(Depth1080p), DepthCopyRing::Reuse);
+    EXPECT_EQ(allocator.Creations, 2u);
+}
+
+TEST(DepthCopyRing, StatesAreTrackedPerSlot)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring(3);
+
+    for (int frame = 0; frame < 3; frame++)
+        CopyDepth(ring, allocator, Depth1080p);
+
+    // Consumer leaves a slot in copy dest, only that slot skips the first barrier
+    ring.SetCurrentState(FakeAllocator::CopyDest);
+    allocator.Live.at(ring.Current())->State = FakeAllocator::CopyDest;
+
+    auto barriers = allocator.Barriers;
+
+    for (int frame = 0; frame < 3; frame++)
+        CopyDepth(ring, allocator, Depth1080p);
+
+    EXPECT_EQ(allocator.Barriers - barriers, 5u);
+    EXPECT_EQ(allocator.WrongBarriers, 0u);
+}
+
+TEST(DepthCopyRing, DrainReleasesEverything)
+{
+    FakeAllocator allocator;
+    DepthCopyRing ring(3);
+
+    for (int frame = 0; frame < 5; frame++)
+        CopyDepth(ring, allocator, Depth1080p);
+
+    // Shutdown with a retired copy still waiting for its fence
+    allocator.Stalled = true;
+    auto large = Depth1080p;
+    large.Width = 3840;
+    CopyDepth(ring, allocator, large);
+    ASSERT_EQ(ring.RetiredCount(), 1u);
+
+    while (auto resource = ring.Drain())
+        allocator.Release(resource);
+
+    EXPECT_EQ(ring.RetiredCount(), 0u);
+    EXPECT_EQ(ring.Current(), nullptr);
+    EXPECT_TRUE(allocator.Live.empty());
+    EXPECT_EQ(allocator.Releases, allocator.Creations);
+
+    EXPECT_EQ(DepthCopyRing(0).SlotCount(), 2u);
+    EXPECT_EQ(DepthCopyRing(100).SlotCount(), DepthCopyRing::MaxSlots);
+}
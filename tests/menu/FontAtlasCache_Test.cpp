@@ -0,0 +1,443 @@
+#include <gtest/gtest.h>
+
+#include <menu/FontAtlasCache.h>
+#include <menu/font/Hack_Baked.h>
+#include <menu/font/Hack_Compressed.h>
+
+#include <imgui/imgui_internal.h>
+#include <imgui/misc/freetype/imgui_freetype.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Headless ImGui with the menu font, same setup as MenuCommon::Init
+class HeadlessMenu
+{
+  public:
+    struct GlyphData
+    {
+        float X0, Y0, X1, Y1, AdvanceX;
+        std::vector<uint8_t> Alpha;
+
+        bool operator==(const GlyphData&) const = default;
+    };
+
+    ImGuiContext* Context = nullptr;
+    ImFont* Font = nullptr;
+
+    explicit HeadlessMenu(FontAtlasCache* InCache)
+    {
+        Context = ImGui::CreateContext();
+        ImGui::SetCurrentContext(Context);
+
+        auto& io = ImGui::GetIO();
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+
+        ImFontConfig fontConfig;
+
+        if (InCache != nullptr)
+        {
+            InCache->Activate();
+            fontConfig.FontLoader = FontAtlasCache::Loader(ImGuiFreeType::GetFontLoader());
+        }
+
+        Font = io.Fonts->AddFontFromMemoryCompressedBase85TTF(hack_compressed_compressed_data_base85, 14.0f,
+                                                              &fontConfig);
+    }
+
+    ~HeadlessMenu() { ImGui::DestroyContext(Context); }
+
+    // Draws printable ascii at menu sizes, glyphs are rasterized on first use
+    void Frame(const std::vector<float>& InSizes)
+    {
+        ImGui::SetCurrentContext(Context);
+        ImGui::NewFrame();
+        ImGui::Begin("OptiScaler");
+
+        for (auto size : InSizes)
+        {
+            ImGui::PushFont(nullptr, size);
+            ImGui::TextUnformatted(" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+            ImGui::TextUnformatted("[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~");
+            ImGui::PopFont();
+        }
+
+        ImGui::End();
+        ImGui::Render();
+
+        // No renderer, mark textures as uploaded
+        for (auto tex : ImGui::GetPlatformIO().Textures)
+        {
+            if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            {
+                tex->SetTexID((ImTextureID) 1);
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+            else if (tex->Status == ImTextureStatus_WantDestroy)
+            {
+                tex->SetTexID(ImTextureID_Invalid);
+                tex->SetStatus(ImTextureStatus_Destroyed);
+            }
+        }
+    }
+
+    std::map<std::pair<float, ImWchar>, GlyphData> Glyphs(const std::vector<float>& InSizes)
+    {
+        ImGui::SetCurrentContext(Context);
+        std::map<std::pair<float, ImWchar>, GlyphData> result;
+        auto atlas = ImGui::GetIO().Fonts;
+        auto tex = atlas->TexData;
+
+        for (auto size : InSizes)
+        {
+            auto baked = Font->GetFontBaked(size);
+
+            for (ImWchar c = 32; c < 127; c++)
+            {
+                auto glyph = baked->FindGlyphNoFallback(c);
+
+                if (glyph == nullptr)
+                    continue;
+
+                GlyphData data { glyph->X0, glyph->Y0, glyph->X1, glyph->Y1, glyph->AdvanceX, {} };
+
+                if (glyph->Visible)
+                {
+                    auto rect = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+                    auto channel = tex->Format == ImTextureFormat_RGBA32 ? 3 : 0;
+
+                    for (int y = 0; y < rect->h; y++)
+                    {
+                        for (int x = 0; x < rect->w; x++)
+                            data.Alpha.push_back(tex->GetPixelsAt(rect->x + x, rect->y + y)[channel]);
+                    }
+                }
+
+                result[{ size, c }] = std::move(data);
+            }
+        }
+
+        return result;
+    }
+};
+
+class FontAtlasCacheTest : public ::testing::Test
+{
+  protected:
+    fs::path CachePath;
+    std::vector<float> Sizes { 14.0f, 16.8f, 21.0f, 28.0f };
+
+    void SetUp() override
+    {
+        auto name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        CachePath = fs::temp_directory_path() / (std::string("optiscaler_fontcache_") + name);
+        fs::remove(CachePath);
+    }
+
+    void TearDown() override { fs::remove(CachePath); }
+};
+
+TEST_F(FontAtlasCacheTest, CachedGlyphsMatchRasterized)
+{
+    std::map<std::pair<float, ImWchar>, HeadlessMenu::GlyphData> reference;
+
+    {
+        HeadlessMenu menu(nullptr);
+        menu.Frame(Sizes);
+        reference = menu.Glyphs(Sizes);
+    }
+
+    ASSERT_EQ(reference.size(), Sizes.size() * 95);
+
+    // Cold cache rasterizes and records
+    {
+        FontAtlasCache cache;
+        EXPECT_FALSE(cache.Load(CachePath));
+
+        HeadlessMenu menu(&cache);
+        menu.Frame(Sizes);
+
+        EXPECT_EQ(cache.Hits(), 0u);
+        EXPECT_EQ(cache.Misses(), reference.size());
+        EXPECT_EQ(menu.Glyphs(Sizes), reference);
+        ASSERT_TRUE(cache.Save(CachePath));
+        EXPECT_FALSE(cache.Dirty());
+    }
+
+    // Warm cache doesn't rasterize anything
+    {
+        FontAtlasCache cache;
+        ASSERT_TRUE(cache.Load(CachePath));
+        EXPECT_EQ(cache.GlyphCount(), reference.size());
+
+        HeadlessMenu menu(&cache);
+        menu.Frame(Sizes);
+
+        EXPECT_EQ(cache.Misses(), 0u);
+        EXPECT_EQ(cache.Hits(), reference.size());
+        EXPECT_FALSE(cache.Dirty());
+        EXPECT_EQ(menu.Glyphs(Sizes), reference);
+    }
+}
+
+TEST_F(FontAtlasCacheTest, NewSizesAreAppended)
+{
+    {
+        FontAtlasCache cache;
+        HeadlessMenu menu(&cache);
+        menu.Frame({ 14.0f });
+        ASSERT_TRUE(cache.Save(CachePath));
+    }
+
+    FontAtlasCache cache;
+    ASSERT_TRUE(cache.Load(CachePath));
+    auto count = cache.GlyphCount();
+
+    {
+        HeadlessMenu menu(&cache);
+        menu.Frame({ 14.0f, 18.2f });
+
+        EXPECT_EQ(cache.Hits(), count);
+        EXPECT_EQ(cache.Misses(), count);
+        ASSERT_TRUE(cache.Save(CachePath));
+    }
+
+    EXPECT_EQ(cache.GlyphCount(), count * 2);
+
+    FontAtlasCache reloaded;
+    ASSERT_TRUE(reloaded.Load(CachePath));
+    EXPECT_EQ(reloaded.GlyphCount(), count * 2);
+}
+
+TEST_F(FontAtlasCacheTest, KeyChangesWithRasterSettings)
+{
+    HeadlessMenu menu(nullptr);
+    menu.Frame(Sizes);
+
+    auto src = menu.Font->Sources[0];
+    auto baked = menu.Font->GetFontBaked(14.0f);
+    auto key = FontAtlasCache::GlyphKey(src, baked, 1);
+
+    EXPECT_NE(key, FontAtlasCache::GlyphKey(src, baked, 2));
+    EXPECT_NE(key, FontAtlasCache::GlyphKey(src, menu.Font->GetFontBaked(16.0f), 1));
+
+    src->GlyphOffset.y = 1.0f;
+    EXPECT_NE(key, FontAtlasCache::GlyphKey(src, baked, 1));
+    src->GlyphOffset.y = 0.0f;
+
+    src->PixelSnapH = !src->PixelSnapH;
+    EXPECT_NE(key, FontAtlasCache::GlyphKey(src, baked, 1));
+    src->PixelSnapH = !src->PixelSnapH;
+
+    EXPECT_EQ(key, FontAtlasCache::GlyphKey(src, baked, 1));
+}
+
+TEST_F(FontAtlasCacheTest, InvalidFilesAreIgnored)
+{
+    FontAtlasCache cache;
+
+    FontAtlasCache::Glyph glyph {};
+    glyph.Key = 1;
+    glyph.Codepoint = 'A';
+    glyph.Width = 2;
+    glyph.Height = 2;
+    const uint8_t pixels[] = { 1, 2, 3, 4 };
+
+    ASSERT_TRUE(cache.Add(glyph, pixels));
+    EXPECT_FALSE(cache.Add(glyph, pixels));
+    ASSERT_TRUE(cache.Save(CachePath));
+
+    auto entry = cache.Find(1, 'A');
+    ASSERT_NE(entry.Info, nullptr);
+    EXPECT_EQ(entry.Pixels[3], 4);
+    EXPECT_EQ(cache.Find(1, 'B').Info, nullptr);
+
+    auto size = fs::file_size(CachePath);
+
+    // Truncated
+    fs::resize_file(CachePath, size - 1);
+    EXPECT_FALSE(cache.Load(CachePath));
+    EXPECT_EQ(cache.GlyphCount(), 0u);
+
+    // Other ImGui version
+    ASSERT_TRUE(cache.Add(glyph, pixels));
+    ASSERT_TRUE(cache.Save(CachePath));
+
+    {
+        std::fstream file(CachePath, std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t version = IMGUI_VERSION_NUM + 1;
+        file.seekp(offsetof(FontAtlasCache::Header, ImGuiVersion));
+        file.write((const char*) &version, sizeof(version));
+    }
+
+    EXPECT_FALSE(cache.Load(CachePath));
+
+    // Pixels out of range
+    ASSERT_TRUE(cache.Add(glyph, pixels));
+    ASSERT_TRUE(cache.Save(CachePath));
+
+    {
+        std::fstream file(CachePath, std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t offset = 100;
+        file.seekp(sizeof(FontAtlasCache::Header) + offsetof(FontAtlasCache::Glyph, PixelOffset));
+        file.write((const char*) &offset, sizeof(offset));
+    }
+
+    EXPECT_FALSE(cache.Load(CachePath));
+    EXPECT_FALSE(cache.Load(CachePath.string() + ".missing"));
+}
+
+TEST_F(FontAtlasCacheTest, FailedReplaceKeepsGlyphs)
+{
+    FontAtlasCache cache;
+
+    FontAtlasCache::Glyph glyph {};
+    glyph.Key = 1;
+    glyph.Codepoint = 'A';
+    glyph.Width = 2;
+    glyph.Height = 2;
+    const uint8_t pixels[] = { 1, 2, 3, 4 };
+
+    ASSERT_TRUE(cache.Add(glyph, pixels));
+    ASSERT_TRUE(cache.Save(CachePath));
+
+    glyph.Codepoint = 'B';
+    const uint8_t otherPixels[] = { 5, 6, 7, 8 };
+    ASSERT_TRUE(cache.Add(glyph, otherPixels));
+
+    // Directory at target path, rename fails after the mapping was closed
+    auto blocked = CachePath.string() + ".dir";
+    fs::create_directories(fs::path(blocked) / "x");
+    EXPECT_FALSE(cache.Save(blocked));
+    fs::remove_all(blocked);
+
+    EXPECT_TRUE(cache.Dirty());
+    EXPECT_EQ(cache.GlyphCount(), 2u);
+
+    auto entry = cache.Find(1, 'A');
+    ASSERT_NE(entry.Info, nullptr);
+    EXPECT_EQ(entry.Pixels[3], 4);
+
+    entry = cache.Find(1, 'B');
+    ASSERT_NE(entry.Info, nullptr);
+    EXPECT_EQ(entry.Pixels[0], 5);
+
+    ASSERT_TRUE(cache.Save(CachePath));
+    EXPECT_FALSE(cache.Dirty());
+    EXPECT_EQ(cache.GlyphCount(), 2u);
+}
+
+// Menu sizes of MenuScale 0.5 - 1.0 (round(14 * scale)), auto scale of the menu stays in this range
+static const std::vector<float> BakedSizes { 7.0f, 8.0f, 10.0f, 11.0f, 13.0f, 14.0f };
+
+static void WriteBakedHeader(const fs::path& InCachePath, const fs::path& InHeaderPath)
+{
+    std::ifstream cacheFile(InCachePath, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(cacheFile)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(data.empty());
+
+    std::ofstream header(InHeaderPath, std::ios::trunc);
+    ASSERT_TRUE(header.good()) << InHeaderPath;
+
+    header << "#pragma once\n\n";
+    header << "// FontAtlasCache data of the embedded Hack font, printable ascii at menu sizes of MenuScale 0.5 - 1.0.\n";
+    header << "// Generated by the menu test, regenerate with OPTISCALER_UPDATE_REFERENCES=1 after ImGui or\n";
+    header << "// FreeType updates. Data of another ImGui version is ignored by FontAtlasCache::LoadBaked.\n\n";
+    header << "alignas(8) inline static const unsigned char hack_baked_glyphs[] = {";
+
+    char hex[8];
+
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        snprintf(hex, sizeof(hex), "0x%02x", data[i]);
+        header << (i % 19 == 0 ? "\n    " : " ") << hex << (i + 1 < data.size() ? "," : "");
+    }
+
+    header << "\n};\n";
+}
+
+TEST_F(FontAtlasCacheTest, BakedGlyphsAreCurrent)
+{
+    if (auto update = std::getenv("OPTISCALER_UPDATE_REFERENCES"); update != nullptr && update[0] == '1')
+    {
+        FontAtlasCache cache;
+        HeadlessMenu menu(&cache);
+        menu.Frame(BakedSizes);
+        ASSERT_TRUE(cache.Save(CachePath));
+
+        WriteBakedHeader(CachePath, fs::path(OPTISCALER_SOURCE_DIR) / "menu/font/Hack_Baked.h");
+        return;
+    }
+
+    FontAtlasCache cache;
+    ASSERT_TRUE(cache.LoadBaked(hack_baked_glyphs, sizeof(hack_baked_glyphs)))
+        << "Outdated menu/font/Hack_Baked.h, regenerate it with OPTISCALER_UPDATE_REFERENCES=1";
+    EXPECT_EQ(cache.BakedCount(), BakedSizes.size() * 95);
+
+    HeadlessMenu menu(&cache);
+    menu.Frame(BakedSizes);
+
+    // Nothing rasterized and nothing to write to the cache file
+    EXPECT_EQ(cache.Misses(), 0u);
+    EXPECT_EQ(cache.Hits(), BakedSizes.size() * 95);
+    EXPECT_FALSE(cache.Dirty());
+    EXPECT_EQ(cache.GlyphCount(), 0u);
+
+    // Other sizes still go to the file
+    menu.Frame({ 16.0f });
+    EXPECT_EQ(cache.Misses(), 95u);
+    ASSERT_TRUE(cache.Save(CachePath));
+
+    FontAtlasCache reloaded;
+    ASSERT_TRUE(reloaded.Load(CachePath));
+    EXPECT_EQ(reloaded.GlyphCount(), 95u);
+}
+
+// First frame cost with and without cache, timings are written as test properties
+TEST_F(FontAtlasCacheTest, DISABLED_FirstFrameBenchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto firstFrame = [this](FontAtlasCache* InCache)
+    {
+        auto start = Clock::now();
+        HeadlessMenu menu(InCache);
+        menu.Frame(Sizes);
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    // Warm up allocator and code
+    firstFrame(nullptr);
+
+    auto uncached = firstFrame(nullptr);
+
+    {
+        FontAtlasCache cache;
+        firstFrame(&cache);
+        ASSERT_TRUE(cache.Save(CachePath));
+    }
+
+    FontAtlasCache cache;
+    auto loadStart = Clock::now();
+    ASSERT_TRUE(cache.Load(CachePath));
+    auto load = std::chrono::duration<double, std::milli>(Clock::now() - loadStart).count();
+    auto cached = firstFrame(&cache);
+
+    RecordProperty("glyphs", (int) cache.GlyphCount());
+    RecordProperty("uncached_ms", std::to_string(uncached));
+    RecordProperty("cached_ms", std::to_string(cached));
+    RecordProperty("load_ms", std::to_string(load));
+    RecordProperty("cache_file_bytes", (int) fs::file_size(CachePath));
+
+    EXPECT_EQ(cache.Misses(), 0u);
+}
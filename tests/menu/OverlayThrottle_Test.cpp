@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <menu/OverlayThrottle.h>
+
+#include <cmath>
+
+static OverlayThrottle::Snapshot MakeSnapshot(uint64_t InLayout, float InFps)
+{
+    OverlayThrottle::Snapshot snapshot;
+    snapshot.Layout = InLayout;
+    snapshot.Values = { InFps, 1000.0f / InFps, 0.0f, 0.0f };
+    return snapshot;
+}
+
+TEST(OverlayThrottle, RateZeroUpdatesEveryFrame)
+{
+    OverlayThrottle throttle;
+    auto snapshot = MakeSnapshot(1, 120.0f);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_TRUE(throttle.ShouldUpdate(i * 8.3, snapshot));
+
+    EXPECT_EQ(throttle.Skipped(), 0u);
+}
+
+TEST(OverlayThrottle, UpdatesAtRate)
+{
+    OverlayThrottle throttle;
+    throttle.SetRate(10);
+
+    // 10 seconds at 144 fps with small fps noise
+    uint32_t updates = 0;
+
+    for (int frame = 0; frame < 1440; frame++)
+    {
+        auto snapshot = MakeSnapshot(1, 144.0f + (frame % 3));
+
+        if (throttle.ShouldUpdate(frame * (1000.0 / 144.0), snapshot))
+            updates++;
+    }
+
+    // Updates land on the first frame after the interval, so a bit under 10 Hz
+    EXPECT_GE(updates, 90u);
+    EXPECT_LE(updates, 101u);
+    EXPECT_EQ(throttle.Updates() + throttle.Skipped(), 1440u);
+}
+
+TEST(OverlayThrottle, VisibleChangeUpdatesImmediately)
+{
+    OverlayThrottle throttle;
+    throttle.SetRate(1);
+
+    ASSERT_TRUE(throttle.ShouldUpdate(0.0, MakeSnapshot(1, 120.0f)));
+
+    // Under threshold
+    EXPECT_FALSE(throttle.ShouldUpdate(10.0, MakeSnapshot(1, 125.0f)));
+
+    // Fps drops
+    EXPECT_TRUE(throttle.ShouldUpdate(20.0, MakeSnapshot(1, 60.0f)));
+    EXPECT_FALSE(throttle.ShouldUpdate(30.0, MakeSnapshot(1, 60.0f)));
+
+    throttle.SetThreshold(0.01f);
+    EXPECT_TRUE(throttle.ShouldUpdate(40.0, MakeSnapshot(1, 61.0f)));
+}
+
+TEST(OverlayThrottle, LayoutChangeUpdates)
+{
+    OverlayThrottle throttle;
+    throttle.SetRate(1);
+
+    ASSERT_TRUE(throttle.ShouldUpdate(0.0, MakeSnapshot(1, 60.0f)));
+    EXPECT_FALSE(throttle.ShouldUpdate(1.0, MakeSnapshot(1, 60.0f)));
+
+    auto layout = OverlayThrottle::Combine(1, 2);
+    EXPECT_NE(layout, OverlayThrottle::Combine(2, 1));
+    EXPECT_TRUE(throttle.ShouldUpdate(2.0, MakeSnapshot(layout, 60.0f)));
+    EXPECT_FALSE(throttle.ShouldUpdate(3.0, MakeSnapshot(layout, 60.0f)));
+}
+
+TEST(OverlayThrottle, InvalidateAndClockJumps)
+{
+    OverlayThrottle throttle;
+    throttle.SetRate(1);
+    auto snapshot = MakeSnapshot(1, 60.0f);
+
+    ASSERT_TRUE(throttle.ShouldUpdate(100.0, snapshot));
+    EXPECT_FALSE(throttle.ShouldUpdate(101.0, snapshot));
+
+    // Menu was drawn
+    throttle.Invalidate();
+    EXPECT_TRUE(throttle.ShouldUpdate(102.0, snapshot));
+
+    // Timer went back
+    EXPECT_TRUE(throttle.ShouldUpdate(50.0, snapshot));
+    EXPECT_FALSE(throttle.ShouldUpdate(51.0, snapshot));
+}
+
+TEST(OverlayThrottle, InvalidValuesUpdate)
+{
+    OverlayThrottle throttle;
+    throttle.SetRate(1);
+
+    // Empty frame time window, RenderMenu invalidates and passes zeros
+    OverlayThrottle::Snapshot empty;
+    empty.Layout = 1;
+
+    ASSERT_TRUE(throttle.ShouldUpdate(0.0, empty));
+    EXPECT_FALSE(throttle.ShouldUpdate(1.0, empty));
+    EXPECT_TRUE(throttle.ShouldUpdate(2.0, MakeSnapshot(1, 60.0f)));
+
+    auto snapshot = MakeSnapshot(1, 60.0f);
+    snapshot.Values[1] = NAN;
+    EXPECT_TRUE(throttle.ShouldUpdate(3.0, snapshot));
+    EXPECT_TRUE(throttle.ShouldUpdate(4.0, snapshot));
+}
@@ -0,0 +1,303 @@
+#include <gtest/gtest.h>
+
+#include <menu/RetainedDrawData.h>
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+// Draw data built by hand, no ImGui context is needed
+class TestDrawData
+{
+    std::vector<std::unique_ptr<ImDrawList>> _lists;
+
+  public:
+    ImDrawData Data;
+
+    ImDrawList* AddList()
+    {
+        _lists.push_back(std::make_unique<ImDrawList>(nullptr));
+        Data.CmdLists.push_back(_lists.back().get());
+        Data.CmdListsCount = Data.CmdLists.Size;
+        return _lists.back().get();
+    }
+
+    // Quad of two triangles with its own draw command
+    void AddQuad(ImDrawList* InList, ImVec2 InMin, ImVec2 InMax, ImTextureID InTexture, ImVec4 InClip)
+    {
+        auto base = (ImDrawIdx) InList->VtxBuffer.Size;
+        ImVec2 corners[] = { InMin, { InMax.x, InMin.y }, InMax, { InMin.x, InMax.y } };
+
+        for (auto corner : corners)
+            InList->VtxBuffer.push_back({ corner, { 0.0f, 0.0f }, 0xFFFFFFFF });
+
+        ImDrawCmd cmd;
+        cmd.ClipRect = InClip;
+        cmd.TexRef = ImTextureRef(InTexture);
+        cmd.IdxOffset = InList->IdxBuffer.Size;
+        cmd.ElemCount = 6;
+
+        for (ImDrawIdx i : { 0, 1, 2, 0, 2, 3 })
+            InList->IdxBuffer.push_back(base + i);
+
+        InList->CmdBuffer.push_back(cmd);
+        Data.TotalVtxCount += 4;
+        Data.TotalIdxCount += 6;
+    }
+
+    void AddCallback(ImDrawList* InList, ImDrawCallback InCallback)
+    {
+        ImDrawCmd cmd;
+        cmd.UserCallback = InCallback;
+        InList->CmdBuffer.push_back(cmd);
+    }
+
+    TestDrawData()
+    {
+        Data.Valid = true;
+        Data.DisplaySize = { 640.0f, 480.0f };
+        Data.FramebufferScale = { 1.0f, 1.0f };
+    }
+};
+
+// Triangle corners with texture and scissor, what reaches the rasterizer
+using Triangle = std::tuple<float, float, float, float, float, float, ImTextureID, int32_t, int32_t, int32_t, int32_t>;
+
+// Draws the way the backends do, from the draw data's own buffers
+static std::vector<Triangle> DrawDirect(const ImDrawData* InData)
+{
+    std::vector<Triangle> result;
+
+    for (int n = 0; n < InData->CmdListsCount; n++)
+    {
+        auto list = InData->CmdLists[n];
+
+        for (const auto& cmd : list->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr)
+                continue;
+
+            auto x0 = (int32_t) std::max(cmd.ClipRect.x - InData->DisplayPos.x, 0.0f);
+            auto y0 = (int32_t) std::max(cmd.ClipRect.y - InData->DisplayPos.y, 0.0f);
+            auto x1 = (int32_t) std::min(cmd.ClipRect.z - InData->DisplayPos.x, InData->DisplaySize.x);
+            auto y1 = (int32_t) std::min(cmd.ClipRect.w - InData->DisplayPos.y, InData->DisplaySize.y);
+
+            if (x1 <= x0 || y1 <= y0)
+                continue;
+
+            for (uint32_t i = 0; i < cmd.ElemCount; i += 3)
+            {
+                auto& a = list->VtxBuffer[cmd.VtxOffset + list->IdxBuffer[cmd.IdxOffset + i]].pos;
+                auto& b = list->VtxBuffer[cmd.VtxOffset + list->IdxBuffer[cmd.IdxOffset + i + 1]].pos;
+                auto& c = list->VtxBuffer[cmd.VtxOffset + list->IdxBuffer[cmd.IdxOffset + i + 2]].pos;
+                result.emplace_back(a.x, a.y, b.x, b.y, c.x, c.y, cmd.GetTexID(), x0, y0, x1, y1);
+            }
+        }
+    }
+
+    return result;
+}
+
+struct TestRenderer
+{
+    std::vector<ImDrawVert> Vtx;
+    std::vector<ImDrawIdx> Idx;
+    std::vector<Triangle> Drawn;
+    int Calls = 0;
+};
+
+static void DrawRetained(const ImDrawList*, const ImDrawCmd* InCmd)
+{
+    auto context = (const RetainedDrawData::Context*) InCmd->UserCallbackData;
+    auto renderer = (TestRenderer*) context->Renderer;
+    renderer->Calls++;
+
+    RetainedDrawData::Scissor scissor;
+
+    for (const auto& command : context->Owner->Commands())
+    {
+        if (!context->Owner->CommandScissor(command, scissor))
+            continue;
+
+        for (uint32_t i = 0; i < command.ElemCount; i += 3)
+        {
+            auto& a = renderer->Vtx[command.VtxOffset + renderer->Idx[command.IdxOffset + i]].pos;
+            auto& b = renderer->Vtx[command.VtxOffset + renderer->Idx[command.IdxOffset + i + 1]].pos;
+            auto& c = renderer->Vtx[command.VtxOffset + renderer->Idx[command.IdxOffset + i + 2]].pos;
+            renderer->Drawn.emplace_back(a.x, a.y, b.x, b.y, c.x, c.y, command.TexRef.GetTexID(), scissor.X0,
+                                         scissor.Y0, scissor.X1, scissor.Y1);
+        }
+    }
+}
+
+// Update, upload on change and draw the replay like the overlay renderers
+static std::vector<Triangle> DrawReplay(RetainedDrawData& InRetained, TestRenderer& InRenderer, ImDrawData* InData,
+                                        int InFrame)
+{
+    if (InRetained.Update(InData, InFrame) == RetainedDrawData::Changed)
+    {
+        InRenderer.Vtx.resize(InData->TotalVtxCount);
+        InRenderer.Idx.resize(InData->TotalIdxCount);
+        RetainedDrawData::CopyBuffers(InData, InRenderer.Vtx.data(), InRenderer.Idx.data());
+    }
+
+    auto replay = InRetained.Replay(DrawRetained, &InRenderer);
+
+    EXPECT_EQ(replay->TotalVtxCount, 0);
+    EXPECT_EQ(replay->TotalIdxCount, 0);
+
+    InRenderer.Drawn.clear();
+
+    for (int n = 0; n < replay->CmdListsCount; n++)
+    {
+        for (const auto& cmd : replay->CmdLists[n]->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                cmd.UserCallback(replay->CmdLists[n], &cmd);
+        }
+    }
+
+    return InRenderer.Drawn;
+}
+
+TEST(RetainedDrawData, SameFrameIsNotHashedAgain)
+{
+    TestDrawData draw;
+    auto list = draw.AddList();
+    draw.AddQuad(list, { 10, 10 }, { 100, 40 }, 1, { 0, 0, 640, 480 });
+
+    RetainedDrawData retained;
+
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Changed);
+
+    // Retained overlay frame, ImGui frame count doesn't move
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Unchanged);
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Unchanged);
+
+    EXPECT_EQ(retained.Uploads(), 1u);
+    EXPECT_EQ(retained.Replays(), 2u);
+}
+
+TEST(RetainedDrawData, RebuiltFrameIsComparedByContent)
+{
+    TestDrawData draw;
+    auto list = draw.AddList();
+    draw.AddQuad(list, { 10, 10 }, { 100, 40 }, 1, { 0, 0, 640, 480 });
+
+    RetainedDrawData retained;
+
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Changed);
+
+    // New frame with identical output
+    EXPECT_EQ(retained.Update(&draw.Data, 2), RetainedDrawData::Unchanged);
+
+    list->VtxBuffer[2].pos.x += 1.0f;
+    EXPECT_EQ(retained.Update(&draw.Data, 3), RetainedDrawData::Changed);
+
+    list->CmdBuffer[0].TexRef = ImTextureRef((ImTextureID) 2);
+    EXPECT_EQ(retained.Update(&draw.Data, 4), RetainedDrawData::Changed);
+
+    list->CmdBuffer[0].ClipRect.z = 320.0f;
+    EXPECT_EQ(retained.Update(&draw.Data, 5), RetainedDrawData::Changed);
+
+    draw.Data.DisplaySize.x = 800.0f;
+    EXPECT_EQ(retained.Update(&draw.Data, 6), RetainedDrawData::Changed);
+
+    EXPECT_EQ(retained.Update(&draw.Data, 7), RetainedDrawData::Unchanged);
+    EXPECT_EQ(retained.Uploads(), 5u);
+}
+
+TEST(RetainedDrawData, InvalidateForcesUpload)
+{
+    TestDrawData draw;
+    draw.AddQuad(draw.AddList(), { 10, 10 }, { 100, 40 }, 1, { 0, 0, 640, 480 });
+
+    RetainedDrawData retained;
+
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Changed);
+    retained.Invalidate();
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Changed);
+}
+
+static void UserCallback(const ImDrawList*, const ImDrawCmd*) {}
+
+TEST(RetainedDrawData, UserCallbacksAreNotRetained)
+{
+    TestDrawData draw;
+    auto list = draw.AddList();
+    draw.AddQuad(list, { 10, 10 }, { 100, 40 }, 1, { 0, 0, 640, 480 });
+
+    RetainedDrawData retained;
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::Changed);
+
+    draw.AddCallback(list, UserCallback);
+    EXPECT_EQ(retained.Update(&draw.Data, 1), RetainedDrawData::NotRetainable);
+
+    // Reset state callbacks are fine, replay sets the state itself
+    list->CmdBuffer.back().UserCallback = ImDrawCallback_ResetRenderState;
+    EXPECT_EQ(retained.Update(&draw.Data, 2), RetainedDrawData::Changed);
+    EXPECT_EQ(retained.Commands().size(), 1u);
+}
+
+TEST(RetainedDrawData, ReplayDrawsSameTrianglesAsBackend)
+{
+    TestDrawData draw;
+    draw.Data.DisplayPos = { 100.0f, 50.0f };
+
+    auto first = draw.AddList();
+    draw.AddQuad(first, { 110, 60 }, { 300, 90 }, 1, { 100, 50, 740, 530 });
+    draw.AddQuad(first, { 110, 100 }, { 300, 130 }, 2, { 100, 50, 200, 530 });
+
+    auto second = draw.AddList();
+    draw.AddCallback(second, ImDrawCallback_ResetRenderState);
+    draw.AddQuad(second, { 50, 0 }, { 900, 700 }, 1, { 0, 0, 1000, 1000 });
+
+    // Outside of the framebuffer, skipped by both
+    draw.AddQuad(second, { 0, 0 }, { 10, 10 }, 1, { 0, 0, 90, 40 });
+
+    RetainedDrawData retained;
+    TestRenderer renderer;
+
+    auto expected = DrawDirect(&draw.Data);
+    ASSERT_EQ(expected.size(), 6u);
+
+    EXPECT_EQ(DrawReplay(retained, renderer, &draw.Data, 1), expected);
+    EXPECT_EQ(renderer.Calls, 1);
+
+    // Retained frame draws from renderer's buffers without uploading
+    renderer.Vtx.push_back({});
+    EXPECT_EQ(DrawReplay(retained, renderer, &draw.Data, 1), expected);
+    EXPECT_EQ(retained.Uploads(), 1u);
+
+    second->VtxBuffer[0].pos.y = 20.0f;
+    EXPECT_NE(DrawDirect(&draw.Data), expected);
+    EXPECT_EQ(DrawReplay(retained, renderer, &draw.Data, 2), DrawDirect(&draw.Data));
+    EXPECT_EQ(retained.Uploads(), 2u);
+}
+
+TEST(RetainedDrawData, ReplayKeepsBackendInputs)
+{
+    TestDrawData draw;
+    draw.Data.FramebufferScale = { 2.0f, 2.0f };
+    draw.AddQuad(draw.AddList(), { 10, 10 }, { 100, 40 }, 1, { 0, 0, 640, 480 });
+
+    ImVector<ImTextureData*> textures;
+    draw.Data.Textures = &textures;
+
+    RetainedDrawData retained;
+    TestRenderer renderer;
+
+    retained.Update(&draw.Data, 1);
+    auto replay = retained.Replay(DrawRetained, &renderer);
+
+    EXPECT_TRUE(replay->Valid);
+    EXPECT_EQ(replay->Textures, &textures);
+    EXPECT_EQ(replay->DisplaySize.x, 640.0f);
+    EXPECT_EQ(replay->FramebufferScale.x, 2.0f);
+
+    RetainedDrawData::Scissor scissor;
+    ASSERT_TRUE(retained.CommandScissor(retained.Commands()[0], scissor));
+    EXPECT_EQ(scissor.X1, 1280);
+    EXPECT_EQ(scissor.Y1, 960);
+}
@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <misc/FileIndex.h>
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// Search of Util::FindFilePath before FileIndex, one walk per query
+static FileIndex::Result WalkFind(const fs::path& InRoot, const fs::path& InFileName)
+{
+    for (const auto& entry : fs::recursive_directory_iterator(InRoot, fs::directory_options::skip_permission_denied))
+    {
+        if (!entry.is_directory() && entry.path().filename() == InFileName)
+            return entry.path();
+    }
+
+    return std::nullopt;
+}
+
+static void Touch(const fs::path& InPath)
+{
+    fs::create_directories(InPath.parent_path());
+    std::ofstream file(InPath);
+}
+
+class FileIndexTest : public ::testing::Test
+{
+  protected:
+    fs::path Root;
+    fs::path CachePath;
+
+    // Game install with pak chunks, UE plugin binaries deep in the tree and a file below the depth limit
+    void MakeTree(uint32_t InFolders, uint32_t InFilesPerFolder)
+    {
+        for (uint32_t a = 0; a < InFolders; a++)
+        {
+            for (uint32_t b = 0; b < InFolders; b++)
+            {
+                auto folder = Root / ("Content" + std::to_string(a)) / ("Paks" + std::to_string(b));
+                fs::create_directories(folder);
+
+                for (uint32_t f = 0; f < InFilesPerFolder; f++)
+                    std::ofstream(folder / ("chunk" + std::to_string(f) + ".pak"));
+            }
+        }
+
+        auto plugin = Root / "Engine" / "Plugins" / "Runtime" / "Nvidia" / "DLSS" / "Binaries" / "ThirdParty" / "Win64";
+        Touch(plugin / "nvngx_dlss.dll");
+        Touch(plugin / "nvngx_dlssg.dll");
+        Touch(Root / "x" / "1" / "2" / "3" / "4" / "5" / "6" / "7" / "8" / "9" / "10" / "11" / "12" / "deep.dll");
+    }
+
+    void SetUp() override
+    {
+        auto name = std::string(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        Root = fs::temp_directory_path() / ("optiscaler_fileindex_" + name);
+        CachePath = fs::temp_directory_path() / ("optiscaler_fileindex_" + name + ".cache");
+        fs::remove_all(Root);
+        fs::remove(CachePath);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(Root);
+        fs::remove(CachePath);
+    }
+};
+
+TEST_F(FileIndexTest, SameResultsAsWalk)
+{
+    MakeTree(4, 10);
+
+    FileIndex index(Root);
+    index.Watch({ "nvngx_dlss.dll", "nvngx_dlssd.dll", "nvngx_dlssg.dll" });
+
+    EXPECT_EQ(index.Find("nvngx_dlss.dll"), WalkFind(Root, "nvngx_dlss.dll"));
+    EXPECT_EQ(index.Find("nvngx_dlssd.dll"), std::nullopt);
+    EXPECT_EQ(index.Find("NVNGX_DLSSG.DLL"), WalkFind(Root, "nvngx_dlssg.dll"));
+    ASSERT_TRUE(index.Find("nvngx_dlss.dll").has_value());
+
+    // Watched names share the first walk
+    EXPECT_EQ(index.WalkCount(), 1u);
+
+    for (int i = 0; i < 100; i++)
+        index.Find("nvngx_dlssd.dll");
+
+    EXPECT_EQ(index.WalkCount(), 1u);
+
+    // Multi name query, one more walk for the new names only
+    auto results = index.Find(std::vector<fs::path> { "chunk3.pak", "other.txt", "nvngx_dlss.dll" });
+    EXPECT_EQ(index.WalkCount(), 2u);
+    ASSERT_EQ(results.size(), 3u);
+    ASSERT_TRUE(results[0].has_value());
+    EXPECT_EQ(results[0]->filename(), "chunk3.pak");
+    EXPECT_FALSE(results[1].has_value());
+    EXPECT_EQ(results[2], WalkFind(Root, "nvngx_dlss.dll"));
+}
+
+TEST_F(FileIndexTest, DepthLimit)
+{
+    MakeTree(1, 1);
+
+    FileIndex index(Root);
+    EXPECT_FALSE(index.Find("deep.dll").has_value());
+
+    FileIndex deeper(Root, 20);
+    EXPECT_EQ(deeper.Find("deep.dll"), WalkFind(Root, "deep.dll"));
+
+    FileIndex missing(Root / "missing");
+    EXPECT_FALSE(missing.Find("nvngx_dlss.dll").has_value());
+}
+
+TEST_F(FileIndexTest, Cache)
+{
+    MakeTree(3, 5);
+    std::vector<fs::path> names { "nvngx_dlss.dll", "nvngx_dlssd.dll", "nvngx_dlssg.dll" };
+
+    {
+        FileIndex index(Root);
+        index.Watch(names);
+        EXPECT_FALSE(index.SetCacheFile(CachePath));
+        index.Find("nvngx_dlss.dll");
+        EXPECT_TRUE(fs::exists(CachePath));
+    }
+
+    {
+        FileIndex index(Root);
+        EXPECT_TRUE(index.SetCacheFile(CachePath));
+        EXPECT_TRUE(index.LoadedFromCache());
+
+        EXPECT_EQ(index.Find("nvngx_dlss.dll"), WalkFind(Root, "nvngx_dlss.dll"));
+        EXPECT_FALSE(index.Find("nvngx_dlssd.dll").has_value());
+        EXPECT_EQ(index.Find("nvngx_dlssg.dll"), WalkFind(Root, "nvngx_dlssg.dll"));
+        EXPECT_EQ(index.WalkCount(), 0u);
+    }
+
+    // Other depth or root doesn't use the cache
+    EXPECT_FALSE(FileIndex(Root, 5).SetCacheFile(CachePath));
+    EXPECT_FALSE(FileIndex(Root / "Engine").SetCacheFile(CachePath));
+
+    // Added file changes the time of its folder
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Touch(Root / "Content1" / "Paks2" / "nvngx_dlssd.dll");
+
+    {
+        FileIndex index(Root);
+        EXPECT_FALSE(index.SetCacheFile(CachePath));
+        EXPECT_TRUE(index.Find("nvngx_dlssd.dll").has_value());
+        EXPECT_EQ(index.WalkCount(), 1u);
+    }
+
+    {
+        FileIndex index(Root);
+        EXPECT_TRUE(index.SetCacheFile(CachePath));
+        EXPECT_TRUE(index.Find("nvngx_dlssd.dll").has_value());
+        EXPECT_EQ(index.WalkCount(), 0u);
+    }
+}
+
+#ifndef _WIN32
+// Walk which stops on an error must not turn names it didn't reach into cached misses
+TEST_F(FileIndexTest, FailedWalkIsNotFinal)
+{
+    MakeTree(2, 2);
+
+    FileIndex index(Root);
+    EXPECT_FALSE(index.SetCacheFile(CachePath));
+
+    rlimit limit;
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+
+    // Only a few free handles, iterator keeps one open per folder level and fails a few levels down
+    auto lowest = dup(0);
+    ASSERT_GE(lowest, 0);
+    close(lowest);
+
+    auto reduced = limit;
+    reduced.rlim_cur = lowest + 3;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &reduced), 0);
+
+    auto results = index.Find(std::vector<fs::path> { "nvngx_dlss.dll", "chunk0.pak" });
+
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+
+    EXPECT_EQ(index.WalkCount(), 1u);
+    EXPECT_FALSE(results[0].has_value());
+    EXPECT_FALSE(fs::exists(CachePath));
+
+    // Walked again and found once handles are available
+    EXPECT_EQ(index.Find("nvngx_dlss.dll"), WalkFind(Root, "nvngx_dlss.dll"));
+    EXPECT_TRUE(index.Find("nvngx_dlss.dll").has_value());
+    EXPECT_EQ(index.WalkCount(), 2u);
+    EXPECT_TRUE(fs::exists(CachePath));
+
+    // Names found before the error are kept, depends on the folder order of the file system
+    if (results[1].has_value())
+    {
+        EXPECT_EQ(index.Find("chunk0.pak"), results[1]);
+    }
+
+    EXPECT_TRUE(index.Find("chunk0.pak").has_value());
+    EXPECT_EQ(index.WalkCount(), 2u);
+}
+#endif
+
+// Cost of repeated walks against the index on a large generated tree, timings are written as test properties
+TEST_F(FileIndexTest, DISABLED_GeneratedTreeBenchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // 16 * 16 folders with 80 files each, ~20k files
+    MakeTree(16, 80);
+    std::vector<fs::path> names { "nvngx_dlss.dll", "nvngx_dlssd.dll", "nvngx_dlssg.dll", "libxess.dll",
+                                  "amd_fidelityfx_dx12.dll" };
+
+    auto start = Clock::now();
+    std::vector<FileIndex::Result> walked;
+
+    for (const auto& name : names)
+        walked.push_back(WalkFind(Root, name));
+
+    auto walkTime = Clock::now() - start;
+
+    start = Clock::now();
+    FileIndex index(Root);
+    index.Watch(names);
+    std::vector<FileIndex::Result> indexed;
+
+    for (const auto& name : names)
+        indexed.push_back(index.Find(name));
+
+    auto indexTime = Clock::now() - start;
+
+    EXPECT_EQ(indexed, walked);
+    EXPECT_EQ(index.WalkCount(), 1u);
+
+    start = Clock::now();
+
+    for (int i = 0; i < 1000; i++)
+        index.Find(names[i % names.size()]);
+
+    auto cachedTime = Clock::now() - start;
+
+    // Persisted index of the next start
+    index.SetCacheFile(CachePath);
+    index.Find("other.dll");
+
+    start = Clock::now();
+    FileIndex loaded(Root);
+    EXPECT_TRUE(loaded.SetCacheFile(CachePath));
+
+    for (const auto& name : names)
+        loaded.Find(name);
+
+    auto loadTime = Clock::now() - start;
+    EXPECT_EQ(loaded.WalkCount(), 0u);
+
+    auto ms = [](Clock::duration InTime) { return std::chrono::duration<double, std::milli>(InTime).count(); };
+
+    RecordProperty("walk_ms", std::to_string(ms(walkTime)));
+    RecordProperty("index_ms", std::to_string(ms(indexTime)));
+    RecordProperty("indexed_queries_ms", std::to_string(ms(cachedTime)));
+    RecordProperty("from_cache_ms", std::to_string(ms(loadTime)));
+}
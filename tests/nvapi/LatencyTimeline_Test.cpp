@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+
+#include <nvapi/LatencyTimeline.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using Timeline = LatencyTimeline;
+
+// Markers in the order ReflexHooks receives them, SetLatencyMarker and SetAsyncFrameMarker share the stream
+struct TraceMarker
+{
+    uint64_t FrameId;
+    uint32_t Marker;
+    uint64_t TimeUs;
+};
+
+static void Replay(Timeline& InTimeline, const std::vector<TraceMarker>& InTrace)
+{
+    for (const auto& marker : InTrace)
+        InTimeline.Record(marker.FrameId, marker.Marker, marker.TimeUs);
+}
+
+// DX12 Streamline game with DLSSG at a 60 fps cap. Input is sampled after simulation start, render submit of a frame
+// ends after simulation of the next one started. Out of band presents of the generated and the real frame both use
+// the id of the real frame and the real one is presented after the next frame started.
+static const std::vector<TraceMarker> DlssgTrace = {
+    { 100, Timeline::SimulationStart, 1000 },
+    { 100, Timeline::InputSample, 1200 },
+    { 100, Timeline::SimulationEnd, 4000 },
+    { 100, Timeline::RenderSubmitStart, 4100 },
+    { 100, Timeline::OutOfBandRenderSubmitStart, 4150 },
+    { 100, Timeline::PresentStart, 6650 },
+    { 100, Timeline::RenderSubmitEnd, 6600 },
+    { 100, Timeline::PresentEnd, 7050 },
+    { 100, Timeline::OutOfBandRenderSubmitEnd, 7900 },
+    { 100, Timeline::OutOfBandPresentStart, 9333 },
+    { 100, Timeline::OutOfBandPresentEnd, 9433 },
+    { 101, Timeline::SimulationStart, 17667 },
+    { 101, Timeline::InputSample, 17867 },
+    { 100, Timeline::OutOfBandPresentStart, 18167 },
+    { 100, Timeline::OutOfBandPresentEnd, 18267 },
+    { 101, Timeline::SimulationEnd, 20667 },
+    { 101, Timeline::RenderSubmitStart, 20767 },
+    { 101, Timeline::OutOfBandRenderSubmitStart, 20817 },
+    { 101, Timeline::RenderSubmitEnd, 23267 },
+    { 101, Timeline::PresentStart, 23317 },
+    { 101, Timeline::PresentEnd, 23717 },
+    { 101, Timeline::OutOfBandRenderSubmitEnd, 24567 },
+    { 101, Timeline::OutOfBandPresentStart, 26000 },
+    { 101, Timeline::OutOfBandPresentEnd, 26100 },
+    { 102, Timeline::SimulationStart, 34334 },
+    { 102, Timeline::InputSample, 34534 },
+    { 101, Timeline::OutOfBandPresentStart, 34834 },
+    { 101, Timeline::OutOfBandPresentEnd, 34934 },
+    { 102, Timeline::SimulationEnd, 37334 },
+    { 102, Timeline::RenderSubmitStart, 37434 },
+    { 102, Timeline::OutOfBandRenderSubmitStart, 37484 },
+    { 102, Timeline::RenderSubmitEnd, 39934 },
+    { 102, Timeline::PresentStart, 39984 },
+    { 102, Timeline::PresentEnd, 40384 },
+    { 102, Timeline::OutOfBandRenderSubmitEnd, 41234 },
+    { 102, Timeline::OutOfBandPresentStart, 42667 },
+    { 102, Timeline::OutOfBandPresentEnd, 42767 },
+    { 103, Timeline::SimulationStart, 51001 },
+    { 102, Timeline::OutOfBandPresentStart, 51501 },
+    { 102, Timeline::OutOfBandPresentEnd, 51601 },
+};
+
+// Longer trace of the same game, render submit and present vary by frame and FG can be turned off
+static std::vector<TraceMarker> GeneratedTrace(uint64_t InFirstId, uint32_t InFrames, uint64_t InStartUs,
+                                               uint32_t InIntervalUs, bool InFrameGeneration, uint32_t InSeed)
+{
+    std::mt19937 random(InSeed);
+    std::vector<TraceMarker> trace;
+
+    for (uint32_t i = 0; i < InFrames; i++)
+    {
+        auto id = InFirstId + i;
+        auto start = InStartUs + (uint64_t) i * InIntervalUs;
+        auto submitUs = 2000 + random() % 1000;
+        auto presentUs = 200 + random() % 400;
+
+        trace.push_back({ id, Timeline::SimulationStart, start });
+        trace.push_back({ id, Timeline::SimulationEnd, start + 3000 });
+        trace.push_back({ id, Timeline::RenderSubmitStart, start + 3100 });
+        trace.push_back({ id, Timeline::RenderSubmitEnd, start + 3100 + submitUs });
+        trace.push_back({ id, Timeline::PresentStart, start + 3150 + submitUs });
+        trace.push_back({ id, Timeline::PresentEnd, start + 3150 + submitUs + presentUs });
+
+        trace.push_back({ id, Timeline::OutOfBandPresentStart, start + InIntervalUs / 2 });
+
+        if (InFrameGeneration)
+            trace.push_back({ id, Timeline::OutOfBandPresentStart, start + InIntervalUs + 500 });
+    }
+
+    return trace;
+}
+
+TEST(LatencyTimeline, DlssgTrace)
+{
+    Timeline timeline;
+    Replay(timeline, DlssgTrace);
+
+    // Frame 103 is still in flight
+    EXPECT_EQ(timeline.CompletedCount(), 3u);
+    EXPECT_EQ(timeline.HistoryCount(), 3u);
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+
+    Timeline::FrameStats stats;
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.FrameId, 102u);
+    EXPECT_EQ(stats.Us[Timeline::Simulation], 3000u);
+    EXPECT_EQ(stats.Us[Timeline::RenderSubmit], 2500u);
+    EXPECT_EQ(stats.Us[Timeline::Present], 400u);
+    EXPECT_EQ(stats.Us[Timeline::Latency], 6050u);
+    EXPECT_EQ(stats.Us[Timeline::Interval], 16667u);
+
+    // First frame has no interval, it's left out
+    EXPECT_EQ(timeline.Percentile(Timeline::Interval, 0), 16667u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 50), 6050u);
+
+    // Generated and real frame presented with the same id
+    EXPECT_FLOAT_EQ(timeline.PresentsPerFrame(), 2.0f);
+}
+
+TEST(LatencyTimeline, FrameGenerationToggled)
+{
+    Timeline timeline;
+    EXPECT_EQ(timeline.PresentsPerFrame(), 0.0f);
+
+    Replay(timeline, GeneratedTrace(1, 200, 1000, 16667, true, 1));
+    EXPECT_NEAR(timeline.PresentsPerFrame(), 2.0f, 0.05f);
+
+    // Out of band presents are counted by id changes, ring of the last presents
+    Replay(timeline, GeneratedTrace(201, Timeline::PresentHistorySize, 1000 + 200 * 16667ull, 16667, false, 2));
+    EXPECT_FLOAT_EQ(timeline.PresentsPerFrame(), 1.0f);
+
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+    EXPECT_EQ(timeline.CompletedCount(), 200u + Timeline::PresentHistorySize);
+
+    // Streamline numbering its own out of band presents never restarts the timeline
+    for (uint64_t i = 0; i < 64; i++)
+    {
+        timeline.Record(900'000 + i, Timeline::OutOfBandPresentStart, 0);
+        timeline.Record(900'000 + i, Timeline::OutOfBandPresentStart, 0);
+    }
+
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+    EXPECT_FLOAT_EQ(timeline.PresentsPerFrame(), 2.0f);
+
+    // Game without out of band markers (Vulkan, no FG)
+    Timeline vulkan;
+    auto trace = GeneratedTrace(1, 100, 1000, 16667, false, 3);
+    trace.erase(std::remove_if(trace.begin(), trace.end(),
+                               [](const TraceMarker& marker) { return marker.Marker > Timeline::PresentEnd; }),
+                trace.end());
+    Replay(vulkan, trace);
+
+    EXPECT_EQ(vulkan.PresentsPerFrame(), 0.0f);
+    EXPECT_EQ(vulkan.CompletedCount(), 100u);
+    EXPECT_EQ(vulkan.Percentile(Timeline::Interval, 50), 16667u);
+}
+
+TEST(LatencyTimeline, Restarts)
+{
+    Timeline timeline;
+    Replay(timeline, GeneratedTrace(5000, 50, 1000, 10000, false, 4));
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+
+    // Level load, frame ids start over. History is kept, interval isn't measured across the restart.
+    Replay(timeline, GeneratedTrace(1, 1, 5'000'000, 10000, false, 5));
+    EXPECT_EQ(timeline.RestartCount(), 1u);
+    EXPECT_EQ(timeline.HistoryCount(), 51u);
+
+    Timeline::FrameStats stats;
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.FrameId, 1u);
+    EXPECT_EQ(stats.Us[Timeline::Interval], 0u);
+    EXPECT_NE(stats.Us[Timeline::Latency], 0u);
+
+    Replay(timeline, GeneratedTrace(2, 1, 5'010'000, 10000, false, 6));
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.Us[Timeline::Interval], 10000u);
+
+    // Far jump ahead
+    timeline.Record(10'000, Timeline::SimulationStart, 6'000'000);
+    EXPECT_EQ(timeline.RestartCount(), 2u);
+
+    // Small jumps ahead are dropped frames, a late marker of a recent frame isn't a restart
+    timeline.Record(10'100, Timeline::SimulationStart, 6'100'000);
+    timeline.Record(10'095, Timeline::PresentEnd, 6'100'100);
+    EXPECT_EQ(timeline.RestartCount(), 2u);
+
+    timeline.Reset();
+    EXPECT_EQ(timeline.HistoryCount(), 0u);
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+    EXPECT_FALSE(timeline.Last(stats));
+}
+
+TEST(LatencyTimeline, MissingAndRepeatedMarkers)
+{
+    Timeline timeline;
+
+    // Present only, no simulation markers
+    timeline.Record(1, Timeline::PresentStart, 1000);
+    timeline.Record(1, Timeline::PresentEnd, 1500);
+
+    Timeline::FrameStats stats;
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.Us[Timeline::Present], 500u);
+    EXPECT_EQ(stats.Us[Timeline::Simulation], 0u);
+    EXPECT_EQ(stats.Us[Timeline::Latency], 0u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 50), 0u);
+
+    // First start and last end are kept
+    timeline.Record(2, Timeline::SimulationStart, 2000);
+    timeline.Record(2, Timeline::SimulationStart, 2500);
+    timeline.Record(2, Timeline::SimulationEnd, 2800);
+    timeline.Record(2, Timeline::SimulationEnd, 3000);
+    timeline.Record(2, Timeline::PresentEnd, 4000);
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.Us[Timeline::Simulation], 1000u);
+    EXPECT_EQ(stats.Us[Timeline::Latency], 2000u);
+
+    // End before start is a broken pair
+    timeline.Record(3, Timeline::RenderSubmitStart, 5000);
+    timeline.Record(3, Timeline::RenderSubmitEnd, 4000);
+    timeline.Record(3, Timeline::PresentEnd, 6000);
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.Us[Timeline::RenderSubmit], 0u);
+
+    // Frame which never presents is dropped when its slot is reused
+    timeline.Record(4, Timeline::SimulationStart, 7000);
+    timeline.Record(4 + Timeline::MaxFrames, Timeline::SimulationStart, 8000);
+    timeline.Record(4 + Timeline::MaxFrames, Timeline::PresentEnd, 9000);
+    ASSERT_TRUE(timeline.Last(stats));
+    EXPECT_EQ(stats.FrameId, 4 + Timeline::MaxFrames);
+    EXPECT_EQ(stats.Us[Timeline::Latency], 1000u);
+    EXPECT_EQ(timeline.CompletedCount(), 4u);
+
+    // Markers outside of the frame timeline
+    timeline.Record(30, Timeline::TriggerFlash, 10000);
+    timeline.Record(30, Timeline::PcLatencyPing, 10000);
+    timeline.Record(30, 99, 10000);
+    EXPECT_EQ(timeline.CompletedCount(), 4u);
+    EXPECT_EQ(timeline.RestartCount(), 0u);
+}
+
+TEST(LatencyTimeline, Percentiles)
+{
+    Timeline timeline;
+
+    for (uint64_t i = 1; i <= 100; i++)
+    {
+        timeline.Record(i, Timeline::SimulationStart, i * 10000);
+        timeline.Record(i, Timeline::PresentEnd, i * 10000 + i * 10);
+    }
+
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 0), 10u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 50), 500u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 99), 990u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 100), 1000u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 150), 1000u);
+
+    // Newest frames only
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 50, 10), 950u);
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 0, 1), 1000u);
+    EXPECT_EQ(timeline.Percentile(Timeline::MetricCount, 50), 0u);
+
+    // History wraps
+    for (uint64_t i = 101; i <= 100 + Timeline::HistorySize; i++)
+    {
+        timeline.Record(i, Timeline::SimulationStart, i * 10000);
+        timeline.Record(i, Timeline::PresentEnd, i * 10000 + 100);
+    }
+
+    EXPECT_EQ(timeline.Percentile(Timeline::Latency, 100), 100u);
+    EXPECT_EQ(timeline.HistoryCount(), Timeline::HistorySize);
+}
+
+// Cost of a marker and of the percentiles the controller reads every frame, timings are written as test properties
+TEST(LatencyTimeline, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto trace = GeneratedTrace(1, 100000, 1000, 16667, true, 7);
+    Timeline timeline;
+
+    auto start = Clock::now();
+    Replay(timeline, trace);
+    auto recordTime = Clock::now() - start;
+
+    EXPECT_EQ(timeline.CompletedCount(), 100000u);
+
+    uint64_t sum = 0;
+    start = Clock::now();
+
+    for (int i = 0; i < 100000; i++)
+        sum += timeline.Percentile((Timeline::Metric) (i % Timeline::MetricCount), 50, 30);
+
+    auto percentileTime = Clock::now() - start;
+    EXPECT_NE(sum, 0u);
+
+    auto ns = [](Clock::duration InTime, size_t InCount)
+    { return std::chrono::duration<double, std::nano>(InTime).count() / InCount; };
+    RecordProperty("record_ns_per_marker", std::to_string(ns(recordTime, trace.size())));
+    RecordProperty("percentile_30_frames_ns", std::to_string(ns(percentileTime, 100000)));
+}
@@ -0,0 +1,309 @@
+#include <gtest/gtest.h>
+
+#include <nvapi/SleepIntervalController.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using Timeline = LatencyTimeline;
+
+// Game paced by Reflex sleep with a render queue of two frames. Simulation of a frame starts after the injected
+// interval or when the present of the previous frame returns, present blocks while two frames wait for the GPU.
+// Markers are recorded like ReflexHooks does and the latency the GPU adds is tracked, markers can't see it.
+class SimulatedGame
+{
+  public:
+    double GpuUs;
+    double Noise = 0.0; // Relative, uniform
+    double SimulationUs = 2000;
+    double SubmitUs = 1000;
+    uint32_t QueueDepth = 2;
+
+    explicit SimulatedGame(double InGpuUs, double InNoise = 0.0, uint32_t InSeed = 1)
+        : GpuUs(InGpuUs), Noise(InNoise), _random(InSeed)
+    {
+    }
+
+    // Returns simulation start to GPU end of the frame
+    double Frame(Timeline& InTimeline, uint32_t InIntervalUs)
+    {
+        auto vary = [this](double InUs) { return InUs * (1.0 + _noise(_random) * Noise); };
+        auto id = ++_frameId;
+
+        double start = std::max(_presentReturned, _lastStart + InIntervalUs);
+        _lastStart = start;
+
+        double simulationEnd = start + vary(SimulationUs);
+        double submitEnd = simulationEnd + vary(SubmitUs);
+        double presentEnd = submitEnd;
+
+        if (_gpuEnds.size() >= QueueDepth)
+            presentEnd = std::max(submitEnd, _gpuEnds[_gpuEnds.size() - QueueDepth]);
+
+        InTimeline.Record(id, Timeline::SimulationStart, (uint64_t) start);
+        InTimeline.Record(id, Timeline::SimulationEnd, (uint64_t) simulationEnd);
+        InTimeline.Record(id, Timeline::RenderSubmitStart, (uint64_t) simulationEnd);
+        InTimeline.Record(id, Timeline::RenderSubmitEnd, (uint64_t) submitEnd);
+        InTimeline.Record(id, Timeline::PresentStart, (uint64_t) submitEnd);
+        InTimeline.Record(id, Timeline::PresentEnd, (uint64_t) presentEnd);
+
+        double gpuStart = std::max(submitEnd, _gpuEnds.empty() ? 0.0 : _gpuEnds.back());
+        _gpuEnds.push_back(gpuStart + vary(GpuUs));
+        _presentReturned = presentEnd;
+
+        return _gpuEnds.back() - start;
+    }
+
+    double LastStart() const { return _lastStart; }
+
+  private:
+    std::mt19937 _random;
+    std::uniform_real_distribution<double> _noise { -1.0, 1.0 };
+    std::vector<double> _gpuEnds;
+    double _presentReturned = 0;
+    double _lastStart = 0;
+    uint64_t _frameId = 0;
+};
+
+struct RunResult
+{
+    double FrameUs = 0;      // Average over the measured frames
+    double LatencyUs = 0;    // Average simulation start to GPU end
+    double QueuedShare = 0;  // Frames with a latency over two GPU frames
+    uint32_t Raises = 0;     // Interval went up
+    uint32_t Reversals = 0;  // Interval went down after going up
+    uint32_t MinIntervalUs = UINT32_MAX;
+    uint32_t MaxIntervalUs = 0;
+    std::vector<uint32_t> RaiseFrames;
+};
+
+// Frames before InMeasureFrom are warm up, only the interval is applied
+static RunResult RunGame(SimulatedGame& InGame, Timeline& InTimeline, SleepIntervalController* InController,
+                         uint32_t InTargetUs, uint32_t InFrames, uint32_t InMeasureFrom)
+{
+    RunResult result;
+    uint32_t interval = InTargetUs;
+    uint32_t previous = interval;
+    bool rising = false;
+    double firstStart = 0;
+    uint32_t measured = 0;
+
+    for (uint32_t i = 0; i < InFrames; i++)
+    {
+        auto latency = InGame.Frame(InTimeline, interval);
+
+        if (InController != nullptr)
+            interval = InController->Update(InTimeline);
+
+        if (i < InMeasureFrom)
+        {
+            previous = interval;
+            continue;
+        }
+
+        if (measured++ == 0)
+            firstStart = InGame.LastStart();
+
+        result.LatencyUs += latency;
+        result.QueuedShare += latency > 2 * InGame.GpuUs ? 1 : 0;
+        result.MinIntervalUs = std::min(result.MinIntervalUs, interval);
+        result.MaxIntervalUs = std::max(result.MaxIntervalUs, interval);
+
+        if (interval > previous)
+        {
+            result.Raises++;
+            result.RaiseFrames.push_back(i);
+            rising = true;
+        }
+        else if (interval < previous && rising)
+        {
+            result.Reversals++;
+            rising = false;
+        }
+
+        previous = interval;
+    }
+
+    result.FrameUs = (InGame.LastStart() - firstStart) / (measured - 1);
+    result.LatencyUs /= measured;
+    result.QueuedShare /= measured;
+
+    return result;
+}
+
+static constexpr uint32_t TargetUs = 16667;
+
+TEST(SleepIntervalController, Disabled)
+{
+    Timeline timeline;
+    SleepIntervalController controller;
+    EXPECT_EQ(controller.Update(timeline), 0u);
+
+    controller.SetTarget(TargetUs);
+    EXPECT_EQ(controller.Update(timeline), TargetUs);
+
+    SimulatedGame game(30000);
+    RunGame(game, timeline, &controller, TargetUs, 300, 0);
+    EXPECT_GT(controller.Interval(), TargetUs);
+
+    // New target starts over
+    controller.SetTarget(8000);
+    EXPECT_EQ(controller.Interval(), 8000u);
+    EXPECT_EQ(controller.Floor(), 0u);
+
+    controller.SetTarget(0);
+    EXPECT_EQ(controller.Update(timeline), 0u);
+}
+
+TEST(SleepIntervalController, MissingMarkersStayAtTarget)
+{
+    Timeline timeline;
+    SleepIntervalController controller;
+    controller.SetTarget(TargetUs);
+
+    // Present markers only, GPU bound
+    for (uint64_t i = 1; i <= 300; i++)
+    {
+        timeline.Record(i, Timeline::PresentStart, i * 30000);
+        timeline.Record(i, Timeline::PresentEnd, i * 30000 + 20000);
+        EXPECT_EQ(controller.Update(timeline), TargetUs);
+    }
+
+    EXPECT_FALSE(controller.Queued());
+}
+
+TEST(SleepIntervalController, ReachableTargetIsKept)
+{
+    Timeline fixedTimeline;
+    SimulatedGame fixedGame(8000);
+    auto fixed = RunGame(fixedGame, fixedTimeline, nullptr, TargetUs, 2000, 1000);
+
+    Timeline timeline;
+    SleepIntervalController controller;
+    controller.SetTarget(TargetUs);
+    SimulatedGame game(8000);
+    auto adaptive = RunGame(game, timeline, &controller, TargetUs, 2000, 0);
+
+    EXPECT_EQ(adaptive.Raises, 0u);
+    EXPECT_EQ(adaptive.MinIntervalUs, TargetUs);
+    EXPECT_EQ(adaptive.MaxIntervalUs, TargetUs);
+    EXPECT_NEAR(adaptive.FrameUs, fixed.FrameUs, 1.0);
+    EXPECT_FALSE(controller.Queued());
+}
+
+struct GpuBoundCase
+{
+    const char* Name;
+    double GpuUs;
+    double Noise;
+};
+
+class GpuBound : public ::testing::TestWithParam<GpuBoundCase>
+{
+};
+
+// Raise, step down and probe cycles after the first few hundred frames. Before the floor and probe back off the
+// controller cycled every ~360 frames between 3% over and 3% under the GPU frame time, a third of the frames queued.
+TEST_P(GpuBound, SettlesWithoutSawTooth)
+{
+    const auto& param = GetParam();
+    const uint32_t frames = 10000;
+    const uint32_t measureFrom = 2000;
+
+    Timeline fixedTimeline;
+    SimulatedGame fixedGame(param.GpuUs, param.Noise);
+    auto fixed = RunGame(fixedGame, fixedTimeline, nullptr, TargetUs, frames, measureFrom);
+
+    Timeline timeline;
+    SleepIntervalController controller;
+    controller.SetTarget(TargetUs);
+    SimulatedGame game(param.GpuUs, param.Noise);
+    auto adaptive = RunGame(game, timeline, &controller, TargetUs, frames, measureFrom);
+
+    // Only shown when an assertion fails
+    SCOPED_TRACE(testing::Message() << "fixed " << fixed.FrameUs << " us frame " << fixed.LatencyUs
+                                    << " us latency, adaptive " << adaptive.FrameUs << " us frame "
+                                    << adaptive.LatencyUs << " us latency, " << adaptive.Raises << " raises, interval "
+                                    << adaptive.MinIntervalUs << "-" << adaptive.MaxIntervalUs << " us, floor "
+                                    << controller.Floor() << " us, " << adaptive.QueuedShare * 100 << "% queued");
+
+    // Queue is gone, frame rate is kept
+    EXPECT_LT(adaptive.LatencyUs, fixed.LatencyUs * 0.75);
+    EXPECT_LT(adaptive.FrameUs, fixed.FrameUs * 1.03);
+    EXPECT_LT(adaptive.QueuedShare, 0.1);
+
+    // Settled just over the GPU frame time, probes only a few percent under it
+    EXPECT_GE(controller.Floor(), param.GpuUs);
+    EXPECT_LT(controller.Floor(), param.GpuUs * 1.04);
+    EXPECT_GT(adaptive.MinIntervalUs, param.GpuUs * 0.95);
+    EXPECT_LT(adaptive.MaxIntervalUs, param.GpuUs * 1.08);
+
+    // Probes back off, one per ~1000 frames at most when settled
+    const uint32_t maxProbeGap =
+        (SleepIntervalController::MaxHoldEvaluations + 10) * SleepIntervalController::EvaluateFrames;
+    EXPECT_LE(adaptive.Raises, (frames - measureFrom) / (maxProbeGap / 2));
+    EXPECT_LE(adaptive.Reversals, adaptive.Raises + 1);
+
+    if (param.Noise == 0.0)
+    {
+        ASSERT_GE(adaptive.RaiseFrames.size(), 2u);
+        auto lastGap = adaptive.RaiseFrames.back() - adaptive.RaiseFrames[adaptive.RaiseFrames.size() - 2];
+        EXPECT_GE(lastGap, SleepIntervalController::MaxHoldEvaluations * SleepIntervalController::EvaluateFrames);
+    }
+}
+
+static std::string GpuBoundName(const ::testing::TestParamInfo<GpuBoundCase>& InInfo) { return InInfo.param.Name; }
+
+INSTANTIATE_TEST_SUITE_P(SleepIntervalController, GpuBound,
+                         ::testing::Values(GpuBoundCase { "gpu20ms", 20000, 0.0 },
+                                           GpuBoundCase { "gpu30ms", 30000, 0.0 },
+                                           GpuBoundCase { "gpu40ms", 40000, 0.0 },
+                                           GpuBoundCase { "gpu20ms_noise5", 20000, 0.05 },
+                                           GpuBoundCase { "gpu25ms_noise10", 25000, 0.10 }),
+                         GpuBoundName);
+
+TEST(SleepIntervalController, LoadChanges)
+{
+    Timeline timeline;
+    SleepIntervalController controller;
+    controller.SetTarget(TargetUs);
+
+    SimulatedGame game(20000, 0.05);
+    RunGame(game, timeline, &controller, TargetUs, 3000, 0);
+    EXPECT_GT(controller.Floor(), 20000u);
+
+    // Heavier scene, raised right away
+    game.GpuUs = 25000;
+    auto heavier = RunGame(game, timeline, &controller, controller.Interval(), 3000, 0);
+    EXPECT_LE(heavier.RaiseFrames.front(), 2 * SleepIntervalController::EvaluateFrames);
+    EXPECT_GE(controller.Floor(), 25000u);
+    EXPECT_LT(controller.Floor(), 25000 * 1.04);
+
+    // Lighter scene, found by the next probe
+    game.GpuUs = 18000;
+    RunGame(game, timeline, &controller, controller.Interval(), 3000, 0);
+    EXPECT_GE(controller.Floor(), 18000u);
+    EXPECT_LT(controller.Floor(), 18000 * 1.04);
+
+    // Target reachable again
+    game.GpuUs = 8000;
+    auto reachable = RunGame(game, timeline, &controller, controller.Interval(), 3000, 2000);
+    EXPECT_EQ(controller.Interval(), TargetUs);
+    EXPECT_EQ(controller.Floor(), 0u);
+    EXPECT_EQ(reachable.MaxIntervalUs, TargetUs);
+}
+
+// Frames which queue just under the target tolerance aren't worth a raise
+TEST(SleepIntervalController, WithinTolerance)
+{
+    Timeline timeline;
+    SleepIntervalController controller;
+    controller.SetTarget(TargetUs);
+
+    SimulatedGame game(TargetUs * 1.04);
+    auto result = RunGame(game, timeline, &controller, TargetUs, 2000, 0);
+
+    EXPECT_EQ(result.Raises, 0u);
+    EXPECT_EQ(controller.Interval(), TargetUs);
+}
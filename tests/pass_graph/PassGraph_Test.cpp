@@ -0,0 +1,382 @@
+#include <pass_graph/PassGraph.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+// D3D12_RESOURCE_STATES values, the compiler only sees them as bitmasks
+enum : uint32_t
+{
+    Common = 0,
+    UnorderedAccess = 0x8,
+    NonPixelShader = 0x40,
+    PixelShader = 0x80,
+    CopyDest = 0x400,
+    CopySource = 0x800,
+};
+
+static constexpr PassGraph::StateTraits Traits { NonPixelShader | PixelShader | CopySource, UnorderedAccess, Common };
+static constexpr PassGraph::TransientDesc Desc { 128, 64, 10, 0 };
+
+using Barrier = PassGraph::Barrier;
+using BarrierType = PassGraph::BarrierType;
+using BarrierFlags = PassGraph::BarrierFlags;
+
+static const PassGraph::Step* FindStep(const PassGraph::Plan& InPlan, PassGraph::PassId InPass)
+{
+    auto it = std::find_if(InPlan.Steps.begin(), InPlan.Steps.end(),
+                           [InPass](const PassGraph::Step& step) { return step.Pass == InPass; });
+
+    return it == InPlan.Steps.end() ? nullptr : &*it;
+}
+
+static std::vector<Barrier> BarriersOf(const std::vector<Barrier>& InBarriers, PassGraph::ResourceId InResource)
+{
+    std::vector<Barrier> result;
+
+    for (const auto& barrier : InBarriers)
+    {
+        if (barrier.Resource == InResource)
+            result.push_back(barrier);
+    }
+
+    return result;
+}
+
+TEST(PassGraph, CullsPassesWhichDontReachImports)
+{
+    PassGraph graph(Traits);
+    auto color = graph.Import("Color", NonPixelShader, NonPixelShader);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    auto used = graph.CreateTransient("Used", Desc);
+    auto unused = graph.CreateTransient("Unused", Desc);
+    auto sideEffect = graph.CreateTransient("SideEffect", Desc);
+
+    auto a = graph.AddPass("A");
+    graph.Read(a, color, NonPixelShader);
+    graph.Write(a, used, UnorderedAccess);
+
+    auto dead = graph.AddPass("Dead");
+    graph.Read(dead, used, NonPixelShader);
+    graph.Write(dead, unused, UnorderedAccess);
+
+    auto kept = graph.AddPass("Kept", true);
+    graph.Read(kept, used, NonPixelShader);
+    graph.Write(kept, sideEffect, UnorderedAccess);
+
+    auto b = graph.AddPass("B");
+    graph.Read(b, used, NonPixelShader);
+    graph.Write(b, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    ASSERT_EQ(plan.CulledPasses.size(), 1u);
+    EXPECT_EQ(plan.CulledPasses[0], dead);
+    ASSERT_EQ(plan.Steps.size(), 3u);
+    EXPECT_EQ(plan.Steps[0].Pass, a);
+    EXPECT_EQ(plan.Steps[1].Pass, kept);
+    EXPECT_EQ(plan.Steps[2].Pass, b);
+    EXPECT_EQ(plan.PhysicalSlot[unused], PassGraph::Invalid);
+}
+
+TEST(PassGraph, CombinesFollowingReads)
+{
+    PassGraph graph(Traits);
+    auto source = graph.Import("Source", UnorderedAccess, UnorderedAccess);
+    auto first = graph.Import("First", UnorderedAccess);
+    auto second = graph.Import("Second", UnorderedAccess);
+
+    auto a = graph.AddPass("A");
+    graph.Read(a, source, NonPixelShader);
+    graph.Write(a, first, UnorderedAccess);
+
+    auto b = graph.AddPass("B");
+    graph.Read(b, source, CopySource);
+    graph.Write(b, second, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    // One transition to both read states, none before B
+    auto atA = BarriersOf(FindStep(plan, a)->Barriers, source);
+    ASSERT_EQ(atA.size(), 1u);
+    EXPECT_EQ(atA[0].StateBefore, (uint32_t) UnorderedAccess);
+    EXPECT_EQ(atA[0].StateAfter, (uint32_t) (NonPixelShader | CopySource));
+    EXPECT_TRUE(BarriersOf(FindStep(plan, b)->Barriers, source).empty());
+
+    auto final = BarriersOf(plan.FinalBarriers, source);
+    ASSERT_EQ(final.size(), 1u);
+    EXPECT_EQ(final[0].StateBefore, (uint32_t) (NonPixelShader | CopySource));
+    EXPECT_EQ(final[0].StateAfter, (uint32_t) UnorderedAccess);
+
+    // Imports without final state stay where the last pass left them
+    EXPECT_TRUE(BarriersOf(plan.FinalBarriers, first).empty());
+    EXPECT_TRUE(BarriersOf(plan.FinalBarriers, second).empty());
+}
+
+TEST(PassGraph, MergesReadStatesOfOnePass)
+{
+    PassGraph graph(Traits);
+    auto source = graph.Import("Source", UnorderedAccess, UnorderedAccess);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+
+    auto a = graph.AddPass("A");
+    graph.Read(a, source, NonPixelShader);
+    graph.Read(a, source, PixelShader);
+    graph.Write(a, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    auto atA = BarriersOf(plan.Steps[0].Barriers, source);
+    ASSERT_EQ(atA.size(), 1u);
+    EXPECT_EQ(atA[0].StateAfter, (uint32_t) (NonPixelShader | PixelShader));
+}
+
+TEST(PassGraph, UavBarrierBetweenWrites)
+{
+    PassGraph graph(Traits);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+
+    auto a = graph.AddPass("A");
+    graph.Write(a, output, UnorderedAccess);
+
+    auto b = graph.AddPass("B");
+    graph.Write(b, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    EXPECT_TRUE(plan.Steps[0].Barriers.empty());
+    ASSERT_EQ(plan.Steps[1].Barriers.size(), 1u);
+    EXPECT_EQ(plan.Steps[1].Barriers[0].Type, BarrierType::UnorderedAccess);
+    EXPECT_TRUE(plan.FinalBarriers.empty());
+    EXPECT_EQ(plan.BarrierCount(), 1u);
+}
+
+TEST(PassGraph, SplitsBarriersOverUnrelatedPasses)
+{
+    PassGraph graph(Traits);
+    auto late = graph.Import("Late", UnorderedAccess, UnorderedAccess);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    auto other = graph.Import("Other", UnorderedAccess, UnorderedAccess);
+
+    auto a = graph.AddPass("A");
+    graph.Write(a, other, UnorderedAccess);
+
+    auto b = graph.AddPass("B");
+    graph.Write(b, other, UnorderedAccess);
+
+    auto c = graph.AddPass("C");
+    graph.Read(c, late, NonPixelShader);
+    graph.Write(c, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    // Imported resource can start its transition at graph start
+    auto begin = BarriersOf(FindStep(plan, a)->Barriers, late);
+    auto end = BarriersOf(FindStep(plan, c)->Barriers, late);
+    ASSERT_EQ(begin.size(), 1u);
+    ASSERT_EQ(end.size(), 1u);
+    EXPECT_EQ(begin[0].Flags, BarrierFlags::BeginOnly);
+    EXPECT_EQ(end[0].Flags, BarrierFlags::EndOnly);
+    EXPECT_EQ(begin[0].StateBefore, end[0].StateBefore);
+    EXPECT_EQ(begin[0].StateAfter, end[0].StateAfter);
+    EXPECT_TRUE(BarriersOf(FindStep(plan, b)->Barriers, late).empty());
+
+    // Used by the very next pass, nothing to split over
+    PassGraph direct(Traits);
+    auto source = direct.Import("Source", UnorderedAccess, UnorderedAccess);
+    auto target = direct.Import("Target", UnorderedAccess, UnorderedAccess);
+    auto pass = direct.AddPass("A");
+    direct.Read(pass, source, NonPixelShader);
+    direct.Write(pass, target, UnorderedAccess);
+
+    ASSERT_TRUE(direct.Compile(plan));
+    ASSERT_EQ(plan.Steps[0].Barriers.size(), 1u);
+    EXPECT_EQ(plan.Steps[0].Barriers[0].Flags, BarrierFlags::None);
+}
+
+TEST(PassGraph, ReusesTransientSlots)
+{
+    PassGraph graph(Traits);
+    auto color = graph.Import("Color", NonPixelShader, NonPixelShader);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    auto t1 = graph.CreateTransient("T1", Desc);
+    auto t2 = graph.CreateTransient("T2", Desc);
+    auto t3 = graph.CreateTransient("T3", Desc);
+    auto other = graph.CreateTransient("Other", { 64, 64, 10, 0 });
+
+    auto a = graph.AddPass("A");
+    graph.Read(a, color, NonPixelShader);
+    graph.Write(a, t1, UnorderedAccess);
+
+    auto b = graph.AddPass("B");
+    graph.Read(b, t1, NonPixelShader);
+    graph.Write(b, t2, UnorderedAccess);
+
+    // T1 is done, T3 can take its slot. Other has another size
+    auto c = graph.AddPass("C");
+    graph.Read(c, t2, NonPixelShader);
+    graph.Write(c, t3, UnorderedAccess);
+    graph.Write(c, other, UnorderedAccess);
+
+    auto d = graph.AddPass("D");
+    graph.Read(d, t3, NonPixelShader);
+    graph.Read(d, other, NonPixelShader);
+    graph.Write(d, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+
+    ASSERT_EQ(plan.PhysicalDescs.size(), 3u);
+    EXPECT_EQ(plan.PhysicalSlot[t3], plan.PhysicalSlot[t1]);
+    EXPECT_NE(plan.PhysicalSlot[t2], plan.PhysicalSlot[t1]);
+    EXPECT_NE(plan.PhysicalSlot[other], plan.PhysicalSlot[t1]);
+    EXPECT_NE(plan.PhysicalSlot[other], plan.PhysicalSlot[t2]);
+    EXPECT_EQ(plan.PhysicalSlot[color], PassGraph::Invalid);
+
+    // T3 continues from the read state T1 left the slot in
+    auto atC = BarriersOf(FindStep(plan, c)->Barriers, t3);
+    ASSERT_EQ(atC.size(), 1u);
+    EXPECT_EQ(atC[0].StateBefore, (uint32_t) NonPixelShader);
+    EXPECT_EQ(atC[0].StateAfter, (uint32_t) UnorderedAccess);
+
+    // First user of a new slot starts from initial state
+    auto atA = BarriersOf(FindStep(plan, a)->Barriers, t1);
+    ASSERT_EQ(atA.size(), 1u);
+    EXPECT_EQ(atA[0].StateBefore, (uint32_t) Common);
+
+    // Every slot is returned to initial state
+    uint32_t slotsReturned = 0;
+
+    for (const auto& barrier : plan.FinalBarriers)
+    {
+        if (plan.PhysicalSlot[barrier.Resource] != PassGraph::Invalid)
+        {
+            EXPECT_EQ(barrier.StateAfter, (uint32_t) Common);
+            slotsReturned++;
+        }
+    }
+
+    EXPECT_EQ(slotsReturned, 3u);
+}
+
+TEST(PassGraph, RejectsInvalidGraphs)
+{
+    PassGraph::Plan plan;
+
+    PassGraph readFirst(Traits);
+    auto transient = readFirst.CreateTransient("Transient", Desc);
+    auto output = readFirst.Import("Output", UnorderedAccess, UnorderedAccess);
+    auto pass = readFirst.AddPass("A");
+    readFirst.Read(pass, transient, NonPixelShader);
+    readFirst.Write(pass, output, UnorderedAccess);
+    EXPECT_FALSE(readFirst.Compile(plan));
+
+    PassGraph conflicting(Traits);
+    auto resource = conflicting.Import("Resource", UnorderedAccess, UnorderedAccess);
+    pass = conflicting.AddPass("A");
+    conflicting.Read(pass, resource, NonPixelShader);
+    conflicting.Write(pass, resource, UnorderedAccess);
+    EXPECT_FALSE(conflicting.Compile(plan));
+
+    EXPECT_FALSE(conflicting.Read(pass, 42, NonPixelShader));
+    EXPECT_FALSE(conflicting.Write(42, resource, UnorderedAccess));
+}
+
+TEST(PassGraph, ResetClearsDeclarations)
+{
+    PassGraph graph(Traits);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    graph.Write(graph.AddPass("A"), output, UnorderedAccess);
+
+    graph.Reset();
+    EXPECT_EQ(graph.PassCount(), 0u);
+    EXPECT_EQ(graph.ResourceCount(), 0u);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+    EXPECT_TRUE(plan.Steps.empty());
+    EXPECT_EQ(plan.BarrierCount(), 0u);
+}
+
+// Declarations of the previous frame must not leak into reused passes
+TEST(PassGraph, RedeclaredGraphReusesStorage)
+{
+    PassGraph graph(Traits);
+    PassGraph::Plan plan;
+
+    auto declare = [&graph]()
+    {
+        auto upscaled = graph.Import("Upscaled", UnorderedAccess, UnorderedAccess);
+        auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+        auto pass = graph.AddPass("RCAS");
+        graph.Read(pass, upscaled, NonPixelShader);
+        graph.Write(pass, output, UnorderedAccess);
+    };
+
+    declare();
+    ASSERT_TRUE(graph.Compile(plan));
+    ASSERT_EQ(plan.Steps.size(), 1u);
+    ASSERT_EQ(plan.Steps[0].Barriers.size(), 1u);
+
+    auto steps = plan.Steps.data();
+    auto barriers = plan.Steps[0].Barriers.data();
+    auto finalBarriers = plan.FinalBarriers.data();
+
+    graph.Reset();
+    declare();
+    ASSERT_TRUE(graph.Compile(plan));
+    ASSERT_EQ(plan.Steps.size(), 1u);
+    ASSERT_EQ(plan.Steps[0].Barriers.size(), 1u);
+    EXPECT_EQ(plan.Steps.data(), steps);
+    EXPECT_EQ(plan.Steps[0].Barriers.data(), barriers);
+    EXPECT_EQ(plan.FinalBarriers.data(), finalBarriers);
+    EXPECT_STREQ(graph.PassName(0), "RCAS");
+
+    // Same pass slot without the read
+    graph.Reset();
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    graph.Write(graph.AddPass("Clear"), output, UnorderedAccess);
+
+    ASSERT_TRUE(graph.Compile(plan));
+    ASSERT_EQ(plan.Steps.size(), 1u);
+    EXPECT_TRUE(plan.Steps[0].Barriers.empty());
+    EXPECT_EQ(plan.BarrierCount(), 0u);
+    EXPECT_STREQ(graph.PassName(0), "Clear");
+}
+
+// Same graph RecordPostPasses declares for RCAS followed by output scaling
+TEST(PassGraph, PostUpscaleTail)
+{
+    PassGraph graph(Traits);
+    auto upscaled = graph.Import("Upscaled", UnorderedAccess, UnorderedAccess);
+    auto output = graph.Import("Output", UnorderedAccess, UnorderedAccess);
+    auto scaler = graph.Import("OutputScaler", UnorderedAccess, UnorderedAccess);
+
+    auto rcas = graph.AddPass("RCAS");
+    graph.Read(rcas, upscaled, NonPixelShader);
+    graph.Write(rcas, scaler, UnorderedAccess);
+
+    auto scaling = graph.AddPass("OutputScaling");
+    graph.Read(scaling, scaler, NonPixelShader);
+    graph.Write(scaling, output, UnorderedAccess);
+
+    PassGraph::Plan plan;
+    ASSERT_TRUE(graph.Compile(plan));
+    ASSERT_EQ(plan.Steps.size(), 2u);
+
+    // Upscaled to read, scaler buffer to read after RCAS, both back to UAV in one final batch
+    ASSERT_EQ(plan.Steps[0].Barriers.size(), 1u);
+    EXPECT_EQ(plan.Steps[0].Barriers[0].Resource, upscaled);
+    ASSERT_EQ(plan.Steps[1].Barriers.size(), 1u);
+    EXPECT_EQ(plan.Steps[1].Barriers[0].Resource, scaler);
+    EXPECT_EQ(plan.Steps[1].Barriers[0].StateAfter, (uint32_t) NonPixelShader);
+    ASSERT_EQ(plan.FinalBarriers.size(), 2u);
+
+    for (const auto& barrier : plan.FinalBarriers)
+        EXPECT_EQ(barrier.StateAfter, (uint32_t) UnorderedAccess);
+}
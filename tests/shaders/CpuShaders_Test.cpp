@@ -0,0 +1,311 @@
+#include "ShaderTestUtils.h"
+
+#include <shaders/bias/Bias_Cpu.h>
+#include <shaders/depth_scale/DS_Cpu.h>
+#include <shaders/depth_transfer/DT_Cpu.h>
+#include <shaders/format_transfer/FT_Cpu.h>
+#include <shaders/fsr1/FSR1_Cpu.h>
+#include <shaders/output_scaling/OS_Cpu.h>
+#include <shaders/rcas/RCAS_Cpu.h>
+#include <shaders/rcas_os/RCAS_OS_Cpu.h>
+#include <shaders/resource_flip/RF_Cpu.h>
+
+using namespace ShaderTest;
+
+// Sizes which are not multiples of the thread group sizes so partial groups are covered
+static constexpr uint32_t SrcWidth = 40;
+static constexpr uint32_t SrcHeight = 24;
+static constexpr uint32_t UpWidth = 64;
+static constexpr uint32_t UpHeight = 38;
+static constexpr uint32_t DownWidth = 27;
+static constexpr uint32_t DownHeight = 16;
+
+TEST(Bias, ScalesRedOnly)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    CpuTexture output(SrcWidth, SrcHeight);
+    ASSERT_TRUE(Bias_Cpu::Dispatch(input, 0.5f, output));
+
+    for (uint32_t y = 0; y < SrcHeight; y++)
+    {
+        for (uint32_t x = 0; x < SrcWidth; x++)
+        {
+            EXPECT_FLOAT_EQ(output.Pixel(x, y)[0], input.Pixel(x, y)[0] * 0.5f);
+            EXPECT_FLOAT_EQ(output.Pixel(x, y)[1], input.Pixel(x, y)[1]);
+            EXPECT_FLOAT_EQ(output.Pixel(x, y)[2], input.Pixel(x, y)[2]);
+        }
+    }
+
+    // Same clamp as the shader constants
+    ASSERT_TRUE(Bias_Cpu::Dispatch(input, 2.0f, output));
+    EXPECT_FLOAT_EQ(output.Pixel(3, 3)[0], input.Pixel(3, 3)[0] * 0.9f);
+
+    ExpectMatchesReference("bias", output);
+}
+
+TEST(DepthScale, Reference)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight, 1);
+    CpuTexture output(SrcWidth, SrcHeight, 1);
+    ASSERT_TRUE(DS_Cpu::Dispatch(input, 0.8f, SrcWidth, SrcHeight, output));
+
+    for (auto value : output.Data)
+    {
+        EXPECT_GE(value, 0.0f);
+        EXPECT_LE(value, 1.0f);
+    }
+
+    ExpectMatchesReference("depth_scale", output);
+
+    CpuTexture single(SrcWidth, SrcHeight, 1);
+    ASSERT_TRUE(DS_Cpu::Dispatch(input, 0.8f, SrcWidth, SrcHeight, single, 1));
+    ExpectIdentical(output, single);
+}
+
+TEST(DepthTransfer, Inverts)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight, 1);
+    CpuTexture output(SrcWidth, SrcHeight, 1);
+    ASSERT_TRUE(DT_Cpu::Dispatch(input, output));
+
+    for (size_t i = 0; i < input.Data.size(); i++)
+        EXPECT_FLOAT_EQ(output.Data[i], 1.0f - input.Data[i]);
+
+    ExpectMatchesReference("depth_transfer", output);
+}
+
+TEST(ResourceFlip, FlipsRowsAndVelocity)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    CpuTexture output(SrcWidth, SrcHeight);
+
+    // RF_Dx12 passes size - 1
+    RF_Cpu::Constants constants { SrcWidth - 1, SrcHeight - 1, 0, 0 };
+    ASSERT_TRUE(RF_Cpu::Dispatch(input, constants, SrcWidth, SrcHeight, output));
+
+    for (uint32_t y = 0; y < SrcHeight; y++)
+    {
+        for (uint32_t x = 0; x < SrcWidth; x++)
+            EXPECT_FLOAT_EQ(output.Pixel(x, SrcHeight - 1 - y)[0], input.Pixel(x, y)[0]);
+    }
+
+    constants.velocity = 1;
+    ASSERT_TRUE(RF_Cpu::Dispatch(input, constants, SrcWidth, SrcHeight, output));
+    EXPECT_FLOAT_EQ(output.Pixel(5, SrcHeight - 1 - 7)[1], -input.Pixel(5, 7)[1]);
+    EXPECT_FLOAT_EQ(output.Pixel(5, SrcHeight - 1 - 7)[2], 0.0f);
+
+    ExpectMatchesReference("resource_flip_velocity", output);
+}
+
+TEST(FormatTransfer, Pack)
+{
+    auto red = CpuFloat4::Set(1.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_EQ(FT_Cpu::Pack(red, FT_Cpu::Format::R8G8B8A8), 0xFF0000FFu);
+    EXPECT_EQ(FT_Cpu::Pack(red, FT_Cpu::Format::R10G10B10A2), 0xC00003FFu);
+
+    // ftB8G8R8A8Code packs B | R << 8 | G << 16
+    EXPECT_EQ(FT_Cpu::Pack(red, FT_Cpu::Format::B8G8R8A8), 0xFF00FF00u);
+    EXPECT_EQ(FT_Cpu::Pack(CpuFloat4::Set(0.0f, 0.0f, 1.0f, 0.0f), FT_Cpu::Format::B8G8R8A8), 0x000000FFu);
+
+    // Saturated and truncated like the (uint) casts
+    EXPECT_EQ(FT_Cpu::Pack(CpuFloat4::Set(2.0f, -1.0f, 0.5f, 0.999f), FT_Cpu::Format::R8G8B8A8), 0xFE7F00FFu);
+    EXPECT_EQ(FT_Cpu::Pack(CpuFloat4::Set(0.5f, 0.25f, 0.0f, 0.5f), FT_Cpu::Format::R10G10B10A2),
+              511u | 255u << 10 | 0u << 20 | 1u << 30);
+}
+
+TEST(FormatTransfer, DispatchMatchesPack)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+
+    for (auto format : { FT_Cpu::Format::R10G10B10A2, FT_Cpu::Format::R8G8B8A8, FT_Cpu::Format::B8G8R8A8 })
+    {
+        CpuPackedTexture output(SrcWidth, SrcHeight, 1);
+        ASSERT_TRUE(FT_Cpu::Dispatch(input, format, SrcWidth, SrcHeight, output));
+
+        for (uint32_t y = 0; y < SrcHeight; y++)
+        {
+            for (uint32_t x = 0; x < SrcWidth; x++)
+                ASSERT_EQ(output.Pixel(x, y)[0], FT_Cpu::Pack(CpuLoad(input, x, y), format)) << x << ", " << y;
+        }
+    }
+}
+
+TEST(Rcas, Reference)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    RCAS_Cpu::Constants constants;
+    constants.Sharpness = 0.6f;
+
+    CpuTexture output;
+    ASSERT_TRUE(RCAS_Cpu::Dispatch(input, nullptr, constants, output));
+    ExpectMatchesReference("rcas", output);
+
+    CpuTexture single;
+    ASSERT_TRUE(RCAS_Cpu::Dispatch(input, nullptr, constants, single, 1));
+    ExpectIdentical(output, single);
+}
+
+TEST(Rcas, MotionAdaptiveReference)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    auto mv = MakeMotionVectors(SrcWidth, SrcHeight);
+
+    RCAS_Cpu::Constants constants;
+    constants.Sharpness = 0.5f;
+    constants.DynamicSharpenEnabled = true;
+    constants.MotionSharpness = 0.8f;
+    constants.Threshold = 1.0f;
+    constants.ScaleLimit = 10.0f;
+    constants.DisplayWidth = SrcWidth;
+    constants.DisplayHeight = SrcHeight;
+
+    CpuTexture output;
+    ASSERT_TRUE(RCAS_Cpu::Dispatch(input, &mv, constants, output));
+    ExpectMatchesReference("rcas_motion", output);
+
+    // Fast area gets more sharpness than the still one
+    EXPECT_GT(RCAS_Cpu::EvaluateSharpness(&mv, constants, SrcWidth - 2, 4),
+              RCAS_Cpu::EvaluateSharpness(&mv, constants, 20, 20));
+}
+
+// Fused pass against RCAS_Cpu + OS_Cpu Upsample, the two pass reference. Both use the same math and only differ by
+// float rounding of the sharpened taps.
+static constexpr float FusedTolerance = 1e-5f;
+
+struct RcasOsCase
+{
+    const char* Name;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t DestWidth;
+    uint32_t DestHeight;
+    bool Motion;
+    bool Debug;
+    float Contrast;
+};
+
+class RcasOutputScaling : public testing::TestWithParam<RcasOsCase>
+{
+};
+
+TEST_P(RcasOutputScaling, MatchesSequential)
+{
+    auto& param = GetParam();
+    auto mv = MakeMotionVectors(param.Width, param.Height);
+
+    RCAS_Cpu::Constants constants;
+    constants.Contrast = param.Contrast;
+    constants.Debug = param.Debug;
+    constants.DynamicSharpenEnabled = param.Motion;
+    constants.MotionSharpness = 0.8f;
+    constants.Threshold = 1.0f;
+    constants.ScaleLimit = 10.0f;
+    constants.DisplayWidth = param.Width;
+    constants.DisplayHeight = param.Height;
+
+    for (uint32_t seed = 1; seed <= 4; seed++)
+    {
+        auto input = MakeImage(param.Width, param.Height, 4, seed);
+
+        for (float sharpness : { 0.0f, 0.4f, 1.0f })
+        {
+            constants.Sharpness = sharpness;
+
+            auto diff = RCAS_OS_Cpu::CompareWithSequential(input, param.Motion ? &mv : nullptr, constants, {},
+                                                           param.DestWidth, param.DestHeight, FusedTolerance);
+
+            EXPECT_FALSE(diff.SizeMismatch) << seed << " " << sharpness;
+            EXPECT_EQ(diff.MismatchCount, 0u) << seed << " " << sharpness << " max diff " << diff.MaxAbsDiff;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Cases, RcasOutputScaling,
+    testing::Values(RcasOsCase { "upscale", SrcWidth, SrcHeight, UpWidth, UpHeight, false, false, -100.0f },
+                    RcasOsCase { "motion", SrcWidth, SrcHeight, UpWidth, UpHeight, true, false, -100.0f },
+                    RcasOsCase { "debug", SrcWidth, SrcHeight, UpWidth, UpHeight, true, true, -100.0f },
+                    RcasOsCase { "contrast", SrcWidth, SrcHeight, UpWidth, UpHeight, false, false, 0.5f },
+                    RcasOsCase { "odd", 37, 23, 71, 45, true, false, -100.0f },
+                    RcasOsCase { "ratio_1_5", 40, 24, 60, 36, false, false, -100.0f },
+                    RcasOsCase { "ratio_2_25", 32, 18, 72, 41, true, false, -100.0f },
+                    RcasOsCase { "same_size", SrcWidth, SrcHeight, SrcWidth, SrcHeight, false, false, -100.0f },
+                    RcasOsCase { "downscale", SrcWidth, SrcHeight, DownWidth, DownHeight, true, false, -100.0f }),
+    [](const testing::TestParamInfo<RcasOsCase>& info) { return std::string(info.param.Name); });
+
+// Mismatching sizes and missing motion vectors are reported, not compared
+TEST(RcasOutputScalingCompare, InvalidInputs)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+
+    RCAS_Cpu::Constants constants;
+    constants.DynamicSharpenEnabled = true;
+
+    EXPECT_TRUE(RCAS_OS_Cpu::CompareWithSequential(input, nullptr, constants, {}, UpWidth, UpHeight, FusedTolerance)
+                    .SizeMismatch);
+    EXPECT_TRUE(RCAS_OS_Cpu::CompareWithSequential(CpuTexture(), nullptr, {}, {}, UpWidth, UpHeight, FusedTolerance)
+                    .SizeMismatch);
+}
+
+struct OsCase
+{
+    const char* Name;
+    OS_Cpu::Kernel Kernel;
+    uint32_t Width;
+    uint32_t Height;
+};
+
+class OutputScaling : public testing::TestWithParam<OsCase>
+{
+};
+
+TEST_P(OutputScaling, Reference)
+{
+    auto& param = GetParam();
+    auto input = MakeImage(SrcWidth, SrcHeight);
+
+    CpuTexture output(param.Width, param.Height);
+    ASSERT_TRUE(OS_Cpu::Dispatch(input, param.Kernel, {}, output));
+    ExpectMatchesReference(std::string("os_") + param.Name, output);
+
+    CpuTexture single(param.Width, param.Height);
+    ASSERT_TRUE(OS_Cpu::Dispatch(input, param.Kernel, {}, single, 1));
+    ExpectIdentical(output, single);
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, OutputScaling,
+                         testing::Values(OsCase { "bicubic", OS_Cpu::Kernel::Bicubic, DownWidth, DownHeight },
+                                         OsCase { "lanczos", OS_Cpu::Kernel::Lanczos, DownWidth, DownHeight },
+                                         OsCase { "catmull", OS_Cpu::Kernel::CatmullRom, DownWidth, DownHeight },
+                                         OsCase { "magc", OS_Cpu::Kernel::Magc, DownWidth, DownHeight },
+                                         OsCase { "upsample", OS_Cpu::Kernel::Upsample, UpWidth, UpHeight }),
+                         [](const testing::TestParamInfo<OsCase>& info) { return std::string(info.param.Name); });
+
+TEST(Fsr1, EasuReference)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    auto constants = FSR1_Cpu::EasuCon((float) SrcWidth, (float) SrcHeight, (float) SrcWidth, (float) SrcHeight,
+                                       (float) UpWidth, (float) UpHeight);
+
+    // Whole output inside the radius
+    constants.projCentre[0] = UpWidth / 2;
+    constants.projCentre[1] = UpHeight / 2;
+    constants.squaredRadius = UINT32_MAX;
+
+    CpuTexture output(UpWidth, UpHeight);
+    ASSERT_TRUE(FSR1_Cpu::DispatchEasu(input, constants, output));
+    ExpectMatchesReference("fsr1_easu", output);
+}
+
+TEST(Fsr1, RcasReference)
+{
+    auto input = MakeImage(SrcWidth, SrcHeight);
+    auto constants = FSR1_Cpu::RcasCon(0.25f);
+    constants.projCentre[0] = SrcWidth / 2;
+    constants.projCentre[1] = SrcHeight / 2;
+    constants.squaredRadius = UINT32_MAX;
+
+    CpuTexture output(SrcWidth, SrcHeight);
+    ASSERT_TRUE(FSR1_Cpu::DispatchRcas(input, constants, output));
+    ExpectMatchesReference("fsr1_rcas", output);
+}
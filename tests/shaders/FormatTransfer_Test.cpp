@@ -0,0 +1,170 @@
+#include <shaders/format_transfer/FT_Cpu.h>
+#include <shaders/format_transfer/FT_Formats.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+TEST(FormatTable, SameFormatIsNone)
+{
+    for (const auto& info : FT_FormatTable)
+        EXPECT_EQ(FT_GetTransferMode(info.Format, info.Format), FT_TransferMode::None);
+}
+
+TEST(FormatTable, CastFamiliesAreCopied)
+{
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB), FT_TransferMode::Copy);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_TYPELESS, DXGI_FORMAT_R8G8B8A8_UNORM), FT_TransferMode::Copy);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_B8G8R8A8_UNORM_SRGB, DXGI_FORMAT_B8G8R8A8_UNORM), FT_TransferMode::Copy);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R10G10B10A2_UNORM, DXGI_FORMAT_R10G10B10A2_TYPELESS),
+              FT_TransferMode::Copy);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_R16G16B16A16_TYPELESS),
+              FT_TransferMode::Copy);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_TYPELESS, DXGI_FORMAT_R16G16B16A16_UNORM),
+              FT_TransferMode::Copy);
+}
+
+// Same family but the bits mean something else, there is no shader for these targets
+TEST(FormatTable, FloatAndUnormAreNotCopied)
+{
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_R16G16B16A16_UNORM),
+              FT_TransferMode::Unsupported);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_UNORM, DXGI_FORMAT_R16G16B16A16_FLOAT),
+              FT_TransferMode::Unsupported);
+
+    // Any copy is between formats which read their channels the same way
+    for (const auto& source : FT_FormatTable)
+    {
+        for (const auto& target : FT_FormatTable)
+        {
+            if (FT_GetTransferMode(source.Format, target.Format) != FT_TransferMode::Copy)
+                continue;
+
+            EXPECT_EQ(source.Family, target.Family) << source.Format << " " << target.Format;
+
+            if (source.Component != FT_Component::Typeless && target.Component != FT_Component::Typeless)
+            {
+                EXPECT_EQ(source.Component, target.Component) << source.Format << " " << target.Format;
+            }
+        }
+    }
+}
+
+TEST(FormatTable, ConversionsUseCompute)
+{
+    // RGBA <-> BGRA are not cast compatible
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_B8G8R8A8_UNORM), FT_TransferMode::Compute);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_B8G8R8A8_UNORM, DXGI_FORMAT_R8G8B8A8_UNORM), FT_TransferMode::Compute);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_R10G10B10A2_UNORM),
+              FT_TransferMode::Compute);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R11G11B10_FLOAT, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB),
+              FT_TransferMode::Compute);
+
+    // Unknown sources are converted as long as the target has a shader
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R16G16B16A16_SNORM, DXGI_FORMAT_R8G8B8A8_UNORM),
+              FT_TransferMode::Compute);
+}
+
+TEST(FormatTable, TargetsWithoutShaderAreUnsupported)
+{
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R16G16B16A16_FLOAT),
+              FT_TransferMode::Unsupported);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R10G10B10A2_UNORM, DXGI_FORMAT_R11G11B10_FLOAT),
+              FT_TransferMode::Unsupported);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R8_UNORM), FT_TransferMode::Unsupported);
+    EXPECT_EQ(FT_GetTransferMode(DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R8G8B8A8_UINT), FT_TransferMode::Unsupported);
+}
+
+TEST(FormatTable, FamiliesAreConsistent)
+{
+    for (const auto& info : FT_FormatTable)
+    {
+        // Family is in the table and is its own family
+        auto family = FT_GetFormatInfo(info.Family);
+        ASSERT_NE(family, nullptr) << info.Format;
+        EXPECT_EQ(family->Family, info.Family) << info.Format;
+
+        // Every member of a family converts with the same shader
+        EXPECT_EQ(family->Shader, info.Shader) << info.Format;
+    }
+}
+
+// Precompiled and runtime layouts must both cover every pixel exactly once, without a group which has no pixel
+TEST(DispatchLayout, CoversOutput)
+{
+    for (auto layout : { FT_RuntimeLayout, FT_PrecompiledLayout })
+    {
+        for (uint32_t width : { 1u, 15u, 16u, 17u, 511u, 512u, 1920u, 3841u })
+        {
+            for (uint32_t height : { 1u, 15u, 16u, 17u, 1080u, 2161u })
+            {
+                uint32_t groupsX = 0;
+                uint32_t groupsY = 0;
+                FT_GetDispatchSize(layout, width, height, groupsX, groupsY);
+
+                uint64_t coveredX = (uint64_t) groupsX * layout.NumThreadsX * layout.PixelsPerThread;
+                uint64_t coveredY = (uint64_t) groupsY * layout.NumThreadsY * layout.PixelsPerThread;
+
+                EXPECT_GE(coveredX, width);
+                EXPECT_GE(coveredY, height);
+                EXPECT_LT(coveredX - width, layout.NumThreadsX * layout.PixelsPerThread);
+                EXPECT_LT(coveredY - height, layout.NumThreadsY * layout.PixelsPerThread);
+            }
+        }
+    }
+}
+
+TEST(DispatchLayout, CpuReferenceUsesRuntimeLayout)
+{
+    EXPECT_EQ(FT_Cpu::NumThreadsX, FT_RuntimeLayout.NumThreadsX);
+    EXPECT_EQ(FT_Cpu::NumThreadsY, FT_RuntimeLayout.NumThreadsY);
+    EXPECT_EQ(FT_Cpu::PixelsPerThread, FT_RuntimeLayout.PixelsPerThread);
+}
+
+// Table shader and FT_Cpu packing agree on channel order
+TEST(Packing, MatchesTableShader)
+{
+    auto color = CpuFloat4::Set(1.0f, 0.5f, 0.0f, 1.0f);
+
+    auto pack = [&](DXGI_FORMAT InFormat)
+    {
+        switch (FT_GetFormatInfo(InFormat)->Shader)
+        {
+        case FT_Shader::R10G10B10A2:
+            return FT_Cpu::Pack(color, FT_Cpu::Format::R10G10B10A2);
+        case FT_Shader::R8G8B8A8:
+            return FT_Cpu::Pack(color, FT_Cpu::Format::R8G8B8A8);
+        case FT_Shader::B8G8R8A8:
+            return FT_Cpu::Pack(color, FT_Cpu::Format::B8G8R8A8);
+        default:
+            return 0u;
+        }
+    };
+
+    EXPECT_EQ(pack(DXGI_FORMAT_R8G8B8A8_UNORM_SRGB), 0xFF007FFFu);
+    EXPECT_EQ(pack(DXGI_FORMAT_R10G10B10A2_UNORM), 0xC0000000u | 511u << 10 | 1023u);
+
+    // ftB8G8R8A8Code layout, B | R << 8 | G << 16
+    EXPECT_EQ(pack(DXGI_FORMAT_B8G8R8A8_UNORM), 0xFF7FFF00u);
+}
+
+// Every value of the 10 and 8 bit ranges survives the round trip through unorm
+TEST(Packing, UnormRoundTrip)
+{
+    for (uint32_t i = 0; i <= 255; i++)
+    {
+        // Shader truncates, values at the centre of each step must land on it
+        float value = (i + 0.5f) / 255.0f;
+        auto packed = FT_Cpu::Pack(CpuFloat4::Splat(std::min(value, 1.0f)), FT_Cpu::Format::R8G8B8A8);
+        EXPECT_EQ(packed & 0xFF, i) << i;
+    }
+
+    for (uint32_t i = 0; i < 1023; i++)
+    {
+        float value = (i + 0.5f) / 1023.0f;
+        auto packed = FT_Cpu::Pack(CpuFloat4::Splat(value), FT_Cpu::Format::R10G10B10A2);
+        EXPECT_EQ(packed & 0x3FF, i) << i;
+        EXPECT_EQ((packed >> 10) & 0x3FF, i) << i;
+        EXPECT_EQ((packed >> 20) & 0x3FF, i) << i;
+    }
+}
@@ -0,0 +1,179 @@
+#include "ShaderTestUtils.h"
+
+#include <shaders/output_scaling/OS_Cpu.h>
+
+using namespace ShaderTest;
+
+// Low frequency image, luminance correction of the downscalers never kicks in on it
+static CpuTexture MakeSmoothImage(uint32_t InWidth, uint32_t InHeight)
+{
+    CpuTexture image(InWidth, InHeight);
+
+    for (uint32_t y = 0; y < InHeight; y++)
+    {
+        for (uint32_t x = 0; x < InWidth; x++)
+        {
+            float u = (x + 0.5f) / InWidth;
+            float v = (y + 0.5f) / InHeight;
+
+            auto p = image.Pixel(x, y);
+            p[0] = 0.2f + 0.5f * u;
+            p[1] = 0.3f + 0.4f * v * v;
+            p[2] = 0.5f + 0.2f * std::sin(6.0f * u) * std::cos(4.0f * v);
+            p[3] = 1.0f;
+        }
+    }
+
+    return image;
+}
+
+// Full 2D evaluation of the separable kernel in double with the exact phase, no weight tables
+static CpuTexture DirectResample(const CpuTexture& InImage, bool InLanczos, uint32_t InWidth, uint32_t InHeight)
+{
+    CpuTexture output(InWidth, InHeight);
+    const double radius = InLanczos ? 3.0 : 2.0;
+
+    auto kernel = [&](double x)
+    { return InLanczos ? OS_Cpu::LanczosKernel((float) std::abs(x), 3.0f) : OS_Cpu::CatmullRomKernel((float) x); };
+
+    double scaleX = (double) InImage.Width / InWidth;
+    double scaleY = (double) InImage.Height / InHeight;
+    double maxScale = (OS_Cpu::SeparableMaxTaps / 2) / radius;
+    double filterX = std::clamp(scaleX, 1.0, maxScale);
+    double filterY = std::clamp(scaleY, 1.0, maxScale);
+
+    for (uint32_t y = 0; y < InHeight; y++)
+    {
+        for (uint32_t x = 0; x < InWidth; x++)
+        {
+            double centreX = (x + 0.5) * scaleX - 0.5;
+            double centreY = (y + 0.5) * scaleY - 0.5;
+            double color[4] {};
+            double total = 0.0;
+
+            for (auto j = (int64_t) std::floor(centreY - radius * filterY);
+                 j <= (int64_t) std::ceil(centreY + radius * filterY); j++)
+            {
+                double weightY = kernel((j - centreY) / filterY);
+
+                for (auto i = (int64_t) std::floor(centreX - radius * filterX);
+                     i <= (int64_t) std::ceil(centreX + radius * filterX); i++)
+                {
+                    double weight = kernel((i - centreX) / filterX) * weightY;
+                    auto p = InImage.Pixel((uint32_t) std::clamp<int64_t>(i, 0, InImage.Width - 1),
+                                           (uint32_t) std::clamp<int64_t>(j, 0, InImage.Height - 1));
+
+                    for (uint32_t c = 0; c < 4; c++)
+                        color[c] += p[c] * weight;
+
+                    total += weight;
+                }
+            }
+
+            for (uint32_t c = 0; c < 4; c++)
+                output.Pixel(x, y)[c] = (float) (color[c] / total);
+        }
+    }
+
+    return output;
+}
+
+struct SeparableCase
+{
+    uint32_t SrcWidth;
+    uint32_t SrcHeight;
+    uint32_t DstWidth;
+    uint32_t DstHeight;
+};
+
+static constexpr SeparableCase SeparableCases[] = {
+    { 40, 24, 27, 16 }, { 128, 72, 64, 36 }, { 200, 120, 67, 40 }, { 96, 96, 24, 24 }, { 160, 90, 100, 56 },
+};
+
+TEST(SeparableScaling, WeightTables)
+{
+    for (auto kernel : { OS_Cpu::Kernel::SeparableLanczos, OS_Cpu::Kernel::SeparableCatmullRom })
+    {
+        for (uint32_t dst : { 1000u, 720u, 480u, 250u, 100u })
+        {
+            OS_Cpu::SeparableAxis axis;
+            OS_Cpu::BuildSeparableAxis(kernel, 1000, dst, axis);
+
+            EXPECT_EQ(axis.Taps % 4, 0u);
+            EXPECT_LE(axis.Taps, OS_Cpu::SeparableMaxTaps);
+
+            for (uint32_t p = 0; p < OS_Cpu::SeparablePhases; p++)
+            {
+                float total = 0.0f;
+
+                for (uint32_t i = 0; i < axis.Taps; i++)
+                    total += axis.Weights[p][i];
+
+                EXPECT_NEAR(total, 1.0f, 1e-5f) << dst << " phase " << p;
+            }
+        }
+    }
+}
+
+// Phase tables and the clamped intermediate only cost quantization error against the exact filter
+TEST(SeparableScaling, MatchesDirectResample)
+{
+    for (auto& test : SeparableCases)
+    {
+        auto input = MakeSmoothImage(test.SrcWidth, test.SrcHeight);
+
+        for (bool lanczos : { true, false })
+        {
+            CpuTexture output(test.DstWidth, test.DstHeight);
+            auto kernel = lanczos ? OS_Cpu::Kernel::SeparableLanczos : OS_Cpu::Kernel::SeparableCatmullRom;
+            ASSERT_TRUE(OS_Cpu::Dispatch(input, kernel, {}, output));
+
+            auto diff = CpuCompareImages(DirectResample(input, lanczos, test.DstWidth, test.DstHeight), output,
+                                         1e-3f, 3);
+            EXPECT_EQ(diff.MismatchCount, 0u) << test.SrcWidth << "->" << test.DstWidth << " max " << diff.MaxAbsDiff;
+        }
+    }
+}
+
+// Separable modes are a replacement of 1 and 2, they differ by the pixel centre offset and kernel width of the
+// 2D shaders but must stay close on smooth content
+TEST(SeparableScaling, CloseTo2DModes)
+{
+    for (auto& test : SeparableCases)
+    {
+        auto input = MakeSmoothImage(test.SrcWidth, test.SrcHeight);
+
+        for (bool lanczos : { true, false })
+        {
+            CpuTexture separable(test.DstWidth, test.DstHeight);
+            CpuTexture full(test.DstWidth, test.DstHeight);
+
+            ASSERT_TRUE(OS_Cpu::Dispatch(
+                input, lanczos ? OS_Cpu::Kernel::SeparableLanczos : OS_Cpu::Kernel::SeparableCatmullRom, {},
+                separable));
+            ASSERT_TRUE(
+                OS_Cpu::Dispatch(input, lanczos ? OS_Cpu::Kernel::Lanczos : OS_Cpu::Kernel::CatmullRom, {}, full));
+
+            auto diff = CpuCompareImages(full, separable, 0.04f, 3);
+            EXPECT_EQ(diff.MismatchCount, 0u) << test.SrcWidth << "->" << test.DstWidth << " max " << diff.MaxAbsDiff;
+            EXPECT_LT(diff.MeanAbsDiff, 0.01) << test.SrcWidth << "->" << test.DstWidth;
+        }
+    }
+}
+
+TEST(SeparableScaling, Reference)
+{
+    auto input = MakeImage(96, 54);
+
+    for (bool lanczos : { true, false })
+    {
+        CpuTexture output(40, 22);
+        auto kernel = lanczos ? OS_Cpu::Kernel::SeparableLanczos : OS_Cpu::Kernel::SeparableCatmullRom;
+        ASSERT_TRUE(OS_Cpu::Dispatch(input, kernel, {}, output));
+        ExpectMatchesReference(lanczos ? "os_lanczos_separable" : "os_catmull_separable", output);
+
+        CpuTexture single(40, 22);
+        ASSERT_TRUE(OS_Cpu::Dispatch(input, kernel, {}, single, 1));
+        ExpectIdentical(output, single);
+    }
+}
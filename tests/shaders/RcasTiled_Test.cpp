@@ -0,0 +1,213 @@
+#include "ShaderTestUtils.h"
+
+#include <shaders/rcas/RCAS_Cpu.h>
+
+using namespace ShaderTest;
+
+static constexpr uint32_t Width = 67;
+static constexpr uint32_t Height = 45;
+
+// Test image with a flat area on the left third, the tiled shader copies those tiles
+static CpuTexture MakeFlatImage()
+{
+    auto image = MakeImage(Width, Height);
+
+    for (uint32_t y = 0; y < Height; y++)
+    {
+        for (uint32_t x = 0; x < Width / 3; x++)
+        {
+            auto p = image.Pixel(x, y);
+            p[0] = 0.4f;
+            p[1] = 0.5f + 0.001f * (x % 2);
+            p[2] = 0.3f;
+        }
+    }
+
+    return image;
+}
+
+// Slowly changing motion, sharpness changes by less than a step per tile
+static CpuTexture MakeSmoothMotion()
+{
+    CpuTexture mv(Width, Height, 2);
+
+    for (uint32_t y = 0; y < Height; y++)
+    {
+        for (uint32_t x = 0; x < Width; x++)
+        {
+            mv.Pixel(x, y)[0] = 0.15f * x;
+            mv.Pixel(x, y)[1] = 0.05f * y;
+        }
+    }
+
+    return mv;
+}
+
+static bool IsFlatTile(const CpuTexture& InImage, uint32_t InTileX, uint32_t InTileY, float InThreshold)
+{
+    float lumaMin = 1e9f;
+    float lumaMax = 0.0f;
+
+    for (int64_t y = (int64_t) InTileY * RCAS_Cpu::TileSize - 1; y <= (InTileY + 1) * RCAS_Cpu::TileSize; y++)
+    {
+        for (int64_t x = (int64_t) InTileX * RCAS_Cpu::TileSize - 1; x <= (InTileX + 1) * RCAS_Cpu::TileSize; x++)
+        {
+            auto color = CpuLoad(InImage, x, y);
+            float luma = std::max(color.X() * 0.5f + color.Y() + color.Z() * 0.5f, 0.0f);
+            lumaMin = std::min(lumaMin, luma);
+            lumaMax = std::max(lumaMax, luma);
+        }
+    }
+
+    return lumaMax - lumaMin < InThreshold;
+}
+
+// Without tile skip and with constant sharpness tiled version is the rcasCode math
+TEST(RcasTiled, MatchesRcasWithoutSkip)
+{
+    auto input = MakeFlatImage();
+
+    for (float sharpness : { 0.0f, 0.3f, 0.8f, 1.3f })
+    {
+        RCAS_Cpu::Constants constants;
+        constants.Sharpness = sharpness;
+        constants.TileSkipThreshold = 0.0f;
+
+        CpuTexture full;
+        CpuTexture tiled;
+        ASSERT_TRUE(RCAS_Cpu::Dispatch(input, nullptr, constants, full));
+        ASSERT_TRUE(RCAS_Cpu::DispatchTiled(input, nullptr, constants, tiled));
+
+        auto diff = CpuCompareImages(full, tiled, 0.0f, 3);
+        EXPECT_EQ(diff.MismatchCount, 0u) << sharpness;
+    }
+}
+
+// Only flat tiles differ, by less than the luma range which made them flat
+TEST(RcasTiled, FlatTileSkipIsBounded)
+{
+    auto input = MakeFlatImage();
+
+    RCAS_Cpu::Constants constants;
+    constants.Sharpness = 0.8f;
+    constants.TileSkipThreshold = 0.01f;
+
+    CpuTexture full;
+    CpuTexture tiled;
+    ASSERT_TRUE(RCAS_Cpu::Dispatch(input, nullptr, constants, full));
+    ASSERT_TRUE(RCAS_Cpu::DispatchTiled(input, nullptr, constants, tiled));
+
+    uint32_t flatTiles = 0;
+
+    for (uint32_t tileY = 0; tileY * RCAS_Cpu::TileSize < Height; tileY++)
+    {
+        for (uint32_t tileX = 0; tileX * RCAS_Cpu::TileSize < Width; tileX++)
+        {
+            bool flat = IsFlatTile(input, tileX, tileY, constants.TileSkipThreshold);
+            flatTiles += flat ? 1 : 0;
+
+            for (uint32_t y = tileY * RCAS_Cpu::TileSize; y < std::min((tileY + 1) * RCAS_Cpu::TileSize, Height); y++)
+            {
+                for (uint32_t x = tileX * RCAS_Cpu::TileSize; x < std::min((tileX + 1) * RCAS_Cpu::TileSize, Width);
+                     x++)
+                {
+                    for (uint32_t c = 0; c < 3; c++)
+                    {
+                        float difference = std::abs(full.Pixel(x, y)[c] - tiled.Pixel(x, y)[c]);
+
+                        if (flat)
+                            EXPECT_LE(difference, constants.TileSkipThreshold) << x << ", " << y;
+                        else
+                            EXPECT_EQ(difference, 0.0f) << x << ", " << y;
+                    }
+                }
+            }
+        }
+    }
+
+    // Tiles at the texture border read 0 outside and tiles next to the noisy area are not flat
+    EXPECT_EQ(flatTiles, 4u);
+}
+
+// Sharpness is taken once per tile, output stays between per pixel results at the lowest and highest
+// sharpness of the tile (RCAS output is monotonic in lobe)
+TEST(RcasTiled, TileMotionIsBounded)
+{
+    auto input = MakeImage(Width, Height);
+    auto mv = MakeSmoothMotion();
+
+    RCAS_Cpu::Constants constants;
+    constants.Sharpness = 0.3f;
+    constants.TileSkipThreshold = 0.0f;
+    constants.DynamicSharpenEnabled = true;
+    constants.MotionSharpness = 0.6f;
+    constants.Threshold = 0.5f;
+    constants.ScaleLimit = 20.0f;
+
+    CpuTexture full;
+    CpuTexture tiled;
+    ASSERT_TRUE(RCAS_Cpu::Dispatch(input, &mv, constants, full));
+    ASSERT_TRUE(RCAS_Cpu::DispatchTiled(input, &mv, constants, tiled));
+
+    // Partial tiles on the right and bottom take motion from outside of the texture
+    for (uint32_t tileY = 0; (tileY + 1) * RCAS_Cpu::TileSize <= Height; tileY++)
+    {
+        for (uint32_t tileX = 0; (tileX + 1) * RCAS_Cpu::TileSize <= Width; tileX++)
+        {
+            float minSharpness = 2.0f;
+            float maxSharpness = -1.0f;
+
+            for (uint32_t y = tileY * RCAS_Cpu::TileSize; y < (tileY + 1) * RCAS_Cpu::TileSize; y++)
+            {
+                for (uint32_t x = tileX * RCAS_Cpu::TileSize; x < (tileX + 1) * RCAS_Cpu::TileSize; x++)
+                {
+                    float sharpness = RCAS_Cpu::EvaluateSharpness(&mv, constants, x, y);
+                    minSharpness = std::min(minSharpness, sharpness);
+                    maxSharpness = std::max(maxSharpness, sharpness);
+                }
+            }
+
+            for (uint32_t y = tileY * RCAS_Cpu::TileSize; y < (tileY + 1) * RCAS_Cpu::TileSize; y++)
+            {
+                for (uint32_t x = tileX * RCAS_Cpu::TileSize; x < (tileX + 1) * RCAS_Cpu::TileSize; x++)
+                {
+                    auto low = RCAS_Cpu::SharpenPixel(input, constants, minSharpness, x, y);
+                    auto high = RCAS_Cpu::SharpenPixel(input, constants, maxSharpness, x, y);
+                    float lows[3] = { low.X(), low.Y(), low.Z() };
+                    float highs[3] = { high.X(), high.Y(), high.Z() };
+
+                    for (uint32_t c = 0; c < 3; c++)
+                    {
+                        float value = tiled.Pixel(x, y)[c];
+                        EXPECT_GE(value, std::min(lows[c], highs[c]) - 1e-5f) << x << ", " << y;
+                        EXPECT_LE(value, std::max(lows[c], highs[c]) + 1e-5f) << x << ", " << y;
+                    }
+                }
+            }
+        }
+    }
+
+    auto diff = CpuCompareImages(full, tiled, 1.0f, 3);
+    EXPECT_LT(diff.MeanAbsDiff, 0.005);
+}
+
+TEST(RcasTiled, Reference)
+{
+    auto input = MakeFlatImage();
+    auto mv = MakeSmoothMotion();
+
+    RCAS_Cpu::Constants constants;
+    constants.Sharpness = 0.5f;
+    constants.TileSkipThreshold = 0.01f;
+    constants.DynamicSharpenEnabled = true;
+    constants.MotionSharpness = 0.4f;
+    constants.ScaleLimit = 20.0f;
+
+    CpuTexture output;
+    ASSERT_TRUE(RCAS_Cpu::DispatchTiled(input, &mv, constants, output));
+    ExpectMatchesReference("rcas_tiled", output);
+
+    CpuTexture single;
+    ASSERT_TRUE(RCAS_Cpu::DispatchTiled(input, &mv, constants, single, 1));
+    ExpectIdentical(output, single);
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <shaders/CPU_Common.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Helpers of the CPU shader tests: deterministic inputs and stored reference images.
+// References are PFM files (rgb or single channel float) under tests/data/shaders, they can be opened with most
+// image viewers. OPTISCALER_UPDATE_REFERENCES=1 rewrites them from the current outputs.
+// OPTISCALER_GPU_REFERENCE_DIR can point to PFM dumps of the gpu kernels made with the same inputs (same names),
+// outputs are compared against those too when they exist.
+namespace ShaderTest
+{
+
+// Gradients, a hard edge, a thin line and noise so sharpening and scaling kernels have something to work on
+inline CpuTexture MakeImage(uint32_t InWidth, uint32_t InHeight, uint32_t InChannels = 4, uint32_t InSeed = 1)
+{
+    CpuTexture image(InWidth, InHeight, InChannels);
+    uint32_t state = InSeed * 747796405u + 2891336453u;
+
+    for (uint32_t y = 0; y < InHeight; y++)
+    {
+        for (uint32_t x = 0; x < InWidth; x++)
+        {
+            state = state * 1664525u + 1013904223u;
+            float noise = (float) (state >> 8) / (float) (1u << 24);
+
+            float u = (x + 0.5f) / InWidth;
+            float v = (y + 0.5f) / InHeight;
+            float edge = x > InWidth / 2 ? 0.8f : 0.1f;
+            float line = y == InHeight / 3 ? 0.5f : 0.0f;
+
+            float values[4] = { CpuSaturate(0.7f * u + 0.2f * noise + line), CpuSaturate(0.6f * v + 0.3f * edge),
+                                CpuSaturate(0.5f * edge + 0.4f * noise), 0.25f + 0.5f * u };
+
+            auto p = image.Pixel(x, y);
+
+            for (uint32_t c = 0; c < InChannels; c++)
+                p[c] = values[c % 4];
+        }
+    }
+
+    return image;
+}
+
+// Smooth motion vector field in pixels with a fast moving area on the right side
+inline CpuTexture MakeMotionVectors(uint32_t InWidth, uint32_t InHeight)
+{
+    CpuTexture mv(InWidth, InHeight, 2);
+
+    for (uint32_t y = 0; y < InHeight; y++)
+    {
+        for (uint32_t x = 0; x < InWidth; x++)
+        {
+            auto p = mv.Pixel(x, y);
+            float fast = x > InWidth * 2 / 3 ? 12.0f : 0.0f;
+            p[0] = 0.1f * x - 2.0f + fast;
+            p[1] = 0.05f * y - 1.0f;
+        }
+    }
+
+    return mv;
+}
+
+inline bool WritePfm(const std::string& InPath, const CpuTexture& InImage)
+{
+    auto file = std::fopen(InPath.c_str(), "wb");
+
+    if (file == nullptr)
+        return false;
+
+    uint32_t channels = InImage.Channels == 1 ? 1 : 3;
+    std::fprintf(file, "%s\n%u %u\n-1.0\n", channels == 1 ? "Pf" : "PF", InImage.Width, InImage.Height);
+
+    // Bottom to top rows, little endian
+    std::vector<float> row(InImage.Width * channels);
+
+    for (uint32_t y = InImage.Height; y-- > 0;)
+    {
+        for (uint32_t x = 0; x < InImage.Width; x++)
+        {
+            for (uint32_t c = 0; c < channels; c++)
+                row[x * channels + c] = c < InImage.Channels ? InImage.Pixel(x, y)[c] : 0.0f;
+        }
+
+        std::fwrite(row.data(), sizeof(float), row.size(), file);
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+inline bool ReadPfm(const std::string& InPath, CpuTexture& OutImage)
+{
+    auto file = std::fopen(InPath.c_str(), "rb");
+
+    if (file == nullptr)
+        return false;
+
+    char type[3] {};
+    uint32_t width = 0;
+    uint32_t height = 0;
+    float scale = 0.0f;
+
+    bool valid = std::fscanf(file, "%2s %u %u %f", type, &width, &height, &scale) == 4 && scale < 0.0f &&
+                 (std::string(type) == "PF" || std::string(type) == "Pf") && width > 0 && height > 0;
+
+    // Single whitespace after the scale
+    valid = valid && std::fgetc(file) != EOF;
+
+    if (valid)
+    {
+        uint32_t channels = type[1] == 'f' ? 1 : 3;
+        OutImage.Resize(width, height, channels);
+
+        for (uint32_t y = height; valid && y-- > 0;)
+            valid = std::fread(OutImage.Pixel(0, y), sizeof(float) * channels, width, file) == width;
+    }
+
+    std::fclose(file);
+    return valid;
+}
+
+inline std::string ReferencePath(const std::string& InName)
+{
+    return std::string(OPTISCALER_TEST_DATA_DIR) + "/shaders/" + InName + ".pfm";
+}
+
+// Compares InImage against the stored reference, and the gpu dump when there is one
+inline void ExpectMatchesReference(const std::string& InName, const CpuTexture& InImage, float InTolerance = 1e-5f,
+                                   float InGpuTolerance = 2.0f / 255.0f)
+{
+    auto path = ReferencePath(InName);
+
+    if (auto update = std::getenv("OPTISCALER_UPDATE_REFERENCES"); update != nullptr && update[0] == '1')
+    {
+        ASSERT_TRUE(WritePfm(path, InImage)) << path;
+        return;
+    }
+
+    CpuTexture reference;
+    ASSERT_TRUE(ReadPfm(path, reference)) << "Missing reference " << path;
+
+    auto components = reference.Channels;
+    auto diff = CpuCompareImages(reference, InImage, InTolerance, components);
+    EXPECT_FALSE(diff.SizeMismatch) << InName;
+    EXPECT_EQ(diff.MismatchCount, 0u) << InName << " max diff " << diff.MaxAbsDiff;
+
+    if (auto gpuDir = std::getenv("OPTISCALER_GPU_REFERENCE_DIR"); gpuDir != nullptr)
+    {
+        CpuTexture gpu;
+
+        if (ReadPfm(std::string(gpuDir) + "/" + InName + ".pfm", gpu))
+        {
+            auto gpuDiff = CpuCompareImages(gpu, InImage, InGpuTolerance, components);
+            EXPECT_FALSE(gpuDiff.SizeMismatch) << InName << " (gpu)";
+            EXPECT_EQ(gpuDiff.MismatchCount, 0u) << InName << " (gpu) max diff " << gpuDiff.MaxAbsDiff;
+        }
+    }
+}
+
+// Multi threaded dispatches must give the same result as a single thread
+inline void ExpectIdentical(const CpuTexture& InA, const CpuTexture& InB)
+{
+    ASSERT_EQ(InA.Width, InB.Width);
+    ASSERT_EQ(InA.Height, InB.Height);
+    ASSERT_EQ(InA.Channels, InB.Channels);
+    EXPECT_EQ(std::memcmp(InA.Data.data(), InB.Data.data(), InA.Data.size() * sizeof(float)), 0);
+}
+
+} // namespace ShaderTest
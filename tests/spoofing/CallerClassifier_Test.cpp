@@ -0,0 +1,339 @@
+#include <gtest/gtest.h>
+
+#include <spoofing/CallerClassifier.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+// Synthetic module ranges and call stacks in place of EnumProcessModules and CaptureStackBackTrace.
+// Decision of SkipSpoofing without the cache is modeled by classifying the stack every time.
+
+static const void* Frame(uint64_t InAddress) { return (const void*) (uintptr_t) InAddress; }
+
+// Game exe, two upscaler dlls and a streamline dll with gaps between them
+static std::vector<CallerClassifier::ModuleRange> SyntheticModules()
+{
+    return {
+        { 0x7ff7a0000000ull, 0x7ff7a0800000ull, 0 },
+        { 0x7ffb10000000ull, 0x7ffb10400000ull, CallerClassifier::XeSS },
+        { 0x7ffb20000000ull, 0x7ffb20200000ull, CallerClassifier::Ffx | CallerClassifier::Fsr },
+        { 0x7ffb30000000ull, 0x7ffb30100000ull, CallerClassifier::Streamline },
+    };
+}
+
+TEST(CallerClassifier, LookupRangeEdges)
+{
+    CallerClassifier classifier;
+    auto modules = SyntheticModules();
+
+    // Ranges are sorted by SetModules
+    std::reverse(modules.begin(), modules.end());
+    classifier.SetModules(modules);
+    EXPECT_EQ(classifier.ModuleCount(), 4u);
+
+    for (const auto& module : modules)
+    {
+        EXPECT_EQ(classifier.Lookup(module.Begin), module.Categories);
+        EXPECT_EQ(classifier.Lookup(module.Begin + (module.End - module.Begin) / 2), module.Categories);
+        EXPECT_EQ(classifier.Lookup(module.End - 1), module.Categories);
+        EXPECT_EQ(classifier.Lookup(module.End), 0u);
+        EXPECT_EQ(classifier.Lookup(module.Begin - 1), 0u);
+    }
+
+    EXPECT_EQ(classifier.Lookup(0), 0u);
+    EXPECT_EQ(classifier.Lookup(UINT64_MAX), 0u);
+
+    // Adjacent ranges
+    classifier.SetModules({ { 0x2000, 0x3000, 2 }, { 0x1000, 0x2000, 1 } });
+    EXPECT_EQ(classifier.Lookup(0x1fff), 1u);
+    EXPECT_EQ(classifier.Lookup(0x2000), 2u);
+    EXPECT_EQ(classifier.Lookup(0x3000), 0u);
+
+    classifier.SetModules({});
+    EXPECT_EQ(classifier.Lookup(0x1000), 0u);
+}
+
+TEST(CallerClassifier, ClassifyStacks)
+{
+    CallerClassifier classifier;
+    classifier.SetModules(SyntheticModules());
+
+    const void* gameOnly[] = { Frame(0x7ff7a0001234), Frame(0x7ff7a0100000), Frame(0x7ffc00000000) };
+    const void* xessThenFsr[] = { Frame(0x7ffb10001000), Frame(0x7ffb20003000), Frame(0x7ff7a0001234) };
+    const void* streamline[] = { Frame(0x7ffb300fffff), Frame(0x7ff7a0001234) };
+    const void* gaps[] = { Frame(0x7ffb10400000), Frame(0x7ffb20200000), Frame(0x7ffb30100000) };
+
+    EXPECT_EQ(classifier.Classify(gameOnly, 3), 0u);
+    EXPECT_EQ(classifier.Classify(xessThenFsr, 3),
+              (uint32_t) (CallerClassifier::XeSS | CallerClassifier::Ffx | CallerClassifier::Fsr));
+    EXPECT_EQ(classifier.Classify(xessThenFsr, 1), (uint32_t) CallerClassifier::XeSS);
+    EXPECT_EQ(classifier.Classify(streamline, 2), (uint32_t) CallerClassifier::Streamline);
+    EXPECT_EQ(classifier.Classify(gaps, 3), 0u);
+    EXPECT_EQ(classifier.Classify(gaps, 0), 0u);
+
+    // Random stacks against a per frame linear search
+    auto modules = SyntheticModules();
+    std::mt19937_64 random(7);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const void* frames[16];
+        uint32_t expected = 0;
+
+        for (auto& frame : frames)
+        {
+            const auto& module = modules[random() % modules.size()];
+            auto address = module.Begin - 0x1000 + random() % (module.End - module.Begin + 0x2000);
+            frame = Frame(address);
+
+            if (address >= module.Begin && address < module.End)
+                expected |= module.Categories;
+        }
+
+        ASSERT_EQ(classifier.Classify(frames, 16), expected);
+    }
+}
+
+TEST(CallerClassifier, Hash)
+{
+    const void* stack[] = { Frame(0x7ffb10001000), Frame(0x7ff7a0001234), Frame(0x7ff7a0001240) };
+    const void* reversed[] = { Frame(0x7ff7a0001240), Frame(0x7ff7a0001234), Frame(0x7ffb10001000) };
+
+    EXPECT_EQ(CallerClassifier::Hash(stack, 3), CallerClassifier::Hash(stack, 3));
+    EXPECT_NE(CallerClassifier::Hash(stack, 3), CallerClassifier::Hash(reversed, 3));
+    EXPECT_NE(CallerClassifier::Hash(stack, 3), CallerClassifier::Hash(stack, 2));
+    EXPECT_NE(CallerClassifier::Hash(stack, 0), CallerClassifier::Hash(stack, 1));
+
+    // Stacks of one game share most frames, return addresses are close to each other
+    std::mt19937_64 random(3);
+    std::unordered_set<uint64_t> hashes;
+    std::unordered_set<std::string> stacks;
+
+    for (int i = 0; i < 200000; i++)
+    {
+        const void* frames[20];
+
+        for (auto& frame : frames)
+            frame = Frame(0x7ff600000000ull + (random() % 4096) * 16);
+
+        if (stacks.emplace((const char*) frames, sizeof(frames)).second)
+            hashes.insert(CallerClassifier::Hash(frames, 20));
+    }
+
+    EXPECT_EQ(hashes.size(), stacks.size());
+}
+
+TEST(CallerClassifier, StaleDecisionsAreNotStored)
+{
+    CallerClassifier classifier;
+    EXPECT_TRUE(classifier.Refresh());
+    classifier.SetModules(SyntheticModules());
+
+    bool decision = false;
+    uint64_t generation = 0;
+
+    EXPECT_FALSE(classifier.Find(1, decision, generation));
+    classifier.Store(1, true, generation);
+    EXPECT_TRUE(classifier.Find(1, decision, generation));
+    EXPECT_TRUE(decision);
+
+    // Module table changed while the decision was made
+    uint64_t before = 0;
+    EXPECT_FALSE(classifier.Find(2, decision, before));
+    classifier.SetModules(SyntheticModules());
+    classifier.Store(2, true, before);
+    EXPECT_FALSE(classifier.Find(2, decision, generation));
+    EXPECT_FALSE(classifier.Find(1, decision, generation));
+
+    EXPECT_FALSE(classifier.Find(3, decision, before));
+    classifier.ClearDecisions();
+    classifier.Store(3, false, before);
+    EXPECT_FALSE(classifier.Find(3, decision, generation));
+
+    // Dll loaded while the decision was made
+    EXPECT_FALSE(classifier.Find(4, decision, before));
+    classifier.Store(4, false, before);
+    classifier.Invalidate();
+    EXPECT_TRUE(classifier.Find(4, decision, generation));
+    EXPECT_FALSE(decision);
+
+    EXPECT_FALSE(classifier.Find(5, decision, before));
+    EXPECT_TRUE(classifier.Refresh());
+    classifier.Store(5, true, before);
+    EXPECT_FALSE(classifier.Find(5, decision, generation));
+    EXPECT_FALSE(classifier.Find(4, decision, generation));
+    EXPECT_EQ(classifier.DecisionCount(), 0u);
+
+    // Module table is kept by Refresh, it's rebuilt by the caller
+    EXPECT_EQ(classifier.ModuleCount(), 4u);
+}
+
+TEST(CallerClassifier, RefreshOncePerInvalidate)
+{
+    CallerClassifier classifier;
+
+    EXPECT_TRUE(classifier.Refresh());
+    EXPECT_FALSE(classifier.Refresh());
+
+    classifier.Invalidate();
+    classifier.Invalidate();
+    EXPECT_TRUE(classifier.Refresh());
+    EXPECT_FALSE(classifier.Refresh());
+}
+
+TEST(CallerClassifier, MaxDecisions)
+{
+    CallerClassifier classifier;
+    bool decision = false;
+    uint64_t generation = 0;
+
+    for (uint64_t i = 0; i < CallerClassifier::MaxDecisions * 5; i++)
+    {
+        classifier.Find(i, decision, generation);
+        classifier.Store(i, (i & 1) != 0, generation);
+        ASSERT_LE(classifier.DecisionCount(), CallerClassifier::MaxDecisions);
+    }
+
+    // Latest one is always kept
+    auto last = CallerClassifier::MaxDecisions * 5 - 1;
+    EXPECT_TRUE(classifier.Find(last, decision, generation));
+    EXPECT_TRUE(decision);
+}
+
+TEST(CallerClassifier, ModuleCategories)
+{
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\Binaries\\Win64\\sl.interposer.dll"),
+              (uint32_t) CallerClassifier::Streamline);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\Binaries\\Win64\\sl.dlss_g.dll"),
+              (uint32_t) CallerClassifier::Streamline);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\libxess.dll"), (uint32_t) CallerClassifier::XeSS);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\libxess_dx11.dll"),
+              (uint32_t) CallerClassifier::XeSS);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\amd_fidelityfx_dx12.dll"),
+              (uint32_t) CallerClassifier::Ffx);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\ffx_fsr2_api_x64.dll"),
+              (uint32_t) CallerClassifier::Fsr);
+
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\Game.exe"), 0u);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Windows\\System32\\dxgi.dll"), 0u);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\nvngx_dlss.dll"), 0u);
+    EXPECT_EQ(CallerClassifier::ModuleCategories(""), 0u);
+
+    // Matched anywhere in the path like the legacy check
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\sl.Game\\Game.exe"),
+              (uint32_t) CallerClassifier::Streamline);
+    EXPECT_EQ(CallerClassifier::ModuleCategories("C:\\Games\\Game\\mysl.dll"), 0u);
+}
+
+// Dll notifications arrive on loader threads while the render thread classifies stacks
+TEST(CallerClassifier, InvalidateWhileClassifying)
+{
+    CallerClassifier classifier;
+    std::atomic<bool> done = false;
+    std::atomic<uint32_t> refreshes = 0;
+
+    std::thread loader(
+        [&]
+        {
+            for (int i = 0; i < 2000; i++)
+            {
+                classifier.Invalidate();
+                std::this_thread::yield();
+            }
+
+            done = true;
+        });
+
+    std::mt19937_64 random(11);
+    auto modules = SyntheticModules();
+
+    while (!done)
+    {
+        if (classifier.Refresh())
+        {
+            classifier.SetModules(modules);
+            refreshes++;
+        }
+
+        const void* frames[8];
+
+        for (auto& frame : frames)
+            frame = Frame(modules[random() % modules.size()].Begin + random() % 0x1000);
+
+        auto hash = CallerClassifier::Hash(frames, 8);
+        bool decision = false;
+        uint64_t generation = 0;
+
+        if (!classifier.Find(hash, decision, generation))
+        {
+            auto categories = classifier.Classify(frames, 8);
+            classifier.Store(hash, (categories & CallerClassifier::XeSS) != 0, generation);
+        }
+    }
+
+    loader.join();
+
+    EXPECT_GE(refreshes.load(), 1u);
+    EXPECT_LE(classifier.DecisionCount(), CallerClassifier::MaxDecisions);
+}
+
+// Cost of the cached path against classifying every call, timings are written as test properties
+TEST(CallerClassifier, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Process with a few hundred modules and a deep stack
+    std::vector<CallerClassifier::ModuleRange> modules;
+
+    for (uint64_t i = 0; i < 300; i++)
+        modules.push_back({ 0x10000000ull + i * 0x100000ull, 0x10000000ull + i * 0x100000ull + 0x80000,
+                            i % 5 == 0 ? (uint32_t) CallerClassifier::Fsr : 0u });
+
+    CallerClassifier classifier;
+    classifier.SetModules(modules);
+
+    std::mt19937_64 random(5);
+    const void* frames[40];
+
+    for (auto& frame : frames)
+        frame = Frame(0x10000000ull + random() % (300 * 0x100000ull));
+
+    const int calls = 1000000;
+    size_t uncachedSkips = 0;
+    auto start = Clock::now();
+
+    for (int i = 0; i < calls; i++)
+        uncachedSkips += (classifier.Classify(frames, 40) & CallerClassifier::Fsr) != 0;
+
+    auto uncachedTime = Clock::now() - start;
+
+    size_t cachedSkips = 0;
+    start = Clock::now();
+
+    for (int i = 0; i < calls; i++)
+    {
+        auto hash = CallerClassifier::Hash(frames, 40);
+        bool decision = false;
+        uint64_t generation = 0;
+
+        if (!classifier.Find(hash, decision, generation))
+        {
+            decision = (classifier.Classify(frames, 40) & CallerClassifier::Fsr) != 0;
+            classifier.Store(hash, decision, generation);
+        }
+
+        cachedSkips += decision;
+    }
+
+    auto cachedTime = Clock::now() - start;
+
+    EXPECT_EQ(cachedSkips, uncachedSkips);
+
+    auto ns = [&](Clock::duration InTime) { return std::chrono::duration<double, std::nano>(InTime).count() / calls; };
+    RecordProperty("classify_ns", std::to_string(ns(uncachedTime)));
+    RecordProperty("cached_decision_ns", std::to_string(ns(cachedTime)));
+}
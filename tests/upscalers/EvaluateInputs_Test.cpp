@@ -0,0 +1,594 @@
+#include <gtest/gtest.h>
+
+#include <upscalers/EvaluateInputs.h>
+
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+
+// Parameter map with the conversions of NVNGX_Parameters, Get succeeds when the key exists even if it was set
+// with another type and returns the converted (or zero) value
+class FakeParameters : public NVSDK_NGX_Parameter
+{
+  public:
+    enum Type
+    {
+        Float,
+        Double,
+        Int,
+        UInt,
+        ULong,
+        Pointer,
+        D3D11,
+        D3D12,
+        TypeCount,
+    };
+
+    struct Value
+    {
+        Type ValueType;
+        double Number = 0.0;
+        void* Resource = nullptr;
+    };
+
+    std::map<std::string, Value> Values;
+    mutable uint32_t Gets = 0;
+
+    void Set(const char* InName, unsigned long long InValue) override { Values[InName] = { ULong, (double) InValue }; }
+    void Set(const char* InName, float InValue) override { Values[InName] = { Float, InValue }; }
+    void Set(const char* InName, double InValue) override { Values[InName] = { Double, InValue }; }
+    void Set(const char* InName, unsigned int InValue) override { Values[InName] = { UInt, (double) InValue }; }
+    void Set(const char* InName, int InValue) override { Values[InName] = { Int, (double) InValue }; }
+    void Set(const char* InName, ID3D11Resource* InValue) override { Values[InName] = { D3D11, 0.0, InValue }; }
+    void Set(const char* InName, ID3D12Resource* InValue) override { Values[InName] = { D3D12, 0.0, InValue }; }
+    void Set(const char* InName, void* InValue) override { Values[InName] = { Pointer, 0.0, InValue }; }
+
+    NVSDK_NGX_Result Get(const char* InName, unsigned long long* OutValue) const override
+    {
+        return GetNumber(InName, OutValue, true);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, float* OutValue) const override
+    {
+        return GetNumber(InName, OutValue, false);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, double* OutValue) const override
+    {
+        return GetNumber(InName, OutValue, false);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, unsigned int* OutValue) const override
+    {
+        return GetNumber(InName, OutValue, false);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, int* OutValue) const override
+    {
+        return GetNumber(InName, OutValue, false);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, ID3D11Resource** OutValue) const override
+    {
+        return GetResource(InName, (void**) OutValue, D3D11);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, ID3D12Resource** OutValue) const override
+    {
+        return GetResource(InName, (void**) OutValue, D3D12);
+    }
+
+    NVSDK_NGX_Result Get(const char* InName, void** OutValue) const override
+    {
+        return GetResource(InName, OutValue, Pointer);
+    }
+
+    void Reset() override { Values.clear(); }
+
+  private:
+    template <typename T>
+    NVSDK_NGX_Result GetNumber(const char* InName, T* OutValue, bool InFromPointer) const
+    {
+        Gets++;
+
+        auto it = Values.find(InName);
+        if (it == Values.end())
+            return NVSDK_NGX_Result_Fail;
+
+        auto& value = it->second;
+
+        if (value.ValueType < Pointer)
+            *OutValue = (T) value.Number;
+        else if (InFromPointer && value.ValueType == Pointer)
+            *OutValue = (T) (uintptr_t) value.Resource;
+        else
+            *OutValue = {};
+
+        return NVSDK_NGX_Result_Success;
+    }
+
+    NVSDK_NGX_Result GetResource(const char* InName, void** OutValue, Type InType) const
+    {
+        Gets++;
+
+        auto it = Values.find(InName);
+        if (it == Values.end())
+            return NVSDK_NGX_Result_Fail;
+
+        auto& value = it->second;
+        *OutValue = (value.ValueType == InType || value.ValueType == Pointer) ? value.Resource : nullptr;
+
+        return NVSDK_NGX_Result_Success;
+    }
+};
+
+// Values a backend passes to the upscaler
+struct Extracted
+{
+    void* Color = nullptr;
+    void* MotionVectors = nullptr;
+    void* Output = nullptr;
+    void* Depth = nullptr;
+    void* Exposure = nullptr;
+    void* BiasColorMask = nullptr;
+    void* Reactive = nullptr;
+    bool UsesReactive = false;
+
+    float JitterX = 0.0f;
+    float JitterY = 0.0f;
+    bool Reset = false;
+
+    bool AppliesMVScale = false;
+    float MVScaleX = 1.0f;
+    float MVScaleY = 1.0f;
+
+    float FrameTimeDelta = 0.0f;
+    float PreExposure = 1.0f;
+    float ExposureScale = 1.0f;
+
+    bool HasSharpness = false;
+    float Sharpness = 0.0f;
+
+    unsigned int RenderWidth = 0;
+    unsigned int RenderHeight = 0;
+};
+
+static constexpr float DeltaTimeFallback = 16.6f;
+static constexpr unsigned int FeatureRenderWidth = 1280;
+static constexpr unsigned int FeatureRenderHeight = 720;
+
+// IFeature::GetRenderResolution before EvaluateInputs, RenderWidth() / RenderHeight() of the feature are constant
+static void LegacyRenderResolution(const NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth,
+                                   unsigned int* OutHeight)
+{
+    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, OutWidth) !=
+            NVSDK_NGX_Result_Success ||
+        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, OutHeight) !=
+            NVSDK_NGX_Result_Success)
+    {
+        unsigned int width;
+        unsigned int height;
+        unsigned int outWidth;
+        unsigned int outHeight;
+
+        if (InParameters->Get(NVSDK_NGX_Parameter_Width, &width) == NVSDK_NGX_Result_Success &&
+            InParameters->Get(NVSDK_NGX_Parameter_Height, &height) == NVSDK_NGX_Result_Success)
+        {
+            if (InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &outWidth) == NVSDK_NGX_Result_Success &&
+                InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &outHeight) == NVSDK_NGX_Result_Success)
+            {
+                *OutWidth = width < outWidth ? width : outWidth;
+                *OutHeight = width < outWidth ? height : outHeight;
+                return;
+            }
+
+            *OutWidth = width < FeatureRenderWidth ? width : FeatureRenderWidth;
+            *OutHeight = width < FeatureRenderWidth ? height : FeatureRenderHeight;
+            return;
+        }
+
+        *OutWidth = FeatureRenderWidth;
+        *OutHeight = FeatureRenderHeight;
+    }
+}
+
+// Resource query of the Dx11 / Dx12 backends, typed query first and void* if it fails.
+// Vulkan backends only used the void* query. Old code left the pointer uninitialized when both failed.
+template <typename T> static void* LegacyResource(const NVSDK_NGX_Parameter* InParameters, const char* InName)
+{
+    T* resource = nullptr;
+
+    if constexpr (std::is_same_v<T, void>)
+    {
+        InParameters->Get(InName, &resource);
+    }
+    else
+    {
+        if (InParameters->Get(InName, &resource) != NVSDK_NGX_Result_Success)
+            InParameters->Get(InName, (void**) &resource);
+    }
+
+    return resource;
+}
+
+// Evaluate of FSR2 / FSR3.1 / XeSS Dx11, Dx11on12 and Vulkan before they used EvaluateInputs
+template <typename T> static Extracted LegacyExtract(const NVSDK_NGX_Parameter* InParameters)
+{
+    Extracted result;
+
+    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &result.JitterX);
+    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &result.JitterY);
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &result.ExposureScale) != NVSDK_NGX_Result_Success)
+        result.ExposureScale = 1.0f;
+
+    unsigned int reset = 0;
+    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
+    result.Reset = (reset == 1);
+
+    LegacyRenderResolution(InParameters, &result.RenderWidth, &result.RenderHeight);
+
+    result.HasSharpness =
+        InParameters->Get(NVSDK_NGX_Parameter_Sharpness, &result.Sharpness) == NVSDK_NGX_Result_Success;
+
+    result.Color = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_Color);
+    result.MotionVectors = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_MotionVectors);
+    result.Output = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_Output);
+    result.Depth = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_Depth);
+    result.Exposure = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_ExposureTexture);
+    result.BiasColorMask = LegacyResource<T>(InParameters, NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask);
+
+    // XeSS Vulkan
+    if constexpr (std::is_same_v<T, void>)
+        result.UsesReactive = InParameters->Get("FSR.reactive", &result.Reactive) == NVSDK_NGX_Result_Success;
+
+    float mvScaleX = 1.0f;
+    float mvScaleY = 1.0f;
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &mvScaleX) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &mvScaleY) == NVSDK_NGX_Result_Success)
+    {
+        result.AppliesMVScale = true;
+        result.MVScaleX = mvScaleX;
+        result.MVScaleY = mvScaleY;
+    }
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &result.FrameTimeDelta) !=
+            NVSDK_NGX_Result_Success ||
+        result.FrameTimeDelta < 1.0f)
+        result.FrameTimeDelta = DeltaTimeFallback;
+
+    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &result.PreExposure) != NVSDK_NGX_Result_Success)
+        result.PreExposure = 1.0f;
+
+    return result;
+}
+
+// Same values from EvaluateInputs like the migrated backends
+static Extracted Extract(const EvaluateInputs& InInputs, bool InVulkan)
+{
+    Extracted result;
+
+    result.JitterX = InInputs.JitterX;
+    result.JitterY = InInputs.JitterY;
+    result.ExposureScale = InInputs.ExposureScale;
+    result.Reset = (InInputs.Reset == 1);
+
+    if (InInputs.HasSubrect)
+    {
+        result.RenderWidth = InInputs.SubrectWidth;
+        result.RenderHeight = InInputs.SubrectHeight;
+    }
+    else if (InInputs.HasSize && InInputs.HasOutSize)
+    {
+        result.RenderWidth = InInputs.Width < InInputs.OutWidth ? InInputs.Width : InInputs.OutWidth;
+        result.RenderHeight = InInputs.Width < InInputs.OutWidth ? InInputs.Height : InInputs.OutHeight;
+    }
+    else if (InInputs.HasSize)
+    {
+        result.RenderWidth = InInputs.Width < FeatureRenderWidth ? InInputs.Width : FeatureRenderWidth;
+        result.RenderHeight = InInputs.Width < FeatureRenderWidth ? InInputs.Height : FeatureRenderHeight;
+    }
+    else
+    {
+        result.RenderWidth = FeatureRenderWidth;
+        result.RenderHeight = FeatureRenderHeight;
+    }
+
+    result.HasSharpness = InInputs.HasSharpness;
+    result.Sharpness = InInputs.Sharpness;
+
+    result.Color = InInputs.Color;
+    result.MotionVectors = InInputs.MotionVectors;
+    result.Output = InInputs.Output;
+    result.Depth = InInputs.Depth;
+    result.Exposure = InInputs.Exposure;
+    result.BiasColorMask = InInputs.BiasColorMask;
+
+    if (InVulkan)
+    {
+        result.UsesReactive = InInputs.HasReactive;
+        result.Reactive = InInputs.Reactive;
+    }
+
+    if (InInputs.HasMVScale)
+    {
+        result.AppliesMVScale = true;
+        result.MVScaleX = InInputs.MVScaleX;
+        result.MVScaleY = InInputs.MVScaleY;
+    }
+
+    if (InInputs.HasFrameTimeDelta)
+        result.FrameTimeDelta = InInputs.FrameTimeDelta;
+
+    if (!InInputs.HasFrameTimeDelta || result.FrameTimeDelta < 1.0f)
+        result.FrameTimeDelta = DeltaTimeFallback;
+
+    result.PreExposure = InInputs.PreExposure;
+
+    return result;
+}
+
+static void ExpectSame(const Extracted& InLegacy, const Extracted& InInputs, int InCase)
+{
+    EXPECT_EQ(InInputs.Color, InLegacy.Color) << InCase;
+    EXPECT_EQ(InInputs.MotionVectors, InLegacy.MotionVectors) << InCase;
+    EXPECT_EQ(InInputs.Output, InLegacy.Output) << InCase;
+    EXPECT_EQ(InInputs.Depth, InLegacy.Depth) << InCase;
+    EXPECT_EQ(InInputs.Exposure, InLegacy.Exposure) << InCase;
+    EXPECT_EQ(InInputs.BiasColorMask, InLegacy.BiasColorMask) << InCase;
+    EXPECT_EQ(InInputs.Reactive, InLegacy.Reactive) << InCase;
+    EXPECT_EQ(InInputs.UsesReactive, InLegacy.UsesReactive) << InCase;
+
+    EXPECT_EQ(InInputs.JitterX, InLegacy.JitterX) << InCase;
+    EXPECT_EQ(InInputs.JitterY, InLegacy.JitterY) << InCase;
+    EXPECT_EQ(InInputs.Reset, InLegacy.Reset) << InCase;
+
+    EXPECT_EQ(InInputs.AppliesMVScale, InLegacy.AppliesMVScale) << InCase;
+    EXPECT_EQ(InInputs.MVScaleX, InLegacy.MVScaleX) << InCase;
+    EXPECT_EQ(InInputs.MVScaleY, InLegacy.MVScaleY) << InCase;
+
+    EXPECT_EQ(InInputs.FrameTimeDelta, InLegacy.FrameTimeDelta) << InCase;
+    EXPECT_EQ(InInputs.PreExposure, InLegacy.PreExposure) << InCase;
+    EXPECT_EQ(InInputs.ExposureScale, InLegacy.ExposureScale) << InCase;
+
+    EXPECT_EQ(InInputs.HasSharpness, InLegacy.HasSharpness) << InCase;
+    EXPECT_EQ(InInputs.Sharpness, InLegacy.Sharpness) << InCase;
+
+    EXPECT_EQ(InInputs.RenderWidth, InLegacy.RenderWidth) << InCase;
+    EXPECT_EQ(InInputs.RenderHeight, InLegacy.RenderHeight) << InCase;
+}
+
+static const char* ResourceNames[] = {
+    NVSDK_NGX_Parameter_Color,
+    NVSDK_NGX_Parameter_MotionVectors,
+    NVSDK_NGX_Parameter_Output,
+    NVSDK_NGX_Parameter_Depth,
+    NVSDK_NGX_Parameter_ExposureTexture,
+    NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask,
+    "FSR.reactive",
+    "FSR.transparencyAndComposition",
+};
+
+static const char* NumberNames[] = {
+    NVSDK_NGX_Parameter_Jitter_Offset_X,
+    NVSDK_NGX_Parameter_Jitter_Offset_Y,
+    NVSDK_NGX_Parameter_Reset,
+    NVSDK_NGX_Parameter_MV_Scale_X,
+    NVSDK_NGX_Parameter_MV_Scale_Y,
+    NVSDK_NGX_Parameter_FrameTimeDeltaInMsec,
+    NVSDK_NGX_Parameter_DLSS_Pre_Exposure,
+    NVSDK_NGX_Parameter_DLSS_Exposure_Scale,
+    NVSDK_NGX_Parameter_Sharpness,
+    NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width,
+    NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height,
+    NVSDK_NGX_Parameter_Width,
+    NVSDK_NGX_Parameter_Height,
+    NVSDK_NGX_Parameter_OutWidth,
+    NVSDK_NGX_Parameter_OutHeight,
+};
+
+// Parameters of a game, each key is missing or set with a random type. Games mostly use the typed setters of
+// the NGX helpers but some set resources as void* or numbers with other types.
+static void RandomParameters(std::mt19937& InRng, FakeParameters& OutParameters)
+{
+    OutParameters.Reset();
+
+    for (auto name : ResourceNames)
+    {
+        auto type = InRng() % 6;
+
+        if (type == 0)
+            continue;
+
+        auto resource = (InRng() % 8 == 0) ? nullptr : (void*) (uintptr_t) (0x1000 + (InRng() % 64) * 0x100);
+
+        if (type == 1 || type == 2)
+            OutParameters.Set(name, resource);
+        else if (type == 3)
+            OutParameters.Set(name, (ID3D11Resource*) resource);
+        else if (type == 4)
+            OutParameters.Set(name, (ID3D12Resource*) resource);
+        else
+            OutParameters.Set(name, 1.0f);
+    }
+
+    for (auto name : NumberNames)
+    {
+        auto type = InRng() % (FakeParameters::TypeCount + 2);
+        auto value = (InRng() % 4000) / 4.0 - 200.0;
+
+        // Sizes and reset are small positive integers
+        std::string key(name);
+
+        if (key == NVSDK_NGX_Parameter_Reset)
+            value = InRng() % 3;
+        else if (key != NVSDK_NGX_Parameter_Jitter_Offset_X && key != NVSDK_NGX_Parameter_Jitter_Offset_Y &&
+                 key != NVSDK_NGX_Parameter_MV_Scale_X && key != NVSDK_NGX_Parameter_MV_Scale_Y)
+            value = std::abs(value);
+
+        switch (type)
+        {
+        case FakeParameters::Float:
+            OutParameters.Set(name, (float) value);
+            break;
+        case FakeParameters::Double:
+            OutParameters.Set(name, value);
+            break;
+        case FakeParameters::Int:
+            OutParameters.Set(name, (int) value);
+            break;
+        case FakeParameters::UInt:
+            OutParameters.Set(name, (unsigned int) std::abs(value));
+            break;
+        case FakeParameters::ULong:
+            OutParameters.Set(name, (unsigned long long) std::abs(value));
+            break;
+        case FakeParameters::Pointer:
+            OutParameters.Set(name, (void*) nullptr);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+TEST(EvaluateInputs, MatchesDx11Backends)
+{
+    std::mt19937 rng(11);
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        RandomParameters(rng, parameters);
+        inputs.Read(&parameters, EvaluateInputs::Dx11);
+
+        ExpectSame(LegacyExtract<ID3D11Resource>(&parameters), Extract(inputs, false), i);
+
+        if (::testing::Test::HasFailure())
+            return;
+    }
+}
+
+TEST(EvaluateInputs, MatchesDx12Backends)
+{
+    std::mt19937 rng(12);
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        RandomParameters(rng, parameters);
+        inputs.Read(&parameters, EvaluateInputs::Dx12);
+
+        ExpectSame(LegacyExtract<ID3D12Resource>(&parameters), Extract(inputs, false), i);
+
+        if (::testing::Test::HasFailure())
+            return;
+    }
+}
+
+TEST(EvaluateInputs, MatchesVulkanBackends)
+{
+    std::mt19937 rng(13);
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        RandomParameters(rng, parameters);
+        inputs.Read(&parameters, EvaluateInputs::Vulkan);
+
+        ExpectSame(LegacyExtract<void>(&parameters), Extract(inputs, true), i);
+
+        if (::testing::Test::HasFailure())
+            return;
+    }
+}
+
+TEST(EvaluateInputs, ResourceTypes)
+{
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    auto color = (void*) 0x1000;
+    auto depth = (void*) 0x2000;
+
+    parameters.Set(NVSDK_NGX_Parameter_Color, (ID3D12Resource*) color);
+    parameters.Set(NVSDK_NGX_Parameter_Depth, depth);
+
+    inputs.Read(&parameters, EvaluateInputs::Dx12);
+    EXPECT_EQ(inputs.Color, color);
+    EXPECT_EQ(inputs.Depth, depth);
+
+    // Resource of another api isn't returned
+    inputs.Read(&parameters, EvaluateInputs::Dx11);
+    EXPECT_EQ(inputs.Color, nullptr);
+    EXPECT_EQ(inputs.Depth, depth);
+
+    inputs.Read(&parameters, EvaluateInputs::Vulkan);
+    EXPECT_EQ(inputs.Color, nullptr);
+    EXPECT_EQ(inputs.Depth, depth);
+
+    // FSR.reactive set to null still selects the reactive path of XeSS
+    parameters.Set("FSR.reactive", (void*) nullptr);
+    inputs.Read(&parameters, EvaluateInputs::Vulkan);
+    EXPECT_TRUE(inputs.HasReactive);
+    EXPECT_EQ(inputs.Reactive, nullptr);
+}
+
+TEST(EvaluateInputs, Defaults)
+{
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    parameters.Set(NVSDK_NGX_Parameter_Color, (void*) 0x1000);
+    parameters.Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, 0.25f);
+    parameters.Set(NVSDK_NGX_Parameter_MV_Scale_X, -1280.0f);
+
+    inputs.Read(&parameters, EvaluateInputs::Dx12);
+
+    // Only one of the pairs, jitter is still read like the backends did
+    EXPECT_FALSE(inputs.HasJitter);
+    EXPECT_EQ(inputs.JitterY, 0.25f);
+    EXPECT_FALSE(inputs.HasMVScale);
+    EXPECT_EQ(inputs.MVScaleX, 1.0f);
+    EXPECT_EQ(inputs.MVScaleY, 1.0f);
+
+    EXPECT_EQ(inputs.PreExposure, 1.0f);
+    EXPECT_EQ(inputs.ExposureScale, 1.0f);
+    EXPECT_EQ(inputs.Reset, 0u);
+    EXPECT_FALSE(inputs.HasSubrect);
+    EXPECT_FALSE(inputs.HasSize);
+
+    // Previous frame's values don't leak into the next read
+    FakeParameters empty;
+    inputs.Read(&empty, EvaluateInputs::Dx12);
+    EXPECT_EQ(inputs.Color, nullptr);
+    EXPECT_EQ(inputs.JitterY, 0.0f);
+
+    inputs.Read(nullptr, EvaluateInputs::Dx12);
+    EXPECT_EQ(inputs.Color, nullptr);
+}
+
+TEST(EvaluateInputs, QueriesEachParameterOnce)
+{
+    std::mt19937 rng(14);
+    FakeParameters parameters;
+    EvaluateInputs inputs;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        RandomParameters(rng, parameters);
+
+        parameters.Gets = 0;
+        inputs.Read(&parameters, EvaluateInputs::Dx11);
+
+        // One query per parameter plus the void* fallback of missing resources
+        ASSERT_LE(parameters.Gets, std::size(ResourceNames) * 2 + std::size(NumberNames)) << i;
+    }
+}
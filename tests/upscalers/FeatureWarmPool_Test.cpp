@@ -0,0 +1,445 @@
+#include <gtest/gtest.h>
+
+#include <upscalers/FeatureWarmPool.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using Key = FeatureWarmPool::Key;
+
+static Key MakeKey(const std::string& InBackend, uint32_t InDisplayWidth, uint32_t InDisplayHeight)
+{
+    return { InBackend, InDisplayWidth, InDisplayHeight, InDisplayWidth, InDisplayHeight, 1, 0 };
+}
+
+TEST(FeatureWarmPool, Lifecycle)
+{
+    FeatureWarmPool pool;
+    auto key = MakeKey("fsr31", 2560, 1440);
+    Key created;
+
+    EXPECT_FALSE(pool.BeginCreate(created));
+    EXPECT_EQ(pool.Request(key), FeatureWarmPool::Start);
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Requested);
+    EXPECT_TRUE(pool.IsBusy());
+
+    // Worker can't be cancelled
+    EXPECT_EQ(pool.Request(MakeKey("xess", 2560, 1440)), FeatureWarmPool::Wait);
+    EXPECT_FALSE(pool.Take(key));
+
+    ASSERT_TRUE(pool.BeginCreate(created));
+    EXPECT_EQ(created, key);
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Creating);
+    EXPECT_FALSE(pool.BeginCreate(created));
+
+    pool.Created(true);
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Ready);
+    EXPECT_FALSE(pool.IsBusy());
+    EXPECT_EQ(pool.Request(key), FeatureWarmPool::Wait);
+    EXPECT_EQ(pool.ReadyKey(), key);
+
+    EXPECT_TRUE(pool.Take(key));
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Empty);
+    EXPECT_FALSE(pool.Take(key));
+    EXPECT_EQ(pool.TakenCount(), 1u);
+}
+
+TEST(FeatureWarmPool, OutdatedFeatureIsDiscarded)
+{
+    FeatureWarmPool pool;
+    auto first = MakeKey("fsr31", 2560, 1440);
+    auto second = MakeKey("xess", 2560, 1440);
+    Key created;
+
+    pool.Request(first);
+    pool.BeginCreate(created);
+    pool.Created(true);
+
+    EXPECT_FALSE(pool.Take(second));
+    EXPECT_EQ(pool.Request(second), FeatureWarmPool::Discard);
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Ready);
+
+    pool.Clear();
+    EXPECT_EQ(pool.Request(second), FeatureWarmPool::Start);
+}
+
+TEST(FeatureWarmPool, FailedKeyFallsBackToSynchronous)
+{
+    FeatureWarmPool pool;
+    auto key = MakeKey("fsr22", 1920, 1080);
+    Key created;
+
+    pool.Request(key);
+    pool.BeginCreate(created);
+    pool.Created(false);
+
+    EXPECT_EQ(pool.State(), FeatureWarmPool::Failed);
+    EXPECT_EQ(pool.FailedCount(), 1u);
+    EXPECT_FALSE(pool.Take(key));
+
+    // Not retried for the same key
+    EXPECT_EQ(pool.Request(key), FeatureWarmPool::Synchronous);
+    EXPECT_EQ(pool.Request(key), FeatureWarmPool::Synchronous);
+
+    EXPECT_EQ(pool.Request(MakeKey("fsr22", 2560, 1440)), FeatureWarmPool::Start);
+}
+
+TEST(FeatureWarmPool, RenderSizeBucket)
+{
+    auto bucket = MakeKey("xess", 2560, 1440);
+    auto dynamic = bucket;
+    dynamic.RenderWidth = 1707;
+    dynamic.RenderHeight = 960;
+
+    EXPECT_TRUE(bucket.Covers(dynamic));
+    EXPECT_FALSE(dynamic.Covers(bucket));
+
+    auto other = dynamic;
+    other.DisplayWidth = 1920;
+    EXPECT_FALSE(bucket.Covers(other));
+
+    other = dynamic;
+    other.Flags = 1;
+    EXPECT_FALSE(bucket.Covers(other));
+
+    // Dynamic resolution doesn't discard the created feature
+    FeatureWarmPool pool;
+    Key created;
+    pool.Request(bucket);
+    pool.BeginCreate(created);
+    pool.Created(true);
+
+    EXPECT_EQ(pool.Request(dynamic), FeatureWarmPool::Wait);
+    EXPECT_TRUE(pool.Take(dynamic));
+}
+
+TEST(FeatureWarmPool, PredictSelectedBackend)
+{
+    FeatureWarmPool pool;
+    auto current = MakeKey("xess", 2560, 1440);
+    Key next;
+
+    pool.Observe(current);
+    EXPECT_FALSE(pool.Predict(current, "", next));
+    EXPECT_FALSE(pool.Predict(current, "xess", next));
+
+    ASSERT_TRUE(pool.Predict(current, "fsr31", next));
+    auto expected = current;
+    expected.Backend = "fsr31";
+    EXPECT_EQ(next, expected);
+}
+
+TEST(FeatureWarmPool, PredictPreviousOutputResolution)
+{
+    FeatureWarmPool pool;
+    auto large = MakeKey("fsr22", 2560, 1440);
+    auto small = MakeKey("fsr22", 1920, 1080);
+    Key next;
+
+    pool.Observe(large);
+    pool.Observe(small);
+
+    ASSERT_TRUE(pool.Predict(small, "", next));
+    EXPECT_EQ(next, large);
+
+    ASSERT_TRUE(pool.Predict(large, "", next));
+    EXPECT_EQ(next, small);
+
+    // Selected backend wins
+    ASSERT_TRUE(pool.Predict(small, "fsr31", next));
+    EXPECT_EQ(next.Backend, "fsr31");
+    EXPECT_EQ(next.DisplayWidth, 1920u);
+
+    // Bucket keeps the largest render size of the output resolution
+    auto extended = small;
+    extended.RenderWidth = 2200;
+    extended.RenderHeight = 1240;
+    pool.Observe(extended);
+    pool.Observe(large);
+
+    ASSERT_TRUE(pool.Predict(large, "", next));
+    EXPECT_EQ(next.RenderWidth, 2200u);
+    EXPECT_EQ(next.RenderHeight, 1240u);
+
+    // Current backend and flags are used for older entries
+    auto changed = large;
+    changed.Backend = "xess";
+    changed.Flags = 4;
+    ASSERT_TRUE(pool.Predict(changed, "", next));
+    EXPECT_EQ(next.Backend, "xess");
+    EXPECT_EQ(next.Flags, 4);
+    EXPECT_EQ(next.DisplayWidth, 1920u);
+}
+
+TEST(FeatureWarmPool, OutputHistoryIsLimited)
+{
+    FeatureWarmPool pool;
+    Key next;
+
+    for (uint32_t i = 0; i <= FeatureWarmPool::MaxOutputHistory; i++)
+        pool.Observe(MakeKey("xess", 1000 + i, 1000));
+
+    // Most recent other resolution
+    auto current = MakeKey("xess", 1000 + FeatureWarmPool::MaxOutputHistory, 1000);
+    ASSERT_TRUE(pool.Predict(current, "", next));
+    EXPECT_EQ(next.DisplayWidth, 999u + FeatureWarmPool::MaxOutputHistory);
+
+    // Oldest one was dropped, observing it again makes it the newest
+    pool.Observe(MakeKey("xess", 1000, 1000));
+    ASSERT_TRUE(pool.Predict(MakeKey("xess", 1000, 1000), "", next));
+    EXPECT_EQ(next.DisplayWidth, 1000u + FeatureWarmPool::MaxOutputHistory);
+}
+
+// Evaluate loop of NVNGX_DLSS_Dx12 (WarmBackendChange & WarmPreCreate) with a worker thread creating features
+class WarmEvaluator
+{
+  public:
+    struct Feature
+    {
+        Key Created;
+    };
+
+    FeatureWarmPool Pool;
+    std::unique_ptr<Feature> Current;
+    std::unique_ptr<Feature> Warm;
+    std::thread Worker;
+
+    std::chrono::milliseconds CreateTime { 20 };
+    bool FailCreation = false;
+    bool PreCreate = true;
+
+    uint32_t SynchronousChanges = 0;
+    uint32_t WarmChanges = 0;
+
+    explicit WarmEvaluator(const Key& InKey) : Current(std::make_unique<Feature>(Feature { InKey })) {}
+
+    ~WarmEvaluator()
+    {
+        if (Worker.joinable())
+            Worker.join();
+    }
+
+    void StartWorker()
+    {
+        if (Worker.joinable())
+            Worker.join();
+
+        Worker = std::thread(
+            [this]
+            {
+                Key key;
+                if (!Pool.BeginCreate(key))
+                    return;
+
+                std::this_thread::sleep_for(CreateTime);
+
+                if (!FailCreation)
+                    Warm = std::make_unique<Feature>(Feature { key });
+
+                Pool.Created(!FailCreation);
+            });
+    }
+
+    // One evaluate, InWanted is the feature game & menu ask for
+    void Evaluate(const Key& InWanted, const std::string& InSelected = "")
+    {
+        auto outputChanged = InWanted.DisplayWidth != Current->Created.DisplayWidth ||
+                             InWanted.DisplayHeight != Current->Created.DisplayHeight;
+
+        if (!Current->Created.Covers(InWanted))
+        {
+            if (Pool.Take(InWanted))
+            {
+                Worker.join();
+                Current = std::move(Warm);
+                WarmChanges++;
+                return;
+            }
+
+            if (!outputChanged)
+            {
+                switch (Pool.Request(InWanted))
+                {
+                case FeatureWarmPool::Start:
+                    StartWorker();
+                    return;
+
+                case FeatureWarmPool::Discard:
+                    Warm.reset();
+                    Pool.Clear();
+                    return;
+
+                case FeatureWarmPool::Wait:
+                    return;
+
+                default:
+                    break;
+                }
+            }
+
+            Current = std::make_unique<Feature>(Feature { InWanted });
+            SynchronousChanges++;
+            return;
+        }
+
+        if (!PreCreate)
+            return;
+
+        Pool.Observe(Current->Created);
+
+        Key next;
+        if (!Pool.Predict(Current->Created, InSelected, next))
+        {
+            if (Pool.State() == FeatureWarmPool::Ready)
+            {
+                Warm.reset();
+                Pool.Clear();
+            }
+
+            return;
+        }
+
+        switch (Pool.Request(next))
+        {
+        case FeatureWarmPool::Start:
+            StartWorker();
+            break;
+
+        case FeatureWarmPool::Discard:
+            Warm.reset();
+            Pool.Clear();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    // Evaluates until the pool is not creating anything
+    void Settle(const Key& InWanted, const std::string& InSelected = "")
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            Evaluate(InWanted, InSelected);
+
+            if (!Pool.IsBusy() && Current->Created.Covers(InWanted))
+                break;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        Evaluate(InWanted, InSelected);
+    }
+};
+
+TEST(FeatureWarmPool, BackendChangeKeepsCurrentFeature)
+{
+    auto xess = MakeKey("xess", 2560, 1440);
+    auto fsr = MakeKey("fsr31", 2560, 1440);
+
+    WarmEvaluator evaluator(xess);
+    evaluator.PreCreate = false;
+
+    evaluator.Evaluate(fsr);
+    EXPECT_EQ(evaluator.Current->Created, xess);
+
+    evaluator.Settle(fsr);
+    EXPECT_EQ(evaluator.Current->Created, fsr);
+    EXPECT_EQ(evaluator.WarmChanges, 1u);
+    EXPECT_EQ(evaluator.SynchronousChanges, 0u);
+}
+
+TEST(FeatureWarmPool, SelectedBackendIsReadyWhenApplied)
+{
+    auto xess = MakeKey("xess", 2560, 1440);
+    auto fsr = MakeKey("fsr31", 2560, 1440);
+
+    WarmEvaluator evaluator(xess);
+
+    // Selected in menu, not applied yet
+    evaluator.Settle(xess, "fsr31");
+    EXPECT_EQ(evaluator.Pool.State(), FeatureWarmPool::Ready);
+    EXPECT_EQ(evaluator.Current->Created, xess);
+
+    // Apply swaps in the same evaluate
+    evaluator.Evaluate(fsr);
+    EXPECT_EQ(evaluator.Current->Created, fsr);
+    EXPECT_EQ(evaluator.WarmChanges, 1u);
+    EXPECT_EQ(evaluator.SynchronousChanges, 0u);
+
+    // Selection is cleared after the change, nothing else is predicted
+    evaluator.Evaluate(fsr);
+    EXPECT_EQ(evaluator.Pool.State(), FeatureWarmPool::Empty);
+}
+
+TEST(FeatureWarmPool, OutputResolutionTogglesAreWarm)
+{
+    auto large = MakeKey("fsr22", 2560, 1440);
+    auto small = MakeKey("fsr22", 1920, 1080);
+
+    WarmEvaluator evaluator(large);
+    evaluator.Settle(large);
+
+    // First change can't be predicted
+    evaluator.Evaluate(small);
+    EXPECT_EQ(evaluator.SynchronousChanges, 1u);
+
+    for (int i = 0; i < 6; i++)
+    {
+        auto& from = (i % 2) == 0 ? small : large;
+        auto& to = (i % 2) == 0 ? large : small;
+
+        evaluator.Settle(from);
+        EXPECT_EQ(evaluator.Pool.State(), FeatureWarmPool::Ready);
+        EXPECT_EQ(evaluator.Pool.ReadyKey(), to);
+
+        evaluator.Evaluate(to);
+        EXPECT_EQ(evaluator.Current->Created, to);
+    }
+
+    EXPECT_EQ(evaluator.SynchronousChanges, 1u);
+    EXPECT_EQ(evaluator.WarmChanges, 6u);
+}
+
+TEST(FeatureWarmPool, DynamicRenderSizeDoesNotChurn)
+{
+    auto bucket = MakeKey("xess", 2560, 1440);
+    WarmEvaluator evaluator(bucket);
+    evaluator.Settle(bucket, "fsr31");
+
+    ASSERT_EQ(evaluator.Pool.State(), FeatureWarmPool::Ready);
+
+    // Render size changes every frame, current and warm features stay
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        auto wanted = bucket;
+        wanted.RenderWidth = 1280 + i * 12;
+        wanted.RenderHeight = 720 + i * 7;
+        evaluator.Evaluate(wanted, "fsr31");
+    }
+
+    EXPECT_EQ(evaluator.Pool.State(), FeatureWarmPool::Ready);
+    EXPECT_EQ(evaluator.Current->Created, bucket);
+    EXPECT_EQ(evaluator.SynchronousChanges, 0u);
+}
+
+TEST(FeatureWarmPool, FailedCreationFallsBack)
+{
+    auto xess = MakeKey("xess", 2560, 1440);
+    auto fsr = MakeKey("fsr31", 2560, 1440);
+
+    WarmEvaluator evaluator(xess);
+    evaluator.FailCreation = true;
+
+    evaluator.Settle(xess, "fsr31");
+    EXPECT_EQ(evaluator.Pool.State(), FeatureWarmPool::Failed);
+
+    // Not retried while selection stays
+    evaluator.Evaluate(xess, "fsr31");
+    EXPECT_EQ(evaluator.Pool.FailedCount(), 1u);
+
+    evaluator.Evaluate(fsr);
+    EXPECT_EQ(evaluator.Current->Created, fsr);
+    EXPECT_EQ(evaluator.SynchronousChanges, 1u);
+}
@@ -0,0 +1,105 @@
+#include <upscalers/FrameRing.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+
+TEST(FrameRing, DepthIsClamped)
+{
+    EXPECT_EQ(FrameRing().Depth(), 2u);
+    EXPECT_EQ(FrameRing(0).Depth(), 2u);
+    EXPECT_EQ(FrameRing(1).Depth(), 2u);
+    EXPECT_EQ(FrameRing(3).Depth(), 3u);
+    EXPECT_EQ(FrameRing(9).Depth(), FrameRing::MaxDepth);
+}
+
+TEST(FrameRing, RotatesSlotsAndFenceValues)
+{
+    FrameRing ring(3);
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        // GPU keeps up, nothing to wait
+        auto frame = ring.Begin(ring.LastValue());
+        EXPECT_EQ(frame.Slot, i % 3);
+        EXPECT_EQ(frame.WaitValue, 0u);
+        EXPECT_EQ(ring.Submit(), i + 1);
+        EXPECT_EQ(ring.LastValue(), i + 1);
+    }
+
+    EXPECT_EQ(ring.CpuWaitCount(), 0u);
+}
+
+TEST(FrameRing, WaitsOnlyWhenExhausted)
+{
+    FrameRing ring(3);
+
+    // Nothing completed, first Depth frames use free slots
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(ring.Begin(0).WaitValue, 0u);
+        ring.Submit();
+    }
+
+    // Slot 0 was submitted with value 1
+    auto frame = ring.Begin(0);
+    EXPECT_EQ(frame.Slot, 0u);
+    EXPECT_EQ(frame.WaitValue, 1u);
+    EXPECT_EQ(ring.CpuWaitCount(), 1u);
+
+    // Completed by then, no wait
+    EXPECT_EQ(ring.Begin(1).WaitValue, 0u);
+    EXPECT_EQ(ring.CpuWaitCount(), 1u);
+    ring.Submit();
+
+    // Slot 1 has value 2
+    frame = ring.Begin(1);
+    EXPECT_EQ(frame.Slot, 1u);
+    EXPECT_EQ(frame.WaitValue, 2u);
+}
+
+// GPU completes frames InLag submissions behind the CPU, CPU waits like ProcessDx11Textures
+static uint64_t SimulateLaggingGpu(uint32_t InDepth, uint32_t InLag, uint32_t InFrames)
+{
+    FrameRing ring(InDepth);
+    uint64_t completed = 0;
+    std::deque<uint64_t> inFlight;
+
+    for (uint32_t i = 0; i < InFrames; i++)
+    {
+        auto frame = ring.Begin(completed);
+        EXPECT_EQ(frame.Slot, i % ring.Depth());
+
+        while (frame.WaitValue != 0 && completed < frame.WaitValue)
+        {
+            completed = inFlight.front();
+            inFlight.pop_front();
+        }
+
+        // Slot is never reused while the GPU can still use it
+        EXPECT_LE(inFlight.size(), ring.Depth() - 1);
+
+        inFlight.push_back(ring.Submit());
+
+        while (inFlight.size() > InLag)
+        {
+            completed = inFlight.front();
+            inFlight.pop_front();
+        }
+    }
+
+    return ring.CpuWaitCount();
+}
+
+TEST(FrameRing, DeeperRingAbsorbsLag)
+{
+    // GPU two frames behind, a ring of 2 waits every frame after the first ones
+    EXPECT_EQ(SimulateLaggingGpu(2, 2, 100), 98u);
+
+    // Ring of 3 has room for both frames in flight
+    EXPECT_EQ(SimulateLaggingGpu(3, 2, 100), 0u);
+    EXPECT_EQ(SimulateLaggingGpu(4, 2, 100), 0u);
+
+    // Lag beyond the depth always waits
+    EXPECT_GT(SimulateLaggingGpu(4, 6, 100), 0u);
+}
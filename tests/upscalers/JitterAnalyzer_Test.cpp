@@ -0,0 +1,378 @@
+#include <gtest/gtest.h>
+
+#include <upscalers/JitterAnalyzer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Counts heap allocations of the test binary, AddSample must not allocate.
+// Forwards to the aligned operators of the runtime so new & delete stay a matching pair.
+static std::atomic<uint64_t> allocations { 0 };
+static constexpr std::align_val_t HeapAlignment { __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+void* operator new(size_t InSize)
+{
+    allocations++;
+    return ::operator new(InSize, HeapAlignment);
+}
+
+void operator delete(void* InPtr) noexcept { ::operator delete(InPtr, HeapAlignment); }
+void operator delete(void* InPtr, size_t) noexcept { ::operator delete(InPtr, HeapAlignment); }
+
+static constexpr uint32_t RenderWidth = 1707;
+static constexpr uint32_t RenderHeight = 960;
+
+static float Halton(uint32_t InIndex, uint32_t InBase)
+{
+    float f = 1.0f;
+    float result = 0.0f;
+
+    for (; InIndex > 0; InIndex /= InBase)
+    {
+        f /= InBase;
+        result += f * (InIndex % InBase);
+    }
+
+    return result;
+}
+
+// Jitter of a game, Halton(2, 3) - 0.5 in the units and signs it passes to DLSS
+struct JitterSequence
+{
+    uint32_t Phases = 8;
+    JitterAnalyzer::Units Units = JitterAnalyzer::Units::Pixels;
+    float SignX = 1.0f;
+    float SignY = 1.0f;
+    float Noise = 0.0f; // in render pixels
+    uint32_t FirstIndex = 1;
+
+    void Get(uint32_t InFrame, std::mt19937& InRng, float& OutX, float& OutY) const
+    {
+        auto index = InFrame % Phases + FirstIndex;
+        std::uniform_real_distribution<float> noise(-Noise, Noise);
+
+        OutX = (Halton(index, 2) - 0.5f + noise(InRng)) * SignX;
+        OutY = (Halton(index, 3) - 0.5f + noise(InRng)) * SignY;
+
+        if (Units == JitterAnalyzer::Units::Ndc)
+        {
+            OutX *= 2.0f / RenderWidth;
+            OutY *= 2.0f / RenderHeight;
+        }
+        else if (Units == JitterAnalyzer::Units::Uv)
+        {
+            OutX /= RenderWidth;
+            OutY /= RenderHeight;
+        }
+    }
+};
+
+// Frame counts after which the period and units of the sequence were first reported, -1 if never
+struct Detection
+{
+    int PeriodAt = -1;
+    int UnitsAt = -1;
+};
+
+// Feeds InFrames frames of the sequence starting from InFirstFrame
+static Detection Feed(JitterAnalyzer& InAnalyzer, const JitterSequence& InSequence, uint32_t InFrames,
+                      std::mt19937& InRng, uint32_t InFirstFrame = 0)
+{
+    Detection result;
+
+    for (uint32_t frame = 0; frame < InFrames; frame++)
+    {
+        float x;
+        float y;
+        InSequence.Get(InFirstFrame + frame, InRng, x, y);
+        InAnalyzer.AddSample(x, y, RenderWidth, RenderHeight);
+
+        if (result.PeriodAt < 0 && InAnalyzer.Period() == InSequence.Phases)
+            result.PeriodAt = frame + 1;
+
+        if (result.UnitsAt < 0 && InAnalyzer.JitterUnits() == InSequence.Units)
+            result.UnitsAt = frame + 1;
+    }
+
+    return result;
+}
+
+struct SequenceCase
+{
+    uint32_t Phases;
+    JitterAnalyzer::Units Units;
+    bool FlipX;
+    bool FlipY;
+    bool Noisy;
+};
+
+class JitterSequences : public testing::TestWithParam<SequenceCase>
+{
+};
+
+// Period, units and signs of every phase count, unit and sign combination
+TEST_P(JitterSequences, Detects)
+{
+    auto& param = GetParam();
+
+    JitterSequence sequence;
+    sequence.Phases = param.Phases;
+    sequence.Units = param.Units;
+    sequence.SignX = param.FlipX ? -1.0f : 1.0f;
+    sequence.SignY = param.FlipY ? -1.0f : 1.0f;
+    sequence.Noise = param.Noisy ? 2e-4f : 0.0f;
+
+    std::mt19937 rng(param.Phases);
+    JitterAnalyzer analyzer;
+    auto detection = Feed(analyzer, sequence, 4 * param.Phases + 100, rng);
+
+    EXPECT_EQ(analyzer.Period(), param.Phases);
+    EXPECT_EQ(analyzer.JitterUnits(), param.Units);
+    EXPECT_EQ(analyzer.FlippedX(), param.FlipX);
+    EXPECT_EQ(analyzer.FlippedY(), param.FlipY);
+    EXPECT_EQ(analyzer.ResetCount(), 0u);
+    EXPECT_NEAR(analyzer.ImpliedRatio(), std::sqrt(param.Phases / 8.0f), 1e-5f);
+
+    // Latency, locks after the second period and units are known after 32 frames or at lock
+    EXPECT_GT(detection.PeriodAt, 0);
+    EXPECT_LE(detection.PeriodAt, (int) (2 * param.Phases + 4));
+    EXPECT_GT(detection.UnitsAt, 0);
+    EXPECT_LE(detection.UnitsAt, std::max(detection.PeriodAt, 32) + 2);
+}
+
+static std::vector<SequenceCase> SequenceCases()
+{
+    std::vector<SequenceCase> cases;
+
+    for (uint32_t phases : { 4u, 8u, 18u, 32u, 72u, 128u })
+    {
+        for (auto units : { JitterAnalyzer::Units::Pixels, JitterAnalyzer::Units::Ndc, JitterAnalyzer::Units::Uv })
+        {
+            for (uint32_t flips = 0; flips < 4; flips++)
+            {
+                for (bool noisy : { false, true })
+                    cases.push_back({ phases, units, (flips & 1) != 0, (flips & 2) != 0, noisy });
+            }
+        }
+    }
+
+    return cases;
+}
+
+static std::string SequenceName(const testing::TestParamInfo<SequenceCase>& InInfo)
+{
+    const char* units[] = { "Unknown", "Pixels", "Ndc", "Uv" };
+    auto& param = InInfo.param;
+
+    return std::to_string(param.Phases) + units[(uint32_t) param.Units] + (param.FlipX ? "FlipX" : "") +
+           (param.FlipY ? "FlipY" : "") + (param.Noisy ? "Noisy" : "");
+}
+
+INSTANTIATE_TEST_SUITE_P(Halton, JitterSequences, testing::ValuesIn(SequenceCases()), SequenceName);
+
+// Scale given to JitterUnitCorrection turns NDC and UV jitter back into render pixels
+TEST(JitterAnalyzer, PixelScale)
+{
+    for (auto units : { JitterAnalyzer::Units::Pixels, JitterAnalyzer::Units::Ndc, JitterAnalyzer::Units::Uv })
+    {
+        JitterSequence sequence;
+        sequence.Phases = 18;
+        sequence.Units = units;
+
+        std::mt19937 rng(1);
+        JitterAnalyzer analyzer;
+        Feed(analyzer, sequence, 100, rng);
+        ASSERT_EQ(analyzer.JitterUnits(), units);
+
+        JitterSequence pixels = sequence;
+        pixels.Units = JitterAnalyzer::Units::Pixels;
+
+        for (uint32_t frame = 0; frame < sequence.Phases; frame++)
+        {
+            float x, y, expectedX, expectedY;
+            sequence.Get(frame, rng, x, y);
+            pixels.Get(frame, rng, expectedX, expectedY);
+
+            EXPECT_NEAR(x * analyzer.PixelScaleX(RenderWidth), expectedX, 1e-5f);
+            EXPECT_NEAR(y * analyzer.PixelScaleY(RenderHeight), expectedY, 1e-5f);
+        }
+    }
+
+    // Nothing detected, jitter is left as it is
+    JitterAnalyzer empty;
+    EXPECT_EQ(empty.PixelScaleX(RenderWidth), 1.0f);
+    EXPECT_EQ(empty.PixelScaleY(RenderHeight), 1.0f);
+}
+
+TEST(JitterAnalyzer, HaltonFromIndexZero)
+{
+    JitterSequence sequence;
+    sequence.Phases = 16;
+    sequence.FirstIndex = 0;
+
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+    Feed(analyzer, sequence, 100, rng);
+
+    EXPECT_EQ(analyzer.Period(), 16u);
+    EXPECT_EQ(analyzer.JitterUnits(), JitterAnalyzer::Units::Pixels);
+}
+
+TEST(JitterAnalyzer, RandomJitterNeverLocks)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> jitter(-0.5f, 0.5f);
+    JitterAnalyzer analyzer;
+
+    for (int frame = 0; frame < 5000; frame++)
+    {
+        analyzer.AddSample(jitter(rng), jitter(rng), RenderWidth, RenderHeight);
+        ASSERT_EQ(analyzer.Period(), 0u) << frame;
+        ASSERT_EQ(analyzer.JitterUnits(), JitterAnalyzer::Units::Unknown) << frame;
+    }
+
+    EXPECT_EQ(analyzer.ImpliedRatio(), 0.0f);
+}
+
+// Noise larger than the match tolerance hides the sequence
+TEST(JitterAnalyzer, VeryNoisyHaltonNeverLocks)
+{
+    JitterSequence sequence;
+    sequence.Noise = 0.05f;
+
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+    Feed(analyzer, sequence, 2000, rng);
+
+    EXPECT_EQ(analyzer.Period(), 0u);
+}
+
+TEST(JitterAnalyzer, ConstantJitter)
+{
+    JitterAnalyzer analyzer;
+
+    for (int frame = 0; frame < 10; frame++)
+        analyzer.AddSample(0.0f, 0.0f, RenderWidth, RenderHeight);
+
+    EXPECT_EQ(analyzer.Period(), 1u);
+    EXPECT_EQ(analyzer.ImpliedRatio(), 0.0f);
+    EXPECT_EQ(analyzer.JitterUnits(), JitterAnalyzer::Units::Unknown);
+}
+
+// Sequence restarting from its first phase is reported on that frame only
+TEST(JitterAnalyzer, ResetDetection)
+{
+    JitterSequence sequence;
+    sequence.Phases = 32;
+
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+    Feed(analyzer, sequence, 100, rng);
+    ASSERT_EQ(analyzer.Period(), 32u);
+
+    for (uint32_t frame = 0; frame < 40; frame++)
+    {
+        float x, y;
+        sequence.Get(frame, rng, x, y);
+        analyzer.AddSample(x, y, RenderWidth, RenderHeight);
+
+        EXPECT_EQ(analyzer.ResetDetected(), frame == 0) << frame;
+    }
+
+    EXPECT_EQ(analyzer.ResetCount(), 1u);
+    EXPECT_EQ(analyzer.Period(), 32u);
+    EXPECT_EQ(analyzer.JitterUnits(), JitterAnalyzer::Units::Pixels);
+
+    // Skipping ahead is a reset too
+    Feed(analyzer, sequence, 20, rng, 50);
+    EXPECT_EQ(analyzer.ResetCount(), 2u);
+    EXPECT_EQ(analyzer.Period(), 32u);
+}
+
+TEST(JitterAnalyzer, SingleOutlierKeepsLock)
+{
+    JitterSequence sequence;
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+
+    for (uint32_t frame = 0; frame < 60; frame++)
+    {
+        float x, y;
+        sequence.Get(frame, rng, x, y);
+
+        if (frame == 40)
+        {
+            x = 0.33f;
+            y = 0.11f;
+        }
+
+        analyzer.AddSample(x, y, RenderWidth, RenderHeight);
+
+        if (frame > 20)
+        {
+            EXPECT_EQ(analyzer.Period(), 8u) << frame;
+        }
+    }
+
+    EXPECT_EQ(analyzer.ResetCount(), 0u);
+}
+
+// Quality mode changes, new phase count is picked up within two periods
+TEST(JitterAnalyzer, PhaseCountChange)
+{
+    for (auto [from, to] : { std::pair { 18u, 8u }, std::pair { 8u, 18u }, std::pair { 32u, 72u } })
+    {
+        JitterSequence before;
+        before.Phases = from;
+        JitterSequence after;
+        after.Phases = to;
+
+        std::mt19937 rng(1);
+        JitterAnalyzer analyzer;
+        Feed(analyzer, before, 4 * from, rng);
+        ASSERT_EQ(analyzer.Period(), from);
+
+        auto detection = Feed(analyzer, after, 4 * to, rng);
+        EXPECT_EQ(analyzer.Period(), to) << from << " -> " << to;
+        EXPECT_GT(detection.PeriodAt, 0) << from << " -> " << to;
+        EXPECT_LE(detection.PeriodAt, (int) (2 * to + 4)) << from << " -> " << to;
+    }
+}
+
+TEST(JitterAnalyzer, ResetClearsState)
+{
+    JitterSequence sequence;
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+    Feed(analyzer, sequence, 100, rng);
+    ASSERT_EQ(analyzer.Period(), 8u);
+
+    analyzer.Reset();
+    EXPECT_EQ(analyzer.Period(), 0u);
+    EXPECT_EQ(analyzer.SampleCount(), 0u);
+    EXPECT_EQ(analyzer.JitterUnits(), JitterAnalyzer::Units::Unknown);
+
+    auto detection = Feed(analyzer, sequence, 100, rng);
+    EXPECT_LE(detection.PeriodAt, 2 * 8 + 4);
+}
+
+TEST(JitterAnalyzer, NoAllocations)
+{
+    JitterSequence sequence;
+    sequence.Phases = 72;
+
+    std::mt19937 rng(1);
+    JitterAnalyzer analyzer;
+
+    auto before = allocations.load();
+    Feed(analyzer, sequence, 10000, rng);
+
+    EXPECT_EQ(allocations.load() - before, 0u);
+    EXPECT_EQ(analyzer.Period(), 72u);
+}
@@ -0,0 +1,150 @@
+#include <upscalers/SharedTextureCache.h>
+
+#include <gtest/gtest.h>
+
+static const SharedTextureCache::TextureDesc Desc { 1920, 1080, 10, 40, 0x802 };
+
+static SharedTextureCache::Entry MakeEntry(const void* InSource, SharedTextureCache::TextureDesc InDesc = Desc)
+{
+    SharedTextureCache::Entry entry {};
+    entry.Source = InSource;
+    entry.Desc = InDesc;
+    return entry;
+}
+
+TEST(SharedTextureCache, FindsInsertedEntries)
+{
+    SharedTextureCache cache(4, 10, 2);
+    int a = 0;
+
+    EXPECT_EQ(cache.Find(&a, Desc, 0), nullptr);
+    EXPECT_EQ(cache.Misses(), 1u);
+
+    auto inserted = cache.Insert(MakeEntry(&a), 0);
+    ASSERT_NE(inserted, nullptr);
+
+    auto found = cache.Find(&a, Desc, 3);
+    EXPECT_EQ(found, inserted);
+    EXPECT_EQ(found->LastUsed, 3u);
+    EXPECT_EQ(cache.Hits(), 1u);
+}
+
+TEST(SharedTextureCache, EntriesStayValidWhileOthersAreInserted)
+{
+    SharedTextureCache cache(64, 10, 2);
+    int sources[64] {};
+
+    auto first = cache.Insert(MakeEntry(&sources[0]), 0);
+    first->Resource = &sources[0];
+
+    for (int i = 1; i < 64; i++)
+        cache.Insert(MakeEntry(&sources[i]), 0);
+
+    EXPECT_EQ(cache.Find(&sources[0], Desc, 1), first);
+    EXPECT_EQ(first->Resource, &sources[0]);
+
+    // Evicting another entry doesn't move the rest
+    std::vector<SharedTextureCache::Entry> evicted;
+    auto changed = Desc;
+    changed.Width = 1280;
+    EXPECT_EQ(cache.Find(&sources[5], changed, 1), nullptr);
+    EXPECT_EQ(cache.Collect(3, evicted), 1u);
+    EXPECT_EQ(cache.Find(&sources[0], Desc, 3), first);
+}
+
+TEST(SharedTextureCache, DifferentDescMarksStale)
+{
+    SharedTextureCache cache(4, 10, 2);
+    int a = 0;
+    cache.Insert(MakeEntry(&a), 0);
+
+    auto changed = Desc;
+    changed.Format = 28;
+    EXPECT_EQ(cache.Find(&a, changed, 1), nullptr);
+
+    // Stale entry is never returned again, even with the old desc
+    EXPECT_EQ(cache.Find(&a, Desc, 1), nullptr);
+
+    // But kept until MinAge frames passed since it was used
+    std::vector<SharedTextureCache::Entry> evicted;
+    EXPECT_EQ(cache.Collect(1, evicted), 0u);
+    EXPECT_EQ(cache.Collect(2, evicted), 1u);
+    EXPECT_EQ(evicted[0].Source, &a);
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST(SharedTextureCache, EvictsOldAndLeastRecentlyUsed)
+{
+    SharedTextureCache cache(2, 10, 3);
+    int a = 0, b = 0, c = 0;
+    std::vector<SharedTextureCache::Entry> evicted;
+
+    cache.Insert(MakeEntry(&a), 0);
+    cache.Insert(MakeEntry(&b), 1);
+    cache.Insert(MakeEntry(&c), 1);
+
+    // Over capacity but everything is possibly in flight, cache grows
+    EXPECT_EQ(cache.Collect(1, evicted), 0u);
+    EXPECT_EQ(cache.Size(), 3u);
+
+    // Least recently used one goes first
+    EXPECT_EQ(cache.Collect(4, evicted), 1u);
+    EXPECT_EQ(evicted.back().Source, &a);
+
+    // Not used for MaxAge frames
+    EXPECT_EQ(cache.Collect(11, evicted), 2u);
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST(SharedTextureCache, ClearReturnsEverything)
+{
+    SharedTextureCache cache(4, 10, 2);
+    int a = 0, b = 0;
+    cache.Insert(MakeEntry(&a), 0);
+    cache.Insert(MakeEntry(&b), 0);
+
+    std::vector<SharedTextureCache::Entry> evicted;
+    cache.Clear(evicted);
+    EXPECT_EQ(evicted.size(), 2u);
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST(SharedTexturePromotion, MatchesOnlyRecordedDescs)
+{
+    SharedTexturePromotion promotion;
+    EXPECT_FALSE(promotion.Matches(Desc));
+
+    promotion.Add(Desc);
+    promotion.Add(Desc);
+    EXPECT_EQ(promotion.Size(), 1u);
+    EXPECT_TRUE(promotion.Matches(Desc));
+
+    auto other = Desc;
+    other.BindFlags = 8;
+    EXPECT_FALSE(promotion.Matches(other));
+
+    promotion.Clear();
+    EXPECT_FALSE(promotion.Matches(Desc));
+}
+
+TEST(SharedTexturePromotion, DropsOldestWhenFull)
+{
+    SharedTexturePromotion promotion;
+
+    for (uint32_t i = 0; i < SharedTexturePromotion::Capacity + 1; i++)
+    {
+        auto desc = Desc;
+        desc.Width = 100 + i;
+        promotion.Add(desc);
+    }
+
+    EXPECT_EQ(promotion.Size(), SharedTexturePromotion::Capacity);
+
+    auto first = Desc;
+    first.Width = 100;
+    EXPECT_FALSE(promotion.Matches(first));
+
+    auto last = Desc;
+    last.Width = 100 + SharedTexturePromotion::Capacity;
+    EXPECT_TRUE(promotion.Matches(last));
+}